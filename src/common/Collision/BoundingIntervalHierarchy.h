@@ -117,6 +117,8 @@ public:
         delete[] dat.indices;
     }
     [[nodiscard]] uint32 primCount() const { return objects.size(); }
+    /// Primitive stored in the given object slot, the slots of a leaf are consecutive
+    [[nodiscard]] uint32 primIndex(uint32 slot) const { return objects[slot]; }
     G3D::AABox const& bound() const { return bounds; }
 
     template<typename RayCallback>
@@ -233,12 +235,21 @@ public:
                     {
                         // leaf - test some objects
                         int n = tree[node + 1];
-                        while (n > 0)
+                        if constexpr (requires { intersectCallback.IntersectLeaf(r, uint32(offset), uint32(n), maxDist); })
                         {
-                            bool hit = intersectCallback(r, objects[offset], maxDist, stopAtFirstHit);
+                            // callback tests the whole leaf at once, given as range of object slots (see primIndex)
+                            bool hit = intersectCallback.IntersectLeaf(r, uint32(offset), uint32(n), maxDist);
                             if (stopAtFirstHit && hit) { return; }
-                            --n;
-                            ++offset;
+                        }
+                        else
+                        {
+                            while (n > 0)
+                            {
+                                bool hit = intersectCallback(r, objects[offset], maxDist, stopAtFirstHit);
+                                if (stopAtFirstHit && hit) { return; }
+                                --n;
+                                ++offset;
+                            }
                         }
                         break;
                     }
@@ -374,6 +385,99 @@ public:
         }
     }
 
+    /// Calls intersectCallback(entry) once for every primitive in a leaf reached by box
+    template<typename IsectCallback>
+    void intersectBox(const G3D::AABox& box, IsectCallback& intersectCallback) const
+    {
+        if (!bounds.intersects(box))
+        {
+            return;
+        }
+
+        G3D::Vector3 const& lo = box.low();
+        G3D::Vector3 const& hi = box.high();
+
+        StackNode stack[MAX_STACK_SIZE];
+        int stackPos = 0;
+        int node = 0;
+
+        while (true)
+        {
+            while (true)
+            {
+                uint32 tn = tree[node];
+                uint32 axis = (tn & (3 << 30)) >> 30; // cppcheck-suppress integerOverflow
+                bool BVH2 = tn & (1 << 29); // cppcheck-suppress integerOverflow
+                int offset = tn & ~(7 << 29); // cppcheck-suppress integerOverflow
+                if (!BVH2)
+                {
+                    if (axis < 3)
+                    {
+                        // "normal" interior node
+                        float tl = intBitsToFloat(tree[node + 1]);
+                        float tr = intBitsToFloat(tree[node + 2]);
+                        bool inLeft = lo[axis] <= tl;
+                        bool inRight = hi[axis] >= tr;
+                        // box is between clip zones
+                        if (!inLeft && !inRight)
+                        {
+                            break;
+                        }
+                        int right = offset + 3;
+                        // box is in one node only
+                        if (!inLeft || !inRight)
+                        {
+                            node = inLeft ? offset : right;
+                            continue;
+                        }
+                        // box is in both nodes
+                        // push back right node
+                        stack[stackPos].node = right;
+                        stackPos++;
+                        node = offset; // left
+                        continue;
+                    }
+                    else
+                    {
+                        // leaf - test some objects
+                        int n = tree[node + 1];
+                        while (n > 0)
+                        {
+                            intersectCallback(objects[offset]);
+                            --n;
+                            ++offset;
+                        }
+                        break;
+                    }
+                }
+                else // BVH2 node (empty space cut off left and right)
+                {
+                    if (axis > 2)
+                    {
+                        return;    // should not happen
+                    }
+                    float tl = intBitsToFloat(tree[node + 1]);
+                    float tr = intBitsToFloat(tree[node + 2]);
+                    node = offset;
+                    if (tl > hi[axis] || tr < lo[axis])
+                    {
+                        break;
+                    }
+                    continue;
+                }
+            } // traversal loop
+
+            // stack is empty?
+            if (stackPos == 0)
+            {
+                return;
+            }
+            // move back up the stack
+            stackPos--;
+            node = stack[stackPos].node;
+        }
+    }
+
     bool writeToFile(FILE* wf) const;
     bool readFromFile(FILE* rf);
 
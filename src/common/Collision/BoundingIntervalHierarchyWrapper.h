@@ -61,6 +61,19 @@ class BIHWrap
                 _callback(p, *obj);
             }
         }
+
+        /// Intersect box
+        void operator() (uint32 idx)
+        {
+            if (idx >= objects_size)
+            {
+                return;
+            }
+            if (const T* obj = objects[idx])
+            {
+                _callback(*obj);
+            }
+        }
     };
 
     typedef G3D::Array<const T*> ObjArray;
@@ -126,6 +139,14 @@ public:
         MDLCallback<IsectCallback> callback(intersectCallback, m_objects.getCArray(), m_objects.size());
         m_tree.intersectPoint(point, callback);
     }
+
+    template<typename IsectCallback>
+    void intersectBox(const G3D::AABox& box, IsectCallback& intersectCallback)
+    {
+        balance();
+        MDLCallback<IsectCallback> callback(intersectCallback, m_objects.getCArray(), m_objects.size());
+        m_tree.intersectBox(box, callback);
+    }
 };
 
 #endif // _BIH_WRAP
@@ -0,0 +1,501 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _DYNAMIC_BVH_H
+#define _DYNAMIC_BVH_H
+
+#include "Define.h"
+#include "G3D/AABox.h"
+#include "G3D/BoundsTrait.h"
+#include "G3D/Ray.h"
+#include "G3D/Vector3.h"
+
+#include <algorithm>
+#include <array>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*
+ * Bounding volume hierarchy which is updated in place.
+ *
+ * Unlike BIH, which has to be rebuilt as a whole once its objects change,
+ * members are inserted and removed in O(log n): an insertion pairs the new
+ * leaf with the sibling of lowest surface area cost, a removal replaces the
+ * parent of the leaf by its sibling, and both refit the bounds of the
+ * ancestors and rotate the unbalanced ones on the way to the root. Moved
+ * objects are removed and inserted again.
+ *
+ * Queries never modify the tree, so they can run concurrently as long as no
+ * member is added or removed at the same time. balance() rebuilds the whole
+ * tree top down when members were inserted since the last build, which is
+ * only worth it after a bulk of insertions such as a grid load.
+ */
+template<class T, class BoundsFunc = BoundsTrait<T>>
+class DynamicBVH
+{
+    static constexpr int32 NullNode = -1;
+
+    struct Node
+    {
+        G3D::AABox Bounds;
+        T const* Object;
+        int32 Parent;               // next free node while in the free list
+        std::array<int32, 2> Children;
+        int32 Height;               // 0 for leaves
+
+        [[nodiscard]] bool IsLeaf() const { return Children[0] == NullNode; }
+    };
+
+    // traversal stack, spills to the heap for trees deeper than expected
+    template<class Entry>
+    class Stack
+    {
+    public:
+        void Push(Entry const& entry)
+        {
+            if (_size < _fixed.size())
+                _fixed[_size] = entry;
+            else
+                _spill.push_back(entry);
+            ++_size;
+        }
+
+        Entry Pop()
+        {
+            --_size;
+            if (_size < _fixed.size())
+                return _fixed[_size];
+
+            Entry entry = _spill.back();
+            _spill.pop_back();
+            return entry;
+        }
+
+        [[nodiscard]] bool Empty() const { return _size == 0; }
+
+    private:
+        std::array<Entry, 64> _fixed;
+        std::vector<Entry> _spill;
+        std::size_t _size = 0;
+    };
+
+public:
+    DynamicBVH() : _root(NullNode), _freeList(NullNode), _insertedSinceBuild(0) { }
+
+    void insert(T const& obj)
+    {
+        if (_leaves.count(&obj))
+            return;
+
+        G3D::AABox bounds;
+        BoundsFunc::GetBounds(obj, bounds);
+
+        int32 leaf = AllocateNode();
+        _nodes[leaf].Bounds = bounds;
+        _nodes[leaf].Object = &obj;
+        _leaves[&obj] = leaf;
+        InsertLeaf(leaf);
+        ++_insertedSinceBuild;
+    }
+
+    void remove(T const& obj)
+    {
+        auto itr = _leaves.find(&obj);
+        if (itr == _leaves.end())
+            return;
+
+        int32 leaf = itr->second;
+        _leaves.erase(itr);
+        RemoveLeaf(leaf);
+        FreeNode(leaf);
+    }
+
+    // rebuilds the tree top down, splitting the members at the median of their longest axis
+    void balance()
+    {
+        if (!_insertedSinceBuild)
+            return;
+
+        _insertedSinceBuild = 0;
+        if (_leaves.size() < 3)
+            return;
+
+        std::vector<std::pair<T const*, G3D::AABox>> members;
+        members.reserve(_leaves.size());
+        for (auto const& [obj, leaf] : _leaves)
+            members.emplace_back(obj, _nodes[leaf].Bounds);
+
+        _nodes.clear();
+        _freeList = NullNode;
+        _nodes.reserve(members.size() * 2 - 1);
+        _root = Build(members, 0, members.size(), NullNode);
+    }
+
+    [[nodiscard]] bool contains(T const& obj) const { return _leaves.count(&obj) != 0; }
+    [[nodiscard]] std::size_t size() const { return _leaves.size(); }
+    [[nodiscard]] int32 height() const { return _root == NullNode ? 0 : _nodes[_root].Height; }
+
+    template<typename RayCallback>
+    void intersectRay(G3D::Ray const& ray, RayCallback& intersectCallback, float& maxDist, bool stopAtFirstHit) const
+    {
+        float entry;
+        if (_root == NullNode || !IntersectRay(_nodes[_root].Bounds, ray, maxDist, entry))
+            return;
+
+        // nearer children are visited first, so hits shrink maxDist before the farther ones are tested
+        Stack<std::pair<int32, float>> stack;
+        stack.Push({ _root, entry });
+        while (!stack.Empty())
+        {
+            auto [index, nodeEntry] = stack.Pop();
+            if (nodeEntry > maxDist)
+                continue;
+
+            Node const& node = _nodes[index];
+            if (node.IsLeaf())
+            {
+                if (intersectCallback(ray, *node.Object, maxDist, stopAtFirstHit) && stopAtFirstHit)
+                    return;
+
+                continue;
+            }
+
+            float entries[2];
+            bool hits[2];
+            for (uint8 i = 0; i < 2; ++i)
+                hits[i] = IntersectRay(_nodes[node.Children[i]].Bounds, ray, maxDist, entries[i]);
+
+            uint8 nearer = (hits[0] && hits[1] && entries[1] < entries[0]) || !hits[0] ? 1 : 0;
+            uint8 farther = 1 - nearer;
+            if (hits[farther])
+                stack.Push({ node.Children[farther], entries[farther] });
+            if (hits[nearer])
+                stack.Push({ node.Children[nearer], entries[nearer] });
+        }
+    }
+
+    template<typename IsectCallback>
+    void intersectPoint(G3D::Vector3 const& point, IsectCallback& intersectCallback) const
+    {
+        if (_root == NullNode)
+            return;
+
+        Stack<int32> stack;
+        stack.Push(_root);
+        while (!stack.Empty())
+        {
+            Node const& node = _nodes[stack.Pop()];
+            if (!node.Bounds.contains(point))
+                continue;
+
+            if (node.IsLeaf())
+                intersectCallback(point, *node.Object);
+            else
+            {
+                stack.Push(node.Children[1]);
+                stack.Push(node.Children[0]);
+            }
+        }
+    }
+
+    template<typename IsectCallback>
+    void intersectBox(G3D::AABox const& box, IsectCallback& intersectCallback) const
+    {
+        if (_root == NullNode)
+            return;
+
+        Stack<int32> stack;
+        stack.Push(_root);
+        while (!stack.Empty())
+        {
+            Node const& node = _nodes[stack.Pop()];
+            if (!Overlaps(node.Bounds, box))
+                continue;
+
+            if (node.IsLeaf())
+                intersectCallback(*node.Object);
+            else
+            {
+                stack.Push(node.Children[1]);
+                stack.Push(node.Children[0]);
+            }
+        }
+    }
+
+private:
+    static G3D::AABox Merge(G3D::AABox const& a, G3D::AABox const& b)
+    {
+        return G3D::AABox(a.low().min(b.low()), a.high().max(b.high()));
+    }
+
+    static bool Overlaps(G3D::AABox const& a, G3D::AABox const& b)
+    {
+        for (uint8 i = 0; i < 3; ++i)
+            if (a.low()[i] > b.high()[i] || b.low()[i] > a.high()[i])
+                return false;
+
+        return true;
+    }
+
+    // slab test, entry is the distance along the ray at which it enters the box
+    static bool IntersectRay(G3D::AABox const& box, G3D::Ray const& ray, float maxDist, float& entry)
+    {
+        float tMin = 0.0f;
+        float tMax = maxDist;
+        for (uint8 i = 0; i < 3; ++i)
+        {
+            float const origin = ray.origin()[i];
+            if (ray.direction()[i] == 0.0f)
+            {
+                if (origin < box.low()[i] || origin > box.high()[i])
+                    return false;
+
+                continue;
+            }
+
+            float const invDir = ray.invDirection()[i];
+            float t1 = (box.low()[i] - origin) * invDir;
+            float t2 = (box.high()[i] - origin) * invDir;
+            if (t1 > t2)
+                std::swap(t1, t2);
+
+            tMin = std::max(tMin, t1);
+            tMax = std::min(tMax, t2);
+            if (tMin > tMax)
+                return false;
+        }
+
+        entry = tMin;
+        return true;
+    }
+
+    int32 AllocateNode()
+    {
+        int32 index;
+        if (_freeList != NullNode)
+        {
+            index = _freeList;
+            _freeList = _nodes[index].Parent;
+        }
+        else
+        {
+            index = int32(_nodes.size());
+            _nodes.emplace_back();
+        }
+
+        Node& node = _nodes[index];
+        node.Object = nullptr;
+        node.Parent = NullNode;
+        node.Children = { NullNode, NullNode };
+        node.Height = 0;
+        return index;
+    }
+
+    void FreeNode(int32 index)
+    {
+        _nodes[index].Parent = _freeList;
+        _nodes[index].Height = -1;
+        _freeList = index;
+    }
+
+    void InsertLeaf(int32 leaf)
+    {
+        if (_root == NullNode)
+        {
+            _root = leaf;
+            _nodes[leaf].Parent = NullNode;
+            return;
+        }
+
+        // descend while pairing the leaf with a child is cheaper than with the node itself
+        G3D::AABox const bounds = _nodes[leaf].Bounds;
+        int32 sibling = _root;
+        while (!_nodes[sibling].IsLeaf())
+        {
+            Node const& node = _nodes[sibling];
+            float const combinedArea = Merge(node.Bounds, bounds).area();
+            float const cost = 2.0f * combinedArea;
+            // the node and all of its ancestors grow when the leaf goes below it
+            float const inheritanceCost = 2.0f * (combinedArea - node.Bounds.area());
+
+            float childCosts[2];
+            for (uint8 i = 0; i < 2; ++i)
+            {
+                Node const& child = _nodes[node.Children[i]];
+                float const mergedArea = Merge(child.Bounds, bounds).area();
+                childCosts[i] = (child.IsLeaf() ? mergedArea : mergedArea - child.Bounds.area()) + inheritanceCost;
+            }
+
+            if (cost < childCosts[0] && cost < childCosts[1])
+                break;
+
+            sibling = childCosts[0] < childCosts[1] ? node.Children[0] : node.Children[1];
+        }
+
+        int32 oldParent = _nodes[sibling].Parent;
+        int32 newParent = AllocateNode();
+        _nodes[newParent].Parent = oldParent;
+        _nodes[newParent].Bounds = Merge(_nodes[sibling].Bounds, bounds);
+        _nodes[newParent].Height = _nodes[sibling].Height + 1;
+        _nodes[newParent].Children = { sibling, leaf };
+        _nodes[sibling].Parent = newParent;
+        _nodes[leaf].Parent = newParent;
+
+        if (oldParent == NullNode)
+            _root = newParent;
+        else
+            ReplaceChild(oldParent, sibling, newParent);
+
+        Refit(_nodes[leaf].Parent);
+    }
+
+    void RemoveLeaf(int32 leaf)
+    {
+        if (leaf == _root)
+        {
+            _root = NullNode;
+            return;
+        }
+
+        int32 parent = _nodes[leaf].Parent;
+        int32 grandParent = _nodes[parent].Parent;
+        int32 sibling = _nodes[parent].Children[0] == leaf ? _nodes[parent].Children[1] : _nodes[parent].Children[0];
+
+        _nodes[sibling].Parent = grandParent;
+        FreeNode(parent);
+
+        if (grandParent == NullNode)
+        {
+            _root = sibling;
+            return;
+        }
+
+        ReplaceChild(grandParent, parent, sibling);
+        Refit(grandParent);
+    }
+
+    void ReplaceChild(int32 parent, int32 oldChild, int32 newChild)
+    {
+        std::array<int32, 2>& children = _nodes[parent].Children;
+        children[children[0] == oldChild ? 0 : 1] = newChild;
+    }
+
+    // restores bounds and heights from index up to the root
+    void Refit(int32 index)
+    {
+        while (index != NullNode)
+        {
+            index = Rotate(index);
+
+            Node& node = _nodes[index];
+            Node const& left = _nodes[node.Children[0]];
+            Node const& right = _nodes[node.Children[1]];
+            node.Height = 1 + std::max(left.Height, right.Height);
+            node.Bounds = Merge(left.Bounds, right.Bounds);
+
+            index = node.Parent;
+        }
+    }
+
+    // lifts the higher grandchild of a node whose children differ in height by more than one, returns the node now in its place
+    int32 Rotate(int32 a)
+    {
+        if (_nodes[a].IsLeaf() || _nodes[a].Height < 2)
+            return a;
+
+        int32 const b = _nodes[a].Children[0];
+        int32 const c = _nodes[a].Children[1];
+        int32 const balance = _nodes[c].Height - _nodes[b].Height;
+        if (balance > 1)
+            return RotateUp(a, c, 1);
+        if (balance < -1)
+            return RotateUp(a, b, 0);
+
+        return a;
+    }
+
+    // moves child (at side of a) above a, a keeps the lower child of child
+    int32 RotateUp(int32 a, int32 child, uint8 side)
+    {
+        Node& nodeA = _nodes[a];
+        Node& nodeChild = _nodes[child];
+        int32 const f = nodeChild.Children[0];
+        int32 const g = nodeChild.Children[1];
+
+        nodeChild.Children[0] = a;
+        nodeChild.Parent = nodeA.Parent;
+        nodeA.Parent = child;
+
+        if (nodeChild.Parent == NullNode)
+            _root = child;
+        else
+            ReplaceChild(nodeChild.Parent, a, child);
+
+        int32 const kept = _nodes[f].Height > _nodes[g].Height ? f : g;
+        int32 const moved = kept == f ? g : f;
+        nodeChild.Children[1] = kept;
+        nodeA.Children[side] = moved;
+        _nodes[moved].Parent = a;
+
+        int32 const other = nodeA.Children[1 - side];
+        nodeA.Bounds = Merge(_nodes[other].Bounds, _nodes[moved].Bounds);
+        nodeA.Height = 1 + std::max(_nodes[other].Height, _nodes[moved].Height);
+        nodeChild.Bounds = Merge(nodeA.Bounds, _nodes[kept].Bounds);
+        nodeChild.Height = 1 + std::max(nodeA.Height, _nodes[kept].Height);
+        return child;
+    }
+
+    int32 Build(std::vector<std::pair<T const*, G3D::AABox>>& members, std::size_t begin, std::size_t end, int32 parent)
+    {
+        int32 index = AllocateNode();
+        _nodes[index].Parent = parent;
+
+        if (end - begin == 1)
+        {
+            _nodes[index].Bounds = members[begin].second;
+            _nodes[index].Object = members[begin].first;
+            _leaves[members[begin].first] = index;
+            return index;
+        }
+
+        G3D::AABox centers(members[begin].second.center());
+        for (std::size_t i = begin + 1; i < end; ++i)
+            centers.merge(members[i].second.center());
+
+        G3D::Vector3 const extent = centers.extent();
+        uint8 axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : (extent.y >= extent.z ? 1 : 2);
+        std::size_t const middle = begin + (end - begin) / 2;
+        std::nth_element(members.begin() + begin, members.begin() + middle, members.begin() + end,
+            [axis](auto const& left, auto const& right) { return left.second.center()[axis] < right.second.center()[axis]; });
+
+        int32 left = Build(members, begin, middle, index);
+        int32 right = Build(members, middle, end, index);
+        _nodes[index].Children = { left, right };
+        _nodes[index].Bounds = Merge(_nodes[left].Bounds, _nodes[right].Bounds);
+        _nodes[index].Height = 1 + std::max(_nodes[left].Height, _nodes[right].Height);
+        return index;
+    }
+
+    std::vector<Node> _nodes;
+    int32 _root;
+    int32 _freeList;
+    std::unordered_map<T const*, int32> _leaves;
+    uint32 _insertedSinceBuild;
+};
+
+#endif // _DYNAMIC_BVH_H
@@ -16,13 +16,12 @@
  */
 
 #include "DynamicTree.h"
-#include "BoundingIntervalHierarchyWrapper.h"
+#include "DynamicBoundingVolumeHierarchy.h"
 #include "GameObjectModel.h"
 #include "MapTree.h"
 #include "ModelIgnoreFlags.h"
 #include "ModelInstance.h"
 #include "RegularGrid.h"
-#include "Timer.h"
 #include "VMapFactory.h"
 #include "VMapMgr2.h"
 #include "WorldModel.h"
@@ -30,14 +29,10 @@
 #include <G3D/AABox.h>
 #include <G3D/Ray.h>
 #include <G3D/Vector3.h>
+#include <algorithm>
 
 using VMAP::ModelInstance;
 
-namespace
-{
-    int CHECK_TREE_PERIOD = 200;
-}
-
 template<> struct HashTrait< GameObjectModel>
 {
     static std::size_t hashCode(const GameObjectModel& g) { return (size_t)(void*)&g; }
@@ -54,57 +49,11 @@ template<> struct BoundsTrait< GameObjectModel>
     static void GetBounds2(const GameObjectModel* g, G3D::AABox& out) { out = g->GetBounds();}
 };
 
-typedef RegularGrid2D<GameObjectModel, BIHWrap<GameObjectModel>> ParentTree;
+typedef RegularGrid2D<GameObjectModel, DynamicBVH<GameObjectModel>> ParentTree;
 
+// cells refit their hierarchy on every insert and remove, there is nothing left to rebuild periodically
 struct DynTreeImpl : public ParentTree
 {
-    typedef GameObjectModel Model;
-    typedef ParentTree base;
-
-    DynTreeImpl() :
-        rebalance_timer(CHECK_TREE_PERIOD),
-        unbalanced_times(0)
-    {
-    }
-
-    void insert(const Model& mdl)
-    {
-        base::insert(mdl);
-        ++unbalanced_times;
-    }
-
-    void remove(const Model& mdl)
-    {
-        base::remove(mdl);
-        ++unbalanced_times;
-    }
-
-    void balance()
-    {
-        base::balance();
-        unbalanced_times = 0;
-    }
-
-    void update(uint32 difftime)
-    {
-        if (!size())
-        {
-            return;
-        }
-
-        rebalance_timer.Update(difftime);
-        if (rebalance_timer.Passed())
-        {
-            rebalance_timer.Reset(CHECK_TREE_PERIOD);
-            if (unbalanced_times > 0)
-            {
-                balance();
-            }
-        }
-    }
-
-    TimeTrackerSmall rebalance_timer;
-    int unbalanced_times;
 };
 
 DynamicMapTree::DynamicMapTree() : impl(new DynTreeImpl()) { }
@@ -139,10 +88,18 @@ int DynamicMapTree::size() const
     return impl->size();
 }
 
-void DynamicMapTree::update(uint32 t_diff)
+struct DynamicTreeBoxCallback
 {
-    impl->update(t_diff);
-}
+    DynamicTreeBoxCallback(std::vector<GameObjectModel const*>& candidates) : _candidates(candidates) { }
+
+    void operator()(const GameObjectModel& obj)
+    {
+        _candidates.push_back(&obj);
+    }
+
+private:
+    std::vector<GameObjectModel const*>& _candidates;
+};
 
 struct DynamicTreeIntersectionCallback
 {
@@ -272,6 +229,78 @@ bool DynamicMapTree::isInLineOfSight(float x1, float y1, float z1, float x2, flo
     return !callback.didHit();
 }
 
+void DynamicMapTree::isInLineOfSightBatch(std::span<std::pair<G3D::Vector3, G3D::Vector3> const> segments, std::vector<bool>& inLineOfSight, uint32 phasemask, VMAP::ModelIgnoreFlags ignoreFlags) const
+{
+    ASSERT(inLineOfSight.size() == segments.size());
+
+    if (!impl->size())
+    {
+        return;
+    }
+
+    Optional<G3D::AABox> bounds;
+    for (std::size_t i = 0; i < segments.size(); ++i)
+    {
+        if (!inLineOfSight[i])
+        {
+            continue;
+        }
+
+        if (!bounds)
+        {
+            bounds.emplace(segments[i].first);
+        }
+        else
+        {
+            bounds->merge(segments[i].first);
+        }
+        bounds->merge(segments[i].second);
+    }
+
+    if (!bounds)
+    {
+        return;
+    }
+
+    // models spanning several grid cells are reported once per cell
+    std::vector<GameObjectModel const*> candidates;
+    DynamicTreeBoxCallback boxCallback(candidates);
+    impl->intersectBox(*bounds, boxCallback);
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+    if (candidates.empty())
+    {
+        return;
+    }
+
+    for (std::size_t i = 0; i < segments.size(); ++i)
+    {
+        if (!inLineOfSight[i])
+        {
+            continue;
+        }
+
+        G3D::Vector3 const& v1 = segments[i].first;
+        G3D::Vector3 const& v2 = segments[i].second;
+        float maxDist = (v2 - v1).magnitude();
+        if (!G3D::fuzzyGt(maxDist, 0))
+        {
+            continue;
+        }
+
+        G3D::Ray r(v1, (v2 - v1) / maxDist);
+        for (GameObjectModel const* model : candidates)
+        {
+            float distance = maxDist;
+            if (model->intersectRay(r, distance, true, phasemask, ignoreFlags))
+            {
+                inLineOfSight[i] = false;
+                break;
+            }
+        }
+    }
+}
+
 float DynamicMapTree::getHeight(float x, float y, float z, float maxSearchDist, uint32 phasemask) const
 {
     G3D::Vector3 v(x, y, z);
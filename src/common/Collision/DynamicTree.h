@@ -20,6 +20,9 @@
 
 #include "Define.h"
 #include "Optional.h"
+#include <span>
+#include <utility>
+#include <vector>
 
 namespace G3D
 {
@@ -45,6 +48,8 @@ public:
     ~DynamicMapTree();
 
     [[nodiscard]] bool isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, VMAP::ModelIgnoreFlags ignoreFlags) const;
+    /// Clears inLineOfSight[i] if segment i (start, end) is blocked, segments already cleared are skipped
+    void isInLineOfSightBatch(std::span<std::pair<G3D::Vector3, G3D::Vector3> const> segments, std::vector<bool>& inLineOfSight, uint32 phasemask, VMAP::ModelIgnoreFlags ignoreFlags) const;
 
     bool GetIntersectionTime(uint32 phasemask, const G3D::Ray& ray, const G3D::Vector3& endPos, float& maxDist) const;
 
@@ -61,8 +66,8 @@ public:
     [[nodiscard]] bool contains(const GameObjectModel&) const;
     [[nodiscard]] int size() const;
 
+    /// Rebuilds the cells which got members since their last rebuild, for bulk insertions
     void balance();
-    void update(uint32 diff);
 };
 
 #endif // _DYNTREE_H
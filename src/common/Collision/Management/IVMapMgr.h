@@ -21,7 +21,15 @@
 #include "Define.h"
 #include "ModelIgnoreFlags.h"
 #include "Optional.h"
+#include <span>
 #include <string>
+#include <utility>
+#include <vector>
+
+namespace G3D
+{
+    class Vector3;
+}
 
 //===========================================================
 
@@ -96,8 +104,18 @@ namespace VMAP
         virtual void unloadMap(unsigned int pMapId) = 0;
 
         virtual bool isInLineOfSight(unsigned int pMapId, float x1, float y1, float z1, float x2, float y2, float z2, ModelIgnoreFlags ignoreFlags) = 0;
+        /**
+        isInLineOfSight for many segments (start, end) at once, clears inLineOfSight[i] if segment i is blocked.
+        Segments already cleared are not tested.
+        */
+        virtual void isInLineOfSightBatch(unsigned int pMapId, std::span<std::pair<G3D::Vector3, G3D::Vector3> const> segments, std::vector<bool>& inLineOfSight, ModelIgnoreFlags ignoreFlags) = 0;
         virtual float getHeight(unsigned int pMapId, float x, float y, float z, float maxSearchDist) = 0;
         /**
+        Changes whenever a tile of the map is loaded or unloaded, results of queries against the map
+        are valid as long as it does not change. 0 if no tile of the map is loaded.
+        */
+        [[nodiscard]] virtual uint32 GetTreeGeneration(unsigned int pMapId) const = 0;
+        /**
         test if we hit an object. return true if we hit one. rx, ry, rz will hold the hit position or the dest position, if no intersection was found
         return a position, that is pReduceDist closer to the origin
         */
@@ -20,6 +20,11 @@
 #include "Errors.h"
 #include "Log.h"
 #include "MapDefines.h"
+#include "Metric.h"
+#include "Util.h"
+#include <boost/interprocess/file_mapping.hpp>
+#include <filesystem>
+#include <zlib.h>
 
 namespace MMAP
 {
@@ -142,6 +147,8 @@ namespace MMAP
             return false;
         }
 
+        auto loadStart = std::chrono::steady_clock::now();
+
         // load this tile :: mmaps/MMMXXYY.mmtile
         std::string fileName = Acore::StringFormat(TILE_FILE_NAME_FORMAT, sConfigMgr->GetOption<std::string>("DataDir", "."), mapId, x, y);
         FILE* file = fopen(fileName.c_str(), "rb");
@@ -168,36 +175,228 @@ namespace MMAP
             return false;
         }
 
-        unsigned char* data = (unsigned char*)dtAlloc(fileHeader.size, DT_ALLOC_PERM);
-        ASSERT(data);
+        unsigned char* data = nullptr;
+        uint32 dataSize = fileHeader.size;
+        int tileFlags = DT_TILE_FREE_DATA;
+        METRIC_TIMER("mmap_tile_load_time", METRIC_TAG("compressed", fileHeader.compressed ? "1" : "0"));
+
+        // compressed tiles are mapped from their inflated copy in the shared tile cache, or inflated into an allocated buffer
+        std::string mappedFileName;
+        if (sConfigMgr->GetOption<bool>("MoveMaps.MemoryMappedTiles", false))
+        {
+            if (!fileHeader.compressed)
+                mappedFileName = fileName;
+            else if (std::string const cacheDir = sConfigMgr->GetOption<std::string>("MoveMaps.SharedTileCacheDir", ""); !cacheDir.empty())
+            {
+                mappedFileName = Acore::StringFormat("{}/{:03}{:02}{:02}.mmtile", cacheDir, mapId, x, y);
+                if (!getInflatedTileFile(file, fileName, fileHeader.size, mappedFileName, dataSize))
+                {
+                    LOG_ERROR("maps", "MMAP:loadMap: Could not inflate {:03}{:02}{:02}.mmtile into '{}'", mapId, x, y, mappedFileName);
+                    fclose(file);
+                    return false;
+                }
+            }
+        }
 
-        std::size_t result = fread(data, fileHeader.size, 1, file);
-        if (!result)
+        if (!mappedFileName.empty())
         {
-            LOG_ERROR("maps", "MMAP:loadMap: Bad header or data in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
             fclose(file);
-            return false;
+            file = nullptr;
+
+            // detour links the polygons in place, only the pages it writes to become private to the process
+            data = mapTileData(mmap, packedGridPos, mappedFileName, dataSize);
+            if (!data)
+            {
+                LOG_ERROR("maps", "MMAP:loadMap: Could not map {:03}{:02}{:02}.mmtile", mapId, x, y);
+                return false;
+            }
+
+            tileFlags = 0;
         }
+        else if (fileHeader.compressed)
+        {
+            data = readCompressedTileData(file, fileHeader.size, dataSize);
+            fclose(file);
+            if (!data)
+            {
+                LOG_ERROR("maps", "MMAP:loadMap: Bad compressed data in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
+                return false;
+            }
+        }
+        else
+        {
+            data = (unsigned char*)dtAlloc(fileHeader.size, DT_ALLOC_PERM);
+            ASSERT(data);
 
-        fclose(file);
+            std::size_t result = fread(data, fileHeader.size, 1, file);
+            if (!result)
+            {
+                LOG_ERROR("maps", "MMAP:loadMap: Bad header or data in mmap {:03}{:02}{:02}.mmtile", mapId, x, y);
+                fclose(file);
+                return false;
+            }
+
+            fclose(file);
+        }
 
         dtTileRef tileRef = 0;
 
         // memory allocated for data is now managed by detour, and will be deallocated when the tile is removed
-        if (dtStatusSucceed(mmap->navMesh->addTile(data, fileHeader.size, DT_TILE_FREE_DATA, 0, &tileRef)))
+        // mapped data is released by releaseTileData instead
+        if (dtStatusSucceed(mmap->navMesh->addTile(data, dataSize, tileFlags, 0, &tileRef)))
         {
             mmap->loadedTileRefs.insert(std::pair<uint32, dtTileRef>(packedGridPos, tileRef));
             ++loadedTiles;
+            tileLoadStats.Loads.fetch_add(1, std::memory_order_relaxed);
+            if (fileHeader.compressed)
+                tileLoadStats.CompressedLoads.fetch_add(1, std::memory_order_relaxed);
+            tileLoadStats.FileBytes.fetch_add(fileHeader.size, std::memory_order_relaxed);
+            tileLoadStats.DataBytes.fetch_add(dataSize, std::memory_order_relaxed);
+            tileLoadStats.LoadTimeUs.fetch_add(uint64(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - loadStart).count()), std::memory_order_relaxed);
             dtMeshHeader* header = (dtMeshHeader*)data;
             LOG_DEBUG("maps", "MMAP:loadMap: Loaded mmtile {:03}[{:02},{:02}] into {:03}[{:02},{:02}]", mapId, x, y, mapId, header->x, header->y);
             return true;
         }
 
         LOG_ERROR("maps", "MMAP:loadMap: Could not load {:03}{:02}{:02}.mmtile into navmesh", mapId, x, y);
-        dtFree(data);
+        if (tileFlags & DT_TILE_FREE_DATA)
+        {
+            dtFree(data);
+        }
+        else
+        {
+            releaseTileData(mmap, packedGridPos);
+        }
         return false;
     }
 
+    unsigned char* MMapMgr::readCompressedTileData(FILE* file, uint32 fileSize, uint32& dataSize)
+    {
+        if (fileSize <= sizeof(uint32))
+            return nullptr;
+
+        std::vector<Bytef> compressedData(fileSize);
+        if (fread(compressedData.data(), fileSize, 1, file) != 1)
+            return nullptr;
+
+        memcpy(&dataSize, compressedData.data(), sizeof(uint32));
+        unsigned char* data = (unsigned char*)dtAlloc(dataSize, DT_ALLOC_PERM);
+        ASSERT(data);
+
+        uLongf inflatedSize = dataSize;
+        if (uncompress(data, &inflatedSize, compressedData.data() + sizeof(uint32), uLong(fileSize - sizeof(uint32))) != Z_OK || inflatedSize != dataSize)
+        {
+            dtFree(data);
+            return nullptr;
+        }
+
+        return data;
+    }
+
+    bool MMapMgr::getInflatedTileFile(FILE* file, std::string const& fileName, uint32 fileSize, std::string const& cacheFileName, uint32& dataSize)
+    {
+        namespace fs = std::filesystem;
+
+        // an inflated copy at least as recent as the mmtile was written by this or another worldserver
+        std::error_code error;
+        fs::file_time_type const sourceTime = fs::last_write_time(fileName, error);
+        if (!error)
+        {
+            fs::file_time_type const cacheTime = fs::last_write_time(cacheFileName, error);
+            if (!error && cacheTime >= sourceTime)
+            {
+                if (FILE* cacheFile = fopen(cacheFileName.c_str(), "rb"))
+                {
+                    MmapTileHeader cacheHeader;
+                    bool const valid = fread(&cacheHeader, sizeof(MmapTileHeader), 1, cacheFile) == 1 && cacheHeader.mmapMagic == MMAP_MAGIC &&
+                        cacheHeader.mmapVersion == MMAP_VERSION && !cacheHeader.compressed;
+                    fclose(cacheFile);
+                    if (valid)
+                    {
+                        dataSize = cacheHeader.size;
+                        return true;
+                    }
+                }
+            }
+        }
+
+        unsigned char* data = readCompressedTileData(file, fileSize, dataSize);
+        if (!data)
+            return false;
+
+        // written under a name of this process and renamed, so other processes only ever see complete copies
+        fs::create_directories(fs::path(cacheFileName).parent_path(), error);
+        std::string const tempFileName = Acore::StringFormat("{}.{}", cacheFileName, GetPID());
+        FILE* cacheFile = fopen(tempFileName.c_str(), "wb");
+        if (!cacheFile)
+        {
+            dtFree(data);
+            return false;
+        }
+
+        MmapTileHeader cacheHeader;
+        fseek(file, 0, SEEK_SET);
+        bool written = fread(&cacheHeader, sizeof(MmapTileHeader), 1, file) == 1;
+        cacheHeader.compressed = false;
+        cacheHeader.size = dataSize;
+        written = written && fwrite(&cacheHeader, sizeof(MmapTileHeader), 1, cacheFile) == 1 && fwrite(data, dataSize, 1, cacheFile) == 1;
+        written = fclose(cacheFile) == 0 && written;
+        dtFree(data);
+
+        if (written)
+            fs::rename(tempFileName, cacheFileName, error);
+
+        if (!written || error)
+        {
+            fs::remove(tempFileName, error);
+            return false;
+        }
+
+        return true;
+    }
+
+    MMapMgr::TileLoadStats MMapMgr::GetTileLoadStats() const
+    {
+        return
+        {
+            tileLoadStats.Loads.load(std::memory_order_relaxed),
+            tileLoadStats.CompressedLoads.load(std::memory_order_relaxed),
+            tileLoadStats.FileBytes.load(std::memory_order_relaxed),
+            tileLoadStats.DataBytes.load(std::memory_order_relaxed),
+            tileLoadStats.LoadTimeUs.load(std::memory_order_relaxed)
+        };
+    }
+
+    unsigned char* MMapMgr::mapTileData(MMapData* mmap, uint32 packedGridPos, std::string const& fileName, uint32 dataSize)
+    {
+        std::unique_ptr<boost::interprocess::mapped_region> region;
+        try
+        {
+            boost::interprocess::file_mapping mapping(fileName.c_str(), boost::interprocess::read_only);
+            region = std::make_unique<boost::interprocess::mapped_region>(mapping, boost::interprocess::copy_on_write);
+        }
+        catch (boost::interprocess::interprocess_exception const& e)
+        {
+            LOG_ERROR("maps", "MMAP:mapTileData: Could not map '{}': {}", fileName, e.what());
+            return nullptr;
+        }
+
+        if (region->get_size() < sizeof(MmapTileHeader) + dataSize)
+        {
+            LOG_ERROR("maps", "MMAP:mapTileData: '{}' is shorter than its header states", fileName);
+            return nullptr;
+        }
+
+        unsigned char* data = static_cast<unsigned char*>(region->get_address()) + sizeof(MmapTileHeader);
+        mmap->mappedTiles[packedGridPos] = std::move(region);
+        return data;
+    }
+
+    void MMapMgr::releaseTileData(MMapData* mmap, uint32 packedGridPos)
+    {
+        mmap->mappedTiles.erase(packedGridPos);
+    }
+
     bool MMapMgr::unloadMap(uint32 mapId, int32 x, int32 y)
     {
         // check if we have this map loaded
@@ -232,7 +431,9 @@ namespace MMAP
             ABORT();
         }
 
+        releaseTileData(mmap, packedGridPos);
         mmap->loadedTileRefs.erase(packedGridPos);
+        ++mmap->tileGeneration;
         --loadedTiles;
         LOG_DEBUG("maps", "MMAP:unloadMap: Unloaded mmtile {:03}[{:02},{:02}] from {:03}", mapId, x, y, mapId);
         return true;
@@ -285,16 +486,18 @@ namespace MMAP
         }
 
         MMapData* mmap = itr->second;
-        if (mmap->navMeshQueries.find(instanceId) == mmap->navMeshQueries.end())
+        std::lock_guard<std::mutex> guard(mmap->navMeshQueriesLock);
+        auto queries = mmap->navMeshQueries.find(instanceId);
+        if (queries == mmap->navMeshQueries.end())
         {
             LOG_DEBUG("maps", "MMAP:unloadMapInstance: Asked to unload not loaded dtNavMeshQuery mapId {:03} instanceId {}", mapId, instanceId);
             return false;
         }
 
-        dtNavMeshQuery* query = mmap->navMeshQueries[instanceId];
+        for (auto& threadQuery : queries->second)
+            dtFreeNavMeshQuery(threadQuery.second);
 
-        dtFreeNavMeshQuery(query);
-        mmap->navMeshQueries.erase(instanceId);
+        mmap->navMeshQueries.erase(queries);
         LOG_DEBUG("maps", "MMAP:unloadMapInstance: Unloaded mapId {:03} instanceId {}", mapId, instanceId);
 
         return true;
@@ -311,6 +514,17 @@ namespace MMAP
         return itr->second->navMesh;
     }
 
+    uint32 MMapMgr::GetTileGeneration(uint32 mapId) const
+    {
+        MMapDataSet::const_iterator itr = GetMMapData(mapId);
+        if (itr == loadedMMaps.end())
+        {
+            return 0;
+        }
+
+        return itr->second->tileGeneration;
+    }
+
     dtNavMeshQuery const* MMapMgr::GetNavMeshQuery(uint32 mapId, uint32 instanceId)
     {
         MMapDataSet::const_iterator itr = GetMMapData(mapId);
@@ -320,27 +534,25 @@ namespace MMAP
         }
 
         MMapData* mmap = itr->second;
-        if (mmap->navMeshQueries.find(instanceId) == mmap->navMeshQueries.end())
-        {
-            // check again after acquiring mutex
-            if (mmap->navMeshQueries.find(instanceId) == mmap->navMeshQueries.end())
-            {
-                // allocate mesh query
-                dtNavMeshQuery* query = dtAllocNavMeshQuery();
-                ASSERT(query);
+        std::lock_guard<std::mutex> guard(mmap->navMeshQueriesLock);
+        NavMeshThreadQuerySet& threadQueries = mmap->navMeshQueries[instanceId];
+        auto query = threadQueries.find(std::this_thread::get_id());
+        if (query != threadQueries.end())
+            return query->second;
 
-                if (dtStatusFailed(query->init(mmap->navMesh, 1024)))
-                {
-                    dtFreeNavMeshQuery(query);
-                    LOG_ERROR("maps", "MMAP:GetNavMeshQuery: Failed to initialize dtNavMeshQuery for mapId {:03} instanceId {}", mapId, instanceId);
-                    return nullptr;
-                }
+        // allocate mesh query
+        dtNavMeshQuery* newQuery = dtAllocNavMeshQuery();
+        ASSERT(newQuery);
 
-                LOG_DEBUG("maps", "MMAP:GetNavMeshQuery: created dtNavMeshQuery for mapId {:03} instanceId {}", mapId, instanceId);
-                mmap->navMeshQueries.insert(std::pair<uint32, dtNavMeshQuery*>(instanceId, query));
-            }
+        if (dtStatusFailed(newQuery->init(mmap->navMesh, 1024)))
+        {
+            dtFreeNavMeshQuery(newQuery);
+            LOG_ERROR("maps", "MMAP:GetNavMeshQuery: Failed to initialize dtNavMeshQuery for mapId {:03} instanceId {}", mapId, instanceId);
+            return nullptr;
         }
 
-        return mmap->navMeshQueries[instanceId];
+        LOG_DEBUG("maps", "MMAP:GetNavMeshQuery: created dtNavMeshQuery for mapId {:03} instanceId {} ({} threads)", mapId, instanceId, threadQueries.size() + 1);
+        threadQueries.emplace(std::this_thread::get_id(), newQuery);
+        return newQuery;
     }
 }
@@ -22,6 +22,11 @@
 #include "DetourAlloc.h"
 #include "DetourExtended.h"
 #include "DetourNavMesh.h"
+#include <boost/interprocess/mapped_region.hpp>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -43,7 +48,9 @@ namespace MMAP
     static char const* const TILE_FILE_NAME_FORMAT = "{}/mmaps/{:03}{:02}{:02}.mmtile";
 
     typedef std::unordered_map<uint32, dtTileRef> MMapTileSet;
-    typedef std::unordered_map<uint32, dtNavMeshQuery*> NavMeshQuerySet;
+    typedef std::unordered_map<uint32, std::unique_ptr<boost::interprocess::mapped_region>> MMapMappedTileSet;
+    typedef std::unordered_map<std::thread::id, dtNavMeshQuery*> NavMeshThreadQuerySet;
+    typedef std::unordered_map<uint32, NavMeshThreadQuerySet> NavMeshQuerySet;
 
     // dummy struct to hold map's mmap data
     struct MMapData
@@ -54,7 +61,8 @@ namespace MMAP
         {
             for (auto& navMeshQuerie : navMeshQueries)
             {
-                dtFreeNavMeshQuery(navMeshQuerie.second);
+                for (auto& threadQuery : navMeshQuerie.second)
+                    dtFreeNavMeshQuery(threadQuery.second);
             }
 
             if (navMesh)
@@ -63,10 +71,14 @@ namespace MMAP
             }
         }
 
-        // we have to use single dtNavMeshQuery for every instance, since those are not thread safe
-        NavMeshQuerySet navMeshQueries; // instanceId to query
+        // we have to use single dtNavMeshQuery for every instance and thread, since those are not thread safe
+        // (instances of a map and regions of a continent may be updated at the same time)
+        NavMeshQuerySet navMeshQueries; // instanceId to thread to query
+        std::mutex navMeshQueriesLock;
         dtNavMesh* navMesh;
         MMapTileSet loadedTileRefs; // maps [map grid coords] to [dtTile]
+        MMapMappedTileSet mappedTiles; // [map grid coords] to the file mapping a tile lives in, not owned by detour
+        std::atomic<uint32> tileGeneration{0}; // raised whenever a tile is removed, invalidating its polygon references
     };
 
     typedef std::unordered_map<uint32, MMapData*> MMapDataSet;
@@ -76,6 +88,15 @@ namespace MMAP
     class MMapMgr
     {
     public:
+        struct TileLoadStats
+        {
+            uint64 Loads;           // tiles added to a navmesh since the start
+            uint64 CompressedLoads; // of those, tiles inflated from compressed mmtiles
+            uint64 FileBytes;       // tile data read from the mmtiles
+            uint64 DataBytes;       // detour data of the loaded tiles
+            uint64 LoadTimeUs;      // time spent reading, inflating and adding the tiles
+        };
+
         MMapMgr()  = default;
         ~MMapMgr();
 
@@ -85,21 +106,36 @@ namespace MMAP
         bool unloadMap(uint32 mapId);
         bool unloadMapInstance(uint32 mapId, uint32 instanceId);
 
-        // the returned [dtNavMeshQuery const*] is NOT threadsafe
+        // the returned [dtNavMeshQuery const*] is NOT threadsafe, it belongs to the calling thread
         dtNavMeshQuery const* GetNavMeshQuery(uint32 mapId, uint32 instanceId);
         dtNavMesh const* GetNavMesh(uint32 mapId);
+        [[nodiscard]] uint32 GetTileGeneration(uint32 mapId) const;
 
         [[nodiscard]] uint32 getLoadedTilesCount() const { return loadedTiles; }
         [[nodiscard]] uint32 getLoadedMapsCount() const { return loadedMMaps.size(); }
+        [[nodiscard]] TileLoadStats GetTileLoadStats() const;
 
     private:
         bool loadMapData(uint32 mapId);
+        unsigned char* mapTileData(MMapData* mmap, uint32 packedGridPos, std::string const& fileName, uint32 dataSize);
+        static unsigned char* readCompressedTileData(FILE* file, uint32 fileSize, uint32& dataSize);
+        static bool getInflatedTileFile(FILE* file, std::string const& fileName, uint32 fileSize, std::string const& cacheFileName, uint32& dataSize);
+        void releaseTileData(MMapData* mmap, uint32 packedGridPos);
         uint32 packTileID(int32 x, int32 y);
         [[nodiscard]] MMapDataSet::const_iterator GetMMapData(uint32 mapId) const;
 
         MMapDataSet loadedMMaps;
         uint32 loadedTiles{0};
         bool thread_safe_environment{true};
+
+        struct
+        {
+            std::atomic<uint64> Loads{0};
+            std::atomic<uint64> CompressedLoads{0};
+            std::atomic<uint64> FileBytes{0};
+            std::atomic<uint64> DataBytes{0};
+            std::atomic<uint64> LoadTimeUs{0};
+        } tileLoadStats;
     };
 }
 
@@ -36,6 +36,7 @@ namespace VMAP
         GetLiquidFlagsPtr = &GetLiquidFlagsDummy;
         IsVMAPDisabledForPtr = &IsVMAPDisabledForDummy;
         thread_safe_environment = true;
+        iTreeGeneration = 0;
     }
 
     VMapMgr2::~VMapMgr2()
@@ -140,7 +141,9 @@ namespace VMAP
             instanceTree->second = newTree;
         }
 
-        return instanceTree->second->LoadMapTile(tileX, tileY, this);
+        bool result = instanceTree->second->LoadMapTile(tileX, tileY, this);
+        instanceTree->second->SetGeneration(++iTreeGeneration);
+        return result;
     }
 
     void VMapMgr2::unloadMap(unsigned int mapId)
@@ -149,6 +152,7 @@ namespace VMAP
         if (instanceTree != iInstanceMapTrees.end() && instanceTree->second)
         {
             instanceTree->second->UnloadMap(this);
+            instanceTree->second->SetGeneration(++iTreeGeneration);
             if (instanceTree->second->numLoadedTiles() == 0)
             {
                 delete instanceTree->second;
@@ -163,6 +167,7 @@ namespace VMAP
         if (instanceTree != iInstanceMapTrees.end() && instanceTree->second)
         {
             instanceTree->second->UnloadMapTile(x, y, this);
+            instanceTree->second->SetGeneration(++iTreeGeneration);
             if (instanceTree->second->numLoadedTiles() == 0)
             {
                 delete instanceTree->second;
@@ -194,6 +199,32 @@ namespace VMAP
         return true;
     }
 
+    void VMapMgr2::isInLineOfSightBatch(unsigned int mapId, std::span<std::pair<Vector3, Vector3> const> segments, std::vector<bool>& inLineOfSight, ModelIgnoreFlags ignoreFlags)
+    {
+#if defined(ENABLE_VMAP_CHECKS)
+        if (!isLineOfSightCalcEnabled() || IsVMAPDisabledForPtr(mapId, VMAP_DISABLE_LOS))
+        {
+            return;
+        }
+#endif
+
+        InstanceTreeMap::const_iterator instanceTree = GetMapTree(mapId);
+        if (instanceTree == iInstanceMapTrees.end())
+        {
+            return;
+        }
+
+        std::vector<std::pair<Vector3, Vector3>> converted;
+        converted.reserve(segments.size());
+        for (std::pair<Vector3, Vector3> const& segment : segments)
+        {
+            converted.emplace_back(convertPositionToInternalRep(segment.first.x, segment.first.y, segment.first.z),
+                convertPositionToInternalRep(segment.second.x, segment.second.y, segment.second.z));
+        }
+
+        instanceTree->second->isInLineOfSightBatch(converted, inLineOfSight, ignoreFlags);
+    }
+
     /**
     get the hit position and return true if we hit something
     otherwise the result pos will be the dest pos
@@ -253,6 +284,17 @@ namespace VMAP
         return VMAP_INVALID_HEIGHT_VALUE;
     }
 
+    uint32 VMapMgr2::GetTreeGeneration(unsigned int mapId) const
+    {
+        InstanceTreeMap::const_iterator instanceTree = GetMapTree(mapId);
+        if (instanceTree != iInstanceMapTrees.end())
+        {
+            return instanceTree->second->GetGeneration();
+        }
+
+        return 0;
+    }
+
     bool VMapMgr2::GetAreaAndLiquidData(uint32 mapId, float x, float y, float z, Optional<uint8> reqLiquidType, AreaAndLiquidData& data) const
     {
         InstanceTreeMap::const_iterator instanceTree = GetMapTree(mapId);
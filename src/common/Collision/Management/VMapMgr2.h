@@ -19,6 +19,7 @@
 #define _VMAPMANAGER2_H
 
 #include "IVMapMgr.h"
+#include <atomic>
 #include <mutex>
 #include <unordered_map>
 #include <vector>
@@ -83,6 +84,9 @@ namespace VMAP
         // Mutex for iLoadedModelFiles
         std::mutex LoadedModelFilesLock;
 
+        // source of the tree generations, never hands out the same value twice
+        std::atomic<uint32> iTreeGeneration;
+
         bool _loadMap(uint32 mapId, const std::string& basePath, uint32 tileX, uint32 tileY);
         /* void _unloadMap(uint32 pMapId, uint32 x, uint32 y); */
 
@@ -107,11 +111,13 @@ namespace VMAP
         void unloadMap(unsigned int mapId) override;
 
         bool isInLineOfSight(unsigned int mapId, float x1, float y1, float z1, float x2, float y2, float z2, ModelIgnoreFlags ignoreFlags) override ;
+        void isInLineOfSightBatch(unsigned int mapId, std::span<std::pair<G3D::Vector3, G3D::Vector3> const> segments, std::vector<bool>& inLineOfSight, ModelIgnoreFlags ignoreFlags) override;
         /**
         fill the hit pos and return true, if an object was hit
         */
         bool GetObjectHitPos(unsigned int mapId, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist) override;
         float getHeight(unsigned int mapId, float x, float y, float z, float maxSearchDist) override;
+        [[nodiscard]] uint32 GetTreeGeneration(unsigned int mapId) const override;
 
         bool processCommand(char* /*command*/) override { return false; } // for debug and extensions
 
@@ -68,7 +68,8 @@ struct MmapTileHeader
     uint32 mmapVersion{MMAP_VERSION};
     uint32 size{0};
     char usesLiquids{true};
-    char padding[3] {};
+    char compressed{false};     // zlib stream of the detour data, preceded by its uint32 inflated size; size counts both
+    char padding[2] {};
 
     MmapTileRecastConfig recastConfig;
 
@@ -82,6 +83,7 @@ static_assert(sizeof(MmapTileHeader) == (sizeof(MmapTileHeader::mmapMagic) +
               sizeof(MmapTileHeader::mmapVersion) +
               sizeof(MmapTileHeader::size) +
               sizeof(MmapTileHeader::usesLiquids) +
+              sizeof(MmapTileHeader::compressed) +
               sizeof(MmapTileHeader::padding)+
               sizeof(MmapTileRecastConfig)), "MmapTileHeader has uninitialized padding fields");
 
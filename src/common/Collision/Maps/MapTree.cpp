@@ -18,10 +18,14 @@
 #include "MapTree.h"
 #include "Errors.h"
 #include "Log.h"
+#include "MapDefines.h"
 #include "Metric.h"
 #include "ModelInstance.h"
+#include "Optional.h"
 #include "VMapDefinitions.h"
 #include "VMapMgr2.h"
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <limits>
 #include <sstream>
@@ -71,6 +75,18 @@ namespace VMAP
         bool result;
     };
 
+    class MapBoxCallback
+    {
+    public:
+        MapBoxCallback(std::vector<uint32>& entries) : candidates(entries) { }
+        void operator()(uint32 entry)
+        {
+            candidates.push_back(entry);
+        }
+    protected:
+        std::vector<uint32>& candidates;
+    };
+
     //=========================================================
 
     std::string StaticMapTree::getTileFileName(uint32 mapID, uint32 tileX, uint32 tileY)
@@ -85,13 +101,19 @@ namespace VMAP
 
     bool StaticMapTree::GetLocationInfo(const Vector3& pos, LocationInfo& info) const
     {
+        // open terrain, only WMO spawns have area info
+        if (!HasAreaCoverage(pos))
+        {
+            return false;
+        }
+
         LocationInfoCallback intersectionCallBack(iTreeValues, info);
         iTree.intersectPoint(pos, intersectionCallBack);
         return intersectionCallBack.result;
     }
 
     StaticMapTree::StaticMapTree(uint32 mapID, const std::string& basePath)
-        : iMapID(mapID), iIsTiled(false), iTreeValues(0), iBasePath(basePath)
+        : iMapID(mapID), iIsTiled(false), iTreeValues(0), iBasePath(basePath), iAreaCoverage(MAX_NUMBER_OF_GRIDS * MAX_NUMBER_OF_GRIDS)
     {
         if (iBasePath.length() > 0 && iBasePath[iBasePath.length() - 1] != '/' && iBasePath[iBasePath.length() - 1] != '\\')
         {
@@ -146,6 +168,92 @@ namespace VMAP
 
         return !GetIntersectionTime(ray, maxDist, true, ignoreFlags);
     }
+    //=========================================================
+    /**
+    The tree is descended once for the bounds of all segments, each segment is then only
+    tested against the models found there instead of doing its own descent.
+    */
+
+    void StaticMapTree::isInLineOfSightBatch(std::span<std::pair<Vector3, Vector3> const> segments, std::vector<bool>& inLineOfSight, ModelIgnoreFlags ignoreFlags) const
+    {
+        ASSERT(inLineOfSight.size() == segments.size());
+
+        Optional<G3D::AABox> bounds;
+        for (std::size_t i = 0; i < segments.size(); ++i)
+        {
+            if (!inLineOfSight[i])
+            {
+                continue;
+            }
+
+            float maxDist = (segments[i].second - segments[i].first).magnitude();
+            // same rules as isInLineOfSight
+            if (maxDist == std::numeric_limits<float>::max() || !std::isfinite(maxDist))
+            {
+                inLineOfSight[i] = false;
+                continue;
+            }
+
+            if (!bounds)
+            {
+                bounds.emplace(segments[i].first);
+            }
+            else
+            {
+                bounds->merge(segments[i].first);
+            }
+            bounds->merge(segments[i].second);
+        }
+
+        if (!bounds)
+        {
+            return;
+        }
+
+        std::vector<uint32> candidates;
+        MapBoxCallback boxCallback(candidates);
+        iTree.intersectBox(*bounds, boxCallback);
+        if (candidates.empty())
+        {
+            return;
+        }
+
+        for (std::size_t i = 0; i < segments.size(); ++i)
+        {
+            if (!inLineOfSight[i])
+            {
+                continue;
+            }
+
+            Vector3 const& pos1 = segments[i].first;
+            Vector3 const& pos2 = segments[i].second;
+            float maxDist = (pos2 - pos1).magnitude();
+            // prevent NaN values which can cause BIH intersection to enter infinite loop
+            if (maxDist < 1e-10f)
+            {
+                continue;
+            }
+
+            G3D::Ray ray = G3D::Ray::fromOriginAndDirection(pos1, (pos2 - pos1) / maxDist);
+            for (uint32 entry : candidates)
+            {
+                ModelInstance const& instance = iTreeValues[entry];
+                // models entered only beyond the end of the segment can not block it
+                if (ray.intersectionTime(instance.GetBounds()) > maxDist)
+                {
+                    continue;
+                }
+
+                float distance = maxDist;
+                if (instance.intersectRay(ray, distance, true, ignoreFlags))
+                {
+                    inLineOfSight[i] = false;
+                    break;
+                }
+            }
+        }
+    }
+
     //=========================================================
     /**
     When moving from pos1 to pos2 check if we hit an object. Return true and the position if we hit one
@@ -298,6 +406,7 @@ namespace VMAP
                 // assume that global model always is the first and only tree value (could be improved...)
                 iTreeValues[0] = ModelInstance(spawn, model);
                 iLoadedSpawns[0] = 1;
+                UpdateAreaCoverage(spawn, true);
             }
             else
             {
@@ -316,6 +425,7 @@ namespace VMAP
     {
         for (loadedSpawnMap::iterator i = iLoadedSpawns.begin(); i != iLoadedSpawns.end(); ++i)
         {
+            UpdateAreaCoverage(iTreeValues[i->first], false);
             iTreeValues[i->first].setUnloaded();
             for (uint32 refCount = 0; refCount < i->second; ++refCount)
             {
@@ -389,6 +499,7 @@ namespace VMAP
 #endif
                             iTreeValues[referencedVal] = ModelInstance(spawn, model);
                             iLoadedSpawns[referencedVal] = 1;
+                            UpdateAreaCoverage(spawn, true);
                         }
                         else
                         {
@@ -478,6 +589,7 @@ namespace VMAP
                             }
                             else if (--iLoadedSpawns[referencedNode] == 0)
                             {
+                                UpdateAreaCoverage(iTreeValues[referencedNode], false);
                                 iTreeValues[referencedNode].setUnloaded();
                                 iLoadedSpawns.erase(referencedNode);
                             }
@@ -493,6 +605,64 @@ namespace VMAP
             "Map: " + std::to_string(iMapID) + " TileX: " + std::to_string(tileX) + " TileY: " + std::to_string(tileY));
     }
 
+    void StaticMapTree::UpdateAreaCoverage(ModelSpawn const& spawn, bool add)
+    {
+        // M2 files don't contain area info, only WMO files
+        if (spawn.flags & MOD_M2)
+        {
+            return;
+        }
+
+        constexpr int32 cellCount = int32(MAX_NUMBER_OF_GRIDS * AREA_COVERAGE_CELLS);
+        constexpr float cellSize = SIZE_OF_GRIDS / AREA_COVERAGE_CELLS;
+        auto toCell = [](float coord) { return std::clamp(int32(std::floor(coord / cellSize)), 0, cellCount - 1); };
+
+        int32 const lowX = toCell(spawn.iBound.low().x);
+        int32 const lowY = toCell(spawn.iBound.low().y);
+        int32 const highX = toCell(spawn.iBound.high().x);
+        int32 const highY = toCell(spawn.iBound.high().y);
+        for (int32 x = lowX; x <= highX; ++x)
+        {
+            for (int32 y = lowY; y <= highY; ++y)
+            {
+                std::unique_ptr<TileAreaCoverage>& tile = iAreaCoverage[(x / AREA_COVERAGE_CELLS) * MAX_NUMBER_OF_GRIDS + y / AREA_COVERAGE_CELLS];
+                if (!tile)
+                {
+                    tile = std::make_unique<TileAreaCoverage>();
+                    tile->fill(0);
+                }
+
+                uint16& count = (*tile)[(x % AREA_COVERAGE_CELLS) * AREA_COVERAGE_CELLS + y % AREA_COVERAGE_CELLS];
+                if (add)
+                {
+                    ++count;
+                }
+                else
+                {
+                    ASSERT(count, "StaticMapTree::UpdateAreaCoverage() : removing uncovered spawn {} of map {}", spawn.ID, iMapID);
+                    --count;
+                }
+            }
+        }
+    }
+
+    bool StaticMapTree::HasAreaCoverage(Vector3 const& pos) const
+    {
+        constexpr float cellSize = SIZE_OF_GRIDS / AREA_COVERAGE_CELLS;
+        float const cellX = std::floor(pos.x / cellSize);
+        float const cellY = std::floor(pos.y / cellSize);
+        // the coverage only spans the grids of the map, leave the rest to the tree
+        if (!(cellX >= 0.0f && cellY >= 0.0f && cellX < float(MAX_NUMBER_OF_GRIDS * AREA_COVERAGE_CELLS) && cellY < float(MAX_NUMBER_OF_GRIDS * AREA_COVERAGE_CELLS)))
+        {
+            return true;
+        }
+
+        uint32 const x = uint32(cellX);
+        uint32 const y = uint32(cellY);
+        TileAreaCoverage const* tile = iAreaCoverage[(x / AREA_COVERAGE_CELLS) * MAX_NUMBER_OF_GRIDS + y / AREA_COVERAGE_CELLS].get();
+        return tile && (*tile)[(x % AREA_COVERAGE_CELLS) * AREA_COVERAGE_CELLS + y % AREA_COVERAGE_CELLS] != 0;
+    }
+
     void StaticMapTree::GetModelInstances(ModelInstance*& models, uint32& count)
     {
         models = iTreeValues;
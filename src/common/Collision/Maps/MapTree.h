@@ -20,11 +20,18 @@
 
 #include "BoundingIntervalHierarchy.h"
 #include "Define.h"
+#include <array>
+#include <atomic>
+#include <memory>
+#include <span>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace VMAP
 {
     class ModelInstance;
+    class ModelSpawn;
     class GroupModel;
     class VMapMgr2;
     enum class ModelIgnoreFlags : uint32;
@@ -49,6 +56,10 @@ namespace VMAP
     {
         typedef std::unordered_map<uint32, bool> loadedTileMap;
         typedef std::unordered_map<uint32, uint32> loadedSpawnMap;
+
+        // loaded WMO spawns whose bounds cover each cell of a tile, cells are 1/16 of a tile like the area ids of terrain data
+        static constexpr uint32 AREA_COVERAGE_CELLS = 16;
+        typedef std::array<uint16, AREA_COVERAGE_CELLS * AREA_COVERAGE_CELLS> TileAreaCoverage;
     private:
         uint32 iMapID;
         bool iIsTiled;
@@ -63,9 +74,14 @@ namespace VMAP
         // stores <tree_index, reference_count> to invalidate tree values, unload map, and to be able to report errors
         loadedSpawnMap iLoadedSpawns;
         std::string iBasePath;
+        std::atomic<uint32> iGeneration{0};
+        // indexed by tile, points outside of every covered cell have no area info
+        std::vector<std::unique_ptr<TileAreaCoverage>> iAreaCoverage;
 
     private:
         bool GetIntersectionTime(const G3D::Ray& pRay, float& pMaxDist, bool StopAtFirstHit, ModelIgnoreFlags ignoreFlags) const;
+        void UpdateAreaCoverage(ModelSpawn const& spawn, bool add);
+        [[nodiscard]] bool HasAreaCoverage(G3D::Vector3 const& pos) const;
         //bool containsLoadedMapTile(unsigned int pTileIdent) const { return(iLoadedMapTiles.containsKey(pTileIdent)); }
     public:
         static std::string getTileFileName(uint32 mapID, uint32 tileX, uint32 tileY);
@@ -77,6 +93,8 @@ namespace VMAP
         ~StaticMapTree();
 
         [[nodiscard]] bool isInLineOfSight(const G3D::Vector3& pos1, const G3D::Vector3& pos2, ModelIgnoreFlags ignoreFlags) const;
+        /// Clears inLineOfSight[i] if segment i (start, end) is blocked, segments already cleared are skipped
+        void isInLineOfSightBatch(std::span<std::pair<G3D::Vector3, G3D::Vector3> const> segments, std::vector<bool>& inLineOfSight, ModelIgnoreFlags ignoreFlags) const;
         bool GetObjectHitPos(const G3D::Vector3& pos1, const G3D::Vector3& pos2, G3D::Vector3& pResultHitPos, float pModifyDist) const;
         [[nodiscard]] float getHeight(const G3D::Vector3& pPos, float maxSearchDist) const;
         bool GetLocationInfo(const G3D::Vector3& pos, LocationInfo& info) const;
@@ -87,6 +105,9 @@ namespace VMAP
         void UnloadMapTile(uint32 tileX, uint32 tileY, VMapMgr2* vm);
         [[nodiscard]] bool isTiled() const { return iIsTiled; }
         [[nodiscard]] uint32 numLoadedTiles() const { return iLoadedTiles.size(); }
+        //! changed by the manager whenever tiles are loaded or unloaded
+        [[nodiscard]] uint32 GetGeneration() const { return iGeneration; }
+        void SetGeneration(uint32 generation) { iGeneration = generation; }
         void GetModelInstances(ModelInstance*& models, uint32& count);
     };
 
@@ -17,13 +17,19 @@
 
 #include "TileAssembler.h"
 #include "BoundingIntervalHierarchy.h"
+#include "CryptoHash.h"
 #include "MapDefines.h"
 #include "MapTree.h"
+#include "Util.h"
 #include "VMapDefinitions.h"
 #include <boost/filesystem.hpp>
+#include <algorithm>
+#include <atomic>
+#include <fstream>
 #include <iomanip>
 #include <set>
 #include <sstream>
+#include <thread>
 
 using G3D::Vector3;
 using G3D::AABox;
@@ -52,8 +58,64 @@ namespace VMAP
 
     //=================================================================
 
-    TileAssembler::TileAssembler(const std::string& pSrcDirName, const std::string& pDestDirName)
-        : iDestDir(pDestDirName), iSrcDir(pSrcDirName)
+    namespace
+    {
+        // Hashes of the previous run, rewritten once a run completes
+        char const* const ASSEMBLER_HASHES_FILE = "assembler_hashes";
+
+        // Runs work(i) for all i below count on a number of threads, until one of them fails
+        template<class Work>
+        bool ParallelFor(uint32 threads, std::size_t count, Work&& work)
+        {
+            std::atomic<std::size_t> next = 0;
+            std::atomic<bool> success = true;
+            auto worker = [&]()
+            {
+                for (std::size_t i = next++; i < count && success; i = next++)
+                    if (!work(i))
+                        success = false;
+            };
+
+            std::vector<std::thread> workers;
+            for (uint32 i = 1; i < std::min<std::size_t>(threads, count); ++i)
+                workers.emplace_back(worker);
+
+            worker();
+            for (std::thread& thread : workers)
+                thread.join();
+
+            return success;
+        }
+
+        template<class T>
+        void HashValue(Acore::Crypto::SHA1& hash, T const& value)
+        {
+            hash.UpdateData(reinterpret_cast<uint8 const*>(&value), sizeof(value));
+        }
+
+        std::string HashFile(std::string const& path)
+        {
+            FILE* file = fopen(path.c_str(), "rb");
+            if (!file)
+                return "";
+
+            Acore::Crypto::SHA1 hash;
+            std::vector<uint8> buffer(1024 * 1024);
+            while (std::size_t read = fread(buffer.data(), 1, buffer.size(), file))
+                hash.UpdateData(buffer.data(), read);
+
+            bool const success = ferror(file) == 0;
+            fclose(file);
+            if (!success)
+                return "";
+
+            hash.Finalize();
+            return ByteArrayToHexStr(hash.GetDigest());
+        }
+    }
+
+    TileAssembler::TileAssembler(const std::string& pSrcDirName, const std::string& pDestDirName, uint32 threads)
+        : iDestDir(pDestDirName), iSrcDir(pSrcDirName), iThreads(std::max(threads, 1u))
     {
         boost::filesystem::create_directory(iDestDir);
         //init();
@@ -72,148 +134,296 @@ namespace VMAP
             return false;
         }
 
+        loadHashes();
+
+        // hash the raw models of all spawns once, map trees depend on those of the M2 spawns
+        std::vector<std::string> rawFiles;
+        for (MapData::iterator map_iter = mapData.begin(); map_iter != mapData.end(); ++map_iter)
+            for (UniqueEntryMap::iterator entry = map_iter->second->UniqueEntries.begin(); entry != map_iter->second->UniqueEntries.end(); ++entry)
+                rawFiles.push_back(entry->second.name);
+
+        std::sort(rawFiles.begin(), rawFiles.end());
+        rawFiles.erase(std::unique(rawFiles.begin(), rawFiles.end()), rawFiles.end());
+        printf("Hashing %u raw model files with %u threads...\n", uint32(rawFiles.size()), iThreads);
+        ParallelFor(iThreads, rawFiles.size(), [&](std::size_t i)
+        {
+            getRawFileHash(rawFiles[i]);
+            return true;
+        });
+
         // export Map data
-        for (MapData::iterator map_iter = mapData.begin(); map_iter != mapData.end() && success; ++map_iter)
+        std::vector<MapData::iterator> maps;
+        for (MapData::iterator map_iter = mapData.begin(); map_iter != mapData.end(); ++map_iter)
+            maps.push_back(map_iter);
+
+        std::vector<std::set<std::string>> mapModelFiles(maps.size());
+        success = ParallelFor(iThreads, maps.size(), [&](std::size_t i)
         {
-            // build global map tree
-            std::vector<ModelSpawn*> mapSpawns;
-            UniqueEntryMap::iterator entry;
-            printf("Calculating model bounds for map %u...\n", map_iter->first);
-            for (entry = map_iter->second->UniqueEntries.begin(); entry != map_iter->second->UniqueEntries.end(); ++entry)
-            {
-                // M2 models don't have a bound set in WDT/ADT placement data, i still think they're not used for LoS at all on retail
-                if (entry->second.flags & MOD_M2)
-                {
-                    if (!calculateTransformedBound(entry->second))
-                    {
-                        break;
-                    }
-                }
-                else if (entry->second.flags & MOD_WORLDSPAWN) // WMO maps and terrain maps use different origin, so we need to adapt :/
-                {
-                    /// @todo remove extractor hack and uncomment below line:
-                    //entry->second.iPos += Vector3(533.33333f*32, 533.33333f*32, 0.f);
-                    entry->second.iBound = entry->second.iBound + Vector3(533.33333f * 32, 533.33333f * 32, 0.f);
-                }
-                mapSpawns.push_back(&(entry->second));
-                spawnedModelFiles.insert(entry->second.name);
-            }
+            return exportMap(maps[i]->first, *maps[i]->second, mapModelFiles[i]);
+        });
 
-            printf("Creating map tree for map %u...\n", map_iter->first);
-            BIH pTree;
+        for (std::set<std::string> const& modelFiles : mapModelFiles)
+            spawnedModelFiles.insert(modelFiles.begin(), modelFiles.end());
 
-            try
-            {
-                pTree.build(mapSpawns, BoundsTrait<ModelSpawn*>::GetBounds);
-            }
-            catch (std::exception& e)
+        // add an object models, listed in temp_gameobject_models file
+        exportGameobjectModels();
+        // export objects
+        std::cout << "\nConverting Model Files" << std::endl;
+        std::vector<std::string> modelFiles(spawnedModelFiles.begin(), spawnedModelFiles.end());
+        success = ParallelFor(iThreads, modelFiles.size(), [&](std::size_t i)
+        {
+            std::string const& modelFile = modelFiles[i];
+            std::string rawHash = getRawFileHash(modelFile);
+            std::string hash;
+            if (!rawHash.empty())
+                hash = ByteArrayToHexStr(Acore::Crypto::SHA1::GetDigestOf(std::string_view(VMAP_MAGIC, 8), rawHash));
+
+            if (isUnchanged("model " + modelFile, hash, iDestDir + "/" + modelFile + ".vmo"))
+                return true;
+
+            printf("Converting %s\n", modelFile.c_str());
+            if (!convertRawFile(modelFile))
             {
-                printf("Exception ""%s"" when calling pTree.build", e.what());
+                printf("error converting %s\n", modelFile.c_str());
                 return false;
             }
 
-            // ===> possibly move this code to StaticMapTree class
-            std::map<uint32, uint32> modelNodeIdx;
-            for (uint32 i = 0; i < mapSpawns.size(); ++i)
-            {
-                modelNodeIdx.insert(pair<uint32, uint32>(mapSpawns[i]->ID, i));
-            }
+            std::lock_guard<std::mutex> guard(iHashLock);
+            iCurrentHashes["model " + modelFile] = hash;
+            return true;
+        }) && success;
+
+        if (success)
+            saveHashes();
+
+        //cleanup:
+        for (MapData::iterator map_iter = mapData.begin(); map_iter != mapData.end(); ++map_iter)
+        {
+            delete map_iter->second;
+        }
+        return success;
+    }
+
+    bool TileAssembler::exportMap(uint32 mapId, MapSpawns& spawns, std::set<std::string>& modelFiles)
+    {
+        // the map tree and tiles depend on the spawns of the map and the raw files giving the bounds of its M2 spawns
+        Acore::Crypto::SHA1 inputHash;
+        inputHash.UpdateData(std::string_view(VMAP_MAGIC, 8));
+        for (UniqueEntryMap::iterator entry = spawns.UniqueEntries.begin(); entry != spawns.UniqueEntries.end(); ++entry)
+        {
+            ModelSpawn const& spawn = entry->second;
+            HashValue(inputHash, spawn.flags);
+            HashValue(inputHash, spawn.adtId);
+            HashValue(inputHash, spawn.ID);
+            HashValue(inputHash, spawn.iPos);
+            HashValue(inputHash, spawn.iRot);
+            HashValue(inputHash, spawn.iScale);
+            HashValue(inputHash, spawn.iBound.low());
+            HashValue(inputHash, spawn.iBound.high());
+            inputHash.UpdateData(spawn.name);
+            inputHash.UpdateData(std::string_view("", 1));
+            if (spawn.flags & MOD_M2)
+                inputHash.UpdateData(getRawFileHash(spawn.name));
+        }
+
+        for (TileMap::iterator tile = spawns.TileEntries.begin(); tile != spawns.TileEntries.end(); ++tile)
+        {
+            HashValue(inputHash, tile->first);
+            HashValue(inputHash, tile->second);
+        }
+
+        inputHash.Finalize();
+        std::string const hash = ByteArrayToHexStr(inputHash.GetDigest());
+
+        std::stringstream mapfilename;
+        mapfilename << iDestDir << '/' << std::setfill('0') << std::setw(3) << mapId << ".vmtree";
+        if (isUnchanged("map " + std::to_string(mapId), hash, mapfilename.str()))
+        {
+            for (UniqueEntryMap::iterator entry = spawns.UniqueEntries.begin(); entry != spawns.UniqueEntries.end(); ++entry)
+                modelFiles.insert(entry->second.name);
+
+            printf("Map %u is unchanged\n", mapId);
+            return true;
+        }
 
-            // write map tree file
-            std::stringstream mapfilename;
-            mapfilename << iDestDir << '/' << std::setfill('0') << std::setw(3) << map_iter->first << ".vmtree";
-            FILE* mapfile = fopen(mapfilename.str().c_str(), "wb");
-            if (!mapfile)
+        // build global map tree
+        bool success = true;
+        bool complete = true;
+        std::vector<ModelSpawn*> mapSpawns;
+        UniqueEntryMap::iterator entry;
+        printf("Calculating model bounds for map %u...\n", mapId);
+        for (entry = spawns.UniqueEntries.begin(); entry != spawns.UniqueEntries.end(); ++entry)
+        {
+            // M2 models don't have a bound set in WDT/ADT placement data, i still think they're not used for LoS at all on retail
+            if (entry->second.flags & MOD_M2)
             {
-                success = false;
-                printf("Cannot open %s\n", mapfilename.str().c_str());
-                break;
+                if (!calculateTransformedBound(entry->second))
+                {
+                    complete = false;
+                    break;
+                }
             }
-
-            //general info
-            if (success && fwrite(VMAP_MAGIC, 1, 8, mapfile) != 8) { success = false; }
-            uint32 globalTileID = StaticMapTree::packTileID(65, 65);
-            pair<TileMap::iterator, TileMap::iterator> globalRange = map_iter->second->TileEntries.equal_range(globalTileID);
-            char isTiled = globalRange.first == globalRange.second; // only maps without terrain (tiles) have global WMO
-            if (success && fwrite(&isTiled, sizeof(char), 1, mapfile) != 1) { success = false; }
-            // Nodes
-            if (success && fwrite("NODE", 4, 1, mapfile) != 1) { success = false; }
-            if (success) { success = pTree.writeToFile(mapfile); }
-            // global map spawns (WDT), if any (most instances)
-            if (success && fwrite("GOBJ", 4, 1, mapfile) != 1) { success = false; }
-
-            for (TileMap::iterator glob = globalRange.first; glob != globalRange.second && success; ++glob)
+            else if (entry->second.flags & MOD_WORLDSPAWN) // WMO maps and terrain maps use different origin, so we need to adapt :/
             {
-                success = ModelSpawn::writeToFile(mapfile, map_iter->second->UniqueEntries[glob->second]);
+                /// @todo remove extractor hack and uncomment below line:
+                //entry->second.iPos += Vector3(533.33333f*32, 533.33333f*32, 0.f);
+                entry->second.iBound = entry->second.iBound + Vector3(533.33333f * 32, 533.33333f * 32, 0.f);
             }
+            mapSpawns.push_back(&(entry->second));
+            modelFiles.insert(entry->second.name);
+        }
+
+        printf("Creating map tree for map %u...\n", mapId);
+        BIH pTree;
+
+        try
+        {
+            pTree.build(mapSpawns, BoundsTrait<ModelSpawn*>::GetBounds);
+        }
+        catch (std::exception& e)
+        {
+            printf("Exception ""%s"" when calling pTree.build", e.what());
+            return false;
+        }
+
+        // ===> possibly move this code to StaticMapTree class
+        std::map<uint32, uint32> modelNodeIdx;
+        for (uint32 i = 0; i < mapSpawns.size(); ++i)
+        {
+            modelNodeIdx.insert(pair<uint32, uint32>(mapSpawns[i]->ID, i));
+        }
+
+        // write map tree file
+        FILE* mapfile = fopen(mapfilename.str().c_str(), "wb");
+        if (!mapfile)
+        {
+            printf("Cannot open %s\n", mapfilename.str().c_str());
+            return false;
+        }
+
+        //general info
+        if (success && fwrite(VMAP_MAGIC, 1, 8, mapfile) != 8) { success = false; }
+        uint32 globalTileID = StaticMapTree::packTileID(65, 65);
+        pair<TileMap::iterator, TileMap::iterator> globalRange = spawns.TileEntries.equal_range(globalTileID);
+        char isTiled = globalRange.first == globalRange.second; // only maps without terrain (tiles) have global WMO
+        if (success && fwrite(&isTiled, sizeof(char), 1, mapfile) != 1) { success = false; }
+        // Nodes
+        if (success && fwrite("NODE", 4, 1, mapfile) != 1) { success = false; }
+        if (success) { success = pTree.writeToFile(mapfile); }
+        // global map spawns (WDT), if any (most instances)
+        if (success && fwrite("GOBJ", 4, 1, mapfile) != 1) { success = false; }
+
+        for (TileMap::iterator glob = globalRange.first; glob != globalRange.second && success; ++glob)
+        {
+            success = ModelSpawn::writeToFile(mapfile, spawns.UniqueEntries[glob->second]);
+        }
 
-            fclose(mapfile);
+        fclose(mapfile);
 
-            // <====
+        // <====
 
-            // write map tile files, similar to ADT files, only with extra BSP tree node info
-            TileMap& tileEntries = map_iter->second->TileEntries;
-            TileMap::iterator tile;
-            for (tile = tileEntries.begin(); tile != tileEntries.end(); ++tile)
+        // write map tile files, similar to ADT files, only with extra BSP tree node info
+        TileMap& tileEntries = spawns.TileEntries;
+        TileMap::iterator tile;
+        for (tile = tileEntries.begin(); tile != tileEntries.end(); ++tile)
+        {
+            const ModelSpawn& spawn = spawns.UniqueEntries[tile->second];
+            if (spawn.flags & MOD_WORLDSPAWN) // WDT spawn, saved as tile 65/65 currently...
             {
-                const ModelSpawn& spawn = map_iter->second->UniqueEntries[tile->second];
-                if (spawn.flags & MOD_WORLDSPAWN) // WDT spawn, saved as tile 65/65 currently...
-                {
-                    continue;
-                }
-                uint32 nSpawns = tileEntries.count(tile->first);
-                std::stringstream tilefilename;
-                tilefilename.fill('0');
-                tilefilename << iDestDir << '/' << std::setw(3) << map_iter->first << '_';
-                uint32 x, y;
-                StaticMapTree::unpackTileID(tile->first, x, y);
-                tilefilename << std::setw(2) << x << '_' << std::setw(2) << y << ".vmtile";
-                if (FILE* tilefile = fopen(tilefilename.str().c_str(), "wb"))
+                continue;
+            }
+            uint32 nSpawns = tileEntries.count(tile->first);
+            std::stringstream tilefilename;
+            tilefilename.fill('0');
+            tilefilename << iDestDir << '/' << std::setw(3) << mapId << '_';
+            uint32 x, y;
+            StaticMapTree::unpackTileID(tile->first, x, y);
+            tilefilename << std::setw(2) << x << '_' << std::setw(2) << y << ".vmtile";
+            if (FILE* tilefile = fopen(tilefilename.str().c_str(), "wb"))
+            {
+                // file header
+                if (success && fwrite(VMAP_MAGIC, 1, 8, tilefile) != 8) { success = false; }
+                // write number of tile spawns
+                if (success && fwrite(&nSpawns, sizeof(uint32), 1, tilefile) != 1) { success = false; }
+                // write tile spawns
+                for (uint32 s = 0; s < nSpawns; ++s)
                 {
-                    // file header
-                    if (success && fwrite(VMAP_MAGIC, 1, 8, tilefile) != 8) { success = false; }
-                    // write number of tile spawns
-                    if (success && fwrite(&nSpawns, sizeof(uint32), 1, tilefile) != 1) { success = false; }
-                    // write tile spawns
-                    for (uint32 s = 0; s < nSpawns; ++s)
+                    if (s)
                     {
-                        if (s)
-                        {
-                            ++tile;
-                        }
-                        const ModelSpawn& spawn2 = map_iter->second->UniqueEntries[tile->second];
-                        success = success && ModelSpawn::writeToFile(tilefile, spawn2);
-                        // MapTree nodes to update when loading tile:
-                        std::map<uint32, uint32>::iterator nIdx = modelNodeIdx.find(spawn2.ID);
-                        if (success && fwrite(&nIdx->second, sizeof(uint32), 1, tilefile) != 1) { success = false; }
+                        ++tile;
                     }
-                    fclose(tilefile);
+                    const ModelSpawn& spawn2 = spawns.UniqueEntries[tile->second];
+                    success = success && ModelSpawn::writeToFile(tilefile, spawn2);
+                    // MapTree nodes to update when loading tile:
+                    std::map<uint32, uint32>::iterator nIdx = modelNodeIdx.find(spawn2.ID);
+                    if (success && fwrite(&nIdx->second, sizeof(uint32), 1, tilefile) != 1) { success = false; }
                 }
+                fclose(tilefile);
             }
-            // break; //test, extract only first map; TODO: remvoe this line
         }
 
-        // add an object models, listed in temp_gameobject_models file
-        exportGameobjectModels();
-        // export objects
-        std::cout << "\nConverting Model Files" << std::endl;
-        for (std::set<std::string>::iterator mfile = spawnedModelFiles.begin(); mfile != spawnedModelFiles.end(); ++mfile)
+        // a map missing some bounds is built again by the next run
+        if (success && complete)
         {
-            std::cout << "Converting " << *mfile << std::endl;
-            if (!convertRawFile(*mfile))
-            {
-                std::cout << "error converting " << *mfile << std::endl;
-                success = false;
-                break;
-            }
+            std::lock_guard<std::mutex> guard(iHashLock);
+            iCurrentHashes["map " + std::to_string(mapId)] = hash;
         }
 
-        //cleanup:
-        for (MapData::iterator map_iter = mapData.begin(); map_iter != mapData.end(); ++map_iter)
+        return success;
+    }
+
+    std::string TileAssembler::getRawFileHash(const std::string& pModelFilename)
+    {
         {
-            delete map_iter->second;
+            std::lock_guard<std::mutex> guard(iHashLock);
+            auto itr = iRawFileHashes.find(pModelFilename);
+            if (itr != iRawFileHashes.end())
+                return itr->second;
         }
-        return success;
+
+        std::string hash = HashFile(iSrcDir + "/" + pModelFilename);
+        std::lock_guard<std::mutex> guard(iHashLock);
+        return iRawFileHashes.emplace(pModelFilename, std::move(hash)).first->second;
+    }
+
+    bool TileAssembler::isUnchanged(const std::string& key, const std::string& hash, const std::string& outputFile)
+    {
+        if (hash.empty() || !boost::filesystem::exists(outputFile))
+            return false;
+
+        std::lock_guard<std::mutex> guard(iHashLock);
+        auto itr = iPreviousHashes.find(key);
+        if (itr == iPreviousHashes.end() || itr->second != hash)
+            return false;
+
+        iCurrentHashes[key] = hash;
+        return true;
+    }
+
+    void TileAssembler::loadHashes()
+    {
+        std::string const path = iDestDir + "/" + ASSEMBLER_HASHES_FILE;
+        std::ifstream file(path);
+        std::string line;
+        while (std::getline(file, line))
+        {
+            std::size_t const separator = line.rfind('\t');
+            if (separator != std::string::npos)
+                iPreviousHashes[line.substr(0, separator)] = line.substr(separator + 1);
+        }
+
+        // an interrupted run leaves outputs which match neither the old hashes nor the new ones
+        boost::system::error_code error;
+        boost::filesystem::remove(path, error);
+        if (!iPreviousHashes.empty())
+            printf("Found the hashes of %u outputs of the previous run\n", uint32(iPreviousHashes.size()));
+    }
+
+    void TileAssembler::saveHashes()
+    {
+        std::ofstream file(iDestDir + "/" + ASSEMBLER_HASHES_FILE);
+        for (auto const& [key, hash] : iCurrentHashes)
+            file << key << '\t' << hash << '\n';
     }
 
     bool TileAssembler::readMapSpawns()
@@ -21,7 +21,9 @@
 #include <G3D/Matrix3.h>
 #include <G3D/Vector3.h>
 #include <map>
+#include <mutex>
 #include <set>
+#include <unordered_map>
 
 #include "ModelInstance.h"
 #include "WorldModel.h"
@@ -31,6 +33,10 @@ namespace VMAP
     /**
     This Class is used to convert raw vector data into balanced BSP-Trees.
     To start the conversion call convertWorld().
+
+    Maps and models are converted on a number of threads. The hashes of the
+    inputs of every map tree and model are kept in the destination directory,
+    a later run only converts again what changed or is missing.
     */
     //===============================================
 
@@ -94,12 +100,24 @@ namespace VMAP
     private:
         std::string iDestDir;
         std::string iSrcDir;
+        uint32 iThreads;
         G3D::Table<std::string, unsigned int > iUniqueNameIds;
         MapData mapData;
         std::set<std::string> spawnedModelFiles;
 
+        std::mutex iHashLock;
+        std::unordered_map<std::string, std::string> iPreviousHashes;   // inputs of the outputs of the previous run
+        std::unordered_map<std::string, std::string> iCurrentHashes;
+        std::unordered_map<std::string, std::string> iRawFileHashes;    // raw model file contents
+
+        bool exportMap(uint32 mapId, MapSpawns& spawns, std::set<std::string>& modelFiles);
+        std::string getRawFileHash(const std::string& pModelFilename);
+        bool isUnchanged(const std::string& key, const std::string& hash, const std::string& outputFile);
+        void loadHashes();
+        void saveHashes();
+
     public:
-        TileAssembler(const std::string& pSrcDirName, const std::string& pDestDirName);
+        TileAssembler(const std::string& pSrcDirName, const std::string& pDestDirName, uint32 threads = 1);
         virtual ~TileAssembler();
 
         bool convertWorld2();
@@ -22,6 +22,14 @@
 #include "VMapDefinitions.h"
 #include <array>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VMAP_TRIANGLE_BLOCK_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define VMAP_TRIANGLE_BLOCK_NEON
+#endif
+
 using G3D::Vector3;
 
 template<> struct BoundsTrait<VMAP::GroupModel>
@@ -31,57 +39,150 @@ template<> struct BoundsTrait<VMAP::GroupModel>
 
 namespace VMAP
 {
-    bool IntersectTriangle(const MeshTriangle& tri, std::vector<Vector3>::const_iterator points, const G3D::Ray& ray, float& distance)
+    /**
+    Ray-triangle test for the lanes of block set in laneMask, four at a time where the CPU allows.
+    Every lane takes the steps of the scalar test, hits and distances do not depend on the path taken.
+    If a hit closer than distance is found, sets distance to it and returns true.
+    */
+    bool IntersectTriangleBlock(const TriangleBlock& block, uint32 laneMask, const G3D::Ray& ray, float& distance)
     {
         static const float EPS = 1e-5f;
 
         // See RTR2 ch. 13.7 for the algorithm.
 
-        const Vector3 e1 = points[tri.idx1] - points[tri.idx0];
-        const Vector3 e2 = points[tri.idx2] - points[tri.idx0];
-        const Vector3 p(ray.direction().cross(e2));
-        const float a = e1.dot(p);
-
-        if (std::fabs(a) < EPS)
-        {
-            // Determinant is ill-conditioned; abort early
-            return false;
+        const Vector3& org = ray.origin();
+        const Vector3& dir = ray.direction();
+        alignas(16) float t[4];
+        uint32 hitMask = 0;
+
+#if defined(VMAP_TRIANGLE_BLOCK_SSE2)
+        const __m128 dx = _mm_set1_ps(dir.x), dy = _mm_set1_ps(dir.y), dz = _mm_set1_ps(dir.z);
+        const __m128 e1x = _mm_load_ps(block.e1[0]), e1y = _mm_load_ps(block.e1[1]), e1z = _mm_load_ps(block.e1[2]);
+        const __m128 e2x = _mm_load_ps(block.e2[0]), e2y = _mm_load_ps(block.e2[1]), e2z = _mm_load_ps(block.e2[2]);
+        const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f);
+
+        // p = dir x e2
+        const __m128 px = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+        const __m128 py = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+        const __m128 pz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+        const __m128 a = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+        const __m128 absA = _mm_andnot_ps(_mm_set1_ps(-0.0f), a);
+        __m128 valid = _mm_cmpge_ps(absA, _mm_set1_ps(EPS));
+
+        const __m128 f = _mm_div_ps(one, a);
+        const __m128 sx = _mm_sub_ps(_mm_set1_ps(org.x), _mm_load_ps(block.v0[0]));
+        const __m128 sy = _mm_sub_ps(_mm_set1_ps(org.y), _mm_load_ps(block.v0[1]));
+        const __m128 sz = _mm_sub_ps(_mm_set1_ps(org.z), _mm_load_ps(block.v0[2]));
+        const __m128 u = _mm_mul_ps(f, _mm_add_ps(_mm_add_ps(_mm_mul_ps(sx, px), _mm_mul_ps(sy, py)), _mm_mul_ps(sz, pz)));
+        valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpge_ps(u, zero), _mm_cmple_ps(u, one)));
+
+        // q = s x e1
+        const __m128 qx = _mm_sub_ps(_mm_mul_ps(sy, e1z), _mm_mul_ps(sz, e1y));
+        const __m128 qy = _mm_sub_ps(_mm_mul_ps(sz, e1x), _mm_mul_ps(sx, e1z));
+        const __m128 qz = _mm_sub_ps(_mm_mul_ps(sx, e1y), _mm_mul_ps(sy, e1x));
+        const __m128 v = _mm_mul_ps(f, _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)), _mm_mul_ps(dz, qz)));
+        valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpge_ps(v, zero), _mm_cmple_ps(_mm_add_ps(u, v), one)));
+
+        const __m128 dist = _mm_mul_ps(f, _mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)));
+        valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpgt_ps(dist, zero), _mm_cmplt_ps(dist, _mm_set1_ps(distance))));
+
+        hitMask = uint32(_mm_movemask_ps(valid)) & laneMask;
+        _mm_store_ps(t, dist);
+#elif defined(VMAP_TRIANGLE_BLOCK_NEON)
+        const float32x4_t dx = vdupq_n_f32(dir.x), dy = vdupq_n_f32(dir.y), dz = vdupq_n_f32(dir.z);
+        const float32x4_t e1x = vld1q_f32(block.e1[0]), e1y = vld1q_f32(block.e1[1]), e1z = vld1q_f32(block.e1[2]);
+        const float32x4_t e2x = vld1q_f32(block.e2[0]), e2y = vld1q_f32(block.e2[1]), e2z = vld1q_f32(block.e2[2]);
+        const float32x4_t zero = vdupq_n_f32(0.0f), one = vdupq_n_f32(1.0f);
+
+        // p = dir x e2
+        const float32x4_t px = vsubq_f32(vmulq_f32(dy, e2z), vmulq_f32(dz, e2y));
+        const float32x4_t py = vsubq_f32(vmulq_f32(dz, e2x), vmulq_f32(dx, e2z));
+        const float32x4_t pz = vsubq_f32(vmulq_f32(dx, e2y), vmulq_f32(dy, e2x));
+        const float32x4_t a = vaddq_f32(vaddq_f32(vmulq_f32(e1x, px), vmulq_f32(e1y, py)), vmulq_f32(e1z, pz));
+        uint32x4_t valid = vcgeq_f32(vabsq_f32(a), vdupq_n_f32(EPS));
+
+        const float32x4_t f = vdivq_f32(one, a);
+        const float32x4_t sx = vsubq_f32(vdupq_n_f32(org.x), vld1q_f32(block.v0[0]));
+        const float32x4_t sy = vsubq_f32(vdupq_n_f32(org.y), vld1q_f32(block.v0[1]));
+        const float32x4_t sz = vsubq_f32(vdupq_n_f32(org.z), vld1q_f32(block.v0[2]));
+        const float32x4_t u = vmulq_f32(f, vaddq_f32(vaddq_f32(vmulq_f32(sx, px), vmulq_f32(sy, py)), vmulq_f32(sz, pz)));
+        valid = vandq_u32(valid, vandq_u32(vcgeq_f32(u, zero), vcleq_f32(u, one)));
+
+        // q = s x e1
+        const float32x4_t qx = vsubq_f32(vmulq_f32(sy, e1z), vmulq_f32(sz, e1y));
+        const float32x4_t qy = vsubq_f32(vmulq_f32(sz, e1x), vmulq_f32(sx, e1z));
+        const float32x4_t qz = vsubq_f32(vmulq_f32(sx, e1y), vmulq_f32(sy, e1x));
+        const float32x4_t v = vmulq_f32(f, vaddq_f32(vaddq_f32(vmulq_f32(dx, qx), vmulq_f32(dy, qy)), vmulq_f32(dz, qz)));
+        valid = vandq_u32(valid, vandq_u32(vcgeq_f32(v, zero), vcleq_f32(vaddq_f32(u, v), one)));
+
+        const float32x4_t dist = vmulq_f32(f, vaddq_f32(vaddq_f32(vmulq_f32(e2x, qx), vmulq_f32(e2y, qy)), vmulq_f32(e2z, qz)));
+        valid = vandq_u32(valid, vandq_u32(vcgtq_f32(dist, zero), vcltq_f32(dist, vdupq_n_f32(distance))));
+
+        alignas(16) uint32 lanes[4];
+        vst1q_u32(lanes, valid);
+        for (uint32 lane = 0; lane < 4; ++lane)
+        {
+            if (lanes[lane])
+            {
+                hitMask |= 1 << lane;
+            }
         }
+        hitMask &= laneMask;
+        vst1q_f32(t, dist);
+#else
+        for (uint32 lane = 0; lane < 4; ++lane)
+        {
+            if (!(laneMask & (1 << lane)))
+            {
+                continue;
+            }
 
-        const float f = 1.0f / a;
-        const Vector3 s(ray.origin() - points[tri.idx0]);
-        const float u = f * s.dot(p);
+            const Vector3 e1(block.e1[0][lane], block.e1[1][lane], block.e1[2][lane]);
+            const Vector3 e2(block.e2[0][lane], block.e2[1][lane], block.e2[2][lane]);
+            const Vector3 p(dir.cross(e2));
+            const float a = e1.dot(p);
+            if (std::fabs(a) < EPS)
+            {
+                continue;
+            }
 
-        if ((u < 0.0f) || (u > 1.0f))
-        {
-            // We hit the plane of the m_geometry, but outside the m_geometry
-            return false;
-        }
+            const float f = 1.0f / a;
+            const Vector3 s(org - Vector3(block.v0[0][lane], block.v0[1][lane], block.v0[2][lane]));
+            const float u = f * s.dot(p);
+            if ((u < 0.0f) || (u > 1.0f))
+            {
+                continue;
+            }
+
+            const Vector3 q(s.cross(e1));
+            const float v = f * dir.dot(q);
+            if ((v < 0.0f) || ((u + v) > 1.0f))
+            {
+                continue;
+            }
 
-        const Vector3 q(s.cross(e1));
-        const float v = f * ray.direction().dot(q);
+            t[lane] = f * e2.dot(q);
+            if ((t[lane] > 0.0f) && (t[lane] < distance))
+            {
+                hitMask |= 1 << lane;
+            }
+        }
+#endif
 
-        if ((v < 0.0f) || ((u + v) > 1.0f))
+        if (!hitMask)
         {
-            // We hit the plane of the triangle, but outside the triangle
             return false;
         }
 
-        const float t = f * e2.dot(q);
-
-        if ((t > 0.0f) && (t < distance))
+        // closest hit of the block, like testing the lanes one after another
+        for (uint32 lane = 0; lane < 4; ++lane)
         {
-            // This is a new hit, closer than the previous one
-            distance = t;
-
-            /* baryCoord[0] = 1.0 - u - v;
-            baryCoord[1] = u;
-            baryCoord[2] = v; */
-
-            return true;
+            if ((hitMask & (1 << lane)) && t[lane] < distance)
+            {
+                distance = t[lane];
+            }
         }
-        // This hit is after the previous hit, so ignore it
-        return false;
+        return true;
     }
 
     class TriBoundFunc
@@ -313,7 +414,7 @@ namespace VMAP
 
     GroupModel::GroupModel(const GroupModel& other):
         iBound(other.iBound), iMogpFlags(other.iMogpFlags), iGroupWMOID(other.iGroupWMOID),
-        vertices(other.vertices), triangles(other.triangles), meshTree(other.meshTree), iLiquid(0)
+        vertices(other.vertices), triangles(other.triangles), meshTree(other.meshTree), packedTriangles(other.packedTriangles), iLiquid(0)
     {
         if (other.iLiquid)
         {
@@ -327,6 +428,40 @@ namespace VMAP
         triangles.swap(tri);
         TriBoundFunc bFunc(vertices);
         meshTree.build(triangles, bFunc);
+        PackTriangles();
+    }
+
+    void GroupModel::PackTriangles()
+    {
+        packedTriangles.clear();
+        uint32 slots = meshTree.primCount();
+        packedTriangles.resize((slots + 3) / 4, TriangleBlock());
+
+        for (uint32 slot = 0; slot < slots; ++slot)
+        {
+            uint32 index = meshTree.primIndex(slot);
+            if (index >= triangles.size())
+            {
+                continue; // stays degenerate, never hit
+            }
+
+            const MeshTriangle& tri = triangles[index];
+            if (tri.idx0 >= vertices.size() || tri.idx1 >= vertices.size() || tri.idx2 >= vertices.size())
+            {
+                continue;
+            }
+
+            const Vector3& v0 = vertices[tri.idx0];
+            const Vector3 e1 = vertices[tri.idx1] - v0;
+            const Vector3 e2 = vertices[tri.idx2] - v0;
+            TriangleBlock& block = packedTriangles[slot / 4];
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                block.v0[axis][slot % 4] = v0[axis];
+                block.e1[axis][slot % 4] = e1[axis];
+                block.e2[axis][slot % 4] = e2[axis];
+            }
+        }
     }
 
     bool GroupModel::writeToFile(FILE* wf)
@@ -385,6 +520,7 @@ namespace VMAP
         uint32 count = 0;
         triangles.clear();
         vertices.clear();
+        packedTriangles.clear();
         delete iLiquid;
         iLiquid = nullptr;
 
@@ -413,6 +549,7 @@ namespace VMAP
         // read mesh BIH
         if (result && !readChunk(rf, chunk, "MBIH", 4)) { result = false; }
         if (result) { result = meshTree.readFromFile(rf); }
+        if (result) { PackTriangles(); }
 
         // write liquid data
         if (result && !readChunk(rf, chunk, "LIQU", 4)) { result = false; }
@@ -426,16 +563,23 @@ namespace VMAP
 
     struct GModelRayCallback
     {
-        GModelRayCallback(const std::vector<MeshTriangle>& tris, const std::vector<Vector3>& vert):
-            vertices(vert.begin()), triangles(tris.begin()), hit(false) { }
-        bool operator()(const G3D::Ray& ray, uint32 entry, float& distance, bool /*StopAtFirstHit*/)
+        GModelRayCallback(const std::vector<TriangleBlock>& blocks): triangleBlocks(blocks), hit(false) { }
+        bool IntersectLeaf(const G3D::Ray& ray, uint32 firstSlot, uint32 count, float& distance)
         {
-            bool result = IntersectTriangle(triangles[entry], vertices, ray, distance);
-            if (result) { hit = true; }
+            // a leaf may start in the middle of a block and reach into the next one
+            uint32 slot = firstSlot;
+            uint32 const end = firstSlot + count;
+            while (slot < end)
+            {
+                uint32 lane = slot % 4;
+                uint32 lanes = std::min(4 - lane, end - slot);
+                uint32 laneMask = ((1 << lanes) - 1) << lane;
+                if (IntersectTriangleBlock(triangleBlocks[slot / 4], laneMask, ray, distance)) { hit = true; }
+                slot += lanes;
+            }
             return hit;
         }
-        std::vector<Vector3>::const_iterator vertices;
-        std::vector<MeshTriangle>::const_iterator triangles;
+        const std::vector<TriangleBlock>& triangleBlocks;
         bool hit;
     };
 
@@ -446,7 +590,7 @@ namespace VMAP
             return false;
         }
 
-        GModelRayCallback callback(triangles, vertices);
+        GModelRayCallback callback(packedTriangles);
         meshTree.intersectRay(ray, callback, distance, stopAtFirstHit);
         return callback.hit;
     }
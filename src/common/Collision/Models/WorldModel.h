@@ -23,6 +23,7 @@
 #include <G3D/AABox.h>
 #include <G3D/Ray.h>
 #include <G3D/Vector3.h>
+#include <vector>
 
 namespace VMAP
 {
@@ -43,6 +44,14 @@ namespace VMAP
         uint32 idx2{0};
     };
 
+    /*! four triangles with their edges precomputed, lanes are in mesh BIH slot order */
+    struct alignas(16) TriangleBlock
+    {
+        float v0[3][4];
+        float e1[3][4];
+        float e2[3][4];
+    };
+
     class WmoLiquid
     {
     public:
@@ -100,7 +109,10 @@ namespace VMAP
         std::vector<G3D::Vector3> vertices;
         std::vector<MeshTriangle> triangles;
         BIH meshTree;
+        std::vector<TriangleBlock> packedTriangles;
         WmoLiquid* iLiquid{nullptr};
+
+        void PackTriangles();
     };
     /*! Holds a model (converted M2 or WMO) in its original coordinate space */
     class WorldModel
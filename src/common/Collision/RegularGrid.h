@@ -1,11 +1,13 @@
 #ifndef _REGULAR_GRID_H
 #define _REGULAR_GRID_H
 
+#include <G3D/AABox.h>
 #include <G3D/PositionTrait.h>
 #include <G3D/Ray.h>
 #include <G3D/Table.h>
 
 #include "Errors.h"
+#include <algorithm>
 
 template <class Node>
 class NodeArray
@@ -274,6 +276,25 @@ public:
         }
     }
 
+    // Visits every node covered by box, members spanning several nodes are passed once per node
+    template<typename IsectCallback>
+    void intersectBox(const G3D::AABox& box, IsectCallback& intersectCallback)
+    {
+        Cell low = Cell::ComputeCell(box.low().x, box.low().y);
+        Cell high = Cell::ComputeCell(box.high().x, box.high().y);
+        low.x = std::max(low.x, 0);
+        low.y = std::max(low.y, 0);
+        high.x = std::min<int>(high.x, CELL_NUMBER - 1);
+        high.y = std::min<int>(high.y, CELL_NUMBER - 1);
+
+        for (int x = low.x; x <= high.x; ++x)
+            for (int y = low.y; y <= high.y; ++y)
+                if (Node* node = nodes[x][y])
+                {
+                    node->intersectBox(box, intersectCallback);
+                }
+    }
+
     // Optimized verson of intersectRay function for rays with vertical directions
     template<typename RayCallback>
     void intersectZAllignedRay(const G3D::Ray& ray, RayCallback& intersectCallback, float& max_dist)
@@ -37,9 +37,20 @@ namespace
     std::vector<std::string> _args;
     std::unordered_map<std::string /*name*/, std::string /*value*/> _configOptions;
     std::unordered_map<std::string /*name*/, std::string /*value*/> _envVarCache;
+    std::mutex _envVarCacheLock;
     std::mutex _configLock;
     ConfigPolicy _policy;
 
+    std::unordered_set<std::string> _reportedRuntimeLookups;
+    std::mutex _runtimeLookupLock;
+
+    void ReportRuntimeLookup(std::string const& name)
+    {
+        std::lock_guard<std::mutex> lock(_runtimeLookupLock);
+        if (_reportedRuntimeLookups.insert(name).second)
+            LOG_WARN("server", "> Config: Option '{}' is looked up by name during the map updates, register it as a ConfigOption instead.", name);
+    }
+
     std::unordered_set<std::string> _criticalConfigOptions =
     {
         "RealmID",
@@ -488,6 +499,7 @@ bool ConfigMgr::Reload()
 // if not, check the env for the value
 Optional<std::string> GetEnvFromCache(std::string const& configName, std::string const& envVarName)
 {
+    std::lock_guard<std::mutex> lock(_envVarCacheLock);
     auto foundInCache = _envVarCache.find(envVarName);
     Optional<std::string> foundInEnv;
     // If it's not in the cache
@@ -533,6 +545,9 @@ std::vector<std::string> ConfigMgr::OverrideWithEnvVariablesIfAny()
 template<class T>
 T ConfigMgr::GetValueDefault(std::string const& name, T const& def, bool showLogs /*= true*/) const
 {
+    if (_warnRuntimeLookups)
+        ReportRuntimeLookup(name);
+
     std::string strValue;
 
     auto const& itr = _configOptions.find(name);
@@ -600,6 +615,9 @@ T ConfigMgr::GetValueDefault(std::string const& name, T const& def, bool showLog
 template<>
 std::string ConfigMgr::GetValueDefault<std::string>(std::string const& name, std::string const& def, bool showLogs /*= true*/) const
 {
+    if (_warnRuntimeLookups)
+        ReportRuntimeLookup(name);
+
     auto const& itr = _configOptions.find(name);
     bool notFound = itr == _configOptions.end();
     auto envVarName = GetEnvVarName(name);
@@ -68,6 +68,9 @@ public:
     template<class T>
     T GetOption(std::string const& name, T const& def, bool showLogs = true) const;
 
+    /// Logs once per option the lookups by name made on this thread, set on the threads where ConfigOption should be used instead
+    void WarnAboutRuntimeLookups(bool warn) { _warnRuntimeLookups = warn; }
+
     bool isDryRun() { return dryRun; }
     void setDryRun(bool mode) { dryRun = mode; }
 
@@ -80,6 +83,7 @@ private:
     T GetValueDefault(std::string const& name, T const& def, bool showLogs = true) const;
 
     bool dryRun = false;
+    static inline thread_local bool _warnRuntimeLookups = false;
 
     std::vector<std::string /*config variant*/> _moduleConfigFiles;
 };
@@ -0,0 +1,39 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ConfigValueCache.h"
+
+ConfigOptionRegistry* ConfigOptionRegistry::instance()
+{
+    static ConfigOptionRegistry instance;
+    return &instance;
+}
+
+void ConfigOptionRegistry::Load()
+{
+    std::lock_guard<std::mutex> lock(_registerLock);
+
+    for (Option& option : _options)
+    {
+        option.Current = std::visit([&option](auto const& defaultValue) -> Value
+        {
+            return sConfigMgr->GetOption<std::decay_t<decltype(defaultValue)>>(option.Name, defaultValue);
+        }, option.Default);
+    }
+
+    _generation.fetch_add(1, std::memory_order_acq_rel);
+}
@@ -22,6 +22,10 @@
 #include "Config.h"
 #include "Errors.h"
 #include "Log.h"
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
 #include <variant>
 
 template<typename ConfigEnum>
@@ -142,4 +146,83 @@ private:
     bool _reloading;
 };
 
+/*
+ * Config options of modules and scripts, read by index instead of by name.
+ *
+ * Options are registered once, usually by a ConfigOption<T> at namespace
+ * scope, and interned: registering a name again returns the same index. The
+ * values are read from the config files by Load(), called with the world
+ * config on startup and on every reload, which also increments the
+ * generation so that code caching values derived from the options can tell
+ * when to rebuild them. Reads don't lock anything: like the world config,
+ * the values only change while the maps aren't updating.
+ */
+class AC_COMMON_API ConfigOptionRegistry
+{
+public:
+    using Value = std::variant<bool, int32, uint32, float, std::string>;
+
+    static ConfigOptionRegistry* instance();
+
+    template<class T>
+    uint32 Register(std::string const& name, T const& defaultValue)
+    {
+        std::lock_guard<std::mutex> lock(_registerLock);
+
+        auto itr = _indexes.find(name);
+        if (itr != _indexes.end())
+        {
+            ASSERT(std::holds_alternative<T>(_options[itr->second].Default), "Config option {} registered with two different types", name);
+            return itr->second;
+        }
+
+        // registered after the config was loaded, read it right away
+        T value = GetGeneration() ? sConfigMgr->GetOption<T>(name, defaultValue) : defaultValue;
+
+        uint32 const index = _options.size();
+        _options.push_back({ name, defaultValue, std::move(value) });
+        _indexes.emplace(name, index);
+        return index;
+    }
+
+    // reads every registered option from the config, on startup and after each reload
+    void Load();
+
+    template<class T>
+    [[nodiscard]] T const& GetValue(uint32 index) const { return std::get<T>(_options[index].Current); }
+
+    // 0 until the first Load(), then incremented by each Load()
+    [[nodiscard]] uint32 GetGeneration() const { return _generation.load(std::memory_order_acquire); }
+
+private:
+    ConfigOptionRegistry() = default;
+
+    struct Option
+    {
+        std::string Name;
+        Value Default;
+        Value Current;
+    };
+
+    std::deque<Option> _options;
+    std::unordered_map<std::string, uint32> _indexes;
+    std::mutex _registerLock;
+    std::atomic<uint32> _generation{ 0 };
+};
+
+#define sConfigOptions ConfigOptionRegistry::instance()
+
+// Handle of a registered config option, the cheap replacement of sConfigMgr->GetOption<T>() outside of loading code
+template<class T>
+class ConfigOption
+{
+public:
+    ConfigOption(std::string const& name, T const& defaultValue) : _index(sConfigOptions->Register<T>(name, defaultValue)) { }
+
+    [[nodiscard]] T const& Get() const { return sConfigOptions->GetValue<T>(_index); }
+
+private:
+    uint32 _index;
+};
+
 #endif
@@ -27,14 +27,18 @@ public:
     AuthCrypt() = default;
 
     void Init(SessionKey const& K);
+    // the other end of the connection, for test clients
+    void InitClient(SessionKey const& K);
     void DecryptRecv(uint8* data, std::size_t len);
     void EncryptSend(uint8* data, std::size_t len);
 
     bool IsInitialized() const { return _initialized; }
 
 private:
-    Acore::Crypto::ARC4 _clientDecrypt;
-    Acore::Crypto::ARC4 _serverEncrypt;
+    void Init(SessionKey const& K, std::array<uint8, 16> const& encryptionKey, std::array<uint8, 16> const& decryptionKey);
+
+    Acore::Crypto::ARC4 _decrypt;
+    Acore::Crypto::ARC4 _encrypt;
     bool _initialized{ false };
 };
 #endif
@@ -110,3 +110,30 @@ std::optional<SessionKey> SRP6::VerifyChallengeResponse(EphemeralKey const& A, S
 
     return std::nullopt;
 }
+
+/*static*/ std::optional<SRP6::ClientProof> SRP6::MakeClientProof(std::string const& username, std::string const& password, Salt const& salt, EphemeralKey const& B)
+{
+    BigNumber const _B(B);
+    if ((_B % _N).IsZero())
+        return std::nullopt;
+
+    ClientProof proof;
+    BigNumber const a(Crypto::GetRandomBytes<19>());
+    proof.A = _g.ModExp(a, _N).ToByteArray<EPHEMERAL_KEY_LENGTH>();
+
+    // S = (B - 3 * g ^ x) ^ (a + u * x) mod N, B is brought above 3 * g ^ x first
+    BigNumber const x(SHA1::GetDigestOf(salt, SHA1::GetDigestOf(username, ":", password)));
+    BigNumber const u(SHA1::GetDigestOf(proof.A, B));
+    BigNumber const base = (_B + _N * 3 - _g.ModExp(x, _N) * 3) % _N;
+    EphemeralKey const S = base.ModExp(a + u * x, _N).ToByteArray<EPHEMERAL_KEY_LENGTH>();
+
+    proof.K = SHA1Interleave(S);
+
+    SHA1::Digest const NHash = SHA1::GetDigestOf(N);
+    SHA1::Digest const gHash = SHA1::GetDigestOf(g);
+    SHA1::Digest NgHash;
+    std::transform(NHash.begin(), NHash.end(), gHash.begin(), NgHash.begin(), std::bit_xor<>());
+
+    proof.M = SHA1::GetDigestOf(NgHash, SHA1::GetDigestOf(username), salt, proof.A, B, proof.K);
+    return proof;
+}
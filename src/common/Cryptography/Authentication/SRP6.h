@@ -57,6 +57,17 @@ namespace Acore::Crypto
         SRP6(std::string const& username, Salt const& salt, Verifier const& verifier);
         std::optional<SessionKey> VerifyChallengeResponse(EphemeralKey const& A, SHA1::Digest const& clientM);
 
+        // the client side of the exchange, for test clients
+        struct ClientProof
+        {
+            EphemeralKey A;
+            SHA1::Digest M;
+            SessionKey K;
+        };
+
+        // username + password must be passed through Utf8ToUpperOnlyLatin FIRST!
+        static std::optional<ClientProof> MakeClientProof(std::string const& username, std::string const& password, Salt const& salt, EphemeralKey const& B);
+
     private:
         bool _used = false; // a single instance can only be used to verify once
 
@@ -17,71 +17,112 @@
 
 #include "DBCFileLoader.h"
 #include "Errors.h"
+#include <algorithm>
 #include <string.h>
 
-DBCFileLoader::DBCFileLoader() : recordSize(0), recordCount(0), fieldCount(0), stringSize(0), fieldsOffset(nullptr), data(nullptr), stringTable(nullptr) { }
+#if AC_PLATFORM == AC_PLATFORM_WINDOWS
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
-bool DBCFileLoader::Load(char const* filename, char const* fmt)
+DBCFileMapping::~DBCFileMapping()
 {
-    uint32 header;
-    if (data)
-    {
-        delete [] data;
-        data = nullptr;
-    }
+#if AC_PLATFORM == AC_PLATFORM_WINDOWS
+    UnmapViewOfFile(_data);
+#else
+    munmap(_data, _size);
+#endif
+}
 
-    FILE* f = fopen(filename, "rb");
-    if (!f)
-    {
-        return false;
-    }
+std::shared_ptr<DBCFileMapping> DBCFileMapping::Open(char const* filename)
+{
+#if AC_PLATFORM == AC_PLATFORM_WINDOWS
+    HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return nullptr;
 
-    if (fread(&header, 4, 1, f) != 1)                        // Number of records
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || !size.QuadPart)
     {
-        fclose(f);
-        return false;
+        CloseHandle(file);
+        return nullptr;
     }
 
-    EndianConvert(header);
+    // the view keeps the file mapping alive once both handles are closed
+    HANDLE fileMapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!fileMapping)
+        return nullptr;
 
-    if (header != 0x43424457)                                //'WDBC'
-    {
-        fclose(f);
-        return false;
-    }
+    void* view = MapViewOfFile(fileMapping, FILE_MAP_COPY, 0, 0, 0);
+    CloseHandle(fileMapping);
+    if (!view)
+        return nullptr;
 
-    if (fread(&recordCount, 4, 1, f) != 1)                   // Number of records
+    return std::shared_ptr<DBCFileMapping>(new DBCFileMapping(static_cast<unsigned char*>(view), std::size_t(size.QuadPart)));
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return nullptr;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0)
     {
-        fclose(f);
-        return false;
+        close(fd);
+        return nullptr;
     }
 
-    EndianConvert(recordCount);
+    // some entries are patched after loading, private pages keep those writes out of the file
+    void* view = mmap(nullptr, std::size_t(st.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED)
+        return nullptr;
 
-    if (fread(&fieldCount, 4, 1, f) != 1)                    // Number of fields
+    return std::shared_ptr<DBCFileMapping>(new DBCFileMapping(static_cast<unsigned char*>(view), std::size_t(st.st_size)));
+#endif
+}
+
+DBCFileLoader::DBCFileLoader() : recordSize(0), recordCount(0), fieldCount(0), stringSize(0), fieldsOffset(nullptr), data(nullptr), stringTable(nullptr) { }
+
+bool DBCFileLoader::Load(char const* filename, char const* fmt)
+{
+    uint32 header[5];
+    data = nullptr;
+    stringTable = nullptr;
+    mapping.reset();
+
+    std::shared_ptr<DBCFileMapping> file = DBCFileMapping::Open(filename);
+    if (!file || file->GetSize() < sizeof(header))
     {
-        fclose(f);
         return false;
     }
 
-    EndianConvert(fieldCount);
+    memcpy(header, file->GetData(), sizeof(header));
+    for (uint32& value : header)
+    {
+        EndianConvert(value);
+    }
 
-    if (fread(&recordSize, 4, 1, f) != 1)                    // Size of a record
+    if (header[0] != 0x43424457)                             //'WDBC'
     {
-        fclose(f);
         return false;
     }
 
-    EndianConvert(recordSize);
+    recordCount = header[1];                                 // Number of records
+    fieldCount = header[2];                                  // Number of fields
+    recordSize = header[3];                                  // Size of a record
+    stringSize = header[4];                                  // String size
 
-    if (fread(&stringSize, 4, 1, f) != 1)                    // String size
+    if (uint64(recordSize) * recordCount + stringSize > file->GetSize() - sizeof(header))
     {
-        fclose(f);
         return false;
     }
 
-    EndianConvert(stringSize);
-
+    delete[] fieldsOffset;
     fieldsOffset = new uint32[fieldCount];
     fieldsOffset[0] = 0;
 
@@ -98,24 +139,15 @@ bool DBCFileLoader::Load(char const* filename, char const* fmt)
         }
     }
 
-    data = new unsigned char[recordSize * recordCount + stringSize];
+    mapping = std::move(file);
+    data = mapping->GetData() + sizeof(header);
     stringTable = data + recordSize * recordCount;
 
-    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
-    {
-        fclose(f);
-        return false;
-    }
-
-    fclose(f);
-
     return true;
 }
 
 DBCFileLoader::~DBCFileLoader()
 {
-    delete[] data;
-
     delete[] fieldsOffset;
 }
 
@@ -273,15 +305,80 @@ char* DBCFileLoader::AutoProduceData(char const* format, uint32& records, char**
     return dataTable;
 }
 
-char* DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
+char* DBCFileLoader::AutoProduceDataInPlace(char const* format, uint32& records, char**& indexTable)
 {
-    if (strlen(format) != fieldCount)
+#if ACORE_ENDIAN == ACORE_BIGENDIAN
+    (void)format;
+    (void)records;
+    (void)indexTable;
+    return nullptr;
+#else
+    typedef char* ptr;
+    if (!data || strlen(format) != fieldCount)
+    {
+        return nullptr;
+    }
+
+    // only 4 byte and byte values, without skipped fields, are laid out in the file like in the structure
+    int32 i = -1;
+    for (uint32 x = 0; x < fieldCount; ++x)
+    {
+        switch (format[x])
+        {
+            case FT_IND:
+                i = x;
+                break;
+            case FT_FLOAT:
+            case FT_INT:
+            case FT_BYTE:
+                break;
+            default:
+                return nullptr;
+        }
+    }
+
+    if (GetFormatRecordSize(format) != recordSize || recordSize % sizeof(uint32))
     {
         return nullptr;
     }
 
-    char* stringPool = new char[stringSize];
-    memcpy(stringPool, stringTable, stringSize);
+    if (i >= 0)
+    {
+        uint32 maxi = 0;
+        for (uint32 y = 0; y < recordCount; ++y)
+        {
+            maxi = std::max(maxi, getRecord(y).getUInt(i));
+        }
+
+        records = maxi + 1;
+        indexTable = new ptr[records];
+        memset(indexTable, 0, records * sizeof(ptr));
+    }
+    else
+    {
+        records = recordCount;
+        indexTable = new ptr[recordCount];
+    }
+
+    for (uint32 y = 0; y < recordCount; ++y)
+    {
+        indexTable[i >= 0 ? getRecord(y).getUInt(i) : y] = reinterpret_cast<char*>(data + y * recordSize);
+    }
+
+    return reinterpret_cast<char*>(data);
+#endif
+}
+
+bool DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
+{
+    if (strlen(format) != fieldCount)
+    {
+        return false;
+    }
+
+    // the strings are used from the mapping, only their pages which are read get loaded
+    char* stringPool = reinterpret_cast<char*>(stringTable);
+    bool referenced = false;
 
     uint32 offset = 0;
 
@@ -309,6 +406,7 @@ char* DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
                     {
                         const char* st = getRecord(y).getString(x);
                         *slot = stringPool + (st - (char const*)stringTable);
+                        referenced = true;
                     }
                     offset += sizeof(char*);
                     break;
@@ -327,5 +425,5 @@ char* DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
         }
     }
 
-    return stringPool;
+    return referenced;
 }
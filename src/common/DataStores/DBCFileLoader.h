@@ -21,6 +21,7 @@
 #include "Define.h"
 #include "Errors.h"
 #include "Utilities/ByteConverter.h"
+#include <memory>
 
 enum DbcFieldFormat
 {
@@ -35,6 +36,28 @@ enum DbcFieldFormat
     FT_LOGIC = 'l'                                           //Logical (boolean)
 };
 
+// Private mapping of a whole file, written pages are copied instead of reaching the file
+class DBCFileMapping
+{
+public:
+    ~DBCFileMapping();
+
+    // nullptr when the file can't be opened or is empty
+    static std::shared_ptr<DBCFileMapping> Open(char const* filename);
+
+    [[nodiscard]] unsigned char* GetData() const { return _data; }
+    [[nodiscard]] std::size_t GetSize() const { return _size; }
+
+private:
+    DBCFileMapping(unsigned char* data, std::size_t size) : _data(data), _size(size) { }
+
+    unsigned char* _data;
+    std::size_t _size;
+
+    DBCFileMapping(DBCFileMapping const& right) = delete;
+    DBCFileMapping& operator=(DBCFileMapping const& right) = delete;
+};
+
 class DBCFileLoader
 {
 public:
@@ -93,7 +116,12 @@ public:
     [[nodiscard]] uint32 GetOffset(std::size_t id) const { return (fieldsOffset != nullptr && id < fieldCount) ? fieldsOffset[id] : 0; }
     [[nodiscard]] bool IsLoaded() const { return data != nullptr; }
     char* AutoProduceData(char const* fmt, uint32& count, char**& indexTable);
-    char* AutoProduceStrings(char const* fmt, char* dataTable);
+    // the records of the mapping itself when their layout is the one of fmt, nullptr otherwise
+    char* AutoProduceDataInPlace(char const* fmt, uint32& count, char**& indexTable);
+    // points the string fields of dataTable into the mapped string table, true if any field references it
+    bool AutoProduceStrings(char const* fmt, char* dataTable);
+    // kept alive by the owners of the data and strings produced from this file
+    [[nodiscard]] std::shared_ptr<DBCFileMapping> const& GetMapping() const { return mapping; }
     static uint32 GetFormatRecordSize(const char* format, int32* index_pos = nullptr);
 
 private:
@@ -104,6 +132,7 @@ private:
     uint32* fieldsOffset;
     unsigned char* data;
     unsigned char* stringTable;
+    std::shared_ptr<DBCFileMapping> mapping;
 
     DBCFileLoader(DBCFileLoader const& right) = delete;
     DBCFileLoader& operator=(DBCFileLoader const& right) = delete;
@@ -24,6 +24,7 @@
  */
 
 #include "Dynamic/TypeList.h"
+#include "GridObjectVector.h"
 #include "GridRefMgr.h"
 #include <unordered_map>
 #include <vector>
@@ -36,7 +37,7 @@
 template<class OBJECT>
 struct ContainerMapList
 {
-    GridRefMgr<OBJECT> _element;
+    GridObjectVector<OBJECT> _element;
 };
 
 template<>
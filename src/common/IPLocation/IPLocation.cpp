@@ -21,7 +21,10 @@
 #include "IpAddress.h"
 #include "Log.h"
 #include "StringConvert.h"
+#include <algorithm>
 #include <fstream>
+#include <limits>
+#include <unordered_map>
 IpLocationStore::IpLocationStore()
 {
 }
@@ -30,9 +33,41 @@ IpLocationStore::~IpLocationStore()
 {
 }
 
+namespace
+{
+    // Next comma separated field of a line, without its quotation marks
+    std::string_view NextField(std::string_view& line, bool last)
+    {
+        std::string_view field = line;
+        if (!last)
+        {
+            std::size_t const comma = line.find(',');
+            if (comma == std::string_view::npos)
+            {
+                line = {};
+                return {};
+            }
+
+            field = line.substr(0, comma);
+            line.remove_prefix(comma + 1);
+        }
+
+        while (!field.empty() && (field.back() == '\r' || field.back() == '\n'))
+            field.remove_suffix(1);
+
+        if (field.size() >= 2 && field.front() == '"' && field.back() == '"')
+            field = field.substr(1, field.size() - 2);
+
+        return field;
+    }
+}
+
 void IpLocationStore::Load()
 {
-    _ipLocationStore.clear();
+    _ipFrom.clear();
+    _ipTo.clear();
+    _countryIndex.clear();
+    _countries.clear();
     LOG_INFO("server.loading", "Loading IP Location Database...");
 
     std::string databaseFilePath = sConfigMgr->GetOption<std::string>("IPLocationFile", "");
@@ -56,35 +91,26 @@ void IpLocationStore::Load()
         return;
     }
 
-    std::string ipFrom;
-    std::string ipTo;
-    std::string countryCode;
-    std::string countryName;
-
-    while (databaseFile.good())
+    struct Range
+    {
+        uint32 IpFrom;
+        uint32 IpTo;
+        uint16 Country;
+    };
+
+    // country strings are stored once, the ranges only keep their index
+    std::vector<Range> ranges;
+    std::unordered_map<std::string, uint16> countryIndexes;
+    std::string line;
+    std::string countryKey;
+
+    while (std::getline(databaseFile, line))
     {
-        // Read lines
-        if (!std::getline(databaseFile, ipFrom, ','))
-            break;
-        if (!std::getline(databaseFile, ipTo, ','))
-            break;
-        if (!std::getline(databaseFile, countryCode, ','))
-            break;
-        if (!std::getline(databaseFile, countryName, '\n'))
-            break;
-
-        // Remove new lines and return
-        countryName.erase(std::remove(countryName.begin(), countryName.end(), '\r'), countryName.end());
-        countryName.erase(std::remove(countryName.begin(), countryName.end(), '\n'), countryName.end());
-
-        // Remove quotation marks
-        ipFrom.erase(std::remove(ipFrom.begin(), ipFrom.end(), '"'), ipFrom.end());
-        ipTo.erase(std::remove(ipTo.begin(), ipTo.end(), '"'), ipTo.end());
-        countryCode.erase(std::remove(countryCode.begin(), countryCode.end(), '"'), countryCode.end());
-        countryName.erase(std::remove(countryName.begin(), countryName.end(), '"'), countryName.end());
-
-        // Convert country code to lowercase
-        std::transform(countryCode.begin(), countryCode.end(), countryCode.begin(), ::tolower);
+        std::string_view fields(line);
+        std::string_view ipFrom = NextField(fields, false);
+        std::string_view ipTo = NextField(fields, false);
+        std::string_view countryCode = NextField(fields, false);
+        std::string_view countryName = NextField(fields, true);
 
         auto IpFrom = Acore::StringTo<uint32>(ipFrom);
         auto IpTo = Acore::StringTo<uint32>(ipTo);
@@ -92,34 +118,70 @@ void IpLocationStore::Load()
         if (!IpFrom || !IpTo)
             continue;
 
-        _ipLocationStore.emplace_back(*IpFrom, *IpTo, std::move(countryCode), std::move(countryName));
+        countryKey.assign(countryCode).append(1, ',').append(countryName);
+        auto [itr, inserted] = countryIndexes.try_emplace(countryKey, uint16(_countries.size()));
+        if (inserted)
+        {
+            ASSERT(_countries.size() <= std::numeric_limits<uint16>::max(), "Too many countries in ip database file");
+
+            // Convert country code to lowercase
+            std::string code(countryCode);
+            std::transform(code.begin(), code.end(), code.begin(), ::tolower);
+            _countries.emplace_back(std::move(code), std::string(countryName));
+        }
+
+        ranges.push_back({ *IpFrom, *IpTo, itr->second });
     }
 
-    std::sort(_ipLocationStore.begin(), _ipLocationStore.end(), [](IpLocationRecord const& a, IpLocationRecord const& b) { return a.IpFrom < b.IpFrom; });
-    ASSERT(std::is_sorted(_ipLocationStore.begin(), _ipLocationStore.end(), [](IpLocationRecord const& a, IpLocationRecord const& b) { return a.IpFrom < b.IpTo; }),
+    std::sort(ranges.begin(), ranges.end(), [](Range const& a, Range const& b) { return a.IpFrom < b.IpFrom; });
+    ASSERT(std::is_sorted(ranges.begin(), ranges.end(), [](Range const& a, Range const& b) { return a.IpFrom < b.IpTo; }),
         "Overlapping IP ranges detected in database file");
 
+    _ipFrom.reserve(ranges.size());
+    _ipTo.reserve(ranges.size());
+    _countryIndex.reserve(ranges.size());
+    for (Range const& range : ranges)
+    {
+        _ipFrom.push_back(range.IpFrom);
+        _ipTo.push_back(range.IpTo);
+        _countryIndex.push_back(range.Country);
+    }
+
     databaseFile.close();
 
-    LOG_INFO("server.loading", ">> Loaded {} ip location entries.", static_cast<uint32>(_ipLocationStore.size()));
+    LOG_INFO("server.loading", ">> Loaded {} ip location entries of {} countries.", static_cast<uint32>(_ipTo.size()), static_cast<uint32>(_countries.size()));
     LOG_INFO("server.loading", " ");
 }
 
 IpLocationRecord const* IpLocationStore::GetLocationRecord(std::string const& ipAddress) const
 {
+    if (_ipTo.empty())
+        return nullptr;
+
     uint32 ip = Acore::Net::address_to_uint(Acore::Net::make_address_v4(ipAddress));
-    auto itr = std::upper_bound(_ipLocationStore.begin(), _ipLocationStore.end(), ip, [](uint32 ip, IpLocationRecord const& loc) { return ip < loc.IpTo; });
-    if (itr == _ipLocationStore.end())
+
+    // first range ending after ip, the halving only selects the next base and compiles without branches
+    uint32 const* base = _ipTo.data();
+    std::size_t length = _ipTo.size();
+    while (length > 1)
+    {
+        std::size_t const half = length / 2;
+        base = (base[half - 1] <= ip) ? base + half : base;
+        length -= half;
+    }
+
+    std::size_t const index = std::size_t(base - _ipTo.data()) + (*base <= ip ? 1 : 0);
+    if (index == _ipTo.size())
     {
         return nullptr;
     }
 
-    if (ip < itr->IpFrom)
+    if (ip < _ipFrom[index])
     {
         return nullptr;
     }
 
-    return &(*itr);
+    return &_countries[_countryIndex[index]];
 }
 
 IpLocationStore* IpLocationStore::instance()
@@ -19,15 +19,13 @@
 #include <string>
 #include <vector>
 
+// Country of an ip range, shared by all ranges of the same country
 struct IpLocationRecord
 {
-    IpLocationRecord() :
-        IpFrom(0), IpTo(0) { }
-    IpLocationRecord(uint32 ipFrom, uint32 ipTo, std::string countryCode, std::string countryName) :
-        IpFrom(ipFrom), IpTo(ipTo), CountryCode(std::move(countryCode)), CountryName(std::move(countryName)) { }
+    IpLocationRecord() { }
+    IpLocationRecord(std::string countryCode, std::string countryName) :
+        CountryCode(std::move(countryCode)), CountryName(std::move(countryName)) { }
 
-    uint32 IpFrom;
-    uint32 IpTo;
     std::string CountryCode;
     std::string CountryName;
 };
@@ -43,7 +41,11 @@ public:
     IpLocationRecord const* GetLocationRecord(std::string const& ipAddress) const;
 
 private:
-    std::vector<IpLocationRecord> _ipLocationStore;
+    // ranges sorted by start, one entry per range in each array
+    std::vector<uint32> _ipFrom;
+    std::vector<uint32> _ipTo;
+    std::vector<uint16> _countryIndex;
+    std::vector<IpLocationRecord> _countries;
 };
 
 #define sIPLocation IpLocationStore::instance()
@@ -0,0 +1,199 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AppenderBinary.h"
+#include "BinaryLogFormat.h"
+#include "ByteConverter.h"
+#include "Log.h"
+#include "LogMessage.h"
+#include "StringConvert.h"
+#include "Timer.h"
+#include <algorithm>
+#include <limits>
+
+using namespace Acore::BinaryLog;
+
+AppenderBinary::AppenderBinary(uint8 id, std::string const& name, LogLevel level, AppenderFlags flags, std::vector<std::string_view> const& args) :
+    Appender(id, name, level, flags),
+    _logfile(nullptr),
+    _maxFileSize(0),
+    _fileSize(0)
+{
+    if (args.size() < 4)
+    {
+        throw InvalidAppenderArgsException(Acore::StringFormat("Log::CreateAppenderFromConfig: Missing file name for appender {}", name));
+    }
+
+    _fileName.assign(args[3]);
+
+    // every file carries its own logger type table, one file per message is not supported
+    if (_fileName.find("%s") != std::string::npos)
+    {
+        throw InvalidAppenderArgsException(Acore::StringFormat("Log::CreateAppenderFromConfig: Dynamic file name is not supported by binary appender {}", name));
+    }
+
+    std::string mode = "a";
+    if (4 < args.size())
+    {
+        mode.assign(args[4]);
+    }
+
+    if (flags & APPENDER_FLAGS_USE_TIMESTAMP)
+    {
+        std::size_t dot_pos = _fileName.find_last_of('.');
+        if (dot_pos != std::string::npos)
+        {
+            _fileName.insert(dot_pos, sLog->GetLogsTimestamp());
+        }
+        else
+        {
+            _fileName += sLog->GetLogsTimestamp();
+        }
+    }
+
+    if (5 < args.size())
+    {
+        if (Optional<uint32> size = Acore::StringTo<uint32>(args[5]))
+        {
+            _maxFileSize = *size;
+        }
+        else
+        {
+            throw InvalidAppenderArgsException(Acore::StringFormat("Log::CreateAppenderFromConfig: Invalid size '{}' for appender {}", args[5], name));
+        }
+    }
+
+    _backup = (flags & APPENDER_FLAGS_MAKE_FILE_BACKUP) != 0;
+
+    OpenFile(mode, (mode == "w") && _backup);
+}
+
+AppenderBinary::~AppenderBinary()
+{
+    CloseFile();
+}
+
+void AppenderBinary::_write(LogMessage const* message)
+{
+    // record header, type id, level, time and text length
+    if (_maxFileSize > 0 && (_fileSize + message->text.size() + 16) > _maxFileSize)
+    {
+        OpenFile("w", true);
+    }
+
+    if (!_logfile)
+    {
+        return;
+    }
+
+    _record.clear();
+
+    uint16 loggerTypeId = GetLoggerTypeId(message->type);
+    Append<uint8>(BINARY_LOG_RECORD_MESSAGE);
+    Append<uint16>(loggerTypeId);
+    Append<uint8>(message->level);
+    Append<uint64>(message->mtime.count());
+    AppendString<uint32>(message->text);
+
+    fwrite(_record.data(), 1, _record.size(), _logfile);
+    _fileSize += _record.size();
+
+    // records stay in the stdio buffer, errors are flushed right away so they survive a crash
+    if (message->level <= LOG_LEVEL_ERROR)
+    {
+        fflush(_logfile);
+    }
+}
+
+uint16 AppenderBinary::GetLoggerTypeId(std::string const& loggerType)
+{
+    auto itr = _loggerTypeIds.find(loggerType);
+    if (itr != _loggerTypeIds.end())
+    {
+        return itr->second;
+    }
+
+    uint16 loggerTypeId = uint16(_loggerTypeIds.size());
+    _loggerTypeIds.emplace(loggerType, loggerTypeId);
+
+    Append<uint8>(BINARY_LOG_RECORD_LOGGER_TYPE);
+    Append<uint16>(loggerTypeId);
+    AppendString<uint16>(loggerType);
+    return loggerTypeId;
+}
+
+template<class T>
+void AppenderBinary::Append(T value)
+{
+    EndianConvert(value);
+    uint8 const* data = reinterpret_cast<uint8 const*>(&value);
+    _record.insert(_record.end(), data, data + sizeof(T));
+}
+
+template<class Length>
+void AppenderBinary::AppendString(std::string const& str)
+{
+    Length length = Length(std::min<std::size_t>(str.size(), std::numeric_limits<Length>::max()));
+    Append<Length>(length);
+    _record.insert(_record.end(), str.begin(), str.begin() + length);
+}
+
+void AppenderBinary::OpenFile(std::string const& mode, bool backup)
+{
+    CloseFile();
+
+    std::string fullName(sLog->GetLogsDir() + _fileName);
+    if (backup)
+    {
+        std::string newName(fullName);
+        newName.push_back('.');
+        newName.append(LogMessage::getTimeStr(GetEpochTime()));
+        std::replace(newName.begin(), newName.end(), ':', '-');
+        rename(fullName.c_str(), newName.c_str()); // no error handling... if we couldn't make a backup, just ignore
+    }
+
+    _logfile = fopen(fullName.c_str(), (mode + "b").c_str());
+    if (!_logfile)
+    {
+        return;
+    }
+
+    setvbuf(_logfile, nullptr, _IOFBF, 64 * 1024);
+    fseek(_logfile, 0, SEEK_END);
+    _fileSize = ftell(_logfile);
+
+    // a new file or the appended part of an existing one starts a new type table
+    _loggerTypeIds.clear();
+
+    if (!_fileSize)
+    {
+        _record.clear();
+        Append<uint32>(Magic);
+        Append<uint16>(Version);
+        fwrite(_record.data(), 1, _record.size(), _logfile);
+        _fileSize += _record.size();
+    }
+}
+
+void AppenderBinary::CloseFile()
+{
+    if (_logfile)
+    {
+        fclose(_logfile);
+        _logfile = nullptr;
+    }
+}
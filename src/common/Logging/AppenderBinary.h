@@ -0,0 +1,57 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef APPENDER_BINARY_H
+#define APPENDER_BINARY_H
+
+#include "Appender.h"
+#include <unordered_map>
+#include <vector>
+
+// Compact record stream for high volume loggers, rendered to text or JSONL by the log_decoder tool
+class AppenderBinary : public Appender
+{
+public:
+    static constexpr AppenderType type = APPENDER_BINARY;
+
+    AppenderBinary(uint8 id, std::string const& name, LogLevel level, AppenderFlags flags, std::vector<std::string_view> const& args);
+    ~AppenderBinary();
+    AppenderType getType() const override { return type; }
+
+private:
+    void OpenFile(std::string const& mode, bool backup);
+    void CloseFile();
+    void _write(LogMessage const* message) override;
+
+    uint16 GetLoggerTypeId(std::string const& loggerType);
+
+    template<class T>
+    void Append(T value);
+    template<class Length>
+    void AppendString(std::string const& str);
+
+    FILE* _logfile;
+    std::string _fileName;
+    bool _backup;
+    uint64 _maxFileSize;
+    uint64 _fileSize;
+
+    std::unordered_map<std::string, uint16> _loggerTypeIds;
+    std::vector<uint8> _record;
+};
+
+#endif
@@ -0,0 +1,49 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BINARY_LOG_FORMAT_H
+#define BINARY_LOG_FORMAT_H
+
+#include "Define.h"
+
+/*
+ * Record stream written by AppenderBinary and read by the log_decoder tool.
+ *
+ * All integers are little endian. A file starts with the magic and the
+ * version, followed by records each starting with their BinaryLogRecord
+ * kind:
+ *   BINARY_LOG_RECORD_LOGGER_TYPE: uint16 id, uint16 length, type name
+ *   BINARY_LOG_RECORD_MESSAGE:     uint16 type id, uint8 level, uint64 time, uint32 length, text
+ *
+ * Logger types are written once per file and referenced by id afterwards.
+ * Appending to a file starts a new id table, a type record always replaces
+ * the previous definition of its id.
+ */
+namespace Acore::BinaryLog
+{
+    constexpr uint32 Magic = 0x4C424341; // "ACBL"
+    constexpr uint16 Version = 1;
+    constexpr std::size_t FileHeaderSize = sizeof(Magic) + sizeof(Version);
+
+    enum BinaryLogRecord : uint8
+    {
+        BINARY_LOG_RECORD_LOGGER_TYPE = 1,
+        BINARY_LOG_RECORD_MESSAGE     = 2
+    };
+}
+
+#endif
@@ -16,13 +16,13 @@
  */
 
 #include "Log.h"
+#include "AppenderBinary.h"
 #include "AppenderConsole.h"
 #include "AppenderFile.h"
 #include "Config.h"
 #include "Errors.h"
 #include "IoContext.h"
 #include "LogMessage.h"
-#include "LogOperation.h"
 #include "Logger.h"
 #include "Strand.h"
 #include "StringConvert.h"
@@ -31,11 +31,31 @@
 #include <chrono>
 #include <memory>
 
-Log::Log() : AppenderId(0), highestLogLevel(LOG_LEVEL_FATAL)
+namespace
+{
+    struct StringViewHash
+    {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view str) const { return std::hash<std::string_view>()(str); }
+    };
+
+    // loggers resolved from message types by this thread, "entities.unit" to "entities" for example
+    struct ResolvedLoggerCache
+    {
+        uint32 Generation = 0;
+        std::unordered_map<std::string, Logger const*, StringViewHash, std::equal_to<>> Loggers;
+    };
+
+    thread_local ResolvedLoggerCache t_resolvedLoggers;
+}
+
+Log::Log() : AppenderId(0), highestLogLevel(LOG_LEVEL_FATAL), _ioContext(nullptr), _loggersGeneration(1),
+    _maxQueuedMessages(0), _queuedMessages(0), _droppedMessages(0), _droppedMessagesTotal(0)
 {
     m_logsTimestamp = "_" + GetTimestampStr();
     RegisterAppender<AppenderConsole>();
     RegisterAppender<AppenderFile>();
+    RegisterAppender<AppenderBinary>();
 }
 
 Log::~Log()
@@ -231,7 +251,7 @@ void Log::RegisterAppender(uint8 index, AppenderCreatorFn appenderCreateFn)
     appenderFactory[index] = appenderCreateFn;
 }
 
-void Log::_outMessage(std::string const& filter, LogLevel level, std::string_view message)
+void Log::_outMessage(std::string_view filter, LogLevel level, std::string_view message)
 {
     write(std::make_unique<LogMessage>(level, filter, message));
 }
@@ -247,16 +267,56 @@ void Log::write(std::unique_ptr<LogMessage>&& msg) const
 
     if (_ioContext)
     {
-        std::shared_ptr<LogOperation> logOperation = std::make_shared<LogOperation>(logger, std::move(msg));
-        Acore::Asio::post(*_ioContext, Acore::Asio::bind_executor(*_strand, [logOperation]() { logOperation->call(); }));
+        // drop the message rather than let the queue grow without bound when the strand can't keep up
+        if (_maxQueuedMessages && _queuedMessages.load(std::memory_order_relaxed) >= _maxQueuedMessages)
+        {
+            _droppedMessages.fetch_add(1, std::memory_order_relaxed);
+            _droppedMessagesTotal.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        std::unique_ptr<LogMessage> droppedNotice;
+        if (uint32 dropped = _droppedMessages.exchange(0, std::memory_order_relaxed))
+            droppedNotice = std::make_unique<LogMessage>(LOG_LEVEL_WARN, msg->type, Acore::StringFormat("{} log messages were dropped, the async log queue was full", dropped));
+
+        _queuedMessages.fetch_add(1, std::memory_order_relaxed);
+        Acore::Asio::post(*_ioContext, Acore::Asio::bind_executor(*_strand, [this, logger, droppedNotice = std::move(droppedNotice), msg = std::move(msg)]()
+        {
+            if (logger)
+            {
+                if (droppedNotice)
+                    logger->write(droppedNotice.get());
+
+                logger->write(msg.get());
+            }
+
+            _queuedMessages.fetch_sub(1, std::memory_order_relaxed);
+        }));
     }
     else
         logger->write(msg.get());
 }
 
-Logger const* Log::GetLoggerByType(std::string const& type) const
+Logger const* Log::GetLoggerByType(std::string_view type) const
 {
-    auto it = loggers.find(type);
+    ResolvedLoggerCache& cache = t_resolvedLoggers;
+    uint32 const generation = _loggersGeneration.load(std::memory_order_acquire);
+    if (cache.Generation != generation)
+    {
+        cache.Loggers.clear();
+        cache.Generation = generation;
+    }
+
+    auto it = cache.Loggers.find(type);
+    if (it == cache.Loggers.end())
+        it = cache.Loggers.emplace(std::string(type), ResolveLoggerByType(type)).first;
+
+    return it->second;
+}
+
+Logger const* Log::ResolveLoggerByType(std::string_view type) const
+{
+    auto it = loggers.find(std::string(type));
     if (it != loggers.end())
     {
         return it->second.get();
@@ -267,14 +327,14 @@ Logger const* Log::GetLoggerByType(std::string const& type) const
         return nullptr;
     }
 
-    std::string parentLogger = LOGGER_ROOT;
+    std::string_view parentLogger = LOGGER_ROOT;
     std::size_t found = type.find_last_of('.');
-    if (found != std::string::npos)
+    if (found != std::string_view::npos)
     {
         parentLogger = type.substr(0, found);
     }
 
-    return GetLoggerByType(parentLogger);
+    return ResolveLoggerByType(parentLogger);
 }
 
 std::string Log::GetTimestampStr()
@@ -305,6 +365,7 @@ bool Log::SetLogLevel(std::string const& name, int32 newLeveli, bool isLogger /*
         }
 
         it->second->setLogLevel(newLevel);
+        InvalidateLoggerCaches();
 
         if (newLevel != LOG_LEVEL_DISABLED && newLevel > highestLogLevel)
         {
@@ -337,14 +398,11 @@ void Log::Close()
 {
     loggers.clear();
     appenders.clear();
+    InvalidateLoggerCaches();
 }
 
-bool Log::ShouldLog(std::string const& type, LogLevel level) const
+bool Log::ShouldLog(std::string_view type, LogLevel level) const
 {
-    /// @todo: Use cache to store "Type.sub1.sub2": "Type" equivalence, should
-    // Speed up in cases where requesting "Type.sub1.sub2" but only configured
-    // Logger "Type"
-
     // Don't even look for a logger if the LogLevel is higher than the highest log levels across all loggers
     if (level > highestLogLevel)
     {
@@ -361,6 +419,24 @@ bool Log::ShouldLog(std::string const& type, LogLevel level) const
     return logLevel != LOG_LEVEL_DISABLED && logLevel >= level;
 }
 
+uint32 Log::ResolveCallSite(LogCallSite& site, std::string_view type) const
+{
+    uint32 generation = _loggersGeneration.load(std::memory_order_acquire) & 0xFFFFFF;
+    Logger const* logger = GetLoggerByType(type);
+    uint32 state = (generation << 8) | (logger ? logger->getLogLevel() : LOG_LEVEL_DISABLED);
+    site.State.store(state, std::memory_order_relaxed);
+    return state;
+}
+
+void Log::InvalidateLoggerCaches()
+{
+    // call sites start at generation 0, never hand it out again after a wrap around
+    if (!((_loggersGeneration.fetch_add(1, std::memory_order_release) + 1) & 0xFFFFFF))
+    {
+        _loggersGeneration.fetch_add(1, std::memory_order_release);
+    }
+}
+
 Log* Log::instance()
 {
     static Log instance;
@@ -391,6 +467,7 @@ void Log::LoadFromConfig()
     highestLogLevel = LOG_LEVEL_FATAL;
     AppenderId = 0;
     m_logsDir = sConfigMgr->GetOption<std::string>("LogsDir", "", false);
+    _maxQueuedMessages = sConfigMgr->GetOption<uint32>("Log.Async.MaxQueuedMessages", 0, false);
 
     if (!m_logsDir.empty())
         if ((m_logsDir.at(m_logsDir.length() - 1) != '/') && (m_logsDir.at(m_logsDir.length() - 1) != '\\'))
@@ -400,4 +477,7 @@ void Log::LoadFromConfig()
 
     ReadAppendersFromConfig();
     ReadLoggersFromConfig();
+
+    // types resolved while the loggers were being read must be resolved again
+    InvalidateLoggerCaches();
 }
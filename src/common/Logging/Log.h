@@ -22,6 +22,7 @@
 #include "Define.h"
 #include "LogCommon.h"
 #include "StringFormat.h"
+#include <atomic>
 #include <unordered_map>
 #include <vector>
 #include <memory>
@@ -38,6 +39,11 @@ namespace Acore::Asio
 
 #define LOGGER_ROOT "root"
 
+// Highest level of the LOG_* messages compiled in, set by the LOG_COMPILE_LEVEL build option
+#ifndef ACORE_LOG_COMPILE_LEVEL
+#define ACORE_LOG_COMPILE_LEVEL 6
+#endif
+
 typedef Appender*(*AppenderCreatorFn)(uint8 id, std::string const& name, LogLevel level, AppenderFlags flags, std::vector<std::string_view> const& extraArgs);
 
 template <class AppenderImpl>
@@ -46,6 +52,13 @@ Appender* CreateAppender(uint8 id, std::string const& name, LogLevel level, Appe
     return new AppenderImpl(id, name, level, flags, extraArgs);
 }
 
+// Level of the logger resolved for the literal filter of a LOG_* call site,
+// tagged with the loggers generation it was resolved in
+struct LogCallSite
+{
+    std::atomic<uint32> State{ 0 };
+};
+
 class Log
 {
 typedef std::unordered_map<std::string, Logger> LoggerMap;
@@ -65,13 +78,30 @@ public:
     void SetSynchronous();  // Not threadsafe - should only be called from main() after all threads are joined
     void LoadFromConfig();
     void Close();
-    [[nodiscard]] bool ShouldLog(std::string const& type, LogLevel level) const;
+    [[nodiscard]] bool ShouldLog(std::string_view type, LogLevel level) const;
+
+    template<std::size_t N>
+    [[nodiscard]] bool ShouldLog(LogCallSite& site, char const (&type)[N], LogLevel level) const
+    {
+        uint32 state = site.State.load(std::memory_order_relaxed);
+        if ((state >> 8) != (_loggersGeneration.load(std::memory_order_relaxed) & 0xFFFFFF))
+        {
+            state = ResolveCallSite(site, std::string_view(type, N - 1));
+        }
+
+        LogLevel logLevel = LogLevel(state & 0xFF);
+        return logLevel != LOG_LEVEL_DISABLED && logLevel >= level;
+    }
+
+    // filters built at runtime can change between two calls of the same site
+    [[nodiscard]] bool ShouldLog(LogCallSite& /*site*/, std::string_view type, LogLevel level) const { return ShouldLog(type, level); }
     bool SetLogLevel(std::string const& name, int32 level, bool isLogger = true);
 
     template<typename... Args>
-    inline void outMessage(std::string const& filter, LogLevel const level, Acore::FormatString<Args...> fmt, Args&&... args)
+    inline void outMessage(std::string_view filter, LogLevel const level, Acore::FormatString<Args...> fmt, Args&&... args)
     {
-        _outMessage(filter, level, Acore::StringFormat(fmt, std::forward<Args>(args)...));
+        Acore::FormatBuffer buffer;
+        _outMessage(filter, level, buffer.Format(fmt, std::forward<Args>(args)...));
     }
 
     template<typename... Args>
@@ -82,7 +112,8 @@ public:
             return;
         }
 
-        _outCommand(Acore::StringFormat(fmt, std::forward<Args>(args)...), std::to_string(account));
+        Acore::FormatBuffer buffer;
+        _outCommand(buffer.Format(fmt, std::forward<Args>(args)...), std::to_string(account));
     }
 
     void SetRealmId(uint32 id);
@@ -96,11 +127,17 @@ public:
     [[nodiscard]] std::string const& GetLogsDir() const { return m_logsDir; }
     [[nodiscard]] std::string const& GetLogsTimestamp() const { return m_logsTimestamp; }
 
+    // messages dropped because the async queue was full, since the start
+    [[nodiscard]] uint64 GetDroppedMessageCount() const { return _droppedMessagesTotal.load(std::memory_order_relaxed); }
+
 private:
     static std::string GetTimestampStr();
     void write(std::unique_ptr<LogMessage>&& msg) const;
 
-    [[nodiscard]] Logger const* GetLoggerByType(std::string const& type) const;
+    [[nodiscard]] Logger const* GetLoggerByType(std::string_view type) const;
+    [[nodiscard]] Logger const* ResolveLoggerByType(std::string_view type) const;
+    uint32 ResolveCallSite(LogCallSite& site, std::string_view type) const;
+    void InvalidateLoggerCaches();
     Appender* GetAppenderByName(std::string_view name);
     uint8 NextAppenderId();
     void CreateAppenderFromConfig(std::string const& name);
@@ -108,7 +145,7 @@ private:
     void ReadAppendersFromConfig();
     void ReadLoggersFromConfig();
     void RegisterAppender(uint8 index, AppenderCreatorFn appenderCreateFn);
-    void _outMessage(std::string const& filter, LogLevel level, std::string_view message);
+    void _outMessage(std::string_view filter, LogLevel level, std::string_view message);
     void _outCommand(std::string_view message, std::string_view param1);
 
     std::unordered_map<uint8, AppenderCreatorFn> appenderFactory;
@@ -122,6 +159,14 @@ private:
 
     Acore::Asio::IoContext* _ioContext;
     std::unique_ptr<Acore::Asio::Strand> _strand;
+
+    // bumped when the loggers or their levels change, invalidates the per thread and call site caches
+    std::atomic<uint32> _loggersGeneration;
+
+    uint32 _maxQueuedMessages;
+    mutable std::atomic<uint32> _queuedMessages;
+    mutable std::atomic<uint32> _droppedMessages;
+    mutable std::atomic<uint64> _droppedMessagesTotal;
 };
 
 #define sLog Log::instance()
@@ -145,7 +190,9 @@ private:
 #define LOG_MESSAGE_BODY(filterType__, level__, ...)                        \
         do                                                              \
         {                                                               \
-            if (sLog->ShouldLog(filterType__, level__))                 \
+            static LogCallSite logCallSite__;                           \
+            if (level__ <= ACORE_LOG_COMPILE_LEVEL &&                   \
+                sLog->ShouldLog(logCallSite__, filterType__, level__))  \
                 LOG_EXCEPTION_FREE(filterType__, level__, __VA_ARGS__); \
         } while (0)
 #endif
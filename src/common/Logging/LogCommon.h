@@ -43,6 +43,7 @@ enum AppenderType : uint8
     APPENDER_FILE,
     APPENDER_DB,
     APPENDER_JSONL,
+    APPENDER_BINARY,
 
     APPENDER_INVALID = 0xFF // SKIP
 };
@@ -18,11 +18,11 @@
 #include "LogMessage.h"
 #include "Timer.h"
 
-LogMessage::LogMessage(LogLevel _level, std::string const& _type, std::string_view _text)
-    : level(_level), type(_type), text(std::string(_text)), mtime(GetEpochTime()) { }
+LogMessage::LogMessage(LogLevel _level, std::string_view _type, std::string_view _text)
+    : level(_level), type(std::string(_type)), text(std::string(_text)), mtime(GetEpochTime()) { }
 
-LogMessage::LogMessage(LogLevel _level, std::string const& _type, std::string_view _text, std::string_view _param1)
-    : level(_level), type(_type), text(std::string(_text)), param1(std::string(_param1)), mtime(GetEpochTime()) { }
+LogMessage::LogMessage(LogLevel _level, std::string_view _type, std::string_view _text, std::string_view _param1)
+    : level(_level), type(std::string(_type)), text(std::string(_text)), param1(std::string(_param1)), mtime(GetEpochTime()) { }
 
 std::string LogMessage::getTimeStr(Seconds time)
 {
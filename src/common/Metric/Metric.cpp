@@ -18,6 +18,7 @@
 #include "Metric.h"
 #include "Config.h"
 #include "Log.h"
+#include "MetricRegistry.h"
 #include "SteadyTimer.h"
 #include "Strand.h"
 #include "Tokenize.h"
@@ -46,6 +47,10 @@ void Metric::Initialize(std::string const& realmName, Acore::Asio::IoContext& io
     _overallStatusTimer = std::make_unique<boost::asio::steady_timer>(ioContext);
     _overallStatusLogger = overallStatusLogger;
     LoadFromConfigs();
+
+    // the registry is scraped independently of the InfluxDB pushes
+    if (uint16 port = sConfigMgr->GetOption<uint16>("Metric.Prometheus.Port", 0))
+        sMetricRegistry->StartEndpoint(ioContext, sConfigMgr->GetOption<std::string>("Metric.Prometheus.BindIP", "127.0.0.1"), port);
 }
 
 bool Metric::Connect()
@@ -186,42 +191,40 @@ void Metric::SendBatch()
 {
     using namespace std::chrono;
 
-    std::stringstream batchedData;
+    Acore::FormatBuffer batchedData;
     MetricData* data;
     bool firstLoop = true;
 
     while (_queuedData.Dequeue(data))
     {
         if (!firstLoop)
-            batchedData << "\n";
+            batchedData.Append("\n");
 
-        batchedData << data->Category;
+        batchedData.Append(data->Category);
         if (!_realmName.empty())
-            batchedData << ",realm=" << _realmName;
+            batchedData.Append(",realm={}", _realmName);
 
         for (MetricTag const& tag : data->Tags)
-            batchedData << "," << tag.first << "=" << FormatInfluxDBTagValue(tag.second);
-
-        batchedData << " ";
+            batchedData.Append(",{}={}", tag.first, FormatInfluxDBTagValue(tag.second));
 
         switch (data->Type)
         {
             case METRIC_DATA_VALUE:
-                batchedData << "value=" << data->Value;
+                batchedData.Append(" value={}", data->Value);
                 break;
             case METRIC_DATA_EVENT:
-                batchedData << "title=\"" << data->Title << "\",text=\"" << data->Text << "\"";
+                batchedData.Append(" title=\"{}\",text=\"{}\"", data->Title, data->Text);
                 break;
         }
 
-        batchedData << " " << std::to_string(duration_cast<nanoseconds>(data->Timestamp.time_since_epoch()).count());
+        batchedData.Append(" {}", duration_cast<nanoseconds>(data->Timestamp.time_since_epoch()).count());
 
         firstLoop = false;
         delete data;
     }
 
     // Check if there's any data to send
-    if (batchedData.tellp() == std::streampos(0))
+    if (batchedData.View().empty())
     {
         ScheduleSend();
         return;
@@ -246,8 +249,8 @@ void Metric::SendBatch()
     GetDataStream() << "Content-Type: application/octet-stream\r\n";
     GetDataStream() << "Content-Transfer-Encoding: binary\r\n";
 
-    GetDataStream() << "Content-Length: " << std::to_string(batchedData.tellp()) << "\r\n\r\n";
-    GetDataStream() << batchedData.rdbuf();
+    GetDataStream() << "Content-Length: " << batchedData.View().size() << "\r\n\r\n";
+    GetDataStream().write(batchedData.View().data(), batchedData.View().size());
 
     std::string http_version;
     GetDataStream() >> http_version;
@@ -308,6 +311,7 @@ void Metric::Unload()
 
     _batchTimer->cancel();
     _overallStatusTimer->cancel();
+    sMetricRegistry->StopEndpoint();
 }
 
 void Metric::ScheduleOverallStatusLog()
@@ -0,0 +1,312 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "MetricRegistry.h"
+#include "Errors.h"
+#include "IoContext.h"
+#include "Log.h"
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/streambuf.hpp>
+#include <boost/asio/write.hpp>
+#include <algorithm>
+#include <istream>
+#include <sstream>
+
+using boost::asio::ip::tcp;
+
+namespace
+{
+    // answers a single request, then closes the connection
+    class PrometheusConnection : public std::enable_shared_from_this<PrometheusConnection>
+    {
+    public:
+        explicit PrometheusConnection(tcp::socket&& socket) : _socket(std::move(socket)), _request(8192) { }
+
+        void Start()
+        {
+            boost::asio::async_read_until(_socket, _request, "\r\n\r\n",
+                [self = shared_from_this()](boost::system::error_code const& error, std::size_t /*size*/)
+            {
+                if (!error)
+                    self->Respond();
+            });
+        }
+
+    private:
+        void Respond()
+        {
+            std::istream request(&_request);
+            std::string method, path;
+            request >> method >> path;
+
+            std::string body;
+            char const* status = "404 Not Found";
+            if (method == "GET" && (path == "/metrics" || path == "/"))
+            {
+                body = sMetricRegistry->Render();
+                status = "200 OK";
+            }
+
+            _response = Acore::StringFormat("HTTP/1.1 {}\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: {}\r\nConnection: close\r\n\r\n{}",
+                status, body.size(), body);
+
+            boost::asio::async_write(_socket, boost::asio::buffer(_response),
+                [self = shared_from_this()](boost::system::error_code const& /*error*/, std::size_t /*size*/)
+            {
+                boost::system::error_code ignored;
+                self->_socket.shutdown(tcp::socket::shutdown_both, ignored);
+            });
+        }
+
+        tcp::socket _socket;
+        boost::asio::streambuf _request;
+        std::string _response;
+    };
+
+    std::string EscapeLabelValue(std::string const& value)
+    {
+        std::string escaped;
+        escaped.reserve(value.size());
+        for (char c : value)
+        {
+            if (c == '\\' || c == '"')
+                escaped += '\\';
+
+            if (c == '\n')
+                escaped += "\\n";
+            else
+                escaped += c;
+        }
+
+        return escaped;
+    }
+}
+
+class PrometheusEndpoint : public std::enable_shared_from_this<PrometheusEndpoint>
+{
+public:
+    explicit PrometheusEndpoint(Acore::Asio::IoContext& ioContext) : _acceptor(static_cast<boost::asio::io_context&>(ioContext)) { }
+
+    bool Open(std::string const& bindIp, uint16 port)
+    {
+        boost::system::error_code error;
+        tcp::endpoint endpoint(boost::asio::ip::make_address(bindIp, error), port);
+        if (error)
+        {
+            LOG_ERROR("metric", "Metric.Prometheus.BindIP '{}' is not a valid address: {}", bindIp, error.message());
+            return false;
+        }
+
+        _acceptor.open(endpoint.protocol(), error);
+        if (!error)
+            _acceptor.set_option(tcp::acceptor::reuse_address(true), error);
+        if (!error)
+            _acceptor.bind(endpoint, error);
+        if (!error)
+            _acceptor.listen(boost::asio::socket_base::max_listen_connections, error);
+
+        if (error)
+        {
+            LOG_ERROR("metric", "Could not listen for Prometheus scrapes on {}:{}: {}", bindIp, port, error.message());
+            return false;
+        }
+
+        return true;
+    }
+
+    void AsyncAccept()
+    {
+        _acceptor.async_accept([self = shared_from_this()](boost::system::error_code const& error, tcp::socket socket)
+        {
+            if (error == boost::asio::error::operation_aborted)
+                return;
+
+            if (!error)
+                std::make_shared<PrometheusConnection>(std::move(socket))->Start();
+
+            self->AsyncAccept();
+        });
+    }
+
+    void Close()
+    {
+        boost::system::error_code ignored;
+        _acceptor.close(ignored);
+    }
+
+private:
+    tcp::acceptor _acceptor;
+};
+
+MetricHistogram::MetricHistogram(std::vector<uint64> bounds) : _bounds(std::move(bounds)), _buckets(new std::atomic<uint64>[_bounds.size() + 1])
+{
+    for (std::size_t i = 0; i <= _bounds.size(); ++i)
+        _buckets[i].store(0, std::memory_order_relaxed);
+}
+
+void MetricHistogram::Observe(uint64 value)
+{
+    std::size_t bucket = std::lower_bound(_bounds.begin(), _bounds.end(), value) - _bounds.begin();
+    _buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    _sum.fetch_add(value, std::memory_order_relaxed);
+}
+
+MetricRegistry::MetricRegistry() = default;
+
+MetricRegistry::~MetricRegistry() = default;
+
+MetricRegistry* MetricRegistry::instance()
+{
+    static MetricRegistry instance;
+    return &instance;
+}
+
+MetricRegistry::Series& MetricRegistry::GetSeries(std::string const& name, std::string const& help, MetricKind kind, std::string const& labels)
+{
+    auto family = std::find_if(_families.begin(), _families.end(), [&](Family const& f) { return f.Name == name; });
+    if (family == _families.end())
+    {
+        _families.push_back({ name, help, kind, { } });
+        family = std::prev(_families.end());
+    }
+
+    ASSERT(family->Kind == kind, "Metric {} registered with two kinds", name);
+
+    auto series = std::find_if(family->Entries.begin(), family->Entries.end(), [&](Series const& s) { return s.Labels == labels; });
+    if (series != family->Entries.end())
+        return *series;
+
+    return family->Entries.emplace_back(Series{ labels, nullptr, nullptr, nullptr });
+}
+
+MetricCounter& MetricRegistry::GetCounter(std::string const& name, std::string const& help, std::vector<MetricTag> const& tags)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    Series& series = GetSeries(name, help, METRIC_KIND_COUNTER, RenderLabels(tags));
+    if (!series.Counter)
+        series.Counter = &_counters.emplace_back();
+
+    return *series.Counter;
+}
+
+MetricGauge& MetricRegistry::GetGauge(std::string const& name, std::string const& help, std::vector<MetricTag> const& tags)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    Series& series = GetSeries(name, help, METRIC_KIND_GAUGE, RenderLabels(tags));
+    if (!series.Gauge)
+        series.Gauge = &_gauges.emplace_back();
+
+    return *series.Gauge;
+}
+
+MetricHistogram& MetricRegistry::GetHistogram(std::string const& name, std::string const& help, std::vector<uint64> bounds, std::vector<MetricTag> const& tags)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    Series& series = GetSeries(name, help, METRIC_KIND_HISTOGRAM, RenderLabels(tags));
+    if (!series.Histogram)
+        series.Histogram = &_histograms.emplace_back(std::move(bounds));
+
+    return *series.Histogram;
+}
+
+std::string MetricRegistry::RenderLabels(std::vector<MetricTag> const& tags)
+{
+    std::string labels;
+    for (MetricTag const& tag : tags)
+    {
+        if (!labels.empty())
+            labels += ',';
+
+        labels += tag.first;
+        labels += "=\"";
+        labels += EscapeLabelValue(tag.second);
+        labels += '"';
+    }
+
+    return labels;
+}
+
+std::string MetricRegistry::Render() const
+{
+    std::ostringstream out;
+
+    std::lock_guard<std::mutex> guard(_lock);
+    for (Family const& family : _families)
+    {
+        char const* type = family.Kind == METRIC_KIND_COUNTER ? "counter" : (family.Kind == METRIC_KIND_GAUGE ? "gauge" : "histogram");
+        out << "# HELP " << family.Name << ' ' << family.Help << '\n';
+        out << "# TYPE " << family.Name << ' ' << type << '\n';
+
+        for (Series const& series : family.Entries)
+        {
+            std::string const labels = series.Labels.empty() ? std::string() : '{' + series.Labels + '}';
+            switch (family.Kind)
+            {
+                case METRIC_KIND_COUNTER:
+                    out << family.Name << labels << ' ' << series.Counter->Get() << '\n';
+                    break;
+                case METRIC_KIND_GAUGE:
+                    out << family.Name << labels << ' ' << series.Gauge->Get() << '\n';
+                    break;
+                case METRIC_KIND_HISTOGRAM:
+                {
+                    // buckets are cumulative in the exposition format
+                    std::string const prefix = series.Labels.empty() ? std::string() : series.Labels + ',';
+                    MetricHistogram const& histogram = *series.Histogram;
+                    uint64 count = 0;
+                    for (std::size_t i = 0; i < histogram.GetBounds().size(); ++i)
+                    {
+                        count += histogram.GetBucketCount(i);
+                        out << family.Name << "_bucket{" << prefix << "le=\"" << histogram.GetBounds()[i] << "\"} " << count << '\n';
+                    }
+
+                    count += histogram.GetBucketCount(histogram.GetBounds().size());
+                    out << family.Name << "_bucket{" << prefix << "le=\"+Inf\"} " << count << '\n';
+                    out << family.Name << "_sum" << labels << ' ' << histogram.GetSum() << '\n';
+                    out << family.Name << "_count" << labels << ' ' << count << '\n';
+                    break;
+                }
+            }
+        }
+    }
+
+    return out.str();
+}
+
+void MetricRegistry::StartEndpoint(Acore::Asio::IoContext& ioContext, std::string const& bindIp, uint16 port)
+{
+    StopEndpoint();
+
+    std::shared_ptr<PrometheusEndpoint> endpoint = std::make_shared<PrometheusEndpoint>(ioContext);
+    if (!endpoint->Open(bindIp, port))
+        return;
+
+    endpoint->AsyncAccept();
+    _endpoint = std::move(endpoint);
+    LOG_INFO("metric", "Serving Prometheus metrics on http://{}:{}/metrics", bindIp, port);
+}
+
+void MetricRegistry::StopEndpoint()
+{
+    if (_endpoint)
+    {
+        _endpoint->Close();
+        _endpoint.reset();
+    }
+}
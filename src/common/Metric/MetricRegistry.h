@@ -0,0 +1,148 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef METRIC_REGISTRY_H__
+#define METRIC_REGISTRY_H__
+
+#include "Define.h"
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Acore::Asio
+{
+    class IoContext;
+}
+
+class PrometheusEndpoint;
+
+typedef std::pair<std::string, std::string> MetricTag;
+
+// Monotonic count, Add() is a relaxed atomic increment
+class AC_COMMON_API MetricCounter
+{
+public:
+    void Add(uint64 value = 1) { _value.fetch_add(value, std::memory_order_relaxed); }
+    [[nodiscard]] uint64 Get() const { return _value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64> _value{ 0 };
+};
+
+class AC_COMMON_API MetricGauge
+{
+public:
+    void Set(int64 value) { _value.store(value, std::memory_order_relaxed); }
+    void Add(int64 value) { _value.fetch_add(value, std::memory_order_relaxed); }
+    [[nodiscard]] int64 Get() const { return _value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64> _value{ 0 };
+};
+
+// Count of the observed values per bucket, bounds are inclusive upper bounds in increasing order
+class AC_COMMON_API MetricHistogram
+{
+public:
+    explicit MetricHistogram(std::vector<uint64> bounds);
+
+    void Observe(uint64 value);
+
+    [[nodiscard]] std::vector<uint64> const& GetBounds() const { return _bounds; }
+    // count of the bucket, the last bucket holding the values above every bound
+    [[nodiscard]] uint64 GetBucketCount(std::size_t bucket) const { return _buckets[bucket].load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64 GetSum() const { return _sum.load(std::memory_order_relaxed); }
+
+private:
+    std::vector<uint64> _bounds;
+    std::unique_ptr<std::atomic<uint64>[]> _buckets;
+    std::atomic<uint64> _sum{ 0 };
+};
+
+/*
+ * In process counters, gauges and histograms served in the Prometheus text
+ * format by an HTTP endpoint.
+ *
+ * A metric is registered once with its tags, usually into a function local
+ * static reference, and updated afterwards with relaxed atomics: no string
+ * is built and nothing is allocated per sample. Registered metrics live as
+ * long as the process.
+ */
+class AC_COMMON_API MetricRegistry
+{
+    MetricRegistry();
+    ~MetricRegistry();
+
+public:
+    static MetricRegistry* instance();
+
+    MetricCounter& GetCounter(std::string const& name, std::string const& help, std::vector<MetricTag> const& tags = {});
+    MetricGauge& GetGauge(std::string const& name, std::string const& help, std::vector<MetricTag> const& tags = {});
+    MetricHistogram& GetHistogram(std::string const& name, std::string const& help, std::vector<uint64> bounds, std::vector<MetricTag> const& tags = {});
+
+    // every registered metric in the Prometheus text exposition format
+    [[nodiscard]] std::string Render() const;
+
+    // serves Render() on http://bindIp:port/metrics, from the threads running ioContext
+    void StartEndpoint(Acore::Asio::IoContext& ioContext, std::string const& bindIp, uint16 port);
+    void StopEndpoint();
+
+private:
+    enum MetricKind : uint8
+    {
+        METRIC_KIND_COUNTER,
+        METRIC_KIND_GAUGE,
+        METRIC_KIND_HISTOGRAM
+    };
+
+    struct Series
+    {
+        std::string Labels; // rendered once at registration, like map_id="571",phase="players"
+        MetricCounter* Counter;
+        MetricGauge* Gauge;
+        MetricHistogram* Histogram;
+    };
+
+    struct Family
+    {
+        std::string Name;
+        std::string Help;
+        MetricKind Kind;
+        std::vector<Series> Entries;
+    };
+
+    // the series of name with labels, added empty to its family when not registered yet
+    Series& GetSeries(std::string const& name, std::string const& help, MetricKind kind, std::string const& labels);
+    static std::string RenderLabels(std::vector<MetricTag> const& tags);
+
+    mutable std::mutex _lock; // registrations and renders only
+    std::deque<Family> _families;
+    std::deque<MetricCounter> _counters;
+    std::deque<MetricGauge> _gauges;
+    std::deque<MetricHistogram> _histograms;
+
+    std::shared_ptr<PrometheusEndpoint> _endpoint;
+};
+
+#define sMetricRegistry MetricRegistry::instance()
+
+#endif // METRIC_REGISTRY_H__
@@ -0,0 +1,198 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "Profiler.h"
+#include "Log.h"
+#include <fstream>
+#include <iomanip>
+
+struct ProfilerRecord
+{
+    char const* Name;
+    int64 Arg;
+    TimePoint Start;
+    TimePoint End;
+};
+
+struct ProfilerThreadBuffer
+{
+    std::mutex Lock;
+    std::vector<ProfilerRecord> Records;
+    std::size_t Next = 0; // index of the next record to overwrite once Records is full
+    uint64 Overwritten = 0;
+    uint32 ThreadId = 0;
+};
+
+namespace
+{
+    void WriteJsonString(std::ofstream& out, char const* str)
+    {
+        out << '"';
+        for (; *str; ++str)
+        {
+            if (*str == '"' || *str == '\\')
+                out << '\\';
+
+            if (static_cast<unsigned char>(*str) >= 0x20)
+                out << *str;
+        }
+
+        out << '"';
+    }
+}
+
+Profiler::Profiler() : _capturing(false) { }
+
+Profiler::~Profiler() = default;
+
+Profiler* Profiler::instance()
+{
+    static Profiler instance;
+    return &instance;
+}
+
+bool Profiler::Start(Milliseconds duration, std::string fileName)
+{
+    if (IsCapturing())
+        return false;
+
+    {
+        std::lock_guard<std::mutex> buffersGuard(_buffersLock);
+        for (std::shared_ptr<ProfilerThreadBuffer> const& buffer : _buffers)
+        {
+            std::lock_guard<std::mutex> guard(buffer->Lock);
+            buffer->Records.clear();
+            buffer->Next = 0;
+            buffer->Overwritten = 0;
+        }
+    }
+
+    _fileName = std::move(fileName);
+    _captureStart = std::chrono::steady_clock::now();
+    _captureEnd = _captureStart + duration;
+    _capturing.store(true, std::memory_order_release);
+    return true;
+}
+
+void Profiler::Update()
+{
+    if (!IsCapturing() || std::chrono::steady_clock::now() < _captureEnd)
+        return;
+
+    Stop();
+}
+
+bool Profiler::Stop()
+{
+    if (!_capturing.exchange(false, std::memory_order_acq_rel))
+        return false;
+
+    WriteCapture();
+    return true;
+}
+
+void Profiler::Record(char const* name, int64 arg, TimePoint start, TimePoint end)
+{
+    // zones ending after the capture are dropped, the buffers are being written
+    if (!IsCapturing())
+        return;
+
+    ProfilerThreadBuffer& buffer = GetThreadBuffer();
+    std::lock_guard<std::mutex> guard(buffer.Lock);
+    if (buffer.Records.size() < ThreadBufferSize)
+    {
+        if (buffer.Records.empty())
+            buffer.Records.reserve(ThreadBufferSize);
+
+        buffer.Records.push_back({ name, arg, start, end });
+        return;
+    }
+
+    buffer.Records[buffer.Next] = { name, arg, start, end };
+    buffer.Next = (buffer.Next + 1) % ThreadBufferSize;
+    ++buffer.Overwritten;
+}
+
+ProfilerThreadBuffer& Profiler::GetThreadBuffer()
+{
+    // shared with the profiler, the zones of exited threads stay available until written
+    thread_local std::shared_ptr<ProfilerThreadBuffer> threadBuffer;
+    if (!threadBuffer)
+    {
+        threadBuffer = std::make_shared<ProfilerThreadBuffer>();
+
+        std::lock_guard<std::mutex> guard(_buffersLock);
+        threadBuffer->ThreadId = uint32(_buffers.size() + 1);
+        _buffers.push_back(threadBuffer);
+    }
+
+    return *threadBuffer;
+}
+
+void Profiler::WriteCapture()
+{
+    std::ofstream out(_fileName, std::ios::out | std::ios::trunc);
+    if (!out)
+    {
+        LOG_ERROR("server", "Profiler: can't open {} to write the capture", _fileName);
+        return;
+    }
+
+    std::size_t zones = 0;
+    uint64 overwritten = 0;
+    bool first = true;
+
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    std::lock_guard<std::mutex> buffersGuard(_buffersLock);
+    for (std::shared_ptr<ProfilerThreadBuffer> const& buffer : _buffers)
+    {
+        std::lock_guard<std::mutex> guard(buffer->Lock);
+        overwritten += buffer->Overwritten;
+
+        for (ProfilerRecord const& record : buffer->Records)
+        {
+            if (!first)
+                out << ',';
+
+            first = false;
+            ++zones;
+
+            // trace events are timed in microseconds
+            out << "\n{\"name\":";
+            WriteJsonString(out, record.Name);
+            out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->ThreadId
+                << ",\"ts\":" << std::chrono::duration_cast<std::chrono::nanoseconds>(record.Start - _captureStart).count() / 1000.0
+                << ",\"dur\":" << std::chrono::duration_cast<std::chrono::nanoseconds>(record.End - record.Start).count() / 1000.0;
+
+            if (record.Arg >= 0)
+                out << ",\"args\":{\"id\":" << record.Arg << '}';
+
+            out << '}';
+        }
+
+        buffer->Records.clear();
+        buffer->Next = 0;
+    }
+
+    out << "\n]}\n";
+    out.close();
+
+    LOG_INFO("server", "Profiler: wrote {} zones to {}, {} older zones were overwritten", zones, _fileName, overwritten);
+}
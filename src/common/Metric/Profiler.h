@@ -0,0 +1,107 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef PROFILER_H__
+#define PROFILER_H__
+
+#include "Define.h"
+#include "Duration.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+struct ProfilerThreadBuffer;
+
+/*
+ * Scoped zone profiler, started at runtime for a number of seconds.
+ *
+ * While a capture runs, every PROFILER_ZONE records its name, start and
+ * duration into a ring buffer owned by the recording thread. Once the
+ * capture duration elapsed, the next Update() writes all the zones to a
+ * Chrome trace event file, which can be opened in chrome://tracing or
+ * Perfetto. Outside of a capture a zone costs one relaxed atomic load.
+ */
+class AC_COMMON_API Profiler
+{
+    Profiler();
+    ~Profiler();
+
+public:
+    // zones kept per thread, the oldest are overwritten once reached
+    static constexpr std::size_t ThreadBufferSize = 1 << 16;
+
+    static Profiler* instance();
+
+    // records the zones of the next duration into fileName, false when a capture already runs
+    bool Start(Milliseconds duration, std::string fileName);
+    // writes the capture once its duration elapsed
+    void Update();
+    // ends the running capture early and writes it, false when none runs
+    bool Stop();
+
+    [[nodiscard]] bool IsCapturing() const { return _capturing.load(std::memory_order_relaxed); }
+
+    // name must outlive the capture, string literals or names of objects living as long as the server
+    void Record(char const* name, int64 arg, TimePoint start, TimePoint end);
+
+private:
+    ProfilerThreadBuffer& GetThreadBuffer();
+    void WriteCapture();
+
+    std::atomic<bool> _capturing;
+    TimePoint _captureStart;
+    TimePoint _captureEnd;
+    std::string _fileName;
+
+    std::mutex _buffersLock;
+    std::vector<std::shared_ptr<ProfilerThreadBuffer>> _buffers;
+};
+
+#define sProfiler Profiler::instance()
+
+class ProfilerZone
+{
+public:
+    explicit ProfilerZone(char const* name, int64 arg = -1) :
+        _name(sProfiler->IsCapturing() ? name : nullptr), _arg(arg), _start(_name ? std::chrono::steady_clock::now() : TimePoint()) { }
+
+    ~ProfilerZone()
+    {
+        if (_name)
+            sProfiler->Record(_name, _arg, _start, std::chrono::steady_clock::now());
+    }
+
+    ProfilerZone(ProfilerZone const&) = delete;
+    ProfilerZone& operator=(ProfilerZone const&) = delete;
+
+private:
+    char const* _name;
+    int64 _arg;
+    TimePoint _start;
+};
+
+#define PROFILER_DO_CONCAT(a, b) a##b
+#define PROFILER_CONCAT(a, b) PROFILER_DO_CONCAT(a, b)
+
+// Records the enclosing scope, arg is written along the zone when not negative (map id, account id...)
+#define PROFILER_ZONE(name) ProfilerZone PROFILER_CONCAT(__ac_profiler_zone, __LINE__)(name)
+#define PROFILER_ZONE_ARG(name, arg) ProfilerZone PROFILER_CONCAT(__ac_profiler_zone, __LINE__)(name, int64(arg))
+
+#endif // PROFILER_H__
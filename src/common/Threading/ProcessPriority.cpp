@@ -17,6 +17,11 @@
 
 #include "ProcessPriority.h"
 #include "Log.h"
+#include "StringConvert.h"
+#include "StringFormat.h"
+#include "Tokenize.h"
+#include <algorithm>
+#include <fstream>
 
 #ifdef _WIN32 // Windows
 #include <Windows.h>
@@ -113,3 +118,88 @@ void SetProcessPriority(std::string const& logChannel, uint32 affinity, bool hig
     (void)highPriority;
 #endif
 }
+
+Optional<std::vector<uint32>> ParseProcessorList(std::string_view list)
+{
+    std::vector<uint32> processors;
+    for (std::string_view token : Acore::Tokenize(list, ',', false))
+    {
+        std::size_t const dash = token.find('-');
+        Optional<uint32> first = Acore::StringTo<uint32>(token.substr(0, dash));
+        Optional<uint32> last = dash == std::string_view::npos ? first : Acore::StringTo<uint32>(token.substr(dash + 1));
+        if (!first || !last || *first > *last || *last >= 1024)
+            return std::nullopt;
+
+        for (uint32 processor = *first; processor <= *last; ++processor)
+            processors.push_back(processor);
+    }
+
+    if (processors.empty())
+        return std::nullopt;
+
+    std::sort(processors.begin(), processors.end());
+    processors.erase(std::unique(processors.begin(), processors.end()), processors.end());
+    return processors;
+}
+
+bool SetCurrentThreadAffinity(std::string const& logChannel, std::string_view processors)
+{
+    if (processors.empty())
+        return true;
+
+    std::string list(processors);
+    if (processors.starts_with("node:"))
+    {
+#if defined(__linux__)
+        // the processors of a NUMA node, in the same list format
+        std::ifstream nodeList(Acore::StringFormat("/sys/devices/system/node/node{}/cpulist", processors.substr(5)));
+        if (!nodeList || !std::getline(nodeList, list))
+        {
+            LOG_ERROR(logChannel, "Can't read the processors of NUMA {}", processors);
+            return false;
+        }
+#else
+        LOG_ERROR(logChannel, "NUMA node affinity ({}) is only supported on Linux", processors);
+        return false;
+#endif
+    }
+
+    Optional<std::vector<uint32>> ids = ParseProcessorList(list);
+    if (!ids)
+    {
+        LOG_ERROR(logChannel, "Invalid processor list '{}'", list);
+        return false;
+    }
+
+#ifdef _WIN32 // Windows
+    DWORD_PTR mask = 0;
+    for (uint32 id : *ids)
+        if (id < sizeof(mask) * 8)
+            mask |= DWORD_PTR(1) << id;
+
+    if (!mask || !SetThreadAffinityMask(GetCurrentThread(), mask))
+    {
+        LOG_ERROR(logChannel, "Can't bind thread to processors {}", list);
+        return false;
+    }
+#elif defined(__linux__) // Linux
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    for (uint32 id : *ids)
+        if (id < CPU_SETSIZE)
+            CPU_SET(id, &mask);
+
+    // pid 0 is the calling thread
+    if (sched_setaffinity(0, sizeof(mask), &mask))
+    {
+        LOG_ERROR(logChannel, "Can't bind thread to processors {}, error: {}", list, strerror(errno));
+        return false;
+    }
+#else
+    LOG_ERROR(logChannel, "Thread affinity is not supported on this platform");
+    return false;
+#endif
+
+    LOG_DEBUG(logChannel, "Thread bound to processors {}", list);
+    return true;
+}
@@ -19,11 +19,24 @@
 #define _PROCESSPRIO_H
 
 #include "Define.h"
+#include "Optional.h"
 #include <string>
+#include <string_view>
+#include <vector>
 
 #define CONFIG_PROCESSOR_AFFINITY "UseProcessors"
 #define CONFIG_HIGH_PRIORITY "ProcessPriority"
 
 void AC_COMMON_API SetProcessPriority(std::string const& logChannel, uint32 affinity, bool highPriority);
 
+/*
+ * Processor sets of the thread groups (map updaters, network, database workers, world thread).
+ * A set is a list of processors and ranges ("0-7,16-23") or a NUMA node ("node:1", Linux only).
+ */
+// Returns the sorted processor ids of a list, nullopt if it is malformed
+AC_COMMON_API Optional<std::vector<uint32>> ParseProcessorList(std::string_view list);
+
+// Restricts the calling thread to the processors of the set, an empty set leaves it unchanged
+AC_COMMON_API bool SetCurrentThreadAffinity(std::string const& logChannel, std::string_view processors);
+
 #endif
@@ -0,0 +1,180 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AllocatorStats.h"
+#include <cstdio>
+#include <string>
+
+#if AC_PLATFORM != AC_PLATFORM_WINDOWS
+#include <unistd.h>
+#endif
+
+#if defined(ACORE_ALLOCATOR_JEMALLOC)
+// the bundled jemalloc is built without symbol prefix
+extern "C" int mallctl(char const* name, void* oldp, std::size_t* oldlenp, void* newp, std::size_t newlen);
+#elif defined(ACORE_ALLOCATOR_MIMALLOC)
+#include <mimalloc.h>
+#elif defined(ACORE_ALLOCATOR_TCMALLOC)
+// weak, tcmalloc is only linked into the worldserver
+extern "C" int MallocExtension_GetNumericProperty(char const* property, std::size_t* value) __attribute__((weak));
+extern "C" void MallocExtension_ReleaseFreeMemory() __attribute__((weak));
+#elif defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace
+{
+    uint64 GetProcessResident()
+    {
+#if AC_PLATFORM == AC_PLATFORM_UNIX
+        FILE* statm = std::fopen("/proc/self/statm", "r");
+        if (!statm)
+            return 0;
+
+        unsigned long long size = 0, resident = 0;
+        int const read = std::fscanf(statm, "%llu %llu", &size, &resident);
+        std::fclose(statm);
+        return read == 2 ? resident * uint64(sysconf(_SC_PAGESIZE)) : 0;
+#else
+        return 0;
+#endif
+    }
+
+#if defined(ACORE_ALLOCATOR_JEMALLOC)
+    template<class T>
+    bool ReadMallctl(std::string const& name, T& value)
+    {
+        std::size_t size = sizeof(T);
+        return mallctl(name.c_str(), &value, &size, nullptr, 0) == 0;
+    }
+#elif defined(ACORE_ALLOCATOR_TCMALLOC)
+    uint64 ReadProperty(char const* property)
+    {
+        std::size_t value = 0;
+        return MallocExtension_GetNumericProperty(property, &value) ? value : 0;
+    }
+#endif
+}
+
+char const* Acore::AllocatorStats::GetAllocatorName()
+{
+#if defined(ACORE_ALLOCATOR_JEMALLOC)
+    return "jemalloc";
+#elif defined(ACORE_ALLOCATOR_MIMALLOC)
+    return "mimalloc";
+#elif defined(ACORE_ALLOCATOR_TCMALLOC)
+    return "tcmalloc";
+#else
+    return "system";
+#endif
+}
+
+bool Acore::AllocatorStats::GetStats(Stats& stats, bool withArenas)
+{
+    stats = Stats();
+    stats.ProcessResident = GetProcessResident();
+
+#if defined(ACORE_ALLOCATOR_JEMALLOC)
+    // the statistics are a snapshot refreshed by each epoch write
+    uint64_t epoch = 1;
+    std::size_t epochSize = sizeof(epoch);
+    if (mallctl("epoch", &epoch, &epochSize, &epoch, epochSize) != 0)
+        return false;
+
+    std::size_t allocated = 0, active = 0, resident = 0, mapped = 0, retained = 0;
+    if (!ReadMallctl("stats.allocated", allocated))
+        return false; // built without statistics
+
+    ReadMallctl("stats.active", active);
+    ReadMallctl("stats.resident", resident);
+    ReadMallctl("stats.mapped", mapped);
+    ReadMallctl("stats.retained", retained);
+    stats.Allocated = allocated;
+    stats.Active = active;
+    stats.Resident = resident;
+    stats.Mapped = mapped;
+    stats.Retained = retained;
+
+    unsigned arenaCount = 0;
+    std::size_t pageSize = 0;
+    if (withArenas && ReadMallctl("arenas.narenas", arenaCount) && ReadMallctl("arenas.page", pageSize))
+    {
+        for (unsigned i = 0; i < arenaCount; ++i)
+        {
+            std::string const prefix = "stats.arenas." + std::to_string(i) + ".";
+            unsigned threads = 0;
+            std::size_t activePages = 0, dirtyPages = 0;
+            // arenas created lazily don't exist yet
+            if (!ReadMallctl(prefix + "nthreads", threads))
+                continue;
+
+            ReadMallctl(prefix + "pactive", activePages);
+            ReadMallctl(prefix + "pdirty", dirtyPages);
+            stats.Arenas.push_back({ i, threads, uint64(activePages) * pageSize, uint64(dirtyPages) * pageSize });
+        }
+    }
+
+    return true;
+#elif defined(ACORE_ALLOCATOR_MIMALLOC)
+    (void)withArenas;
+    std::size_t elapsed, user, system, resident, peakResident, committed, peakCommitted, pageFaults;
+    mi_process_info(&elapsed, &user, &system, &resident, &peakResident, &committed, &peakCommitted, &pageFaults);
+    stats.Resident = resident;
+    stats.Mapped = committed;
+    return true;
+#elif defined(ACORE_ALLOCATOR_TCMALLOC)
+    (void)withArenas;
+    if (!MallocExtension_GetNumericProperty)
+        return false;
+
+    uint64 const heap = ReadProperty("generic.heap_size");
+    uint64 const unmapped = ReadProperty("tcmalloc.pageheap_unmapped_bytes");
+    uint64 const free = ReadProperty("tcmalloc.pageheap_free_bytes");
+    stats.Allocated = ReadProperty("generic.current_allocated_bytes");
+    stats.Resident = heap - unmapped;
+    stats.Active = stats.Resident - free;
+    stats.Mapped = heap;
+    stats.Retained = unmapped;
+    return true;
+#elif defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    (void)withArenas;
+    struct mallinfo2 const info = mallinfo2();
+    stats.Allocated = info.uordblks + info.hblkhd;
+    stats.Mapped = info.arena + info.hblkhd;
+    stats.Resident = stats.Mapped;
+    stats.Active = stats.Mapped - info.fordblks;
+    return true;
+#else
+    (void)withArenas;
+    return false;
+#endif
+}
+
+void Acore::AllocatorStats::Purge()
+{
+#if defined(ACORE_ALLOCATOR_JEMALLOC)
+    // 4096 is MALLCTL_ARENAS_ALL
+    mallctl("arena.4096.purge", nullptr, nullptr, nullptr, 0);
+#elif defined(ACORE_ALLOCATOR_MIMALLOC)
+    mi_collect(true);
+#elif defined(ACORE_ALLOCATOR_TCMALLOC)
+    if (MallocExtension_ReleaseFreeMemory)
+        MallocExtension_ReleaseFreeMemory();
+#elif defined(__GLIBC__)
+    malloc_trim(0);
+#endif
+}
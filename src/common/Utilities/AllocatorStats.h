@@ -0,0 +1,66 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_ALLOCATOR_STATS_H
+#define ACORE_ALLOCATOR_STATS_H
+
+#include "Define.h"
+#include <vector>
+
+namespace Acore
+{
+    /*
+     * Statistics of the global allocator selected by the ALLOCATOR build
+     * option: the bundled jemalloc, tcmalloc, mimalloc or the system one.
+     * Values the allocator doesn't report are 0.
+     */
+    class AC_COMMON_API AllocatorStats
+    {
+    public:
+        struct Arena
+        {
+            uint32 Index;
+            uint32 Threads;  // threads bound to the arena
+            uint64 Active;   // bytes of the pages holding allocations
+            uint64 Dirty;    // bytes of unused pages not returned to the system yet
+        };
+
+        struct Stats
+        {
+            uint64 Allocated;       // bytes handed out to the program
+            uint64 Active;          // bytes of the pages holding them
+            uint64 Resident;        // bytes of the allocator resident in memory
+            uint64 Mapped;          // bytes mapped by the allocator
+            uint64 Retained;        // bytes mapped but returned to the system
+            uint64 ProcessResident; // resident set of the whole process
+            std::vector<Arena> Arenas;
+
+            // share of the allocator resident memory not holding allocations
+            [[nodiscard]] float GetFragmentation() const { return Resident && Allocated <= Resident ? float(Resident - Allocated) / float(Resident) : 0.0f; }
+        };
+
+        [[nodiscard]] static char const* GetAllocatorName();
+
+        // false when the allocator reports nothing
+        [[nodiscard]] static bool GetStats(Stats& stats, bool withArenas = false);
+
+        // returns the unused pages of every arena or thread cache to the system
+        static void Purge();
+    };
+}
+
+#endif
@@ -0,0 +1,230 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BufferPool.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <new>
+
+namespace
+{
+    using Acore::BufferPool;
+
+    static_assert(BufferPool::GetBlockSize(BufferPool::SizeClassCount - 1) == BufferPool::MaxBlockSize, "BufferPool: size classes don't end at MaxBlockSize");
+
+    struct FreeBlock
+    {
+        FreeBlock* Next;
+    };
+
+    struct FreeList
+    {
+        FreeBlock* Head;
+        std::size_t Size;
+    };
+
+    // trivially destructible, so it stays usable while the other thread_local objects are destroyed
+    struct ThreadCache
+    {
+        std::array<FreeList, BufferPool::SizeClassCount> Lists;
+        bool Released;
+    };
+
+    struct Depot
+    {
+        std::mutex Lock;
+        FreeList List = { nullptr, 0 };
+    };
+
+    struct SizeClassCounters
+    {
+        std::atomic<uint64> Allocations{ 0 };
+        std::atomic<uint64> HeapAllocations{ 0 };
+        std::atomic<std::size_t> Active{ 0 };
+        std::atomic<std::size_t> Cached{ 0 };
+    };
+
+    thread_local ThreadCache t_cache = { };
+    std::array<Depot, BufferPool::SizeClassCount> s_depots;
+    std::array<SizeClassCounters, BufferPool::SizeClassCount> s_counters;
+
+    // at most 256 KiB of each size class per thread and 4 MiB in the depot
+    constexpr std::size_t GetMaxThreadBlocks(std::size_t sizeClass)
+    {
+        return std::clamp<std::size_t>((256 * 1024) / BufferPool::GetBlockSize(sizeClass), 16, 128);
+    }
+
+    constexpr std::size_t GetMaxDepotBlocks(std::size_t sizeClass)
+    {
+        return std::min<std::size_t>((4 * 1024 * 1024) / BufferPool::GetBlockSize(sizeClass), 4096);
+    }
+
+    std::size_t GetSizeClass(std::size_t size)
+    {
+        std::size_t sizeClass = 0;
+        while (BufferPool::GetBlockSize(sizeClass) < size)
+            ++sizeClass;
+
+        return sizeClass;
+    }
+
+    // moves up to count blocks from the head of one list to another
+    void MoveBlocks(FreeList& from, FreeList& to, std::size_t count)
+    {
+        for (; count && from.Head; --count)
+        {
+            FreeBlock* block = from.Head;
+            from.Head = block->Next;
+            --from.Size;
+            block->Next = to.Head;
+            to.Head = block;
+            ++to.Size;
+        }
+    }
+
+    void FreeBlocks(FreeList& list, std::size_t count, std::size_t sizeClass)
+    {
+        std::size_t freed = 0;
+        for (; freed < count && list.Head; ++freed)
+        {
+            FreeBlock* block = list.Head;
+            list.Head = block->Next;
+            --list.Size;
+            ::operator delete(block);
+        }
+
+        s_counters[sizeClass].Cached.fetch_sub(freed, std::memory_order_relaxed);
+    }
+
+    // hands the blocks of an exiting thread to the depot
+    struct ThreadCacheReleaser
+    {
+        ~ThreadCacheReleaser()
+        {
+            for (std::size_t sizeClass = 0; sizeClass < BufferPool::SizeClassCount; ++sizeClass)
+            {
+                FreeList& list = t_cache.Lists[sizeClass];
+                {
+                    std::lock_guard<std::mutex> guard(s_depots[sizeClass].Lock);
+                    FreeList& depot = s_depots[sizeClass].List;
+                    MoveBlocks(list, depot, GetMaxDepotBlocks(sizeClass) - std::min(depot.Size, GetMaxDepotBlocks(sizeClass)));
+                }
+
+                FreeBlocks(list, list.Size, sizeClass);
+            }
+
+            t_cache.Released = true;
+        }
+    };
+
+    // registers the release of the cache of this thread, before its first block is cached
+    void RegisterThreadCacheRelease()
+    {
+        static thread_local ThreadCacheReleaser releaser;
+        (void)releaser;
+    }
+}
+
+void* Acore::BufferPool::Allocate(std::size_t size)
+{
+    if (size > MaxBlockSize)
+        return ::operator new(size);
+
+    std::size_t const sizeClass = GetSizeClass(size);
+    SizeClassCounters& counters = s_counters[sizeClass];
+    counters.Allocations.fetch_add(1, std::memory_order_relaxed);
+    counters.Active.fetch_add(1, std::memory_order_relaxed);
+
+    FreeList& list = t_cache.Lists[sizeClass];
+    if (!list.Head && !t_cache.Released)
+    {
+        RegisterThreadCacheRelease();
+        std::lock_guard<std::mutex> guard(s_depots[sizeClass].Lock);
+        MoveBlocks(s_depots[sizeClass].List, list, GetMaxThreadBlocks(sizeClass) / 2);
+    }
+
+    if (FreeBlock* block = list.Head)
+    {
+        list.Head = block->Next;
+        --list.Size;
+        counters.Cached.fetch_sub(1, std::memory_order_relaxed);
+        return block;
+    }
+
+    counters.HeapAllocations.fetch_add(1, std::memory_order_relaxed);
+    return ::operator new(GetBlockSize(sizeClass));
+}
+
+void Acore::BufferPool::Deallocate(void* ptr, std::size_t size) noexcept
+{
+    if (!ptr)
+        return;
+
+    if (size > MaxBlockSize)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    std::size_t const sizeClass = GetSizeClass(size);
+    SizeClassCounters& counters = s_counters[sizeClass];
+    counters.Active.fetch_sub(1, std::memory_order_relaxed);
+
+    // thread_local destructors already ran on this thread
+    if (t_cache.Released)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    RegisterThreadCacheRelease();
+
+    FreeList& list = t_cache.Lists[sizeClass];
+    FreeBlock* block = static_cast<FreeBlock*>(ptr);
+    block->Next = list.Head;
+    list.Head = block;
+    ++list.Size;
+    counters.Cached.fetch_add(1, std::memory_order_relaxed);
+
+    if (list.Size < GetMaxThreadBlocks(sizeClass))
+        return;
+
+    // full, share half of the list with the other threads and free what the depot can't hold
+    std::size_t const excess = list.Size / 2;
+    {
+        std::lock_guard<std::mutex> guard(s_depots[sizeClass].Lock);
+        FreeList& depot = s_depots[sizeClass].List;
+        MoveBlocks(list, depot, std::min(excess, GetMaxDepotBlocks(sizeClass) - std::min(depot.Size, GetMaxDepotBlocks(sizeClass))));
+    }
+
+    if (list.Size > GetMaxThreadBlocks(sizeClass) - excess)
+        FreeBlocks(list, list.Size - (GetMaxThreadBlocks(sizeClass) - excess), sizeClass);
+}
+
+Acore::BufferPool::Stats Acore::BufferPool::GetStats(std::size_t sizeClass)
+{
+    SizeClassCounters const& counters = s_counters[sizeClass];
+    return
+    {
+        counters.Allocations.load(std::memory_order_relaxed),
+        counters.HeapAllocations.load(std::memory_order_relaxed),
+        counters.Active.load(std::memory_order_relaxed),
+        counters.Cached.load(std::memory_order_relaxed)
+    };
+}
@@ -0,0 +1,84 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_BUFFER_POOL_H
+#define ACORE_BUFFER_POOL_H
+
+#include "Define.h"
+#include <cstddef>
+#include <vector>
+
+namespace Acore
+{
+    /*
+     * Size classed pool for the byte storage of network and packet buffers.
+     *
+     * Requests are rounded up to a power of two between MinBlockSize and
+     * MaxBlockSize, larger requests go to the global heap. Freed blocks are
+     * kept in a list per size class owned by the freeing thread. Lists which
+     * grow too large hand half of their blocks to a depot shared by all
+     * threads, and empty lists refill from it: packets are mostly allocated
+     * by the network threads and freed by the world and map threads, so
+     * their blocks travel back through the depot.
+     */
+    class AC_COMMON_API BufferPool
+    {
+    public:
+        static constexpr std::size_t MinBlockSize = 64;
+        static constexpr std::size_t MaxBlockSize = 16384;
+        static constexpr std::size_t SizeClassCount = 9;
+
+        struct Stats
+        {
+            uint64 Allocations;     // blocks handed out since the start
+            uint64 HeapAllocations; // allocations which found no cached block
+            std::size_t Active;     // blocks currently in use
+            std::size_t Cached;     // freed blocks waiting for reuse, in thread lists and depot
+        };
+
+        static void* Allocate(std::size_t size);
+        static void Deallocate(void* ptr, std::size_t size) noexcept;
+
+        [[nodiscard]] static constexpr std::size_t GetBlockSize(std::size_t sizeClass) { return MinBlockSize << sizeClass; }
+        [[nodiscard]] static Stats GetStats(std::size_t sizeClass);
+    };
+
+    // Standard allocator drawing from BufferPool
+    template<class T>
+    class BufferAllocator
+    {
+    public:
+        using value_type = T;
+
+        BufferAllocator() noexcept = default;
+        template<class U>
+        BufferAllocator(BufferAllocator<U> const&) noexcept { }
+
+        T* allocate(std::size_t n) { return static_cast<T*>(BufferPool::Allocate(n * sizeof(T))); }
+        void deallocate(T* ptr, std::size_t n) noexcept { BufferPool::Deallocate(ptr, n * sizeof(T)); }
+
+        template<class U>
+        bool operator==(BufferAllocator<U> const&) const noexcept { return true; }
+        template<class U>
+        bool operator!=(BufferAllocator<U> const&) const noexcept { return false; }
+    };
+
+    // Byte storage of MessageBuffer and ByteBuffer, moved from one to the other without copy
+    using ByteStorage = std::vector<uint8, BufferAllocator<uint8>>;
+}
+
+#endif
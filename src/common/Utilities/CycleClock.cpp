@@ -0,0 +1,106 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CycleClock.h"
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define AC_CYCLE_CLOCK_TSC
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace
+{
+    struct Calibration
+    {
+        bool CounterBased = false;
+        uint64 BaseCycles = 0;
+        double NanosecondsPerCycle = 0.0;
+    };
+
+#ifdef AC_CYCLE_CLOCK_TSC
+    // the counter ticks at a constant rate in all power states, otherwise it can't measure time
+    bool HasInvariantCounter()
+    {
+#ifdef _MSC_VER
+        int registers[4];
+        __cpuid(registers, 0x80000000);
+        if (uint32(registers[0]) < 0x80000007)
+            return false;
+
+        __cpuid(registers, 0x80000007);
+        return (registers[3] & (1 << 8)) != 0;
+#else
+        unsigned int eax, ebx, ecx, edx;
+        if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx))
+            return false;
+
+        return (edx & (1 << 8)) != 0;
+#endif
+    }
+#endif
+
+    Calibration Calibrate()
+    {
+        Calibration calibration;
+#ifdef AC_CYCLE_CLOCK_TSC
+        if (!HasInvariantCounter())
+            return calibration;
+
+        std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+        uint64 const startCycles = __rdtsc();
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        uint64 const endCycles = __rdtsc();
+        std::chrono::steady_clock::time_point const end = std::chrono::steady_clock::now();
+
+        if (endCycles <= startCycles)
+            return calibration;
+
+        calibration.CounterBased = true;
+        calibration.BaseCycles = startCycles;
+        calibration.NanosecondsPerCycle = double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / double(endCycles - startCycles);
+#endif
+        return calibration;
+    }
+
+    Calibration const& GetCalibration()
+    {
+        static Calibration const calibration = Calibrate();
+        return calibration;
+    }
+}
+
+Acore::CycleClock::time_point Acore::CycleClock::now() noexcept
+{
+    [[maybe_unused]] Calibration const& calibration = GetCalibration();
+#ifdef AC_CYCLE_CLOCK_TSC
+    if (calibration.CounterBased)
+        return time_point(duration(rep(double(__rdtsc() - calibration.BaseCycles) * calibration.NanosecondsPerCycle)));
+#endif
+
+    return time_point(std::chrono::duration_cast<duration>(std::chrono::steady_clock::now().time_since_epoch()));
+}
+
+bool Acore::CycleClock::IsCounterBased()
+{
+    return GetCalibration().CounterBased;
+}
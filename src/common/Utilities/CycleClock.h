@@ -0,0 +1,51 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_CYCLE_CLOCK_H
+#define ACORE_CYCLE_CLOCK_H
+
+#include "Define.h"
+#include <chrono>
+
+namespace Acore
+{
+    /*
+     * Monotonic clock reading the time stamp counter of the CPU, for timing
+     * code which runs too often to pay for steady_clock::now() each time.
+     *
+     * The counter is scaled to nanoseconds by a calibration against
+     * steady_clock taken on first use. CPUs without an invariant counter, and
+     * other architectures, fall back to steady_clock. Only meant for
+     * measuring durations, its time points don't compare to other clocks.
+     */
+    class AC_COMMON_API CycleClock
+    {
+    public:
+        using duration = std::chrono::nanoseconds;
+        using rep = duration::rep;
+        using period = duration::period;
+        using time_point = std::chrono::time_point<CycleClock>;
+        static constexpr bool is_steady = true;
+
+        static time_point now() noexcept;
+
+        // Whether now() reads the time stamp counter
+        static bool IsCounterBased();
+    };
+}
+
+#endif
@@ -17,6 +17,7 @@
 
 #include "EventMap.h"
 #include "Random.h"
+#include <algorithm>
 
 void EventMap::Reset()
 {
@@ -53,7 +54,7 @@ void EventMap::ScheduleEvent(EventId eventId, Milliseconds time, GroupIndex grou
     if (phase > sizeof(PhaseMask) * 8)
         return;
 
-    _eventMap.emplace(_time + time, Event(eventId, group, phase));
+    Insert(_time + time, Event(eventId, group, phase));
 }
 
 void EventMap::ScheduleEvent(EventId eventId, Milliseconds minTime, Milliseconds maxTime, GroupIndex group /*= 0u*/, PhaseIndex phase /*= 0u*/)
@@ -75,7 +76,7 @@ void EventMap::RescheduleEvent(EventId eventId, Milliseconds time, GroupIndex gr
 
 void EventMap::Repeat(Milliseconds time)
 {
-    _eventMap.emplace(_time + time, _lastEvent);
+    Insert(_time + time, _lastEvent);
 }
 
 void EventMap::Repeat(Milliseconds minTime, Milliseconds maxTime)
@@ -87,17 +88,17 @@ EventMap::EventId EventMap::ExecuteEvent()
 {
     while (!Empty())
     {
-        auto const& itr = _eventMap.begin();
+        auto const& [time, event] = _eventMap.back();
 
-        if (itr->first > _time)
+        if (time > _time)
             return 0;
-        else if (_phaseMask && itr->second._phaseMask && !(itr->second._phaseMask & _phaseMask))
-            _eventMap.erase(itr);
+        else if (_phaseMask && event._phaseMask && !(event._phaseMask & _phaseMask))
+            _eventMap.pop_back();
         else
         {
-            auto eventId = itr->second._id;
-            _lastEvent = itr->second;
-            _eventMap.erase(itr);
+            auto eventId = event._id;
+            _lastEvent = event;
+            _eventMap.pop_back();
             return eventId;
         }
     }
@@ -107,16 +108,9 @@ EventMap::EventId EventMap::ExecuteEvent()
 
 void EventMap::DelayEvents(Milliseconds delay)
 {
-    if (Empty())
-        return;
-
-    EventStore delayed = std::move(_eventMap);
-    for (auto itr = delayed.begin(); itr != delayed.end();)
-    {
-        auto node = delayed.extract(itr++);
-        node.key() = node.key() + delay;
-        _eventMap.insert(_eventMap.end(), std::move(node));
-    }
+    // the order is kept, all events move by the same delay
+    for (auto& [time, event] : _eventMap)
+        time += delay;
 }
 
 void EventMap::DelayEvents(Milliseconds delay, GroupIndex group)
@@ -124,37 +118,48 @@ void EventMap::DelayEvents(Milliseconds delay, GroupIndex group)
     if (group > sizeof(GroupMask) * 8 || Empty())
         return;
 
+    auto matches = [group](EventStore::value_type const& entry)
+    {
+        return !group || (entry.second._groupMask & GroupMask(1u << (group - 1u)));
+    };
+
     EventStore delayed;
 
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
-    {
-        if (!group || (itr->second._groupMask & GroupMask(1u << (group - 1u))))
-        {
-            delayed.emplace(itr->first + delay, itr->second);
-            itr = _eventMap.erase(itr);
-            continue;
-        }
+    // in execution order
+    for (auto itr = _eventMap.rbegin(); itr != _eventMap.rend(); ++itr)
+        if (matches(*itr))
+            delayed.emplace_back(itr->first + delay, itr->second);
 
-        ++itr;
-    }
+    if (delayed.empty())
+        return;
+
+    _eventMap.erase(std::remove_if(_eventMap.begin(), _eventMap.end(), matches), _eventMap.end());
 
-    _eventMap.insert(delayed.begin(), delayed.end());
+    for (auto const& [time, event] : delayed)
+        Insert(time, event);
 }
 
 void EventMap::DelayEventsToMax(Milliseconds delay, GroupIndex group)
 {
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
+    auto matches = [this, delay, group](EventStore::value_type const& entry)
     {
-        if (itr->first < _time + delay && (!group || (itr->second._groupMask & GroupMask(1u << (group - 1u)))))
-        {
-            ScheduleEvent(itr->second._id, delay, group);
-            _eventMap.erase(itr);
-            itr = _eventMap.begin();
-            continue;
-        }
+        return entry.first < _time + delay && (!group || (entry.second._groupMask & GroupMask(1u << (group - 1u))));
+    };
 
-        ++itr;
-    }
+    std::vector<EventId> delayed;
+
+    // in execution order
+    for (auto itr = _eventMap.rbegin(); itr != _eventMap.rend(); ++itr)
+        if (matches(*itr))
+            delayed.push_back(itr->second._id);
+
+    if (delayed.empty())
+        return;
+
+    _eventMap.erase(std::remove_if(_eventMap.begin(), _eventMap.end(), matches), _eventMap.end());
+
+    for (EventId eventId : delayed)
+        ScheduleEvent(eventId, delay, group);
 }
 
 void EventMap::CancelEvent(EventId eventId)
@@ -162,16 +167,10 @@ void EventMap::CancelEvent(EventId eventId)
     if (Empty())
         return;
 
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
+    _eventMap.erase(std::remove_if(_eventMap.begin(), _eventMap.end(), [eventId](EventStore::value_type const& entry)
     {
-        if (eventId == itr->second._id)
-        {
-            itr = _eventMap.erase(itr);
-            continue;
-        }
-
-        ++itr;
-    }
+        return entry.second._id == eventId;
+    }), _eventMap.end());
 }
 
 void EventMap::CancelEventGroup(GroupIndex group)
@@ -179,17 +178,10 @@ void EventMap::CancelEventGroup(GroupIndex group)
     if (!group || group > sizeof(GroupMask) * 8 || Empty())
         return;
 
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
+    _eventMap.erase(std::remove_if(_eventMap.begin(), _eventMap.end(), [group](EventStore::value_type const& entry)
     {
-        if (itr->second._groupMask & GroupMask(1u << (group - 1u)))
-        {
-            _eventMap.erase(itr);
-            itr = _eventMap.begin();
-            continue;
-        }
-
-        ++itr;
-    }
+        return (entry.second._groupMask & GroupMask(1u << (group - 1u))) != 0;
+    }), _eventMap.end());
 }
 
 bool EventMap::IsInPhase(PhaseIndex phase) const
@@ -199,13 +191,21 @@ bool EventMap::IsInPhase(PhaseIndex phase) const
 
 Milliseconds EventMap::GetTimeUntilEvent(EventId eventId) const
 {
-    for (auto const& [time, event] : _eventMap)
-        if (eventId == event._id)
-            return std::chrono::duration_cast<Milliseconds>(time - _time);
+    // first due first
+    for (auto itr = _eventMap.rbegin(); itr != _eventMap.rend(); ++itr)
+        if (eventId == itr->second._id)
+            return std::chrono::duration_cast<Milliseconds>(itr->first - _time);
 
     return Milliseconds::max();
 }
 
+void EventMap::Insert(TimePoint time, Event const& event)
+{
+    // in front of the events already due at that time, they sit closer to the back and execute first
+    auto itr = std::partition_point(_eventMap.begin(), _eventMap.end(), [time](EventStore::value_type const& entry) { return entry.first > time; });
+    _eventMap.emplace(itr, time, event);
+}
+
 bool EventMap::HasTimeUntilEvent(EventId eventId) const
 {
     return GetTimeUntilEvent(eventId) != Milliseconds::max();
@@ -20,7 +20,7 @@
 
 #include "Define.h"
 #include "Duration.h"
-#include <map>
+#include <vector>
 
 class EventMap
 {
@@ -48,7 +48,9 @@ class EventMap
      * Internal storage type.
      * Key: Time as TimePoint when the event should occur.
      */
-    using EventStore = std::multimap<TimePoint, Event>;
+    // events ordered from the last due to the first due, so the next one is taken from the back;
+    // events due at the same time execute in the order they were scheduled
+    using EventStore = std::vector<std::pair<TimePoint, Event>>;
 
 public:
     EventMap() { }
@@ -245,6 +247,14 @@ public:
     bool HasTimeUntilEvent(EventId eventId) const;
 
 private:
+    /**
+    * @name Insert
+    * @brief Stores an event behind the events already due at the same time.
+    * @param time Time the event is due at.
+    * @param event The event.
+    */
+    void Insert(TimePoint time, Event const& event);
+
     /**
     * @name _time
     * @brief Internal timer.
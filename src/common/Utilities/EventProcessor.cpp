@@ -43,12 +43,11 @@ void EventProcessor::Update(uint32 p_time)
     m_time += p_time;
 
     // main event loop
-    EventList::iterator i;
-    while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+    while (!m_events.empty() && m_events.top().DueTime <= m_time)
     {
         // get and remove event from queue
-        BasicEvent* event = i->second;
-        m_events.erase(i);
+        BasicEvent* event = m_events.top().Item;
+        m_events.pop();
 
         if (event->IsRunning())
         {
@@ -81,55 +80,54 @@ void EventProcessor::Update(uint32 p_time)
 
 void EventProcessor::KillAllEvents(bool force)
 {
-    // first, abort all existing events
-    for (auto itr = m_events.begin(); itr != m_events.end();)
+    // events are taken out of the queue first, aborting one may add or cancel others
+    std::vector<EventList::Entry> events;
+    std::vector<EventList::Entry> kept;
+    do
     {
-        // Abort events which weren't aborted already
-        if (!itr->second->IsAborted())
-        {
-            itr->second->SetAborted();
-            itr->second->Abort(m_time);
-        }
+        m_events.extract_if([](EventList::Entry const&) { return true; }, events);
 
-        // Skip non-deletable events when we are
-        // not forcing the event cancellation.
-        if (!force && !itr->second->IsDeletable())
+        for (EventList::Entry& entry : events)
         {
-            ++itr;
-            continue;
-        }
+            // Abort events which weren't aborted already
+            if (!entry.Item->IsAborted())
+            {
+                entry.Item->SetAborted();
+                entry.Item->Abort(m_time);
+            }
 
-        delete itr->second;
+            // Skip non-deletable events when we are
+            // not forcing the event cancellation.
+            if (!force && !entry.Item->IsDeletable())
+            {
+                kept.push_back(std::move(entry));
+                continue;
+            }
 
-        if (force)
-            ++itr; // Clear the whole container when forcing
-        else
-            itr = m_events.erase(itr);
-    }
+            delete entry.Item;
+        }
 
-    if (force)
-        m_events.clear();
+        events.clear();
+    } while (force && !m_events.empty()); // Clear the whole container when forcing
+
+    m_events.restore(kept);
 }
 
 void EventProcessor::CancelEventGroup(uint8 group)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end();)
-    {
-        if (itr->second->m_eventGroup != group)
-        {
-            ++itr;
-            continue;
-        }
+    std::vector<EventList::Entry> cancelled;
+    m_events.extract_if([group](EventList::Entry const& entry) { return entry.Item->m_eventGroup == group; }, cancelled);
 
+    for (EventList::Entry& entry : cancelled)
+    {
         // Abort events which weren't aborted already
-        if (!itr->second->IsAborted())
+        if (!entry.Item->IsAborted())
         {
-            itr->second->SetAborted();
-            itr->second->Abort(m_time);
+            entry.Item->SetAborted();
+            entry.Item->Abort(m_time);
         }
 
-        delete itr->second;
-        itr = m_events.erase(itr);
+        delete entry.Item;
     }
 }
 
@@ -139,19 +137,18 @@ void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime
         Event->m_addTime = m_time;
     Event->m_execTime = e_time;
     Event->m_eventGroup = eventGroup;
-    m_events.emplace(e_time, Event);
+    m_events.push(e_time, Event);
 }
 
 void EventProcessor::ModifyEventTime(BasicEvent* event, Milliseconds newTime)
 {
     for (auto itr = m_events.begin(); itr != m_events.end(); ++itr)
     {
-        if (itr->second != event)
+        if (itr->Item != event)
             continue;
 
         event->m_execTime = newTime.count();
-        m_events.erase(itr);
-        m_events.emplace(newTime.count(), event);
+        m_events.reschedule(itr, newTime.count());
         break;
     }
 }
@@ -0,0 +1,218 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_FLAT_HASH_MAP_H
+#define ACORE_FLAT_HASH_MAP_H
+
+#include "Define.h"
+#include <algorithm>
+#include <functional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Acore
+{
+    /*
+     * Hash map keeping its entries in one dense array, indexed by an open
+     * addressing table (linear probing, at most half full) of entry indexes
+     * and hash bits. Lookups probe a few adjacent slots and compare keys only
+     * on matching hash bits, iteration walks contiguous memory.
+     *
+     * Erasing moves the last entry into the erased one. erase(iterator)
+     * returns the position of the erased entry, which then holds an entry not
+     * visited yet, so erasing while iterating visits every entry once.
+     * Inserting or erasing invalidates iterators and references to entries.
+     */
+    template<class Key, class Value, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+    class FlatHashMap
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = Value;
+        using value_type = std::pair<Key, Value>;
+        using iterator = typename std::vector<value_type>::iterator;
+        using const_iterator = typename std::vector<value_type>::const_iterator;
+
+        iterator begin() { return _entries.begin(); }
+        iterator end() { return _entries.end(); }
+        const_iterator begin() const { return _entries.begin(); }
+        const_iterator end() const { return _entries.end(); }
+
+        [[nodiscard]] bool empty() const { return _entries.empty(); }
+        [[nodiscard]] std::size_t size() const { return _entries.size(); }
+
+        void clear()
+        {
+            _entries.clear();
+            _slots.clear();
+        }
+
+        void reserve(std::size_t count)
+        {
+            _entries.reserve(count);
+            if (count * 2 > _slots.size())
+                Rehash(count * 2);
+        }
+
+        iterator find(Key const& key)
+        {
+            std::size_t const slot = FindSlot(key, HashOf(key));
+            return slot != NOT_FOUND ? _entries.begin() + _slots[slot].Index : _entries.end();
+        }
+
+        const_iterator find(Key const& key) const
+        {
+            std::size_t const slot = FindSlot(key, HashOf(key));
+            return slot != NOT_FOUND ? _entries.begin() + _slots[slot].Index : _entries.end();
+        }
+
+        [[nodiscard]] bool contains(Key const& key) const { return FindSlot(key, HashOf(key)) != NOT_FOUND; }
+        [[nodiscard]] std::size_t count(Key const& key) const { return contains(key) ? 1 : 0; }
+
+        template<class... Args>
+        std::pair<iterator, bool> emplace(Key const& key, Args&&... args)
+        {
+            uint32 const hash = HashOf(key);
+            std::size_t const slot = FindSlot(key, hash);
+            if (slot != NOT_FOUND)
+                return { _entries.begin() + _slots[slot].Index, false };
+
+            if ((_entries.size() + 1) * 2 > _slots.size())
+                Rehash(std::max<std::size_t>(_slots.size() * 2, MIN_SLOTS));
+
+            _entries.emplace_back(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+            _slots[FindFreeSlot(hash)] = { uint32(_entries.size() - 1), hash };
+            return { _entries.end() - 1, true };
+        }
+
+        std::pair<iterator, bool> insert(value_type const& value) { return emplace(value.first, value.second); }
+
+        Value& operator[](Key const& key) { return emplace(key).first->second; }
+
+        iterator erase(iterator itr)
+        {
+            std::size_t const index = itr - _entries.begin();
+            EraseSlot(FindSlot(itr->first, HashOf(itr->first)));
+            return _entries.begin() + index;
+        }
+
+        std::size_t erase(Key const& key)
+        {
+            std::size_t const slot = FindSlot(key, HashOf(key));
+            if (slot == NOT_FOUND)
+                return 0;
+
+            EraseSlot(slot);
+            return 1;
+        }
+
+    private:
+        static constexpr std::size_t NOT_FOUND = std::size_t(-1);
+        static constexpr std::size_t MIN_SLOTS = 16;
+        static constexpr uint32 EMPTY = uint32(-1);
+
+        struct Slot
+        {
+            uint32 Index = EMPTY;       // of the entry
+            uint32 HashBits = 0;
+        };
+
+        static uint32 HashOf(Key const& key)
+        {
+            // Fibonacci hashing, spreads sequential keys (guid counters) over the whole table
+            return uint32((uint64(Hash()(key)) * 0x9E3779B97F4A7C15ULL) >> 32);
+        }
+
+        std::size_t Mask() const { return _slots.size() - 1; }
+
+        std::size_t FindSlot(Key const& key, uint32 hash) const
+        {
+            if (_slots.empty())
+                return NOT_FOUND;
+
+            for (std::size_t slot = hash & Mask(); _slots[slot].Index != EMPTY; slot = (slot + 1) & Mask())
+                if (_slots[slot].HashBits == hash && KeyEqual()(_entries[_slots[slot].Index].first, key))
+                    return slot;
+
+            return NOT_FOUND;
+        }
+
+        std::size_t FindFreeSlot(uint32 hash) const
+        {
+            std::size_t slot = hash & Mask();
+            while (_slots[slot].Index != EMPTY)
+                slot = (slot + 1) & Mask();
+
+            return slot;
+        }
+
+        void Rehash(std::size_t slotCount)
+        {
+            std::size_t size = MIN_SLOTS;
+            while (size < slotCount)
+                size *= 2;
+
+            _slots.assign(size, Slot());
+            for (std::size_t i = 0; i < _entries.size(); ++i)
+            {
+                uint32 const hash = HashOf(_entries[i].first);
+                _slots[FindFreeSlot(hash)] = { uint32(i), hash };
+            }
+        }
+
+        void EraseSlot(std::size_t slot)
+        {
+            uint32 const index = _slots[slot].Index;
+
+            // close the gap, entries after it in the probe sequence move back unless that passes their home slot
+            std::size_t hole = slot;
+            for (std::size_t next = (hole + 1) & Mask(); _slots[next].Index != EMPTY; next = (next + 1) & Mask())
+            {
+                std::size_t const home = _slots[next].HashBits & Mask();
+                if (((next - home) & Mask()) >= ((next - hole) & Mask()))
+                {
+                    _slots[hole] = _slots[next];
+                    hole = next;
+                }
+            }
+
+            _slots[hole] = Slot();
+
+            // keep the entries dense, the last one takes the erased place
+            uint32 const last = uint32(_entries.size() - 1);
+            if (index != last)
+            {
+                _entries[index] = std::move(_entries[last]);
+
+                uint32 const hash = HashOf(_entries[index].first);
+                std::size_t moved = hash & Mask();
+                while (_slots[moved].Index != last)
+                    moved = (moved + 1) & Mask();
+
+                _slots[moved].Index = index;
+            }
+
+            _entries.pop_back();
+        }
+
+        std::vector<value_type> _entries;
+        std::vector<Slot> _slots;      // power of two size
+    };
+}
+
+#endif
@@ -0,0 +1,206 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_FLAT_MULTI_MAP_H
+#define ACORE_FLAT_MULTI_MAP_H
+
+#include "Define.h"
+#include <boost/container/small_vector.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace Acore
+{
+    /*
+     * Multimap keeping its entries sorted by key in one contiguous array,
+     * with room for InlineCapacity entries inside the container itself.
+     * Entries with equal keys keep their insertion order, like std::multimap.
+     *
+     * Iterators hold the container and an entry index rather than a
+     * pointer: inserting or erasing shifts the entries after the position,
+     * but never leaves an iterator pointing into freed storage. Code holding
+     * an iterator across inserts or erases must account for the shift.
+     */
+    template<class Key, class Value, std::size_t InlineCapacity = 8, class Compare = std::less<Key>>
+    class FlatMultiMap
+    {
+        using Storage = boost::container::small_vector<std::pair<Key, Value>, InlineCapacity>;
+
+        template<bool IsConst>
+        class Iterator
+        {
+            using Container = std::conditional_t<IsConst, Storage const, Storage>;
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = std::pair<Key, Value>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<IsConst, value_type const*, value_type*>;
+            using reference = std::conditional_t<IsConst, value_type const&, value_type&>;
+
+            Iterator() = default;
+            Iterator(Container* entries, std::size_t index) : _entries(entries), _index(index) { }
+            template<bool OtherConst, class = std::enable_if_t<IsConst && !OtherConst>>
+            Iterator(Iterator<OtherConst> const& other) : _entries(other._entries), _index(other._index) { }
+
+            reference operator*() const { return (*_entries)[_index]; }
+            pointer operator->() const { return &(*_entries)[_index]; }
+            reference operator[](difference_type offset) const { return (*_entries)[_index + offset]; }
+
+            Iterator& operator++() { ++_index; return *this; }
+            Iterator operator++(int) { Iterator itr = *this; ++_index; return itr; }
+            Iterator& operator--() { --_index; return *this; }
+            Iterator operator--(int) { Iterator itr = *this; --_index; return itr; }
+            Iterator& operator+=(difference_type offset) { _index += offset; return *this; }
+            Iterator& operator-=(difference_type offset) { _index -= offset; return *this; }
+            Iterator operator+(difference_type offset) const { return Iterator(_entries, _index + offset); }
+            Iterator operator-(difference_type offset) const { return Iterator(_entries, _index - offset); }
+            template<bool OtherConst> difference_type operator-(Iterator<OtherConst> const& other) const { return difference_type(_index) - difference_type(other._index); }
+
+            template<bool OtherConst> bool operator==(Iterator<OtherConst> const& other) const { return _index == other._index && _entries == other._entries; }
+            template<bool OtherConst> bool operator!=(Iterator<OtherConst> const& other) const { return !(*this == other); }
+            template<bool OtherConst> bool operator<(Iterator<OtherConst> const& other) const { return _index < other._index; }
+            template<bool OtherConst> bool operator>(Iterator<OtherConst> const& other) const { return _index > other._index; }
+            template<bool OtherConst> bool operator<=(Iterator<OtherConst> const& other) const { return _index <= other._index; }
+            template<bool OtherConst> bool operator>=(Iterator<OtherConst> const& other) const { return _index >= other._index; }
+
+        private:
+            template<bool> friend class Iterator;
+            friend class FlatMultiMap;
+
+            Container* _entries = nullptr;
+            std::size_t _index = 0;
+        };
+
+    public:
+        using key_type = Key;
+        using mapped_type = Value;
+        using value_type = std::pair<Key, Value>;
+        using size_type = std::size_t;
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+        iterator begin() { return iterator(&_entries, 0); }
+        iterator end() { return iterator(&_entries, _entries.size()); }
+        const_iterator begin() const { return const_iterator(&_entries, 0); }
+        const_iterator end() const { return const_iterator(&_entries, _entries.size()); }
+        const_iterator cbegin() const { return begin(); }
+        const_iterator cend() const { return end(); }
+
+        [[nodiscard]] bool empty() const { return _entries.empty(); }
+        [[nodiscard]] size_type size() const { return _entries.size(); }
+
+        void clear() { _entries.clear(); }
+        void reserve(size_type count) { _entries.reserve(count); }
+
+        iterator lower_bound(Key const& key) { return iterator(&_entries, LowerBound(key)); }
+        const_iterator lower_bound(Key const& key) const { return const_iterator(&_entries, LowerBound(key)); }
+        iterator upper_bound(Key const& key) { return iterator(&_entries, UpperBound(key)); }
+        const_iterator upper_bound(Key const& key) const { return const_iterator(&_entries, UpperBound(key)); }
+
+        std::pair<iterator, iterator> equal_range(Key const& key)
+        {
+            auto [first, last] = EqualRange(key);
+            return { iterator(&_entries, first), iterator(&_entries, last) };
+        }
+
+        std::pair<const_iterator, const_iterator> equal_range(Key const& key) const
+        {
+            auto [first, last] = EqualRange(key);
+            return { const_iterator(&_entries, first), const_iterator(&_entries, last) };
+        }
+
+        iterator find(Key const& key)
+        {
+            size_type const index = LowerBound(key);
+            return iterator(&_entries, IsKeyAt(index, key) ? index : _entries.size());
+        }
+
+        const_iterator find(Key const& key) const
+        {
+            size_type const index = LowerBound(key);
+            return const_iterator(&_entries, IsKeyAt(index, key) ? index : _entries.size());
+        }
+
+        [[nodiscard]] bool contains(Key const& key) const { return IsKeyAt(LowerBound(key), key); }
+
+        [[nodiscard]] size_type count(Key const& key) const
+        {
+            auto [first, last] = EqualRange(key);
+            return last - first;
+        }
+
+        // Inserts after the entries with an equal key
+        iterator insert(value_type const& value)
+        {
+            size_type const index = UpperBound(value.first);
+            _entries.insert(_entries.begin() + index, value);
+            return iterator(&_entries, index);
+        }
+
+        template<class... Args>
+        iterator emplace(Key const& key, Args&&... args)
+        {
+            return insert(value_type(key, Value(std::forward<Args>(args)...)));
+        }
+
+        // Returns the position of the erased entry, now holding the entry that followed it
+        iterator erase(const_iterator itr)
+        {
+            _entries.erase(_entries.begin() + itr._index);
+            return iterator(&_entries, itr._index);
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            _entries.erase(_entries.begin() + first._index, _entries.begin() + last._index);
+            return iterator(&_entries, first._index);
+        }
+
+        size_type erase(Key const& key)
+        {
+            auto [first, last] = EqualRange(key);
+            _entries.erase(_entries.begin() + first, _entries.begin() + last);
+            return last - first;
+        }
+
+    private:
+        struct KeyLess
+        {
+            bool operator()(value_type const& entry, Key const& key) const { return Compare()(entry.first, key); }
+            bool operator()(Key const& key, value_type const& entry) const { return Compare()(key, entry.first); }
+        };
+
+        size_type LowerBound(Key const& key) const { return std::lower_bound(_entries.begin(), _entries.end(), key, KeyLess()) - _entries.begin(); }
+        size_type UpperBound(Key const& key) const { return std::upper_bound(_entries.begin(), _entries.end(), key, KeyLess()) - _entries.begin(); }
+
+        std::pair<size_type, size_type> EqualRange(Key const& key) const
+        {
+            auto [first, last] = std::equal_range(_entries.begin(), _entries.end(), key, KeyLess());
+            return { size_type(first - _entries.begin()), size_type(last - _entries.begin()) };
+        }
+
+        bool IsKeyAt(size_type index, Key const& key) const { return index < _entries.size() && !Compare()(key, _entries[index].first); }
+
+        Storage _entries;
+    };
+}
+
+#endif
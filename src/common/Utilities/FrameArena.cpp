@@ -0,0 +1,125 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FrameArena.h"
+#include <cstddef>
+#include <new>
+
+namespace
+{
+    using Acore::FrameArena;
+
+    class FrameArenaResource final : public std::pmr::memory_resource
+    {
+    public:
+        ~FrameArenaResource() override
+        {
+            for (std::byte* chunk : _chunks)
+                ::operator delete(chunk);
+        }
+
+        void Trim()
+        {
+            if (_live)
+                return;
+
+            while (_chunks.size() > 1)
+            {
+                ::operator delete(_chunks.back());
+                _chunks.pop_back();
+            }
+        }
+
+        [[nodiscard]] FrameArena::Stats GetStats() const { return { _live, _chunks.size() * FrameArena::ChunkSize }; }
+
+    private:
+        static bool UsesHeap(std::size_t bytes, std::size_t alignment)
+        {
+            return bytes > FrameArena::MaxAllocationSize || alignment > alignof(std::max_align_t);
+        }
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            if (UsesHeap(bytes, alignment))
+                return ::operator new(bytes, std::align_val_t(alignment));
+
+            for (;;)
+            {
+                if (_current == _chunks.size())
+                    _chunks.push_back(static_cast<std::byte*>(::operator new(FrameArena::ChunkSize)));
+
+                std::size_t const begin = (_offset + alignment - 1) & ~(alignment - 1);
+                if (begin + bytes <= FrameArena::ChunkSize)
+                {
+                    _offset = begin + bytes;
+                    ++_live;
+                    return _chunks[_current] + begin;
+                }
+
+                ++_current;
+                _offset = 0;
+            }
+        }
+
+        void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override
+        {
+            if (UsesHeap(bytes, alignment))
+            {
+                ::operator delete(ptr, bytes, std::align_val_t(alignment));
+                return;
+            }
+
+            if (!--_live)
+            {
+                _current = 0;
+                _offset = 0;
+                return;
+            }
+
+            // the last allocation gives its bytes back, which lets a growing vector reuse them
+            if (static_cast<std::byte*>(ptr) + bytes == _chunks[_current] + _offset)
+                _offset -= bytes;
+        }
+
+        bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+        std::vector<std::byte*> _chunks;
+        std::size_t _current = 0;
+        std::size_t _offset = 0;
+        std::size_t _live = 0;
+    };
+
+    thread_local FrameArenaResource t_arena;
+}
+
+std::pmr::memory_resource* Acore::FrameArena::GetResource()
+{
+    return &t_arena;
+}
+
+void Acore::FrameArena::Trim()
+{
+    t_arena.Trim();
+}
+
+Acore::FrameArena::Stats Acore::FrameArena::GetStats()
+{
+    return t_arena.GetStats();
+}
@@ -0,0 +1,72 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_FRAME_ARENA_H
+#define ACORE_FRAME_ARENA_H
+
+#include "Define.h"
+#include <list>
+#include <memory_resource>
+#include <vector>
+
+namespace Acore
+{
+    /*
+     * Bump allocator of the calling thread for the temporaries of an update:
+     * target lists, proc lists and search results which die before the
+     * function building them returns.
+     *
+     * Allocations are carved from chunks owned by the thread and freeing
+     * only counts them, except for the last allocation which gives its bytes
+     * back. Once every allocation is freed the arena rewinds to its first
+     * chunk, and Trim() at the end of each map update gives the chunks grown
+     * by a busy update back to the heap. Requests above MaxAllocationSize go
+     * to the heap directly.
+     *
+     * Memory of the arena must not be kept past the update nor handed to
+     * another thread; containers stored in objects keep the default allocator.
+     */
+    class AC_COMMON_API FrameArena
+    {
+    public:
+        static constexpr std::size_t ChunkSize = 64 * 1024;
+        static constexpr std::size_t MaxAllocationSize = 16 * 1024;
+
+        struct Stats
+        {
+            std::size_t LiveAllocations; // allocations of the arena not freed yet
+            std::size_t ReservedBytes;   // bytes of the chunks held by the arena
+        };
+
+        // memory resource of the arena of the calling thread
+        [[nodiscard]] static std::pmr::memory_resource* GetResource();
+
+        // frees the chunks above the first one, nothing is done while allocations are alive
+        static void Trim();
+
+        [[nodiscard]] static Stats GetStats();
+    };
+
+    // Containers of temporaries, construct them with FrameArena::GetResource()
+    template<class T>
+    using FrameVector = std::pmr::vector<T>;
+
+    template<class T>
+    using FrameList = std::pmr::list<T>;
+}
+
+#endif
@@ -18,13 +18,13 @@
 #ifndef __MESSAGEBUFFER_H_
 #define __MESSAGEBUFFER_H_
 
+#include "BufferPool.h"
 #include "Define.h"
 #include <cstring>
-#include <vector>
 
 class MessageBuffer
 {
-    using size_type = std::vector<uint8>::size_type;
+    using size_type = Acore::ByteStorage::size_type;
 
 public:
     MessageBuffer() :  _storage()
@@ -99,7 +99,7 @@ public:
         }
     }
 
-    std::vector<uint8>&& Move()
+    Acore::ByteStorage&& Move()
     {
         _wpos = 0;
         _rpos = 0;
@@ -134,7 +134,7 @@ public:
 private:
     size_type _wpos{0};
     size_type _rpos{0};
-    std::vector<uint8> _storage;
+    Acore::ByteStorage _storage;
 };
 
 #endif /* __MESSAGEBUFFER_H_ */
@@ -0,0 +1,173 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_OBJECT_POOL_H
+#define ACORE_OBJECT_POOL_H
+
+#include "Define.h"
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+namespace Acore
+{
+    /*
+     * Allocator for objects of type T which are created and destroyed at a
+     * high rate. Freed blocks are kept in a list owned by the freeing thread
+     * and handed out again by its next allocations, so map update threads
+     * reuse their own memory without taking any lock.
+     *
+     * A block freed by another thread than the one which allocated it simply
+     * joins the list of the freeing thread. Each list keeps at most
+     * MaxCachedBlocks blocks and returns the rest to the global heap, and is
+     * released when its thread exits.
+     *
+     * Requests for another size than sizeof(T), made for classes deriving
+     * from T that don't declare their own pool, go to the global heap.
+     *
+     * Usage, inside the class declaration:
+     *     static void* operator new(std::size_t size) { return Acore::ObjectPool<T>::Allocate(size); }
+     *     static void operator delete(void* ptr, std::size_t size) { Acore::ObjectPool<T>::Deallocate(ptr, size); }
+     */
+    template<class T, std::size_t MaxCachedBlocks = 1024>
+    class ObjectPool
+    {
+    public:
+        static void* Allocate(std::size_t size)
+        {
+            if (size != sizeof(T))
+                return ::operator new(size);
+
+            _activeCount.fetch_add(1, std::memory_order_relaxed);
+
+            if (FreeBlock* block = t_freeList.Head)
+            {
+                t_freeList.Head = block->Next;
+                --t_freeList.Size;
+                _cachedCount.fetch_sub(1, std::memory_order_relaxed);
+                return block;
+            }
+
+            return ::operator new(sizeof(T));
+        }
+
+        static void Deallocate(void* ptr, std::size_t size) noexcept
+        {
+            if (!ptr)
+                return;
+
+            if (size != sizeof(T))
+            {
+                ::operator delete(ptr);
+                return;
+            }
+
+            _activeCount.fetch_sub(1, std::memory_order_relaxed);
+
+            // thread_local destructors already ran on this thread, or the list is full
+            if (t_freeList.Released || t_freeList.Size >= MaxCachedBlocks)
+            {
+                ::operator delete(ptr);
+                return;
+            }
+
+            // registers the cleanup of the list for this thread on first use
+            static thread_local FreeListReleaser releaser;
+            (void)releaser;
+
+            FreeBlock* block = static_cast<FreeBlock*>(ptr);
+            block->Next = t_freeList.Head;
+            t_freeList.Head = block;
+            ++t_freeList.Size;
+            _cachedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // objects of type T currently alive, over all threads
+        [[nodiscard]] static std::size_t GetActiveCount() { return _activeCount.load(std::memory_order_relaxed); }
+
+        // freed blocks waiting for reuse, over all threads
+        [[nodiscard]] static std::size_t GetCachedCount() { return _cachedCount.load(std::memory_order_relaxed); }
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* Next;
+        };
+
+        static_assert(sizeof(T) >= sizeof(FreeBlock), "ObjectPool: object type smaller than a pointer");
+
+        // trivially destructible, so it stays usable while the other thread_local objects are destroyed
+        struct FreeList
+        {
+            FreeBlock* Head;
+            std::size_t Size;
+            bool Released;
+        };
+
+        struct FreeListReleaser
+        {
+            ~FreeListReleaser()
+            {
+                while (FreeBlock* block = t_freeList.Head)
+                {
+                    t_freeList.Head = block->Next;
+                    ::operator delete(block);
+                }
+
+                _cachedCount.fetch_sub(t_freeList.Size, std::memory_order_relaxed);
+                t_freeList.Size = 0;
+                t_freeList.Released = true;
+            }
+        };
+
+        static inline thread_local FreeList t_freeList = { nullptr, 0, false };
+        static inline std::atomic<std::size_t> _activeCount{ 0 };
+        static inline std::atomic<std::size_t> _cachedCount{ 0 };
+    };
+
+    /*
+     * Standard allocator drawing single objects from ObjectPool, for objects
+     * created through std::allocate_shared: the pool is the one of the
+     * control block type the allocator is rebound to.
+     */
+    template<class T>
+    class PoolAllocator
+    {
+    public:
+        using value_type = T;
+
+        PoolAllocator() noexcept = default;
+
+        template<class U>
+        PoolAllocator(PoolAllocator<U> const&) noexcept { }
+
+        T* allocate(std::size_t count)
+        {
+            return static_cast<T*>(ObjectPool<T>::Allocate(count * sizeof(T)));
+        }
+
+        void deallocate(T* ptr, std::size_t count) noexcept
+        {
+            ObjectPool<T>::Deallocate(ptr, count * sizeof(T));
+        }
+
+        template<class U>
+        bool operator==(PoolAllocator<U> const&) const noexcept { return true; }
+    };
+}
+
+#endif
@@ -82,16 +82,20 @@ uint32 rand32()
     return GetRng()->RandomUInt32();
 }
 
+void SetRandomSeed(uint32 seed)
+{
+    sfmtRand = std::make_unique<SFMTRand>(seed);
+}
+
+// one 32 bit draw, std::uniform_real_distribution<double> takes two to fill the 53 bits of the mantissa
 double rand_norm()
 {
-    std::uniform_real_distribution<double> urd;
-    return urd(engine);
+    return GetRng()->RandomUInt32() * (1.0 / 4294967296.0);
 }
 
 double rand_chance()
 {
-    std::uniform_real_distribution<double> urd(0.0, 100.0);
-    return urd(engine);
+    return rand_norm() * 100.0;
 }
 
 uint32 urandweighted(std::size_t count, double const* chances)
@@ -35,6 +35,9 @@ AC_COMMON_API uint32 urandms(uint32 min, uint32 max);
 /* Return a random number in the range 0 .. UINT32_MAX. */
 AC_COMMON_API uint32 rand32();
 
+/* Restart the generator of the calling thread from seed, the following numbers of this thread are the same for the same seed. */
+AC_COMMON_API void SetRandomSeed(uint32 seed);
+
 /* Return a random time in the range min..max (up to millisecond precision). Only works for values where millisecond difference is a valid uint32. */
 AC_COMMON_API Milliseconds randtime(Milliseconds min, Milliseconds max);
 
@@ -73,9 +73,9 @@ SFMTRand::SFMTRand()
     }
 }
 
-uint32 SFMTRand::RandomUInt32()                            // Output random bits
+SFMTRand::SFMTRand(uint32 seed)
 {
-    return sfmt_genrand_uint32(&_state);
+    sfmt_init_gen_rand(&_state, seed);
 }
 
 void* SFMTRand::operator new(std::size_t size, std::nothrow_t const&)
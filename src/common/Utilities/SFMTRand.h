@@ -24,12 +24,16 @@
 
 /*
  * C++ Wrapper for SFMT
+ *
+ * The state holds a block of SFMT_N32 numbers generated at once with SIMD,
+ * RandomUInt32 reads the next one and refills the block when it runs out.
  */
 class SFMTRand
 {
 public:
     SFMTRand();
-    uint32 RandomUInt32(); // Output random bits
+    explicit SFMTRand(uint32 seed);
+    uint32 RandomUInt32() { return sfmt_genrand_uint32(&_state); } // Output random bits
     void* operator new(std::size_t size, std::nothrow_t const&);
     void operator delete(void* ptr, std::nothrow_t const&);
     void* operator new(std::size_t size);
@@ -19,10 +19,12 @@
 #define _STRING_FORMAT_H_
 
 #include "Define.h"
+#include "Optional.h"
 #include <fmt/chrono.h>
 #include <fmt/format.h>
 #include <fmt/printf.h>
 #include <locale>
+#include <string_view>
 
 namespace Acore
 {
@@ -43,6 +45,102 @@ namespace Acore
         }
     }
 
+    /// Appends the formatted arguments to out, without an intermediate std::string.
+    template<typename... Args>
+    inline void StringFormatTo(fmt::memory_buffer& out, FormatString<Args...> fmt, Args&&... args)
+    {
+        std::size_t const size = out.size();
+        try
+        {
+            fmt::format_to(std::back_inserter(out), fmt, std::forward<Args>(args)...);
+        }
+        catch (std::exception const& e)
+        {
+            out.resize(size);
+            fmt::format_to(std::back_inserter(out), "Wrong format occurred ({}). Fmt string: '{}'", e.what(), fmt.get());
+        }
+    }
+
+    namespace Impl
+    {
+        struct ThreadFormatBuffer
+        {
+            fmt::memory_buffer Buffer;
+            bool Borrowed = false;
+        };
+
+        inline ThreadFormatBuffer& GetThreadFormatBuffer()
+        {
+            thread_local ThreadFormatBuffer buffer;
+            return buffer;
+        }
+    }
+
+    /**
+     * Format target reusing the storage of the calling thread between calls.
+     *
+     * Borrows the buffer of the thread for its lifetime, scopes nested in it
+     * (a formatter which logs) use a buffer of their own. Views returned by
+     * Format are valid until the next Format or the end of the scope.
+     */
+    class FormatBuffer
+    {
+    public:
+        // buffers grown above this by a large message are released on return
+        static constexpr std::size_t MaxKeptCapacity = 64 * 1024;
+
+        FormatBuffer()
+        {
+            Impl::ThreadFormatBuffer& shared = Impl::GetThreadFormatBuffer();
+            if (shared.Borrowed)
+            {
+                _own.emplace();
+                return;
+            }
+
+            shared.Borrowed = true;
+            shared.Buffer.clear();
+            _shared = &shared;
+        }
+
+        ~FormatBuffer()
+        {
+            if (!_shared)
+                return;
+
+            if (_shared->Buffer.capacity() > MaxKeptCapacity)
+                _shared->Buffer = fmt::memory_buffer();
+
+            _shared->Borrowed = false;
+        }
+
+        FormatBuffer(FormatBuffer const&) = delete;
+        FormatBuffer& operator=(FormatBuffer const&) = delete;
+
+        template<typename... Args>
+        std::string_view Format(FormatString<Args...> fmt, Args&&... args)
+        {
+            Get().clear();
+            Append(fmt, std::forward<Args>(args)...);
+            return View();
+        }
+
+        template<typename... Args>
+        void Append(FormatString<Args...> fmt, Args&&... args)
+        {
+            StringFormatTo(Get(), fmt, std::forward<Args>(args)...);
+        }
+
+        void Append(std::string_view text) { Get().append(text); }
+
+        [[nodiscard]] fmt::memory_buffer& Get() { return _shared ? _shared->Buffer : *_own; }
+        [[nodiscard]] std::string_view View() { return { Get().data(), Get().size() }; }
+
+    private:
+        Impl::ThreadFormatBuffer* _shared = nullptr;
+        Optional<fmt::memory_buffer> _own;
+    };
+
     /// Returns true if the given char pointer is null.
     inline bool IsFormatEmptyOrNull(char const* fmt)
     {
@@ -131,19 +131,20 @@ Milliseconds TaskScheduler::GetNextGroupOccurrence(group_t const group) const
 
 void TaskScheduler::TaskQueue::Push(TaskContainer&& task)
 {
-    container.insert(task);
+    timepoint_t const end = task->_end;
+    container.push(end, std::move(task));
 }
 
 auto TaskScheduler::TaskQueue::Pop() -> TaskContainer
 {
-    TaskContainer result = *container.begin();
-    container.erase(container.begin());
+    TaskContainer result = container.top().Item;
+    container.pop();
     return result;
 }
 
 auto TaskScheduler::TaskQueue::First() const -> TaskContainer const&
 {
-    return *container.begin();
+    return container.top().Item;
 }
 
 void TaskScheduler::TaskQueue::Clear()
@@ -153,39 +154,26 @@ void TaskScheduler::TaskQueue::Clear()
 
 void TaskScheduler::TaskQueue::RemoveIf(std::function<bool(TaskContainer const&)> const& filter)
 {
-    for (auto itr = container.begin(); itr != container.end();)
-        if (filter(*itr))
-        {
-            itr = container.erase(itr);
-        }
-        else
-        {
-            ++itr;
-        }
+    std::vector<Entry> removed;
+    container.extract_if([&filter](Entry const& entry) { return filter(entry.Item); }, removed);
 }
 
 void TaskScheduler::TaskQueue::ModifyIf(std::function<bool(TaskContainer const&)> const& filter)
 {
-    std::vector<TaskContainer> cache;
-    for (auto itr = container.begin(); itr != container.end();)
-        if (filter(*itr))
-        {
-            cache.push_back(*itr);
-            itr = container.erase(itr);
-        }
-        else
-        {
-            ++itr;
-        }
+    std::vector<Entry> modified;
+    container.extract_if([&filter](Entry const& entry) { return filter(entry.Item); }, modified);
 
-    container.insert(cache.begin(), cache.end());
+    // Modified tasks are queued after the tasks already ending at the same time,
+    // in the order they had before.
+    for (Entry& entry : modified)
+        Push(std::move(entry.Item));
 }
 
 bool TaskScheduler::TaskQueue::IsGroupQueued(group_t const group)
 {
-    for (auto const& task : container)
+    for (auto const& entry : container)
     {
-        if (task->IsInGroup(group))
+        if (entry.Item->IsInGroup(group))
         {
             return true;
         }
@@ -197,9 +185,9 @@ bool TaskScheduler::TaskQueue::IsGroupQueued(group_t const group)
 TaskScheduler::timepoint_t TaskScheduler::TaskQueue::GetNextGroupOccurrence(group_t const group) const
 {
     TaskScheduler::timepoint_t next = TaskScheduler::timepoint_t::max();
-    for (auto const& task : container)
-        if (task->IsInGroup(group) && task->_end < next)
-            next = task->_end;
+    for (auto const& entry : container)
+        if (entry.Item->IsInGroup(group) && entry.DueTime < next)
+            next = entry.DueTime;
     return next;
 }
 
@@ -274,7 +262,7 @@ void TaskContext::AssertOnConsumed() const
 {
     // This was adapted to TC to prevent static analysis tools from complaining.
     // If you encounter this assertion check if you repeat a TaskContext more then 1 time!
-    ASSERT(!(*_consumed) && "Bad task logic, task context was consumed already!");
+    ASSERT(_task && _task->_invocation == _invocation && "Bad task logic, task context was consumed already!");
 }
 
 void TaskContext::Invoke()
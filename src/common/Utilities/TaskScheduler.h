@@ -18,12 +18,15 @@
 #ifndef _TASK_SCHEDULER_H_
 #define _TASK_SCHEDULER_H_
 
+#include "ObjectPool.h"
+#include "TickClock.h"
+#include "TimerHeap.h"
 #include "Util.h"
 #include <chrono>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <queue>
-#include <set>
 #include <vector>
 
 class TaskContext;
@@ -45,8 +48,8 @@ class TaskScheduler
 {
     friend class TaskContext;
 
-    // Time definitions (use steady clock)
-    typedef std::chrono::steady_clock clock_t;
+    // Time definitions (use the steady time of the current world tick)
+    typedef Acore::TickClock clock_t;
     typedef clock_t::time_point timepoint_t;
     typedef clock_t::duration duration_t;
 
@@ -70,17 +73,20 @@ class TaskScheduler
         duration_t _duration;
         std::optional<group_t> _group;
         repeated_t _repeated;
+        /// Number of times the task was handed to a context, a context is
+        /// consumed once the task was handed out again or repeated.
+        uint32 _invocation;
         task_handler_t _task;
 
     public:
         // All Argument construct
         Task(timepoint_t const& end, duration_t const& duration, std::optional<group_t> const& group,
-             repeated_t const repeated, task_handler_t const& task)
-            : _end(end), _duration(duration), _group(group), _repeated(repeated), _task(task) { }
+             repeated_t const repeated, task_handler_t&& task)
+            : _end(end), _duration(duration), _group(group), _repeated(repeated), _invocation(0), _task(std::move(task)) { }
 
         // Minimal Argument construct
-        Task(timepoint_t const& end, duration_t const& duration, task_handler_t const& task)
-            : _end(end), _duration(duration), _group(std::nullopt), _repeated(0), _task(task) { }
+        Task(timepoint_t const& end, duration_t const& duration, task_handler_t&& task)
+            : _end(end), _duration(duration), _group(std::nullopt), _repeated(0), _invocation(0), _task(std::move(task)) { }
 
         // Copy construct
         Task(Task const&) = delete;
@@ -118,17 +124,14 @@ class TaskScheduler
     typedef std::shared_ptr<Task> TaskContainer;
 
     /// Container which provides Task order, insert and reschedule operations.
-    struct Compare
-    {
-        bool operator() (TaskContainer const& left, TaskContainer const& right) const
-        {
-            return (*left.get()) < (*right.get());
-        };
-    };
-
+    /// Tasks are kept in a heap keyed by their end, a repeated task goes back
+    /// into the heap without any allocation once the heap has grown.
     class TaskQueue
     {
-        std::multiset<TaskContainer, Compare> container;
+        typedef Acore::TimerHeap<timepoint_t, TaskContainer> TaskHeap;
+        typedef TaskHeap::Entry Entry;
+
+        TaskHeap container;
 
     public:
         // Pushes the task in the container
@@ -230,27 +233,27 @@ public:
     /// Never call this from within a task context! Use TaskContext::Schedule instead!
     template<class _Rep, class _Period>
     TaskScheduler& Schedule(std::chrono::duration<_Rep, _Period> const& time,
-                            task_handler_t const& task)
+                            task_handler_t task)
     {
-        return ScheduleAt(_now, time, task);
+        return ScheduleAt(_now, time, std::move(task));
     }
 
     /// Schedule an event with a fixed rate.
     /// Never call this from within a task context! Use TaskContext::Schedule instead!
     template<class _Rep, class _Period>
     TaskScheduler& Schedule(std::chrono::duration<_Rep, _Period> const& time,
-                            group_t const group, task_handler_t const& task)
+                            group_t const group, task_handler_t task)
     {
-        return ScheduleAt(_now, time, group, task);
+        return ScheduleAt(_now, time, group, std::move(task));
     }
 
     /// Schedule an event with a randomized rate between min and max rate.
     /// Never call this from within a task context! Use TaskContext::Schedule instead!
     template<class _RepLeft, class _PeriodLeft, class _RepRight, class _PeriodRight>
     TaskScheduler& Schedule(std::chrono::duration<_RepLeft, _PeriodLeft> const& min,
-                            std::chrono::duration<_RepRight, _PeriodRight> const& max, task_handler_t const& task)
+                            std::chrono::duration<_RepRight, _PeriodRight> const& max, task_handler_t task)
     {
-        return Schedule(RandomDurationBetween(min, max), task);
+        return Schedule(RandomDurationBetween(min, max), std::move(task));
     }
 
     /// Schedule an event with a fixed rate.
@@ -258,9 +261,9 @@ public:
     template<class _RepLeft, class _PeriodLeft, class _RepRight, class _PeriodRight>
     TaskScheduler& Schedule(std::chrono::duration<_RepLeft, _PeriodLeft> const& min,
                             std::chrono::duration<_RepRight, _PeriodRight> const& max, group_t const group,
-                            task_handler_t const& task)
+                            task_handler_t task)
     {
-        return Schedule(RandomDurationBetween(min, max), group, task);
+        return Schedule(RandomDurationBetween(min, max), group, std::move(task));
     }
 
     /// Cancels all tasks.
@@ -383,11 +386,18 @@ private:
     /// Insert a new task to the enqueued tasks.
     TaskScheduler& InsertTask(TaskContainer task);
 
+    /// Creates a task, the task and its reference count share one block taken from a pool.
+    template<class... Args>
+    static TaskContainer MakeTask(Args&&... args)
+    {
+        return std::allocate_shared<Task>(Acore::PoolAllocator<Task>(), std::forward<Args>(args)...);
+    }
+
     template<class _Rep, class _Period>
     TaskScheduler& ScheduleAt(timepoint_t const& end,
-                              std::chrono::duration<_Rep, _Period> const& time, task_handler_t const& task)
+                              std::chrono::duration<_Rep, _Period> const& time, task_handler_t&& task)
     {
-        return InsertTask(TaskContainer(new Task(end + time, time, task)));
+        return InsertTask(MakeTask(end + time, time, std::move(task)));
     }
 
     /// Schedule an event with a fixed rate.
@@ -395,10 +405,10 @@ private:
     template<class _Rep, class _Period>
     TaskScheduler& ScheduleAt(timepoint_t const& end,
                               std::chrono::duration<_Rep, _Period> const& time,
-                              group_t const group, task_handler_t const& task)
+                              group_t const group, task_handler_t&& task)
     {
         static repeated_t const DEFAULT_REPEATED = 0;
-        return InsertTask(TaskContainer(new Task(end + time, time, group, DEFAULT_REPEATED, task)));
+        return InsertTask(MakeTask(end + time, time, group, DEFAULT_REPEATED, std::move(task)));
     }
 
     // Returns a random duration between min and max
@@ -427,8 +437,9 @@ class TaskContext
     /// Owner
     std::weak_ptr<TaskScheduler> _owner;
 
-    /// Marks the task as consumed
-    std::shared_ptr<bool> _consumed;
+    /// Invocation of the task this context belongs to, the context is
+    /// consumed once the task moved on to another invocation.
+    uint32 _invocation;
 
     /// Dispatches an action safe on the TaskScheduler
     TaskContext& Dispatch(std::function<TaskScheduler&(TaskScheduler&)> const& apply);
@@ -436,26 +447,26 @@ class TaskContext
 public:
     // Empty constructor
     TaskContext()
-        : _task(), _owner(), _consumed(std::make_shared<bool>(true)) { }
+        : _task(), _owner(), _invocation(0) { }
 
     // Construct from task and owner
     explicit TaskContext(TaskScheduler::TaskContainer&& task, std::weak_ptr<TaskScheduler>&& owner)
-        : _task(task), _owner(owner), _consumed(std::make_shared<bool>(false)) { }
+        : _task(std::move(task)), _owner(std::move(owner)), _invocation(++_task->_invocation) { }
 
     // Copy construct
     TaskContext(TaskContext const& right)
-        : _task(right._task), _owner(right._owner), _consumed(right._consumed) { }
+        : _task(right._task), _owner(right._owner), _invocation(right._invocation) { }
 
     // Move construct
     TaskContext(TaskContext&& right) noexcept
-        : _task(std::move(right._task)), _owner(std::move(right._owner)), _consumed(std::move(right._consumed)) { }
+        : _task(std::move(right._task)), _owner(std::move(right._owner)), _invocation(right._invocation) { }
 
     // Copy assign
     TaskContext& operator= (TaskContext const& right) noexcept
     {
         _task = right._task;
         _owner = right._owner;
-        _consumed = right._consumed;
+        _invocation = right._invocation;
         return *this;
     }
 
@@ -464,7 +475,7 @@ public:
     {
         _task = std::move(right._task);
         _owner = std::move(right._owner);
-        _consumed = std::move(right._consumed);
+        _invocation = right._invocation;
         return *this;
     }
 
@@ -498,8 +509,13 @@ public:
         _task->_duration = duration;
         _task->_end += duration;
         _task->_repeated += 1;
-        (*_consumed) = true;
-        return Dispatch(std::bind(&TaskScheduler::InsertTask, std::placeholders::_1, _task));
+        ++_task->_invocation;
+
+        // The same task goes back into the queue, only the call is dispatched.
+        return Dispatch([this](TaskScheduler& scheduler) -> TaskScheduler&
+        {
+            return scheduler.InsertTask(_task);
+        });
     }
 
     /// Repeats the event with the same duration.
@@ -531,12 +547,12 @@ public:
     /// which will be called at the next update tick.
     template<class _Rep, class _Period>
     TaskContext& Schedule(std::chrono::duration<_Rep, _Period> const& time,
-                          TaskScheduler::task_handler_t const& task)
+                          TaskScheduler::task_handler_t task)
     {
         auto const end = _task->_end;
-        return Dispatch([end, time, task](TaskScheduler & scheduler) -> TaskScheduler &
+        return Dispatch([&end, &time, &task](TaskScheduler & scheduler) -> TaskScheduler &
         {
-            return scheduler.ScheduleAt<_Rep, _Period>(end, time, task);
+            return scheduler.ScheduleAt<_Rep, _Period>(end, time, std::move(task));
         });
     }
 
@@ -546,12 +562,12 @@ public:
     /// which will be called at the next update tick.
     template<class _Rep, class _Period>
     TaskContext& Schedule(std::chrono::duration<_Rep, _Period> const& time,
-                          TaskScheduler::group_t const group, TaskScheduler::task_handler_t const& task)
+                          TaskScheduler::group_t const group, TaskScheduler::task_handler_t task)
     {
         auto const end = _task->_end;
-        return Dispatch([end, time, group, task](TaskScheduler & scheduler) -> TaskScheduler &
+        return Dispatch([&end, &time, group, &task](TaskScheduler & scheduler) -> TaskScheduler &
         {
-            return scheduler.ScheduleAt<_Rep, _Period>(end, time, group, task);
+            return scheduler.ScheduleAt<_Rep, _Period>(end, time, group, std::move(task));
         });
     }
 
@@ -561,9 +577,9 @@ public:
     /// which will be called at the next update tick.
     template<class _RepLeft, class _PeriodLeft, class _RepRight, class _PeriodRight>
     TaskContext& Schedule(std::chrono::duration<_RepLeft, _PeriodLeft> const& min,
-                          std::chrono::duration<_RepRight, _PeriodRight> const& max, TaskScheduler::task_handler_t const& task)
+                          std::chrono::duration<_RepRight, _PeriodRight> const& max, TaskScheduler::task_handler_t task)
     {
-        return Schedule(TaskScheduler::RandomDurationBetween(min, max), task);
+        return Schedule(TaskScheduler::RandomDurationBetween(min, max), std::move(task));
     }
 
     /// Schedule an event with a randomized rate between min and max rate from within the context.
@@ -573,9 +589,9 @@ public:
     template<class _RepLeft, class _PeriodLeft, class _RepRight, class _PeriodRight>
     TaskContext& Schedule(std::chrono::duration<_RepLeft, _PeriodLeft> const& min,
                           std::chrono::duration<_RepRight, _PeriodRight> const& max, TaskScheduler::group_t const group,
-                          TaskScheduler::task_handler_t const& task)
+                          TaskScheduler::task_handler_t task)
     {
-        return Schedule(TaskScheduler::RandomDurationBetween(min, max), group, task);
+        return Schedule(TaskScheduler::RandomDurationBetween(min, max), group, std::move(task));
     }
 
     /// Cancels all tasks from within the context.
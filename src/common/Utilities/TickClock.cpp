@@ -15,26 +15,6 @@
  * with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
-#ifndef LOGOPERATION_H
-#define LOGOPERATION_H
+#include "TickClock.h"
 
-#include <memory>
-
-class Logger;
-struct LogMessage;
-
-class LogOperation
-{
-public:
-    LogOperation(Logger const* _logger, std::unique_ptr<LogMessage>&& _msg);
-
-    ~LogOperation();
-
-    int call();
-
-protected:
-    Logger const* logger;
-    std::unique_ptr<LogMessage> msg;
-};
-
-#endif
+std::atomic<Acore::TickClock::rep> Acore::TickClock::_now{ 0 };
@@ -0,0 +1,62 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_TICK_CLOCK_H
+#define ACORE_TICK_CLOCK_H
+
+#include "Define.h"
+#include <atomic>
+#include <chrono>
+
+namespace Acore
+{
+    /*
+     * steady_clock compatible clock returning the time point of the current
+     * world tick instead of asking the OS.
+     *
+     * The world sets it once per tick, so the map and session updates of the
+     * tick all see the same now(). Until the first Update, and in processes
+     * which never update it, now() is steady_clock::now().
+     */
+    class AC_COMMON_API TickClock
+    {
+    public:
+        using duration = std::chrono::steady_clock::duration;
+        using rep = duration::rep;
+        using period = duration::period;
+        using time_point = std::chrono::steady_clock::time_point;
+        static constexpr bool is_steady = true;
+
+        static time_point now() noexcept
+        {
+            if (rep const ticks = _now.load(std::memory_order_relaxed))
+                return time_point(duration(ticks));
+
+            return std::chrono::steady_clock::now();
+        }
+
+        static void Update(time_point now) noexcept
+        {
+            _now.store(now.time_since_epoch().count(), std::memory_order_relaxed);
+        }
+
+    private:
+        static std::atomic<rep> _now;
+    };
+}
+
+#endif
@@ -0,0 +1,119 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_TIMER_HEAP_H
+#define ACORE_TIMER_HEAP_H
+
+#include "Define.h"
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+namespace Acore
+{
+    /*
+     * Queue of values ordered by their due time, kept as a binary min-heap in
+     * one vector, so scheduling allocates only when the vector grows. Values
+     * due at the same time leave the queue in the order they were pushed, as
+     * they would from a std::multimap keyed by time.
+     *
+     * Iteration visits the values in heap order, not in time order.
+     */
+    template<class Time, class Value>
+    class TimerHeap
+    {
+    public:
+        struct Entry
+        {
+            Time DueTime;
+            uint64 Sequence;
+            Value Item;
+        };
+
+        using iterator = typename std::vector<Entry>::iterator;
+        using const_iterator = typename std::vector<Entry>::const_iterator;
+
+        iterator begin() { return _entries.begin(); }
+        iterator end() { return _entries.end(); }
+        const_iterator begin() const { return _entries.begin(); }
+        const_iterator end() const { return _entries.end(); }
+
+        [[nodiscard]] bool empty() const { return _entries.empty(); }
+        [[nodiscard]] std::size_t size() const { return _entries.size(); }
+
+        void clear() { _entries.clear(); }
+
+        void push(Time dueTime, Value item)
+        {
+            _entries.push_back({ dueTime, _nextSequence++, std::move(item) });
+            std::push_heap(_entries.begin(), _entries.end(), &Later);
+        }
+
+        // entry due first
+        [[nodiscard]] Entry const& top() const { return _entries.front(); }
+
+        void pop()
+        {
+            std::pop_heap(_entries.begin(), _entries.end(), &Later);
+            _entries.pop_back();
+        }
+
+        // moves the entries matching pred to the end of out, ordered by due time
+        template<class Pred>
+        void extract_if(Pred pred, std::vector<Entry>& out)
+        {
+            auto itr = std::partition(_entries.begin(), _entries.end(), [&pred](Entry const& entry) { return !pred(entry); });
+            if (itr == _entries.end())
+                return;
+
+            std::size_t const first = out.size();
+            out.insert(out.end(), std::make_move_iterator(itr), std::make_move_iterator(_entries.end()));
+            _entries.erase(itr, _entries.end());
+            std::make_heap(_entries.begin(), _entries.end(), &Later);
+            std::sort(out.begin() + first, out.end(), [](Entry const& left, Entry const& right) { return Later(right, left); });
+        }
+
+        // gives the entry a new due time, it then leaves after the entries already due at that time
+        void reschedule(iterator itr, Time dueTime)
+        {
+            itr->DueTime = dueTime;
+            itr->Sequence = _nextSequence++;
+            std::make_heap(_entries.begin(), _entries.end(), &Later);
+        }
+
+        // puts back entries taken by extract_if, keeping their place among entries due at the same time
+        void restore(std::vector<Entry>& entries)
+        {
+            if (entries.empty())
+                return;
+
+            _entries.insert(_entries.end(), std::make_move_iterator(entries.begin()), std::make_move_iterator(entries.end()));
+            std::make_heap(_entries.begin(), _entries.end(), &Later);
+        }
+
+    private:
+        static bool Later(Entry const& left, Entry const& right)
+        {
+            return std::tie(left.DueTime, left.Sequence) > std::tie(right.DueTime, right.Sequence);
+        }
+
+        std::vector<Entry> _entries;
+        uint64 _nextSequence = 0;
+    };
+}
+
+#endif
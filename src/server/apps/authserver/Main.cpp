@@ -24,6 +24,7 @@
 */
 
 #include "AppenderDB.h"
+#include "AuthCryptoPool.h"
 #include "AuthSocketMgr.h"
 #include "Banner.h"
 #include "Config.h"
@@ -33,6 +34,7 @@
 #include "IPLocation.h"
 #include "IoContext.h"
 #include "Log.h"
+#include "Metric.h"
 #include "MySQLThreading.h"
 #include "OpenSSLCrypto.h"
 #include "ProcessPriority.h"
@@ -136,7 +138,7 @@ int main(int argc, char** argv)
 
     std::shared_ptr<void> sRealmListHandle(nullptr, [](void*) { sRealmList->Close(); });
 
-    if (sRealmList->GetRealms().empty())
+    if (sRealmList->GetRealms()->empty())
     {
         LOG_ERROR("server.authserver", "No valid realms specified.");
         return 1;
@@ -159,6 +161,22 @@ int main(int argc, char** argv)
 
     std::string bindIp = sConfigMgr->GetOption<std::string>("BindIP", "0.0.0.0");
 
+    sMetric->Initialize("authserver", *ioContext, []()
+    {
+        METRIC_VALUE("auth_crypto_queue", uint64(sAuthCryptoPool->GetQueueSize()));
+        METRIC_VALUE("auth_crypto_rejected", sAuthCryptoPool->GetRejectedCount());
+        METRIC_VALUE("db_queue_login", uint64(LoginDatabase.QueueSize()));
+    });
+
+    std::shared_ptr<void> sMetricHandle(nullptr, [](void*) { sMetric->Unload(); });
+
+    // Stopped after the network, sessions never wait on a job of a stopped pool
+    sAuthCryptoPool->Start(sConfigMgr->GetOption<uint32>("AuthCrypto.Threads", 2),
+        sConfigMgr->GetOption<uint32>("AuthCrypto.MaxQueueSize", 1000),
+        sConfigMgr->GetOption<uint32>("AuthCrypto.MaxPendingPerIP", 4));
+
+    std::shared_ptr<void> sAuthCryptoPoolHandle(nullptr, [](void*) { sAuthCryptoPool->Stop(); });
+
     if (!sAuthSocketMgr.StartNetwork(*ioContext, bindIp, port))
     {
         LOG_ERROR("server.authserver", "Failed to initialize network");
@@ -0,0 +1,136 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AuthCryptoPool.h"
+#include "Log.h"
+#include "Metric.h"
+
+AuthCryptoPool* AuthCryptoPool::instance()
+{
+    static AuthCryptoPool instance;
+    return &instance;
+}
+
+void AuthCryptoPool::Start(uint32 numThreads, uint32 maxQueueSize, uint32 maxPendingPerAddress)
+{
+    _maxQueueSize = maxQueueSize;
+    _maxPendingPerAddress = maxPendingPerAddress;
+
+    _workerThreads.reserve(numThreads);
+    for (uint32 i = 0; i < numThreads; ++i)
+        _workerThreads.push_back(std::thread(&AuthCryptoPool::WorkerThread, this));
+
+    if (numThreads)
+        LOG_INFO("server.authserver", "Started {} crypto worker threads.", numThreads);
+}
+
+void AuthCryptoPool::Stop()
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _stopping = true;
+    }
+
+    _condition.notify_all();
+
+    for (auto& thread : _workerThreads)
+        if (thread.joinable())
+            thread.join();
+
+    _workerThreads.clear();
+
+    // the network is stopped first, no session waits on the jobs left behind
+    std::lock_guard<std::mutex> guard(_lock);
+    _queue.clear();
+    _pendingByAddress.clear();
+}
+
+Optional<std::future<void>> AuthCryptoPool::Enqueue(std::string const& address, Job&& job)
+{
+    std::packaged_task<void()> work(std::move(job));
+    std::future<void> result = work.get_future();
+
+    if (_workerThreads.empty())
+    {
+        work();
+        return result;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        uint32& pending = _pendingByAddress[address];
+        if (_stopping || (_maxQueueSize && _queue.size() >= _maxQueueSize) || (_maxPendingPerAddress && pending >= _maxPendingPerAddress))
+        {
+            if (!pending)
+                _pendingByAddress.erase(address);
+
+            ++_rejected;
+            LOG_DEBUG("server.authserver", "[AuthCryptoPool] Refused crypto job of '{}', {} jobs queued, {} pending for the address", address, _queue.size(), pending);
+            return {};
+        }
+
+        ++pending;
+        _queue.push_back({ std::move(work), address, std::chrono::steady_clock::now() });
+    }
+
+    _condition.notify_one();
+    return result;
+}
+
+std::size_t AuthCryptoPool::GetQueueSize() const
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    return _queue.size();
+}
+
+uint64 AuthCryptoPool::GetRejectedCount() const
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    return _rejected;
+}
+
+void AuthCryptoPool::Release(std::string const& address)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    auto itr = _pendingByAddress.find(address);
+    if (itr != _pendingByAddress.end() && !--itr->second)
+        _pendingByAddress.erase(itr);
+}
+
+void AuthCryptoPool::WorkerThread()
+{
+    while (true)
+    {
+        Task task;
+
+        {
+            std::unique_lock<std::mutex> guard(_lock);
+            _condition.wait(guard, [this] { return _stopping || !_queue.empty(); });
+
+            if (_stopping)
+                break;
+
+            task = std::move(_queue.front());
+            _queue.pop_front();
+        }
+
+        METRIC_VALUE("auth_crypto_wait_time", std::chrono::nanoseconds(std::chrono::steady_clock::now() - task.QueueTime));
+
+        task.Work();
+        Release(task.Address);
+    }
+}
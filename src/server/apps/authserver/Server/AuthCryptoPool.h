@@ -0,0 +1,105 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef AuthCryptoPool_h__
+#define AuthCryptoPool_h__
+
+#include "Define.h"
+#include "Optional.h"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Worker threads running the modular exponentiations of the SRP6 logon
+ * (AuthCrypto.Threads), so a burst of logons doesn't stall the network
+ * thread serving every other connection.
+ *
+ * Jobs only touch the state they capture, their completion is handed back
+ * to the session through an AuthCryptoCallback polled in its Update().
+ * Enqueue refuses jobs when the queue is full (AuthCrypto.MaxQueueSize) or
+ * when the address already has too many jobs pending (AuthCrypto.MaxPendingPerIP).
+ */
+class AuthCryptoPool
+{
+public:
+    typedef std::function<void()> Job;
+
+    static AuthCryptoPool* instance();
+
+    void Start(uint32 numThreads, uint32 maxQueueSize, uint32 maxPendingPerAddress);
+    void Stop();
+
+    // Queues the job, or runs it right away without worker threads. Returns nothing when the job is refused.
+    Optional<std::future<void>> Enqueue(std::string const& address, Job&& job);
+
+    [[nodiscard]] std::size_t GetQueueSize() const;
+    [[nodiscard]] uint64 GetRejectedCount() const;
+
+private:
+    struct Task
+    {
+        std::packaged_task<void()> Work;
+        std::string Address;
+        std::chrono::steady_clock::time_point QueueTime;
+    };
+
+    void WorkerThread();
+    void Release(std::string const& address);
+
+    mutable std::mutex _lock;
+    std::condition_variable _condition;
+    std::deque<Task> _queue;
+    std::unordered_map<std::string, uint32> _pendingByAddress;
+    std::vector<std::thread> _workerThreads;
+    uint32 _maxQueueSize = 0;
+    uint32 _maxPendingPerAddress = 0;
+    uint64 _rejected = 0;
+    bool _stopping = false;
+};
+
+#define sAuthCryptoPool AuthCryptoPool::instance()
+
+// Runs the continuation of a crypto job on the session thread once the job is done
+class AuthCryptoCallback
+{
+public:
+    AuthCryptoCallback(std::future<void>&& result, std::function<void()>&& callback) : _result(std::move(result)), _callback(std::move(callback)) { }
+
+    bool InvokeIfReady()
+    {
+        if (_result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            return false;
+
+        _result.get();
+        _callback();
+        return true;
+    }
+
+private:
+    std::future<void> _result;
+    std::function<void()> _callback;
+};
+
+#endif // AuthCryptoPool_h__
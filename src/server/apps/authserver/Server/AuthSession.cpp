@@ -31,6 +31,7 @@
 #include "TOTP.h"
 #include "Util.h"
 #include <boost/lexical_cast.hpp>
+#include <mutex>
 
 using boost::asio::ip::tcp;
 
@@ -119,6 +120,78 @@ std::array<uint8, 16> VersionChallenge = { { 0xBA, 0xA3, 0x1E, 0x99, 0xA0, 0x0B,
 #define AUTH_LOGON_CHALLENGE_INITIAL_SIZE 4
 #define REALM_LIST_PACKET_SIZE 5
 
+namespace
+{
+    // Part of a realm list entry which only depends on the client build
+    struct PreparedRealm
+    {
+        Realm const* Info;
+        uint8 Flags;
+        std::string Name;
+        RealmBuildInfo const* BuildInfo;
+    };
+
+    // Realm list entries for one client build, prepared once per realm list refresh
+    struct PreparedRealmList
+    {
+        std::shared_ptr<RealmList::RealmMap const> Realms;
+        std::vector<PreparedRealm> Entries;
+    };
+
+    std::mutex PreparedRealmListsLock;
+    std::unordered_map<uint32, std::shared_ptr<PreparedRealmList const>> PreparedRealmLists;
+
+    std::shared_ptr<PreparedRealmList> PrepareRealmList(std::shared_ptr<RealmList::RealmMap const> realms, uint32 build, uint8 expversion)
+    {
+        std::shared_ptr<PreparedRealmList> realmList = std::make_shared<PreparedRealmList>();
+        realmList->Realms = std::move(realms);
+
+        for (auto const& [realmHandle, realm] : *realmList->Realms)
+        {
+            // don't work with realms which not compatible with the client
+            bool okBuild = ((expversion & POST_BC_EXP_FLAG) && realm.Build == build) || ((expversion & PRE_BC_EXP_FLAG) && !AuthHelper::IsPreBCAcceptedClientBuild(realm.Build));
+
+            // No SQL injection. id of realm is controlled by the database.
+            uint32 flag = realm.Flags;
+            RealmBuildInfo const* buildInfo = sRealmList->GetBuildInfo(realm.Build);
+            if (!okBuild)
+            {
+                if (!buildInfo)
+                    continue;
+
+                flag |= REALM_FLAG_OFFLINE | REALM_FLAG_SPECIFYBUILD;   // tell the client what build the realm is for
+            }
+
+            if (!buildInfo)
+                flag &= ~REALM_FLAG_SPECIFYBUILD;
+
+            std::string name = realm.Name;
+            if (expversion & PRE_BC_EXP_FLAG && flag & REALM_FLAG_SPECIFYBUILD)
+            {
+                std::ostringstream ss;
+                ss << name << " (" << buildInfo->MajorVersion << '.' << buildInfo->MinorVersion << '.' << buildInfo->BugfixVersion << ')';
+                name = ss.str();
+            }
+
+            realmList->Entries.push_back({ &realm, uint8(flag), std::move(name), buildInfo });
+        }
+
+        return realmList;
+    }
+
+    std::shared_ptr<PreparedRealmList const> GetPreparedRealmList(uint32 build, uint8 expversion)
+    {
+        std::shared_ptr<RealmList::RealmMap const> realms = sRealmList->GetRealms();
+
+        std::lock_guard<std::mutex> guard(PreparedRealmListsLock);
+        std::shared_ptr<PreparedRealmList const>& realmList = PreparedRealmLists[build];
+        if (!realmList || realmList->Realms != realms)
+            realmList = PrepareRealmList(std::move(realms), build, expversion);
+
+        return realmList;
+    }
+}
+
 std::unordered_map<uint8, AuthHandler> AuthSession::InitHandlers()
 {
     std::unordered_map<uint8, AuthHandler> handlers;
@@ -182,7 +255,18 @@ bool AuthSession::Update()
         return false;
 
     _queryProcessor.ProcessReadyCallbacks();
+    _cryptoProcessor.ProcessReadyCallbacks();
+
+    return true;
+}
 
+bool AuthSession::QueueCryptoJob(AuthCryptoPool::Job&& job, std::function<void()>&& callback)
+{
+    Optional<std::future<void>> result = sAuthCryptoPool->Enqueue(GetRemoteIpAddress().to_string(), std::move(job));
+    if (!result)
+        return false;
+
+    _cryptoProcessor.AddCallback(AuthCryptoCallback(std::move(*result), std::move(callback)));
     return true;
 }
 
@@ -405,9 +489,32 @@ void AuthSession::LogonChallengeCallback(PreparedQueryResult result)
         }
     }
 
-    _srp6.emplace(_accountInfo.Login,
-        fields[12].Get<Binary, Acore::Crypto::SRP6::SALT_LENGTH>(),
-        fields[13].Get<Binary, Acore::Crypto::SRP6::VERIFIER_LENGTH>());
+    // B = 3v + g^b is a modular exponentiation, leave it to the crypto workers
+    std::shared_ptr<std::shared_ptr<Acore::Crypto::SRP6>> srp6 = std::make_shared<std::shared_ptr<Acore::Crypto::SRP6>>();
+    bool queued = QueueCryptoJob([srp6, login = _accountInfo.Login,
+        salt = fields[12].Get<Binary, Acore::Crypto::SRP6::SALT_LENGTH>(),
+        verifier = fields[13].Get<Binary, Acore::Crypto::SRP6::VERIFIER_LENGTH>()]()
+    {
+        *srp6 = std::make_shared<Acore::Crypto::SRP6>(login, salt, verifier);
+    }, [this, srp6, securityFlags]()
+    {
+        _srp6 = std::move(*srp6);
+        SendLogonChallenge(securityFlags);
+    });
+
+    if (!queued)
+    {
+        pkt << uint8(WOW_FAIL_DB_BUSY);
+        SendPacket(pkt);
+        LOG_DEBUG("server.authserver", "'{}:{}' [AuthChallenge] Too many logons pending, refused account {}", ipAddress, port, _accountInfo.Login);
+    }
+}
+
+void AuthSession::SendLogonChallenge(uint8 securityFlags)
+{
+    ByteBuffer pkt;
+    pkt << uint8(AUTH_LOGON_CHALLENGE);
+    pkt << uint8(0x00);
 
     // Fill the response packet with the result
     if (AuthHelper::IsAcceptedClientBuild(_build))
@@ -442,7 +549,7 @@ void AuthSession::LogonChallengeCallback(PreparedQueryResult result)
             pkt << uint8(1);
 
         LOG_DEBUG("server.authserver", "'{}:{}' [AuthChallenge] account {} is using '{}' locale ({})",
-            ipAddress, port, _accountInfo.Login, _localizationName, GetLocaleByName(_localizationName));
+            GetRemoteIpAddress().to_string(), GetRemotePort(), _accountInfo.Login, _localizationName, GetLocaleByName(_localizationName));
 
         _status = STATUS_LOGON_PROOF;
     }
@@ -469,21 +576,52 @@ bool AuthSession::HandleLogonProof()
         return false;
     }
 
+    // The token follows the proof in the read buffer, take it before the verification leaves this thread
+    bool sentToken = (logonProof->securityFlags & 0x04);
+    Optional<uint32> incomingToken;
+    if (sentToken && _totpSecret)
+    {
+        uint8 size = *(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C));
+        std::string token(reinterpret_cast<char*>(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C) + sizeof(size)), size);
+        GetReadBuffer().ReadCompleted(sizeof(size) + size);
+
+        incomingToken = Acore::StringTo<uint32>(token);
+    }
+
+    // Check if SRP6 results match (password is correct) on the crypto workers
+    std::shared_ptr<Optional<SessionKey>> K = std::make_shared<Optional<SessionKey>>();
+    bool queued = QueueCryptoJob([srp6 = _srp6, K, A = logonProof->A, clientM = logonProof->clientM]()
+    {
+        *K = srp6->VerifyChallengeResponse(A, clientM);
+    }, [this, K, A = logonProof->A, clientM = logonProof->clientM, crcHash = logonProof->crc_hash, sentToken, incomingToken]()
+    {
+        LogonProofVerified(*K, A, clientM, crcHash, sentToken, incomingToken);
+    });
+
+    if (!queued)
+    {
+        ByteBuffer packet;
+        packet << uint8(AUTH_LOGON_PROOF);
+        packet << uint8(WOW_FAIL_DB_BUSY);
+        packet << uint16(0);    // LoginFlags, 1 has account message
+        SendPacket(packet);
+    }
+
+    return true;
+}
+
+void AuthSession::LogonProofVerified(Optional<SessionKey> const& K, Acore::Crypto::SRP6::EphemeralKey const& A, Acore::Crypto::SHA1::Digest const& clientM,
+    Acore::Crypto::SHA1::Digest const& crcHash, bool sentToken, Optional<uint32> incomingToken)
+{
     // Check if SRP6 results match (password is correct), else send an error
-    if (Optional<SessionKey> K = _srp6->VerifyChallengeResponse(logonProof->A, logonProof->clientM))
+    if (K)
     {
         _sessionKey = *K;
         // Check auth token
         bool tokenSuccess = false;
-        bool sentToken = (logonProof->securityFlags & 0x04);
         if (sentToken && _totpSecret)
         {
-            uint8 size = *(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C));
-            std::string token(reinterpret_cast<char*>(GetReadBuffer().GetReadPointer() + sizeof(sAuthLogonProof_C) + sizeof(size)), size);
-            GetReadBuffer().ReadCompleted(sizeof(size) + size);
-
-            uint32 incomingToken = *Acore::StringTo<uint32>(token);
-            tokenSuccess = Acore::Crypto::TOTP::ValidateToken(*_totpSecret, incomingToken);
+            tokenSuccess = incomingToken && Acore::Crypto::TOTP::ValidateToken(*_totpSecret, *incomingToken);
             memset(_totpSecret->data(), 0, _totpSecret->size());
         }
         else if (!sentToken && !_totpSecret)
@@ -496,16 +634,16 @@ bool AuthSession::HandleLogonProof()
             packet << uint8(WOW_FAIL_UNKNOWN_ACCOUNT);
             packet << uint16(0);    // LoginFlags, 1 has account message
             SendPacket(packet);
-            return true;
+            return;
         }
 
-        if (!VerifyVersion(logonProof->A.data(), logonProof->A.size(), logonProof->crc_hash, false))
+        if (!VerifyVersion(A.data(), A.size(), crcHash, false))
         {
             ByteBuffer packet;
             packet << uint8(AUTH_LOGON_PROOF);
             packet << uint8(WOW_FAIL_VERSION_INVALID);
             SendPacket(packet);
-            return true;
+            return;
         }
 
         LOG_DEBUG("server.authserver", "'{}:{}' User '{}' successfully authenticated", GetRemoteIpAddress().to_string(), GetRemotePort(), _accountInfo.Login);
@@ -513,6 +651,8 @@ bool AuthSession::HandleLogonProof()
         // Update the sessionkey, last_ip, last login time and reset number of failed logins in the account table for this account
         // No SQL injection (escaped user name) and IP address as received by socket
 
+        LoadCharacterCounts();
+
         std::string address = sConfigMgr->GetOption<bool>("AllowLoggingIPAddressesInDatabase", true, true) ? GetRemoteIpAddress().to_string() : "0.0.0.0";
         LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_LOGONPROOF);
         stmt->SetData(0, _sessionKey);
@@ -521,7 +661,7 @@ bool AuthSession::HandleLogonProof()
         stmt->SetData(3, _os);
         stmt->SetData(4, _accountInfo.Login);
         _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt)
-            .WithPreparedCallback([this, M2 = Acore::Crypto::SRP6::GetSessionVerifier(logonProof->A, logonProof->clientM, _sessionKey)](PreparedQueryResult const&)
+            .WithPreparedCallback([this, M2 = Acore::Crypto::SRP6::GetSessionVerifier(A, clientM, _sessionKey)](PreparedQueryResult const&)
         {
             // Finish SRP6 and send the final result to the client
             ByteBuffer packet;
@@ -614,9 +754,9 @@ bool AuthSession::HandleLogonProof()
         }
     }
 
-    return true;
 }
 
+
 bool AuthSession::HandleReconnectChallenge()
 {
     _status = STATUS_CLOSED;
@@ -706,6 +846,8 @@ bool AuthSession::HandleReconnectProof()
             return true;
         }
 
+        LoadCharacterCounts();
+
         // Sending response
         ByteBuffer pkt;
         pkt << uint8(AUTH_RECONNECT_PROOF);
@@ -727,65 +869,57 @@ bool AuthSession::HandleRealmList()
 {
     LOG_DEBUG("server.authserver", "Entering _HandleRealmList");
 
+    // The character counts are loaded along with the proof, the realm list is sent once they are there
+    _status = STATUS_WAITING_FOR_REALM_LIST;
+    if (_characterCounts)
+        SendRealmList();
+
+    return true;
+}
+
+void AuthSession::LoadCharacterCounts()
+{
     LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_REALM_CHARACTER_COUNTS);
     stmt->SetData(0, _accountInfo.Id);
 
-    _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&AuthSession::RealmListCallback, this, std::placeholders::_1)));
-    _status = STATUS_WAITING_FOR_REALM_LIST;
-    return true;
+    _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&AuthSession::CharacterCountsCallback, this, std::placeholders::_1)));
 }
 
-void AuthSession::RealmListCallback(PreparedQueryResult result)
+void AuthSession::CharacterCountsCallback(PreparedQueryResult result)
 {
-    std::map<uint32, uint8> characterCounts;
+    _characterCounts.emplace();
     if (result)
     {
         do
         {
             Field* fields = result->Fetch();
-            characterCounts[fields[0].Get<uint32>()] = fields[1].Get<uint8>();
+            (*_characterCounts)[fields[0].Get<uint32>()] = fields[1].Get<uint8>();
         } while (result->NextRow());
     }
 
-    // Circle through realms in the RealmList and construct the return packet (including # of user characters in each realm)
+    if (_status == STATUS_WAITING_FOR_REALM_LIST)
+        SendRealmList();
+}
+
+void AuthSession::SendRealmList()
+{
+    // Circle through the realms prepared for this build and construct the return packet (including # of user characters in each realm)
+    std::map<uint32, uint8>& characterCounts = *_characterCounts;
     ByteBuffer pkt;
 
-    std::size_t RealmListSize = 0;
-    for (auto const& [realmHandle, realm] : sRealmList->GetRealms())
+    std::shared_ptr<PreparedRealmList const> realmList = GetPreparedRealmList(_build, _expversion);
+    std::size_t RealmListSize = realmList->Entries.size();
+    for (PreparedRealm const& entry : realmList->Entries)
     {
-        // don't work with realms which not compatible with the client
-        bool okBuild = ((_expversion & POST_BC_EXP_FLAG) && realm.Build == _build) || ((_expversion & PRE_BC_EXP_FLAG) && !AuthHelper::IsPreBCAcceptedClientBuild(realm.Build));
-
-        // No SQL injection. id of realm is controlled by the database.
-        uint32 flag = realm.Flags;
-        RealmBuildInfo const* buildInfo = sRealmList->GetBuildInfo(realm.Build);
-        if (!okBuild)
-        {
-            if (!buildInfo)
-                continue;
-
-            flag |= REALM_FLAG_OFFLINE | REALM_FLAG_SPECIFYBUILD;   // tell the client what build the realm is for
-        }
-
-        if (!buildInfo)
-            flag &= ~REALM_FLAG_SPECIFYBUILD;
-
-        std::string name = realm.Name;
-        if (_expversion & PRE_BC_EXP_FLAG && flag & REALM_FLAG_SPECIFYBUILD)
-        {
-            std::ostringstream ss;
-            ss << name << " (" << buildInfo->MajorVersion << '.' << buildInfo->MinorVersion << '.' << buildInfo->BugfixVersion << ')';
-            name = ss.str();
-        }
-
+        Realm const& realm = *entry.Info;
         uint8 lock = (realm.AllowedSecurityLevel > _accountInfo.SecurityLevel) ? 1 : 0;
 
         pkt << uint8(realm.Type);                           // realm type
         if (_expversion & POST_BC_EXP_FLAG)                 // only 2.x and 3.x clients
             pkt << uint8(lock);                             // if 1, then realm locked
 
-        pkt << uint8(flag);                                 // RealmFlags
-        pkt << name;
+        pkt << uint8(entry.Flags);                          // RealmFlags
+        pkt << entry.Name;
         pkt << boost::lexical_cast<std::string>(realm.GetAddressForClient(GetRemoteIpAddress()));
         pkt << float(realm.PopulationLevel);
         pkt << uint8(characterCounts[realm.Id.Realm]);
@@ -796,15 +930,13 @@ void AuthSession::RealmListCallback(PreparedQueryResult result)
         else
             pkt << uint8(0x0);                              // 1.12.1 and 1.12.2 clients
 
-        if (_expversion & POST_BC_EXP_FLAG && flag & REALM_FLAG_SPECIFYBUILD)
+        if (_expversion & POST_BC_EXP_FLAG && entry.Flags & REALM_FLAG_SPECIFYBUILD)
         {
-            pkt << uint8(buildInfo->MajorVersion);
-            pkt << uint8(buildInfo->MinorVersion);
-            pkt << uint8(buildInfo->BugfixVersion);
-            pkt << uint16(buildInfo->Build);
+            pkt << uint8(entry.BuildInfo->MajorVersion);
+            pkt << uint8(entry.BuildInfo->MinorVersion);
+            pkt << uint8(entry.BuildInfo->BugfixVersion);
+            pkt << uint16(entry.BuildInfo->Build);
         }
-
-        ++RealmListSize;
     }
 
     if (_expversion & POST_BC_EXP_FLAG)                     // 2.x and 3.x clients
@@ -19,6 +19,7 @@
 #define __AUTHSESSION_H__
 
 #include "AsyncCallbackProcessor.h"
+#include "AuthCryptoPool.h"
 #include "BigNumber.h"
 #include "ByteBuffer.h"
 #include "Common.h"
@@ -28,6 +29,8 @@
 #include "SRP6.h"
 #include "Socket.h"
 #include <boost/asio/ip/tcp.hpp>
+#include <map>
+#include <memory>
 
 using boost::asio::ip::tcp;
 
@@ -87,11 +90,18 @@ private:
     void CheckIpCallback(PreparedQueryResult result);
     void LogonChallengeCallback(PreparedQueryResult result);
     void ReconnectChallengeCallback(PreparedQueryResult result);
-    void RealmListCallback(PreparedQueryResult result);
+    void LoadCharacterCounts();
+    void CharacterCountsCallback(PreparedQueryResult result);
+    void SendRealmList();
+
+    bool QueueCryptoJob(AuthCryptoPool::Job&& job, std::function<void()>&& callback);
+    void SendLogonChallenge(uint8 securityFlags);
+    void LogonProofVerified(Optional<SessionKey> const& K, Acore::Crypto::SRP6::EphemeralKey const& A, Acore::Crypto::SHA1::Digest const& clientM,
+        Acore::Crypto::SHA1::Digest const& crcHash, bool sentToken, Optional<uint32> incomingToken);
 
     bool VerifyVersion(uint8 const* a, int32 aLength, Acore::Crypto::SHA1::Digest const& versionProof, bool isReconnect);
 
-    Optional<Acore::Crypto::SRP6> _srp6;
+    std::shared_ptr<Acore::Crypto::SRP6> _srp6;
     SessionKey _sessionKey = {};
     std::array<uint8, 16> _reconnectProof = {};
 
@@ -103,8 +113,10 @@ private:
     std::string _ipCountry;
     uint16 _build;
     uint8 _expversion;
+    Optional<std::map<uint32, uint8>> _characterCounts;
 
     QueryCallbackProcessor _queryProcessor;
+    AsyncCallbackProcessor<AuthCryptoCallback> _cryptoProcessor;
 };
 
 #pragma pack(push, 1)
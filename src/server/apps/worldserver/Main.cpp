@@ -32,8 +32,10 @@
 #include "DatabaseEnv.h"
 #include "DatabaseLoader.h"
 #include "GitRevision.h"
+#include "GuildMgr.h"
 #include "IoContext.h"
 #include "MapMgr.h"
+#include "MapReplay.h"
 #include "Metric.h"
 #include "ModuleMgr.h"
 #include "ModulesScriptLoader.h"
@@ -48,8 +50,10 @@
 #include "ScriptMgr.h"
 #include "SecretMgr.h"
 #include "SharedDefines.h"
+#include "StatementStats.h"
 #include "SteadyTimer.h"
 #include "Systemd.h"
+#include "WardenWorker.h"
 #include "World.h"
 #include "WorldSessionMgr.h"
 #include "WorldSocket.h"
@@ -293,6 +297,10 @@ int main(int argc, char** argv)
         METRIC_VALUE("db_queue_login", uint64(LoginDatabase.QueueSize()));
         METRIC_VALUE("db_queue_character", uint64(CharacterDatabase.QueueSize()));
         METRIC_VALUE("db_queue_world", uint64(WorldDatabase.QueueSize()));
+
+        for (StatementStats* stats : { LoginDatabase.GetStatementStats(), CharacterDatabase.GetStatementStats(), WorldDatabase.GetStatementStats() })
+            if (stats)
+                stats->LogMetrics();
     });
 
     METRIC_EVENT("events", "Worldserver started", "");
@@ -352,26 +360,33 @@ int main(int argc, char** argv)
         return 1;
     }
 
-    if (!sWorldSocketMgr.StartWorldNetwork(*ioContext, worldListener, worldPort, networkThreads))
+    // A map replay runs without network
+    bool const replay = vm.count("replay") > 0;
+
+    if (!replay && !sWorldSocketMgr.StartWorldNetwork(*ioContext, worldListener, worldPort, networkThreads))
     {
         LOG_ERROR("server.worldserver", "Failed to initialize network");
         World::StopNow(ERROR_EXIT_CODE);
         return 1;
     }
 
-    std::shared_ptr<void> sWorldSocketMgrHandle(nullptr, [](void*)
+    std::shared_ptr<void> sWorldSocketMgrHandle(nullptr, [replay](void*)
     {
         sWorldSessionMgr->KickAll();         // save and kick all players
         sWorldSessionMgr->UpdateSessions(1); // real players unload required UpdateSessions call
+        sWardenWorker->Stop();               // jobs of the remaining sessions run on their own thread from now on
+        sGuildMgr->SaveGuildLogs();          // guild logs not saved by the last world update
 
-        sWorldSocketMgr.StopNetwork();
+        if (!replay)
+            sWorldSocketMgr.StopNetwork();
 
         ///- Clean database before leaving
         ClearOnlineAccounts();
     });
 
     // Set server online (allow connecting now)
-    LoginDatabase.DirectExecute("UPDATE realmlist SET flag = flag & ~{}, population = 0 WHERE id = '{}'", REALM_FLAG_VERSION_MISMATCH, realm.Id.Realm);
+    if (!replay)
+        LoginDatabase.DirectExecute("UPDATE realmlist SET flag = flag & ~{}, population = 0 WHERE id = '{}'", REALM_FLAG_VERSION_MISMATCH, realm.Id.Realm);
     realm.PopulationLevel = 0.0f;
     realm.Flags = RealmFlags(realm.Flags & ~uint32(REALM_FLAG_VERSION_MISMATCH));
 
@@ -399,7 +414,13 @@ int main(int argc, char** argv)
         cliThread.reset(new std::thread(CliThread), &ShutdownCLIThread);
     }
 
-    WorldUpdateLoop();
+    if (replay)
+    {
+        std::string const replayReport = vm.count("replay-report") ? vm["replay-report"].as<std::string>() : "";
+        World::StopNow(sMapReplay->Replay(vm["replay"].as<std::string>(), replayReport) ? SHUTDOWN_EXIT_CODE : ERROR_EXIT_CODE);
+    }
+    else
+        WorldUpdateLoop();
 
     // Shutdown starts here
     threadPool.reset();
@@ -567,6 +588,9 @@ void WorldUpdateLoop()
     if (!halfMaxCoreStuckTime)
         halfMaxCoreStuckTime = std::numeric_limits<uint32>::max();
 
+    // after the other thread groups were started, new threads inherit the affinity of the thread starting them
+    SetCurrentThreadAffinity("server.worldserver", sConfigMgr->GetOption<std::string>("WorldThread.Affinity", ""));
+
     LoginDatabase.WarnAboutSyncQueries(true);
     CharacterDatabase.WarnAboutSyncQueries(true);
     WorldDatabase.WarnAboutSyncQueries(true);
@@ -715,7 +739,9 @@ variables_map GetConsoleArguments(int argc, char** argv, fs::path& configFile, [
         ("version,v", "print version build info")
         ("dry-run,d", "Dry run")
         ("config,c", value<fs::path>(&configFile)->default_value(fs::path(sConfigMgr->GetConfigPath() + std::string(_ACORE_CORE_CONFIG))), "use <arg> as configuration file")
-        ("config-policy", value<std::string>()->value_name("policy"), "override config severity policy (e.g. default=skip,critical_option=fatal)");
+        ("config-policy", value<std::string>()->value_name("policy"), "override config severity policy (e.g. default=skip,critical_option=fatal)")
+        ("replay", value<std::string>()->value_name("file"), "replay a map recorded by .debug replay without network, then stop")
+        ("replay-report", value<std::string>()->value_name("file"), "write the update times of every replayed tick to a CSV file");
 
 #if AC_PLATFORM == AC_PLATFORM_WINDOWS
     options_description win("Windows platform specific options");
@@ -30,6 +30,7 @@ public:
     ~BasicStatementTask();
 
     bool Execute() override;
+    [[nodiscard]] bool IsBatchable() const override { return !m_has_result; }
     QueryResultFuture GetFuture() const { return m_result->get_future(); }
 
 private:
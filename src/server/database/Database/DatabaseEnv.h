@@ -27,6 +27,7 @@
 
 #include "PreparedStatement.h"
 #include "QueryCallback.h"
+#include "QueryTask.h"
 #include "Transaction.h"
 
 /// Accessor to the world database
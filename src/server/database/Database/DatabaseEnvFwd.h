@@ -83,6 +83,11 @@ using WorldDatabaseQueryHolder = SQLQueryHolder<WorldDatabaseConnection>;
 
 class SQLQueryHolderCallback;
 
+class QueryTask;
+class QueryAwaiter;
+class PreparedQueryAwaiter;
+class TransactionAwaiter;
+
 // mysql
 struct MySQLHandle;
 struct MySQLResult;
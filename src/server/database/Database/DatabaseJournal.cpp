@@ -0,0 +1,543 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DatabaseJournal.h"
+#include "Duration.h"
+#include "Log.h"
+#include "Metric.h"
+#include "PreparedStatement.h"
+#include <boost/crc.hpp>
+#include <cstring>
+#include <filesystem>
+
+namespace
+{
+    constexpr uint32 JOURNAL_MAGIC = 0x4C4A4341; // "ACJL"
+    constexpr uint32 JOURNAL_VERSION = 1;
+
+    /// Records bigger than this are treated as garbage from a torn write
+    constexpr uint32 MAX_RECORD_SIZE = 64 * 1024 * 1024;
+
+    /// Once everything written is completed and the file grew past this it is emptied
+    constexpr uint64 COMPACT_SIZE = 16 * 1024 * 1024;
+
+    constexpr Milliseconds SPOOL_READER_INTERVAL = 50ms;
+
+    struct JournalHeader
+    {
+        uint32 Magic;
+        uint32 Version;
+        uint64 Completed;
+    };
+
+    struct RecordHeader
+    {
+        uint32 Size;
+        uint32 Checksum;
+        uint64 Sequence;
+    };
+
+    static_assert(sizeof(JournalHeader) == 16 && sizeof(RecordHeader) == 16);
+
+    uint32 GetChecksum(uint64 sequence, std::string_view payload)
+    {
+        boost::crc_32_type crc;
+        crc.process_bytes(&sequence, sizeof(sequence));
+        crc.process_bytes(payload.data(), payload.size());
+        return crc.checksum();
+    }
+
+    class PayloadWriter
+    {
+    public:
+        template <typename T>
+        void Write(T value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            _data.append(reinterpret_cast<char const*>(&value), sizeof(T));
+        }
+
+        void WriteBytes(void const* data, std::size_t size)
+        {
+            Write<uint32>(uint32(size));
+            _data.append(static_cast<char const*>(data), size);
+        }
+
+        std::string Release() { return std::move(_data); }
+
+    private:
+        std::string _data;
+    };
+
+    class PayloadReader
+    {
+    public:
+        explicit PayloadReader(std::string_view data) : _data(data) { }
+
+        template <typename T>
+        bool Read(T& value)
+        {
+            if (_data.size() - _position < sizeof(T))
+                return false;
+
+            std::memcpy(&value, _data.data() + _position, sizeof(T));
+            _position += sizeof(T);
+            return true;
+        }
+
+        bool ReadBytes(std::string_view& value)
+        {
+            uint32 size;
+            if (!Read(size) || _data.size() - _position < size)
+                return false;
+
+            value = _data.substr(_position, size);
+            _position += size;
+            return true;
+        }
+
+    private:
+        std::string_view _data;
+        std::size_t _position{0};
+    };
+}
+
+DatabaseJournal::DatabaseJournal(std::string fileName, std::string_view databaseName) :
+    _fileName(std::move(fileName)),
+    _databaseName(databaseName),
+    _lastSequence(0),
+    _completed(0),
+    _appendOffset(sizeof(JournalHeader)),
+    _readOffset(0),
+    _spooling(false),
+    _stopReader(false)
+{
+}
+
+DatabaseJournal::~DatabaseJournal()
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _stopReader = true;
+    }
+
+    _readerCondition.notify_all();
+    if (_reader.joinable())
+        _reader.join();
+
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_file.is_open())
+        WriteHeader();
+
+    for (SQLOperation* op : _deferred)
+        delete op;
+}
+
+bool DatabaseJournal::Open(std::vector<std::string>& pending)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    std::error_code error;
+    if (!std::filesystem::exists(_fileName, error))
+    {
+        Truncate();
+        return _file.good();
+    }
+
+    _file.open(_fileName, std::ios::in | std::ios::out | std::ios::binary);
+
+    JournalHeader header{};
+    if (!_file.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.Magic != JOURNAL_MAGIC || header.Version != JOURNAL_VERSION)
+    {
+        LOG_ERROR("sql.driver", "Database journal '{}' of '{}' is not readable, its pending writes are lost.", _fileName, _databaseName);
+        Truncate();
+        return _file.good();
+    }
+
+    // a torn record at the end is where the process died while appending, nothing after it was queued
+    uint64 last = header.Completed;
+    std::string payload;
+    uint64 sequence;
+    uint64 offset = sizeof(JournalHeader);
+    while (ReadRecord(offset, payload, sequence, offset))
+    {
+        last = std::max(last, sequence);
+        if (sequence <= header.Completed)
+            continue;
+
+        pending.push_back(payload);
+    }
+
+    if (!pending.empty())
+        LOG_WARN("sql.driver", "Database journal '{}': {} writes to '{}' were not executed before the last shutdown, queueing them again.", _fileName, pending.size(), _databaseName);
+
+    _completed = _lastSequence = last;
+    Truncate();
+    return _file.good();
+}
+
+void DatabaseJournal::StartSpoolReader(std::function<bool()> canQueue, SpoolHandler handler, std::function<void(SQLOperation*)> enqueue)
+{
+    _canQueue = std::move(canQueue);
+    _spoolHandler = std::move(handler);
+    _enqueue = std::move(enqueue);
+    _reader = std::thread(&DatabaseJournal::SpoolReaderThread, this);
+}
+
+void DatabaseJournal::SpoolReaderThread()
+{
+    std::string payload;
+    uint64 sequence;
+
+    std::unique_lock<std::mutex> guard(_lock);
+    while (!_stopReader)
+    {
+        if (!_spooling || !_canQueue())
+        {
+            _readerCondition.wait_for(guard, SPOOL_READER_INTERVAL);
+            continue;
+        }
+
+        if (ReadSpooled(payload, sequence))
+            QueueSpooled(payload, sequence);
+    }
+}
+
+void DatabaseJournal::Drain()
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _stopReader = true;
+    }
+
+    _readerCondition.notify_all();
+    if (_reader.joinable())
+        _reader.join();
+
+    std::string payload;
+    uint64 sequence;
+
+    std::lock_guard<std::mutex> guard(_lock);
+    while (_spooling)
+        if (ReadSpooled(payload, sequence))
+            QueueSpooled(payload, sequence);
+}
+
+void DatabaseJournal::QueueSpooled(std::string const& payload, uint64 sequence)
+{
+    if (!_spoolHandler(payload, sequence))
+        CompleteLocked(sequence);
+}
+
+uint64 DatabaseJournal::Append(std::string_view payload, bool queueFull, bool& spooled)
+{
+    spooled = false;
+
+    std::lock_guard<std::mutex> guard(_lock);
+    if (!_file.is_open())
+        return 0;
+
+    RecordHeader header;
+    header.Size = uint32(payload.size());
+    header.Sequence = _lastSequence + 1;
+    header.Checksum = GetChecksum(header.Sequence, payload);
+
+    _file.seekp(_appendOffset);
+    _file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    _file.write(payload.data(), payload.size());
+    _file.flush();
+
+    if (!_file)
+    {
+        // the next record overwrites whatever part of this one made it to the file
+        LOG_ERROR("sql.driver", "Database journal '{}': could not append a write, it is queued without journal.", _fileName);
+        _file.clear();
+        return 0;
+    }
+
+    uint64 const recordOffset = _appendOffset;
+    _appendOffset += sizeof(header) + payload.size();
+    _lastSequence = header.Sequence;
+
+    if (_spooling || queueFull)
+    {
+        if (!_spooling)
+        {
+            LOG_WARN("sql.driver", "Async queue of '{}' is full, spooling writes to the journal '{}'.", _databaseName, _fileName);
+            METRIC_EVENT("events", "Database spooling", _databaseName);
+
+            _spooling = true;
+            _readOffset = recordOffset;
+        }
+
+        spooled = true;
+        _readerCondition.notify_all();
+    }
+
+    return header.Sequence;
+}
+
+bool DatabaseJournal::DeferIfSpooling(SQLOperation* op)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    if (!_spooling)
+        return false;
+
+    _deferred.push_back(op);
+    return true;
+}
+
+void DatabaseJournal::Complete(uint64 sequence)
+{
+    if (!sequence)
+        return;
+
+    std::lock_guard<std::mutex> guard(_lock);
+    CompleteLocked(sequence);
+}
+
+void DatabaseJournal::CompleteLocked(uint64 sequence)
+{
+    if (sequence != _completed + 1)
+    {
+        _completedOutOfOrder.insert(sequence);
+        return;
+    }
+
+    ++_completed;
+    while (!_completedOutOfOrder.empty() && *_completedOutOfOrder.begin() == _completed + 1)
+    {
+        _completedOutOfOrder.erase(_completedOutOfOrder.begin());
+        ++_completed;
+    }
+
+    if (_completed == _lastSequence && !_spooling && _appendOffset >= COMPACT_SIZE)
+        Truncate();
+    else
+        WriteHeader();
+}
+
+bool DatabaseJournal::ReadRecord(uint64 offset, std::string& payload, uint64& sequence, uint64& nextOffset)
+{
+    RecordHeader header;
+
+    _file.clear();
+    _file.seekg(offset);
+    if (!_file.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.Size > MAX_RECORD_SIZE)
+    {
+        _file.clear();
+        return false;
+    }
+
+    payload.resize(header.Size);
+    if (!_file.read(payload.data(), header.Size) || GetChecksum(header.Sequence, payload) != header.Checksum)
+    {
+        _file.clear();
+        return false;
+    }
+
+    sequence = header.Sequence;
+    nextOffset = offset + sizeof(header) + header.Size;
+    return true;
+}
+
+bool DatabaseJournal::ReadSpooled(std::string& payload, uint64& sequence)
+{
+    if (_readOffset < _appendOffset)
+    {
+        if (ReadRecord(_readOffset, payload, sequence, _readOffset))
+            return true;
+
+        LOG_ERROR("sql.driver", "Database journal '{}': spooled write at offset {} is not readable, the remaining spooled writes are lost.", _fileName, _readOffset);
+        _readOffset = _appendOffset;
+    }
+
+    // spool is empty, everything held back behind it may run now
+    _spooling = false;
+    for (SQLOperation* op : _deferred)
+        _enqueue(op);
+
+    LOG_INFO("sql.driver", "Spooled writes of '{}' are queued again, {} held back operations released.", _databaseName, _deferred.size());
+    _deferred.clear();
+    return false;
+}
+
+void DatabaseJournal::WriteHeader()
+{
+    JournalHeader header{ JOURNAL_MAGIC, JOURNAL_VERSION, _completed };
+
+    _file.seekp(0);
+    _file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    _file.flush();
+    _file.clear();
+}
+
+void DatabaseJournal::Truncate()
+{
+    if (_file.is_open())
+        _file.close();
+
+    _file.open(_fileName, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!_file)
+    {
+        LOG_ERROR("sql.driver", "Database journal '{}' could not be opened, writes to '{}' are not journaled.", _fileName, _databaseName);
+        _file.close();
+        return;
+    }
+
+    _appendOffset = sizeof(JournalHeader);
+    WriteHeader();
+}
+
+std::string DatabaseJournal::Serialize(std::span<SQLElementData const> elements, bool transaction)
+{
+    PayloadWriter writer;
+    writer.Write<uint8>(transaction);
+    writer.Write<uint32>(uint32(elements.size()));
+
+    for (SQLElementData const& element : elements)
+    {
+        writer.Write<uint8>(element.type);
+
+        if (element.type == SQL_ELEMENT_RAW)
+        {
+            std::string const& sql = std::get<std::string>(element.element);
+            writer.WriteBytes(sql.data(), sql.size());
+            continue;
+        }
+
+        PreparedStatementBase const* stmt = std::get<PreparedStatementBase*>(element.element);
+        writer.Write<uint32>(stmt->GetIndex());
+        writer.Write<uint8>(uint8(stmt->GetParameters().size()));
+
+        for (PreparedStatementData const& parameter : stmt->GetParameters())
+        {
+            writer.Write<uint8>(uint8(parameter.data.index()));
+            std::visit([&writer](auto const& value)
+            {
+                using Type = std::decay_t<decltype(value)>;
+                if constexpr (std::is_same_v<Type, std::string> || std::is_same_v<Type, std::vector<uint8>>)
+                    writer.WriteBytes(value.data(), value.size());
+                else if constexpr (!std::is_same_v<Type, std::nullptr_t>)
+                    writer.Write<Type>(value);
+            }, parameter.data);
+        }
+    }
+
+    return writer.Release();
+}
+
+namespace
+{
+    template <std::size_t Index = 0>
+    bool ReadParameter(PayloadReader& reader, std::size_t type, PreparedStatementData& parameter)
+    {
+        using Variant = decltype(PreparedStatementData::data);
+
+        if constexpr (Index < std::variant_size_v<Variant>)
+        {
+            if (type != Index)
+                return ReadParameter<Index + 1>(reader, type, parameter);
+
+            using Type = std::variant_alternative_t<Index, Variant>;
+            if constexpr (std::is_same_v<Type, std::nullptr_t>)
+                parameter.data.emplace<std::nullptr_t>(nullptr);
+            else if constexpr (std::is_same_v<Type, std::string> || std::is_same_v<Type, std::vector<uint8>>)
+            {
+                std::string_view bytes;
+                if (!reader.ReadBytes(bytes))
+                    return false;
+
+                parameter.data.emplace<Type>(bytes.begin(), bytes.end());
+            }
+            else
+            {
+                Type value;
+                if (!reader.Read(value))
+                    return false;
+
+                parameter.data.emplace<Type>(value);
+            }
+
+            return true;
+        }
+        else
+            return false;
+    }
+}
+
+bool DatabaseJournal::Deserialize(std::string_view payload, std::function<PreparedStatementBase*(uint32 index, uint8 parameterCount)> const& createStatement,
+    std::vector<SQLElementData>& elements, bool& transaction)
+{
+    PayloadReader reader(payload);
+
+    uint8 isTransaction;
+    uint32 count;
+    if (!reader.Read(isTransaction) || !reader.Read(count))
+        return false;
+
+    transaction = isTransaction != 0;
+    if (!transaction && count != 1)
+        return false;
+
+    auto cleanup = [&elements]()
+    {
+        for (SQLElementData& element : elements)
+            if (element.type == SQL_ELEMENT_PREPARED)
+                delete std::get<PreparedStatementBase*>(element.element);
+
+        elements.clear();
+        return false;
+    };
+
+    for (uint32 i = 0; i < count; ++i)
+    {
+        uint8 type;
+        if (!reader.Read(type))
+            return cleanup();
+
+        if (type == SQL_ELEMENT_RAW)
+        {
+            std::string_view sql;
+            if (!reader.ReadBytes(sql))
+                return cleanup();
+
+            elements.push_back({ std::string(sql), SQL_ELEMENT_RAW });
+            continue;
+        }
+
+        uint32 index;
+        uint8 parameterCount;
+        if (type != SQL_ELEMENT_PREPARED || !reader.Read(index) || !reader.Read(parameterCount))
+            return cleanup();
+
+        PreparedStatementBase* stmt = createStatement(index, parameterCount);
+        if (!stmt)
+            return cleanup();
+
+        elements.push_back({ stmt, SQL_ELEMENT_PREPARED });
+
+        for (PreparedStatementData& parameter : stmt->statement_data)
+        {
+            uint8 parameterType;
+            if (!reader.Read(parameterType) || !ReadParameter(reader, parameterType, parameter))
+                return cleanup();
+        }
+    }
+
+    return true;
+}
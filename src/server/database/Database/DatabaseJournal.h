@@ -0,0 +1,111 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _DATABASEJOURNAL_H
+#define _DATABASEJOURNAL_H
+
+#include "DatabaseEnvFwd.h"
+#include "Define.h"
+#include "SQLOperation.h"
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Append-only file every async write of a pool is recorded in before it is queued.
+ *
+ * A record counts as completed once the worker that executed it is done with it,
+ * records not completed when the process died are queued again on the next start.
+ * While the async queue is over its limit new writes are not queued at all but
+ * only kept in the journal (spooled), a reader thread queues them again once the
+ * queue drained. Async reads issued meanwhile are held back until the spool is
+ * empty, so they never overtake a spooled write.
+ *
+ * Records are flushed to the operating system, not synced to disk: they survive a
+ * crash of the worldserver but not a power loss.
+ */
+class AC_DATABASE_API DatabaseJournal
+{
+public:
+    /// Queues a record handed out by the spool reader, false completes the record right away
+    using SpoolHandler = std::function<bool(std::string_view payload, uint64 sequence)>;
+
+    DatabaseJournal(std::string fileName, std::string_view databaseName);
+    ~DatabaseJournal();
+
+    /// Opens the journal and empties it, pending receives every record not completed before, oldest first
+    bool Open(std::vector<std::string>& pending);
+
+    /// Starts the reader queueing spooled records through handler while canQueue returns true
+    void StartSpoolReader(std::function<bool()> canQueue, SpoolHandler handler, std::function<void(SQLOperation*)> enqueue);
+
+    /// Stops the reader and hands every spooled record and held back operation out, regardless of the queue size
+    void Drain();
+
+    /// Records payload, returns its sequence (0 if it could not be written). spooled is set when the caller must not queue
+    /// the write, which happens while queueFull or while older records are still spooled.
+    uint64 Append(std::string_view payload, bool queueFull, bool& spooled);
+
+    /// Holds op back while records are spooled, returns false if the caller may queue it right away
+    bool DeferIfSpooling(SQLOperation* op);
+
+    void Complete(uint64 sequence);
+
+    [[nodiscard]] bool IsSpooling() const { return _spooling; }
+
+    static std::string Serialize(std::span<SQLElementData const> elements, bool transaction);
+    static bool Deserialize(std::string_view payload, std::function<PreparedStatementBase*(uint32 index, uint8 parameterCount)> const& createStatement,
+        std::vector<SQLElementData>& elements, bool& transaction);
+
+private:
+    bool ReadRecord(uint64 offset, std::string& payload, uint64& sequence, uint64& nextOffset);
+    bool ReadSpooled(std::string& payload, uint64& sequence);
+    void QueueSpooled(std::string const& payload, uint64 sequence);
+    void CompleteLocked(uint64 sequence);
+    void WriteHeader();
+    void Truncate();
+    void SpoolReaderThread();
+
+    std::string _fileName;
+    std::string _databaseName;
+    std::fstream _file;
+    mutable std::mutex _lock;
+
+    uint64 _lastSequence;                   // last appended record
+    uint64 _completed;                      // every record up to this one is completed
+    std::set<uint64> _completedOutOfOrder;  // completed records after _completed
+    uint64 _appendOffset;
+    uint64 _readOffset;                     // next spooled record, only meaningful while spooling
+    std::atomic<bool> _spooling;
+    std::vector<SQLOperation*> _deferred;
+
+    std::function<bool()> _canQueue;
+    SpoolHandler _spoolHandler;
+    std::function<void(SQLOperation*)> _enqueue;
+    std::thread _reader;
+    std::condition_variable _readerCondition;
+    bool _stopReader;
+};
+
+#endif
@@ -23,8 +23,11 @@
 #include "Log.h"
 #include <errmsg.h>
 #include <mysqld_error.h>
+#include <algorithm>
 #include <thread>
 #include <string_view>
+#include <vector>
+
 namespace
 {
     std::string const EMPTY_DATABASE_INFO;
@@ -74,7 +77,21 @@ DatabaseLoader& DatabaseLoader::AddDatabase(DatabaseWorkerPool<T>& pool, std::st
 
         uint8 const synchThreads = sConfigMgr->GetOption<uint8>(name + "Database.SynchThreads", 1);
 
-        pool.SetConnectionInfo(dbString, asyncThreads, synchThreads);
+        uint32 const batchSize = sConfigMgr->GetOption<uint32>(name + "Database.BatchSize", 1);
+
+        pool.SetConnectionInfo(dbString, asyncThreads, synchThreads, batchSize);
+
+        std::string const replicaString = sConfigMgr->GetOption<std::string>(name + "DatabaseReplicaInfo", "", false);
+        if (!replicaString.empty())
+        {
+            uint8 const replicaAsyncThreads = sConfigMgr->GetOption<uint8>(name + "Database.Replica.WorkerThreads", 1);
+            uint8 const replicaSynchThreads = sConfigMgr->GetOption<uint8>(name + "Database.Replica.SynchThreads", 1);
+            uint32 const replicaMaxLag = sConfigMgr->GetOption<uint32>(name + "Database.Replica.MaxLag", 5);
+            pool.SetReplicaConnectionInfo(replicaString, replicaAsyncThreads, replicaSynchThreads, replicaMaxLag);
+        }
+
+        if (uint32 const resultCacheTTL = sConfigMgr->GetOption<uint32>(name + "Database.ResultCache.TTL", 0, false))
+            pool.EnableResultCache(Seconds(resultCacheTTL));
 
         if (uint32 error = pool.Open())
         {
@@ -164,6 +181,17 @@ DatabaseLoader& DatabaseLoader::AddDatabase(DatabaseWorkerPool<T>& pool, std::st
             return false;
         }
 
+        std::string const journalFile = sConfigMgr->GetOption<std::string>(name + "Database.Journal.File", "", false);
+        if (!journalFile.empty())
+        {
+            std::size_t const spoolThreshold = sConfigMgr->GetOption<uint32>(name + "Database.Journal.SpoolThreshold", 10000, false);
+            if (!pool.EnableJournal(journalFile, spoolThreshold))
+            {
+                LOG_ERROR(_logger, "Could not open the journal '{}' of the {} database.", journalFile, name);
+                return false;
+            }
+        }
+
         return true;
     });
 
@@ -197,12 +225,12 @@ bool DatabaseLoader::OpenDatabases()
 
 bool DatabaseLoader::PopulateDatabases()
 {
-    return Process(_populate);
+    return ProcessConcurrently(_populate);
 }
 
 bool DatabaseLoader::UpdateDatabases()
 {
-    return Process(_update);
+    return ProcessConcurrently(_update);
 }
 
 bool DatabaseLoader::PrepareStatements()
@@ -232,6 +260,39 @@ bool DatabaseLoader::Process(std::queue<Predicate>& queue)
     return true;
 }
 
+bool DatabaseLoader::ProcessConcurrently(std::queue<Predicate>& queue)
+{
+    std::vector<Predicate> predicates;
+    predicates.reserve(queue.size());
+    while (!queue.empty())
+    {
+        predicates.push_back(std::move(queue.front()));
+        queue.pop();
+    }
+
+    // std::vector<bool> packs its elements, which can't be written from several threads
+    std::vector<uint8> results(predicates.size(), 0);
+    std::vector<std::thread> threads;
+    threads.reserve(predicates.size());
+    for (std::size_t i = 0; i < predicates.size(); ++i)
+        threads.emplace_back([&predicates, &results, i]() { results[i] = predicates[i]() ? 1 : 0; });
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    if (std::find(results.begin(), results.end(), 0) == results.end())
+        return true;
+
+    // Close all open databases which have a registered close operation
+    while (!_close.empty())
+    {
+        _close.top()();
+        _close.pop();
+    }
+
+    return false;
+}
+
 template AC_DATABASE_API
 DatabaseLoader& DatabaseLoader::AddDatabase<LoginDatabaseConnection>(DatabaseWorkerPool<LoginDatabaseConnection>&, std::string const&);
 template AC_DATABASE_API
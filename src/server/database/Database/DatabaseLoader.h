@@ -70,6 +70,9 @@ private:
     // Returns false when there was an error.
     bool Process(std::queue<Predicate>& queue);
 
+    // Same as Process, but invokes the functions, which handle one database each, on their own threads.
+    bool ProcessConcurrently(std::queue<Predicate>& queue);
+
     std::string const _logger;
     std::string_view _modulesList;
     bool const _autoSetup;
@@ -16,13 +16,21 @@
  */
 
 #include "DatabaseWorker.h"
+#include "Config.h"
+#include "Log.h"
+#include "Metric.h"
+#include "MySQLConnection.h"
 #include "PCQueue.h"
+#include "ProcessPriority.h"
 #include "SQLOperation.h"
 
-DatabaseWorker::DatabaseWorker(ProducerConsumerQueue<SQLOperation*>* newQueue, MySQLConnection* connection)
+DatabaseWorker::DatabaseWorker(ProducerConsumerQueue<SQLOperation*>* newQueue, MySQLConnection* connection, MySQLConnectionInfo const& connectionInfo)
 {
     _connection = connection;
     _queue = newQueue;
+    _batchSize = connectionInfo.batch_size;
+    _databaseName = connectionInfo.database;
+    _affinity = sConfigMgr->GetOption<std::string>("Database.Worker.Affinity", "", false);
     _workerThread = std::thread(&DatabaseWorker::WorkerThread, this);
 }
 
@@ -36,6 +44,8 @@ void DatabaseWorker::WorkerThread()
     if (!_queue)
         return;
 
+    SetCurrentThreadAffinity("sql.driver", _affinity);
+
     for (;;)
     {
         SQLOperation* operation = nullptr;
@@ -45,9 +55,77 @@ void DatabaseWorker::WorkerThread()
         if (!operation)
             return;
 
+        if (_batchSize > 1 && operation->IsBatchable())
+        {
+            // Drain the one-way statements queued right behind this one, the first
+            // operation that cannot join the batch runs after it was committed
+            _batch.push_back(operation);
+            operation = nullptr;
+
+            while (_batch.size() < _batchSize && _queue->Pop(operation))
+            {
+                if (!operation->IsBatchable())
+                    break;
+
+                _batch.push_back(operation);
+                operation = nullptr;
+            }
+
+            ExecuteBatch();
+
+            if (!operation)
+                continue;
+        }
+
         operation->SetConnection(_connection);
         operation->call();
 
         delete operation;
     }
 }
+
+void DatabaseWorker::ExecuteBatch()
+{
+    METRIC_VALUE("db_batch_size", uint64(_batch.size()),
+        METRIC_TAG("database", _databaseName));
+    METRIC_VALUE("db_batch_queue_depth", uint64(_queue->Size()),
+        METRIC_TAG("database", _databaseName));
+
+    bool failed = false;
+    if (_batch.size() > 1)
+    {
+        _connection->BeginTransaction();
+
+        for (SQLOperation* operation : _batch)
+        {
+            operation->SetConnection(_connection);
+            if (!operation->Execute())
+            {
+                failed = true;
+                break;
+            }
+        }
+
+        if (!failed)
+            _connection->CommitTransaction();
+        else
+        {
+            // Keep the unbatched semantics, every statement stands on its own
+            LOG_WARN("sql.sql", "Batch of {} statements aborted, executing them one by one.", _batch.size());
+            _connection->RollbackTransaction();
+        }
+    }
+
+    for (SQLOperation* operation : _batch)
+    {
+        if (failed || _batch.size() == 1)
+        {
+            operation->SetConnection(_connection);
+            operation->call();
+        }
+
+        delete operation;
+    }
+
+    _batch.clear();
+}
@@ -20,25 +20,33 @@
 
 #include "Define.h"
 #include <atomic>
+#include <string>
 #include <thread>
+#include <vector>
 
 template <typename T>
 class ProducerConsumerQueue;
 
 class MySQLConnection;
 class SQLOperation;
+struct MySQLConnectionInfo;
 
 class AC_DATABASE_API DatabaseWorker
 {
 public:
-    DatabaseWorker(ProducerConsumerQueue<SQLOperation*>* newQueue, MySQLConnection* connection);
+    DatabaseWorker(ProducerConsumerQueue<SQLOperation*>* newQueue, MySQLConnection* connection, MySQLConnectionInfo const& connectionInfo);
     ~DatabaseWorker();
 
 private:
     ProducerConsumerQueue<SQLOperation*>* _queue;
     MySQLConnection* _connection;
+    uint32 _batchSize;
+    std::string _databaseName;
+    std::string _affinity;
+    std::vector<SQLOperation*> _batch;
 
     void WorkerThread();
+    void ExecuteBatch();
     std::thread _workerThread;
 
     DatabaseWorker(DatabaseWorker const& right) = delete;
@@ -18,19 +18,26 @@
 #include "DatabaseWorkerPool.h"
 #include "AdhocStatement.h"
 #include "CharacterDatabase.h"
+#include "DatabaseJournal.h"
 #include "Errors.h"
 #include "Log.h"
 #include "LoginDatabase.h"
 #include "MySQLPreparedStatement.h"
 #include "MySQLWorkaround.h"
+#include "Optional.h"
 #include "PCQueue.h"
 #include "PreparedStatement.h"
 #include "QueryCallback.h"
 #include "QueryHolder.h"
 #include "QueryResult.h"
+#include "QueryResultCache.h"
+#include "QueryTask.h"
 #include "SQLOperation.h"
+#include "StatementStats.h"
+#include "Timer.h"
 #include "Transaction.h"
 #include "WorldDatabase.h"
+#include <algorithm>
 #include <limits>
 #include <mysqld_error.h>
 #include <sstream>
@@ -51,11 +58,135 @@ class PingOperation : public SQLOperation
     }
 };
 
+/// Minimum amount of queries of one holder executed by the same connection
+static constexpr std::size_t MIN_QUERY_HOLDER_PART_SIZE = 8;
+
+/// How often the replication lag of a read replica is verified, in milliseconds
+static constexpr uint32 REPLICA_LAG_CHECK_INTERVAL = 5 * IN_MILLISECONDS;
+
+class ReplicaLagCheckOperation : public SQLOperation
+{
+public:
+    ReplicaLagCheckOperation(std::atomic<bool>& usable, uint32 maxLag, std::string_view databaseName) :
+        _usable(usable), _maxLag(maxLag), _databaseName(databaseName) { }
+
+    //! Marks the replica usable only while it reports a known lag within the limit
+    bool Execute() override
+    {
+        Optional<uint64> lag = QueryLag("SHOW REPLICA STATUS", "Seconds_Behind_Source");
+        if (!lag)
+            lag = QueryLag("SHOW SLAVE STATUS", "Seconds_Behind_Master");  // servers older than 8.0.22
+
+        bool usable = lag && *lag <= _maxLag;
+        if (_usable.exchange(usable) != usable)
+        {
+            if (usable)
+                LOG_INFO("sql.driver", "Read replica '{}' is usable again (lag {}s).", _databaseName, *lag);
+            else if (lag)
+                LOG_WARN("sql.driver", "Read replica '{}' lags {}s behind (limit {}s), queries fall back to the primary.", _databaseName, *lag, _maxLag);
+            else
+                LOG_WARN("sql.driver", "Read replica '{}' does not report its replication lag, queries fall back to the primary.", _databaseName);
+        }
+
+        return usable;
+    }
+
+private:
+    Optional<uint64> QueryLag(std::string_view sql, std::string_view column)
+    {
+        ResultSet* result = m_conn->Query(sql);
+        if (!result)
+            return {};
+
+        Optional<uint64> lag;
+        if (result->GetRowCount() && result->NextRow())
+        {
+            for (uint32 i = 0; i < result->GetFieldCount(); ++i)
+            {
+                if (result->GetFieldName(i) != column)
+                    continue;
+
+                if (!(*result)[i].IsNull())
+                    lag = (*result)[i].Get<uint64>();
+
+                break;
+            }
+        }
+
+        delete result;
+        return lag;
+    }
+
+    std::atomic<bool>& _usable;
+    uint32 _maxLag;
+    std::string _databaseName;
+};
+
+//! Async read of a cached statement, stores the result before handing it out
+class ResultCacheQueryTask : public PreparedStatementTask
+{
+public:
+    ResultCacheQueryTask(PreparedStatementBase* stmt, QueryResultCache& cache, QueryResultCache::Lookup lookup) :
+        PreparedStatementTask(stmt, true), _cache(cache), _lookup(std::move(lookup)) { }
+
+    bool Execute() override
+    {
+        PreparedQueryResult result = _cache.Store(m_stmt->GetIndex(), _lookup, m_conn->Query(m_stmt));
+        m_result->set_value(result);
+        return result != nullptr;
+    }
+
+private:
+    QueryResultCache& _cache;
+    QueryResultCache::Lookup _lookup;
+};
+
+//! Keeps the writes of the wrapped task pending in the result cache and its journal record
+//! uncompleted until the task is done with
+template <class Task>
+class TrackedWriteTask : public Task
+{
+public:
+    template <typename... Args>
+    TrackedWriteTask(QueryResultCache* cache, std::vector<uint32> writes, DatabaseJournal* journal, uint64 sequence, Args&&... args) :
+        Task(std::forward<Args>(args)...), _cache(cache), _writes(std::move(writes)), _journal(journal), _sequence(sequence) { }
+
+    ~TrackedWriteTask() override
+    {
+        for (uint32 index : _writes)
+            _cache->EndWrite(index);
+
+        // dropped from the queue without running, the journal queues it again on the next start
+        if (_journal && _executed)
+            _journal->Complete(_sequence);
+    }
+
+    bool Execute() override
+    {
+        _executed = true;
+        return Task::Execute();
+    }
+
+private:
+    QueryResultCache* _cache;
+    std::vector<uint32> _writes;
+    DatabaseJournal* _journal;
+    uint64 _sequence;
+    bool _executed{false};
+};
+
 template <class T>
 DatabaseWorkerPool<T>::DatabaseWorkerPool() :
     _queue(new ProducerConsumerQueue<SQLOperation*>()),
     _async_threads(0),
-    _synch_threads(0)
+    _synch_threads(0),
+    _replicaQueue(new ProducerConsumerQueue<SQLOperation*>()),
+    _replica_async_threads(0),
+    _replica_synch_threads(0),
+    _replicaMaxLag(0),
+    _replicaUsable(false),
+    _lastReplicaCheck(0),
+    _journalSpoolThreshold(0)
 {
     WPFatal(mysql_thread_safe(), "Used MySQL library isn't thread-safe.");
 
@@ -72,17 +203,72 @@ template <class T>
 DatabaseWorkerPool<T>::~DatabaseWorkerPool()
 {
     _queue->Cancel();
+    _replicaQueue->Cancel();
 }
 
 template <class T>
-void DatabaseWorkerPool<T>::SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads)
+void DatabaseWorkerPool<T>::SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads, uint32 const batchSize)
 {
     _connectionInfo = std::make_unique<MySQLConnectionInfo>(infoString);
+    _connectionInfo->batch_size = std::max<uint32>(batchSize, 1);
 
     _async_threads = asyncThreads;
     _synch_threads = synchThreads;
 }
 
+template <class T>
+void DatabaseWorkerPool<T>::SetReplicaConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads, uint32 const maxLagSeconds)
+{
+    _replicaConnectionInfo = std::make_unique<MySQLConnectionInfo>(infoString);
+
+    _replica_async_threads = std::max<uint8>(asyncThreads, 1);
+    _replica_synch_threads = std::max<uint8>(synchThreads, 1);
+    _replicaMaxLag = maxLagSeconds;
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::EnableResultCache(Milliseconds ttl)
+{
+    _resultCache = std::make_unique<QueryResultCache>(ttl, GetDatabaseName());
+}
+
+template <class T>
+bool DatabaseWorkerPool<T>::EnableJournal(std::string const& fileName, std::size_t spoolThreshold)
+{
+    ASSERT(!_connections[IDX_ASYNC].empty());
+
+    auto const& asyncStmts = _connections[IDX_ASYNC].front()->m_stmts;
+    _journalStatements.assign(asyncStmts.size(), false);
+    for (std::size_t i = 0; i < asyncStmts.size(); ++i)
+        _journalStatements[i] = asyncStmts[i] != nullptr;
+
+    _journal = std::make_unique<DatabaseJournal>(fileName, GetDatabaseName());
+    _journalSpoolThreshold = spoolThreshold ? spoolThreshold : std::numeric_limits<std::size_t>::max();
+
+    std::vector<std::string> pending;
+    if (!_journal->Open(pending))
+    {
+        _journal.reset();
+        return false;
+    }
+
+    // journaled again before queueing, another crash while they run does not lose them either
+    for (std::string const& payload : pending)
+    {
+        bool spooled = false;
+        uint64 const sequence = _journal->Append(payload, _queue->Size() >= _journalSpoolThreshold, spooled);
+        if (!spooled && !EnqueueJournaled(payload, sequence))
+            _journal->Complete(sequence);
+    }
+
+    _journal->StartSpoolReader([this]() { return _queue->Size() < _journalSpoolThreshold / 2; },
+        [this](std::string_view payload, uint64 sequence) { return EnqueueJournaled(payload, sequence); },
+        [this](SQLOperation* op) { Enqueue(op); });
+
+    LOG_INFO("sql.driver", "Async writes of DatabasePool '{}' are journaled in '{}'.", GetDatabaseName(), fileName);
+    return true;
+}
+
 template <class T>
 uint32 DatabaseWorkerPool<T>::Open()
 {
@@ -98,10 +284,14 @@ uint32 DatabaseWorkerPool<T>::Open()
 
     error = OpenConnections(IDX_SYNCH, _synch_threads);
 
+    if (!error && _replicaConnectionInfo && !OpenReplicaConnections())
+        IsReplicaUsable(); // queue the first lag check, reads stay on the primary until it passes
+
     if (!error)
     {
         LOG_INFO("sql.driver", "DatabasePool '{}' opened successfully. {} total connections running.",
-            GetDatabaseName(), (_connections[IDX_SYNCH].size() + _connections[IDX_ASYNC].size()));
+            GetDatabaseName(), (_connections[IDX_SYNCH].size() + _connections[IDX_ASYNC].size() +
+            _connections[IDX_REPLICA_SYNCH].size() + _connections[IDX_REPLICA_ASYNC].size()));
     }
 
     LOG_INFO("sql.driver", " ");
@@ -109,17 +299,62 @@ uint32 DatabaseWorkerPool<T>::Open()
     return error;
 }
 
+template <class T>
+uint32 DatabaseWorkerPool<T>::OpenReplicaConnections()
+{
+    LOG_INFO("sql.driver", "Opening read replica '{}' of DatabasePool '{}'. Asynchronous connections: {}, synchronous connections: {}.",
+        _replicaConnectionInfo->host, GetDatabaseName(), _replica_async_threads, _replica_synch_threads);
+
+    uint32 error = OpenConnections(IDX_REPLICA_ASYNC, _replica_async_threads);
+    if (!error)
+        error = OpenConnections(IDX_REPLICA_SYNCH, _replica_synch_threads);
+
+    // a missing replica must not keep the server from starting, everything is served by the primary instead
+    if (error)
+    {
+        LOG_ERROR("sql.driver", "Could not open read replica of DatabasePool '{}', all queries use the primary.", GetDatabaseName());
+        CloseReplicaConnections();
+    }
+
+    return error;
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::CloseReplicaConnections()
+{
+    _replicaUsable = false;
+
+    _replicaQueue->Cancel();
+    _connections[IDX_REPLICA_ASYNC].clear();
+    _connections[IDX_REPLICA_SYNCH].clear();
+    _replicaStatements.clear();
+    _replicaConnectionInfo.reset();
+}
+
 template <class T>
 void DatabaseWorkerPool<T>::Close()
 {
     LOG_INFO("sql.driver", "Closing down DatabasePool '{}'. Waiting for {} queries to finish...", GetDatabaseName(), _queue->Size());
 
+    //! Everything spooled is queued before the queue shuts down, the workers finish it
+    if (_journal)
+        _journal->Drain();
+
     // Gracefully close async query queue, worker threads will block when the destructor
     // is called from the .clear() functions below until the queue is empty
     _queue->Shutdown();
 
     //! Closes the actualy MySQL connection.
     _connections[IDX_ASYNC].clear();
+    _journal.reset();
+
+    //! Same for the read replica, pending reads still complete
+    if (_replicaConnectionInfo)
+    {
+        _replicaQueue->Shutdown();
+        _connections[IDX_REPLICA_ASYNC].clear();
+        CloseReplicaConnections();
+    }
 
     LOG_INFO("sql.driver", "Asynchronous connections on DatabasePool '{}' terminated. Proceeding with synchronous connections.",
         GetDatabaseName());
@@ -174,6 +409,32 @@ bool DatabaseWorkerPool<T>::PrepareStatements()
         }
     }
 
+    // replica connections only prepare the statements flagged for them
+    if (!_connections[IDX_REPLICA_SYNCH].empty())
+    {
+        auto const& replicaStmts = _connections[IDX_REPLICA_SYNCH].front()->m_stmts;
+        _replicaStatements.assign(replicaStmts.size(), false);
+        for (std::size_t i = 0; i < replicaStmts.size(); ++i)
+            _replicaStatements[i] = replicaStmts[i] != nullptr;
+    }
+
+    _statementStats = std::make_unique<StatementStats>(GetDatabaseName(), _preparedStatementSize.size());
+    for (auto const& connections : _connections)
+    {
+        for (auto const& connection : connections)
+        {
+            for (std::size_t i = 0; i < connection->m_stmts.size(); ++i)
+                if (MySQLPreparedStatement* stmt = connection->m_stmts[i].get())
+                    _statementStats->SetQueryString(uint32(i), stmt->GetQueryTemplate());
+
+            connection->m_statementStats = _statementStats.get();
+        }
+    }
+
+    if (_resultCache && !_connections[IDX_SYNCH].empty())
+        for (auto const& [index, invalidatedBy] : _connections[IDX_SYNCH].front()->m_cachedStatements)
+            _resultCache->Register(index, invalidatedBy);
+
     return true;
 }
 
@@ -195,15 +456,76 @@ QueryResult DatabaseWorkerPool<T>::Query(std::string_view sql)
 }
 
 template <class T>
-PreparedQueryResult DatabaseWorkerPool<T>::Query(PreparedStatement<T>* stmt)
+uint64 DatabaseWorkerPool<T>::StreamQuery(std::string_view sql, std::function<void(Field* fields)> const& handler)
 {
     auto connection = GetFreeConnection();
+
+    uint64 count = 0;
+    if (ResultSet* result = connection->StreamQuery(sql))
+    {
+        while (result->NextRow())
+        {
+            handler(result->Fetch());
+            ++count;
+        }
+
+        //! Must be released before the connection, unread rows are still pending on it
+        delete result;
+    }
+
+    connection->Unlock();
+    return count;
+}
+
+template <class T>
+QueryResult DatabaseWorkerPool<T>::ReplicaQuery(std::string_view sql)
+{
+    if (!IsReplicaUsable())
+        return Query(sql);
+
+    auto connection = GetFreeConnection(IDX_REPLICA_SYNCH);
+
+    ResultSet* result = connection->Query(sql);
+    connection->Unlock();
+
+    if (!result || !result->GetRowCount() || !result->NextRow())
+    {
+        delete result;
+        return QueryResult(nullptr);
+    }
+
+    return QueryResult(result);
+}
+
+template <class T>
+PreparedQueryResult DatabaseWorkerPool<T>::Query(PreparedStatement<T>* stmt)
+{
+    uint32 const index = stmt->GetIndex();
+    bool const useReplica = CanUseReplica(index);
+
+    //! Replica reads are never cached, they may not see the writes that invalidated the cache yet
+    bool const cached = !useReplica && _resultCache && _resultCache->IsCached(index);
+    QueryResultCache::Lookup lookup;
+    if (cached)
+    {
+        PreparedQueryResult result;
+        if (_resultCache->Find(stmt, result, lookup))
+        {
+            delete stmt;
+            return result;
+        }
+    }
+
+    auto connection = GetFreeConnection(useReplica ? IDX_REPLICA_SYNCH : IDX_SYNCH);
     PreparedResultSet* ret = connection->Query(stmt);
     connection->Unlock();
 
     //! Delete proxy-class. Not needed anymore
     delete stmt;
 
+    if (cached)
+        return _resultCache->Store(index, lookup, ret);
+
     if (!ret || !ret->GetRowCount())
     {
         delete ret;
@@ -219,27 +541,74 @@ QueryCallback DatabaseWorkerPool<T>::AsyncQuery(std::string_view sql)
     BasicStatementTask* task = new BasicStatementTask(sql, true);
     // Store future result before enqueueing - task might get already processed and deleted before returning from this method
     QueryResultFuture result = task->GetFuture();
-    Enqueue(task);
+    EnqueueOrdered(task);
     return QueryCallback(std::move(result));
 }
 
 template <class T>
 QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt)
 {
-    PreparedStatementTask* task = new PreparedStatementTask(stmt, true);
+    bool const useReplica = CanUseReplica(stmt->GetIndex());
+
+    PreparedStatementTask* task;
+    if (!useReplica && _resultCache && _resultCache->IsCached(stmt->GetIndex()))
+    {
+        PreparedQueryResult cachedResult;
+        QueryResultCache::Lookup lookup;
+        if (_resultCache->Find(stmt, cachedResult, lookup))
+        {
+            delete stmt;
+
+            PreparedQueryResultPromise promise;
+            promise.set_value(std::move(cachedResult));
+            return QueryCallback(promise.get_future());
+        }
+
+        task = new ResultCacheQueryTask(stmt, *_resultCache, std::move(lookup));
+    }
+    else
+        task = new PreparedStatementTask(stmt, true);
+
     // Store future result before enqueueing - task might get already processed and deleted before returning from this method
     PreparedQueryResultFuture result = task->GetFuture();
-    Enqueue(task);
+    if (useReplica)
+        _replicaQueue->Push(task);
+    else
+        EnqueueOrdered(task);
     return QueryCallback(std::move(result));
 }
 
+template <class T>
+QueryAwaiter DatabaseWorkerPool<T>::AwaitQuery(std::string_view sql)
+{
+    return QueryAwaiter(AsyncQuery(sql));
+}
+
+template <class T>
+PreparedQueryAwaiter DatabaseWorkerPool<T>::AwaitQuery(PreparedStatement<T>* stmt)
+{
+    return PreparedQueryAwaiter(AsyncQuery(stmt));
+}
+
 template <class T>
 SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder)
 {
+    //! Big holders are split across the async connections, each part runs a share of the queries
+    std::size_t const parts = std::min<std::size_t>(_async_threads, holder->GetSize() / MIN_QUERY_HOLDER_PART_SIZE);
+    if (parts > 1)
+    {
+        auto state = std::make_shared<SQLQueryHolderPartTask::SharedState>(parts);
+        QueryResultHolderFuture result = state->Result.get_future();
+        for (std::size_t part = 0; part < parts; ++part)
+            EnqueueOrdered(new SQLQueryHolderPartTask(holder, state, part, parts));
+
+        return { std::move(holder), std::move(result) };
+    }
+
     SQLQueryHolderTask* task = new SQLQueryHolderTask(holder);
     // Store future result before enqueueing - task might get already processed and deleted before returning from this method
     QueryResultHolderFuture result = task->GetFuture();
-    Enqueue(task);
+    EnqueueOrdered(task);
     return { std::move(holder), std::move(result) };
 }
 
@@ -269,7 +638,12 @@ void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction)
     }
 #endif // ACORE_DEBUG
 
-    Enqueue(new TransactionTask(transaction));
+    //! Spooled, the transaction frees its statements once the caller dropped it
+    uint64 sequence = 0;
+    if (_journal && !JournalWrite(transaction->m_queries, true, sequence))
+        return;
+
+    EnqueueWrite<TransactionTask>(transaction->m_queries, sequence, transaction);
 }
 
 template <class T>
@@ -292,21 +666,32 @@ TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction
     }
 #endif // ACORE_DEBUG
 
-    TransactionWithResultTask* task = new TransactionWithResultTask(transaction);
+    std::vector<uint32> writes = BeginResultCacheWrites(transaction->m_queries);
+    TransactionWithResultTask* task = writes.empty() ? new TransactionWithResultTask(transaction) :
+        new TrackedWriteTask<TransactionWithResultTask>(_resultCache.get(), std::move(writes), nullptr, 0, transaction);
     TransactionFuture result = task->GetFuture();
-    Enqueue(task);
+    EnqueueOrdered(task);
     return TransactionCallback(std::move(result));
 }
 
+template <class T>
+TransactionAwaiter DatabaseWorkerPool<T>::AwaitCommitTransaction(SQLTransaction<T> transaction)
+{
+    return TransactionAwaiter(AsyncCommitTransaction(std::move(transaction)));
+}
+
 template <class T>
 void DatabaseWorkerPool<T>::DirectCommitTransaction(SQLTransaction<T>& transaction)
 {
+    std::vector<uint32> const writes = BeginResultCacheWrites(transaction->m_queries);
+
     T* connection = GetFreeConnection();
     int errorCode = connection->ExecuteTransaction(transaction);
 
     if (!errorCode)
     {
         connection->Unlock();      // OK, operation succesful
+        EndResultCacheWrites(writes);
         return;
     }
 
@@ -328,6 +713,7 @@ void DatabaseWorkerPool<T>::DirectCommitTransaction(SQLTransaction<T>& transacti
     transaction->Cleanup();
 
     connection->Unlock();
+    EndResultCacheWrites(writes);
 }
 
 template <class T>
@@ -368,6 +754,19 @@ void DatabaseWorkerPool<T>::KeepAlive()
 
     for (uint8 i = 0; i < count; ++i)
         Enqueue(new PingOperation);
+
+    //! Same for the read replica, if any
+    for (auto& connection : _connections[IDX_REPLICA_SYNCH])
+    {
+        if (connection->LockIfReady())
+        {
+            connection->Ping();
+            connection->Unlock();
+        }
+    }
+
+    for (std::size_t i = 0; i < _connections[IDX_REPLICA_ASYNC].size(); ++i)
+        _replicaQueue->Push(new PingOperation);
 }
 
 /**
@@ -428,15 +827,26 @@ uint32 DatabaseWorkerPool<T>::OpenConnections(InternalIndex type, uint8 numConne
                 return std::make_unique<T>(_queue.get(), *_connectionInfo);
             case IDX_SYNCH:
                 return std::make_unique<T>(*_connectionInfo);
+            case IDX_REPLICA_ASYNC:
+                return std::make_unique<T>(_replicaQueue.get(), *_replicaConnectionInfo);
+            case IDX_REPLICA_SYNCH:
+                return std::make_unique<T>(*_replicaConnectionInfo);
             default:
                 ABORT();
             }
         }();
 
+        // replica connections only prepare the statements flagged as safe to read from a replica
+        if (type == IDX_REPLICA_ASYNC || type == IDX_REPLICA_SYNCH)
+            connection->m_connectionFlags = CONNECTION_REPLICA;
+
         if (uint32 error = connection->Open())
         {
             // Failed to open a connection or invalid version, abort and cleanup
-            _queue->Cancel();
+            if (type == IDX_REPLICA_ASYNC || type == IDX_REPLICA_SYNCH)
+                _replicaQueue->Cancel();
+            else
+                _queue->Cancel();
             _connections[type].clear();
             return error;
         }
@@ -471,6 +881,68 @@ void DatabaseWorkerPool<T>::Enqueue(SQLOperation* op)
     _queue->Push(op);
 }
 
+template <class T>
+void DatabaseWorkerPool<T>::EnqueueOrdered(SQLOperation* op)
+{
+    if (_journal && _journal->DeferIfSpooling(op))
+        return;
+
+    Enqueue(op);
+}
+
+template <class T>
+template <class Task, typename... Args>
+void DatabaseWorkerPool<T>::EnqueueWrite(std::span<SQLElementData const> elements, uint64 sequence, Args&&... args)
+{
+    std::vector<uint32> writes = BeginResultCacheWrites(elements);
+    if (writes.empty() && !sequence)
+        Enqueue(new Task(std::forward<Args>(args)...));
+    else
+        Enqueue(new TrackedWriteTask<Task>(_resultCache.get(), std::move(writes), _journal.get(), sequence, std::forward<Args>(args)...));
+}
+
+template <class T>
+bool DatabaseWorkerPool<T>::JournalWrite(std::span<SQLElementData const> elements, bool transaction, uint64& sequence)
+{
+    bool spooled = false;
+    sequence = _journal->Append(DatabaseJournal::Serialize(elements, transaction), _queue->Size() >= _journalSpoolThreshold, spooled);
+    return !spooled;
+}
+
+template <class T>
+bool DatabaseWorkerPool<T>::EnqueueJournaled(std::string_view payload, uint64 sequence)
+{
+    auto createStatement = [this](uint32 index, uint8 parameterCount) -> PreparedStatementBase*
+    {
+        // recorded by another core revision, the statement changed meanwhile
+        if (index >= _journalStatements.size() || !_journalStatements[index] || _preparedStatementSize[index] != parameterCount)
+            return nullptr;
+
+        return new PreparedStatement<T>(index, parameterCount);
+    };
+
+    std::vector<SQLElementData> elements;
+    bool transaction = false;
+    if (!DatabaseJournal::Deserialize(payload, createStatement, elements, transaction))
+    {
+        LOG_ERROR("sql.driver", "Journaled write {} of DatabasePool '{}' does not match its prepared statements, skipped.", sequence, GetDatabaseName());
+        return false;
+    }
+
+    if (transaction)
+    {
+        SQLTransaction<T> trans = std::make_shared<Transaction<T>>();
+        trans->m_queries = std::move(elements);
+        EnqueueWrite<TransactionTask>(trans->m_queries, sequence, trans);
+    }
+    else if (elements.front().type == SQL_ELEMENT_RAW)
+        EnqueueWrite<BasicStatementTask>({}, sequence, std::get<std::string>(elements.front().element));
+    else
+        EnqueueWrite<PreparedStatementTask>(elements, sequence, std::get<PreparedStatementBase*>(elements.front().element));
+
+    return true;
+}
+
 template <class T>
 std::size_t DatabaseWorkerPool<T>::QueueSize() const
 {
@@ -478,7 +950,62 @@ std::size_t DatabaseWorkerPool<T>::QueueSize() const
 }
 
 template <class T>
-T* DatabaseWorkerPool<T>::GetFreeConnection()
+bool DatabaseWorkerPool<T>::IsReplicaUsable()
+{
+    if (_connections[IDX_REPLICA_ASYNC].empty())
+        return false;
+
+    // re-check the replication lag periodically, the check itself runs on a replica worker
+    uint32 const now = getMSTime();
+    uint32 lastCheck = _lastReplicaCheck;
+    if (lastCheck && getMSTimeDiff(lastCheck, now) < REPLICA_LAG_CHECK_INTERVAL)
+        return _replicaUsable;
+
+    // only one caller queues the check
+    if (_lastReplicaCheck.compare_exchange_strong(lastCheck, std::max<uint32>(now, 1)))
+        _replicaQueue->Push(new ReplicaLagCheckOperation(_replicaUsable, _replicaMaxLag, GetDatabaseName()));
+
+    return _replicaUsable;
+}
+
+template <class T>
+bool DatabaseWorkerPool<T>::CanUseReplica(uint32 index)
+{
+    return index < _replicaStatements.size() && _replicaStatements[index] && IsReplicaUsable();
+}
+
+template <class T>
+std::vector<uint32> DatabaseWorkerPool<T>::BeginResultCacheWrites(std::span<SQLElementData const> elements)
+{
+    std::vector<uint32> writes;
+    if (!_resultCache)
+        return writes;
+
+    for (SQLElementData const& data : elements)
+    {
+        if (data.type != SQL_ELEMENT_PREPARED)
+            continue;
+
+        uint32 const index = std::get<PreparedStatementBase*>(data.element)->GetIndex();
+        if (!_resultCache->IsInvalidating(index))
+            continue;
+
+        _resultCache->BeginWrite(index);
+        writes.push_back(index);
+    }
+
+    return writes;
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::EndResultCacheWrites(std::vector<uint32> const& writes)
+{
+    for (uint32 index : writes)
+        _resultCache->EndWrite(index);
+}
+
+template <class T>
+T* DatabaseWorkerPool<T>::GetFreeConnection(InternalIndex type /*= IDX_SYNCH*/)
 {
 #ifdef ACORE_DEBUG
     if (_warnSyncQueries)
@@ -490,13 +1017,13 @@ T* DatabaseWorkerPool<T>::GetFreeConnection()
 #endif
 
     uint8 i = 0;
-    auto const num_cons = _connections[IDX_SYNCH].size();
+    auto const num_cons = _connections[type].size();
     T* connection = nullptr;
 
     //! Block forever until a connection is free
     for (;;)
     {
-        connection = _connections[IDX_SYNCH][++i % num_cons].get();
+        connection = _connections[type][++i % num_cons].get();
         //! Must be matched with t->Unlock() or you will get deadlocks
         if (connection->LockIfReady())
             break;
@@ -517,6 +1044,15 @@ void DatabaseWorkerPool<T>::Execute(std::string_view sql)
     if (sql.empty())
         return;
 
+    if (_journal)
+    {
+        SQLElementData const element{ std::string(sql), SQL_ELEMENT_RAW };
+        uint64 sequence = 0;
+        if (JournalWrite({ &element, 1 }, false, sequence))
+            EnqueueWrite<BasicStatementTask>({}, sequence, sql);
+        return;
+    }
+
     BasicStatementTask* task = new BasicStatementTask(sql);
     Enqueue(task);
 }
@@ -524,6 +1060,20 @@ void DatabaseWorkerPool<T>::Execute(std::string_view sql)
 template <class T>
 void DatabaseWorkerPool<T>::Execute(PreparedStatement<T>* stmt)
 {
+    if (_journal || _resultCache)
+    {
+        SQLElementData const element{ stmt, SQL_ELEMENT_PREPARED };
+        uint64 sequence = 0;
+        if (_journal && !JournalWrite({ &element, 1 }, false, sequence))
+        {
+            delete stmt;
+            return;
+        }
+
+        EnqueueWrite<PreparedStatementTask>({ &element, 1 }, sequence, stmt);
+        return;
+    }
+
     PreparedStatementTask* task = new PreparedStatementTask(stmt);
     Enqueue(task);
 }
@@ -542,10 +1092,18 @@ void DatabaseWorkerPool<T>::DirectExecute(std::string_view sql)
 template <class T>
 void DatabaseWorkerPool<T>::DirectExecute(PreparedStatement<T>* stmt)
 {
+    uint32 const index = stmt->GetIndex();
+    bool const invalidating = _resultCache && _resultCache->IsInvalidating(index);
+    if (invalidating)
+        _resultCache->BeginWrite(index);
+
     T* connection = GetFreeConnection();
     connection->Execute(stmt);
     connection->Unlock();
 
+    if (invalidating)
+        _resultCache->EndWrite(index);
+
     //! Delete proxy-class. Not needed anymore
     delete stmt;
 }
@@ -20,8 +20,12 @@
 
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
+#include "Duration.h"
 #include "StringFormat.h"
 #include <array>
+#include <atomic>
+#include <functional>
+#include <span>
 #include <vector>
 
 /** @file DatabaseWorkerPool.h */
@@ -41,8 +45,12 @@
 template <typename T>
 class ProducerConsumerQueue;
 
+class DatabaseJournal;
+class QueryResultCache;
 class SQLOperation;
+class StatementStats;
 struct MySQLConnectionInfo;
+struct SQLElementData;
 
 template <class T>
 class DatabaseWorkerPool
@@ -52,6 +60,8 @@ private:
     {
         IDX_ASYNC,
         IDX_SYNCH,
+        IDX_REPLICA_ASYNC,
+        IDX_REPLICA_SYNCH,
         IDX_SIZE
     };
 
@@ -60,7 +70,20 @@ public:
     DatabaseWorkerPool();
     ~DatabaseWorkerPool();
 
-    void SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads);
+    void SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads, uint32 const batchSize = 1);
+
+    //! Optional read replica, statements prepared with a *_REPLICA connection flag are served by it
+    //! while its replication lag stays below maxLagSeconds.
+    void SetReplicaConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads, uint32 const maxLagSeconds);
+
+    //! Caches results of the statements registered through CacheStatementResults for up to ttl.
+    //! Must be called before PrepareStatements.
+    void EnableResultCache(Milliseconds ttl);
+
+    //! Records async writes in a journal before queueing them, see DatabaseJournal. Writes left over from a crash
+    //! are queued again right away, so this must be called after PrepareStatements.
+    //! Writes are spooled to the journal instead of queued while more than spoolThreshold operations are queued.
+    bool EnableJournal(std::string const& fileName, std::size_t spoolThreshold);
 
     uint32 Open();
     void Close();
@@ -143,6 +166,27 @@ public:
     //! Statement must be prepared with CONNECTION_SYNCH flag.
     PreparedQueryResult Query(PreparedStatement<T>* stmt);
 
+    //! Directly executes an SQL query in string format and passes every row to handler while it is read from the server,
+    //! without buffering the whole result set on the client. Meant for loaders of big tables.
+    //! Fields are only valid during the handler call. The connection stays locked until all rows were handled,
+    //! so handler must not run synchronous queries on this pool. Returns the number of rows handled.
+    uint64 StreamQuery(std::string_view sql, std::function<void(Field* fields)> const& handler);
+
+    //! Same as Query(std::string_view) but executed on the read replica when it is usable.
+    //! Only use for reads that tolerate the configured replication lag.
+    QueryResult ReplicaQuery(std::string_view sql);
+
+    //! Same as Query(std::string_view, Args&&...) but executed on the read replica when it is usable.
+    //! Only use for reads that tolerate the configured replication lag.
+    template<typename... Args>
+    QueryResult ReplicaQuery(std::string_view sql, Args&&... args)
+    {
+        if (sql.empty())
+            return QueryResult(nullptr);
+
+        return ReplicaQuery(Acore::StringFormat(sql, std::forward<Args>(args)...));
+    }
+
     /**
         Asynchronous query (with resultset) methods.
     */
@@ -162,6 +206,13 @@ public:
     //! Any prepared statements added to this holder need to be prepared with the CONNECTION_ASYNC flag.
     SQLQueryHolderCallback DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder);
 
+    //! Same as AsyncQuery, for a QueryTask coroutine: co_await the return value to get the result.
+    QueryAwaiter AwaitQuery(std::string_view sql);
+
+    //! Same as AsyncQuery, for a QueryTask coroutine: co_await the return value to get the result.
+    //! Statement must be prepared with CONNECTION_ASYNC flag.
+    PreparedQueryAwaiter AwaitQuery(PreparedStatement<T>* stmt);
+
     /**
         Transaction context methods.
     */
@@ -177,6 +228,9 @@ public:
     //! were appended to the transaction will be respected during execution.
     TransactionCallback AsyncCommitTransaction(SQLTransaction<T> transaction);
 
+    //! Same as AsyncCommitTransaction, for a QueryTask coroutine: co_await the return value to know whether it succeeded.
+    TransactionAwaiter AwaitCommitTransaction(SQLTransaction<T> transaction);
+
     //! Directly executes a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
     //! were appended to the transaction will be respected during execution.
     void DirectCommitTransaction(SQLTransaction<T>& transaction);
@@ -215,16 +269,44 @@ public:
 
     [[nodiscard]] std::size_t QueueSize() const;
 
+    //! True while a replica is configured and its last lag check passed, re-checks the lag when due
+    bool IsReplicaUsable();
+
+    //! Latencies of the prepared statements of all connections, null until PrepareStatements ran
+    [[nodiscard]] StatementStats* GetStatementStats() const { return _statementStats.get(); }
+
 private:
     uint32 OpenConnections(InternalIndex type, uint8 numConnections);
+    uint32 OpenReplicaConnections();
+    void CloseReplicaConnections();
+
+    //! True if the statement may be served by the replica right now
+    bool CanUseReplica(uint32 index);
+
+    //! Marks the statements invalidating cached results as pending writes, returns their indices
+    std::vector<uint32> BeginResultCacheWrites(std::span<SQLElementData const> elements);
+    void EndResultCacheWrites(std::vector<uint32> const& writes);
 
     unsigned long EscapeString(char* to, char const* from, unsigned long length);
 
     void Enqueue(SQLOperation* op);
 
+    //! Enqueues async reads, they are held back while writes issued before them are spooled in the journal
+    void EnqueueOrdered(SQLOperation* op);
+
+    //! Enqueues a write task, tracked by the result cache and the journal if needed
+    template <class Task, typename... Args>
+    void EnqueueWrite(std::span<SQLElementData const> elements, uint64 sequence, Args&&... args);
+
+    //! Records the write in the journal, returns false if it was spooled (the caller frees it then)
+    bool JournalWrite(std::span<SQLElementData const> elements, bool transaction, uint64& sequence);
+
+    //! Rebuilds and enqueues a write recorded in the journal, false if it does not match the prepared statements
+    bool EnqueueJournaled(std::string_view payload, uint64 sequence);
+
     //! Gets a free connection in the synchronous connection pool.
     //! Caller MUST call t->Unlock() after touching the MySQL context to prevent deadlocks.
-    T* GetFreeConnection();
+    T* GetFreeConnection(InternalIndex type = IDX_SYNCH);
 
     [[nodiscard]] std::string_view GetDatabaseName() const;
 
@@ -234,6 +316,25 @@ private:
     std::unique_ptr<MySQLConnectionInfo> _connectionInfo;
     std::vector<uint8> _preparedStatementSize;
     uint8 _async_threads, _synch_threads;
+
+    //! Read replica, only used when a replica connection info was set
+    std::unique_ptr<ProducerConsumerQueue<SQLOperation*>> _replicaQueue;
+    std::unique_ptr<MySQLConnectionInfo> _replicaConnectionInfo;
+    std::vector<bool> _replicaStatements;
+    uint8 _replica_async_threads, _replica_synch_threads;
+    uint32 _replicaMaxLag;
+    std::atomic<bool> _replicaUsable;
+    std::atomic<uint32> _lastReplicaCheck;
+
+    //! Prepared statement results, only set when enabled
+    std::unique_ptr<QueryResultCache> _resultCache;
+
+    std::unique_ptr<StatementStats> _statementStats;
+
+    //! Async write journal, only set when enabled
+    std::unique_ptr<DatabaseJournal> _journal;
+    std::size_t _journalSpoolThreshold;
+    std::vector<bool> _journalStatements;   // statements prepared on the async connections
 #ifdef ACORE_DEBUG
     static inline thread_local bool _warnSyncQueries = false;
 #endif
@@ -22,6 +22,7 @@
 #include "MySQLPreparedStatement.h"
 #include "PreparedStatement.h"
 #include "QueryResult.h"
+#include "StatementStats.h"
 #include "StringConvert.h"
 #include "Timer.h"
 #include "Tokenize.h"
@@ -53,7 +54,8 @@ MySQLConnection::MySQLConnection(MySQLConnectionInfo& connInfo) :
     m_Mysql(nullptr),
     m_queue(nullptr),
     m_connectionInfo(connInfo),
-    m_connectionFlags(CONNECTION_SYNCH) { }
+    m_connectionFlags(CONNECTION_SYNCH),
+    m_statementStats(nullptr) { }
 
 MySQLConnection::MySQLConnection(ProducerConsumerQueue<SQLOperation*>* queue, MySQLConnectionInfo& connInfo) :
     m_reconnecting(false),
@@ -61,9 +63,10 @@ MySQLConnection::MySQLConnection(ProducerConsumerQueue<SQLOperation*>* queue, My
     m_Mysql(nullptr),
     m_queue(queue),
     m_connectionInfo(connInfo),
-    m_connectionFlags(CONNECTION_ASYNC)
+    m_connectionFlags(CONNECTION_ASYNC),
+    m_statementStats(nullptr)
 {
-    m_worker = std::make_unique<DatabaseWorker>(m_queue, this);
+    m_worker = std::make_unique<DatabaseWorker>(m_queue, this, connInfo);
 }
 
 MySQLConnection::~MySQLConnection()
@@ -168,6 +171,7 @@ uint32 MySQLConnection::Open()
 
 bool MySQLConnection::PrepareStatements()
 {
+    m_cachedStatements.clear();
     DoPrepareStatements();
     return !m_prepareError;
 }
@@ -215,6 +219,7 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
     MYSQL_BIND* msql_BIND = m_mStmt->GetBind();
 
     uint32 _s = getMSTime();
+    TimePoint const start = std::chrono::steady_clock::now();
 
 #if MYSQL_VERSION_ID >= 80300
     if (mysql_stmt_bind_named_param(msql_STMT, msql_BIND, m_mStmt->GetParameterCount(), nullptr))
@@ -224,6 +229,7 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
     {
         uint32 lErrno = mysql_errno(m_Mysql);
         LOG_ERROR("sql.sql", "SQL(p): {}\n [ERROR]: [{}] {}", m_mStmt->getQueryString(), lErrno, mysql_stmt_error(msql_STMT));
+        RecordStatement(index, start, 0, true);
 
         if (_HandleMySQLErrno(lErrno, mysql_stmt_error(msql_STMT)))  // If it returns true, an error was handled successfully (i.e. reconnection)
             return Execute(stmt);       // Try again
@@ -236,6 +242,7 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
     {
         uint32 lErrno = mysql_errno(m_Mysql);
         LOG_ERROR("sql.sql", "SQL(p): {}\n [ERROR]: [{}] {}", m_mStmt->getQueryString(), lErrno, mysql_stmt_error(msql_STMT));
+        RecordStatement(index, start, 0, true);
 
         if (_HandleMySQLErrno(lErrno, mysql_stmt_error(msql_STMT)))  // If it returns true, an error was handled successfully (i.e. reconnection)
             return Execute(stmt);       // Try again
@@ -245,6 +252,7 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
     }
 
     LOG_DEBUG("sql.sql", "[{} ms] SQL(p): {}", getMSTimeDiff(_s, getMSTime()), m_mStmt->getQueryString());
+    RecordStatement(index, start, mysql_stmt_affected_rows(msql_STMT), false);
 
     m_mStmt->ClearParameters();
     return true;
@@ -323,6 +331,38 @@ ResultSet* MySQLConnection::Query(std::string_view sql)
     return new ResultSet(result, fields, rowCount, fieldCount);
 }
 
+ResultSet* MySQLConnection::StreamQuery(std::string_view sql)
+{
+    if (sql.empty() || !m_Mysql)
+        return nullptr;
+
+    uint32 _s = getMSTime();
+
+    if (mysql_query(m_Mysql, std::string(sql).c_str()))
+    {
+        uint32 lErrno = mysql_errno(m_Mysql);
+        LOG_INFO("sql.sql", "SQL: {}", sql);
+        LOG_ERROR("sql.sql", "[{}] {}", lErrno, mysql_error(m_Mysql));
+
+        if (_HandleMySQLErrno(lErrno, mysql_error(m_Mysql))) // If it returns true, an error was handled successfully (i.e. reconnection)
+            return StreamQuery(sql);    // We try again
+
+        return nullptr;
+    }
+    else
+        LOG_DEBUG("sql.sql", "[{} ms] SQL: {}", getMSTimeDiff(_s, getMSTime()), sql);
+
+    // rows stay on the server until fetched, so the row count is unknown here
+    MySQLResult* result = reinterpret_cast<MySQLResult*>(mysql_use_result(m_Mysql));
+    if (!result)
+        return nullptr;
+
+    uint32 fieldCount = mysql_field_count(m_Mysql);
+    MySQLField* fields = reinterpret_cast<MySQLField*>(mysql_fetch_fields(result));
+
+    return new ResultSet(result, fields, 0, fieldCount);
+}
+
 bool MySQLConnection::_Query(std::string_view sql, MySQLResult** pResult, MySQLField** pFields, uint64* pRowCount, uint32* pFieldCount)
 {
     if (!m_Mysql)
@@ -502,6 +542,11 @@ MySQLPreparedStatement* MySQLConnection::GetPreparedStatement(uint32 index)
     return ret;
 }
 
+void MySQLConnection::CacheStatementResults(uint32 index, std::vector<uint32> invalidatedBy)
+{
+    m_cachedStatements.emplace_back(index, std::move(invalidatedBy));
+}
+
 void MySQLConnection::PrepareStatement(uint32 index, std::string_view sql, ConnectionFlags flags)
 {
     // Check if specified query should be prepared on this connection
@@ -541,15 +586,29 @@ PreparedResultSet* MySQLConnection::Query(PreparedStatementBase* stmt)
     uint64 rowCount = 0;
     uint32 fieldCount = 0;
 
+    // includes fetching the rows, that is part of what the statement costs
+    TimePoint const start = std::chrono::steady_clock::now();
+
     if (!_Query(stmt, &mysqlStmt, &result, &rowCount, &fieldCount))
+    {
+        RecordStatement(stmt->GetIndex(), start, 0, true);
         return nullptr;
+    }
 
     if (mysql_more_results(m_Mysql))
     {
         mysql_next_result(m_Mysql);
     }
 
-    return new PreparedResultSet(mysqlStmt->GetSTMT(), result, rowCount, fieldCount);
+    PreparedResultSet* resultSet = new PreparedResultSet(mysqlStmt->GetSTMT(), result, rowCount, fieldCount);
+    RecordStatement(stmt->GetIndex(), start, resultSet->GetRowCount(), false);
+    return resultSet;
+}
+
+void MySQLConnection::RecordStatement(uint32 index, TimePoint start, uint64 rows, bool error)
+{
+    if (m_statementStats)
+        m_statementStats->Record(index, std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - start), rows, error);
 }
 
 bool MySQLConnection::_HandleMySQLErrno(uint32 errNo, char const* err, uint8 attempts /*= 5*/)
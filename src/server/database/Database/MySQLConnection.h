@@ -20,6 +20,7 @@
 
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
+#include "Duration.h"
 #include <map>
 #include <mutex>
 #include <string>
@@ -31,12 +32,17 @@ class ProducerConsumerQueue;
 class DatabaseWorker;
 class MySQLPreparedStatement;
 class SQLOperation;
+class StatementStats;
 
 enum ConnectionFlags
 {
     CONNECTION_ASYNC = 0x1,
     CONNECTION_SYNCH = 0x2,
-    CONNECTION_BOTH = CONNECTION_ASYNC | CONNECTION_SYNCH
+    CONNECTION_BOTH = CONNECTION_ASYNC | CONNECTION_SYNCH,
+    CONNECTION_REPLICA = 0x4,                                       // also prepared on read replica connections
+    CONNECTION_ASYNC_REPLICA = CONNECTION_ASYNC | CONNECTION_REPLICA,
+    CONNECTION_SYNCH_REPLICA = CONNECTION_SYNCH | CONNECTION_REPLICA,
+    CONNECTION_BOTH_REPLICA = CONNECTION_BOTH | CONNECTION_REPLICA
 };
 
 struct AC_DATABASE_API MySQLConnectionInfo
@@ -49,6 +55,8 @@ struct AC_DATABASE_API MySQLConnectionInfo
     std::string host;
     std::string port_or_socket;
     std::string ssl;
+
+    uint32 batch_size{1}; //! Max consecutive one-way async statements committed together, 1 disables batching
 };
 
 class AC_DATABASE_API MySQLConnection
@@ -71,6 +79,9 @@ public:
     bool Execute(std::string_view sql);
     bool Execute(PreparedStatementBase* stmt);
     ResultSet* Query(std::string_view sql);
+    //! Same as Query(std::string_view) but ResultSet::NextRow reads the rows from the server one by one.
+    //! Nothing else can run on this connection until the result set is destroyed.
+    ResultSet* StreamQuery(std::string_view sql);
     PreparedResultSet* Query(PreparedStatementBase* stmt);
     bool _Query(std::string_view sql, MySQLResult** pResult, MySQLField** pFields, uint64* pRowCount, uint32* pFieldCount);
     bool _Query(PreparedStatementBase* stmt, MySQLPreparedStatement** mysqlStmt, MySQLResult** pResult, uint64* pRowCount, uint32* pFieldCount);
@@ -96,6 +107,9 @@ protected:
     [[nodiscard]] std::string GetServerInfo() const;
     MySQLPreparedStatement* GetPreparedStatement(uint32 index);
     void PrepareStatement(uint32 index, std::string_view sql, ConnectionFlags flags);
+    //! Lets the pool cache the results of index (if its result cache is enabled), they are dropped whenever one of invalidatedBy is executed.
+    //! Writes through ad-hoc sql are not tracked, every statement changing the data read by index must be listed.
+    void CacheStatementResults(uint32 index, std::vector<uint32> invalidatedBy);
 
     virtual void DoPrepareStatements() = 0;
     virtual bool _HandleMySQLErrno(uint32 errNo, char const* err = "", uint8 attempts = 5);
@@ -103,6 +117,7 @@ protected:
     typedef std::vector<std::unique_ptr<MySQLPreparedStatement>> PreparedStatementContainer;
 
     PreparedStatementContainer m_stmts; //! PreparedStatements storage
+    std::vector<std::pair<uint32, std::vector<uint32>>> m_cachedStatements; //! Statements the pool may cache results of
     bool m_reconnecting;  //! Are we reconnecting?
     bool m_prepareError;  //! Was there any error while preparing statements?
     MySQLHandle* m_Mysql; //! MySQL Handle.
@@ -112,8 +127,11 @@ private:
     std::unique_ptr<DatabaseWorker> m_worker;           //! Core worker task.
     MySQLConnectionInfo& m_connectionInfo;              //! Connection info (used for logging)
     ConnectionFlags m_connectionFlags;                  //! Connection flags (for preparing relevant statements)
+    StatementStats* m_statementStats;                   //! Per statement latencies, owned by the pool
     std::mutex m_Mutex;
 
+    void RecordStatement(uint32 index, TimePoint start, uint64 rows, bool error);
+
     MySQLConnection(MySQLConnection const& right) = delete;
     MySQLConnection& operator=(MySQLConnection const& right) = delete;
 };
@@ -42,6 +42,8 @@ public:
     void BindParameters(PreparedStatementBase* stmt);
 
     uint32 GetParameterCount() const { return m_paramCount; }
+    //! Query string with the parameter placeholders, valid while no parameters are bound
+    std::string const& GetQueryTemplate() const { return m_queryString; }
 
 protected:
     void SetParameter(const uint8 index, bool value);
@@ -67,6 +67,7 @@ struct PreparedStatementData
 class AC_DATABASE_API PreparedStatementBase
 {
 friend class PreparedStatementTask;
+friend class DatabaseJournal;
 
 public:
     explicit PreparedStatementBase(uint32 index, uint8 capacity);
@@ -173,6 +174,7 @@ public:
     ~PreparedStatementTask() override;
 
     bool Execute() override;
+    [[nodiscard]] bool IsBatchable() const override { return !m_has_result; }
     PreparedQueryResultFuture GetFuture() { return m_result->get_future(); }
 
 protected:
@@ -227,3 +227,23 @@ bool QueryCallback::InvokeIfReady()
 
     return false;
 }
+
+bool QueryCallback::IsReady() const
+{
+    if (!_isPrepared)
+        return _string.valid() && _string.wait_for(0s) == std::future_status::ready;
+
+    return _prepared.valid() && _prepared.wait_for(0s) == std::future_status::ready;
+}
+
+QueryResult QueryCallback::GetResult()
+{
+    ASSERT(!_isPrepared, "Attempted to get the result of a prepared async query as a string query result");
+    return _string.get();
+}
+
+PreparedQueryResult QueryCallback::GetPreparedResult()
+{
+    ASSERT(_isPrepared, "Attempted to get the result of a string async query as a prepared query result");
+    return _prepared.get();
+}
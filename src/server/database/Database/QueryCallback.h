@@ -47,6 +47,11 @@ public:
     // returns true when completed
     bool InvokeIfReady();
 
+    // result of a query without callbacks, awaited by a QueryTask
+    [[nodiscard]] bool IsReady() const;
+    QueryResult GetResult();
+    PreparedQueryResult GetPreparedResult();
+
 private:
     QueryCallback(QueryCallback const& right) = delete;
     QueryCallback& operator=(QueryCallback const& right) = delete;
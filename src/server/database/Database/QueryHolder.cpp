@@ -85,6 +85,20 @@ bool SQLQueryHolderTask::Execute()
     return true;
 }
 
+bool SQLQueryHolderPartTask::Execute()
+{
+    /// every part writes distinct result slots, the holder's vector is never resized meanwhile
+    for (std::size_t i = m_part; i < m_holder->m_queries.size(); i += m_partCount)
+        if (PreparedStatementBase* stmt = m_holder->m_queries[i].first)
+            m_holder->SetPreparedResult(i, m_conn->Query(stmt));
+
+    // acq_rel makes the results of all other parts visible to whoever waits on the future
+    if (m_state->Remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        m_state->Result.set_value();
+
+    return true;
+}
+
 bool SQLQueryHolderCallback::InvokeIfReady()
 {
     if (m_future.valid() && m_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
@@ -19,16 +19,19 @@
 #define _QUERYHOLDER_H
 
 #include "SQLOperation.h"
+#include <atomic>
 #include <vector>
 
 class AC_DATABASE_API SQLQueryHolderBase
 {
 friend class SQLQueryHolderTask;
+friend class SQLQueryHolderPartTask;
 
 public:
     SQLQueryHolderBase() = default;
     virtual ~SQLQueryHolderBase();
     void SetSize(std::size_t size);
+    [[nodiscard]] std::size_t GetSize() const { return m_queries.size(); }
     PreparedQueryResult GetPreparedResult(std::size_t index) const;
     void SetPreparedResult(std::size_t index, PreparedResultSet* result);
 
@@ -65,6 +68,32 @@ private:
     QueryResultHolderPromise m_result;
 };
 
+//! Executes every partCount-th query of a holder starting at part, so the queries
+//! of one holder can run on several connections at once. The part finishing last
+//! completes the future shared by all parts.
+class AC_DATABASE_API SQLQueryHolderPartTask : public SQLOperation
+{
+public:
+    struct SharedState
+    {
+        explicit SharedState(std::size_t parts) : Remaining(parts) { }
+
+        std::atomic<std::size_t> Remaining;
+        QueryResultHolderPromise Result;
+    };
+
+    SQLQueryHolderPartTask(std::shared_ptr<SQLQueryHolderBase> holder, std::shared_ptr<SharedState> state, std::size_t part, std::size_t partCount)
+        : m_holder(std::move(holder)), m_state(std::move(state)), m_part(part), m_partCount(partCount) { }
+
+    bool Execute() override;
+
+private:
+    std::shared_ptr<SQLQueryHolderBase> m_holder;
+    std::shared_ptr<SharedState> m_state;
+    std::size_t m_part;
+    std::size_t m_partCount;
+};
+
 class AC_DATABASE_API SQLQueryHolderCallback
 {
 public:
@@ -377,6 +377,19 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
     mysql_stmt_free_result(m_stmt);
 }
 
+PreparedResultSet::PreparedResultSet(std::shared_ptr<PreparedResultSet const> source) :
+    m_rows(source->m_rows),
+    m_rowCount(source->m_rowCount),
+    m_rowPosition(0),
+    m_fieldCount(source->m_fieldCount),
+    m_rBind(nullptr),
+    m_stmt(nullptr),
+    m_metadataResult(nullptr),
+    m_source(std::move(source))
+{
+    // fields keep pointing to the data and metadata of the source
+}
+
 PreparedResultSet::~PreparedResultSet()
 {
     CleanUp();
@@ -21,6 +21,7 @@
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
 #include "Field.h"
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -99,6 +100,8 @@ class AC_DATABASE_API PreparedResultSet
 {
 public:
     PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint64 rowCount, uint32 fieldCount);
+    //! Independent cursor over the rows of source, which is kept alive by it
+    explicit PreparedResultSet(std::shared_ptr<PreparedResultSet const> source);
     ~PreparedResultSet();
 
     bool NextRow();
@@ -138,6 +141,7 @@ private:
     MySQLBind* m_rBind;
     MySQLStmt* m_stmt;
     MySQLResult* m_metadataResult;    ///< Field metadata, returned by mysql_stmt_result_metadata
+    std::shared_ptr<PreparedResultSet const> m_source;    ///< Owner of the row data for cursors
 
     void CleanUp();
     bool _NextRow();
@@ -0,0 +1,156 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "QueryResultCache.h"
+#include "Errors.h"
+#include "Metric.h"
+#include "PreparedStatement.h"
+#include "QueryResult.h"
+#include "StringFormat.h"
+#include "Util.h"
+#include <algorithm>
+
+/// Cached results per statement, all of them are dropped when the limit is hit
+static constexpr std::size_t MAX_CACHED_RESULTS_PER_STATEMENT = 4096;
+
+void QueryResultCache::Register(uint32 index, std::vector<uint32> const& invalidatedBy)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    if (_statements.size() <= index)
+        _statements.resize(index + 1);
+
+    _statements[index].Registered = true;
+
+    for (uint32 writeIndex : invalidatedBy)
+    {
+        if (_writes.size() <= writeIndex)
+            _writes.resize(writeIndex + 1);
+
+        _writes[writeIndex].push_back(index);
+    }
+}
+
+std::string QueryResultCache::BuildKey(PreparedStatementBase const* stmt)
+{
+    std::string key;
+    for (PreparedStatementData const& param : stmt->GetParameters())
+    {
+        std::visit([&key](auto const& value)
+        {
+            using Type = std::decay_t<decltype(value)>;
+            if constexpr (std::is_same_v<Type, std::vector<uint8>>)
+                key += Acore::StringFormat("B{}:{};", value.size(), ByteArrayToHexStr(value));
+            else if constexpr (std::is_same_v<Type, std::string>)
+                key += Acore::StringFormat("S{}:{};", value.size(), value);
+            else if constexpr (std::is_same_v<Type, std::nullptr_t>)
+                key += "N;";
+            else
+                key += Acore::StringFormat("{};", value);
+        }, param.data);
+    }
+
+    return key;
+}
+
+bool QueryResultCache::Find(PreparedStatementBase const* stmt, PreparedQueryResult& result, Lookup& lookup)
+{
+    uint32 const index = stmt->GetIndex();
+    lookup.Key = BuildKey(stmt);
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+
+        Statement& statement = _statements[index];
+        lookup.Generation = statement.Generation;
+
+        auto itr = statement.Entries.find(lookup.Key);
+        if (itr != statement.Entries.end())
+        {
+            if (itr->second.Expires > std::chrono::steady_clock::now())
+            {
+                // handed out as cursor, callers iterate their own copy of the row position
+                result = itr->second.Result ? std::make_shared<PreparedResultSet>(itr->second.Result) : nullptr;
+
+                METRIC_VALUE("db_result_cache_hit", uint64(1),
+                    METRIC_TAG("database", _databaseName),
+                    METRIC_TAG("statement", std::to_string(index)));
+                return true;
+            }
+
+            statement.Entries.erase(itr);
+        }
+    }
+
+    METRIC_VALUE("db_result_cache_miss", uint64(1),
+        METRIC_TAG("database", _databaseName),
+        METRIC_TAG("statement", std::to_string(index)));
+    return false;
+}
+
+PreparedQueryResult QueryResultCache::Store(uint32 index, Lookup const& lookup, PreparedResultSet* result)
+{
+    // query failed, nothing known about the data
+    if (!result)
+        return nullptr;
+
+    PreparedQueryResult source;
+    if (result->GetRowCount())
+        source.reset(result);
+    else
+        delete result;
+
+    std::lock_guard<std::mutex> guard(_lock);
+
+    Statement& statement = _statements[index];
+
+    // a write was issued (or is still running) since the read started, the result may be stale already
+    if (statement.PendingWrites || statement.Generation != lookup.Generation)
+        return source;
+
+    if (statement.Entries.size() >= MAX_CACHED_RESULTS_PER_STATEMENT)
+        statement.Entries.clear();
+
+    statement.Entries[lookup.Key] = { source, std::chrono::steady_clock::now() + _ttl };
+
+    return source ? std::make_shared<PreparedResultSet>(source) : nullptr;
+}
+
+void QueryResultCache::BeginWrite(uint32 writeIndex)
+{
+    Invalidate(writeIndex, 1);
+}
+
+void QueryResultCache::EndWrite(uint32 writeIndex)
+{
+    Invalidate(writeIndex, -1);
+}
+
+void QueryResultCache::Invalidate(uint32 writeIndex, int32 pendingChange)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    for (uint32 index : _writes[writeIndex])
+    {
+        Statement& statement = _statements[index];
+        ASSERT(pendingChange > 0 || statement.PendingWrites > 0);
+
+        statement.PendingWrites += pendingChange;
+        ++statement.Generation;
+        statement.Entries.clear();
+    }
+}
@@ -0,0 +1,88 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _QUERYRESULTCACHE_H
+#define _QUERYRESULTCACHE_H
+
+#include "DatabaseEnvFwd.h"
+#include "Define.h"
+#include "Duration.h"
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Results of prepared statements, keyed by statement index and bound parameters.
+ *
+ * Every cached statement lists the statements writing the data it reads.
+ * Enqueueing one of those drops all cached results of the statement, and no
+ * result is stored while such a write is still pending or was issued during
+ * the read. Entries also expire after the configured TTL.
+ */
+class AC_DATABASE_API QueryResultCache
+{
+public:
+    struct Lookup
+    {
+        std::string Key;
+        uint32 Generation{0};
+    };
+
+    explicit QueryResultCache(Milliseconds ttl, std::string_view databaseName) : _ttl(ttl), _databaseName(databaseName) { }
+
+    void Register(uint32 index, std::vector<uint32> const& invalidatedBy);
+
+    [[nodiscard]] bool IsCached(uint32 index) const { return index < _statements.size() && _statements[index].Registered; }
+    [[nodiscard]] bool IsInvalidating(uint32 index) const { return index < _writes.size() && !_writes[index].empty(); }
+
+    /// Returns true and sets result to a new cursor over the cached rows on hit, fills lookup for Store on miss
+    bool Find(PreparedStatementBase const* stmt, PreparedQueryResult& result, Lookup& lookup);
+
+    /// Stores the result read for lookup unless a write invalidated it meanwhile, returns the result to hand out
+    PreparedQueryResult Store(uint32 index, Lookup const& lookup, PreparedResultSet* result);
+
+    /// Must be paired, the write counts as pending until EndWrite
+    void BeginWrite(uint32 writeIndex);
+    void EndWrite(uint32 writeIndex);
+
+private:
+    struct Entry
+    {
+        std::shared_ptr<PreparedResultSet> Result;
+        TimePoint Expires;
+    };
+
+    struct Statement
+    {
+        bool Registered{false};
+        uint32 Generation{0};
+        uint32 PendingWrites{0};
+        std::unordered_map<std::string, Entry> Entries;
+    };
+
+    static std::string BuildKey(PreparedStatementBase const* stmt);
+    void Invalidate(uint32 writeIndex, int32 pendingChange);
+
+    Milliseconds _ttl;
+    std::string _databaseName;
+    std::vector<Statement> _statements;
+    std::vector<std::vector<uint32>> _writes;   // write index -> cached statements it invalidates
+    std::mutex _lock;
+};
+
+#endif
@@ -0,0 +1,61 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "QueryTask.h"
+#include "Duration.h"
+
+void QueryTask::Awaiter::await_suspend(std::coroutine_handle<promise_type> handle) const
+{
+    handle.promise().Awaiting = this;
+}
+
+QueryTask& QueryTask::operator=(QueryTask&& right) noexcept
+{
+    if (this != &right)
+    {
+        if (_handle)
+            _handle.destroy();
+
+        _handle = std::exchange(right._handle, nullptr);
+    }
+
+    return *this;
+}
+
+QueryTask::~QueryTask()
+{
+    if (_handle)
+        _handle.destroy();
+}
+
+bool QueryTask::InvokeIfReady()
+{
+    if (_handle.done())
+        return true;
+
+    if (!_handle.promise().Awaiting->IsReady())
+        return false;
+
+    _handle.promise().Awaiting = nullptr;
+    _handle.resume();
+    return _handle.done();
+}
+
+bool TransactionAwaiter::IsReady() const
+{
+    return _transaction.m_future.valid() && _transaction.m_future.wait_for(0s) == std::future_status::ready;
+}
@@ -0,0 +1,116 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _QUERY_TASK_H
+#define _QUERY_TASK_H
+
+#include "QueryCallback.h"
+#include "Transaction.h"
+#include <coroutine>
+#include <utility>
+
+/*
+ * Coroutine for handlers issuing several asynchronous queries in a row.
+ *
+ * The handler co_awaits the awaiters returned by DatabaseWorkerPool::AwaitQuery
+ * and AwaitCommitTransaction instead of chaining callbacks. It runs until its
+ * first unfinished query, then the returned task is added to an
+ * AsyncCallbackProcessor<QueryTask> whose owner resumes it, on its own thread,
+ * once the result is available. The coroutine frame is the only allocation of
+ * the whole handler; destroying the task (with its owner) abandons it.
+ */
+class AC_DATABASE_API QueryTask
+{
+public:
+    struct promise_type;
+
+    class Awaiter
+    {
+    public:
+        [[nodiscard]] virtual bool IsReady() const = 0;
+
+        bool await_ready() const { return IsReady(); }
+        void await_suspend(std::coroutine_handle<promise_type> handle) const;
+
+    protected:
+        ~Awaiter() = default;
+    };
+
+    struct promise_type
+    {
+        QueryTask get_return_object() { return QueryTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_never initial_suspend() noexcept { return { }; }
+        std::suspend_always final_suspend() noexcept { return { }; }
+        void return_void() noexcept { }
+        void unhandled_exception() { throw; }
+
+        Awaiter const* Awaiting = nullptr;
+    };
+
+    QueryTask(QueryTask&& right) noexcept : _handle(std::exchange(right._handle, nullptr)) { }
+    QueryTask& operator=(QueryTask&& right) noexcept;
+    ~QueryTask();
+
+    // returns true when completed
+    bool InvokeIfReady();
+
+private:
+    explicit QueryTask(std::coroutine_handle<promise_type> handle) : _handle(handle) { }
+
+    QueryTask(QueryTask const& right) = delete;
+    QueryTask& operator=(QueryTask const& right) = delete;
+
+    std::coroutine_handle<promise_type> _handle;
+};
+
+class AC_DATABASE_API QueryAwaiter final : public QueryTask::Awaiter
+{
+public:
+    explicit QueryAwaiter(QueryCallback&& query) : _query(std::move(query)) { }
+
+    [[nodiscard]] bool IsReady() const override { return _query.IsReady(); }
+    QueryResult await_resume() { return _query.GetResult(); }
+
+private:
+    QueryCallback _query;
+};
+
+class AC_DATABASE_API PreparedQueryAwaiter final : public QueryTask::Awaiter
+{
+public:
+    explicit PreparedQueryAwaiter(QueryCallback&& query) : _query(std::move(query)) { }
+
+    [[nodiscard]] bool IsReady() const override { return _query.IsReady(); }
+    PreparedQueryResult await_resume() { return _query.GetPreparedResult(); }
+
+private:
+    QueryCallback _query;
+};
+
+class AC_DATABASE_API TransactionAwaiter final : public QueryTask::Awaiter
+{
+public:
+    explicit TransactionAwaiter(TransactionCallback&& transaction) : _transaction(std::move(transaction)) { }
+
+    [[nodiscard]] bool IsReady() const override;
+    bool await_resume() { return _transaction.m_future.get(); }
+
+private:
+    TransactionCallback _transaction;
+};
+
+#endif // _QUERY_TASK_H
@@ -53,6 +53,9 @@ public:
     virtual bool Execute() = 0;
     virtual void SetConnection(MySQLConnection* con) { m_conn = con; }
 
+    //! One-way statements nobody waits on, these can be committed together with their neighbours
+    [[nodiscard]] virtual bool IsBatchable() const { return false; }
+
     MySQLConnection* m_conn{nullptr};
 
 private:
@@ -0,0 +1,143 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StatementStats.h"
+#include "Errors.h"
+#include "Metric.h"
+#include <algorithm>
+#include <bit>
+
+StatementStats::StatementStats(std::string_view databaseName, std::size_t statementCount) :
+    _databaseName(databaseName),
+    _queryStrings(statementCount),
+    _total(std::make_unique<Counters[]>(statementCount)),
+    _interval(std::make_unique<Counters[]>(statementCount)),
+    _statementCount(statementCount)
+{
+}
+
+void StatementStats::SetQueryString(uint32 index, std::string_view sql)
+{
+    ASSERT(index < _statementCount);
+    _queryStrings[index] = sql;
+}
+
+void StatementStats::Record(uint32 index, Microseconds elapsed, uint64 rows, bool error)
+{
+    if (index >= _statementCount)
+        return;
+
+    uint64 const microseconds = std::max<int64>(elapsed.count(), 0);
+    std::size_t const bucket = std::min<std::size_t>(microseconds < 2 ? 0 : std::bit_width(microseconds) - 1, BUCKET_COUNT - 1);
+
+    _total[index].Add(microseconds, bucket, rows, error);
+    _interval[index].Add(microseconds, bucket, rows, error);
+}
+
+void StatementStats::Counters::Add(uint64 microseconds, std::size_t bucket, uint64 rows, bool error)
+{
+    Calls.fetch_add(1, std::memory_order_relaxed);
+    Rows.fetch_add(rows, std::memory_order_relaxed);
+    TotalMicroseconds.fetch_add(microseconds, std::memory_order_relaxed);
+    Buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+
+    if (error)
+        Errors.fetch_add(1, std::memory_order_relaxed);
+
+    uint64 max = MaxMicroseconds.load(std::memory_order_relaxed);
+    while (max < microseconds && !MaxMicroseconds.compare_exchange_weak(max, microseconds, std::memory_order_relaxed));
+}
+
+StatementStats::Snapshot StatementStats::Counters::Read(uint32 index, bool reset)
+{
+    auto read = [reset](std::atomic<uint64>& value)
+    {
+        return reset ? value.exchange(0, std::memory_order_relaxed) : value.load(std::memory_order_relaxed);
+    };
+
+    Snapshot snapshot;
+    snapshot.Index = index;
+    snapshot.Calls = read(Calls);
+    snapshot.Errors = read(Errors);
+    snapshot.Rows = read(Rows);
+    snapshot.Total = Microseconds(read(TotalMicroseconds));
+    snapshot.Max = Microseconds(read(MaxMicroseconds));
+
+    std::array<uint64, BUCKET_COUNT> buckets;
+    uint64 counted = 0;
+    for (std::size_t i = 0; i < BUCKET_COUNT; ++i)
+        counted += buckets[i] = read(Buckets[i]);
+
+    // calls and buckets are not read atomically together, the buckets are what the percentiles are based on
+    auto percentile = [&](uint64 permille)
+    {
+        uint64 const target = std::max<uint64>((counted * permille + 999) / 1000, 1);
+        uint64 seen = 0;
+        for (std::size_t i = 0; i + 1 < BUCKET_COUNT; ++i)
+        {
+            seen += buckets[i];
+            if (seen >= target)
+                return std::min(Microseconds(uint64(2) << i), snapshot.Max);
+        }
+
+        return snapshot.Max;
+    };
+
+    if (counted)
+    {
+        snapshot.P50 = percentile(500);
+        snapshot.P99 = percentile(990);
+    }
+
+    return snapshot;
+}
+
+std::vector<StatementStats::Snapshot> StatementStats::GetSnapshots() const
+{
+    std::vector<Snapshot> snapshots;
+    for (std::size_t i = 0; i < _statementCount; ++i)
+        if (_total[i].Calls.load(std::memory_order_relaxed))
+            snapshots.push_back(_total[i].Read(uint32(i), false));
+
+    std::sort(snapshots.begin(), snapshots.end(), [](Snapshot const& left, Snapshot const& right) { return left.Total > right.Total; });
+    return snapshots;
+}
+
+void StatementStats::Reset()
+{
+    for (std::size_t i = 0; i < _statementCount; ++i)
+        _total[i].Read(uint32(i), true);
+}
+
+void StatementStats::LogMetrics()
+{
+    for (std::size_t i = 0; i < _statementCount; ++i)
+    {
+        if (!_interval[i].Calls.load(std::memory_order_relaxed))
+            continue;
+
+        Snapshot const snapshot = _interval[i].Read(uint32(i), true);
+        std::string const index = std::to_string(i);
+
+        METRIC_VALUE("db_statement_calls", snapshot.Calls, METRIC_TAG("database", _databaseName), METRIC_TAG("statement", index));
+        METRIC_VALUE("db_statement_errors", snapshot.Errors, METRIC_TAG("database", _databaseName), METRIC_TAG("statement", index));
+        METRIC_VALUE("db_statement_rows", snapshot.Rows, METRIC_TAG("database", _databaseName), METRIC_TAG("statement", index));
+        METRIC_VALUE("db_statement_p50_us", uint64(snapshot.P50.count()), METRIC_TAG("database", _databaseName), METRIC_TAG("statement", index));
+        METRIC_VALUE("db_statement_p99_us", uint64(snapshot.P99.count()), METRIC_TAG("database", _databaseName), METRIC_TAG("statement", index));
+        METRIC_VALUE("db_statement_max_us", uint64(snapshot.Max.count()), METRIC_TAG("database", _databaseName), METRIC_TAG("statement", index));
+    }
+}
@@ -0,0 +1,90 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _STATEMENTSTATS_H
+#define _STATEMENTSTATS_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Latency histograms, row and error counts per prepared statement index.
+ *
+ * Recording only touches relaxed atomics, so every connection of a pool
+ * records into the same instance. Latencies go into power of two buckets
+ * (in microseconds), percentiles are reported as the upper bound of the
+ * bucket they fall in.
+ */
+class AC_DATABASE_API StatementStats
+{
+public:
+    struct Snapshot
+    {
+        uint32 Index{0};
+        uint64 Calls{0};
+        uint64 Errors{0};
+        uint64 Rows{0};
+        Microseconds Total{0};
+        Microseconds P50{0};
+        Microseconds P99{0};
+        Microseconds Max{0};
+    };
+
+    StatementStats(std::string_view databaseName, std::size_t statementCount);
+
+    void SetQueryString(uint32 index, std::string_view sql);
+    [[nodiscard]] std::string const& GetQueryString(uint32 index) const { return _queryStrings[index]; }
+    [[nodiscard]] std::string const& GetDatabaseName() const { return _databaseName; }
+
+    void Record(uint32 index, Microseconds elapsed, uint64 rows, bool error);
+
+    /// Statements executed since startup or the last Reset, sorted by total time spent
+    [[nodiscard]] std::vector<Snapshot> GetSnapshots() const;
+    void Reset();
+
+    /// Sends the statements executed since the previous call to the metric server
+    void LogMetrics();
+
+private:
+    static constexpr std::size_t BUCKET_COUNT = 24;   // last bucket holds everything above ~8s
+
+    struct Counters
+    {
+        std::atomic<uint64> Calls{0};
+        std::atomic<uint64> Errors{0};
+        std::atomic<uint64> Rows{0};
+        std::atomic<uint64> TotalMicroseconds{0};
+        std::atomic<uint64> MaxMicroseconds{0};
+        std::array<std::atomic<uint64>, BUCKET_COUNT> Buckets{};
+
+        void Add(uint64 microseconds, std::size_t bucket, uint64 rows, bool error);
+        Snapshot Read(uint32 index, bool reset);
+    };
+
+    std::string _databaseName;
+    std::vector<std::string> _queryStrings;
+    std::unique_ptr<Counters[]> _total;       // since startup or Reset, shown by .server dbstats
+    std::unique_ptr<Counters[]> _interval;    // since the last LogMetrics call
+    std::size_t _statementCount;
+};
+
+#endif
@@ -18,15 +18,23 @@
 #include "DBUpdater.h"
 #include "BuiltInConfig.h"
 #include "Config.h"
+#include "CryptoHash.h"
 #include "DatabaseEnv.h"
 #include "DatabaseLoader.h"
 #include "Log.h"
 #include "StartProcess.h"
 #include "UpdateFetcher.h"
 #include "QueryResult.h"
+#include "Timer.h"
+#include "Util.h"
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 std::string DBUpdaterUtil::GetCorrectedMySQLExecutable()
@@ -39,6 +47,10 @@ std::string DBUpdaterUtil::GetCorrectedMySQLExecutable()
 
 bool DBUpdaterUtil::CheckExecutable()
 {
+    // the databases are populated and updated concurrently
+    static std::mutex lock;
+    std::lock_guard<std::mutex> guard(lock);
+
     std::filesystem::path exe(GetCorrectedMySQLExecutable());
     if (!is_regular_file(exe))
     {
@@ -405,27 +417,73 @@ bool DBUpdater<T>::Populate(DatabaseWorkerPool<T>& pool)
             sqlFiles.push_back(entry.path());
     }
 
+    // The base files hold one table each and are applied in parallel,
+    // the largest ones first so they don't end up last on a single thread
     std::sort(sqlFiles.begin(), sqlFiles.end());
-
-    for (const auto &file : sqlFiles)
+    std::stable_sort(sqlFiles.begin(), sqlFiles.end(), [](std::filesystem::path const& left, std::filesystem::path const& right)
     {
-        LOG_INFO("sql.updates", ">> Applying \'{}\'...", file.filename().generic_string());
+        return std::filesystem::file_size(left) > std::filesystem::file_size(right);
+    });
 
-        try
-        {
-            ApplyFile(pool, file);
-        }
-        catch (UpdateException&)
+    std::size_t const threadCount = std::clamp<std::size_t>(sConfigMgr->GetOption<uint32>("Updates.ImportThreads", 4), 1, sqlFiles.size());
+    std::atomic<std::size_t> nextFile = 0;
+    std::atomic<bool> failed = false;
+    uint32 const startTime = getMSTime();
+
+    auto applyFiles = [&]()
+    {
+        for (std::size_t index = nextFile++; index < sqlFiles.size() && !failed; index = nextFile++)
         {
-            return false;
+            LOG_INFO("sql.updates", ">> Applying \'{}\' to {} ({}/{})...", sqlFiles[index].filename().generic_string(),
+                DBUpdater<T>::GetTableName(), index + 1, sqlFiles.size());
+
+            try
+            {
+                ApplyFile(pool, sqlFiles[index]);
+            }
+            catch (UpdateException&)
+            {
+                failed = true;
+            }
         }
-    }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount - 1);
+    for (std::size_t i = 1; i < threadCount; ++i)
+        workers.emplace_back(applyFiles);
+
+    applyFiles();
+
+    for (std::thread& worker : workers)
+        worker.join();
 
-    LOG_INFO("sql.updates", ">> Done!");
+    if (failed)
+        return false;
+
+    LOG_INFO("sql.updates", ">> Done! Applied {} files to {} in {} ms", sqlFiles.size(), DBUpdater<T>::GetTableName(), GetMSTimeDiffToNow(startTime));
     LOG_INFO("sql.updates", " ");
     return true;
 }
 
+template<class T>
+std::string DBUpdater<T>::GetUpdatesHash(DatabaseWorkerPool<T>& pool)
+{
+    QueryResult const result = Retrieve(pool, "SELECT `name`, `hash` FROM `updates` ORDER BY `name`");
+    if (!result)
+        return "";
+
+    Acore::Crypto::SHA1 hash;
+    do
+    {
+        Field* fields = result->Fetch();
+        hash.UpdateData(Acore::StringFormat("{}:{};", fields[0].Get<std::string>(), fields[1].Get<std::string>()));
+    } while (result->NextRow());
+
+    hash.Finalize();
+    return ByteArrayToHexStr(hash.GetDigest());
+}
+
 template<class T>
 QueryResult DBUpdater<T>::Retrieve(DatabaseWorkerPool<T>& pool, std::string const& query)
 {
@@ -455,7 +513,8 @@ void DBUpdater<T>::ApplyFile(DatabaseWorkerPool<T>& pool, std::string const& hos
 
     tempDir = Acore::String::AddSuffixIfNotExists(tempDir, std::filesystem::path::preferred_separator);
 
-    std::string confFileName = "mysql_ac.conf";
+    // one file per thread, files may be applied concurrently to databases with different credentials
+    std::string confFileName = Acore::StringFormat("mysql_ac_{}.conf", std::hash<std::thread::id>()(std::this_thread::get_id()));
 
     std::ofstream outfile (tempDir + confFileName);
 
@@ -512,6 +571,9 @@ void DBUpdater<T>::ApplyFile(DatabaseWorkerPool<T>& pool, std::string const& hos
     int const ret = Acore::StartProcess(DBUpdaterUtil::GetCorrectedMySQLExecutable(), args,
         "sql.updates", path.generic_string(), true);
 
+    std::error_code error;
+    std::filesystem::remove(tempDir + confFileName, error);
+
     if (ret != EXIT_SUCCESS)
     {
         LOG_FATAL("sql.updates", "Applying of file \'{}\' to database \'{}\' failed!" \
@@ -80,6 +80,10 @@ public:
     static bool Update(DatabaseWorkerPool<T>& pool, std::vector<std::string> const* setDirectories);
     static bool Populate(DatabaseWorkerPool<T>& pool);
 
+    // Hash over all applied updates (name and file hash), empty if the updates table is missing.
+    // Changes whenever an update is applied, removed or rehashed.
+    static std::string GetUpdatesHash(DatabaseWorkerPool<T>& pool);
+
     // module
     static std::string GetDBModuleName();
 
@@ -19,6 +19,7 @@
 #include "CharmInfo.h"
 #include "Creature.h"
 #include "Errors.h"
+#include "GridNotifiers.h"
 #include "Group.h"
 #include "ObjectAccessor.h"
 #include "Pet.h"
@@ -525,7 +526,7 @@ Unit* PetAI::SelectNextTarget(bool allowAutoSelect) const
     {
         if (!me->GetCharmInfo()->IsReturning() || me->GetCharmInfo()->IsFollowing() || me->GetCharmInfo()->IsAtStay())
         {
-            if (Unit* nearTarget = me->ToCreature()->SelectNearestTargetInAttackDistance(MAX_AGGRO_RADIUS))
+            if (Unit* nearTarget = SelectNearestTargetOfOwner(owner))
             {
                 if (nearTarget->IsPlayer() && nearTarget->ToPlayer()->IsPvP() && !owner->IsPvP()) // If owner is not PvP flagged and target is PvP flagged, do not attack
                 {
@@ -543,6 +544,31 @@ Unit* PetAI::SelectNextTarget(bool allowAutoSelect) const
     return nullptr;
 }
 
+Unit* PetAI::SelectNearestTargetOfOwner(Unit* owner) const
+{
+    // Summons follow their owner closely, so the first one to search answers for the others
+    // (army of the dead, treants, feral spirits) instead of each visiting the grid every update
+    static constexpr uint32 SharedSearchTime = 500;
+
+    Unit::ControlledTargetSearch& search = owner->m_controlledTargetSearch;
+    if (search.Time && getMSTimeDiff(search.Time, getMSTime()) < SharedSearchTime)
+    {
+        if (!search.Target)
+            return nullptr;
+
+        // same check as the search itself, from the position of this summon
+        Acore::NearestHostileUnitInAttackDistanceCheck check(me, MAX_AGGRO_RADIUS);
+        if (Unit* target = ObjectAccessor::GetUnit(*me, search.Target))
+            if (check(target))
+                return target;
+    }
+
+    Unit* target = me->SelectNearestTargetInAttackDistance(MAX_AGGRO_RADIUS);
+    search.Target = target ? target->GetGUID() : ObjectGuid::Empty;
+    search.Time = std::max<uint32>(getMSTime(), 1);
+    return target;
+}
+
 void PetAI::HandleReturnMovement()
 {
     // Handles moving the pet back to stay or owner
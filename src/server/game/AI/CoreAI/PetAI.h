@@ -85,6 +85,7 @@ private:
     float combatRange;
 
     Unit* SelectNextTarget(bool allowAutoSelect) const;
+    Unit* SelectNearestTargetOfOwner(Unit* owner) const;
     void HandleReturnMovement();
     void DoAttack(Unit* target, bool chase);
     bool CanAttack(Unit* target, SpellInfo const* spellInfo = nullptr);
@@ -386,6 +386,11 @@ void UnitAI::SortByDistance(std::list<Unit*>& list, bool ascending)
     list.sort(Acore::ObjectDistanceOrderPred(me, ascending));
 }
 
+void UnitAI::SortByDistance(Acore::FrameList<Unit*>& list, bool ascending)
+{
+    list.sort(Acore::ObjectDistanceOrderPred(me, ascending));
+}
+
 //Enable PlayerAI when charmed
 void PlayerAI::OnCharmed(bool apply)
 {
@@ -20,6 +20,7 @@
 
 #include "Containers.h"
 #include "Define.h"
+#include "FrameArena.h"
 #include "Unit.h"
 #include <list>
 
@@ -242,7 +243,7 @@ public:
         if (mgr.GetThreatListSize() <= position)
             return nullptr;
 
-        std::list<Unit*> targetList;
+        Acore::FrameList<Unit*> targetList(Acore::FrameArena::GetResource());
         SelectTargetList(targetList, mgr.GetThreatListSize(), targetType, position, predicate);
 
         // maybe nothing fulfills the predicate
@@ -278,8 +279,9 @@ public:
     // Select the best (up to) <num> targets (in <targetType> order) satisfying <predicate> from the threat list and stores them in <targetList> (which is cleared first).
     // If <offset> is nonzero, the first <offset> entries in <targetType> order (or SelectTargetMethod::MaxThreat
     // order, if <targetType> is SelectTargetMethod::Random) are skipped.
-    template <class PREDICATE>
-    void SelectTargetList(std::list<Unit*>& targetList, uint32 num, SelectTargetMethod targetType, uint32 position, PREDICATE const& predicate)
+    // <targetList> is a std::list<Unit*> or an Acore::FrameList<Unit*> of the frame arena.
+    template <class CONTAINER, class PREDICATE>
+    void SelectTargetList(CONTAINER& targetList, uint32 num, SelectTargetMethod targetType, uint32 position, PREDICATE const& predicate)
     {
         targetList.clear();
         ThreatMgr& mgr = GetThreatMgr();
@@ -423,6 +425,7 @@ public:
 private:
     ThreatMgr& GetThreatMgr();
     void SortByDistance(std::list<Unit*>& list, bool ascending = true);
+    void SortByDistance(Acore::FrameList<Unit*>& list, bool ascending = true);
 };
 
 class PlayerAI : public UnitAI
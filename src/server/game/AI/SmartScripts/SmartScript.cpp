@@ -134,32 +134,41 @@ void SmartScript::OnReset()
 
 void SmartScript::ProcessEventsFor(SMART_EVENT e, Unit* unit, uint32 var0, uint32 var1, bool bvar, SpellInfo const* spell, GameObject* gob)
 {
-    for (SmartAIEventList::iterator i = mEvents.begin(); i != mEvents.end(); ++i)
+    // only the events of this type, in the order of mEvents; links are never in the index (special handling)
+    auto range = std::equal_range(mEventIndex.begin(), mEventIndex.end(), std::make_pair(uint32(e), uint32(0)),
+        [](std::pair<uint32, uint32> const& left, std::pair<uint32, uint32> const& right) { return left.first < right.first; });
+
+    for (auto itr = range.first; itr != range.second; ++itr)
     {
-        SMART_EVENT eventType = SMART_EVENT((*i).GetEventType());
-        if (eventType == SMART_EVENT_LINK)//special handling
-            continue;
+        SmartScriptHolder& holder = mEvents[itr->second];
+        ConditionList conds = sConditionMgr->GetConditionsForSmartEvent(holder.entryOrGuid, holder.event_id, holder.source_type);
+        ConditionSourceInfo info = ConditionSourceInfo(unit, GetBaseObject(), me ? me->GetVictim() : nullptr);
 
-        if (eventType == e)
+        if (sConditionMgr->IsObjectMeetToConditions(info, conds))
         {
-            ConditionList conds = sConditionMgr->GetConditionsForSmartEvent((*i).entryOrGuid, (*i).event_id, (*i).source_type);
-            ConditionSourceInfo info = ConditionSourceInfo(unit, GetBaseObject(), me ? me->GetVictim() : nullptr);
-
-            if (sConditionMgr->IsObjectMeetToConditions(info, conds))
+            ASSERT(executionStack.empty());
+            executionStack.emplace_back(SmartScriptFrame{ holder, unit, var0, var1, bvar, spell, gob });
+            while (!executionStack.empty())
             {
-                ASSERT(executionStack.empty());
-                executionStack.emplace_back(SmartScriptFrame{ *i, unit, var0, var1, bvar, spell, gob });
-                while (!executionStack.empty())
-                {
-                    auto [stack_holder , stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob] = executionStack.back();
-                    executionStack.pop_back();
-                    ProcessEvent(stack_holder, stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob);
-                }
+                auto [stack_holder , stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob] = executionStack.back();
+                executionStack.pop_back();
+                ProcessEvent(stack_holder, stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob);
             }
         }
     }
 }
 
+void SmartScript::BuildEventIndex()
+{
+    mEventIndex.clear();
+    mEventIndex.reserve(mEvents.size());
+    for (uint32 i = 0; i < mEvents.size(); ++i)
+        if (mEvents[i].GetEventType() != SMART_EVENT_LINK)
+            mEventIndex.emplace_back(mEvents[i].GetEventType(), i);
+
+    std::sort(mEventIndex.begin(), mEventIndex.end());
+}
+
 void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, uint32 var1, bool bvar, SpellInfo const* spell, GameObject* gob)
 {
     e.runOnce = true;//used for repeat check
@@ -2517,14 +2526,14 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     {
                         for (uint32 wp = e.action.startClosestWaypoint.pathId1; wp <= e.action.startClosestWaypoint.pathId2; ++wp)
                         {
-                            WaypointPath* path = sSmartWaypointMgr->GetPath(wp);
+                            WaypointPath const* path = sSmartWaypointMgr->GetPath(wp);
                             if (!path || path->empty())
                                 continue;
 
                             auto itrWp = path->find(1);
                             if (itrWp != path->end())
                             {
-                                WaypointData& wpData = itrWp->second;
+                                WaypointData const& wpData = itrWp->second;
                                 float distToThisPath = creature->GetExactDistSq(wpData.x, wpData.y, wpData.z);
                                 if (distToThisPath < distanceToClosest)
                                 {
@@ -4623,7 +4632,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 }
                 else if (e.event.distance.entry != 0)
                 {
-                    std::list<Creature*> list;
+                    Acore::FrameList<Creature*> list(Acore::FrameArena::GetResource());
                     me->GetCreatureListWithEntryInGrid(list, e.event.distance.entry, (float)e.event.distance.dist);
 
                     if (!list.empty())
@@ -4994,6 +5003,7 @@ void SmartScript::InstallEvents()
             mEvents.push_back(*i);//must be before UpdateTimers
 
         mInstallEvents.clear();
+        BuildEventIndex();
     }
 }
 
@@ -5007,6 +5017,7 @@ void SmartScript::OnUpdate(uint32 const diff)
     if (mEventSortingRequired)
     {
         SortEvents(mEvents);
+        BuildEventIndex();
         mEventSortingRequired = false;
     }
 
@@ -5092,7 +5103,7 @@ void SmartScript::RetryLater(SmartScriptHolder& e, bool ignoreChanceRoll)
     e.runOnce = false;
 }
 
-void SmartScript::FillScript(SmartAIEventList e, WorldObject* obj, AreaTrigger const* at)
+void SmartScript::FillScript(SmartAIEventList const& e, WorldObject* obj, AreaTrigger const* at)
 {
     (void)at; // ensure that the variable is referenced even if extra logs are disabled in order to pass compiler checks
 
@@ -5105,7 +5116,8 @@ void SmartScript::FillScript(SmartAIEventList e, WorldObject* obj, AreaTrigger c
             LOG_DEBUG("sql.sql", "SmartScript: EventMap for AreaTrigger {} is empty but is using SmartScript.", at->entry);
         return;
     }
-    for (SmartAIEventList::iterator i = e.begin(); i != e.end(); ++i)
+    mEvents.reserve(mEvents.size() + e.size());
+    for (SmartAIEventList::const_iterator i = e.begin(); i != e.end(); ++i)
     {
 #ifndef ACORE_DEBUG
         if ((*i).event.event_flags & SMART_EVENT_FLAG_DEBUG_ONLY)
@@ -5129,36 +5141,32 @@ void SmartScript::FillScript(SmartAIEventList e, WorldObject* obj, AreaTrigger c
 
 void SmartScript::GetScript()
 {
-    SmartAIEventList e;
+    // the rows are read in place from the manager, FillScript copies only the ones used by this object
     if (me)
     {
-        e = sSmartScriptMgr->GetScript(-((int32)me->GetSpawnId()), mScriptType);
-        if (e.empty())
-            e = sSmartScriptMgr->GetScript((int32)me->GetEntry(), mScriptType);
+        SmartAIEventList const* e = &sSmartScriptMgr->GetScript(-((int32)me->GetSpawnId()), mScriptType);
+        if (e->empty())
+            e = &sSmartScriptMgr->GetScript((int32)me->GetEntry(), mScriptType);
 
-        FillScript(e, me, nullptr);
+        FillScript(*e, me, nullptr);
 
         if (CreatureTemplate const* cInfo = me->GetCreatureTemplate())
         {
             if (cInfo->HasFlagsExtra(CREATURE_FLAG_EXTRA_DONT_OVERRIDE_ENTRY_SAI))
-            {
-                e = sSmartScriptMgr->GetScript((int32)me->GetEntry(), mScriptType);
-                FillScript(e, me, nullptr);
-            }
+                FillScript(sSmartScriptMgr->GetScript((int32)me->GetEntry(), mScriptType), me, nullptr);
         }
     }
     else if (go)
     {
-        e = sSmartScriptMgr->GetScript(-((int32)go->GetSpawnId()), mScriptType);
-        if (e.empty())
-            e = sSmartScriptMgr->GetScript((int32)go->GetEntry(), mScriptType);
-        FillScript(e, go, nullptr);
+        SmartAIEventList const* e = &sSmartScriptMgr->GetScript(-((int32)go->GetSpawnId()), mScriptType);
+        if (e->empty())
+            e = &sSmartScriptMgr->GetScript((int32)go->GetEntry(), mScriptType);
+        FillScript(*e, go, nullptr);
     }
     else if (trigger)
-    {
-        e = sSmartScriptMgr->GetScript((int32)trigger->entry, mScriptType);
-        FillScript(e, nullptr, trigger);
-    }
+        FillScript(sSmartScriptMgr->GetScript((int32)trigger->entry, mScriptType), nullptr, trigger);
+
+    BuildEventIndex();
 }
 
 void SmartScript::OnInitialize(WorldObject* obj, AreaTrigger const* at)
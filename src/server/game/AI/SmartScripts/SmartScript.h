@@ -44,7 +44,7 @@ public:
 
     void OnInitialize(WorldObject* obj, AreaTrigger const* at = nullptr);
     void GetScript();
-    void FillScript(SmartAIEventList e, WorldObject* obj, AreaTrigger const* at);
+    void FillScript(SmartAIEventList const& e, WorldObject* obj, AreaTrigger const* at);
 
     void ProcessEventsFor(SMART_EVENT e, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr);
     void ProcessEvent(SmartScriptHolder& e, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr);
@@ -220,6 +220,9 @@ private:
     void RetryLater(SmartScriptHolder& e, bool ignoreChanceRoll = false);
 
     SmartAIEventList mEvents;
+    // (event type, position in mEvents) of the non link events, sorted, so ProcessEventsFor only visits matching events
+    std::vector<std::pair<uint32, uint32>> mEventIndex;
+    void BuildEventIndex();
     SmartAIEventList mInstallEvents;
     SmartAIEventList mTimedActionList;
     bool isProcessingTimedActionList;
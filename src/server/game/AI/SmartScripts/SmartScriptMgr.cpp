@@ -48,11 +48,6 @@ void SmartWaypointMgr::LoadFromDB()
 {
     uint32 oldMSTime = getMSTime();
 
-    for (auto itr : waypoint_map)
-    {
-        delete itr.second;
-    }
-
     waypoint_map.clear();
 
     WorldDatabasePreparedStatement* stmt = WorldDatabase.GetPreparedStatement(WORLD_SEL_SMARTAI_WP);
@@ -85,7 +80,6 @@ void SmartWaypointMgr::LoadFromDB()
 
         if (last_entry != entry)
         {
-            waypoint_map[entry] = new WaypointPath();
             last_id = 1;
             count++;
         }
@@ -102,24 +96,19 @@ void SmartWaypointMgr::LoadFromDB()
         data.orientation = o;
         data.delay = delay;
         data.move_type = WAYPOINT_MOVE_TYPE_MAX;
-        (*waypoint_map[entry]).emplace(id, data);
+        waypoint_map[entry].emplace(id, data);
 
         last_entry = entry;
         total++;
     } while (result->NextRow());
 
+    for (auto& [entry, path] : waypoint_map)
+        path.shrink_to_fit();
+
     LOG_INFO("server.loading", ">> Loaded {} SmartAI waypoint paths (total {} waypoints) in {} ms", count, total, GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
 
-SmartWaypointMgr::~SmartWaypointMgr()
-{
-    for (auto itr : waypoint_map)
-    {
-        delete itr.second;
-    }
-}
-
 SmartAIMgr* SmartAIMgr::instance()
 {
     static SmartAIMgr instance;
@@ -2049,21 +2049,21 @@ class SmartWaypointMgr
 {
     SmartWaypointMgr() {}
 public:
-    ~SmartWaypointMgr();
-
     static SmartWaypointMgr* instance();
 
     void LoadFromDB();
 
-    WaypointPath* GetPath(uint32 id)
+    WaypointPath const* GetPath(uint32 id) const
     {
-        if (waypoint_map.find(id) != waypoint_map.end())
-            return waypoint_map[id];
-        else return 0;
+        WaypointPathContainer::const_iterator itr = waypoint_map.find(id);
+        if (itr != waypoint_map.end())
+            return &itr->second;
+
+        return nullptr;
     }
 
 private:
-    std::unordered_map<uint32, WaypointPath*> waypoint_map;
+    WaypointPathContainer waypoint_map;
 };
 
 // all events for a single entry
@@ -2084,17 +2084,18 @@ public:
     void LoadSmartAIFromDB();
     void CheckIfSmartAIInDatabaseExists();
 
-    SmartAIEventList GetScript(int32 entry, SmartScriptType type)
+    // the rows are owned by the manager, callers copy what they keep
+    SmartAIEventList const& GetScript(int32 entry, SmartScriptType type) const
     {
-        SmartAIEventList temp;
-        if (mEventMap[uint32(type)].find(entry) != mEventMap[uint32(type)].end())
-            return mEventMap[uint32(type)][entry];
-        else
-        {
-            if (entry > 0) //first search is for guid (negative), do not drop error if not found
-                LOG_DEBUG("sql.sql", "SmartAIMgr::GetScript: Could not load Script for Entry {} ScriptType {}.", entry, uint32(type));
-            return temp;
-        }
+        SmartAIEventMap::const_iterator itr = mEventMap[uint32(type)].find(entry);
+        if (itr != mEventMap[uint32(type)].end())
+            return itr->second;
+
+        if (entry > 0) //first search is for guid (negative), do not drop error if not found
+            LOG_DEBUG("sql.sql", "SmartAIMgr::GetScript: Could not load Script for Entry {} ScriptType {}.", entry, uint32(type));
+
+        static SmartAIEventList const empty;
+        return empty;
     }
 
 private:
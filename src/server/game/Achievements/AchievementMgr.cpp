@@ -479,6 +479,15 @@ bool AchievementCriteriaDataSet::Meets(Player const* source, Unit const* target,
     return true;
 }
 
+uint32 AchievementCriteriaDataSet::GetRequiredCreatureEntry() const
+{
+    for (AchievementCriteriaData const& data : _storage)
+        if (data.dataType == ACHIEVEMENT_CRITERIA_DATA_TYPE_T_CREATURE)
+            return data.creature.id;
+
+    return 0;
+}
+
 AchievementMgr::AchievementMgr(Player* player)
 {
     _player = player;
@@ -877,6 +886,14 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
             }
             achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByType(type);
             break;
+        case ACHIEVEMENT_CRITERIA_TYPE_KILL_CREATURE_TYPE:
+            if (miscValue2 && unit && unit->IsCreature())
+            {
+                achievementCriteriaList = sAchievementMgr->GetKillCreatureTypeCriteriaByEntry(unit->GetEntry());
+                break;
+            }
+            achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByType(type);
+            break;
         default:
             achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByType(type);
             break;
@@ -2925,6 +2942,24 @@ void AchievementGlobalMgr::LoadAchievementCriteriaData()
             LOG_ERROR("sql.sql", "Table `achievement_criteria_data` does not have expected data for criteria (Entry: {} Type: {}) for achievement {}.", criteria->ID, criteria->requiredType, criteria->referredAchievement);
     }
 
+    // index the kill creature type criterias by the creature their data requires, criterias without data never meet
+    _killCreatureTypeCriteriasByEntry.clear();
+    _killCreatureTypeCriteriasAnyEntry.clear();
+    for (AchievementCriteriaEntry const* criteria : _achievementCriteriasByType[ACHIEVEMENT_CRITERIA_TYPE_KILL_CREATURE_TYPE])
+    {
+        AchievementCriteriaDataSet const* dataSet = GetCriteriaDataSet(criteria);
+        if (!dataSet)
+            continue;
+
+        if (uint32 entry = dataSet->GetRequiredCreatureEntry())
+            _killCreatureTypeCriteriasByEntry[entry].push_back(criteria);
+        else
+            _killCreatureTypeCriteriasAnyEntry.push_back(criteria);
+    }
+
+    for (auto& [entry, criterias] : _killCreatureTypeCriteriasByEntry)
+        criterias.insert(criterias.end(), _killCreatureTypeCriteriasAnyEntry.begin(), _killCreatureTypeCriteriasAnyEntry.end());
+
     LOG_INFO("server.loading", ">> Loaded {} additional achievement criteria data in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
@@ -249,6 +249,8 @@ struct AchievementCriteriaDataSet
     void Add(AchievementCriteriaData const& data) { _storage.push_back(data); }
     bool Meets(Player const* source, Unit const* target, uint32 miscvalue = 0) const;
     void SetCriteriaId(uint32 id) {_criteria_id = id;}
+    // entry of the creature the target must be, 0 if the data allows any target
+    [[nodiscard]] uint32 GetRequiredCreatureEntry() const;
 private:
     uint32 _criteria_id{0};
     Storage _storage;
@@ -363,18 +365,22 @@ public:
         return &_achievementCriteriasByType[type];
     }
 
-    AchievementCriteriaEntryList const* GetSpecialAchievementCriteriaByType(AchievementCriteriaTypes type, uint32 val)
+    [[nodiscard]] AchievementCriteriaEntryList const* GetSpecialAchievementCriteriaByType(AchievementCriteriaTypes type, uint32 val) const
     {
-        if (_specialList[type].find(val) != _specialList[type].end())
-            return &_specialList[type][val];
-        return nullptr;
+        auto itr = _specialList[type].find(val);
+        return itr != _specialList[type].end() ? &itr->second : nullptr;
     }
 
-    AchievementCriteriaEntryList const* GetAchievementCriteriaByCondition(AchievementCriteriaCondition condition, uint32 val)
+    [[nodiscard]] AchievementCriteriaEntryList const* GetKillCreatureTypeCriteriaByEntry(uint32 entry) const
     {
-        if (_achievementCriteriasByCondition[condition].find(val) != _achievementCriteriasByCondition[condition].end())
-            return &_achievementCriteriasByCondition[condition][val];
-        return nullptr;
+        auto itr = _killCreatureTypeCriteriasByEntry.find(entry);
+        return itr != _killCreatureTypeCriteriasByEntry.end() ? &itr->second : &_killCreatureTypeCriteriasAnyEntry;
+    }
+
+    [[nodiscard]] AchievementCriteriaEntryList const* GetAchievementCriteriaByCondition(AchievementCriteriaCondition condition, uint32 val) const
+    {
+        auto itr = _achievementCriteriasByCondition[condition].find(val);
+        return itr != _achievementCriteriasByCondition[condition].end() ? &itr->second : nullptr;
     }
 
     [[nodiscard]] AchievementCriteriaEntryList const& GetTimedAchievementCriteriaByType(AchievementCriteriaTimedTypes type) const
@@ -444,8 +450,13 @@ private:
     AchievementRewardLocales _achievementRewardLocales;
 
     // pussywizard:
-    std::map<uint32, AchievementCriteriaEntryList> _specialList[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
-    std::map<uint32, AchievementCriteriaEntryList> _achievementCriteriasByCondition[ACHIEVEMENT_CRITERIA_CONDITION_TOTAL];
+    std::unordered_map<uint32, AchievementCriteriaEntryList> _specialList[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+    std::unordered_map<uint32, AchievementCriteriaEntryList> _achievementCriteriasByCondition[ACHIEVEMENT_CRITERIA_CONDITION_TOTAL];
+
+    // ACHIEVEMENT_CRITERIA_TYPE_KILL_CREATURE_TYPE criterias by the creature entry their data requires,
+    // each list also holds the criterias which accept any creature
+    std::unordered_map<uint32, AchievementCriteriaEntryList> _killCreatureTypeCriteriasByEntry;
+    AchievementCriteriaEntryList _killCreatureTypeCriteriasAnyEntry;
 };
 
 #define sAchievementMgr AchievementGlobalMgr::instance()
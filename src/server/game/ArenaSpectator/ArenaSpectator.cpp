@@ -302,7 +302,7 @@ bool ArenaSpectator::ShouldSendAura(Aura* aura, uint8 effMask, ObjectGuid target
 }
 
 template<>
-AC_GAME_API void ArenaSpectator::SendPacketTo(Player const* player, std::string&& message)
+AC_GAME_API void ArenaSpectator::SendPacketTo(Player const* player, std::string&& message, ObjectGuid /*target*/, const char* /*key*/)
 {
     WorldPacket data;
     CreatePacket(data, message);
@@ -310,16 +310,14 @@ AC_GAME_API void ArenaSpectator::SendPacketTo(Player const* player, std::string&
 }
 
 template<>
-AC_GAME_API void ArenaSpectator::SendPacketTo(const Map* map, std::string&& message)
+AC_GAME_API void ArenaSpectator::SendPacketTo(const Map* map, std::string&& message, ObjectGuid target, const char* key)
 {
     if (!map->IsBattleArena())
         return;
 
     Battleground* bg = ((BattlegroundMap*)map)->GetBG();
-    if (!bg || bg->GetStatus() != STATUS_IN_PROGRESS)
+    if (!bg || bg->GetStatus() != STATUS_IN_PROGRESS || !bg->HaveSpectators())
         return;
 
-    WorldPacket data;
-    CreatePacket(data, message);
-    bg->SpectatorsSendPacket(data);
+    bg->QueueSpectatorMessage(std::move(message), target, key);
 }
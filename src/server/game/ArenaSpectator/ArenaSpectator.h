@@ -40,8 +40,10 @@ class WorldPacket;
 
 namespace ArenaSpectator
 {
+    // Messages sent to a map are queued for its spectators, a message with a value key replaces
+    // the queued message of the same target and key
     template<class T>
-    AC_GAME_API void SendPacketTo(const T* object, std::string&& message);
+    AC_GAME_API void SendPacketTo(const T* object, std::string&& message, ObjectGuid target = ObjectGuid::Empty, const char* key = nullptr);
 
     template<class T, typename Format, typename... Args>
     inline void SendCommand(T* o, Format&& fmt, Args&& ... args)
@@ -49,22 +51,31 @@ namespace ArenaSpectator
         SendPacketTo(o, Acore::StringFormat(std::forward<Format>(fmt), std::forward<Args>(args)...));
     }
 
+    template<class T, typename Format, typename... Args>
+    inline void SendValueCommand(T* o, ObjectGuid targetGUID, const char* prefix, Format&& fmt, Args&& ... args)
+    {
+        SendPacketTo(o, Acore::StringFormat(std::forward<Format>(fmt), std::forward<Args>(args)...), targetGUID, prefix);
+    }
+
     template<class T>
     inline void SendCommand_String(T* o, ObjectGuid targetGUID, const char* prefix, const char* c)
     {
         if (!targetGUID.IsPlayer())
             return;
 
-        SendCommand(o, "%s0x%016llX;%s=%s;", SPECTATOR_ADDON_PREFIX, targetGUID.GetRawValue(), prefix, c);
+        SendValueCommand(o, targetGUID, prefix, "%s0x%016llX;%s=%s;", SPECTATOR_ADDON_PREFIX, targetGUID.GetRawValue(), prefix, c);
     }
 
     template<class T>
-    inline void SendCommand_UInt32Value(T* o, ObjectGuid targetGUID, const char* prefix, uint32 t)
+    inline void SendCommand_UInt32Value(T* o, ObjectGuid targetGUID, const char* prefix, uint32 t, bool coalesce = true)
     {
         if (!targetGUID.IsPlayer())
             return;
 
-        SendCommand(o, "%s0x%016llX;%s=%u;", SPECTATOR_ADDON_PREFIX, targetGUID.GetRawValue(), prefix, t);
+        if (coalesce)
+            SendValueCommand(o, targetGUID, prefix, "%s0x%016llX;%s=%u;", SPECTATOR_ADDON_PREFIX, targetGUID.GetRawValue(), prefix, t);
+        else
+            SendCommand(o, "%s0x%016llX;%s=%u;", SPECTATOR_ADDON_PREFIX, targetGUID.GetRawValue(), prefix, t);
     }
 
     template<class T>
@@ -73,7 +84,7 @@ namespace ArenaSpectator
         if (!targetGUID.IsPlayer())
             return;
 
-        SendCommand(o, "%s0x%016llX;%s=0x%016llX;", SPECTATOR_ADDON_PREFIX, targetGUID.GetRawValue(), prefix, t.GetRawValue());
+        SendValueCommand(o, targetGUID, prefix, "%s0x%016llX;%s=0x%016llX;", SPECTATOR_ADDON_PREFIX, targetGUID.GetRawValue(), prefix, t.GetRawValue());
     }
 
     template<class T>
@@ -28,12 +28,13 @@
 #include "ScriptMgr.h"
 #include "UpdateTime.h"
 #include "World.h"
+#include "WorldLoadGovernor.h"
 #include "WorldPacket.h"
 #include <vector>
 
 constexpr auto AH_MINIMUM_DEPOSIT = 100;
 
-AuctionHouseMgr::AuctionHouseMgr() : _auctionHouseSearcher(new AuctionHouseSearcher())
+AuctionHouseMgr::AuctionHouseMgr() : _auctionHouseSearcher(new AuctionHouseSearcher()), _expiryDeferral(0ms)
 {
     _updateIntervalTimer.SetInterval(MINUTE * IN_MILLISECONDS);
     _updateIntervalTimer.SetCurrent(MINUTE * IN_MILLISECONDS);
@@ -430,13 +431,28 @@ void AuctionHouseMgr::Update(uint32 const diff)
     {
         sScriptMgr->OnBeforeAuctionHouseMgrUpdate();
 
-        _hordeAuctions.Update();
-        _allianceAuctions.Update();
-        _neutralAuctions.Update();
-
         _updateIntervalTimer.Reset();
     }
 
+    // The auctions are ordered by expiry time, so expired ones are found without scanning the houses.
+    // Those expiring together (at the top of the hour) are closed over several updates.
+    time_t const checkTime = GameTime::GetGameTime().count();
+    bool const hasExpiredAuctions = _hordeAuctions.HasExpiredAuctions(checkTime) || _allianceAuctions.HasExpiredAuctions(checkTime) || _neutralAuctions.HasExpiredAuctions(checkTime);
+    if (hasExpiredAuctions && sWorldLoadGovernor.ShouldDefer(LoadSheddingWork::AuctionExpiry, _expiryDeferral))
+        _expiryDeferral += Milliseconds(diff);
+    else if (hasExpiredAuctions)
+    {
+        _expiryDeferral = 0ms;
+
+        uint32 budget = sWorld->getIntConfig(CONFIG_AUCTIONHOUSE_EXPIRED_PER_UPDATE);
+
+        CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+        _hordeAuctions.Update(checkTime, trans, budget);
+        _allianceAuctions.Update(checkTime, trans, budget);
+        _neutralAuctions.Update(checkTime, trans, budget);
+        CharacterDatabase.CommitTransaction(trans);
+    }
+
     _auctionHouseSearcher->Update();
 }
 
@@ -481,6 +497,7 @@ void AuctionHouseObject::AddAuction(AuctionEntry* auction)
     ASSERT(auction);
 
     _auctionsMap[auction->Id] = auction;
+    _expiryQueue.emplace(auction->expire_time, auction->Id);
     sAuctionMgr->GetAuctionHouseSearcher()->AddAuction(auction);
 
     sScriptMgr->OnAuctionAdd(this, auction);
@@ -489,6 +506,7 @@ void AuctionHouseObject::AddAuction(AuctionEntry* auction)
 bool AuctionHouseObject::RemoveAuction(AuctionEntry* auction)
 {
     bool wasInMap = _auctionsMap.erase(auction->Id);
+    _expiryQueue.erase(std::make_pair(auction->expire_time, auction->Id));
     sAuctionMgr->GetAuctionHouseSearcher()->RemoveAuction(auction);
 
     sScriptMgr->OnAuctionRemove(this, auction);
@@ -500,24 +518,19 @@ bool AuctionHouseObject::RemoveAuction(AuctionEntry* auction)
     return wasInMap;
 }
 
-void AuctionHouseObject::Update()
+void AuctionHouseObject::Update(time_t checkTime, CharacterDatabaseTransaction trans, uint32& budget)
 {
-    time_t checkTime = GameTime::GetGameTime().count() + 60;
     ///- Handle expired auctions
-
-    // If storage is empty, no need to update. next == nullptr in this case.
-    if (_auctionsMap.empty())
-        return;
-
-    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
-
-    for (AuctionEntryMap::iterator itr, iter = _auctionsMap.begin(); iter != _auctionsMap.end(); )
+    while (budget && HasExpiredAuctions(checkTime))
     {
-        itr = iter++;
-        AuctionEntry* auction = (*itr).second;
+        --budget;
 
-        if (auction->expire_time > checkTime)
+        AuctionEntry* auction = GetAuction(_expiryQueue.begin()->second);
+        if (!auction)
+        {
+            _expiryQueue.erase(_expiryQueue.begin());
             continue;
+        }
 
         ///- Either cancel the auction if there was no bidder
         if (!auction->bidder)
@@ -542,7 +555,6 @@ void AuctionHouseObject::Update()
         sAuctionMgr->RemoveAItem(auction->item_guid);
         RemoveAuction(auction);
     }
-    CharacterDatabase.CommitTransaction(trans);
 }
 
 AuctionHouseFaction AuctionEntry::GetFactionId() const
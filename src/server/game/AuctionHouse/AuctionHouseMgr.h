@@ -25,6 +25,7 @@
 #include "ObjectGuid.h"
 #include "Timer.h"
 #include "WorldPacket.h"
+#include <set>
 #include <unordered_map>
 
 class Item;
@@ -152,10 +153,16 @@ public:
 
     bool RemoveAuction(AuctionEntry* auction);
 
-    void Update();
+    [[nodiscard]] bool HasExpiredAuctions(time_t checkTime) const { return !_expiryQueue.empty() && _expiryQueue.begin()->first <= checkTime; }
+
+    // Closes the auctions expired at checkTime, at most budget of them
+    void Update(time_t checkTime, CharacterDatabaseTransaction trans, uint32& budget);
 
 private:
+    typedef std::set<std::pair<time_t, uint32>> AuctionExpiryQueue;
+
     AuctionEntryMap _auctionsMap;
+    AuctionExpiryQueue _expiryQueue;                      // expire_time, auction id
 
     // storage for "next" auction item for next Update()
     AuctionEntryMap::const_iterator _next;
@@ -219,6 +226,7 @@ private:
     AuctionHouseSearcher* _auctionHouseSearcher;
 
     IntervalTimer _updateIntervalTimer;
+    Milliseconds _expiryDeferral;
 };
 
 #define sAuctionMgr AuctionHouseMgr::instance()
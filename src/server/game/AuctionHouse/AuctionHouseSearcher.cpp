@@ -21,6 +21,7 @@
 #include "DBCStores.h"
 #include "GameTime.h"
 #include "Player.h"
+#include <limits>
 
 AuctionHouseWorkerThread::AuctionHouseWorkerThread(ProducerConsumerQueue<AuctionSearcherRequest*>* requestQueue, MPSCQueue<AuctionSearcherResponse>* responseQueue)
 {
@@ -49,6 +50,7 @@ void AuctionHouseWorkerThread::Run()
 
         ProcessSearchUpdates();
         ProcessSearchRequests();
+        CleanupListResultCache();
     }
 }
 
@@ -86,24 +88,42 @@ void AuctionHouseWorkerThread::ProcessSearchUpdates()
 void AuctionHouseWorkerThread::SearchUpdateAdd(AuctionSearchAdd const& auctionAdd)
 {
     SearchableAuctionEntriesMap& searchableAuctionMap = GetSearchableAuctionMap(auctionAdd.listFaction);
-    searchableAuctionMap.insert(std::make_pair(auctionAdd.searchableAuctionEntry->Id, auctionAdd.searchableAuctionEntry));
+    if (searchableAuctionMap.insert(std::make_pair(auctionAdd.searchableAuctionEntry->Id, auctionAdd.searchableAuctionEntry)).second)
+    {
+        GetSearchIndex(auctionAdd.listFaction).Add(auctionAdd.searchableAuctionEntry.get());
+        ++_auctionVersions[static_cast<uint8>(auctionAdd.listFaction)];
+    }
 }
 
 void AuctionHouseWorkerThread::SearchUpdateRemove(AuctionSearchRemove const& auctionRemove)
 {
     SearchableAuctionEntriesMap& searchableAuctionMap = GetSearchableAuctionMap(auctionRemove.listFaction);
-    searchableAuctionMap.erase(auctionRemove.auctionId);
+    SearchableAuctionEntriesMap::iterator itr = searchableAuctionMap.find(auctionRemove.auctionId);
+    if (itr == searchableAuctionMap.end())
+        return;
+
+    GetSearchIndex(auctionRemove.listFaction).Remove(itr->second.get());
+    searchableAuctionMap.erase(itr);
+
+    // the cached results may point to the removed entry
+    ++_auctionVersions[static_cast<uint8>(auctionRemove.listFaction)];
 }
 
 void AuctionHouseWorkerThread::SearchUpdateBid(AuctionSearchUpdateBid const& auctionUpdateBid)
 {
     SearchableAuctionEntriesMap const& searchableAuctionMap = GetSearchableAuctionMap(auctionUpdateBid.listFaction);
     SearchableAuctionEntriesMap::const_iterator itr = searchableAuctionMap.find(auctionUpdateBid.auctionId);
-    if (itr != searchableAuctionMap.end())
+    if (itr == searchableAuctionMap.end())
+        return;
+
+    if (auctionUpdateBid.updateEntry)
     {
         itr->second->bid = auctionUpdateBid.bid;
         itr->second->bidderGuid = auctionUpdateBid.bidderGuid;
     }
+
+    // the bid is a sort column
+    ++_auctionVersions[static_cast<uint8>(auctionUpdateBid.listFaction)];
 }
 
 void AuctionHouseWorkerThread::ProcessSearchRequests()
@@ -151,14 +171,7 @@ void AuctionHouseWorkerThread::SearchListRequest(AuctionSearchListRequest const&
 
     if (!searchListRequest.searchInfo.getAll)
     {
-        SortableAuctionEntriesList auctionEntries;
-        BuildListAuctionItems(searchListRequest, auctionEntries, searchableAuctionMap);
-
-        if (!searchListRequest.searchInfo.sorting.empty() && auctionEntries.size() > MAX_AUCTIONS_PER_PAGE)
-        {
-            AuctionSorter sorter(&searchListRequest.searchInfo.sorting, searchListRequest.playerInfo.loc_idx);
-            std::sort(auctionEntries.begin(), auctionEntries.end(), sorter);
-        }
+        SortableAuctionEntriesList const& auctionEntries = GetListAuctionItems(searchListRequest);
 
         SortableAuctionEntriesList::const_iterator itr = auctionEntries.begin();
         if (searchListRequest.searchInfo.listfrom)
@@ -202,6 +215,87 @@ void AuctionHouseWorkerThread::SearchListRequest(AuctionSearchListRequest const&
     _responseQueue->Enqueue(searchResponse);
 }
 
+SortableAuctionEntriesList const& AuctionHouseWorkerThread::GetListAuctionItems(AuctionSearchListRequest const& searchRequest)
+{
+    uint32 const version = _auctionVersions[static_cast<uint8>(searchRequest.listFaction)];
+
+    // the next pages of the same search reuse the sorted results while no auction of the faction changed
+    auto itr = _listResultCache.find(searchRequest.playerInfo.playerGuid);
+    if (itr != _listResultCache.end() && itr->second.version == version && itr->second.IsSameSearch(searchRequest))
+    {
+        itr->second.expireTime = std::chrono::steady_clock::now() + AUCTION_LIST_CACHE_TIME;
+        return itr->second.auctionEntries;
+    }
+
+    AuctionListResultCache& cache = _listResultCache[searchRequest.playerInfo.playerGuid];
+    cache.listFaction = searchRequest.listFaction;
+    cache.searchInfo = searchRequest.searchInfo;
+    cache.playerInfo = searchRequest.playerInfo;
+    cache.version = version;
+    cache.expireTime = std::chrono::steady_clock::now() + AUCTION_LIST_CACHE_TIME;
+    cache.auctionEntries.clear();
+
+    BuildListAuctionItems(searchRequest, cache.auctionEntries, GetSearchableAuctionMap(searchRequest.listFaction), GetSearchIndex(searchRequest.listFaction));
+
+    if (!searchRequest.searchInfo.sorting.empty() && cache.auctionEntries.size() > MAX_AUCTIONS_PER_PAGE)
+    {
+        AuctionSorter sorter(&searchRequest.searchInfo.sorting, searchRequest.playerInfo.loc_idx);
+        std::sort(cache.auctionEntries.begin(), cache.auctionEntries.end(), sorter);
+    }
+
+    return cache.auctionEntries;
+}
+
+void AuctionHouseWorkerThread::CleanupListResultCache()
+{
+    TimePoint const now = std::chrono::steady_clock::now();
+    if (now < _nextCacheCleanup)
+        return;
+
+    _nextCacheCleanup = now + AUCTION_LIST_CACHE_TIME;
+
+    for (auto itr = _listResultCache.begin(); itr != _listResultCache.end();)
+    {
+        if (itr->second.expireTime <= now)
+            itr = _listResultCache.erase(itr);
+        else
+            ++itr;
+    }
+}
+
+bool AuctionListResultCache::IsSameSearch(AuctionSearchListRequest const& searchRequest) const
+{
+    AuctionHouseSearchInfo const& search = searchRequest.searchInfo;
+
+    // listfrom is the page, everything else must match
+    if (listFaction != searchRequest.listFaction || searchInfo.wsearchedname != search.wsearchedname
+        || searchInfo.levelmin != search.levelmin || searchInfo.levelmax != search.levelmax
+        || searchInfo.usable != search.usable || searchInfo.inventoryType != search.inventoryType
+        || searchInfo.itemClass != search.itemClass || searchInfo.itemSubClass != search.itemSubClass
+        || searchInfo.quality != search.quality || playerInfo.loc_idx != searchRequest.playerInfo.loc_idx)
+    {
+        return false;
+    }
+
+    if (searchInfo.sorting.size() != search.sorting.size())
+        return false;
+
+    for (std::size_t i = 0; i < search.sorting.size(); ++i)
+        if (searchInfo.sorting[i].sortOrder != search.sorting[i].sortOrder || searchInfo.sorting[i].isDesc != search.sorting[i].isDesc)
+            return false;
+
+    // usable items depend on the level, skills and spells of the player
+    if (search.usable)
+    {
+        AuctionHouseUsablePlayerInfo const& cached = playerInfo.usablePlayerInfo.value();
+        AuctionHouseUsablePlayerInfo const& current = searchRequest.playerInfo.usablePlayerInfo.value();
+        if (cached.level != current.level || cached.skills != current.skills || cached.spells != current.spells)
+            return false;
+    }
+
+    return true;
+}
+
 void AuctionHouseWorkerThread::SearchOwnerListRequest(AuctionSearchOwnerListRequest const& searchOwnerListRequest)
 {
     SearchableAuctionEntriesMap const& searchableAuctionMap = GetSearchableAuctionMap(searchOwnerListRequest.listFaction);
@@ -274,7 +368,7 @@ void AuctionHouseWorkerThread::SearchBidderListRequest(AuctionSearchBidderListRe
     _responseQueue->Enqueue(searchResponse);
 }
 
-void AuctionHouseWorkerThread::BuildListAuctionItems(AuctionSearchListRequest const& searchRequest, SortableAuctionEntriesList& auctionEntries, SearchableAuctionEntriesMap const& auctionMap) const
+void AuctionHouseWorkerThread::BuildListAuctionItems(AuctionSearchListRequest const& searchRequest, SortableAuctionEntriesList& auctionEntries, SearchableAuctionEntriesMap const& auctionMap, AuctionSearchIndex& searchIndex) const
 {
     // pussywizard: optimization, this is a simplified case for the default search state (no filters)
     if (searchRequest.searchInfo.itemClass == 0xffffffff && searchRequest.searchInfo.itemSubClass == 0xffffffff
@@ -288,50 +382,186 @@ void AuctionHouseWorkerThread::BuildListAuctionItems(AuctionSearchListRequest co
         return;
     }
 
+    std::vector<AuctionSearchIndex::AuctionSet const*> candidates;
+    if (searchIndex.GetCandidates(searchRequest.searchInfo, searchRequest.playerInfo.loc_idx, auctionMap, candidates))
+    {
+        for (AuctionSearchIndex::AuctionSet const* auctions : candidates)
+            for (SearchableAuctionEntry* auction : *auctions)
+                if (MatchesSearch(searchRequest, *auction))
+                    auctionEntries.push_back(auction);
+
+        return;
+    }
+
     for (auto const& pair : auctionMap)
+        if (MatchesSearch(searchRequest, *pair.second))
+            auctionEntries.push_back(pair.second.get());
+}
+
+bool AuctionHouseWorkerThread::MatchesSearch(AuctionSearchListRequest const& searchRequest, SearchableAuctionEntry const& auction)
+{
+    SearchableAuctionEntryItem const& Aitem = auction.item;
+    ItemTemplate const* proto = Aitem.itemTemplate;
+
+    if (searchRequest.searchInfo.itemClass != 0xffffffff && proto->Class != searchRequest.searchInfo.itemClass)
+        return false;
+
+    if (searchRequest.searchInfo.itemSubClass != 0xffffffff && proto->SubClass != searchRequest.searchInfo.itemSubClass)
+        return false;
+
+    if (searchRequest.searchInfo.inventoryType != 0xffffffff && proto->InventoryType != searchRequest.searchInfo.inventoryType)
+    {
+        // xinef: exception, robes are counted as chests
+        if (searchRequest.searchInfo.inventoryType != INVTYPE_CHEST || proto->InventoryType != INVTYPE_ROBE)
+            return false;
+    }
+
+    if (searchRequest.searchInfo.quality != 0xffffffff && proto->Quality < searchRequest.searchInfo.quality)
+        return false;
+
+    if (searchRequest.searchInfo.levelmin != 0x00 && (proto->RequiredLevel < searchRequest.searchInfo.levelmin
+        || (searchRequest.searchInfo.levelmax != 0x00 && proto->RequiredLevel > searchRequest.searchInfo.levelmax)))
     {
-        std::shared_ptr<SearchableAuctionEntry> const& Aentry = pair.second;
-        SearchableAuctionEntryItem const& Aitem = Aentry->item;
-        ItemTemplate const* proto = Aitem.itemTemplate;
+        return false;
+    }
 
-        if (searchRequest.searchInfo.itemClass != 0xffffffff && proto->Class != searchRequest.searchInfo.itemClass)
-            continue;
+    if (searchRequest.searchInfo.usable != 0x00)
+    {
+        if (!searchRequest.playerInfo.usablePlayerInfo.value().PlayerCanUseItem(proto))
+            return false;
+    }
 
-        if (searchRequest.searchInfo.itemSubClass != 0xffffffff && proto->SubClass != searchRequest.searchInfo.itemSubClass)
-            continue;
+    // Allow search by suffix (ie: of the Monkey) or partial name (ie: Monkey)
+    // No need to do any of this if no search term was entered
+    if (!searchRequest.searchInfo.wsearchedname.empty())
+    {
+        if (Aitem.itemName[searchRequest.playerInfo.loc_idx].find(searchRequest.searchInfo.wsearchedname) == std::wstring::npos)
+            return false;
+    }
+
+    return true;
+}
+
+void AuctionSearchIndex::Add(SearchableAuctionEntry* auction)
+{
+    ItemTemplate const* proto = auction->item.itemTemplate;
+
+    _byClass[proto->Class].insert(auction);
+    _bySubClass[GetClassKey(proto->Class, proto->SubClass)].insert(auction);
+    _byQuality[std::min<uint32>(proto->Quality, MAX_ITEM_QUALITY - 1)].insert(auction);
+    _byRequiredLevel[proto->RequiredLevel].insert(auction);
+
+    for (uint32 locale = 0; locale < TOTAL_LOCALES; ++locale)
+        if (_nameIndexed[locale])
+            _byName[locale][auction->item.itemName[locale]].insert(auction);
+}
+
+void AuctionSearchIndex::Remove(SearchableAuctionEntry* auction)
+{
+    auto removeFrom = [auction](auto& index, auto const& key)
+    {
+        auto itr = index.find(key);
+        if (itr == index.end())
+            return;
+
+        itr->second.erase(auction);
+        if (itr->second.empty())
+            index.erase(itr);
+    };
+
+    ItemTemplate const* proto = auction->item.itemTemplate;
+
+    removeFrom(_byClass, proto->Class);
+    removeFrom(_bySubClass, GetClassKey(proto->Class, proto->SubClass));
+    _byQuality[std::min<uint32>(proto->Quality, MAX_ITEM_QUALITY - 1)].erase(auction);
+    removeFrom(_byRequiredLevel, proto->RequiredLevel);
+
+    for (uint32 locale = 0; locale < TOTAL_LOCALES; ++locale)
+        if (_nameIndexed[locale])
+            removeFrom(_byName[locale], auction->item.itemName[locale]);
+}
 
-        if (searchRequest.searchInfo.inventoryType != 0xffffffff && proto->InventoryType != searchRequest.searchInfo.inventoryType)
+void AuctionSearchIndex::BuildNameIndex(int locIdx, SearchableAuctionEntriesMap const& auctionMap)
+{
+    for (auto const& pair : auctionMap)
+        _byName[locIdx][pair.second->item.itemName[locIdx]].insert(pair.second.get());
+
+    _nameIndexed[locIdx] = true;
+}
+
+bool AuctionSearchIndex::GetCandidates(AuctionHouseSearchInfo const& searchInfo, int locIdx, SearchableAuctionEntriesMap const& auctionMap, std::vector<AuctionSet const*>& candidates)
+{
+    std::size_t bestSize = std::numeric_limits<std::size_t>::max();
+    std::vector<AuctionSet const*> sets;
+
+    // keeps the sets if they hold fewer auctions than the best ones so far
+    auto consider = [&bestSize, &candidates, &sets]()
+    {
+        std::size_t size = 0;
+        for (AuctionSet const* auctions : sets)
+            size += auctions->size();
+
+        if (size < bestSize)
         {
-            // xinef: exception, robes are counted as chests
-            if (searchRequest.searchInfo.inventoryType != INVTYPE_CHEST || proto->InventoryType != INVTYPE_ROBE)
-                continue;
+            bestSize = size;
+            candidates.swap(sets);
         }
 
-        if (searchRequest.searchInfo.quality != 0xffffffff && proto->Quality < searchRequest.searchInfo.quality)
-            continue;
+        sets.clear();
+    };
 
-        if (searchRequest.searchInfo.levelmin != 0x00 && (proto->RequiredLevel < searchRequest.searchInfo.levelmin
-            || (searchRequest.searchInfo.levelmax != 0x00 && proto->RequiredLevel > searchRequest.searchInfo.levelmax)))
+    if (searchInfo.itemClass != 0xffffffff)
+    {
+        if (searchInfo.itemSubClass != 0xffffffff)
         {
-            continue;
+            auto itr = _bySubClass.find(GetClassKey(searchInfo.itemClass, searchInfo.itemSubClass));
+            if (itr != _bySubClass.end())
+                sets.push_back(&itr->second);
         }
-
-        if (searchRequest.searchInfo.usable != 0x00)
+        else
         {
-            if (!searchRequest.playerInfo.usablePlayerInfo.value().PlayerCanUseItem(proto))
-                continue;
+            auto itr = _byClass.find(searchInfo.itemClass);
+            if (itr != _byClass.end())
+                sets.push_back(&itr->second);
         }
 
-        // Allow search by suffix (ie: of the Monkey) or partial name (ie: Monkey)
-        // No need to do any of this if no search term was entered
-        if (!searchRequest.searchInfo.wsearchedname.empty())
+        consider();
+    }
+
+    if (searchInfo.quality != 0xffffffff)
+    {
+        for (uint32 quality = searchInfo.quality; quality < MAX_ITEM_QUALITY; ++quality)
+            sets.push_back(&_byQuality[quality]);
+
+        consider();
+    }
+
+    if (searchInfo.levelmin != 0x00)
+    {
+        auto end = searchInfo.levelmax != 0x00 ? _byRequiredLevel.upper_bound(searchInfo.levelmax) : _byRequiredLevel.end();
+        for (auto itr = _byRequiredLevel.lower_bound(searchInfo.levelmin); itr != end && itr->first >= searchInfo.levelmin; ++itr)
+            sets.push_back(&itr->second);
+
+        consider();
+    }
+
+    // scanning the names only pays off when the other filters leave more auctions than there are names
+    if (!searchInfo.wsearchedname.empty() && locIdx >= 0 && locIdx < TOTAL_LOCALES)
+    {
+        if (!_nameIndexed[locIdx])
+            BuildNameIndex(locIdx, auctionMap);
+
+        if (_byName[locIdx].size() < bestSize)
         {
-            if (Aitem.itemName[searchRequest.playerInfo.loc_idx].find(searchRequest.searchInfo.wsearchedname) == std::wstring::npos)
-                continue;
-        }
+            for (auto const& [name, auctions] : _byName[locIdx])
+                if (name.find(searchInfo.wsearchedname) != std::wstring::npos)
+                    sets.push_back(&auctions);
 
-        auctionEntries.push_back(Aentry.get());
+            consider();
+        }
     }
+
+    return bestSize != std::numeric_limits<std::size_t>::max();
 }
 
 AuctionHouseSearcher::AuctionHouseSearcher()
@@ -416,7 +646,15 @@ void AuctionHouseSearcher::UpdateBid(AuctionEntry const* auctionEntry)
 {
     // Updating bids is a bit unique, we really only need to update a single worker as every worker thread contains
     // a map of shared pointers to the same SearchableAuctionEntry's, so updating one will update them all.
-    NotifyOneWorker(std::make_shared<AuctionSearchUpdateBid>(auctionEntry->Id, auctionEntry->GetFactionId(), auctionEntry->bid, auctionEntry->bidder));
+    NotifyOneWorker(std::make_shared<AuctionSearchUpdateBid>(auctionEntry->Id, auctionEntry->GetFactionId(), auctionEntry->bid, auctionEntry->bidder, true));
+
+    // The other workers only have to drop their cached results sorted by the previous bid
+    if (_workerThreads.size() > 1)
+    {
+        std::shared_ptr<AuctionSearchUpdateBid> const invalidate = std::make_shared<AuctionSearchUpdateBid>(auctionEntry->Id, auctionEntry->GetFactionId(), auctionEntry->bid, auctionEntry->bidder, false);
+        for (std::size_t i = 1; i < _workerThreads.size(); ++i)
+            _workerThreads[i]->AddAuctionSearchUpdateToQueue(invalidate);
+    }
 }
 
 void AuctionHouseSearcher::NotifyAllWorkers(std::shared_ptr<AuctionSearcherUpdate> const auctionSearchUpdate)
@@ -24,6 +24,8 @@
 #include "LockedQueue.h"
 #include "MPSCQueue.h"
 #include "PCQueue.h"
+#include <array>
+#include <map>
 #include <memory>
 #include <thread>
 #include <unordered_map>
@@ -218,17 +220,52 @@ struct AuctionSearchRemove : AuctionSearcherUpdate
 
 struct AuctionSearchUpdateBid : AuctionSearcherUpdate
 {
-    AuctionSearchUpdateBid(uint32 _auctionId, AuctionHouseFaction _listFaction, uint32 _bid, ObjectGuid _bidderGuid)
-        : AuctionSearcherUpdate(AuctionSearcherUpdate::Type::UPDATE_BID, _listFaction), auctionId(_auctionId), bid(_bid), bidderGuid(_bidderGuid) { }
+    AuctionSearchUpdateBid(uint32 _auctionId, AuctionHouseFaction _listFaction, uint32 _bid, ObjectGuid _bidderGuid, bool _updateEntry)
+        : AuctionSearcherUpdate(AuctionSearcherUpdate::Type::UPDATE_BID, _listFaction), auctionId(_auctionId), bid(_bid), bidderGuid(_bidderGuid), updateEntry(_updateEntry) { }
 
     uint32 auctionId;
     uint32 bid;
     ObjectGuid bidderGuid;
+    bool updateEntry; // the entry is shared by all the workers, only one of them writes it
 };
 
 typedef std::unordered_map<uint32, std::shared_ptr<SearchableAuctionEntry>> SearchableAuctionEntriesMap;
 typedef std::vector<SearchableAuctionEntry*> SortableAuctionEntriesList;
 
+/*
+ * Inverted indexes over the auctions of one faction, kept by each worker thread
+ * next to its auction map. A list search walks the smallest posting list matching
+ * its indexed filters (item class and subclass, minimum quality, level range, name)
+ * and checks every filter on those candidates only.
+ *
+ * Names are matched anywhere in the item name, so they're indexed by distinct name:
+ * the search scans the names instead of the auctions, stacks of the same item share
+ * one entry. The name index of a locale is built by its first search.
+ */
+class AuctionSearchIndex
+{
+public:
+    typedef std::unordered_set<SearchableAuctionEntry*> AuctionSet;
+
+    void Add(SearchableAuctionEntry* auction);
+    void Remove(SearchableAuctionEntry* auction);
+
+    // Auction sets holding at least every auction matching the indexed filters of the search, nothing without usable filter
+    bool GetCandidates(AuctionHouseSearchInfo const& searchInfo, int locIdx, SearchableAuctionEntriesMap const& auctionMap, std::vector<AuctionSet const*>& candidates);
+
+private:
+    static uint32 GetClassKey(uint32 itemClass, uint32 itemSubClass) { return (itemClass << 16) | (itemSubClass & 0xFFFF); }
+
+    void BuildNameIndex(int locIdx, SearchableAuctionEntriesMap const& auctionMap);
+
+    std::unordered_map<uint32, AuctionSet> _byClass;
+    std::unordered_map<uint32, AuctionSet> _bySubClass;    // GetClassKey()
+    std::array<AuctionSet, MAX_ITEM_QUALITY> _byQuality;
+    std::map<uint32, AuctionSet> _byRequiredLevel;
+    std::array<std::unordered_map<std::wstring, AuctionSet>, TOTAL_LOCALES> _byName;
+    std::array<bool, TOTAL_LOCALES> _nameIndexed{};
+};
+
 class AuctionSorter
 {
 public:
@@ -240,6 +277,21 @@ private:
     int _loc_idx;
 };
 
+constexpr Seconds AUCTION_LIST_CACHE_TIME = 60s;
+
+// Result of the last list search of a player, kept sorted while the player pages through it
+struct AuctionListResultCache
+{
+    AuctionHouseFaction listFaction;
+    AuctionHouseSearchInfo searchInfo;
+    AuctionHousePlayerInfo playerInfo;
+    uint32 version;                         // AuctionHouseWorkerThread::_auctionVersions of the faction
+    TimePoint expireTime;
+    SortableAuctionEntriesList auctionEntries;
+
+    bool IsSameSearch(AuctionSearchListRequest const& searchRequest) const;
+};
+
 class AuctionHouseWorkerThread
 {
 public:
@@ -262,11 +314,21 @@ private:
     void SearchOwnerListRequest(AuctionSearchOwnerListRequest const& searchOwnerListRequest);
     void SearchBidderListRequest(AuctionSearchBidderListRequest const& searchBidderListRequest);
 
-    void BuildListAuctionItems(AuctionSearchListRequest const& searchRequest, SortableAuctionEntriesList& auctionEntries, SearchableAuctionEntriesMap const& auctionMap) const;
+    SortableAuctionEntriesList const& GetListAuctionItems(AuctionSearchListRequest const& searchRequest);
+    void CleanupListResultCache();
+
+    void BuildListAuctionItems(AuctionSearchListRequest const& searchRequest, SortableAuctionEntriesList& auctionEntries, SearchableAuctionEntriesMap const& auctionMap,
+        AuctionSearchIndex& searchIndex) const;
+    static bool MatchesSearch(AuctionSearchListRequest const& searchRequest, SearchableAuctionEntry const& auction);
 
     SearchableAuctionEntriesMap& GetSearchableAuctionMap(AuctionHouseFaction faction) { return _searchableAuctionMap[static_cast<uint8>(faction)]; };
+    AuctionSearchIndex& GetSearchIndex(AuctionHouseFaction faction) { return _searchIndex[static_cast<uint8>(faction)]; }
 
     SearchableAuctionEntriesMap _searchableAuctionMap[MAX_AUCTION_HOUSE_FACTIONS];
+    AuctionSearchIndex _searchIndex[MAX_AUCTION_HOUSE_FACTIONS];
+    uint32 _auctionVersions[MAX_AUCTION_HOUSE_FACTIONS]{};  // changed by every update of the auctions of the faction
+    std::unordered_map<ObjectGuid, AuctionListResultCache> _listResultCache;
+    TimePoint _nextCacheCleanup;
     LockedQueue<std::shared_ptr<AuctionSearcherUpdate>> _auctionUpdatesQueue;
 
     ProducerConsumerQueue<AuctionSearcherRequest*>* _requestQueue;
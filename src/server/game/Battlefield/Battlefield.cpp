@@ -108,6 +108,7 @@ void Battlefield::HandlePlayerEnterZone(Player* player, uint32 /*zone*/)
 
     // Add player in the list of player in zone
     m_players[player->GetTeamId()].insert(player->GetGUID());
+    HandlePlayerRelocation(player);
     OnPlayerEnterZone(player);
 }
 
@@ -130,7 +131,10 @@ void Battlefield::HandlePlayerLeaveZone(Player* player, uint32 /*zone*/)
     }
 
     for (BfCapturePointVector::iterator itr = m_capturePoints.begin(); itr != m_capturePoints.end(); ++itr)
+    {
         (*itr)->HandlePlayerLeave(player);
+        (*itr)->RemovePlayerInRange(player->GetGUID());
+    }
 
     m_InvitedPlayers[player->GetTeamId()].erase(player->GetGUID());
     m_PlayersWillBeKick[player->GetTeamId()].erase(player->GetGUID());
@@ -140,6 +144,41 @@ void Battlefield::HandlePlayerLeaveZone(Player* player, uint32 /*zone*/)
     OnPlayerLeaveZone(player);
 }
 
+void Battlefield::HandlePlayerRelocation(Player* player)
+{
+    if (m_capturePoints.empty())
+        return;
+
+    std::lock_guard<std::mutex> guard(m_relocationLock);
+    m_relocatedPlayers.insert(player->GetGUID());
+}
+
+void Battlefield::QueueZonePlayersRelocation()
+{
+    std::lock_guard<std::mutex> guard(m_relocationLock);
+    for (uint8 team = 0; team < PVP_TEAMS_COUNT; ++team)
+        m_relocatedPlayers.insert(m_players[team].begin(), m_players[team].end());
+}
+
+void Battlefield::ProcessRelocations()
+{
+    GuidUnorderedSet relocatedPlayers;
+    {
+        std::lock_guard<std::mutex> guard(m_relocationLock);
+        relocatedPlayers.swap(m_relocatedPlayers);
+    }
+
+    for (ObjectGuid const& playerGuid : relocatedPlayers)
+    {
+        Player* player = ObjectAccessor::FindPlayer(playerGuid);
+        if (!player || !HasPlayer(player))
+            continue;
+
+        for (BfCapturePointVector::iterator itr = m_capturePoints.begin(); itr != m_capturePoints.end(); ++itr)
+            (*itr)->HandlePlayerRelocation(player);
+    }
+}
+
 bool Battlefield::Update(uint32 diff)
 {
     if (m_Timer <= diff)
@@ -942,6 +981,7 @@ bool BfCapturePoint::SetCapturePointData(GameObject* capturePoint, TeamId team)
     LOG_DEBUG("bg.battlefield", "Creating capture point {}", capturePoint->GetEntry());
 
     m_capturePoint = capturePoint->GetGUID();
+    m_Bf->QueueZonePlayersRelocation();
 
     // check info existence
     GameObjectTemplate const* goinfo = capturePoint->GetGOInfo();
@@ -993,20 +1033,30 @@ GameObject* BfCapturePoint::GetCapturePointGo(WorldObject* obj)
     return ObjectAccessor::GetGameObject(*obj, m_capturePoint);
 }
 
+void BfCapturePoint::HandlePlayerRelocation(Player* player)
+{
+    GameObject* capturePoint = GetCapturePointGo();
+    if (!capturePoint)
+        return;
+
+    if (capturePoint->IsWithinDistInMap(player, capturePoint->GetGOInfo()->capturePoint.radius))
+        m_playersInRange.insert(player->GetGUID());
+    else
+        m_playersInRange.erase(player->GetGUID());
+}
+
 bool BfCapturePoint::Update(uint32 diff)
 {
     GameObject* capturePoint = GetCapturePointGo();
     if (!capturePoint)
         return false;
 
-    float radius = capturePoint->GetGOInfo()->capturePoint.radius;
-
     for (uint8 team = 0; team < 2; ++team)
     {
         for (GuidUnorderedSet::iterator itr = m_activePlayers[team].begin(); itr != m_activePlayers[team].end();)
         {
             if (Player* player = ObjectAccessor::FindPlayer(*itr))
-                if (!capturePoint->IsWithinDistInMap(player, radius) || !player->IsOutdoorPvPActive())
+                if (!m_playersInRange.count(*itr) || !player->IsOutdoorPvPActive())
                 {
                     itr = HandlePlayerLeave(player);
                     continue;
@@ -1016,15 +1066,11 @@ bool BfCapturePoint::Update(uint32 diff)
         }
     }
 
-    std::list<Player*> players;
-    Acore::AnyPlayerInObjectRangeCheck checker(capturePoint, radius);
-    Acore::PlayerListSearcher<Acore::AnyPlayerInObjectRangeCheck> searcher(capturePoint, players, checker);
-    Cell::VisitObjects(capturePoint, searcher, radius);
-
-    for (std::list<Player*>::iterator itr = players.begin(); itr != players.end(); ++itr)
-        if ((*itr)->IsOutdoorPvPActive())
-            if (m_activePlayers[(*itr)->GetTeamId()].insert((*itr)->GetGUID()).second)
-                HandlePlayerEnter(*itr);
+    for (ObjectGuid const& playerGuid : m_playersInRange)
+        if (Player* player = ObjectAccessor::FindPlayer(playerGuid))
+            if (player->IsOutdoorPvPActive())
+                if (m_activePlayers[player->GetTeamId()].insert(playerGuid).second)
+                    HandlePlayerEnter(player);
 
     // get the difference of numbers
     float fact_diff = ((float) m_activePlayers[0].size() - (float) m_activePlayers[1].size()) * diff / BATTLEFIELD_OBJECTIVE_UPDATE_INTERVAL;
@@ -23,6 +23,7 @@
 #include "ObjectAccessor.h"
 #include "SharedDefines.h"
 #include "ZoneScript.h"
+#include <mutex>
 
 enum BattlefieldTypes
 {
@@ -97,6 +98,10 @@ public:
     // Checks if player is in range of a capture credit marker
     bool IsInsideObjective(Player* player) const;
 
+    // Rechecks if a moved player of the zone is within the capture radius
+    void HandlePlayerRelocation(Player* player);
+    void RemovePlayerInRange(ObjectGuid guid) { m_playersInRange.erase(guid); }
+
     // Returns true if the state of the objective has changed, in this case, the OutdoorPvP must send a world state ui update.
     virtual bool Update(uint32 diff);
     virtual void ChangeTeam(TeamId /*oldTeam*/) {}
@@ -114,6 +119,9 @@ protected:
     // active Players in the area of the objective, 0 - alliance, 1 - horde
     GuidUnorderedSet m_activePlayers[2];
 
+    // Players within the capture radius, kept up to date by HandlePlayerRelocation
+    GuidUnorderedSet m_playersInRange;
+
     // Total shift needed to capture the objective
     float m_maxValue;
     float m_minValue;
@@ -263,6 +271,13 @@ public:
     /// Called when player (player) leave the zone
     void HandlePlayerLeaveZone(Player* player, uint32 zone);
 
+    /// Called from the map update when a player of the zone moves
+    void HandlePlayerRelocation(Player* player);
+    /// Called by BattlefieldMgr before Update, passes the moved players to the capture points
+    void ProcessRelocations();
+    /// Rechecks all players of the zone against the capture points, when one of them spawns
+    void QueueZonePlayersRelocation();
+
     // All-purpose data storage 64 bit
     uint64 GetData64(uint32 dataId) const override { return m_Data64[dataId]; }
     void SetData64(uint32 dataId, uint64 value) override { m_Data64[dataId] = value; }
@@ -424,6 +439,10 @@ protected:
     void RegisterZone(uint32 zoneid);
     bool HasPlayer(Player* player) const;
     void TeamCastSpell(TeamId team, int32 spellId);
+
+private:
+    std::mutex m_relocationLock;
+    GuidUnorderedSet m_relocatedPlayers;
 };
 
 #endif
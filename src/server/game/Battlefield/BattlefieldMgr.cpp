@@ -136,8 +136,11 @@ void BattlefieldMgr::Update(uint32 diff)
     if (m_UpdateTimer > BATTLEFIELD_OBJECTIVE_UPDATE_INTERVAL)
     {
         for (BattlefieldSet::iterator itr = m_BattlefieldSet.begin(); itr != m_BattlefieldSet.end(); ++itr)
+        {
+            (*itr)->ProcessRelocations();
             //if ((*itr)->IsEnabled())
             (*itr)->Update(m_UpdateTimer);
+        }
         m_UpdateTimer = 0;
     }
 }
@@ -825,6 +825,13 @@ uint32 Battleground::GetRealRepFactionForPlayer(uint32 factionId, Player* player
 
 void Battleground::UpdateWorldState(uint32 variable, uint32 value)
 {
+    // score ticks change the same world states several times per update
+    if (m_Map)
+    {
+        m_Map->UpdateWorldState(variable, value);
+        return;
+    }
+
     WorldPackets::WorldState::UpdateWorldState worldstate;
     worldstate.VariableID = variable;
     worldstate.Value = value;
@@ -1374,6 +1381,47 @@ void Battleground::SpectatorsSendPacket(WorldPacket& data)
         (*itr)->SendDirectMessage(&data);
 }
 
+void Battleground::QueueSpectatorMessage(std::string&& message, ObjectGuid target, char const* key)
+{
+    if (key)
+    {
+        auto [itr, inserted] = m_SpectatorValueMessages.try_emplace(std::make_pair(target, std::string(key)), m_SpectatorMessages.size());
+        if (!inserted)
+        {
+            // the older value is dropped, the new one stays behind the events queued meanwhile
+            m_SpectatorMessages[itr->second].clear();
+            itr->second = m_SpectatorMessages.size();
+        }
+    }
+
+    m_SpectatorMessages.push_back(std::move(message));
+}
+
+void Battleground::SendSpectatorMessages()
+{
+    if (m_SpectatorMessages.empty())
+        return;
+
+    if (GetStatus() == STATUS_IN_PROGRESS)
+    {
+        for (std::string const& message : m_SpectatorMessages)
+        {
+            if (message.empty())
+                continue;
+
+            WorldPacket data;
+            ArenaSpectator::CreatePacket(data, message);
+            SharedWorldPacket packet = std::make_shared<WorldPacket const>(std::move(data));
+
+            for (Player* spectator : m_Spectators)
+                spectator->GetSession()->SendSharedPacket(packet);
+        }
+    }
+
+    m_SpectatorMessages.clear();
+    m_SpectatorValueMessages.clear();
+}
+
 void Battleground::ReadyMarkerClicked(Player* p)
 {
     if (!isArena() || GetStatus() >= STATUS_IN_PROGRESS || GetStartDelayTime() <= BG_START_DELAY_15S || (m_Events & BG_STARTING_EVENT_3) || p->IsSpectator())
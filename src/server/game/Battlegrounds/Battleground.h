@@ -400,6 +400,8 @@ public:
     void AddToBeTeleported(ObjectGuid spectator, ObjectGuid participant) { m_ToBeTeleported[spectator] = participant; }
     void RemoveToBeTeleported(ObjectGuid spectator) { ToBeTeleportedMap::iterator itr = m_ToBeTeleported.find(spectator); if (itr != m_ToBeTeleported.end()) m_ToBeTeleported.erase(itr); }
     void SpectatorsSendPacket(WorldPacket& data);
+    void QueueSpectatorMessage(std::string&& message, ObjectGuid target = ObjectGuid::Empty, char const* key = nullptr);
+    void SendSpectatorMessages();
 
     [[nodiscard]] bool isArena() const        { return m_IsArena; }
     [[nodiscard]] bool isBattleground() const { return !m_IsArena; }
@@ -716,6 +718,10 @@ private:
     SpectatorList m_Spectators;
     ToBeTeleportedMap m_ToBeTeleported;
 
+    // Addon messages for the spectators, built once and shared by all of them at the end of the map update
+    std::vector<std::string> m_SpectatorMessages;
+    std::map<std::pair<ObjectGuid, std::string>, std::size_t> m_SpectatorValueMessages; // index of the latest value of a unit
+
     // Players count by team
     uint32 m_PlayersCount[PVP_TEAMS_COUNT];
 
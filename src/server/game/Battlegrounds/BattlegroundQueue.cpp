@@ -192,6 +192,7 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player* leader, Group* group, Battle
 
     //add GroupInfo to m_QueuedGroups
     m_QueuedGroups[bracketId][index].push_back(ginfo);
+    ++_ratedMatchStates[bracketId].Version;
 
     // announce world (this doesn't need mutex)
     SendJoinMessageArenaQueue(leader, ginfo, bracketEntry, isRated);
@@ -302,6 +303,8 @@ void BattlegroundQueue::RemovePlayer(ObjectGuid guid, bool decreaseInvitedCount)
 
     LOG_DEBUG("bg.battleground", "BattlegroundQueue: Removing {}, from bracket_id {}", guid.ToString(), _bracketId);
 
+    ++_ratedMatchStates[_bracketId].Version;
+
     // remove player from group queue info
     auto const& pitr = groupInfo->Players.find(guid);
     ASSERT(pitr != groupInfo->Players.end());
@@ -828,8 +831,14 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId
         // found out the minimum and maximum ratings the newly added team should battle against
         // arenaRating is the rating of the latest joined team, or 0
         // 0 is on (automatic update call) and we must set it to team's with longest wait time
-        if (!arenaRating)
+        bool const periodicUpdate = !arenaRating;
+        if (periodicUpdate)
         {
+            // nothing changed since the last update which found no match
+            RatedMatchState const& state = _ratedMatchStates[bracket_id];
+            if (state.CheckedVersion == state.Version && GameTime::GetGameTimeMS().count() < state.NextCheckTime)
+                return;
+
             GroupQueueInfo* front1 = nullptr;
             GroupQueueInfo* front2 = nullptr;
 
@@ -892,7 +901,12 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId
         }
 
         if (!found)
+        {
+            if (periodicUpdate)
+                SetRatedMatchChecked(bracket_id);
+
             return;
+        }
 
         if (found == 1)
         {
@@ -953,9 +967,37 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 diff, BattlegroundTypeId
             LOG_DEBUG("bg.battleground", "Starting rated arena match!");
             arena->StartBattleground();
         }
+        else if (periodicUpdate)
+            SetRatedMatchChecked(bracket_id);
     }
 }
 
+void BattlegroundQueue::SetRatedMatchChecked(BattlegroundBracketId bracket_id)
+{
+    uint32 const now = GameTime::GetGameTimeMS().count();
+    uint32 const ratingDiscardTimer = sBattlegroundMgr->GetRatingDiscardTimer();
+    uint32 const opponentsDiscardTimer = sWorld->getIntConfig(CONFIG_ARENA_PREV_OPPONENTS_DISCARD_TIMER);
+
+    // check again at least every minute, the timers can be reloaded
+    uint32 nextCheckTime = now + MINUTE * IN_MILLISECONDS;
+    for (uint8 i = BG_QUEUE_PREMADE_ALLIANCE; i < BG_QUEUE_NORMAL_ALLIANCE; ++i)
+    {
+        for (GroupQueueInfo const* ginfo : m_QueuedGroups[bracket_id][i])
+        {
+            if (ginfo->IsInvitedToBGInstanceGUID)
+                continue;
+
+            for (uint32 timer : { ratingDiscardTimer, opponentsDiscardTimer })
+                if (ginfo->JoinTime + timer >= now)
+                    nextCheckTime = std::min(nextCheckTime, ginfo->JoinTime + timer + 1);
+        }
+    }
+
+    RatedMatchState& state = _ratedMatchStates[bracket_id];
+    state.CheckedVersion = state.Version;
+    state.NextCheckTime = nextCheckTime;
+}
+
 void BattlegroundQueue::BattlegroundQueueAnnouncerUpdate(uint32 diff, BattlegroundQueueTypeId bgQueueTypeId, BattlegroundBracketId bracket_id)
 {
     BattlegroundTypeId bgTypeId = BattlegroundMgr::BGTemplateId(bgQueueTypeId);
@@ -973,6 +1015,12 @@ void BattlegroundQueue::BattlegroundQueueAnnouncerUpdate(uint32 diff, Battlegrou
 
     if (sWorld->getBoolConfig(CONFIG_BATTLEGROUND_QUEUE_ANNOUNCER_TIMED))
     {
+        if (IsAllQueuesEmpty(bracket_id))
+        {
+            _queueAnnouncementTimer[bracket_id] = -1;
+            return;
+        }
+
         uint32 qPlayers = 0;
 
         if (_queueAnnouncementCrossfactioned)
@@ -1229,6 +1277,7 @@ void BattlegroundQueue::InviteGroupToBG(GroupQueueInfo* ginfo, Battleground* bg,
 
     // set invitation
     ginfo->IsInvitedToBGInstanceGUID = bg->GetInstanceID();
+    ++_ratedMatchStates[ginfo->BracketId].Version;
 
     BattlegroundTypeId bgTypeId = bg->GetBgTypeID();
     BattlegroundQueueTypeId bgQueueTypeId = BattlegroundMgr::BGQueueTypeId(ginfo->BgTypeId, ginfo->ArenaType);
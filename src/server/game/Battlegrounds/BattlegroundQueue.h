@@ -129,6 +129,19 @@ public:
     [[nodiscard]] int32 GetQueueAnnouncementTimer(uint32 bracketId) const;
 
 private:
+    // The periodic rated arena update of a bracket is skipped while its groups don't change
+    // and none of them reaches the rating or previous opponents discard timers
+    struct RatedMatchState
+    {
+        uint32 Version{1};                                  // changed by every join, leave and invitation in the bracket
+        uint32 CheckedVersion{0};                           // version of the last periodic update which found no match
+        uint32 NextCheckTime{0};                            // game time (ms) when a waiting group reaches a discard timer
+    };
+
+    void SetRatedMatchChecked(BattlegroundBracketId bracket_id);
+
+    std::array<RatedMatchState, MAX_BATTLEGROUND_BRACKETS> _ratedMatchStates;
+
     uint32 m_WaitTimes[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS][COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME];
     uint32 m_WaitTimeLastIndex[PVP_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS];
 
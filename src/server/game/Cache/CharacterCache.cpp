@@ -22,12 +22,29 @@
 #include "Player.h"
 #include "Timer.h"
 #include "World.h"
+#include <string_view>
 #include <unordered_map>
 
 namespace
 {
     std::unordered_map<ObjectGuid, CharacterCacheEntry> _characterCacheStore;
-    std::unordered_map<std::string, CharacterCacheEntry*> _characterCacheByNameStore;
+    // keys view the Name of the entry they point to, entries are not moved by the node based store
+    std::unordered_map<std::string_view, CharacterCacheEntry*> _characterCacheByNameStore;
+
+    // must run before the name of the entry changes or the entry is erased
+    void EraseNameKey(CharacterCacheEntry const& entry)
+    {
+        auto itr = _characterCacheByNameStore.find(entry.Name);
+        if (itr != _characterCacheByNameStore.end() && itr->second == &entry)
+            _characterCacheByNameStore.erase(itr);
+    }
+
+    // a key of an other entry with the same name is replaced, so no key outlives the name it views
+    void InsertNameKey(CharacterCacheEntry& entry)
+    {
+        _characterCacheByNameStore.erase(entry.Name);
+        _characterCacheByNameStore.emplace(entry.Name, &entry);
+    }
 }
 
 CharacterCache* CharacterCache::instance()
@@ -59,16 +76,21 @@ CharacterCache* CharacterCache::instance()
 
 void CharacterCache::LoadCharacterCacheStorage()
 {
+    _characterCacheByNameStore.clear();
     _characterCacheStore.clear();
     uint32 oldMSTime = getMSTime();
 
-    QueryResult result = CharacterDatabase.Query("SELECT guid, name, account, race, gender, class, level FROM characters");
+    QueryResult result = CharacterDatabase.ReplicaQuery("SELECT guid, name, account, race, gender, class, level FROM characters");
     if (!result)
     {
         LOG_INFO("server.loading", "No character name data loaded, empty query!");
         return;
     }
 
+    // no rehashing while the realm is loaded
+    _characterCacheStore.reserve(result->GetRowCount());
+    _characterCacheByNameStore.reserve(result->GetRowCount());
+
     do
     {
         Field* fields = result->Fetch();
@@ -76,7 +98,7 @@ void CharacterCache::LoadCharacterCacheStorage()
             fields[4].Get<uint8>() /*gender*/, fields[3].Get<uint8>() /*race*/, fields[5].Get<uint8>() /*class*/, fields[6].Get<uint8>() /*level*/);
     } while (result->NextRow());
 
-    QueryResult mailCountResult = CharacterDatabase.Query("SELECT receiver, COUNT(receiver) FROM mail GROUP BY receiver");
+    QueryResult mailCountResult = CharacterDatabase.ReplicaQuery("SELECT receiver, COUNT(receiver) FROM mail GROUP BY receiver");
     if (mailCountResult)
     {
         do
@@ -122,6 +144,10 @@ Modifying functions
 void CharacterCache::AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accountId, std::string const& name, uint8 gender, uint8 race, uint8 playerClass, uint8 level)
 {
     CharacterCacheEntry& data = _characterCacheStore[guid];
+
+    // the key of a replaced entry views its old name
+    EraseNameKey(data);
+
     data.Guid = guid;
     data.Name = name;
     data.AccountId = accountId;
@@ -136,13 +162,19 @@ void CharacterCache::AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accou
     }
 
     // Fill Name to Guid Store
-    _characterCacheByNameStore[name] = &data;
+    InsertNameKey(data);
 }
 
 void CharacterCache::DeleteCharacterCacheEntry(ObjectGuid const& guid, std::string const& name)
 {
-    _characterCacheStore.erase(guid);
+    auto itr = _characterCacheStore.find(guid);
+    if (itr != _characterCacheStore.end())
+        EraseNameKey(itr->second);
+
     _characterCacheByNameStore.erase(name);
+
+    if (itr != _characterCacheStore.end())
+        _characterCacheStore.erase(itr);
 }
 
 void CharacterCache::UpdateCharacterData(ObjectGuid const& guid, std::string const& name, Optional<uint8> gender /*= {}*/, Optional<uint8> race /*= {}*/)
@@ -151,7 +183,8 @@ void CharacterCache::UpdateCharacterData(ObjectGuid const& guid, std::string con
     if (itr == _characterCacheStore.end())
         return;
 
-    std::string oldName = itr->second.Name;
+    // drop the key viewing the old name before the name changes
+    EraseNameKey(itr->second);
     itr->second.Name = name;
 
     if (gender)
@@ -168,8 +201,7 @@ void CharacterCache::UpdateCharacterData(ObjectGuid const& guid, std::string con
     //sWorld->SendGlobalMessage(packet.Write());
 
     // Correct name -> pointer storage
-    _characterCacheByNameStore.erase(oldName);
-    _characterCacheByNameStore[name] = &itr->second;
+    InsertNameKey(itr->second);
 }
 
 void CharacterCache::UpdateCharacterLevel(ObjectGuid const& guid, uint8 level)
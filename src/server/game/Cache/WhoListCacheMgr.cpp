@@ -34,6 +34,17 @@ void WhoListCacheMgr::Update()
     _whoListStorage.clear();
     _whoListStorage.reserve(sWorldSessionMgr->GetPlayerCount() + 1);
 
+    for (IndexList& list : _levelIndex)
+        list.clear();
+
+    for (IndexList& list : _classIndex)
+        list.clear();
+
+    for (IndexList& list : _raceIndex)
+        list.clear();
+
+    _zoneIndex.clear();
+
     for (auto const& [guid, player] : ObjectAccessor::GetPlayers())
     {
         if (!player->FindMap() || player->GetSession()->PlayerLoading())
@@ -59,5 +70,120 @@ void WhoListCacheMgr::Update()
             player->getClass(), player->getRace(),
             (player->IsSpectator() ? AREA_DALARAN : player->GetZoneId()), player->getGender(), player->IsVisible(),
             widePlayerName, wideGuildName, playerName, guildName);
+
+        WhoListPlayerInfo const& info = _whoListStorage.back();
+        uint32 index = _whoListStorage.size() - 1;
+        _levelIndex[info.GetLevel()].push_back(index);
+
+        if (info.GetClass() < MAX_CLASSES)
+            _classIndex[info.GetClass()].push_back(index);
+
+        if (info.GetRace() < MAX_RACES)
+            _raceIndex[info.GetRace()].push_back(index);
+
+        _zoneIndex[info.GetZoneId()].push_back(index);
     }
 }
+
+std::vector<WhoListPlayerInfo const*> WhoListCacheMgr::GetCandidates(uint32 levelMin, uint32 levelMax, uint32 raceMask, uint32 classMask,
+    uint32 const* zoneIds, uint32 zonesCount, std::wstring const& widePlayerName, std::wstring const& wideGuildName) const
+{
+    std::vector<WhoListPlayerInfo const*> candidates;
+
+    levelMax = std::min<uint32>(levelMax, _levelIndex.size() - 1);
+    if (levelMin > levelMax)
+        return candidates;
+
+    // collect the lists selected by each criterion and walk the criterion with the fewest entries
+    std::vector<IndexList const*> levelLists, classLists, raceLists, zoneLists;
+    std::size_t levelCount = 0, classCount = 0, raceCount = 0, zoneCount = 0;
+
+    for (uint32 level = levelMin; level <= levelMax; ++level)
+    {
+        levelLists.push_back(&_levelIndex[level]);
+        levelCount += _levelIndex[level].size();
+    }
+
+    for (uint32 i = 0; i < MAX_CLASSES; ++i)
+    {
+        if (classMask & (1 << i))
+        {
+            classLists.push_back(&_classIndex[i]);
+            classCount += _classIndex[i].size();
+        }
+    }
+
+    for (uint32 i = 0; i < MAX_RACES; ++i)
+    {
+        if (raceMask & (1 << i))
+        {
+            raceLists.push_back(&_raceIndex[i]);
+            raceCount += _raceIndex[i].size();
+        }
+    }
+
+    std::vector<IndexList const*>* lists = &levelLists;
+    std::size_t count = levelCount;
+
+    if (classCount < count)
+    {
+        lists = &classLists;
+        count = classCount;
+    }
+
+    if (raceCount < count)
+    {
+        lists = &raceLists;
+        count = raceCount;
+    }
+
+    if (zonesCount)
+    {
+        for (uint32 i = 0; i < zonesCount; ++i)
+        {
+            // the client may send the same zone twice
+            if (std::find(zoneIds, zoneIds + i, zoneIds[i]) != zoneIds + i)
+                continue;
+
+            auto itr = _zoneIndex.find(zoneIds[i]);
+            if (itr == _zoneIndex.end())
+                continue;
+
+            zoneLists.push_back(&itr->second);
+            zoneCount += itr->second.size();
+        }
+
+        if (zoneCount < count)
+        {
+            lists = &zoneLists;
+            count = zoneCount;
+        }
+    }
+
+    if (!count)
+        return candidates;
+
+    IndexList indexes;
+    indexes.reserve(count);
+    for (IndexList const* list : *lists)
+        indexes.insert(indexes.end(), list->begin(), list->end());
+
+    // the reply is capped, keep the order of the full list
+    if (lists->size() > 1)
+        std::sort(indexes.begin(), indexes.end());
+
+    uint64 playerNameMask = WhoListPlayerInfo::GetCharacterMask(widePlayerName);
+    uint64 guildNameMask = WhoListPlayerInfo::GetCharacterMask(wideGuildName);
+
+    candidates.reserve(indexes.size());
+    for (uint32 index : indexes)
+    {
+        WhoListPlayerInfo const& info = _whoListStorage[index];
+        if (!info.MayContainPlayerName(playerNameMask) || !info.MayContainGuildName(guildNameMask))
+            continue;
+
+        candidates.push_back(&info);
+    }
+
+    return candidates;
+}
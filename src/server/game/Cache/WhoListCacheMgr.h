@@ -21,6 +21,8 @@
 #include "Common.h"
 #include "ObjectGuid.h"
 #include "SharedDefines.h"
+#include <array>
+#include <unordered_map>
 
 class WhoListPlayerInfo
 {
@@ -39,7 +41,9 @@ public:
         _widePlayerName(widePlayerName),
         _wideGuildName(wideGuildName),
         _playerName(playerName),
-        _guildName(guildName) { }
+        _guildName(guildName),
+        _playerNameMask(GetCharacterMask(widePlayerName)),
+        _guildNameMask(GetCharacterMask(wideGuildName)) { }
 
     ObjectGuid GetGuid() const { return _guid; }
     TeamId GetTeamId() const { return _team; }
@@ -55,6 +59,20 @@ public:
     std::string const& GetPlayerName() const { return _playerName; }
     std::string const& GetGuildName() const { return _guildName; }
 
+    // a name can only contain the search string if it has all of its characters
+    bool MayContainPlayerName(uint64 mask) const { return (_playerNameMask & mask) == mask; }
+    bool MayContainGuildName(uint64 mask) const { return (_guildNameMask & mask) == mask; }
+
+    // one bit per character, folded into 64 bits
+    static uint64 GetCharacterMask(std::wstring const& str)
+    {
+        uint64 mask = 0;
+        for (wchar_t ch : str)
+            mask |= UI64LIT(1) << (uint32(ch) % 64);
+
+        return mask;
+    }
+
 private:
     ObjectGuid _guid;
     TeamId _team;
@@ -69,6 +87,8 @@ private:
     std::wstring _wideGuildName;
     std::string _playerName;
     std::string _guildName;
+    uint64 _playerNameMask;
+    uint64 _guildNameMask;
 };
 
 using WhoListInfoVector = std::vector<WhoListPlayerInfo>;
@@ -89,8 +109,21 @@ public:
     void Update();
     WhoListInfoVector const& GetWhoList() const { return _whoListStorage; }
 
+    // Entries which can match the level range, masks, zones and names of a /who request, in list order.
+    // The names must be lowercase, and the caller still checks every criterion of the request.
+    std::vector<WhoListPlayerInfo const*> GetCandidates(uint32 levelMin, uint32 levelMax, uint32 raceMask, uint32 classMask,
+        uint32 const* zoneIds, uint32 zonesCount, std::wstring const& widePlayerName, std::wstring const& wideGuildName) const;
+
 protected:
+    using IndexList = std::vector<uint32>;
+
     WhoListInfoVector _whoListStorage;
+
+    // positions in _whoListStorage, rebuilt with it
+    std::array<IndexList, 256> _levelIndex;
+    std::array<IndexList, MAX_CLASSES> _classIndex;
+    std::array<IndexList, MAX_RACES> _raceIndex;
+    std::unordered_map<uint32, IndexList> _zoneIndex;
 };
 
 #define sWhoListCacheMgr WhoListCacheMgr::instance()
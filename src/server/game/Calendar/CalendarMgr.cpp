@@ -88,6 +88,7 @@ void CalendarMgr::LoadFromDB()
 
             CalendarEvent* calendarEvent = new CalendarEvent(eventId, creatorGUID, guildId, type, dungeonId, time_t(eventTime), flags, time_t(timezoneTime), title, description);
             _events.insert(calendarEvent);
+            IndexEvent(calendarEvent);
 
             _maxEventId = std::max(_maxEventId, eventId);
 
@@ -114,6 +115,7 @@ void CalendarMgr::LoadFromDB()
 
             CalendarInvite* invite = new CalendarInvite(inviteId, eventId, invitee, senderGUID, time_t(statusTime), status, rank, text);
             _invites[eventId].push_back(invite);
+            IndexInvite(invite);
 
             _maxInviteId = std::max(_maxInviteId, inviteId);
 
@@ -132,9 +134,50 @@ void CalendarMgr::LoadFromDB()
             _freeInviteIds.push_back(i);
 }
 
+void CalendarMgr::IndexEvent(CalendarEvent* calendarEvent)
+{
+    _eventsById.emplace(calendarEvent->GetEventId(), calendarEvent);
+
+    if (calendarEvent->GetGuildId())
+        _guildEvents[calendarEvent->GetGuildId()].insert(calendarEvent);
+}
+
+void CalendarMgr::UnindexEvent(CalendarEvent* calendarEvent)
+{
+    if (auto itr = _eventsById.find(calendarEvent->GetEventId()); itr != _eventsById.end() && itr->second == calendarEvent)
+        _eventsById.erase(itr);
+
+    if (auto itr = _guildEvents.find(calendarEvent->GetGuildId()); itr != _guildEvents.end())
+    {
+        itr->second.erase(calendarEvent);
+        if (itr->second.empty())
+            _guildEvents.erase(itr);
+    }
+}
+
+void CalendarMgr::IndexInvite(CalendarInvite* invite)
+{
+    _invitesById.emplace(invite->GetInviteId(), invite);
+    _playerInvites[invite->GetInviteeGUID()].push_back(invite);
+}
+
+void CalendarMgr::UnindexInvite(CalendarInvite* invite)
+{
+    if (auto itr = _invitesById.find(invite->GetInviteId()); itr != _invitesById.end() && itr->second == invite)
+        _invitesById.erase(itr);
+
+    if (auto itr = _playerInvites.find(invite->GetInviteeGUID()); itr != _playerInvites.end())
+    {
+        std::erase(itr->second, invite);
+        if (itr->second.empty())
+            _playerInvites.erase(itr);
+    }
+}
+
 void CalendarMgr::AddEvent(CalendarEvent* calendarEvent, CalendarSendEventType sendType)
 {
     _events.insert(calendarEvent);
+    IndexEvent(calendarEvent);
     UpdateEvent(calendarEvent);
     SendCalendarEvent(calendarEvent->GetCreatorGUID(), *calendarEvent, sendType);
 }
@@ -150,6 +193,7 @@ void CalendarMgr::AddInvite(CalendarEvent* calendarEvent, CalendarInvite* invite
     if (!calendarEvent->IsGuildAnnouncement())
     {
         _invites[invite->GetEventId()].push_back(invite);
+        IndexInvite(invite);
         UpdateInvite(invite, trans);
     }
 }
@@ -195,10 +239,12 @@ CalendarEventStore::iterator CalendarMgr::RemoveEvent(CalendarEvent* calendarEve
         if (remover && invite->GetInviteeGUID() != remover)
             mail.SendMailTo(trans, MailReceiver(invite->GetInviteeGUID().GetCounter()), calendarEvent, MAIL_CHECK_MASK_COPIED);
 
+        UnindexInvite(invite);
         delete invite;
     }
 
     _invites.erase(calendarEvent->GetEventId());
+    UnindexEvent(calendarEvent);
 
     stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CALENDAR_EVENT);
     stmt->SetData(0, calendarEvent->GetEventId());
@@ -252,6 +298,7 @@ void CalendarMgr::RemoveInvite(uint64 inviteId, uint64 eventId, ObjectGuid /*rem
     //    MailDraft(calendarEvent->BuildCalendarMailSubject(remover), calendarEvent->BuildCalendarMailBody())
     //        .SendMailTo(trans, MailReceiver((*itr)->GetInvitee()), calendarEvent, MAIL_CHECK_MASK_COPIED);
 
+    UnindexInvite(*itr);
     delete *itr;
     _invites[eventId].erase(itr);
 }
@@ -323,24 +370,20 @@ void CalendarMgr::RemovePlayerGuildEventsAndSignups(ObjectGuid guid, uint32 guil
 
 CalendarEvent* CalendarMgr::GetEvent(uint64 eventId, CalendarEventStore::iterator* it)
 {
-    for (CalendarEventStore::iterator itr = _events.begin(); itr != _events.end(); ++itr)
-        if ((*itr)->GetEventId() == eventId)
-        {
-            if (it)
-                *it = itr;
+    auto itr = _eventsById.find(eventId);
+    if (itr == _eventsById.end())
+        return nullptr;
 
-            return *itr;
-        }
+    if (it)
+        *it = _events.find(itr->second);
 
-    return nullptr;
+    return itr->second;
 }
 
 CalendarInvite* CalendarMgr::GetInvite(uint64 inviteId) const
 {
-    for (CalendarEventInviteStore::const_iterator itr = _invites.begin(); itr != _invites.end(); ++itr)
-        for (CalendarInviteStore::const_iterator itr2 = itr->second.begin(); itr2 != itr->second.end(); ++itr2)
-            if ((*itr2)->GetInviteId() == inviteId)
-                return *itr2;
+    if (auto itr = _invitesById.find(inviteId); itr != _invitesById.end())
+        return itr->second;
 
     LOG_DEBUG("entities.unit", "CalendarMgr::GetInvite: [{}] not found!", inviteId);
     return nullptr;
@@ -414,10 +457,13 @@ CalendarEventStore CalendarMgr::GetGuildEvents(uint32 guildId)
     if (!guildId)
         return result;
 
-    for (CalendarEventStore::const_iterator itr = _events.begin(); itr != _events.end(); ++itr)
-        if ((*itr)->IsGuildEvent() || (*itr)->IsGuildAnnouncement())
-            if ((*itr)->GetGuildId() == guildId)
-                result.insert(*itr);
+    auto guildItr = _guildEvents.find(guildId);
+    if (guildItr == _guildEvents.end())
+        return result;
+
+    for (CalendarEvent* event : guildItr->second)
+        if (event->IsGuildEvent() || event->IsGuildAnnouncement())
+            result.insert(event);
 
     return result;
 }
@@ -426,17 +472,15 @@ CalendarEventStore CalendarMgr::GetPlayerEvents(ObjectGuid guid)
 {
     CalendarEventStore events;
 
-    for (CalendarEventInviteStore::const_iterator itr = _invites.begin(); itr != _invites.end(); ++itr)
-        for (CalendarInviteStore::const_iterator itr2 = itr->second.begin(); itr2 != itr->second.end(); ++itr2)
-            if ((*itr2)->GetInviteeGUID() == guid)
-                if (CalendarEvent* event = GetEvent(itr->first)) // nullptr check added as attempt to fix #11512
-                    events.insert(event);
+    if (auto inviteItr = _playerInvites.find(guid); inviteItr != _playerInvites.end())
+        for (CalendarInvite const* invite : inviteItr->second)
+            if (CalendarEvent* event = GetEvent(invite->GetEventId())) // nullptr check added as attempt to fix #11512
+                events.insert(event);
 
     if (Player* player = ObjectAccessor::FindConnectedPlayer(guid))
         if (player->GetGuildId())
-            for (CalendarEventStore::const_iterator itr = _events.begin(); itr != _events.end(); ++itr)
-                if ((*itr)->GetGuildId() == player->GetGuildId())
-                    events.insert(*itr);
+            if (auto guildItr = _guildEvents.find(player->GetGuildId()); guildItr != _guildEvents.end())
+                events.insert(guildItr->second.begin(), guildItr->second.end());
 
     return events;
 }
@@ -448,14 +492,10 @@ CalendarInviteStore const& CalendarMgr::GetEventInvites(uint64 eventId)
 
 CalendarInviteStore CalendarMgr::GetPlayerInvites(ObjectGuid guid)
 {
-    CalendarInviteStore invites;
-
-    for (CalendarEventInviteStore::const_iterator itr = _invites.begin(); itr != _invites.end(); ++itr)
-        for (CalendarInviteStore::const_iterator itr2 = itr->second.begin(); itr2 != itr->second.end(); ++itr2)
-            if ((*itr2)->GetInviteeGUID() == guid)
-                invites.push_back(*itr2);
+    if (auto itr = _playerInvites.find(guid); itr != _playerInvites.end())
+        return itr->second;
 
-    return invites;
+    return CalendarInviteStore();
 }
 
 uint32 CalendarMgr::GetPlayerNumPending(ObjectGuid guid)
@@ -283,11 +283,22 @@ private:
     CalendarEventStore _events;
     CalendarEventInviteStore _invites;
 
+    // lookups of the events and invites above, so queries don't scan all of them
+    std::unordered_map<uint64 /* eventId */, CalendarEvent*> _eventsById;
+    std::unordered_map<uint64 /* inviteId */, CalendarInvite*> _invitesById;
+    std::unordered_map<ObjectGuid /* invitee */, CalendarInviteStore> _playerInvites;
+    std::unordered_map<uint32 /* guildId */, CalendarEventStore> _guildEvents;
+
     std::deque<uint64> _freeEventIds;
     std::deque<uint64> _freeInviteIds;
     uint64 _maxEventId;
     uint64 _maxInviteId;
 
+    void IndexEvent(CalendarEvent* calendarEvent);
+    void UnindexEvent(CalendarEvent* calendarEvent);
+    void IndexInvite(CalendarInvite* invite);
+    void UnindexInvite(CalendarInvite* invite);
+
 public:
     static CalendarMgr* instance();
 
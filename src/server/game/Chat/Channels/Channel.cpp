@@ -207,7 +207,7 @@ void Channel::JoinChannel(Player* player, std::string const& pass)
     pinfo.flags = MEMBER_FLAG_NONE;
     pinfo.plrPtr = player;
 
-    playersStore[guid] = pinfo;
+    AddMember(pinfo);
 
     if (_channelRights.joinMessage.length())
         ChatHandler(player->GetSession()).PSendSysMessage("{}", _channelRights.joinMessage);
@@ -271,7 +271,7 @@ void Channel::LeaveChannel(Player* player, bool send)
 
     bool changeowner = playersStore[guid].IsOwner();
 
-    playersStore.erase(guid);
+    RemoveMember(guid);
     if (_announce && ShouldAnnouncePlayer(player))
     {
         WorldPacket data;
@@ -438,7 +438,7 @@ void Channel::KickOrBan(Player const* player, std::string const& badname, bool b
 
     if (isOnChannel)
     {
-        playersStore.erase(victim);
+        RemoveMember(victim);
         bad->LeftChannel(this);
         RemoveWatching(bad);
         LeaveNotify(bad);
@@ -906,16 +906,20 @@ void Channel::SetOwner(ObjectGuid guid, bool exclaim)
 
 void Channel::SendToAll(WorldPacket* data, ObjectGuid guid)
 {
-    for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
-        if (!guid || !i->second.plrPtr->GetSocial()->HasIgnore(guid))
-            i->second.plrPtr->SendDirectMessage(data);
+    SharedWorldPacket const shared = std::make_shared<WorldPacket const>(*data);
+
+    for (auto const& [memberGuid, member] : playersList)
+        if (!guid || !member->GetSocial()->HasIgnore(guid))
+            member->GetSession()->SendSharedPacket(shared);
 }
 
 void Channel::SendToAllButOne(WorldPacket* data, ObjectGuid who)
 {
-    for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
-        if (i->first != who)
-            i->second.plrPtr->SendDirectMessage(data);
+    SharedWorldPacket const shared = std::make_shared<WorldPacket const>(*data);
+
+    for (auto const& [memberGuid, member] : playersList)
+        if (memberGuid != who)
+            member->GetSession()->SendSharedPacket(shared);
 }
 
 void Channel::SendToOne(WorldPacket* data, ObjectGuid who)
@@ -926,8 +930,10 @@ void Channel::SendToOne(WorldPacket* data, ObjectGuid who)
 
 void Channel::SendToAllWatching(WorldPacket* data)
 {
+    SharedWorldPacket const shared = std::make_shared<WorldPacket const>(*data);
+
     for (PlayersWatchingContainer::const_iterator i = playersWatchingStore.begin(); i != playersWatchingStore.end(); ++i)
-        (*i)->SendDirectMessage(data);
+        (*i)->GetSession()->SendSharedPacket(shared);
 }
 
 bool Channel::ShouldAnnouncePlayer(Player const* player) const
@@ -935,6 +941,34 @@ bool Channel::ShouldAnnouncePlayer(Player const* player) const
     return !(player->GetSession()->IsGMAccount() && sWorld->getBoolConfig(CONFIG_SILENTLY_GM_JOIN_TO_CHANNEL));
 }
 
+void Channel::AddMember(PlayerInfo& pinfo)
+{
+    RemoveMember(pinfo.player);
+
+    pinfo.listIndex = playersList.size();
+    playersList.emplace_back(pinfo.player, pinfo.plrPtr);
+    playersStore[pinfo.player] = pinfo;
+}
+
+void Channel::RemoveMember(ObjectGuid guid)
+{
+    PlayerContainer::iterator itr = playersStore.find(guid);
+    if (itr == playersStore.end())
+        return;
+
+    uint32 index = itr->second.listIndex;
+    playersStore.erase(itr);
+
+    // the last member takes the freed slot
+    if (index + 1 < playersList.size())
+    {
+        playersList[index] = playersList.back();
+        playersStore[playersList[index].first].listIndex = index;
+    }
+
+    playersList.pop_back();
+}
+
 void Channel::Voice(ObjectGuid /*guid1*/, ObjectGuid /*guid2*/)
 {
 }
@@ -147,6 +147,7 @@ class Channel
         ObjectGuid player;
         uint8 flags;
         Player* plrPtr; // pussywizard
+        uint32 listIndex; // position in playersList
 
         [[nodiscard]] bool HasFlag(uint8 flag) const { return flags & flag; }
         void SetFlag(uint8 flag) { if (!HasFlag(flag)) flags |= flag; }
@@ -269,6 +270,10 @@ private:
 
     bool ShouldAnnouncePlayer(Player const* player) const;
 
+    // keep playersStore and playersList in sync
+    void AddMember(PlayerInfo& pinfo);
+    void RemoveMember(ObjectGuid guid);
+
     [[nodiscard]] bool IsOn(ObjectGuid who) const { return playersStore.find(who) != playersStore.end(); }
     [[nodiscard]] bool IsBanned(ObjectGuid guid) const;
 
@@ -314,6 +319,7 @@ private:
     }
 
     typedef std::unordered_map<ObjectGuid, PlayerInfo> PlayerContainer;
+    typedef std::vector<std::pair<ObjectGuid, Player*>> PlayerList;
     typedef std::unordered_map<ObjectGuid, uint32> BannedContainer;
     typedef std::unordered_set<Player*> PlayersWatchingContainer;
 
@@ -331,6 +337,7 @@ private:
     std::string _password;
     ChannelRights _channelRights;
     PlayerContainer playersStore;
+    PlayerList playersList; // members of playersStore in a contiguous array, walked by the broadcasts
     BannedContainer bannedStore;
     PlayersWatchingContainer playersWatchingStore;
 };
@@ -24,9 +24,104 @@
 #include "SpellInfo.h"
 #include "SpellMgr.h"
 #include "World.h"
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 
 using namespace Acore::Hyperlinks;
 
+namespace
+{
+    /*
+     * LRU of the raw text of links which passed validation, trade channel spam
+     * repeats the same item and spell links in every message. Entries are tagged
+     * with the link checking severity and the generation bumped by ClearLinkCache,
+     * the shards have their own lock as chat is handled by the map threads too.
+     */
+    class ValidLinkCache
+    {
+    public:
+        explicit ValidLinkCache(uint32 capacity) : _shardCapacity(capacity ? std::max<std::size_t>(capacity / SHARD_COUNT, 1) : 0), _generation(0) { }
+
+        bool Contains(int32 severity, std::string_view link)
+        {
+            if (!_shardCapacity)
+                return false;
+
+            uint32 const generation = GetGeneration(severity);
+            Shard& shard = GetShard(link);
+            std::lock_guard<std::mutex> guard(shard.Lock);
+
+            if (shard.Generation != generation)
+            {
+                shard.Entries.clear();
+                shard.Index.clear();
+                shard.Generation = generation;
+                return false;
+            }
+
+            auto itr = shard.Index.find(link);
+            if (itr == shard.Index.end())
+                return false;
+
+            shard.Entries.splice(shard.Entries.begin(), shard.Entries, itr->second);
+            return true;
+        }
+
+        void Store(int32 severity, std::string_view link)
+        {
+            if (!_shardCapacity)
+                return;
+
+            uint32 const generation = GetGeneration(severity);
+            Shard& shard = GetShard(link);
+            std::lock_guard<std::mutex> guard(shard.Lock);
+
+            // validated against data cleared meanwhile
+            if (shard.Generation != generation || shard.Index.contains(link))
+                return;
+
+            if (shard.Entries.size() >= _shardCapacity)
+            {
+                shard.Index.erase(shard.Entries.back());
+                shard.Entries.pop_back();
+            }
+
+            // the index views the strings owned by the list nodes
+            shard.Entries.emplace_front(link);
+            shard.Index.emplace(shard.Entries.front(), shard.Entries.begin());
+        }
+
+        void Clear() { ++_generation; }
+
+    private:
+        static constexpr std::size_t SHARD_COUNT = 8;
+
+        struct Shard
+        {
+            std::mutex Lock;
+            uint32 Generation = 0;
+            std::list<std::string> Entries;     // most recently used first
+            std::unordered_map<std::string_view, std::list<std::string>::iterator> Index;
+        };
+
+        uint32 GetGeneration(int32 severity) const { return (_generation.load(std::memory_order_relaxed) << 2) | uint32(severity + 2); }
+        Shard& GetShard(std::string_view link) { return _shards[std::hash<std::string_view>()(link) % SHARD_COUNT]; }
+
+        std::size_t _shardCapacity;
+        std::atomic<uint32> _generation;
+        std::array<Shard, SHARD_COUNT> _shards;
+    };
+
+    ValidLinkCache& GetValidLinkCache()
+    {
+        static ValidLinkCache cache(sWorld->getIntConfig(CONFIG_CHAT_STRICT_LINK_CHECKING_CACHE_SIZE));
+        return cache;
+    }
+}
+
 inline uint8 toHex(char c) { return (c >= '0' && c <= '9') ? c - '0' + 0x10 : (c >= 'a' && c <= 'f') ? c - 'a' + 0x1a : 0x00; }
 
 // Validates a single hyperlink
@@ -377,47 +472,55 @@ static bool ValidateLinkInfo(HyperlinkInfo const& info)
 // Validates all hyperlinks and control sequences contained in str
 bool Acore::Hyperlinks::CheckAllLinks(std::string_view str)
 {
-    // Step 1: Disallow all control sequences except ||, |H, |h, |c and |r
-    {
-        std::string_view::size_type pos = 0;
-        while ((pos = str.find('|', pos)) != std::string::npos)
-        {
-            ++pos;
-            if (pos == str.length())
-                return false;
-            char next = str[pos];
-            if (next == 'H' || next == 'h' || next == 'c' || next == 'r' || next == '|')
-                ++pos;
-            else
-                return false;
-        }
-    }
-
-    // Step 2: Parse all link sequences
-    // They look like this: |c<color>|H<linktag>:<linkdata>|h[<linktext>]|h|r
+    // Single pass over all control sequences, every | starts either an escaped pipe
+    // character (||) or a link, which look like this: |c<color>|H<linktag>:<linkdata>|h[<linktext>]|h|r
     // - <color> is 8 hex characters AARRGGBB
     // - <linktag> is arbitrary length [a-z_]
     // - <linkdata> is arbitrary length, no | contained
     // - <linktext> is printable
+    // so the |H, |h and |r sequences are only allowed as part of a link.
+    ValidLinkCache& cache = GetValidLinkCache();
+    int32 const severity = static_cast<int32>(sWorld->getIntConfig(CONFIG_CHAT_STRICT_LINK_CHECKING_SEVERITY));
+
+    std::string_view::size_type pos;
+    while ((pos = str.find('|')) != std::string_view::npos)
     {
-        std::string::size_type pos;
-        while ((pos = str.find('|')) != std::string::npos)
+        str.remove_prefix(pos);
+        if (str.length() < 2)
+            return false;
+
+        if (str[1] == '|') // this is an escaped pipe character (||)
         {
-            if (str[pos + 1] == '|') // this is an escaped pipe character (||)
-            {
-                str = str.substr(pos + 2);
-                continue;
-            }
+            str.remove_prefix(2);
+            continue;
+        }
 
-            HyperlinkInfo info = ParseSingleHyperlink(str.substr(pos));
-            if (!info || !ValidateLinkInfo(info))
-                return false;
+        // neither data nor text contain a |, a valid link ends at the first |h|r
+        std::string_view link;
+        if (std::size_t end = str.find("|h|r"); end != std::string_view::npos)
+            link = str.substr(0, end + 4);
 
-            // tag is fine, find the next one
-            str = info.tail;
+        if (!link.empty() && cache.Contains(severity, link))
+        {
+            str.remove_prefix(link.length());
+            continue;
         }
+
+        HyperlinkInfo info = ParseSingleHyperlink(str);
+        if (!info || !ValidateLinkInfo(info))
+            return false;
+
+        cache.Store(severity, str.substr(0, str.length() - info.tail.length()));
+
+        // tag is fine, find the next one
+        str = info.tail;
     }
 
     // all tags are valid
     return true;
 }
+
+void Acore::Hyperlinks::ClearLinkCache()
+{
+    GetValidLinkCache().Clear();
+}
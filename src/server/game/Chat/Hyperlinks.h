@@ -84,7 +84,7 @@ namespace Acore::Hyperlinks
         uint16 CurValue;
         uint16 MaxValue;
         ObjectGuid Owner;
-        std::string KnownRecipes;
+        std::string_view KnownRecipes;
     };
 
     namespace LinkTags
@@ -248,6 +248,9 @@ namespace Acore::Hyperlinks
 
     HyperlinkInfo AC_GAME_API ParseSingleHyperlink(std::string_view str);
     bool AC_GAME_API CheckAllLinks(std::string_view str);
+
+    // Drops the remembered valid links, their items, quests or locales may have changed
+    void AC_GAME_API ClearLinkCache();
 }
 
 #endif
@@ -306,7 +306,21 @@ void ThreatContainer::ModifyThreatByPercent(Unit* victim, int32 percent)
 void ThreatContainer::update()
 {
     if (iDirty && iThreatList.size() > 1)
-        iThreatList.sort(Acore::ThreatOrderPred());
+    {
+        // Threat changes between updates rarely move more than a few references, so insert each one
+        // into the sorted prefix: stable like the former list sort, with no allocation and few moves
+        Acore::ThreatOrderPred pred;
+        for (StorageType::iterator itr = std::next(iThreatList.begin()); itr != iThreatList.end(); ++itr)
+        {
+            if (!pred(*itr, *std::prev(itr)))
+                continue;
+
+            HostileReference* ref = *itr;
+            StorageType::iterator pos = std::upper_bound(iThreatList.begin(), itr, ref, pred);
+            std::move_backward(pos, itr, std::next(itr));
+            *pos = ref;
+        }
+    }
 
     iDirty = false;
 }
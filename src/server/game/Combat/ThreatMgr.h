@@ -23,7 +23,9 @@
 #include "Reference.h"
 #include "SharedDefines.h"
 #include "UnitEvents.h"
+#include <algorithm>
 #include <list>
+#include <vector>
 
 //==============================================================
 
@@ -139,12 +141,15 @@ private:
 //==============================================================
 class ThreatMgr;
 
+// References are kept in one contiguous array, sorted by descending threat after update().
+// Removing a reference shifts the ones after it: code that may remove references
+// while walking the list (killing targets, clearing threat) must walk a copy.
 class ThreatContainer
 {
     friend class ThreatMgr;
 
 public:
-    typedef std::list<HostileReference*> StorageType;
+    typedef std::vector<HostileReference*> StorageType;
 
     ThreatContainer() = default;
 
@@ -182,7 +187,7 @@ public:
 private:
     void remove(HostileReference* hostileRef)
     {
-        iThreatList.remove(hostileRef);
+        iThreatList.erase(std::remove(iThreatList.begin(), iThreatList.end(), hostileRef), iThreatList.end());
     }
 
     void addReference(HostileReference* hostileRef)
@@ -227,9 +232,13 @@ public:
 
     [[nodiscard]] bool isThreatListEmpty() const { return iThreatContainer.empty(); }
     [[nodiscard]] bool areThreatListsEmpty() const { return iThreatContainer.empty() && iThreatOfflineContainer.empty(); }
+    [[nodiscard]] bool isThreatListDirty() const { return iThreatContainer.isDirty(); }
 
-    Acore::IteratorPair<std::list<ThreatReference*>::const_iterator> GetSortedThreatList() const { auto& list = iThreatContainer.GetThreatList(); return { list.cbegin(), list.cend() }; }
-    Acore::IteratorPair<std::list<ThreatReference*>::const_iterator> GetUnsortedThreatList() const { return GetSortedThreatList(); }
+    // Sorts the threat list by descending threat, done by getHostileTarget as well
+    void UpdateThreatList() { iThreatContainer.update(); }
+
+    Acore::IteratorPair<ThreatContainer::StorageType::const_iterator> GetSortedThreatList() const { auto& list = iThreatContainer.GetThreatList(); return { list.cbegin(), list.cend() }; }
+    Acore::IteratorPair<ThreatContainer::StorageType::const_iterator> GetUnsortedThreatList() const { return GetSortedThreatList(); }
 
     void processThreatEvent(ThreatRefStatusChangeEvent* threatRefStatusChangeEvent);
 
@@ -21,6 +21,7 @@
 #include "GameObject.h"
 #include "GameObjectAI.h"
 #include "InstanceScript.h"
+#include "Metric.h"
 #include "ObjectMgr.h"
 #include "Pet.h"
 #include "Player.h"
@@ -844,6 +845,59 @@ uint32 Condition::GetMaxAvailableConditionTargets()
     return 1;
 }
 
+uint8 Condition::GetEvaluationCost() const
+{
+    // references evaluate a whole other list
+    if (ReferenceId)
+        return 3;
+
+    // keep conditions with a cast error in front, so the spell still reports their error when they fail
+    if (ErrorType)
+        return 0;
+
+    switch (ConditionType)
+    {
+        // inventory walks and grid searches
+        case CONDITION_ITEM:
+        case CONDITION_NEAR_CREATURE:
+        case CONDITION_NEAR_GAMEOBJECT:
+            return 2;
+        // lookups in player, aura, quest or world containers
+        case CONDITION_AURA:
+        case CONDITION_ITEM_EQUIPPED:
+        case CONDITION_REPUTATION_RANK:
+        case CONDITION_SKILL:
+        case CONDITION_QUESTREWARDED:
+        case CONDITION_QUESTTAKEN:
+        case CONDITION_WORLD_STATE:
+        case CONDITION_ACTIVE_EVENT:
+        case CONDITION_INSTANCE_INFO:
+        case CONDITION_QUEST_NONE:
+        case CONDITION_ACHIEVEMENT:
+        case CONDITION_SPELL:
+        case CONDITION_QUEST_COMPLETE:
+        case CONDITION_RELATION_TO:
+        case CONDITION_REACTION_TO:
+        case CONDITION_DISTANCE_TO:
+        case CONDITION_REALM_ACHIEVEMENT:
+        case CONDITION_IN_WATER:
+        case CONDITION_DAILY_QUEST_DONE:
+        case CONDITION_QUESTSTATE:
+        case CONDITION_QUEST_OBJECTIVE_PROGRESS:
+        case CONDITION_QUEST_SATISFY_EXCLUSIVE:
+        case CONDITION_HAS_AURA_TYPE:
+        case CONDITION_WORLD_SCRIPT:
+        case CONDITION_AI_DATA:
+        case CONDITION_PLAYER_QUEUED_RANDOM_DUNGEON:
+            return 1;
+        // plain field reads
+        default:
+            break;
+    }
+
+    return 0;
+}
+
 ConditionMgr::ConditionMgr() {}
 
 ConditionMgr::~ConditionMgr()
@@ -905,13 +959,58 @@ uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(ConditionList const& co
     return mask;
 }
 
+bool ConditionMgr::IsObjectMeetToCondition(ConditionSourceInfo& sourceInfo, Condition* cond)
+{
+    LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList condType: {} val1: {}", cond->ConditionType, cond->ConditionValue1);
+    if (!cond->ReferenceId) // handle normal condition
+        return cond->Meets(sourceInfo);
+
+    // handle reference
+    ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find(cond->ReferenceId);
+    if (ref == ConditionReferenceStore.end())
+    {
+        LOG_DEBUG("condition", "IsPlayerMeetToConditionList: Reference template -{} not found", cond->ReferenceId);
+        return true;
+    }
+
+    return IsObjectMeetToConditionList(sourceInfo, ref->second);
+}
+
 bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionList const& conditions)
+{
+    // lists filled through AddToConditionList hold each ElseGroup in one run, cheapest conditions first
+    if (!std::is_sorted(conditions.begin(), conditions.end(), [](Condition const* left, Condition const* right) { return left->ElseGroup < right->ElseGroup; }))
+        return IsObjectMeetToUnorderedConditionList(sourceInfo, conditions);
+
+    ConditionList::const_iterator i = conditions.begin();
+    while (i != conditions.end())
+    {
+        uint32 const elseGroup = (*i)->ElseGroup;
+        bool groupChecked = false;
+        bool groupPassed = true;
+        for (; i != conditions.end() && (*i)->ElseGroup == elseGroup; ++i)
+        {
+            if (!groupPassed || !(*i)->isLoaded())
+                continue;
+
+            groupChecked = true;
+            groupPassed = IsObjectMeetToCondition(sourceInfo, *i);
+        }
+
+        // object meets the list as soon as all conditions of one group are met
+        if (groupChecked && groupPassed)
+            return true;
+    }
+
+    return false;
+}
+
+bool ConditionMgr::IsObjectMeetToUnorderedConditionList(ConditionSourceInfo& sourceInfo, ConditionList const& conditions)
 {
     //     groupId, groupCheckPassed
     std::map<uint32, bool> ElseGroupStore;
     for (ConditionList::const_iterator i = conditions.begin(); i != conditions.end(); ++i)
     {
-        LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList condType: {} val1: {}", (*i)->ConditionType, (*i)->ConditionValue1);
         if ((*i)->isLoaded())
         {
             //! Find ElseGroup in ElseGroupStore
@@ -922,24 +1021,8 @@ bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo,
             else if (!(*itr).second)
                 continue;
 
-            if ((*i)->ReferenceId) // handle reference
-            {
-                ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find((*i)->ReferenceId);
-                if (ref != ConditionReferenceStore.end())
-                {
-                    if (!IsObjectMeetToConditionList(sourceInfo, (*ref).second))
-                        ElseGroupStore[(*i)->ElseGroup] = false;
-                }
-                else
-                {
-                    LOG_DEBUG("condition", "IsPlayerMeetToConditionList: Reference template -{} not found", (*i)->ReferenceId);
-                }
-            }
-            else // handle normal condition
-            {
-                if (!(*i)->Meets(sourceInfo))
-                    ElseGroupStore[(*i)->ElseGroup] = false;
-            }
+            if (!IsObjectMeetToCondition(sourceInfo, *i))
+                ElseGroupStore[(*i)->ElseGroup] = false;
         }
     }
     for (std::map<uint32, bool>::const_iterator i = ElseGroupStore.begin(); i != ElseGroupStore.end(); ++i)
@@ -967,7 +1050,63 @@ bool ConditionMgr::IsObjectMeetToConditions(ConditionSourceInfo& sourceInfo, Con
         return true;
 
     LOG_DEBUG("condition", "ConditionMgr::IsObjectMeetToConditions");
-    return IsObjectMeetToConditionList(sourceInfo, conditions);
+    if (!_evaluationMetrics.load(std::memory_order_relaxed))
+        return IsObjectMeetToConditionList(sourceInfo, conditions);
+
+    auto const startTime = std::chrono::steady_clock::now();
+    bool const meets = IsObjectMeetToConditionList(sourceInfo, conditions);
+    uint64 const time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+
+    ConditionSourceType const sourceType = conditions.front()->SourceType;
+    if (sourceType < CONDITION_SOURCE_TYPE_MAX)
+    {
+        EvaluationStats& stats = _evaluationStats[sourceType];
+        stats.Calls.fetch_add(1, std::memory_order_relaxed);
+        stats.Time.fetch_add(time, std::memory_order_relaxed);
+        if (!meets)
+            stats.Failures.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return meets;
+}
+
+void ConditionMgr::AddToConditionList(ConditionList& conditions, Condition* cond)
+{
+    auto const pos = std::upper_bound(conditions.begin(), conditions.end(), cond, [](Condition const* left, Condition const* right)
+    {
+        if (left->ElseGroup != right->ElseGroup)
+            return left->ElseGroup < right->ElseGroup;
+
+        return left->GetEvaluationCost() < right->GetEvaluationCost();
+    });
+
+    conditions.insert(pos, cond);
+}
+
+void ConditionMgr::LogEvaluationMetrics()
+{
+#if defined PERFORMANCE_PROFILING || defined WITHOUT_METRICS
+    _evaluationMetrics.store(false, std::memory_order_relaxed);
+#else
+    _evaluationMetrics.store(sMetric->IsEnabled(), std::memory_order_relaxed);
+    if (!sMetric->IsEnabled())
+        return;
+
+    for (std::size_t sourceType = 0; sourceType < _evaluationStats.size(); ++sourceType)
+    {
+        EvaluationStats& stats = _evaluationStats[sourceType];
+        uint64 const calls = stats.Calls.exchange(0, std::memory_order_relaxed);
+        uint64 const failures = stats.Failures.exchange(0, std::memory_order_relaxed);
+        uint64 const time = stats.Time.exchange(0, std::memory_order_relaxed);
+        if (!calls)
+            continue;
+
+        std::string const tag = std::to_string(sourceType);
+        METRIC_VALUE("condition_evaluations", calls, METRIC_TAG("source_type", tag));
+        METRIC_VALUE("condition_evaluation_failures", failures, METRIC_TAG("source_type", tag));
+        METRIC_VALUE("condition_evaluation_time", std::chrono::nanoseconds(time), METRIC_TAG("source_type", tag));
+    }
+#endif
 }
 
 bool ConditionMgr::CanHaveSourceGroupSet(ConditionSourceType sourceType) const
@@ -1184,7 +1323,7 @@ void ConditionMgr::LoadConditions(bool isReload)
                 ConditionList mCondList;
                 ConditionReferenceStore[uRefId] = mCondList;
             }
-            ConditionReferenceStore[uRefId].push_back(cond); // add to reference storage
+            AddToConditionList(ConditionReferenceStore[uRefId], cond); // add to reference storage
             count++;
             continue;
         } // end of reference templates
@@ -1272,7 +1411,7 @@ void ConditionMgr::LoadConditions(bool isReload)
                 break;
             case CONDITION_SOURCE_TYPE_SPELL_CLICK_EVENT:
             {
-                SpellClickEventConditionStore[cond->SourceGroup][cond->SourceEntry].push_back(cond);
+                AddToConditionList(SpellClickEventConditionStore[cond->SourceGroup][cond->SourceEntry], cond);
                 valid = true;
                 ++count;
                 continue; // do not add to m_AllocatedMemory to avoid double deleting
@@ -1282,7 +1421,7 @@ void ConditionMgr::LoadConditions(bool isReload)
                 break;
             case CONDITION_SOURCE_TYPE_VEHICLE_SPELL:
             {
-                VehicleSpellConditionStore[cond->SourceGroup][cond->SourceEntry].push_back(cond);
+                AddToConditionList(VehicleSpellConditionStore[cond->SourceGroup][cond->SourceEntry], cond);
                 valid = true;
                 ++count;
                 continue; // do not add to m_AllocatedMemory to avoid double deleting
@@ -1291,14 +1430,14 @@ void ConditionMgr::LoadConditions(bool isReload)
             {
                 //! TODO: PAIR_32 ?
                 std::pair<int32, uint32> key = std::make_pair(cond->SourceEntry, cond->SourceId);
-                SmartEventConditionStore[key][cond->SourceGroup].push_back(cond);
+                AddToConditionList(SmartEventConditionStore[key][cond->SourceGroup], cond);
                 valid = true;
                 ++count;
                 continue;
             }
             case CONDITION_SOURCE_TYPE_NPC_VENDOR:
             {
-                NpcVendorConditionContainerStore[cond->SourceGroup][cond->SourceEntry].push_back(cond);
+                AddToConditionList(NpcVendorConditionContainerStore[cond->SourceGroup][cond->SourceEntry], cond);
                 valid = true;
                 ++count;
                 continue;
@@ -1341,7 +1480,7 @@ void ConditionMgr::LoadConditions(bool isReload)
         }
 
         // add new Condition to storage based on Type/Entry
-        ConditionStore[cond->SourceType][cond->SourceEntry].push_back(cond);
+        AddToConditionList(ConditionStore[cond->SourceType][cond->SourceEntry], cond);
         ++count;
     } while (result->NextRow());
 
@@ -1374,7 +1513,7 @@ bool ConditionMgr::addToGossipMenus(Condition* cond)
         {
             if ((*itr).second.MenuID == cond->SourceGroup && (*itr).second.TextID == uint32(cond->SourceEntry))
             {
-                (*itr).second.Conditions.push_back(cond);
+                AddToConditionList((*itr).second.Conditions, cond);
                 return true;
             }
         }
@@ -1393,7 +1532,7 @@ bool ConditionMgr::addToGossipMenuItems(Condition* cond)
         {
             if ((*itr).second.MenuID == cond->SourceGroup && (*itr).second.OptionID == uint32(cond->SourceEntry))
             {
-                (*itr).second.Conditions.push_back(cond);
+                AddToConditionList((*itr).second.Conditions, cond);
                 return true;
             }
         }
@@ -1482,7 +1621,7 @@ bool ConditionMgr::addToSpellImplicitTargetConditions(Condition* cond)
                     delete sharedList;
             }
             if (sharedList)
-                sharedList->push_back(cond);
+                AddToConditionList(*sharedList, cond);
             break;
         }
     }
@@ -19,6 +19,8 @@
 #define ACORE_CONDITIONMGR_H
 
 #include "Define.h"
+#include <array>
+#include <atomic>
 #include <list>
 #include <map>
 
@@ -234,6 +236,8 @@ struct Condition
     uint32 GetSearcherTypeMaskForCondition();
     [[nodiscard]] bool isLoaded() const { return ConditionType > CONDITION_NONE || ReferenceId; }
     uint32 GetMaxAvailableConditionTargets();
+    // rough cost rank of Meets, conditions of a group are evaluated cheapest first
+    [[nodiscard]] uint8 GetEvaluationCost() const;
 };
 
 typedef std::list<Condition*> ConditionList;
@@ -270,6 +274,11 @@ public:
     ConditionList GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId);
     ConditionList GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId);
 
+    // Adds a condition to a list, keeping the list ordered by ElseGroup and then by evaluation cost
+    static void AddToConditionList(ConditionList& conditions, Condition* cond);
+
+    void LogEvaluationMetrics();
+
 private:
     bool isSourceTypeValid(Condition* cond);
     bool addToLootTemplate(Condition* cond, LootTemplate* loot);
@@ -277,6 +286,8 @@ private:
     bool addToGossipMenuItems(Condition* cond);
     bool addToSpellImplicitTargetConditions(Condition* cond);
     bool IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionList const& conditions);
+    bool IsObjectMeetToUnorderedConditionList(ConditionSourceInfo& sourceInfo, ConditionList const& conditions);
+    bool IsObjectMeetToCondition(ConditionSourceInfo& sourceInfo, Condition* cond);
 
     void Clean(); // free up resources
     std::list<Condition*> AllocatedMemoryStore; // some garbage collection :)
@@ -287,6 +298,16 @@ private:
     CreatureSpellConditionContainer   SpellClickEventConditionStore;
     NpcVendorConditionContainer       NpcVendorConditionContainerStore;
     SmartEventConditionContainer      SmartEventConditionStore;
+
+    struct EvaluationStats
+    {
+        std::atomic<uint64> Calls{ 0 };
+        std::atomic<uint64> Failures{ 0 };
+        std::atomic<uint64> Time{ 0 };
+    };
+
+    std::atomic<bool> _evaluationMetrics{ false };
+    std::array<EvaluationStats, CONDITION_SOURCE_TYPE_MAX> _evaluationStats;
 };
 
 #define sConditionMgr ConditionMgr::instance()
@@ -332,29 +332,22 @@ namespace lfg
         }
         else if (task == 1)
         {
-            this->lastProposalId = m_lfgProposalId; // pussywizard: task 2 is done independantly, store previous value in LFGMgr for future use
-            uint8 newGroupsProcessed = 0;
-            // Check if a proposal can be formed with the new groups being added
-            for (LfgQueueContainer::iterator it = QueuesStore.begin(); it != QueuesStore.end(); ++it)
-            {
-                newGroupsProcessed += it->second.FindGroups();
-                if (newGroupsProcessed)
-                    break;
-            }
-
-            // Update all players status queue info
-            if (!newGroupsProcessed) // don't do this on updates that precessed groups (performance)
-                for (LfgQueueContainer::iterator it = QueuesStore.begin(); it != QueuesStore.end(); ++it)
-                    it->second.UpdateQueueTimers(tdiff);
+            // MapUpdater updates each queue in its own task
+            for (LfgQueueContainer::value_type const& queue : QueuesStore)
+                UpdateQueue(queue.first, tdiff);
         }
         else if (task == 2)
         {
+            uint32 const lastProposalId = m_lfgProposalId;
+            for (LfgQueueContainer::value_type& queue : QueuesStore)
+                ProcessQueueResults(queue.second);
+
             if (lastProposalId != m_lfgProposalId)
             {
-                // pussywizard: only one proposal can be created in World::Update (during maps update), and it has id == m_lfgProposalId, so try to find only that one, dunno why for loop here xD
-                for (LfgProposalContainer::const_iterator itProposal = ProposalsStore.find(m_lfgProposalId); itProposal != ProposalsStore.end(); ++itProposal)
+                // one proposal can be created by every queue in World::Update (during maps update)
+                for (LfgProposalContainer::const_iterator itr = ProposalsStore.upper_bound(lastProposalId); itr != ProposalsStore.end();)
                 {
-                    uint32 proposalId = itProposal->first;
+                    uint32 proposalId = (itr++)->first;
                     LfgProposal& proposal = ProposalsStore[proposalId];
 
                     ObjectGuid guid;
@@ -381,6 +374,54 @@ namespace lfg
         }
     }
 
+    void LFGMgr::UpdateQueue(uint8 queueId, uint32 diff)
+    {
+        if (!isOptionEnabled(LFG_OPTION_ENABLE_DUNGEON_FINDER | LFG_OPTION_ENABLE_RAID_BROWSER | LFG_OPTION_ENABLE_SEASONAL_BOSSES))
+            return;
+
+        LfgQueueContainer::iterator itr = QueuesStore.find(queueId);
+        if (itr == QueuesStore.end())
+            return;
+
+        // Check if a proposal can be formed with the new groups being added
+        // Update all players status queue info otherwise (performance)
+        if (!itr->second.FindGroups())
+            itr->second.UpdateQueueTimers(diff);
+    }
+
+    std::vector<uint8> LFGMgr::GetQueueIds() const
+    {
+        std::vector<uint8> queueIds;
+        queueIds.reserve(QueuesStore.size());
+        for (LfgQueueContainer::value_type const& queue : QueuesStore)
+            queueIds.push_back(queue.first);
+
+        return queueIds;
+    }
+
+    void LFGMgr::ProcessQueueResults(LFGQueue& queue)
+    {
+        std::vector<LfgProposal> proposals;
+        proposals.swap(queue.GetPendingProposals());
+        for (LfgProposal& proposal : proposals)
+        {
+            // a player may have left while the queues were updated, the others wait for another group
+            if (AllQueued(proposal.queues))
+                AddProposal(proposal);
+            else
+            {
+                for (uint8 i = 0; i < 5 && proposal.queues.guids[i]; ++i)
+                    if (GetState(proposal.queues.guids[i]) == LFG_STATE_QUEUED)
+                        queue.AddToQueue(proposal.queues.guids[i], true);
+            }
+        }
+
+        LfgGuidList expired;
+        expired.swap(queue.GetExpiredGuids());
+        for (ObjectGuid const& guid : expired)
+            LeaveAllLfgQueues(guid, true);
+    }
+
     /**
         Generate the dungeon lock map for a given player
 
@@ -442,6 +442,9 @@ namespace lfg
 
         // Functions used outside lfg namespace
         void Update(uint32 diff, uint8 task);
+        /// Finds groups in one queue, the queues are independent and updated in parallel by MapUpdater
+        void UpdateQueue(uint8 queueId, uint32 diff);
+        std::vector<uint8> GetQueueIds() const;
 
         // World.cpp
         /// Finish the dungeon for the given group. All check are performed using internal lfg data
@@ -604,6 +607,7 @@ namespace lfg
 
         // Generic
         LFGQueue& GetQueue(ObjectGuid guid);
+        void ProcessQueueResults(LFGQueue& queue);
         LfgDungeonSet const& GetDungeonsByRandom(uint32 randomdungeon);
         LfgType GetDungeonType(uint32 dungeon);
 
@@ -620,7 +624,6 @@ namespace lfg
         // General variables
         uint32 m_lfgProposalId;                            ///< used as internal counter for proposals
         uint32 m_options;                                  ///< Stores config options
-        uint32 lastProposalId;                             ///< pussywizard, store it here because of splitting LFGMgr update into tasks
         uint32 m_raidBrowserUpdateTimer[2];                ///< pussywizard
         uint32 m_raidBrowserLastUpdatedDungeonId[2];       ///< pussywizard: for 2 factions
 
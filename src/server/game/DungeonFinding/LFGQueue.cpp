@@ -33,6 +33,35 @@ namespace lfg
         joinTime(time_t(GameTime::GetGameTime().count())), lastRefreshTime(joinTime), tanks(LFG_TANKS_NEEDED),
         healers(LFG_HEALERS_NEEDED), dps(LFG_DPS_NEEDED) { }
 
+    bool LfgDungeonIndex::BuildMask(LfgDungeonSet const& dungeons, Mask& mask)
+    {
+        mask.reset();
+        for (uint32 dungeon : dungeons)
+        {
+            auto itr = _indexes.find(dungeon);
+            if (itr == _indexes.end())
+            {
+                if (_dungeons.size() >= MaxDungeons)
+                    return false;
+
+                itr = _indexes.emplace(dungeon, uint16(_dungeons.size())).first;
+                _dungeons.push_back(dungeon);
+            }
+
+            mask.set(itr->second);
+        }
+
+        return true;
+    }
+
+    void LfgDungeonIndex::GetDungeons(Mask const& mask, LfgDungeonSet& dungeons) const
+    {
+        dungeons.clear();
+        for (std::size_t i = 0; i < _dungeons.size(); ++i)
+            if (mask.test(i))
+                dungeons.insert(_dungeons[i]);
+    }
+
     void LFGQueue::AddToQueue(ObjectGuid guid, bool failedProposal)
     {
         LOG_DEBUG("lfg", "ADD AddToQueue: {}, failed proposal: {}", guid.ToString(), failedProposal ? 1 : 0);
@@ -106,7 +135,27 @@ namespace lfg
     void LFGQueue::AddQueueData(ObjectGuid guid, time_t joinTime, LfgDungeonSet const& dungeons, LfgRolesMap const& rolesMap)
     {
         LOG_DEBUG("lfg", "JOINED AddQueueData: {}", guid.ToString());
-        QueueDataStore[guid] = LfgQueueData(joinTime, dungeons, rolesMap);
+        LfgQueueData& queueData = QueueDataStore[guid] = LfgQueueData(joinTime, dungeons, rolesMap);
+        queueData.hasDungeonMask = DungeonIndex.BuildMask(dungeons, queueData.dungeonMask);
+
+        for (LfgRolesMap::value_type const& member : rolesMap)
+        {
+            switch (member.second & ~PLAYER_ROLE_LEADER)
+            {
+                case PLAYER_ROLE_TANK:
+                    ++queueData.fixedTanks;
+                    break;
+                case PLAYER_ROLE_HEALER:
+                    ++queueData.fixedHealers;
+                    break;
+                case PLAYER_ROLE_DAMAGE:
+                    ++queueData.fixedDamage;
+                    break;
+                default:
+                    break;
+            }
+        }
+
         AddToQueue(guid);
     }
 
@@ -205,16 +254,10 @@ namespace lfg
 
         // we have to take into account that FindNewGroups is called every X minutes if number of compatibles is low!
         // build set of already present compatibles for this guid
-        std::set<Lfg5Guids> currentCompatibles;
-        for (Lfg5GuidsList::iterator it = CompatibleList.begin(); it != CompatibleList.end(); ++it)
+        LfgCompatibleGuidsSet currentCompatibles;
+        for (Lfg5GuidsList::const_iterator it = CompatibleList.begin(); it != CompatibleList.end(); ++it)
             if (it->hasGuid(newGuid))
-            {
-                // unset roles here so they are not copied, restore after insertion
-                LfgRolesMap* r = it->roles;
-                it->roles = nullptr;
-                currentCompatibles.insert(*it);
-                it->roles = r;
-            }
+                currentCompatibles.insert(it->guids);
 
         LfgCompatibility selfCompatibility = LFG_COMPATIBILITY_PENDING;
         if (currentCompatibles.empty())
@@ -243,7 +286,7 @@ namespace lfg
         return selfCompatibility;
     }
 
-    LfgCompatibility LFGQueue::CheckCompatibility(Lfg5Guids const& checkWith, const ObjectGuid& newGuid, uint64& foundMask, uint32& foundCount, const std::set<Lfg5Guids>& currentCompatibles)
+    LfgCompatibility LFGQueue::CheckCompatibility(Lfg5Guids const& checkWith, const ObjectGuid& newGuid, uint64& foundMask, uint32& foundCount, LfgCompatibleGuidsSet const& currentCompatibles)
     {
         LOG_DEBUG("lfg", "CHECK CheckCompatibility: {}, new guid: {}", checkWith.toString(), newGuid.ToString());
         Lfg5Guids check(checkWith, false); // here newGuid is at front
@@ -251,7 +294,7 @@ namespace lfg
         check.force_insert_front(newGuid);
         strGuids.insert(newGuid);
 
-        if (!currentCompatibles.empty() && currentCompatibles.find(strGuids) != currentCompatibles.end())
+        if (!currentCompatibles.empty() && currentCompatibles.find(strGuids.guids) != currentCompatibles.end())
             return LFG_INCOMPATIBLES_TOO_MUCH_PLAYERS;
 
         LfgProposal proposal;
@@ -313,6 +356,29 @@ namespace lfg
         // If it's single group no need to check for duplicate players, ignores, bad roles or bad dungeons as it's been checked before joining
         if (check.size() > 1)
         {
+            // reject on the members queued for a single role and on the dungeon masks before building the roles of the proposal
+            uint8 fixedTanks = 0;
+            uint8 fixedHealers = 0;
+            uint8 fixedDamage = 0;
+            bool hasDungeonMask = true;
+            LfgDungeonIndex::Mask dungeonMask;
+            dungeonMask.set();
+            for (uint8 i = 0; i < 5 && check.guids[i]; ++i)
+            {
+                LfgQueueData const& queueData = QueueDataStore[check.guids[i]];
+                fixedTanks += queueData.fixedTanks;
+                fixedHealers += queueData.fixedHealers;
+                fixedDamage += queueData.fixedDamage;
+                hasDungeonMask = hasDungeonMask && queueData.hasDungeonMask;
+                dungeonMask &= queueData.dungeonMask;
+            }
+
+            if (fixedTanks > LFG_TANKS_NEEDED || fixedHealers > LFG_HEALERS_NEEDED || fixedDamage > LFG_DPS_NEEDED)
+                return LFG_INCOMPATIBLES_NO_ROLES;
+
+            if (hasDungeonMask && dungeonMask.none())
+                return LFG_INCOMPATIBLES_NO_DUNGEONS;
+
             for (uint8 i = 0; i < 5 && check.guids[i]; ++i)
             {
                 const LfgRolesMap& roles = QueueDataStore[check.guids[i]].roles;
@@ -368,13 +434,18 @@ namespace lfg
             else
                 addToFoundMask |= (((uint64)1) << (roleCheckResult - 1));
 
-            proposalDungeons = QueueDataStore[check.front()].dungeons;
-            for (uint8 i = 1; i < 5 && check.guids[i]; ++i)
+            if (hasDungeonMask)
+                DungeonIndex.GetDungeons(dungeonMask, proposalDungeons);
+            else
             {
-                LfgDungeonSet temporal;
-                LfgDungeonSet& dungeons = QueueDataStore[check.guids[i]].dungeons;
-                std::set_intersection(proposalDungeons.begin(), proposalDungeons.end(), dungeons.begin(), dungeons.end(), std::inserter(temporal, temporal.begin()));
-                proposalDungeons = temporal;
+                proposalDungeons = QueueDataStore[check.front()].dungeons;
+                for (uint8 i = 1; i < 5 && check.guids[i]; ++i)
+                {
+                    LfgDungeonSet temporal;
+                    LfgDungeonSet& dungeons = QueueDataStore[check.guids[i]].dungeons;
+                    std::set_intersection(proposalDungeons.begin(), proposalDungeons.end(), dungeons.begin(), dungeons.end(), std::inserter(temporal, temporal.begin()));
+                    proposalDungeons = temporal;
+                }
             }
 
             if (proposalDungeons.empty())
@@ -408,7 +479,7 @@ namespace lfg
         proposal.queues = strGuids;
         proposal.isNew = numLfgGroups != 1;
 
-        if (!sLFGMgr->AllQueued(check)) // can't create proposal
+        if (!AllQueued(check)) // can't create proposal
             return LFG_COMPATIBILITY_PENDING;
 
         // Create a new proposal
@@ -461,11 +532,29 @@ namespace lfg
         for (uint8 i = 0; i < 5 && proposal.queues.guids[i]; ++i)
             RemoveFromQueue(proposal.queues.guids[i], true);
 
-        sLFGMgr->AddProposal(proposal);
+        // the queues are updated in parallel, LFGMgr adds the proposal afterwards
+        PendingProposals.push_back(proposal);
 
         return LFG_COMPATIBLES_MATCH;
     }
 
+    bool LFGQueue::AllQueued(Lfg5Guids const& check)
+    {
+        bool ok = true;
+
+        for (uint8 i = 0; i < 5 && check.guids[i]; ++i)
+        {
+            ObjectGuid guid = check.guids[i];
+            if (sLFGMgr->GetState(guid) != LFG_STATE_QUEUED)
+            {
+                RemoveFromQueue(guid);
+                ok = false;
+            }
+        }
+
+        return ok;
+    }
+
     void LFGQueue::UpdateQueueTimers(uint32 diff)
     {
         time_t currTime = GameTime::GetGameTime().count();
@@ -498,7 +587,7 @@ namespace lfg
                 {
                     ObjectGuid guid = itQueue->first;
                     QueueDataStore.erase(itQueue++);
-                    sLFGMgr->LeaveAllLfgQueues(guid, true);
+                    ExpiredGuids.push_back(guid);
                     continue;
                 }
                 if (itQueue->second.bestCompatible.empty())
@@ -19,9 +19,14 @@
 #define _LFGQUEUE_H
 
 #include "LFG.h"
+#include <bitset>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace lfg
 {
+    struct LfgProposal;
+
     enum LfgCompatibility
     {
         LFG_COMPATIBILITY_PENDING,
@@ -35,6 +40,25 @@ namespace lfg
         LFG_COMPATIBLES_MATCH                                  // Must be the last one
     };
 
+    /**
+        Dense indexes of the dungeons selected in a queue, so the selections of
+        the queued groups are intersected as bitsets
+    */
+    class LfgDungeonIndex
+    {
+    public:
+        static constexpr std::size_t MaxDungeons = 512;
+        typedef std::bitset<MaxDungeons> Mask;
+
+        // Returns false if the queue already indexed MaxDungeons other dungeons
+        bool BuildMask(LfgDungeonSet const& dungeons, Mask& mask);
+        void GetDungeons(Mask const& mask, LfgDungeonSet& dungeons) const;
+
+    private:
+        std::unordered_map<uint32, uint16> _indexes;
+        std::vector<uint32> _dungeons;
+    };
+
     // Stores player or group queue info
     struct LfgQueueData
     {
@@ -53,6 +77,22 @@ namespace lfg
         LfgDungeonSet dungeons;                                // Selected Player/Group Dungeon/s
         LfgRolesMap roles;                                     // Selected Player Role/s
         Lfg5Guids bestCompatible;                              // Best compatible combination of people queued
+        LfgDungeonIndex::Mask dungeonMask;                     // dungeons, indexed by LFGQueue::DungeonIndex
+        bool hasDungeonMask{false};
+        uint8 fixedTanks{0};                                   // Members queued only as tank
+        uint8 fixedHealers{0};                                 // Members queued only as healer
+        uint8 fixedDamage{0};                                  // Members queued only as dps
+    };
+
+    struct Lfg5GuidsHash
+    {
+        std::size_t operator()(std::array<ObjectGuid, 5> const& guids) const
+        {
+            std::size_t hash = 0;
+            for (ObjectGuid const& guid : guids)
+                hash = hash * 31 + std::hash<ObjectGuid>()(guid);
+            return hash;
+        }
     };
 
     struct LfgWaitTime
@@ -65,6 +105,7 @@ namespace lfg
     typedef std::map<uint32, LfgWaitTime> LfgWaitTimesContainer;
     typedef std::map<ObjectGuid, LfgQueueData> LfgQueueDataContainer;
     typedef std::list<Lfg5Guids> LfgCompatibleContainer;
+    typedef std::unordered_set<std::array<ObjectGuid, 5>, Lfg5GuidsHash> LfgCompatibleGuidsSet;
 
     /**
         Stores all data related to queue
@@ -91,6 +132,10 @@ namespace lfg
         // Find new group
         uint8 FindGroups();
 
+        // Results of the queue update, handled by LFGMgr once the queues updated in parallel are done
+        std::vector<LfgProposal>& GetPendingProposals() { return PendingProposals; }
+        LfgGuidList& GetExpiredGuids() { return ExpiredGuids; }
+
     private:
         void SetQueueUpdateData(std::string const& strGuids, LfgRolesMap const& proposalRoles);
 
@@ -104,11 +149,13 @@ namespace lfg
         void UpdateBestCompatibleInQueue(LfgQueueDataContainer::iterator itrQueue, Lfg5Guids const& key);
 
         LfgCompatibility FindNewGroups(const ObjectGuid& newGuid);
-        LfgCompatibility CheckCompatibility(Lfg5Guids const& checkWith, const ObjectGuid& newGuid, uint64& foundMask, uint32& foundCount, const std::set<Lfg5Guids>& currentCompatibles);
+        bool AllQueued(Lfg5Guids const& check);
+        LfgCompatibility CheckCompatibility(Lfg5Guids const& checkWith, const ObjectGuid& newGuid, uint64& foundMask, uint32& foundCount, LfgCompatibleGuidsSet const& currentCompatibles);
 
         // Queue
         uint32 m_QueueStatusTimer;                         // used to check interval of sending queue status
         LfgQueueDataContainer QueueDataStore;              // Queued groups
+        LfgDungeonIndex DungeonIndex;                      // Dense indexes of the dungeons of QueueDataStore
         LfgCompatibleContainer CompatibleList;             // Compatible dungeons
         LfgCompatibleContainer CompatibleTempList;         // new compatibles are added to this container while main one is being iterated
 
@@ -118,6 +165,8 @@ namespace lfg
         LfgWaitTimesContainer waitTimesDpsStore;           // Average wait time to find a group queuing as dps
         LfgGuidList newToQueueStore;                       // New groups to add to queue
         LfgGuidList restoredAfterProposal;
+        std::vector<LfgProposal> PendingProposals;         // Proposals created by the last update
+        LfgGuidList ExpiredGuids;                          // Queued for too long by the last update, must leave all queues
     };
 }
 
@@ -171,43 +171,6 @@ CreatureModel const* CreatureTemplate::GetFirstVisibleModel() const
     return &CreatureModel::DefaultVisibleModel;
 }
 
-void CreatureTemplate::InitializeQueryData()
-{
-    queryData.Initialize(SMSG_CREATURE_QUERY_RESPONSE, 1);
-
-    queryData << uint32(Entry);                                   // creature entry
-    queryData << Name;
-    queryData << uint8(0) << uint8(0) << uint8(0);                // name2, name3, name4, always empty
-    queryData << SubName;
-    queryData << IconName;                                        // "Directions" for guard, string for Icons 2.3.0
-    queryData << uint32(type_flags);                              // flags
-    queryData << uint32(type);                                    // CreatureType.dbc
-    queryData << uint32(family);                                  // CreatureFamily.dbc
-    queryData << uint32(rank);                                    // Creature Rank (elite, boss, etc)
-    queryData << uint32(KillCredit[0]);                           // new in 3.1, kill credit
-    queryData << uint32(KillCredit[1]);                           // new in 3.1, kill credit
-    if (GetModelByIdx(0))
-        queryData << uint32(GetModelByIdx(0)->CreatureDisplayID); // Modelid1
-    else
-        queryData << uint32(0);                                   // Modelid1
-    if (GetModelByIdx(1))
-        queryData << uint32(GetModelByIdx(1)->CreatureDisplayID); // Modelid2
-    else
-        queryData << uint32(0);                                   // Modelid2
-    if (GetModelByIdx(2))
-        queryData << uint32(GetModelByIdx(2)->CreatureDisplayID); // Modelid3
-    else
-        queryData << uint32(0);                                   // Modelid3
-    if (GetModelByIdx(3))
-        queryData << uint32(GetModelByIdx(3)->CreatureDisplayID); // Modelid4
-    else
-        queryData << uint32(0);                                   // Modelid4
-    queryData << float(ModHealth);                                // dmg/hp modifier
-    queryData << float(ModMana);                                  // dmg/mana modifier
-    queryData << uint8(RacialLeader);
-    queryData << uint32(movementId);                              // CreatureMovementInfo.dbc
-}
-
 bool AssistDelayEvent::Execute(uint64 /*e_time*/, uint32 /*p_time*/)
 {
     if (Unit* victim = ObjectAccessor::GetUnit(*m_owner, m_victim))
@@ -267,7 +230,8 @@ Creature::Creature(): Unit(), MovableMapObject(), m_groupLootTimer(0), lootingGr
     m_spawnId(0), m_equipmentId(0), m_originalEquipmentId(0), m_alreadyCallForHelp(false), m_AlreadyCallAssistance(false),
     m_AlreadySearchedAssistance(false), m_regenHealth(true), m_regenPower(true), m_AI_locked(false), m_meleeDamageSchoolMask(SPELL_SCHOOL_MASK_NORMAL), m_originalEntry(0), _gossipMenuId(0), m_moveInLineOfSightDisabled(false), m_moveInLineOfSightStrictlyDisabled(false),
     m_homePosition(), m_transportHomePosition(), m_creatureInfo(nullptr), m_creatureData(nullptr), m_detectionDistance(20.0f),_sparringPct(0.0f), m_waypointID(0), m_path_id(0), m_formation(nullptr), m_lastLeashExtensionTime(nullptr), m_cannotReachTimer(0),
-    _isMissingSwimmingFlagOutOfCombat(false), m_assistanceTimer(0), _playerDamageReq(0), _damagedByPlayer(false), _isCombatMovementAllowed(true)
+    _isMissingSwimmingFlagOutOfCombat(false), m_assistanceTimer(0), _playerDamageReq(0), _damagedByPlayer(false), _isCombatMovementAllowed(true),
+    _aiUpdateDiff(0), _aiPlayerCheckTimer(0), _aiNearPlayer(true)
 {
     m_regenTimer = CREATURE_REGEN_INTERVAL;
     m_valuesCount = UNIT_END;
@@ -288,6 +252,7 @@ Creature::Creature(): Unit(), MovableMapObject(), m_groupLootTimer(0), lootingGr
 
     ResetLootMode(); // restore default loot mode
     TriggerJustRespawned = false;
+    m_respawnScheduled = false;
     _focusSpell = nullptr;
 
     m_respawnedTime = time_t(0);
@@ -683,6 +648,10 @@ void Creature::Update(uint32 diff)
             {
                 Respawn();
             }
+
+            // nothing to update until the respawn, leave it to the respawn queue of the map
+            if (m_deathState == DeathState::Dead && m_respawnTime > now && m_spawnId && !m_respawnScheduled && sWorld->getBoolConfig(CONFIG_MAP_CREATURE_UPDATE_SLEEP))
+                GetMap()->ScheduleCreatureRespawn(this);
             break;
         }
         case DeathState::Corpse:
@@ -825,10 +794,17 @@ void Creature::Update(uint32 diff)
 
             if (!IsInEvadeMode() && IsAIEnabled)
             {
-                // do not allow the AI to be changed during update
-                m_AI_locked = true;
-                i_AI->UpdateAI(diff);
-                m_AI_locked = false;
+                _aiUpdateDiff += diff;
+                if (!IsAIUpdateThrottled(diff))
+                {
+                    // the AI gets all the time elapsed since its last update
+                    uint32 const aiDiff = std::exchange(_aiUpdateDiff, 0);
+
+                    // do not allow the AI to be changed during update
+                    m_AI_locked = true;
+                    i_AI->UpdateAI(aiDiff);
+                    m_AI_locked = false;
+                }
             }
 
             // creature can be dead after UpdateAI call
@@ -1124,7 +1100,7 @@ void Creature::Motion_Initialize()
         GetMotionMaster()->Initialize();
 }
 
-bool Creature::Create(ObjectGuid::LowType guidlow, Map* map, uint32 phaseMask, uint32 Entry, uint32 vehId, float x, float y, float z, float ang, const CreatureData* data)
+bool Creature::Create(ObjectGuid::LowType guidlow, Map* map, uint32 phaseMask, uint32 Entry, uint32 vehId, float x, float y, float z, float ang, const CreatureData* data, PositionFullTerrainStatus const* terrainStatus)
 {
     ASSERT(map);
     SetMap(map);
@@ -1148,9 +1124,14 @@ bool Creature::Create(ObjectGuid::LowType guidlow, Map* map, uint32 phaseMask, u
     }
 
     // area/zone id is needed immediately for ZoneScript::GetCreatureEntry hook before it is known which creature template to load (no model/scale available yet)
-    PositionFullTerrainStatus terrainData;
-    GetMap()->GetFullTerrainStatusForPosition(GetPhaseMask(), GetPositionX(), GetPositionY(), GetPositionZ(), DEFAULT_COLLISION_HEIGHT, terrainData);
-    ProcessPositionDataChanged(terrainData);
+    if (terrainStatus)
+        ProcessPositionDataChanged(*terrainStatus);
+    else
+    {
+        PositionFullTerrainStatus terrainData;
+        GetMap()->GetFullTerrainStatusForPosition(GetPhaseMask(), GetPositionX(), GetPositionY(), GetPositionZ(), DEFAULT_COLLISION_HEIGHT, terrainData);
+        ProcessPositionDataChanged(terrainData);
+    }
 
     //oX = x;     oY = y;    dX = x;    dY = y;    m_moveTime = 0;    m_startMove = 0;
     if (!CreateFromProto(guidlow, Entry, vehId, data))
@@ -1652,7 +1633,7 @@ bool Creature::isVendorWithIconSpeak() const
     return m_creatureInfo->IconName == "Speak" && m_creatureData->npcflag & UNIT_NPC_FLAG_VENDOR;
 }
 
-bool Creature::LoadCreatureFromDB(ObjectGuid::LowType spawnId, Map* map, bool addToMap, bool allowDuplicate /*= false*/)
+bool Creature::LoadCreatureFromDB(ObjectGuid::LowType spawnId, Map* map, bool addToMap, bool allowDuplicate /*= false*/, PositionFullTerrainStatus const* terrainStatus /*= nullptr*/)
 {
     if (!allowDuplicate)
     {
@@ -1698,7 +1679,7 @@ bool Creature::LoadCreatureFromDB(ObjectGuid::LowType spawnId, Map* map, bool ad
     // Add to world
     uint32 entry = GetRandomId(data->id1, data->id2, data->id3);
 
-    if (!Create(map->GenerateLowGuid<HighGuid::Unit>(), map, data->phaseMask, entry, 0, data->posX, data->posY, data->posZ, data->orientation, data))
+    if (!Create(map->GenerateLowGuid<HighGuid::Unit>(), map, data->phaseMask, entry, 0, data->posX, data->posY, data->posZ, data->orientation, data, terrainStatus))
         return false;
 
     //We should set first home position, because then AI calls home movement
@@ -1922,6 +1903,7 @@ bool Creature::CanStartAttack(Unit const* who) const
 void Creature::setDeathState(DeathState state, bool despawn)
 {
     Unit::setDeathState(state, despawn);
+    WakeUpdate();
 
     if (state == DeathState::JustDied)
     {
@@ -1992,6 +1974,13 @@ void Creature::setDeathState(DeathState state, bool despawn)
  */
 void Creature::Respawn(bool force)
 {
+    if (m_respawnScheduled)
+    {
+        m_respawnScheduled = false;
+        if (IsInWorld())
+            GetMap()->AddObjectToPendingUpdateList(this);
+    }
+
     if (force)
     {
         if (IsAlive())
@@ -3654,6 +3643,7 @@ void Creature::SetRespawnTime(uint32 respawn)
         sScriptMgr->OnBeforeCreatureSetRespawnTime(this, respawn);
 
     m_respawnTime = respawn ? GameTime::GetGameTime().count() + respawn : 0;
+    WakeUpdate();
 }
 
 void Creature::SetCorpseRemoveTime(uint32 delay)
@@ -3745,9 +3735,73 @@ std::string Creature::GetDebugInfo() const
     return sstr.str();
 }
 
+// Out of combat creatures with no player nearby update their AI at the reduced rate configured for
+// their map type, the AI then receives the time accumulated since its last update.
+bool Creature::IsAIUpdateThrottled(uint32 diff)
+{
+    // Interval between player checks, a player coming close restores the full rate after at most this time
+    constexpr uint32 AI_THROTTLE_PLAYER_CHECK_INTERVAL = 1000;
+
+    Map const* map = GetMap();
+    uint32 const interval = sWorld->getIntConfig(map->IsBattlegroundOrArena() ? CONFIG_MAP_CREATURE_AI_THROTTLE_BATTLEGROUND :
+        map->Instanceable() ? CONFIG_MAP_CREATURE_AI_THROTTLE_INSTANCE : CONFIG_MAP_CREATURE_AI_THROTTLE_CONTINENT);
+
+    if (!interval || _aiUpdateDiff >= interval)
+        return false;
+
+    if (IsInCombat() || IsEngaged() || isActiveObject() || GetCharmerOrOwnerGUID() || IsSummon())
+        return false;
+
+    if (diff >= _aiPlayerCheckTimer)
+    {
+        Player* player = nullptr;
+        Acore::AnyPlayerInObjectRangeCheck checker(this, sWorld->getFloatConfig(CONFIG_MAP_CREATURE_AI_THROTTLE_RANGE), false);
+        Acore::PlayerSearcher<Acore::AnyPlayerInObjectRangeCheck> searcher(this, player, checker);
+        Cell::VisitObjects(this, searcher, sWorld->getFloatConfig(CONFIG_MAP_CREATURE_AI_THROTTLE_RANGE));
+
+        _aiNearPlayer = player != nullptr;
+        _aiPlayerCheckTimer = AI_THROTTLE_PLAYER_CHECK_INTERVAL;
+    }
+    else
+        _aiPlayerCheckTimer -= diff;
+
+    return !_aiNearPlayer;
+}
+
 // Note: This is called in a tight (heavy) loop, is it critical that all checks are FAST and are hopefully only simple conditionals.
+uint32 Creature::GetUpdateSleepTime() const
+{
+    // Longest sleep, keeps wake time arithmetic far from uint32 wrap
+    constexpr time_t MAX_UPDATE_SLEEP_TIME = MINUTE;
+
+    // Dead creatures only check their respawn time, see Update()
+    if (m_deathState != DeathState::Dead || TriggerJustRespawned || !sWorld->getBoolConfig(CONFIG_MAP_CREATURE_UPDATE_SLEEP))
+        return 0;
+
+    time_t const now = GameTime::GetGameTime().count();
+    if (m_respawnTime <= now)
+        return 0;
+
+    return uint32(std::min(m_respawnTime - now, MAX_UPDATE_SLEEP_TIME) * IN_MILLISECONDS);
+}
+
+void Creature::WakeUpdate()
+{
+    if (!IsInWorld())
+        return;
+
+    // the respawn time may have been brought forward
+    if (m_respawnScheduled)
+        GetMap()->ScheduleCreatureRespawn(this);
+    else
+        GetMap()->WakeUpdatableObject(this);
+}
+
 bool Creature::IsUpdateNeeded()
 {
+    if (m_respawnScheduled)
+        return false;
+
     if (WorldObject::IsUpdateNeeded())
         return true;
 
@@ -61,7 +61,8 @@ public:
 
     [[nodiscard]] bool isVendorWithIconSpeak() const;
 
-    bool Create(ObjectGuid::LowType guidlow, Map* map, uint32 phaseMask, uint32 Entry, uint32 vehId, float x, float y, float z, float ang, const CreatureData* data = nullptr);
+    // terrainStatus, if set, is the terrain status at the given position, saved the terrain queries
+    bool Create(ObjectGuid::LowType guidlow, Map* map, uint32 phaseMask, uint32 Entry, uint32 vehId, float x, float y, float z, float ang, const CreatureData* data = nullptr, PositionFullTerrainStatus const* terrainStatus = nullptr);
     bool LoadCreaturesAddon(bool reload = false);
     void SelectLevel(bool changelevel = true);
     void LoadEquipment(int8 id = 1, bool force = false);
@@ -218,8 +219,8 @@ public:
 
     void setDeathState(DeathState s, bool despawn = false) override;    // override virtual Unit::setDeathState
 
-    bool LoadFromDB(ObjectGuid::LowType guid, Map* map, bool allowDuplicate = false) { return LoadCreatureFromDB(guid, map, false, allowDuplicate); }
-    bool LoadCreatureFromDB(ObjectGuid::LowType guid, Map* map, bool addToMap = true, bool allowDuplicate = false);
+    bool LoadFromDB(ObjectGuid::LowType guid, Map* map, bool allowDuplicate = false, PositionFullTerrainStatus const* terrainStatus = nullptr) { return LoadCreatureFromDB(guid, map, false, allowDuplicate, terrainStatus); }
+    bool LoadCreatureFromDB(ObjectGuid::LowType guid, Map* map, bool addToMap = true, bool allowDuplicate = false, PositionFullTerrainStatus const* terrainStatus = nullptr);
     void SaveToDB();
 
     virtual void SaveToDB(uint32 mapid, uint8 spawnMask, uint32 phaseMask);   // overriden in Pet
@@ -438,6 +439,15 @@ public:
 
     bool IsUpdateNeeded() override;
 
+    // Map update sleep scheduling: time this creature can skip its updates for after
+    // an update (0 if it has to be updated next tick), and wake up on state changes
+    [[nodiscard]] uint32 GetUpdateSleepTime() const;
+    void WakeUpdate();
+
+    // Out of the map update list while waiting in the respawn queue of the map
+    [[nodiscard]] bool IsRespawnScheduled() const { return m_respawnScheduled; }
+    void SetRespawnScheduled(bool scheduled) { m_respawnScheduled = scheduled; }
+
 protected:
     bool CreateFromProto(ObjectGuid::LowType guidlow, uint32 Entry, uint32 vehId, const CreatureData* data = nullptr);
     bool InitEntry(uint32 entry, const CreatureData* data = nullptr);
@@ -515,6 +525,7 @@ private:
     // Formation variable
     CreatureGroup* m_formation;
     bool TriggerJustRespawned;
+    bool m_respawnScheduled;
 
     // Shared timer between mobs who assist another.
     // Damaging one extends leash range on all of them.
@@ -534,6 +545,12 @@ private:
     uint32 _playerDamageReq;
     bool _damagedByPlayer;
     bool _isCombatMovementAllowed;
+
+    // AI update throttling of idle creatures away from players, see Update()
+    bool IsAIUpdateThrottled(uint32 diff);
+    uint32 _aiUpdateDiff;                               // (msecs) time elapsed since the last AI update
+    uint32 _aiPlayerCheckTimer;                         // (msecs) remaining time for next nearby player check
+    bool _aiNearPlayer;
 };
 
 class AssistDelayEvent : public BasicEvent
@@ -241,7 +241,6 @@ struct CreatureTemplate
     uint8   SpellSchoolImmuneMask;
     uint32  flags_extra;
     uint32  ScriptID;
-    WorldPacket queryData; // pussywizard
     CreatureModel const* GetModelByIdx(uint32 idx) const;
     CreatureModel const* GetRandomValidModel() const;
     CreatureModel const* GetFirstValidModel() const;
@@ -277,8 +276,6 @@ struct CreatureTemplate
     }
 
     [[nodiscard]] bool HasFlagsExtra (uint32 flag) const { return (flags_extra & flag) != 0; }
-
-    void InitializeQueryData();
 };
 
 typedef std::vector<uint32> CreatureQuestItemList;
@@ -19,6 +19,7 @@
 #include "Creature.h"
 #include "CreatureAI.h"
 #include "Log.h"
+#include "MoveSpline.h"
 #include "MoveSplineInit.h"
 #include "ObjectMgr.h"
 #include "QueryResult.h"
@@ -344,6 +345,30 @@ void CreatureGroup::FormationReset(bool dismiss, bool initMotionMaster)
     m_Formed = !dismiss;
 }
 
+// the path the leader was just launched on, when it bends on its way to the formation destination
+static bool GetLeaderPath(Creature* leader, float x, float y, Movement::PointsArray& path, float& length)
+{
+    Movement::MoveSpline const* moveSpline = leader->movespline;
+    if (moveSpline->Finalized() || moveSpline->onTransport || moveSpline->isCyclic())
+        return false;
+
+    // a virtual point on both ends around the start, the corners and the destination
+    Movement::PointsArray const& points = moveSpline->_Spline().getPoints();
+    if (points.size() < 5)
+        return false;
+
+    G3D::Vector3 const& dest = moveSpline->FinalDestination();
+    if (std::fabs(dest.x - x) > 1.0f || std::fabs(dest.y - y) > 1.0f)
+        return false;
+
+    path.assign(points.begin() + 1, points.end() - 1);
+    length = 0.0f;
+    for (std::size_t i = 1; i < path.size(); ++i)
+        length += (path[i] - path[i - 1]).length();
+
+    return length > 0.0f;
+}
+
 void CreatureGroup::LeaderMoveTo(float x, float y, float z, uint32 move_type)
 {
     //! To do: This should probably get its own movement generator or use WaypointMovementGenerator.
@@ -354,6 +379,12 @@ void CreatureGroup::LeaderMoveTo(float x, float y, float z, uint32 move_type)
     float pathDist = m_leader->GetExactDist(x, y, z);
     float pathAngle = std::atan2(m_leader->GetPositionY() - y, m_leader->GetPositionX() - x);
 
+    // members follow the navmesh path of the leader moved by their formation offset, instead of searching their own
+    Movement::PointsArray leaderPath;
+    float leaderPathLength = 0.0f;
+    bool const hasLeaderPath = GetLeaderPath(m_leader, x, y, leaderPath, leaderPathLength);
+    Movement::PointsArray memberPath;
+
     for (auto const& itr : m_members)
     {
         Creature* member = itr.first;
@@ -403,15 +434,45 @@ void CreatureGroup::LeaderMoveTo(float x, float y, float z, uint32 move_type)
             break;
         }
 
+        float memberDist = member->GetExactDist(dx, dy, dz);
+        if (hasLeaderPath)
+        {
+            float const offsetX = dx - x;
+            float const offsetY = dy - y;
+
+            memberPath.resize(leaderPath.size());
+            memberPath[0] = G3D::Vector3(member->GetPositionX(), member->GetPositionY(), member->GetPositionZ());
+            memberDist = 0.0f;
+            for (std::size_t i = 1; i < leaderPath.size(); ++i)
+            {
+                G3D::Vector3& point = memberPath[i];
+                if (i + 1 == leaderPath.size())
+                    point = G3D::Vector3(dx, dy, dz);
+                else
+                {
+                    point = G3D::Vector3(leaderPath[i].x + offsetX, leaderPath[i].y + offsetY, leaderPath[i].z);
+                    Acore::NormalizeMapCoord(point.x);
+                    Acore::NormalizeMapCoord(point.y);
+                    if (move_type < 2)
+                        member->UpdateGroundPositionZ(point.x, point.y, point.z);
+                }
+
+                memberDist += (point - memberPath[i - 1]).length();
+            }
+        }
+
         // xinef: if we move members to position without taking care of sizes, we should compare distance without sizes
         // xinef: change members speed basing on distance - if too far speed up, if too close slow down
         UnitMoveType const mtype = Movement::SelectSpeedType(member->GetUnitMovementFlags());
-        float const speedRate = m_leader->GetSpeedRate(mtype) * member->GetExactDist(dx, dy, dz) / pathDist;
+        float const speedRate = m_leader->GetSpeedRate(mtype) * memberDist / (hasLeaderPath ? leaderPathLength : pathDist);
 
         if (speedRate > 0.01f) // don't move if speed rate is too low
         {
             member->SetSpeedRate(mtype, speedRate);
-            member->GetMotionMaster()->MovePoint(0, dx, dy, dz);
+            if (hasLeaderPath)
+                member->GetMotionMaster()->MovePoint(0, memberPath);
+            else
+                member->GetMotionMaster()->MovePoint(0, dx, dy, dz);
             member->SetHomePosition(dx, dy, dz, pathAngle);
         }
     }
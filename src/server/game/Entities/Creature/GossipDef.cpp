@@ -506,141 +506,151 @@ void PlayerMenu::SendQuestGiverQuestDetails(Quest const* quest, ObjectGuid npcGU
 
 void PlayerMenu::SendQuestQueryResponse(Quest const* quest) const
 {
-    std::string questTitle           = quest->GetTitle();
-    std::string questDetails         = quest->GetDetails();
-    std::string questObjectives      = quest->GetObjectives();
-    std::string questAreaDescription = quest->GetAreaDescription();
-    std::string questCompletedText   = quest->GetCompletedText();
-
-    std::string questObjectiveText[QUEST_OBJECTIVES_COUNT];
-    for (uint8 i = 0; i < QUEST_OBJECTIVES_COUNT; ++i)
-        questObjectiveText[i] = quest->ObjectiveText[i];
-
-    int32 locale = _session->GetSessionDbLocaleIndex();
-    if (QuestLocale const* localeData = sObjectMgr->GetQuestLocale(quest->GetQuestId()))
+    LocaleConstant locale = _session->GetSessionDbLocaleIndex();
+    QueryResponse response = sObjectMgr->GetQueryResponse(QUERY_RESPONSE_QUEST, quest->GetQuestId(), locale, [&]()
     {
-        ObjectMgr::GetLocaleString(localeData->Title, locale, questTitle);
-        ObjectMgr::GetLocaleString(localeData->Details, locale, questDetails);
-        ObjectMgr::GetLocaleString(localeData->Objectives, locale, questObjectives);
-        ObjectMgr::GetLocaleString(localeData->AreaDescription, locale, questAreaDescription);
-        ObjectMgr::GetLocaleString(localeData->CompletedText, locale, questCompletedText);
+        std::string questTitle           = quest->GetTitle();
+        std::string questDetails         = quest->GetDetails();
+        std::string questObjectives      = quest->GetObjectives();
+        std::string questAreaDescription = quest->GetAreaDescription();
+        std::string questCompletedText   = quest->GetCompletedText();
 
+        std::string questObjectiveText[QUEST_OBJECTIVES_COUNT];
         for (uint8 i = 0; i < QUEST_OBJECTIVES_COUNT; ++i)
-            ObjectMgr::GetLocaleString(localeData->ObjectiveText[i], locale, questObjectiveText[i]);
-    }
+            questObjectiveText[i] = quest->ObjectiveText[i];
 
-    WorldPacket data(SMSG_QUEST_QUERY_RESPONSE, 100);       // guess size
+        if (QuestLocale const* localeData = sObjectMgr->GetQuestLocale(quest->GetQuestId()))
+        {
+            ObjectMgr::GetLocaleString(localeData->Title, locale, questTitle);
+            ObjectMgr::GetLocaleString(localeData->Details, locale, questDetails);
+            ObjectMgr::GetLocaleString(localeData->Objectives, locale, questObjectives);
+            ObjectMgr::GetLocaleString(localeData->AreaDescription, locale, questAreaDescription);
+            ObjectMgr::GetLocaleString(localeData->CompletedText, locale, questCompletedText);
+
+            for (uint8 i = 0; i < QUEST_OBJECTIVES_COUNT; ++i)
+                ObjectMgr::GetLocaleString(localeData->ObjectiveText[i], locale, questObjectiveText[i]);
+        }
 
-    data << uint32(quest->GetQuestId());                    // quest id
-    data << uint32(quest->GetQuestMethod());                // Accepted values: 0, 1 or 2. 0 == IsAutoComplete() (skip objectives/details)
-    data << uint32(quest->GetQuestLevel());                 // may be -1, static data, in other cases must be used dynamic level: Player::GetQuestLevel (0 is not known, but assuming this is no longer valid for quest intended for client)
-    data << uint32(quest->GetMinLevel());                   // min level
-    data << uint32(quest->GetZoneOrSort());                 // zone or sort to display in quest log
+        WorldPacket data(SMSG_QUEST_QUERY_RESPONSE, 100);       // guess size
 
-    data << uint32(quest->GetType());                       // quest type
-    data << uint32(quest->GetSuggestedPlayers());           // suggested players count
+        data << uint32(quest->GetQuestId());                    // quest id
+        data << uint32(quest->GetQuestMethod());                // Accepted values: 0, 1 or 2. 0 == IsAutoComplete() (skip objectives/details)
+        data << uint32(quest->GetQuestLevel());                 // may be -1, static data, in other cases must be used dynamic level: Player::GetQuestLevel (0 is not known, but assuming this is no longer valid for quest intended for client)
+        data << uint32(quest->GetMinLevel());                   // min level
+        data << uint32(quest->GetZoneOrSort());                 // zone or sort to display in quest log
 
-    data << uint32(quest->GetRepObjectiveFaction());        // shown in quest log as part of quest objective
-    data << uint32(quest->GetRepObjectiveValue());          // shown in quest log as part of quest objective
+        data << uint32(quest->GetType());                       // quest type
+        data << uint32(quest->GetSuggestedPlayers());           // suggested players count
 
-    data << uint32(quest->GetRepObjectiveFaction2());       // shown in quest log as part of quest objective OPPOSITE faction
-    data << uint32(quest->GetRepObjectiveValue2());         // shown in quest log as part of quest objective OPPOSITE faction
+        data << uint32(quest->GetRepObjectiveFaction());        // shown in quest log as part of quest objective
+        data << uint32(quest->GetRepObjectiveValue());          // shown in quest log as part of quest objective
 
-    data << uint32(quest->GetNextQuestInChain());           // client will request this quest from NPC, if not 0
-    data << uint32(quest->GetXPId());                       // used for calculating rewarded experience
+        data << uint32(quest->GetRepObjectiveFaction2());       // shown in quest log as part of quest objective OPPOSITE faction
+        data << uint32(quest->GetRepObjectiveValue2());         // shown in quest log as part of quest objective OPPOSITE faction
 
-    if (quest->HasFlag(QUEST_FLAGS_HIDDEN_REWARDS))
-        data << uint32(0);                                  // Hide money rewarded
-    else
-    {
-        uint32 moneyRew = 0;
-        Player* player = _session->GetPlayer();
-        if (player && (player->GetLevel() >= sWorld->getIntConfig(CONFIG_MAX_PLAYER_LEVEL) || sScriptMgr->OnPlayerShouldBeRewardedWithMoneyInsteadOfExp(player)))
-        {
-            moneyRew = quest->GetRewMoneyMaxLevel();
-        }
-        moneyRew += quest->GetRewOrReqMoney(player ? player->GetLevel() : 0); // reward money (below max lvl)
-        data << moneyRew;
-    }
+        data << uint32(quest->GetNextQuestInChain());           // client will request this quest from NPC, if not 0
+        data << uint32(quest->GetXPId());                       // used for calculating rewarded experience
 
-    data << uint32(quest->GetRewMoneyMaxLevel());           // used in XP calculation at client
-    data << uint32(quest->GetRewSpell());                   // reward spell, this spell will display (icon) (cast if RewSpellCast == 0)
-    data << int32(quest->GetRewSpellCast());                // cast spell
+        data << uint32(0);                                      // reward money, depends on the player and set at send
 
-    // rewarded honor points
-    data << uint32(quest->GetRewHonorAddition());
-    data << float(quest->GetRewHonorMultiplier());
-    data << uint32(quest->GetSrcItemId());                  // source item id
-    data << uint32(quest->GetFlags() & 0xFFFF);             // quest flags
-    data << uint32(quest->GetCharTitleId());                // CharTitleId, new 2.4.0, player gets this title (id from CharTitles)
-    data << uint32(quest->GetPlayersSlain());               // players slain
-    data << uint32(quest->GetBonusTalents());               // bonus talents
-    data << uint32(quest->GetRewArenaPoints());             // bonus arena points
-    data << uint32(0);                                      // review rep show mask
+        data << uint32(quest->GetRewMoneyMaxLevel());           // used in XP calculation at client
+        data << uint32(quest->GetRewSpell());                   // reward spell, this spell will display (icon) (cast if RewSpellCast == 0)
+        data << int32(quest->GetRewSpellCast());                // cast spell
 
-    if (quest->HasFlag(QUEST_FLAGS_HIDDEN_REWARDS))
-    {
-        for (uint8 i = 0; i < QUEST_REWARDS_COUNT; ++i)
-            data << uint32(0) << uint32(0);
-        for (uint8 i = 0; i < QUEST_REWARD_CHOICES_COUNT; ++i)
-            data << uint32(0) << uint32(0);
-    }
-    else
-    {
-        for (uint8 i = 0; i < QUEST_REWARDS_COUNT; ++i)
+        // rewarded honor points
+        data << uint32(quest->GetRewHonorAddition());
+        data << float(quest->GetRewHonorMultiplier());
+        data << uint32(quest->GetSrcItemId());                  // source item id
+        data << uint32(quest->GetFlags() & 0xFFFF);             // quest flags
+        data << uint32(quest->GetCharTitleId());                // CharTitleId, new 2.4.0, player gets this title (id from CharTitles)
+        data << uint32(quest->GetPlayersSlain());               // players slain
+        data << uint32(quest->GetBonusTalents());               // bonus talents
+        data << uint32(quest->GetRewArenaPoints());             // bonus arena points
+        data << uint32(0);                                      // review rep show mask
+
+        if (quest->HasFlag(QUEST_FLAGS_HIDDEN_REWARDS))
         {
-            data << uint32(quest->RewardItemId[i]);
-            data << uint32(quest->RewardItemIdCount[i]);
+            for (uint8 i = 0; i < QUEST_REWARDS_COUNT; ++i)
+                data << uint32(0) << uint32(0);
+            for (uint8 i = 0; i < QUEST_REWARD_CHOICES_COUNT; ++i)
+                data << uint32(0) << uint32(0);
         }
-        for (uint8 i = 0; i < QUEST_REWARD_CHOICES_COUNT; ++i)
+        else
         {
-            data << uint32(quest->RewardChoiceItemId[i]);
-            data << uint32(quest->RewardChoiceItemCount[i]);
+            for (uint8 i = 0; i < QUEST_REWARDS_COUNT; ++i)
+            {
+                data << uint32(quest->RewardItemId[i]);
+                data << uint32(quest->RewardItemIdCount[i]);
+            }
+            for (uint8 i = 0; i < QUEST_REWARD_CHOICES_COUNT; ++i)
+            {
+                data << uint32(quest->RewardChoiceItemId[i]);
+                data << uint32(quest->RewardChoiceItemCount[i]);
+            }
         }
-    }
 
-    for (uint8 i = 0; i < QUEST_REPUTATIONS_COUNT; ++i)        // reward factions ids
-        data << uint32(quest->RewardFactionId[i]);
+        for (uint8 i = 0; i < QUEST_REPUTATIONS_COUNT; ++i)        // reward factions ids
+            data << uint32(quest->RewardFactionId[i]);
 
-    for (uint8 i = 0; i < QUEST_REPUTATIONS_COUNT; ++i)        // columnid+1 QuestFactionReward.dbc?
-        data << int32(quest->RewardFactionValueId[i]);
+        for (uint8 i = 0; i < QUEST_REPUTATIONS_COUNT; ++i)        // columnid+1 QuestFactionReward.dbc?
+            data << int32(quest->RewardFactionValueId[i]);
 
-    for (uint8 i = 0; i < QUEST_REPUTATIONS_COUNT; ++i)        // unk (0)
-        data << int32(quest->RewardFactionValueIdOverride[i]);
+        for (uint8 i = 0; i < QUEST_REPUTATIONS_COUNT; ++i)        // unk (0)
+            data << int32(quest->RewardFactionValueIdOverride[i]);
 
-    data << uint32(quest->GetPOIContinent());
-    data << float(quest->GetPOIx());
-    data << float(quest->GetPOIy());
-    data << uint32(quest->GetPointOpt());
+        data << uint32(quest->GetPOIContinent());
+        data << float(quest->GetPOIx());
+        data << float(quest->GetPOIy());
+        data << uint32(quest->GetPointOpt());
 
-    data << questTitle;
-    data << questObjectives;
-    data << questDetails;
-    data << questAreaDescription;
-    data << questCompletedText;                                 // display in quest objectives window once all objectives are completed
+        data << questTitle;
+        data << questObjectives;
+        data << questDetails;
+        data << questAreaDescription;
+        data << questCompletedText;                                 // display in quest objectives window once all objectives are completed
 
-    for (uint8 i = 0; i < QUEST_OBJECTIVES_COUNT; ++i)
-    {
-        if (quest->RequiredNpcOrGo[i] < 0)
-            data << uint32((quest->RequiredNpcOrGo[i] * (-1)) | 0x80000000);    // client expects gameobject template id in form (id|0x80000000)
-        else
-            data << uint32(quest->RequiredNpcOrGo[i]);
+        for (uint8 i = 0; i < QUEST_OBJECTIVES_COUNT; ++i)
+        {
+            if (quest->RequiredNpcOrGo[i] < 0)
+                data << uint32((quest->RequiredNpcOrGo[i] * (-1)) | 0x80000000);    // client expects gameobject template id in form (id|0x80000000)
+            else
+                data << uint32(quest->RequiredNpcOrGo[i]);
 
-        data << uint32(quest->RequiredNpcOrGoCount[i]);
-        data << uint32(quest->ItemDrop[i]);
-        data << uint32(0);                                  // req source count?
-    }
+            data << uint32(quest->RequiredNpcOrGoCount[i]);
+            data << uint32(quest->ItemDrop[i]);
+            data << uint32(0);                                  // req source count?
+        }
 
-    for (uint8 i = 0; i < QUEST_ITEM_OBJECTIVES_COUNT; ++i)
+        for (uint8 i = 0; i < QUEST_ITEM_OBJECTIVES_COUNT; ++i)
+        {
+            data << uint32(quest->RequiredItemId[i]);
+            data << uint32(quest->RequiredItemCount[i]);
+        }
+
+        for (uint8 i = 0; i < QUEST_OBJECTIVES_COUNT; ++i)
+            data << questObjectiveText[i];
+
+        return data;
+    });
+
+    if (quest->HasFlag(QUEST_FLAGS_HIDDEN_REWARDS))
+        _session->SendSharedPacket(response);               // Hide money rewarded
+    else
     {
-        data << uint32(quest->RequiredItemId[i]);
-        data << uint32(quest->RequiredItemCount[i]);
-    }
+        uint32 moneyRew = 0;
+        Player* player = _session->GetPlayer();
+        if (player && (player->GetLevel() >= sWorld->getIntConfig(CONFIG_MAX_PLAYER_LEVEL) || sScriptMgr->OnPlayerShouldBeRewardedWithMoneyInsteadOfExp(player)))
+        {
+            moneyRew = quest->GetRewMoneyMaxLevel();
+        }
+        moneyRew += quest->GetRewOrReqMoney(player ? player->GetLevel() : 0); // reward money (below max lvl)
 
-    for (uint8 i = 0; i < QUEST_OBJECTIVES_COUNT; ++i)
-        data << questObjectiveText[i];
+        // the reward money follows the 13 uint32 fields from quest id to xp id
+        WorldPacket data(*response);
+        data.put<uint32>(13 * sizeof(uint32), moneyRew);
+        _session->SendPacket(&data);
+    }
 
-    _session->SendPacket(&data);
     LOG_DEBUG("network", "WORLD: Sent SMSG_QUEST_QUERY_RESPONSE questid={}", quest->GetQuestId());
 }
 
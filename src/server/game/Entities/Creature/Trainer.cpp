@@ -42,7 +42,38 @@ namespace Trainer
         trainerList.TrainerGUID = npc->GetGUID();
         trainerList.TrainerType = AsUnderlyingType(_type);
         trainerList.Greeting = GetGreeting(locale);
-        trainerList.Spells.reserve(_spells.size());
+
+        std::vector<ListedSpell> const& listedSpells = GetListedSpells(player);
+        trainerList.Spells.reserve(listedSpells.size());
+        for (ListedSpell const& listedSpell : listedSpells)
+        {
+            Spell const& trainerSpell = *listedSpell.TrainerSpell;
+
+            trainerList.Spells.emplace_back();
+            WorldPackets::NPC::TrainerListSpell& trainerListSpell = trainerList.Spells.back();
+            trainerListSpell.SpellID = trainerSpell.SpellId;
+            trainerListSpell.Usable = AsUnderlyingType(GetSpellState(player, &trainerSpell));
+            trainerListSpell.MoneyCost = int32(trainerSpell.MoneyCost * reputationDiscount);
+            trainerListSpell.PointCost[0] = 0; // spells don't cost talent points
+            trainerListSpell.PointCost[1] = (listedSpell.PrimaryProfessionFirstRank ? 1 : 0);
+            trainerListSpell.ReqLevel = trainerSpell.ReqLevel;
+            trainerListSpell.ReqSkillLine = trainerSpell.ReqSkillLine;
+            trainerListSpell.ReqSkillRank = trainerSpell.ReqSkillRank;
+            std::copy(trainerSpell.ReqAbility.begin(), trainerSpell.ReqAbility.end(), trainerListSpell.ReqAbility.begin());
+        }
+
+        player->SendDirectMessage(trainerList.Write());
+    }
+
+    std::vector<Trainer::ListedSpell> const& Trainer::GetListedSpells(Player const* player) const
+    {
+        std::lock_guard<std::mutex> guard(_listedSpellsLock);
+
+        // elements of unordered_map keep their address, the list stays valid once unlocked
+        auto [itr, inserted] = _listedSpells.try_emplace(uint32(player->getRace(true)) << 16 | uint32(player->getRace()) << 8 | player->getClass());
+        if (!inserted)
+            return itr->second;
+
         for (Spell const& trainerSpell : _spells)
         {
             if (!player->IsSpellFitByClassAndRace(trainerSpell.SpellId))
@@ -61,20 +92,10 @@ namespace Trainer
                     primaryProfessionFirstRank = true;
             }
 
-            trainerList.Spells.emplace_back();
-            WorldPackets::NPC::TrainerListSpell& trainerListSpell = trainerList.Spells.back();
-            trainerListSpell.SpellID = trainerSpell.SpellId;
-            trainerListSpell.Usable = AsUnderlyingType(GetSpellState(player, &trainerSpell));
-            trainerListSpell.MoneyCost = int32(trainerSpell.MoneyCost * reputationDiscount);
-            trainerListSpell.PointCost[0] = 0; // spells don't cost talent points
-            trainerListSpell.PointCost[1] = (primaryProfessionFirstRank ? 1 : 0);
-            trainerListSpell.ReqLevel = trainerSpell.ReqLevel;
-            trainerListSpell.ReqSkillLine = trainerSpell.ReqSkillLine;
-            trainerListSpell.ReqSkillRank = trainerSpell.ReqSkillRank;
-            std::copy(trainerSpell.ReqAbility.begin(), trainerSpell.ReqAbility.end(), trainerListSpell.ReqAbility.begin());
+            itr->second.push_back({ &trainerSpell, primaryProfessionFirstRank });
         }
 
-        player->SendDirectMessage(trainerList.Write());
+        return itr->second;
     }
 
     void Trainer::TeachSpell(Creature* npc, Player* player, uint32 spellId)
@@ -20,6 +20,8 @@
 
 #include "Common.h"
 #include <array>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 class Creature;
@@ -78,6 +80,14 @@ namespace Trainer
             bool IsTrainerValidForPlayer(Player const* player) const;
 
             private:
+            // spells of the list shown to a race and class, with what doesn't depend on the player
+            struct ListedSpell
+            {
+                Spell const* TrainerSpell;
+                bool PrimaryProfessionFirstRank;
+            };
+
+            std::vector<ListedSpell> const& GetListedSpells(Player const* player) const;
             SpellState GetSpellState(Player const* player, Spell const* trainerSpell) const;
             void SendTeachFailure(Creature const* npc, Player const* player, uint32 spellId, FailReason reason) const;
             void SendTeachSucceeded(Creature const* npc, Player const* player, uint32 spellId) const;
@@ -91,6 +101,10 @@ namespace Trainer
             uint32 _requirement;
             std::vector<Spell> _spells;
             std::array<std::string, TOTAL_LOCALES> _greeting;
+
+            // keyed by original and displayed race and class, filled by the first player of each combination
+            mutable std::mutex _listedSpellsLock;
+            mutable std::unordered_map<uint32, std::vector<ListedSpell>> _listedSpells;
     };
 }
 
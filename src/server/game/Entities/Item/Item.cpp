@@ -711,6 +711,14 @@ void Item::UpdateItemSuffixFactor()
     SetUInt32Value(ITEM_FIELD_PROPERTY_SEED, suffixFactor);
 }
 
+Loot& Item::GetLoot()
+{
+    if (!m_loot)
+        m_loot = std::make_unique<Loot>();
+
+    return *m_loot;
+}
+
 void Item::SetState(ItemUpdateState state, Player* forplayer)
 {
     if (uState == ITEM_NEW && state == ITEM_REMOVED)
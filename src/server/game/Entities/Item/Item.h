@@ -317,7 +317,8 @@ public:
     [[nodiscard]] int32 GetSpellCharges(uint8 index/*0..5*/ = 0) const { return GetInt32Value(ITEM_FIELD_SPELL_CHARGES + index); }
     void  SetSpellCharges(uint8 index/*0..5*/, int32 value) { SetInt32Value(ITEM_FIELD_SPELL_CHARGES + index, value); }
 
-    Loot loot;
+    // allocated when the item is first opened, most items never hold any loot
+    Loot& GetLoot();
     bool m_lootGenerated;
 
     // Update States
@@ -366,6 +367,7 @@ public:
     std::string GetDebugInfo() const override;
 private:
     std::string m_text;
+    std::unique_ptr<Loot> m_loot;
     uint8 m_slot;
     Bag* m_container;
     ItemUpdateState uState;
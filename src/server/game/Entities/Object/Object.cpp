@@ -227,7 +227,11 @@ void Object::BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target)
     buf << GetPackGUID();
     buf << (uint8)m_objectTypeId;
 
-    BuildMovementUpdate(&buf, flags);
+    if (IsCreature())
+        ToUnit()->BuildCachedMovementUpdate(&buf, flags);
+    else
+        BuildMovementUpdate(&buf, flags);
+
     BuildValuesUpdate(updatetype, &buf, target);
     data->AddUpdateBlock(buf);
 }
@@ -245,14 +249,13 @@ void Object::SendUpdateToPlayer(Player* player)
 
 void Object::BuildValuesUpdateBlockForPlayer(UpdateData* data, Player* target)
 {
-    ByteBuffer buf(500);
+    // Written straight into the update buffer, avoids a temporary allocation per recipient
+    ByteBuffer& buf = data->BeginUpdateBlock();
 
     buf << (uint8) UPDATETYPE_VALUES;
     buf << GetPackGUID();
 
     BuildValuesUpdate(UPDATETYPE_VALUES, &buf, target);
-
-    data->AddUpdateBlock(buf);
 }
 
 void Object::BuildOutOfRangeUpdateBlock(UpdateData* data) const
@@ -489,27 +492,46 @@ void Object::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* targe
         return;
 
     ByteBuffer fieldBuffer;
-    UpdateMask updateMask;
-    updateMask.SetCount(m_valuesCount);
 
     uint32* flags = nullptr;
     uint32 visibleFlag = GetUpdateFieldData(target, flags);
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    UpdateMask updateMask;
+    BuildValuesUpdateMask(updateType, flags, visibleFlag, updateMask);
+    updateMask.ForEachSetBit([&](uint32 index)
     {
-        if (_fieldNotifyFlags & flags[index] ||
-                ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)))
-        {
-            updateMask.SetBit(index);
-            fieldBuffer << m_uint32Values[index];
-        }
-    }
+        fieldBuffer << m_uint32Values[index];
+    });
 
     *data << uint8(updateMask.GetBlockCount());
     updateMask.AppendToPacket(data);
     data->append(fieldBuffer);
 }
 
+void Object::BuildValuesUpdateMask(uint8 updateType, uint32 const* flags, uint32 visibleFlag, UpdateMask& updateMask) const
+{
+    BuildUpdateFieldFlagMask(flags, m_valuesCount, visibleFlag, updateMask);
+
+    if (updateType == UPDATETYPE_VALUES)
+        updateMask &= _changesMask;
+    else
+    {
+        // creation only sends the visible fields which are set
+        updateMask.ForEachSetBit([&](uint32 index)
+        {
+            if (!m_uint32Values[index])
+                updateMask.UnsetBit(index);
+        });
+    }
+
+    if (_fieldNotifyFlags)
+    {
+        UpdateMask notifyMask;
+        BuildUpdateFieldFlagMask(flags, m_valuesCount, _fieldNotifyFlags, notifyMask);
+        updateMask |= notifyMask;
+    }
+}
+
 void Object::AddToObjectUpdateIfNeeded()
 {
     if (m_inWorld && !m_objectUpdated)
@@ -531,17 +553,43 @@ void Object::ClearUpdateMask(bool remove)
     }
 }
 
-void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map)
+bool Object::HasObserverVisibleChanges() const
 {
-    UpdateDataMapType::iterator iter = data_map.find(player);
+    // dynamic fields are notified with any update, other notify flags force fields of their class
+    if (_fieldNotifyFlags & ~UF_FLAG_DYNAMIC)
+        return true;
 
-    if (iter == data_map.end())
+    uint32 const* flags = nullptr;
+    switch (GetTypeId())
     {
-        std::pair<UpdateDataMapType::iterator, bool> p = data_map.insert(UpdateDataMapType::value_type(player, UpdateData()));
-        ASSERT(p.second);
-        iter = p.first;
+        case TYPEID_ITEM:
+        case TYPEID_CONTAINER:
+            flags = ItemUpdateFieldFlags;
+            break;
+        case TYPEID_UNIT:
+        case TYPEID_PLAYER:
+            flags = UnitUpdateFieldFlags;
+            break;
+        case TYPEID_GAMEOBJECT:
+            flags = GameObjectUpdateFieldFlags;
+            break;
+        case TYPEID_DYNAMICOBJECT:
+            flags = DynamicObjectUpdateFieldFlags;
+            break;
+        case TYPEID_CORPSE:
+            flags = CorpseUpdateFieldFlags;
+            break;
+        default:
+            return true;
     }
 
+    // fields only flagged private are never sent to the other players
+    return (GetUpdateFieldFlagsOfMask(flags, _changesMask) & ~UF_FLAG_PRIVATE) != 0;
+}
+
+void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map)
+{
+    UpdateDataMapType::iterator iter = data_map.try_emplace(player).first;
     BuildValuesUpdateBlockForPlayer(&iter->second, iter->first);
 }
 
@@ -653,8 +701,11 @@ void Object::UpdateUInt32Value(uint16 index, uint32 value)
 {
     ASSERT(index < m_valuesCount || PrintIndexError(index, true));
 
-    m_uint32Values[index] = value;
-    _changesMask.SetBit(index);
+    if (m_uint32Values[index] != value)
+    {
+        m_uint32Values[index] = value;
+        _changesMask.SetBit(index);
+    }
 }
 
 void Object::SetUInt64Value(uint16 index, uint64 value)
@@ -1033,7 +1084,7 @@ WorldObject::WorldObject() : WorldLocation(),
     LastUsedScriptID(0), m_name(""), m_isActive(false), _visibilityDistanceOverrideType(VisibilityDistanceType::Normal), m_zoneScript(nullptr),
     _zoneId(0), _areaId(0), _floorZ(INVALID_HEIGHT), _outdoors(false), _liquidData(), _updatePositionData(false), m_transport(nullptr),
     m_currMap(nullptr), _heartbeatTimer(HEARTBEAT_INTERVAL), m_InstanceId(0), m_phaseMask(PHASEMASK_NORMAL), m_useCombinedPhases(true),
-    m_notifyflags(0), m_executed_notifies(0), _objectVisibilityContainer(this)
+    m_notifyflags(0), m_executed_notifies(0), m_moveVisibilityEpoch(0), _objectVisibilityContainer(this)
 {
     m_serverSideVisibility.SetValue(SERVERSIDE_VISIBILITY_GHOST, GHOST_VISIBILITY_ALIVE | GHOST_VISIBILITY_GHOST);
     m_serverSideVisibilityDetect.SetValue(SERVERSIDE_VISIBILITY_GHOST, GHOST_VISIBILITY_ALIVE);
@@ -1052,7 +1103,8 @@ void WorldObject::Update(uint32 diff)
         Heartbeat();
     }
 
-    sScriptMgr->OnWorldObjectUpdate(this, diff);
+    if (ScriptRegistry<WorldObjectScript>::HasEnabledHooks(WORLDOBJECTHOOK_ON_WORLD_OBJECT_UPDATE))
+        sScriptMgr->OnWorldObjectUpdate(this, diff);
 }
 
 void WorldObject::setActive(bool on)
@@ -1353,19 +1405,9 @@ bool WorldObject::IsWithinLOS(float ox, float oy, float oz, VMAP::ModelIgnoreFla
 {
     if (IsInWorld())
     {
-        oz += GetCollisionHeight();
-        float x, y, z;
-        if (IsPlayer())
-        {
-            GetPosition(x, y, z);
-            z += GetCollisionHeight();
-        }
-        else
-        {
-            GetHitSpherePointFor({ ox, oy, oz }, x, y, z);
-        }
-
-        return GetMap()->isInLineOfSight(x, y, z, ox, oy, oz, GetPhaseMask(), checks, ignoreFlags);
+        Position start, end;
+        GetLineOfSightSegment(ox, oy, oz, start, end);
+        return GetMap()->isInLineOfSight(start.GetPositionX(), start.GetPositionY(), start.GetPositionZ(), end.GetPositionX(), end.GetPositionY(), end.GetPositionZ(), GetPhaseMask(), checks, ignoreFlags);
     }
     return true;
 }
@@ -1375,25 +1417,31 @@ bool WorldObject::IsWithinLOSInMap(WorldObject const* obj, VMAP::ModelIgnoreFlag
    if (!IsInMap(obj))
         return false;
 
-    float ox, oy, oz;
+    Position start, end;
+    GetLineOfSightSegment(obj, start, end, collisionHeight, combatReach);
+    return GetMap()->isInLineOfSight(start.GetPositionX(), start.GetPositionY(), start.GetPositionZ(), end.GetPositionX(), end.GetPositionY(), end.GetPositionZ(), GetPhaseMask(), checks, ignoreFlags);
+}
+
+void WorldObject::GetLineOfSightSegment(float ox, float oy, float oz, Position& start, Position& end) const
+{
+    end.Relocate(ox, oy, oz + GetCollisionHeight());
+    if (IsPlayer())
+        start.Relocate(GetPositionX(), GetPositionY(), GetPositionZ() + GetCollisionHeight());
+    else
+        start = GetHitSpherePointFor(end);
+}
+
+void WorldObject::GetLineOfSightSegment(WorldObject const* obj, Position& start, Position& end, Optional<float> collisionHeight /*= { }*/, Optional<float> combatReach /*= { }*/) const
+{
     if (obj->IsPlayer())
-    {
-        obj->GetPosition(ox, oy, oz);
-        oz += obj->GetCollisionHeight();
-    }
+        end.Relocate(obj->GetPositionX(), obj->GetPositionY(), obj->GetPositionZ() + obj->GetCollisionHeight());
     else
-        obj->GetHitSpherePointFor({ GetPositionX(), GetPositionY(), GetPositionZ() + (collisionHeight ? *collisionHeight : GetCollisionHeight()) }, ox, oy, oz);
+        end = obj->GetHitSpherePointFor({ GetPositionX(), GetPositionY(), GetPositionZ() + (collisionHeight ? *collisionHeight : GetCollisionHeight()) });
 
-    float x, y, z;
     if (IsPlayer())
-    {
-        GetPosition(x, y, z);
-        z += GetCollisionHeight();
-    }
+        start.Relocate(GetPositionX(), GetPositionY(), GetPositionZ() + GetCollisionHeight());
     else
-        GetHitSpherePointFor({ obj->GetPositionX(), obj->GetPositionY(), obj->GetPositionZ() + obj->GetCollisionHeight() }, x, y, z, collisionHeight, combatReach);
-
-    return GetMap()->isInLineOfSight(x, y, z, ox, oy, oz, GetPhaseMask(), checks, ignoreFlags);
+        start = GetHitSpherePointFor({ obj->GetPositionX(), obj->GetPositionY(), obj->GetPositionZ() + obj->GetCollisionHeight() }, collisionHeight, combatReach);
 }
 
 void WorldObject::GetHitSpherePointFor(Position const& dest, float& x, float& y, float& z, Optional<float> collisionHeight, Optional<float> combatReach) const
@@ -2089,7 +2137,10 @@ void WorldObject::SendMessageToSet(WorldPacket const* data, bool self) const
 void WorldObject::SendMessageToSetInRange(WorldPacket const* data, float dist, bool /*self*/) const
 {
     Acore::MessageDistDeliverer notifier(this, data, dist);
-    notifier.Visit(GetObjectVisibilityContainer().GetVisiblePlayersMap());
+    if (dist != 0.0f && FindMap())
+        notifier.Visit(GetObjectVisibilityContainer().GetVisiblePlayersInRange(dist, FindMap()->GetVisibilityEpoch()));
+    else
+        notifier.Visit(GetObjectVisibilityContainer().GetVisiblePlayersMap());
 }
 
 void WorldObject::SendMessageToSet(WorldPacket const* data, Player const* skipped_rcvr) const
@@ -2259,7 +2310,7 @@ TempSummon* Map::SummonCreature(uint32 entry, Position const& pos, SummonPropert
     summon->InitSummon();
 
     // call MoveInLineOfSight for nearby creatures
-    Acore::AIRelocationNotifier notifier(*summon);
+    Acore::AIRelocationNotifier notifier(*summon, GetVisibilityRange());
     Cell::VisitObjects(summon, notifier, GetVisibilityRange());
 
     return summon;
@@ -2515,6 +2566,20 @@ void WorldObject::GetCreatureListWithEntryInGrid(std::list<Creature*>& creatureL
     Cell::VisitObjects(this, searcher, maxSearchRange);
 }
 
+void WorldObject::GetCreatureListWithEntryInGrid(Acore::FrameList<Creature*>& creatureList, uint32 entry, float maxSearchRange) const
+{
+    Acore::AllCreaturesOfEntryInRange check(this, entry, maxSearchRange);
+    Acore::CreatureListSearcher<Acore::AllCreaturesOfEntryInRange> searcher(this, creatureList, check);
+    Cell::VisitObjects(this, searcher, maxSearchRange);
+}
+
+void WorldObject::GetCreatureListWithEntryInGrid(Acore::FrameList<Creature*>& creatureList, std::vector<uint32> const& entries, float maxSearchRange) const
+{
+    Acore::AllCreaturesMatchingOneEntryInRange check(this, entries, maxSearchRange);
+    Acore::CreatureListSearcher searcher(this, creatureList, check);
+    Cell::VisitObjects(this, searcher, maxSearchRange);
+}
+
 void WorldObject::GetDeadCreatureListInGrid(std::list<Creature*>& creaturedeadList, float maxSearchRange, bool alive /*= false*/) const
 {
     Acore::AllDeadCreaturesInRange check(this, maxSearchRange, alive);
@@ -2994,10 +3059,13 @@ void WorldObject::BuildUpdate(UpdateDataMapType& data_map)
         BuildFieldsUpdate(ToPlayer(), data_map);
 
     // Build update for visible players
-    DoForAllVisiblePlayers([this, &data_map](Player* player)
+    if (HasObserverVisibleChanges())
     {
-        BuildFieldsUpdate(player, data_map);
-    });
+        DoForAllVisiblePlayers([this, &data_map](Player* player)
+        {
+            BuildFieldsUpdate(player, data_map);
+        });
+    }
 
     ClearUpdateMask(false);
 }
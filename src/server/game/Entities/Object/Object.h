@@ -22,8 +22,10 @@
 #include "Common.h"
 #include "DataMap.h"
 #include "EventProcessor.h"
+#include "FrameArena.h"
 #include "G3D/Vector3.h"
 #include "GridDefines.h"
+#include "GridObjectVector.h"
 #include "GridReference.h"
 #include "Map.h"
 #include "ModelIgnoreFlags.h"
@@ -191,6 +193,9 @@ public:
     virtual void BuildUpdate(UpdateDataMapType&) {}
     void BuildFieldsUpdate(Player*, UpdateDataMapType&);
 
+    // true when players other than this one have changed fields to receive
+    [[nodiscard]] bool HasObserverVisibleChanges() const;
+
     void SetFieldNotifyFlag(uint16 flag) { _fieldNotifyFlags |= flag; }
     void RemoveFieldNotifyFlag(uint16 flag) { _fieldNotifyFlags &= ~flag; }
 
@@ -244,6 +249,8 @@ protected:
     bool _LoadIntoDataField(std::string const& data, uint32 startOffset, uint32 count);
 
     uint32 GetUpdateFieldData(Player const* target, uint32*& flags) const;
+    // fields sent to a target seeing visibleFlag, changed ones for UPDATETYPE_VALUES and set ones on creation
+    void BuildValuesUpdateMask(uint8 updateType, uint32 const* flags, uint32 visibleFlag, UpdateMask& updateMask) const;
 
     void BuildMovementUpdate(ByteBuffer* data, uint16 flags) const;
     virtual void BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target);
@@ -357,22 +364,33 @@ template<class T>
 class GridObject
 {
 public:
+    ~GridObject()
+    {
+        if (IsInGrid())
+            RemoveFromGrid();
+    }
     bool IsInGrid() const
     {
-        return _gridRef.isValid();
+        return _gridLink.Container != nullptr;
     }
-    void AddToGrid(GridRefMgr<T>& m)
+    void AddToGrid(GridObjectVector<T>& m)
     {
         ASSERT(!IsInGrid());
-        _gridRef.link(&m, (T*)this);
+        m.Insert((T*)this, _gridLink);
     }
     void RemoveFromGrid()
     {
         ASSERT(IsInGrid());
-        _gridRef.unlink();
+        _gridLink.Container->Erase(_gridLink.Index);
+    }
+    // refreshes the position the grid cell keeps for range searches
+    void UpdateGridPosition()
+    {
+        if (IsInGrid())
+            _gridLink.Container->UpdatePosition(_gridLink.Index);
     }
 private:
-    GridReference<T> _gridRef;
+    GridObjectVectorLink<T> _gridLink;
 };
 
 template <class T_VALUES, class T_FLAGS, class FLAG_TYPE, uint8 ARRAY_SIZE>
@@ -544,6 +562,10 @@ public:
     bool IsWithinDistInMap(WorldObject const* obj, float dist2compare, bool is3D = true, bool incOwnRadius = true, bool incTargetRadius = true) const;
     [[nodiscard]] bool IsWithinLOS(float x, float y, float z, VMAP::ModelIgnoreFlags ignoreFlags = VMAP::ModelIgnoreFlags::Nothing, LineOfSightChecks checks = LINEOFSIGHT_ALL_CHECKS) const;
     [[nodiscard]] bool IsWithinLOSInMap(WorldObject const* obj, VMAP::ModelIgnoreFlags ignoreFlags = VMAP::ModelIgnoreFlags::Nothing, LineOfSightChecks checks = LINEOFSIGHT_ALL_CHECKS, Optional<float> collisionHeight = { }, Optional<float> combatReach = { }) const;
+    /// Segment tested by IsWithinLOS, start lies on this object
+    void GetLineOfSightSegment(float x, float y, float z, Position& start, Position& end) const;
+    /// Segment tested by IsWithinLOSInMap, start lies on this object
+    void GetLineOfSightSegment(WorldObject const* obj, Position& start, Position& end, Optional<float> collisionHeight = { }, Optional<float> combatReach = { }) const;
     [[nodiscard]] Position GetHitSpherePointFor(Position const& dest, Optional<float> collisionHeight = { }, Optional<float> combatReach = { }) const;
     void GetHitSpherePointFor(Position const& dest, float& x, float& y, float& z, Optional<float> collisionHeight = { }, Optional<float> combatReach = { }) const;
     bool GetDistanceOrder(WorldObject const* obj1, WorldObject const* obj2, bool is3D = true) const;
@@ -640,6 +662,9 @@ public:
     void GetGameObjectListWithEntryInGrid(std::list<GameObject*>& gameobjectList, std::vector<uint32> const& entries, float maxSearchRange) const;
     void GetCreatureListWithEntryInGrid(std::list<Creature*>& lList, uint32 uiEntry, float fMaxSearchRange) const;
     void GetCreatureListWithEntryInGrid(std::list<Creature*>& creatureList, std::vector<uint32> const& entries, float maxSearchRange) const;
+    // same searches into a container of the frame arena, for results which don't outlive the caller
+    void GetCreatureListWithEntryInGrid(Acore::FrameList<Creature*>& creatureList, uint32 entry, float maxSearchRange) const;
+    void GetCreatureListWithEntryInGrid(Acore::FrameList<Creature*>& creatureList, std::vector<uint32> const& entries, float maxSearchRange) const;
     void GetDeadCreatureListInGrid(std::list<Creature*>& lList, float maxSearchRange, bool alive = false) const;
 
     virtual void UpdateObjectVisibility(bool forced = true, bool fromUpdate = false);
@@ -661,6 +686,9 @@ public:
     [[nodiscard]] bool NotifyExecuted(uint16 f) const { return m_executed_notifies & f;}
     void SetNotified(uint16 f) { m_executed_notifies |= f;}
     void ResetAllNotifies() { m_notifyflags = 0; m_executed_notifies = 0; }
+    // Map::GetVisibilityEpoch of the last relocation, incremental visibility updates check objects moved since their last pass
+    [[nodiscard]] uint32 GetMoveVisibilityEpoch() const { return m_moveVisibilityEpoch; }
+    void SetMoveVisibilityEpoch(uint32 epoch) { m_moveVisibilityEpoch = epoch; }
 
     [[nodiscard]] bool isActiveObject() const { return m_isActive; }
     void setActive(bool isActiveObject);
@@ -768,6 +796,7 @@ private:
 
     uint16 m_notifyflags;
     uint16 m_executed_notifies;
+    uint32 m_moveVisibilityEpoch;
 
     virtual bool _IsWithinDist(WorldObject const* obj, float dist2compare, bool is3D, bool incOwnRadius = true, bool incTargetRadius = true) const;
 
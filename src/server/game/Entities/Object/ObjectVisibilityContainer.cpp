@@ -28,7 +28,7 @@
 */
 
 ObjectVisibilityContainer::ObjectVisibilityContainer(WorldObject* selfObject) :
-    _selfObject(selfObject)
+    _selfObject(selfObject), _visiblePlayersVersion(0)
 {
 }
 
@@ -58,6 +58,7 @@ void ObjectVisibilityContainer::CleanVisibilityReferences()
     }
 
     _visiblePlayersMap.clear();
+    ++_visiblePlayersVersion;
 }
 
 void ObjectVisibilityContainer::LinkWorldObjectVisibility(WorldObject* worldObject)
@@ -98,9 +99,32 @@ VisibleWorldObjectsMap::iterator ObjectVisibilityContainer::UnlinkVisibilityFrom
 VisiblePlayersMap::iterator ObjectVisibilityContainer::UnlinkVisibilityFromWorldObject(Player* player, VisiblePlayersMap::iterator itr)
 {
     player->GetObjectVisibilityContainer().DirectRemoveVisibilityReference(_selfObject->GetGUID());
+    ++_visiblePlayersVersion;
     return _visiblePlayersMap.erase(itr);
 }
 
+std::vector<Player*> const& ObjectVisibilityContainer::GetVisiblePlayersInRange(float dist, uint32 epoch) const
+{
+    if (!_playersInRange)
+        _playersInRange = std::make_unique<PlayersInRange>();
+
+    PlayersInRange& cache = *_playersInRange;
+    if (cache.Epoch == epoch && cache.Version == _visiblePlayersVersion && cache.Dist == dist)
+        return cache.Players;
+
+    cache.Dist = dist;
+    cache.Epoch = epoch;
+    cache.Version = _visiblePlayersVersion;
+    cache.Players.clear();
+
+    float const distSq = dist * dist;
+    for (auto const& kvPair : _visiblePlayersMap)
+        if (kvPair.second->m_seer->GetExactDist2dSq(_selfObject) <= distSq)
+            cache.Players.push_back(kvPair.second);
+
+    return cache.Players;
+}
+
 void ObjectVisibilityContainer::DirectRemoveVisibilityReference(ObjectGuid guid)
 {
     ASSERT(_visibleWorldObjectsMap);
@@ -110,9 +134,11 @@ void ObjectVisibilityContainer::DirectRemoveVisibilityReference(ObjectGuid guid)
 void ObjectVisibilityContainer::DirectInsertVisiblePlayerReference(Player* player)
 {
     _visiblePlayersMap.insert(std::make_pair(player->GetGUID(), player));
+    ++_visiblePlayersVersion;
 }
 
 void ObjectVisibilityContainer::DirectRemoveVisiblePlayerReference(ObjectGuid guid)
 {
     _visiblePlayersMap.erase(guid);
+    ++_visiblePlayersVersion;
 }
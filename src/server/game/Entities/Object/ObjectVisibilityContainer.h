@@ -19,15 +19,16 @@
 #define _OBJECTVISIBILITYCONTAINER_H
 
 #include "Common.h"
+#include "FlatHashMap.h"
 #include "ObjectGuid.h"
 #include <memory>
-#include <unordered_map>
+#include <vector>
 
 class Player;
 class WorldObject;
 
-typedef std::unordered_map<ObjectGuid, WorldObject*> VisibleWorldObjectsMap;
-typedef std::unordered_map<ObjectGuid, Player*> VisiblePlayersMap;
+typedef Acore::FlatHashMap<ObjectGuid, WorldObject*> VisibleWorldObjectsMap;
+typedef Acore::FlatHashMap<ObjectGuid, Player*> VisiblePlayersMap;
 
 // Class that manages the visibility containers of a worldobject
 class ObjectVisibilityContainer
@@ -54,6 +55,11 @@ public:
     VisiblePlayersMap& GetVisiblePlayersMap() { return _visiblePlayersMap; }
     VisiblePlayersMap const& GetVisiblePlayersMap() const { return _visiblePlayersMap; }
 
+    // Returns the players who can see us whose viewpoint is within dist of us. The list is kept
+    // for the next broadcasts at the same dist during the same map update (epoch, Map::GetVisibilityEpoch)
+    // as long as the players who can see us do not change
+    std::vector<Player*> const& GetVisiblePlayersInRange(float dist, uint32 epoch) const;
+
     // Returns a list of all worldobjects who we can see
     // Warning: This is for player objects only, all other objects will return a nullptr
     VisibleWorldObjectsMap* GetVisibleWorldObjectsMap()
@@ -96,6 +102,18 @@ private:
     // List of players who are currently able to see this worldobject.
     // All worldobjects will contain this map
     VisiblePlayersMap _visiblePlayersMap;
+    uint32 _visiblePlayersVersion;         // changes with _visiblePlayersMap
+
+    struct PlayersInRange
+    {
+        float Dist = 0.0f;
+        uint32 Epoch = 0;
+        uint32 Version = 0;
+        std::vector<Player*> Players;
+    };
+
+    // Only allocated by the objects broadcasting in range
+    mutable std::unique_ptr<PlayersInRange> _playersInRange;
 };
 
 #endif
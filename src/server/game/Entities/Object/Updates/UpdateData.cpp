@@ -45,6 +45,12 @@ void UpdateData::AddUpdateBlock(const UpdateData& block)
     m_blockCount += block.m_blockCount;
 }
 
+ByteBuffer& UpdateData::BeginUpdateBlock()
+{
+    ++m_blockCount;
+    return m_data;
+}
+
 bool UpdateData::BuildPacket(WorldPacket& packet)
 {
     ASSERT(packet.empty());
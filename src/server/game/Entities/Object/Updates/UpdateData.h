@@ -56,6 +56,8 @@ public:
     void AddOutOfRangeGUID(ObjectGuid guid);
     void AddUpdateBlock(const ByteBuffer& block);
     void AddUpdateBlock(const UpdateData& block);
+    // Counts a new block and returns the buffer it has to be written to
+    ByteBuffer& BeginUpdateBlock();
     bool BuildPacket(WorldPacket& packet);
     [[nodiscard]] bool HasData() const { return m_blockCount > 0 || !m_outOfRangeGUIDs.empty(); }
     void Clear();
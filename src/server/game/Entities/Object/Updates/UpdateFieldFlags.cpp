@@ -16,6 +16,8 @@
  */
 
 #include "UpdateFieldFlags.h"
+#include "UpdateMask.h"
+#include <array>
 
 uint32 ItemUpdateFieldFlags[CONTAINER_END] =
 {
@@ -1566,3 +1568,90 @@ uint32 CorpseUpdateFieldFlags[CORPSE_END] =
     UF_FLAG_DYNAMIC,                                        // CORPSE_FIELD_DYNAMIC_FLAGS
     UF_FLAG_NONE,                                           // CORPSE_FIELD_PAD
 };
+
+namespace
+{
+    constexpr uint32 UF_FLAG_BIT_COUNT = 9;
+
+    // one mask per flag bit of a table, built once so that visibility checks are word operations
+    struct UpdateFieldFlagMasks
+    {
+        UpdateFieldFlagMasks(uint32 const* flags, uint32 count) : Flags(flags), Count(count)
+        {
+            for (uint32 bit = 0; bit < UF_FLAG_BIT_COUNT; ++bit)
+            {
+                Masks[bit].SetCount(count);
+                for (uint32 index = 0; index < count; ++index)
+                    if (flags[index] & (1 << bit))
+                        Masks[bit].SetBit(index);
+            }
+        }
+
+        uint32 const* Flags;
+        uint32 Count;
+        std::array<UpdateMask, UF_FLAG_BIT_COUNT> Masks;
+    };
+
+    UpdateFieldFlagMasks const& GetUpdateFieldFlagMasks(uint32 const* flags)
+    {
+        static UpdateFieldFlagMasks const tables[] =
+        {
+            { ItemUpdateFieldFlags, CONTAINER_END },
+            { UnitUpdateFieldFlags, PLAYER_END },
+            { GameObjectUpdateFieldFlags, GAMEOBJECT_END },
+            { DynamicObjectUpdateFieldFlags, DYNAMICOBJECT_END },
+            { CorpseUpdateFieldFlags, CORPSE_END }
+        };
+
+        for (UpdateFieldFlagMasks const& table : tables)
+            if (table.Flags == flags)
+                return table;
+
+        ABORT("Unknown update field flags table");
+    }
+}
+
+void BuildUpdateFieldFlagMask(uint32 const* flags, uint32 count, uint32 flagMask, UpdateMask& mask)
+{
+    UpdateFieldFlagMasks const& table = GetUpdateFieldFlagMasks(flags);
+    ASSERT(count <= table.Count);
+
+    mask.SetCount(count);
+    UpdateMask::ClientUpdateMaskType* blocks = mask.GetBlocks();
+    uint32 const blockCount = mask.GetBlockCount();
+    for (uint32 bit = 0; bit < UF_FLAG_BIT_COUNT; ++bit)
+    {
+        if (!(flagMask & (1 << bit)))
+            continue;
+
+        UpdateMask::ClientUpdateMaskType const* bits = table.Masks[bit].GetBlocks();
+        for (uint32 i = 0; i < blockCount; ++i)
+            blocks[i] |= bits[i];
+    }
+
+    // units use the first UNIT_END fields of the player table
+    if (uint32 tail = count % UpdateMask::CLIENT_UPDATE_MASK_BITS)
+        blocks[blockCount - 1] &= (UpdateMask::ClientUpdateMaskType(1) << tail) - 1;
+}
+
+uint32 GetUpdateFieldFlagsOfMask(uint32 const* flags, UpdateMask const& mask)
+{
+    UpdateFieldFlagMasks const& table = GetUpdateFieldFlagMasks(flags);
+    ASSERT(mask.GetCount() <= table.Count);
+
+    UpdateMask::ClientUpdateMaskType const* blocks = mask.GetBlocks();
+    uint32 const blockCount = mask.GetBlockCount();
+    uint32 result = UF_FLAG_NONE;
+    for (uint32 bit = 0; bit < UF_FLAG_BIT_COUNT; ++bit)
+    {
+        UpdateMask::ClientUpdateMaskType const* bits = table.Masks[bit].GetBlocks();
+        UpdateMask::ClientUpdateMaskType any = 0;
+        for (uint32 i = 0; i < blockCount; ++i)
+            any |= blocks[i] & bits[i];
+
+        if (any)
+            result |= 1 << bit;
+    }
+
+    return result;
+}
@@ -21,6 +21,8 @@
 #include "Define.h"
 #include "UpdateFields.h"
 
+class UpdateMask;
+
 enum UpdatefieldFlags
 {
     UF_FLAG_NONE         = 0x000,
@@ -41,4 +43,9 @@ extern uint32 GameObjectUpdateFieldFlags[GAMEOBJECT_END];
 extern uint32 DynamicObjectUpdateFieldFlags[DYNAMICOBJECT_END];
 extern uint32 CorpseUpdateFieldFlags[CORPSE_END];
 
+// Resizes mask to count fields and sets the fields of one of the tables above having any flag of flagMask
+void BuildUpdateFieldFlagMask(uint32 const* flags, uint32 count, uint32 flagMask, UpdateMask& mask);
+// Union of the flags of the fields set in mask
+uint32 GetUpdateFieldFlagsOfMask(uint32 const* flags, UpdateMask const& mask);
+
 #endif // _UPDATEFIELDFLAGS_H
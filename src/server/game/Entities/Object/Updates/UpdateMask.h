@@ -20,6 +20,7 @@
 
 #include "ByteBuffer.h"
 #include "Errors.h"
+#include <bit>
 
 class UpdateMask
 {
@@ -32,51 +33,62 @@ public:
         CLIENT_UPDATE_MASK_BITS = sizeof(ClientUpdateMaskType) * 8,
     };
 
+    // blocks stored in the mask itself, enough for every object type except players
+    static constexpr uint32 INLINE_BLOCK_COUNT = 8;
+
     UpdateMask()  = default;
 
     UpdateMask(UpdateMask const& right)
     {
         SetCount(right.GetCount());
-        memcpy(_bits, right._bits, sizeof(uint8) * _blockCount * 32);
+        memcpy(_bits, right._bits, sizeof(ClientUpdateMaskType) * _blockCount);
     }
 
-    ~UpdateMask() { delete[] _bits; }
+    ~UpdateMask() { FreeBits(); }
+
+    // one bit per field, stored in the blocks the client reads
+    void SetBit(uint32 index) { _bits[index / CLIENT_UPDATE_MASK_BITS] |= ClientUpdateMaskType(1) << (index % CLIENT_UPDATE_MASK_BITS); }
+    void UnsetBit(uint32 index) { _bits[index / CLIENT_UPDATE_MASK_BITS] &= ~(ClientUpdateMaskType(1) << (index % CLIENT_UPDATE_MASK_BITS)); }
+    [[nodiscard]] bool GetBit(uint32 index) const { return (_bits[index / CLIENT_UPDATE_MASK_BITS] >> (index % CLIENT_UPDATE_MASK_BITS)) & 1; }
 
-    void SetBit(uint32 index) { _bits[index] = 1; }
-    void UnsetBit(uint32 index) { _bits[index] = 0; }
-    [[nodiscard]] bool GetBit(uint32 index) const { return _bits[index] != 0; }
+    // calls func(index) for each set bit, in increasing order; func may unset the bits it visits
+    template<class Func>
+    void ForEachSetBit(Func&& func) const
+    {
+        for (uint32 i = 0; i < _blockCount; ++i)
+            for (ClientUpdateMaskType block = _bits[i]; block; block &= block - 1)
+                func(i * CLIENT_UPDATE_MASK_BITS + uint32(std::countr_zero(block)));
+    }
 
     void AppendToPacket(ByteBuffer* data)
     {
         for (uint32 i = 0; i < GetBlockCount(); ++i)
-        {
-            ClientUpdateMaskType maskPart = 0;
-            for (uint32 j = 0; j < CLIENT_UPDATE_MASK_BITS; ++j)
-                if (_bits[CLIENT_UPDATE_MASK_BITS * i + j])
-                    maskPart |= 1 << j;
-
-            *data << maskPart;
-        }
+            *data << _bits[i];
     }
 
     [[nodiscard]] uint32 GetBlockCount() const { return _blockCount; }
     [[nodiscard]] uint32 GetCount() const { return _fieldCount; }
+    [[nodiscard]] ClientUpdateMaskType* GetBlocks() { return _bits; }
+    [[nodiscard]] ClientUpdateMaskType const* GetBlocks() const { return _bits; }
 
     void SetCount(uint32 valuesCount)
     {
-        delete[] _bits;
+        uint32 const blockCount = (valuesCount + CLIENT_UPDATE_MASK_BITS - 1) / CLIENT_UPDATE_MASK_BITS;
+        if (blockCount != _blockCount || !_bits)
+        {
+            FreeBits();
+            _bits = blockCount > INLINE_BLOCK_COUNT ? new ClientUpdateMaskType[blockCount] : _inlineBits;
+        }
 
         _fieldCount = valuesCount;
-        _blockCount = (valuesCount + CLIENT_UPDATE_MASK_BITS - 1) / CLIENT_UPDATE_MASK_BITS;
-
-        _bits = new uint8[_blockCount * CLIENT_UPDATE_MASK_BITS];
-        memset(_bits, 0, sizeof(uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+        _blockCount = blockCount;
+        memset(_bits, 0, sizeof(ClientUpdateMaskType) * _blockCount);
     }
 
     void Clear()
     {
         if (_bits)
-            memset(_bits, 0, sizeof(uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+            memset(_bits, 0, sizeof(ClientUpdateMaskType) * _blockCount);
     }
 
     UpdateMask& operator=(UpdateMask const& right)
@@ -85,15 +97,15 @@ public:
             return *this;
 
         SetCount(right.GetCount());
-        memcpy(_bits, right._bits, sizeof(uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+        memcpy(_bits, right._bits, sizeof(ClientUpdateMaskType) * _blockCount);
         return *this;
     }
 
     UpdateMask& operator&=(UpdateMask const& right)
     {
         ASSERT(right.GetCount() <= GetCount());
-        for (uint32 i = 0; i < _fieldCount; ++i)
-            _bits[i] &= right._bits[i];
+        for (uint32 i = 0; i < _blockCount; ++i)
+            _bits[i] &= i < right._blockCount ? right._bits[i] : 0;
 
         return *this;
     }
@@ -101,7 +113,7 @@ public:
     UpdateMask& operator|=(UpdateMask const& right)
     {
         ASSERT(right.GetCount() <= GetCount());
-        for (uint32 i = 0; i < _fieldCount; ++i)
+        for (uint32 i = 0; i < right._blockCount; ++i)
             _bits[i] |= right._bits[i];
 
         return *this;
@@ -115,9 +127,18 @@ public:
     }
 
 private:
+    void FreeBits()
+    {
+        if (_bits != _inlineBits)
+            delete[] _bits;
+
+        _bits = nullptr;
+    }
+
     uint32 _fieldCount{0};
     uint32 _blockCount{0};
-    uint8* _bits{nullptr};
+    ClientUpdateMaskType* _bits{nullptr};
+    ClientUpdateMaskType _inlineBits[INLINE_BLOCK_COUNT];
 };
 
 #endif
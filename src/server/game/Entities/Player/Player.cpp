@@ -197,6 +197,10 @@ Player::Player(WorldSession* session): Unit(), m_mover(this)
 
     m_needZoneUpdate = false;
 
+    _visibilityPassEpoch = 0;
+    _visibilityPassAreaId = 0;
+    _visibilityFullPassTime = 0;
+
     m_additionalSaveTimer = 0;
     m_additionalSaveMask = 0;
     m_hostileReferenceCheckTimer = 15000;
@@ -210,6 +214,7 @@ Player::Player(WorldSession* session): Unit(), m_mover(this)
     // group is initialized in the reference constructor
     SetGroupInvite(nullptr);
     m_groupUpdateMask = 0;
+    m_groupUpdateDelay = 0;
     m_auraRaidUpdateMask = 0;
     m_bPassOnGroupLoot = false;
 
@@ -237,6 +242,7 @@ Player::Player(WorldSession* session): Unit(), m_mover(this)
 
     m_DailyQuestChanged = false;
     m_lastDailyQuestTime = 0;
+    m_questGiverStatusGeneration = 0;
 
     for (uint8 i = 0; i < MAX_TIMERS; i++)
         m_MirrorTimer[i] = DISABLED_MIRROR_TIMER;
@@ -284,6 +290,7 @@ Player::Player(WorldSession* session): Unit(), m_mover(this)
     ////////////////////Rest System/////////////////////
 
     m_mailsUpdated = false;
+    m_mailItemsLoaded = false;
     unReadMails = 0;
     m_nextMailDelivereTime = time_t(0);
 
@@ -329,6 +336,9 @@ Player::Player(WorldSession* session): Unit(), m_mover(this)
     m_baseManaRegen = 0;
     m_baseHealthRegen = 0;
     m_spellPenetrationItemMod = 0;
+    m_statUpdateBatchDepth = 0;
+    m_deferredStatDependents = 0;
+    m_deferredStatRatings = 0;
 
     // Honor System
     m_lastHonorUpdateTime = GameTime::GetGameTime().count();
@@ -1561,6 +1571,9 @@ bool Player::TeleportTo(uint32 mapid, float x, float y, float z, float orientati
 
             if (!GetSession()->PlayerLogout())
             {
+                // the instance is created once the client acknowledges the teleport, query its saved state meanwhile
+                sMapMgr->PrefetchInstanceRespawnTimes(mapid, this);
+
                 // send transfer packets
                 WorldPacket data(SMSG_TRANSFER_PENDING, 4 + 4 + 4);
                 data << uint32(mapid);
@@ -2443,6 +2456,8 @@ void Player::GiveLevel(uint8 level)
     if (!sScriptMgr->OnPlayerCanGiveLevel(this, level))
         return;
 
+    InvalidateQuestGiverStatusCache();
+
     if (Guild* guild = GetGuild())
         guild->UpdateMemberData(this, GUILD_MEMBER_DATA_LEVEL, level);
 
@@ -5334,6 +5349,8 @@ void Player::SetSkill(uint16 id, uint16 step, uint16 newVal, uint16 maxVal)
     if (!id)
         return;
 
+    InvalidateQuestGiverStatusCache();
+
     uint16 currVal;
     SkillStatusMap::iterator itr = mSkillStatus.find(id);
 
@@ -5680,7 +5697,10 @@ void Player::SendMessageToSetInRange(WorldPacket const* data, float dist, bool s
         SendDirectMessage(data);
 
     Acore::MessageDistDeliverer notifier(this, data, dist);
-    notifier.Visit(GetObjectVisibilityContainer().GetVisiblePlayersMap());
+    if (dist != 0.0f && FindMap())
+        notifier.Visit(GetObjectVisibilityContainer().GetVisiblePlayersInRange(dist, FindMap()->GetVisibilityEpoch()));
+    else
+        notifier.Visit(GetObjectVisibilityContainer().GetVisiblePlayersMap());
 }
 
 void Player::SendMessageToSet(WorldPacket const* data, Player const* skipped_rcvr) const
@@ -6628,6 +6648,8 @@ void Player::_ApplyItemBonuses(ItemTemplate const* proto, uint8 slot, bool apply
 
     uint32 ScalingStatValue = proto->ScalingStatValue > 0 ? proto->ScalingStatValue : CustomScalingStatValue;
 
+    StatUpdateBatch statUpdateBatch(this);
+
     if (ssd && ssd_level > ssd->MaxLevel)
         ssd_level = ssd->MaxLevel;
 
@@ -7962,7 +7984,7 @@ void Player::SendLoot(ObjectGuid guid, LootType loot_type)
 
         permission = OWNER_PERMISSION;
 
-        loot = &item->loot;
+        loot = &item->GetLoot();
 
         // Xinef: Store container id
         loot->containerGUID = item->GetGUID();
@@ -11735,12 +11757,22 @@ void Player::SendInitialPacketsAfterAddToMap()
         SendRaidDifficulty(GetGroup() != nullptr);
 }
 
-void Player::SendUpdateToOutOfRangeGroupMembers()
+void Player::SendUpdateToOutOfRangeGroupMembers(uint32 diff)
 {
+    m_groupUpdateDelay = m_groupUpdateDelay > diff ? m_groupUpdateDelay - diff : 0;
+
     if (m_groupUpdateMask == GROUP_UPDATE_FLAG_NONE)
         return;
+
+    // merge the changes until the interval passed, the members should see a status change right away
+    if (m_groupUpdateDelay && !(m_groupUpdateMask & GROUP_UPDATE_FLAG_STATUS))
+        return;
+
     if (Group* group = GetGroup())
+    {
         group->UpdatePlayerOutOfRange(this);
+        m_groupUpdateDelay = group->GetMemberStatsInterval();
+    }
 
     m_groupUpdateMask = GROUP_UPDATE_FLAG_NONE;
     m_auraRaidUpdateMask = 0;
@@ -12135,6 +12167,8 @@ void Player::SetDailyQuestStatus(uint32 quest_id)
             m_lastDailyQuestTime = GameTime::GetGameTime().count();
             m_DailyQuestChanged = true;
         }
+
+        InvalidateQuestGiverStatusCache();
     }
 }
 
@@ -12158,6 +12192,7 @@ void Player::SetWeeklyQuestStatus(uint32 quest_id)
 {
     m_weeklyquests.insert(quest_id);
     m_WeeklyQuestChanged = true;
+    InvalidateQuestGiverStatusCache();
 }
 
 void Player::SetSeasonalQuestStatus(uint32 quest_id)
@@ -12168,12 +12203,14 @@ void Player::SetSeasonalQuestStatus(uint32 quest_id)
 
     m_seasonalquests[quest->GetEventIdForQuest()].insert(quest_id);
     m_SeasonalQuestChanged = true;
+    InvalidateQuestGiverStatusCache();
 }
 
 void Player::SetMonthlyQuestStatus(uint32 quest_id)
 {
     m_monthlyquests.insert(quest_id);
     m_MonthlyQuestChanged = true;
+    InvalidateQuestGiverStatusCache();
 }
 
 void Player::ResetDailyQuestStatus()
@@ -12186,6 +12223,7 @@ void Player::ResetDailyQuestStatus()
     // DB data deleted in caller
     m_DailyQuestChanged = false;
     m_lastDailyQuestTime = 0;
+    InvalidateQuestGiverStatusCache();
 }
 
 void Player::ResetWeeklyQuestStatus()
@@ -12196,6 +12234,7 @@ void Player::ResetWeeklyQuestStatus()
     m_weeklyquests.clear();
     // DB data deleted in caller
     m_WeeklyQuestChanged = false;
+    InvalidateQuestGiverStatusCache();
 }
 
 void Player::ResetSeasonalQuestStatus(uint16 event_id)
@@ -12206,6 +12245,7 @@ void Player::ResetSeasonalQuestStatus(uint16 event_id)
     m_seasonalquests.erase(event_id);
     // DB data deleted in caller
     m_SeasonalQuestChanged = false;
+    InvalidateQuestGiverStatusCache();
 }
 
 void Player::ResetMonthlyQuestStatus()
@@ -12216,6 +12256,7 @@ void Player::ResetMonthlyQuestStatus()
     m_monthlyquests.clear();
     // DB data deleted in caller
     m_MonthlyQuestChanged = false;
+    InvalidateQuestGiverStatusCache();
 }
 
 Battleground* Player::GetBattleground(bool create) const
@@ -14723,6 +14764,12 @@ void Player::_SaveEntryPoint(CharacterDatabaseTransaction trans)
     if (!mEntry)
         return;
 
+    // the row is rewritten as a whole, skip it while it matches the database
+    if (m_savedEntryPointData == m_entryPointData)
+        return;
+
+    m_savedEntryPointData = m_entryPointData;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYER_ENTRY_POINT);
     stmt->SetData(0, GetGUID().GetCounter());
     trans->Append(stmt);
@@ -14778,7 +14825,7 @@ void Player::SendClearCooldown(uint32 spell_id, Unit* target)
     SendDirectMessage(&data);
 
     if (target == this && NeedSendSpectatorData())
-        ArenaSpectator::SendCommand_UInt32Value(FindMap(), GetGUID(), "RCD", spell_id);
+        ArenaSpectator::SendCommand_UInt32Value(FindMap(), GetGUID(), "RCD", spell_id, false);
 }
 
 void Player::ResetMap()
@@ -15897,6 +15944,8 @@ void Player::_LoadInstanceTimeRestrictions(PreparedQueryResult result)
         Field* fields = result->Fetch();
         _instanceResetTimes.insert(InstanceTimeMap::value_type(fields[0].Get<uint32>(), fields[1].Get<uint64>()));
     } while (result->NextRow());
+
+    _savedInstanceResetTimes = _instanceResetTimes;
 }
 
 void Player::_LoadBrewOfTheMonth(PreparedQueryResult result)
@@ -15990,9 +16039,11 @@ void Player::_LoadPetStable(uint8 petStableSlots, PreparedQueryResult result)
 
 void Player::_SaveInstanceTimeRestrictions(CharacterDatabaseTransaction trans)
 {
-    if (_instanceResetTimes.empty())
+    if (_instanceResetTimes.empty() || _instanceResetTimes == _savedInstanceResetTimes)
         return;
 
+    _savedInstanceResetTimes = _instanceResetTimes;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES);
     stmt->SetData(0, GetSession()->GetAccountId());
     trans->Append(stmt);
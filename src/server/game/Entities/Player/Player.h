@@ -65,6 +65,11 @@ class PlayerSocial;
 class SpellCastTargets;
 class UpdateMask;
 
+namespace Acore
+{
+    struct VisibilityPassDelta;
+}
+
 typedef std::deque<Mail*> PlayerMails;
 typedef void(*bgZoneRef)(Battleground*, WorldPackets::WorldState::InitWorldStates&);
 
@@ -604,6 +609,16 @@ typedef std::unordered_set<uint32> RewardedQuestSet;
 //               quest,  keep
 typedef std::map<uint32, bool> QuestStatusSaveMap;
 
+// objective of a quest in the log, indexed by the creature or item it requires
+struct QuestObjectiveTarget
+{
+    uint32 QuestId;
+    uint8 Objective;
+};
+
+//                         entry
+typedef std::unordered_map<uint32, std::vector<QuestObjectiveTarget>> QuestObjectiveIndex;
+
 enum QuestSlotOffsets
 {
     QUEST_ID_OFFSET     = 0,
@@ -857,7 +872,6 @@ enum PlayerLoginQueryIndex
     PLAYER_LOGIN_QUERY_LOAD_INVENTORY                    = 8,
     PLAYER_LOGIN_QUERY_LOAD_ACTIONS                      = 9,
     PLAYER_LOGIN_QUERY_LOAD_MAILS                        = 10,
-    PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS                   = 11,
     PLAYER_LOGIN_QUERY_LOAD_SOCIAL_LIST                  = 13,
     PLAYER_LOGIN_QUERY_LOAD_HOME_BIND                    = 14,
     PLAYER_LOGIN_QUERY_LOAD_SPELL_COOLDOWNS              = 15,
@@ -1048,6 +1062,12 @@ struct EntryPointData
 
     void ClearTaxiPath() { taxiPath.fill(0); }
     [[nodiscard]] bool HasTaxiPath() const { return taxiPath[0] && taxiPath[1]; }
+
+    [[nodiscard]] bool operator==(EntryPointData const& right) const
+    {
+        return mountSpell == right.mountSpell && taxiPath == right.taxiPath &&
+            joinPos.GetMapId() == right.joinPos.GetMapId() && joinPos == right.joinPos;
+    }
 };
 
 struct PendingSpellCastRequest
@@ -1464,6 +1484,7 @@ public:
     void RemoveRewardedQuest(uint32 questId, bool update = true);
     void SendQuestUpdate(uint32 questId);
     QuestGiverStatus GetQuestDialogStatus(Object* questGiver);
+    void InvalidateQuestGiverStatusCache() { m_questGiverStatusCache.clear(); }
     float GetQuestRate(bool isDFQuest = false);
     void SetDailyQuestStatus(uint32 quest_id);
     bool IsDailyQuestDone(uint32 quest_id);
@@ -1480,14 +1501,7 @@ public:
     [[nodiscard]] uint32 GetQuestSlotState(uint16 slot)   const { return GetUInt32Value(PLAYER_QUEST_LOG_1_1 + slot * MAX_QUEST_OFFSET + QUEST_STATE_OFFSET); }
     [[nodiscard]] uint16 GetQuestSlotCounter(uint16 slot, uint8 counter) const { return (uint16)(GetUInt64Value(PLAYER_QUEST_LOG_1_1 + slot * MAX_QUEST_OFFSET + QUEST_COUNTS_OFFSET) >> (counter * 16)); }
     [[nodiscard]] uint32 GetQuestSlotTime(uint16 slot)    const { return GetUInt32Value(PLAYER_QUEST_LOG_1_1 + slot * MAX_QUEST_OFFSET + QUEST_TIME_OFFSET); }
-    void SetQuestSlot(uint16 slot, uint32 quest_id, uint32 timer = 0)
-    {
-        SetUInt32Value(PLAYER_QUEST_LOG_1_1 + slot * MAX_QUEST_OFFSET + QUEST_ID_OFFSET, quest_id);
-        SetUInt32Value(PLAYER_QUEST_LOG_1_1 + slot * MAX_QUEST_OFFSET + QUEST_STATE_OFFSET, 0);
-        SetUInt32Value(PLAYER_QUEST_LOG_1_1 + slot * MAX_QUEST_OFFSET + QUEST_COUNTS_OFFSET, 0);
-        SetUInt32Value(PLAYER_QUEST_LOG_1_1 + slot * MAX_QUEST_OFFSET + QUEST_COUNTS_OFFSET + 1, 0);
-        SetUInt32Value(PLAYER_QUEST_LOG_1_1 + slot * MAX_QUEST_OFFSET + QUEST_TIME_OFFSET, timer);
-    }
+    void SetQuestSlot(uint16 slot, uint32 quest_id, uint32 timer = 0);
     void SetQuestSlotCounter(uint16 slot, uint8 counter, uint16 count)
     {
         uint64 val = GetUInt64Value(PLAYER_QUEST_LOG_1_1 + slot * MAX_QUEST_OFFSET + QUEST_COUNTS_OFFSET);
@@ -1587,6 +1601,7 @@ public:
     static void DeleteOldRecoveryItems(uint32 keepDays);
 
     bool m_mailsUpdated;
+    bool m_mailItemsLoaded;                             // mailed items are loaded at the first mailbox interaction
 
     void SetBindPoint(ObjectGuid guid);
     void SendTalentWipeConfirm(ObjectGuid guid);
@@ -1642,6 +1657,7 @@ public:
     Mail* GetMail(uint32 id);
 
     [[nodiscard]] PlayerMails const& GetMails() const { return m_mail; }
+    void LoadMailedItems();
     void SendItemRetrievalMail(uint32 itemEntry, uint32 count); // Item retrieval mails sent by The Postmaster (34337)
     void SendItemRetrievalMail(std::vector<std::pair<uint32, uint32>> mailItems); // Item retrieval mails sent by The Postmaster (34337)
 
@@ -1878,7 +1894,7 @@ public:
     void UninviteFromGroup();
     static void RemoveFromGroup(Group* group, ObjectGuid guid, RemoveMethod method = GROUP_REMOVEMETHOD_DEFAULT, ObjectGuid kicker = ObjectGuid::Empty, const char* reason = nullptr);
     void RemoveFromGroup(RemoveMethod method = GROUP_REMOVEMETHOD_DEFAULT) { RemoveFromGroup(GetGroup(), GetGUID(), method); }
-    void SendUpdateToOutOfRangeGroupMembers();
+    void SendUpdateToOutOfRangeGroupMembers(uint32 diff);
 
     void SetInGuild(uint32 GuildId)
     {
@@ -1986,6 +2002,22 @@ public:
     void UpdateEnergyRegen();
     void UpdateRuneRegen(RuneType rune);
 
+    // While alive, primary stat changes defer the update of the values derived from them
+    // (armor, attack power, crit, max health/mana, ...) to the end of the batch, so that
+    // several stats changed together are followed by a single update of each value
+    class StatUpdateBatch
+    {
+    public:
+        explicit StatUpdateBatch(Player* player);
+        ~StatUpdateBatch();
+
+        StatUpdateBatch(StatUpdateBatch const&) = delete;
+        StatUpdateBatch& operator=(StatUpdateBatch const&) = delete;
+
+    private:
+        Player* _player;
+    };
+
     [[nodiscard]] ObjectGuid GetLootGUID() const { return m_lootGuid; }
     void SetLootGUID(ObjectGuid guid) { m_lootGuid = guid; }
 
@@ -2401,6 +2433,9 @@ public:
     void GetInitialVisiblePackets(Unit* target);
     void UpdateObjectVisibility(bool forced = true, bool fromUpdate = false) override;
     void UpdateVisibilityForPlayer(bool mapChange = false);
+    // Incremental visibility updates between full ones (Visibility.Incremental.FullUpdateInterval), false if a full update is due
+    bool GetVisibilityPassDelta(WorldObject const* viewPoint, Acore::VisibilityPassDelta& delta) const;
+    void SetVisibilityPassDone(WorldObject const* viewPoint, bool fullPass);
     void UpdateVisibilityOf(WorldObject* target);
     void UpdateTriggerVisibility();
 
@@ -2703,6 +2738,7 @@ protected:
     /*********************************************************/
 
     EntryPointData m_entryPointData;
+    Optional<EntryPointData> m_savedEntryPointData; // what the database holds, unset until known
 
     /*********************************************************/
     /***                    QUEST SYSTEM                   ***/
@@ -2728,7 +2764,8 @@ protected:
     void _LoadAuras(PreparedQueryResult result, uint32 timediff);
     void _LoadGlyphAuras();
     void _LoadInventory(PreparedQueryResult result, uint32 timeDiff);
-    void _LoadMail(PreparedQueryResult mailsResult, PreparedQueryResult mailItemsResult);
+    void _LoadMail(PreparedQueryResult mailsResult);
+    void _LoadMailedItems(PreparedQueryResult mailItemsResult);
     static Item* _LoadMailedItem(ObjectGuid const& playerGuid, Player* player, uint32 mailId, Mail* mail, Field* fields);
     void _LoadQuestStatus(PreparedQueryResult result);
     void _LoadQuestStatusRewarded(PreparedQueryResult result);
@@ -2816,8 +2853,18 @@ protected:
     QuestStatusMap m_QuestStatus;
     QuestStatusSaveMap m_QuestStatusSave;
 
+    // objectives of the quest log, maintained by SetQuestSlot
+    QuestObjectiveIndex m_questKillObjectives;
+    QuestObjectiveIndex m_questItemObjectives;
+    void UpdateQuestObjectiveIndex(uint32 questId, bool add);
+
     RewardedQuestSet m_RewardedQuests;
     QuestStatusSaveMap m_RewardedQuestsSave;
+
+    // quest dialog status of questgiver entries without quest conditions, by type id and entry,
+    // cleared on quest log, level, skill, reputation and daily changes
+    std::unordered_map<uint64, QuestGiverStatus> m_questGiverStatusCache;
+    uint32 m_questGiverStatusGeneration;
     void SendQuestGiverStatusMultiple();
 
     SkillStatusMap mSkillStatus;
@@ -2850,6 +2897,11 @@ protected:
     uint32 m_baseHealthRegen;
     int32 m_spellPenetrationItemMod;
 
+    void UpdateStatDependents(uint32 dependents, uint32 ratingMask);
+    uint8 m_statUpdateBatchDepth;
+    uint32 m_deferredStatDependents;                    // PlayerStatDependents of stat changes in a StatUpdateBatch
+    uint32 m_deferredStatRatings;                       // CombatRating bits of SPELL_AURA_MOD_RATING_FROM_STAT to recalculate
+
     SpellModList m_spellMods[MAX_SPELLMOD];
     //uint32 m_pad;
     //        Spell* m_spellModTakingSpell;  // Spell for which charges are dropped in spell::finish
@@ -2920,6 +2972,7 @@ protected:
     GroupReference m_originalGroup;
     Group* m_groupInvite;
     uint32 m_groupUpdateMask;
+    uint32 m_groupUpdateDelay;                      // until the next stats update to the group members out of range
     uint64 m_auraRaidUpdateMask;
     bool m_bPassOnGroupLoot;
 
@@ -2947,6 +3000,12 @@ protected:
     bool m_needZoneUpdate;
 
 private:
+    // last visibility update, see GetVisibilityPassDelta
+    Position _visibilityPassPosition;
+    uint32 _visibilityPassEpoch;                    // 0 if the next update must be a full one
+    uint32 _visibilityPassAreaId;
+    uint32 _visibilityFullPassTime;
+
     // internal common parts for CanStore/StoreItem functions
     InventoryResult CanStoreItem_InSpecificSlot(uint8 bag, uint8 slot, ItemPosCountVec& dest, ItemTemplate const* pProto, uint32& count, bool swap, Item* pSrcItem) const;
     InventoryResult CanStoreItem_InBag(uint8 bag, ItemPosCountVec& dest, ItemTemplate const* pProto, uint32& count, bool merge, bool non_specialized, Item* pSrcItem, uint8 skip_bag, uint8 skip_slot) const;
@@ -3009,6 +3068,7 @@ private:
     uint32 m_ChampioningFaction;
 
     InstanceTimeMap _instanceResetTimes;
+    InstanceTimeMap _savedInstanceResetTimes;
     uint32 _pendingBindId;
     uint32 _pendingBindTimer;
 
@@ -3029,6 +3089,7 @@ private:
     bool _wasOutdoor;
 
     PlayerSettingMap m_charSettingsMap;
+    std::unordered_set<std::string> m_charSettingsChanged;   // sources with settings not saved yet
 
     Seconds m_creationTime;
 
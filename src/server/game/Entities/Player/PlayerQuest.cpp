@@ -572,6 +572,7 @@ void Player::AddQuest(Quest const* quest, Object* questGiver)
     SetQuestSlot(log_slot, quest_id, qtime);
 
     m_QuestStatusSave[quest_id] = true;
+    InvalidateQuestGiverStatusCache();
 
     StartTimedAchievement(ACHIEVEMENT_TIMED_TYPE_QUEST, quest_id);
 
@@ -882,6 +883,7 @@ void Player::SetRewardedQuest(uint32 quest_id)
 {
     m_RewardedQuests.insert(quest_id);
     m_RewardedQuestsSave[quest_id] = true;
+    InvalidateQuestGiverStatusCache();
 }
 
 void Player::FailQuest(uint32 questId)
@@ -1518,6 +1520,8 @@ void Player::SetQuestStatus(uint32 questId, QuestStatus status, bool update /*=
         {
             m_QuestStatusSave[questId] = true;
         }
+
+        InvalidateQuestGiverStatusCache();
     }
 
     if (update)
@@ -1531,6 +1535,7 @@ void Player::RemoveActiveQuest(uint32 questId, bool update /*= true*/)
     {
         m_QuestStatus.erase(itr);
         m_QuestStatusSave[questId] = false;
+        InvalidateQuestGiverStatusCache();
     }
 
     if (update)
@@ -1549,6 +1554,7 @@ void Player::RemoveRewardedQuest(uint32 questId, bool update /*= true*/)
     {
         m_RewardedQuests.erase(rewItr);
         m_RewardedQuestsSave[questId] = false;
+        InvalidateQuestGiverStatusCache();
     }
 
     if (update)
@@ -1657,6 +1663,19 @@ QuestGiverStatus Player::GetQuestDialogStatus(Object* questgiver)
             return DIALOG_STATUS_NONE;
     }
 
+    // the scripts answered above, what follows only depends on the entry and on this player
+    uint64 const cacheKey = (uint64(questgiver->GetTypeId()) << 32) | questgiver->GetEntry();
+    uint32 const generation = sObjectMgr->GetQuestGiverStatusGeneration();
+    if (m_questGiverStatusGeneration != generation)
+    {
+        m_questGiverStatusCache.clear();
+        m_questGiverStatusGeneration = generation;
+    }
+    else if (auto itr = m_questGiverStatusCache.find(cacheKey); itr != m_questGiverStatusCache.end())
+        return itr->second;
+
+    // conditions may test anything, entries using them are evaluated every time
+    bool cacheable = true;
     QuestGiverStatus result = DIALOG_STATUS_NONE;
 
     for (QuestRelations::const_iterator i = qir.first; i != qir.second; ++i)
@@ -1668,8 +1687,12 @@ QuestGiverStatus Player::GetQuestDialogStatus(Object* questgiver)
             continue;
 
         ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_QUEST_AVAILABLE, quest->GetQuestId());
-        if (!sConditionMgr->IsObjectMeetToConditions(this, conditions))
-            continue;
+        if (!conditions.empty())
+        {
+            cacheable = false;
+            if (!sConditionMgr->IsObjectMeetToConditions(this, conditions))
+                continue;
+        }
 
         QuestStatus status = GetQuestStatus(questId);
         if (status == QUEST_STATUS_COMPLETE && !GetQuestRewardStatus(questId))
@@ -1701,8 +1724,12 @@ QuestGiverStatus Player::GetQuestDialogStatus(Object* questgiver)
             continue;
 
         ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_QUEST_AVAILABLE, quest->GetQuestId());
-        if (!sConditionMgr->IsObjectMeetToConditions(this, conditions))
-            continue;
+        if (!conditions.empty())
+        {
+            cacheable = false;
+            if (!sConditionMgr->IsObjectMeetToConditions(this, conditions))
+                continue;
+        }
 
         QuestStatus status = GetQuestStatus(questId);
         if (status == QUEST_STATUS_NONE)
@@ -1776,6 +1803,9 @@ QuestGiverStatus Player::GetQuestDialogStatus(Object* questgiver)
             result = result2;
     }
 
+    if (cacheable)
+        m_questGiverStatusCache[cacheKey] = result;
+
     return result;
 }
 
@@ -1820,6 +1850,64 @@ uint16 Player::FindQuestSlot(uint32 quest_id) const
     return MAX_QUEST_LOG_SIZE;
 }
 
+void Player::SetQuestSlot(uint16 slot, uint32 quest_id, uint32 timer /*= 0*/)
+{
+    uint32 oldQuestId = GetQuestSlotQuestId(slot);
+    if (oldQuestId != quest_id)
+    {
+        if (oldQuestId)
+            UpdateQuestObjectiveIndex(oldQuestId, false);
+        if (quest_id)
+            UpdateQuestObjectiveIndex(quest_id, true);
+    }
+
+    SetUInt32Value(PLAYER_QUEST_LOG_1_1 + slot * MAX_QUEST_OFFSET + QUEST_ID_OFFSET, quest_id);
+    SetUInt32Value(PLAYER_QUEST_LOG_1_1 + slot * MAX_QUEST_OFFSET + QUEST_STATE_OFFSET, 0);
+    SetUInt32Value(PLAYER_QUEST_LOG_1_1 + slot * MAX_QUEST_OFFSET + QUEST_COUNTS_OFFSET, 0);
+    SetUInt32Value(PLAYER_QUEST_LOG_1_1 + slot * MAX_QUEST_OFFSET + QUEST_COUNTS_OFFSET + 1, 0);
+    SetUInt32Value(PLAYER_QUEST_LOG_1_1 + slot * MAX_QUEST_OFFSET + QUEST_TIME_OFFSET, timer);
+}
+
+void Player::UpdateQuestObjectiveIndex(uint32 questId, bool add)
+{
+    Quest const* qInfo = sObjectMgr->GetQuestTemplate(questId);
+    if (!qInfo)
+        return;
+
+    auto update = [questId, add](QuestObjectiveIndex& index, uint32 entry, uint8 objective)
+    {
+        if (add)
+        {
+            index[entry].push_back({ questId, objective });
+            return;
+        }
+
+        auto itr = index.find(entry);
+        if (itr == index.end())
+            return;
+
+        std::erase_if(itr->second, [questId](QuestObjectiveTarget const& target) { return target.QuestId == questId; });
+        if (itr->second.empty())
+            index.erase(itr);
+    };
+
+    if (qInfo->HasSpecialFlag(QUEST_SPECIAL_FLAGS_KILL))
+    {
+        // credit goes to the first objective requiring the creature
+        std::set<uint32> creatures;
+        for (uint8 j = 0; j < QUEST_OBJECTIVES_COUNT; ++j)
+            if (qInfo->RequiredNpcOrGo[j] > 0 && creatures.insert(qInfo->RequiredNpcOrGo[j]).second)
+                update(m_questKillObjectives, qInfo->RequiredNpcOrGo[j], j);
+    }
+
+    if (qInfo->HasSpecialFlag(QUEST_SPECIAL_FLAGS_DELIVER))
+    {
+        for (uint8 j = 0; j < QUEST_ITEM_OBJECTIVES_COUNT; ++j)
+            if (qInfo->RequiredItemId[j])
+                update(m_questItemObjectives, qInfo->RequiredItemId[j], j);
+    }
+}
+
 void Player::AreaExploredOrEventHappens(uint32 questId)
 {
     if (questId)
@@ -1866,38 +1954,38 @@ void Player::GroupEventHappens(uint32 questId, WorldObject const* pEventObject)
 
 void Player::ItemAddedQuestCheck(uint32 entry, uint32 count)
 {
-    for (uint8 i = 0; i < MAX_QUEST_LOG_SIZE; ++i)
+    auto itr = m_questItemObjectives.find(entry);
+    if (itr != m_questItemObjectives.end())
     {
-        uint32 questid = GetQuestSlotQuestId(i);
-        if (questid == 0)
-            continue;
+        // completing a quest may change the quest log
+        std::vector<QuestObjectiveTarget> const targets = itr->second;
+        for (QuestObjectiveTarget const& target : targets)
+        {
+            uint32 questid = target.QuestId;
+            uint8 j = target.Objective;
+            if (!HasQuest(questid))
+                continue;
 
-        QuestStatusData& q_status = m_QuestStatus[questid];
+            QuestStatusData& q_status = m_QuestStatus[questid];
 
-        if (q_status.Status != QUEST_STATUS_INCOMPLETE)
-            continue;
+            if (q_status.Status != QUEST_STATUS_INCOMPLETE)
+                continue;
 
-        Quest const* qInfo = sObjectMgr->GetQuestTemplate(questid);
-        if (!qInfo || !qInfo->HasSpecialFlag(QUEST_SPECIAL_FLAGS_DELIVER))
-            continue;
+            Quest const* qInfo = sObjectMgr->GetQuestTemplate(questid);
+            if (!qInfo || !qInfo->HasSpecialFlag(QUEST_SPECIAL_FLAGS_DELIVER) || qInfo->RequiredItemId[j] != entry)
+                continue;
 
-        for (uint8 j = 0; j < QUEST_ITEM_OBJECTIVES_COUNT; ++j)
-        {
-            uint32 reqitem = qInfo->RequiredItemId[j];
-            if (reqitem == entry)
+            uint32 reqitemcount = qInfo->RequiredItemCount[j];
+            uint16 curitemcount = q_status.ItemCount[j];
+            if (curitemcount < reqitemcount)
             {
-                uint32 reqitemcount = qInfo->RequiredItemCount[j];
-                uint16 curitemcount = q_status.ItemCount[j];
-                if (curitemcount < reqitemcount)
-                {
-                    q_status.ItemCount[j] = std::min<uint16>(q_status.ItemCount[j] + count, reqitemcount);
-                    m_QuestStatusSave[questid] = true;
-                }
-                if (CanCompleteQuest(questid))
-                    CompleteQuest(questid);
-                else
-                    AdditionalSavingAddMask(ADDITIONAL_SAVING_INVENTORY_AND_GOLD | ADDITIONAL_SAVING_QUEST_STATUS);
+                q_status.ItemCount[j] = std::min<uint16>(q_status.ItemCount[j] + count, reqitemcount);
+                m_QuestStatusSave[questid] = true;
             }
+            if (CanCompleteQuest(questid))
+                CompleteQuest(questid);
+            else
+                AdditionalSavingAddMask(ADDITIONAL_SAVING_INVENTORY_AND_GOLD | ADDITIONAL_SAVING_QUEST_STATUS);
         }
     }
     UpdateForQuestWorldObjects();
@@ -1905,39 +1993,35 @@ void Player::ItemAddedQuestCheck(uint32 entry, uint32 count)
 
 void Player::ItemRemovedQuestCheck(uint32 entry, uint32 count)
 {
-    for (uint8 i = 0; i < MAX_QUEST_LOG_SIZE; ++i)
+    auto itr = m_questItemObjectives.find(entry);
+    if (itr != m_questItemObjectives.end())
     {
-        uint32 questid = GetQuestSlotQuestId(i);
-        if (!questid)
-            continue;
-
-        Quest const* qInfo = sObjectMgr->GetQuestTemplate(questid);
-        if (!qInfo)
-            continue;
+        std::vector<QuestObjectiveTarget> const targets = itr->second;
+        for (QuestObjectiveTarget const& target : targets)
+        {
+            uint32 questid = target.QuestId;
+            uint8 j = target.Objective;
+            if (!HasQuest(questid))
+                continue;
 
-        if (!qInfo->HasSpecialFlag(QUEST_SPECIAL_FLAGS_DELIVER))
-            continue;
+            Quest const* qInfo = sObjectMgr->GetQuestTemplate(questid);
+            if (!qInfo || !qInfo->HasSpecialFlag(QUEST_SPECIAL_FLAGS_DELIVER) || qInfo->RequiredItemId[j] != entry)
+                continue;
 
-        for (uint8 j = 0; j < QUEST_ITEM_OBJECTIVES_COUNT; ++j)
-        {
-            uint32 reqitem = qInfo->RequiredItemId[j];
-            if (reqitem == entry)
-            {
-                QuestStatusData& q_status = m_QuestStatus[questid];
-                uint32 reqitemcount = qInfo->RequiredItemCount[j];
-                uint16 curitemcount = q_status.ItemCount[j];
+            QuestStatusData& q_status = m_QuestStatus[questid];
+            uint32 reqitemcount = qInfo->RequiredItemCount[j];
+            uint16 curitemcount = q_status.ItemCount[j];
 
-                if (q_status.ItemCount[j] >= reqitemcount) // we may have more than what the status shows
-                    curitemcount = GetItemCount(entry, false);
+            if (q_status.ItemCount[j] >= reqitemcount) // we may have more than what the status shows
+                curitemcount = GetItemCount(entry, false);
 
-                uint16 newItemCount = (count > curitemcount) ? 0 : curitemcount - count;
-                newItemCount = std::min<uint16>(newItemCount, reqitemcount);
-                if (newItemCount != q_status.ItemCount[j])
-                {
-                    q_status.ItemCount[j] = newItemCount;
-                    m_QuestStatusSave[questid] = true;
-                    IncompleteQuest(questid);
-                }
+            uint16 newItemCount = (count > curitemcount) ? 0 : curitemcount - count;
+            newItemCount = std::min<uint16>(newItemCount, reqitemcount);
+            if (newItemCount != q_status.ItemCount[j])
+            {
+                q_status.ItemCount[j] = newItemCount;
+                m_QuestStatusSave[questid] = true;
+                IncompleteQuest(questid);
             }
         }
     }
@@ -1970,10 +2054,17 @@ void Player::KilledMonsterCredit(uint32 entry, ObjectGuid guid)
     StartTimedAchievement(ACHIEVEMENT_TIMED_TYPE_CREATURE, real_entry);   // MUST BE CALLED FIRST
     UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_KILL_CREATURE, real_entry, addkillcount, guid ? GetMap()->GetCreature(guid) : nullptr);
 
-    for (uint8 i = 0; i < MAX_QUEST_LOG_SIZE; ++i)
+    auto itr = m_questKillObjectives.find(real_entry);
+    if (itr == m_questKillObjectives.end())
+        return;
+
+    // completing a quest may change the quest log
+    std::vector<QuestObjectiveTarget> const targets = itr->second;
+    for (QuestObjectiveTarget const& target : targets)
     {
-        uint32 questid = GetQuestSlotQuestId(i);
-        if (!questid)
+        uint32 questid = target.QuestId;
+        uint8 j = target.Objective;
+        if (!HasQuest(questid))
             continue;
 
         Quest const* qInfo = sObjectMgr->GetQuestTemplate(questid);
@@ -1988,38 +2079,24 @@ void Player::KilledMonsterCredit(uint32 entry, ObjectGuid guid)
             if (!sScriptMgr->OnPlayerPassedQuestKilledMonsterCredit(this, qInfo, entry, real_entry, guid))
                 continue;
 
-            if (qInfo->HasSpecialFlag(QUEST_SPECIAL_FLAGS_KILL) /*&& !qInfo->HasSpecialFlag(QUEST_SPECIAL_FLAGS_CAST)*/)
-            {
-                for (uint8 j = 0; j < QUEST_OBJECTIVES_COUNT; ++j)
-                {
-                    // skip GO activate objective or none
-                    if (qInfo->RequiredNpcOrGo[j] <= 0)
-                        continue;
-
-                    uint32 reqkill = qInfo->RequiredNpcOrGo[j];
-
-                    if (reqkill == real_entry)
-                    {
-                        uint32 reqkillcount = qInfo->RequiredNpcOrGoCount[j];
-                        uint16 curkillcount = q_status.CreatureOrGOCount[j];
-                        if (curkillcount < reqkillcount)
-                        {
-                            q_status.CreatureOrGOCount[j] = curkillcount + addkillcount;
+            // the index only holds the first objective of each quest requiring the creature
+            if (!qInfo->HasSpecialFlag(QUEST_SPECIAL_FLAGS_KILL) || qInfo->RequiredNpcOrGo[j] <= 0 || uint32(qInfo->RequiredNpcOrGo[j]) != real_entry)
+                continue;
 
-                            m_QuestStatusSave[questid] = true;
+            uint32 reqkillcount = qInfo->RequiredNpcOrGoCount[j];
+            uint16 curkillcount = q_status.CreatureOrGOCount[j];
+            if (curkillcount < reqkillcount)
+            {
+                q_status.CreatureOrGOCount[j] = curkillcount + addkillcount;
 
-                            SendQuestUpdateAddCreatureOrGo(qInfo, guid, j, curkillcount, addkillcount);
-                        }
-                        if (CanCompleteQuest(questid))
-                            CompleteQuest(questid);
-                        else
-                            AdditionalSavingAddMask(ADDITIONAL_SAVING_QUEST_STATUS);
+                m_QuestStatusSave[questid] = true;
 
-                        // same objective target can be in many active quests, but not in 2 objectives for single quest (code optimization).
-                        break;
-                    }
-                }
+                SendQuestUpdateAddCreatureOrGo(qInfo, guid, j, curkillcount, addkillcount);
             }
+            if (CanCompleteQuest(questid))
+                CompleteQuest(questid);
+            else
+                AdditionalSavingAddMask(ADDITIONAL_SAVING_QUEST_STATUS);
         }
     }
 }
@@ -2239,6 +2316,8 @@ void Player::MoneyChanged(uint32 count)
 
 void Player::ReputationChanged(FactionEntry const* factionEntry)
 {
+    InvalidateQuestGiverStatusCache();
+
     for (uint8 i = 0; i < MAX_QUEST_LOG_SIZE; ++i)
     {
         if (uint32 questid = GetQuestSlotQuestId(i))
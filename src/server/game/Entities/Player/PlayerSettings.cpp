@@ -110,6 +110,7 @@ CharacterDatabasePreparedStatement* PlayerSettingsStore::PrepareReplaceStatement
 void Player::_LoadCharacterSettings(PreparedQueryResult result)
 {
     m_charSettingsMap.clear();
+    m_charSettingsChanged.clear();
 
     if (!sWorld->getBoolConfig(CONFIG_PLAYER_SETTINGS_ENABLED))
         return;
@@ -146,14 +147,17 @@ void Player::_SavePlayerSettings(CharacterDatabaseTransaction trans)
     if (!sWorld->getBoolConfig(CONFIG_PLAYER_SETTINGS_ENABLED))
         return;
 
-    for (auto const& [source, settings] : m_charSettingsMap)
+    for (std::string const& source : m_charSettingsChanged)
     {
-        if (settings.empty())
+        auto itr = m_charSettingsMap.find(source);
+        if (itr == m_charSettingsMap.end() || itr->second.empty())
             continue;
 
-        CharacterDatabasePreparedStatement* stmt = PlayerSettingsStore::PrepareReplaceStatement(GetGUID().GetCounter(), source, settings);
+        CharacterDatabasePreparedStatement* stmt = PlayerSettingsStore::PrepareReplaceStatement(GetGUID().GetCounter(), source, itr->second);
         trans->Append(stmt);
     }
+
+    m_charSettingsChanged.clear();
 }
 
 void Player::UpdatePlayerSetting(std::string const& source, uint32 index, uint32 value)
@@ -172,9 +176,14 @@ void Player::UpdatePlayerSetting(std::string const& source, uint32 index, uint32
     else
     {
         PlayerSettingVector& settings = it->second;
+        if (settings.size() >= requiredSize && settings[index].value == value)
+            return;
+
         if (settings.size() < requiredSize)
             settings.resize(requiredSize); // new elements default to zero
 
         settings[index].value = value;
     }
+
+    m_charSettingsChanged.insert(source);
 }
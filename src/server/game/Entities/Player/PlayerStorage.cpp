@@ -4867,6 +4867,8 @@ void Player::_LoadEntryPointData(PreparedQueryResult result)
     m_entryPointData.taxiPath[0] = fields[5].Get<uint32>();
     m_entryPointData.taxiPath[1] = fields[6].Get<uint32>();
     m_entryPointData.mountSpell = fields[7].Get<uint32>();
+
+    m_savedEntryPointData = m_entryPointData;
 }
 
 bool Player::LoadPositionFromDB(uint32& mapid, float& x, float& y, float& z, float& o, bool& in_flight, ObjectGuid::LowType guid)
@@ -5455,7 +5457,7 @@ bool Player::LoadFromDB(ObjectGuid playerGuid, CharacterDatabaseQueryHolder cons
     m_reputationMgr->LoadFromDB(holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_REPUTATION));
 
     // xinef: load mails before inventory, so problematic items can be added to already loaded mails
-    _LoadMail(holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_MAILS), holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS));
+    _LoadMail(holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_MAILS));
 
     _LoadInventory(holder.GetPreparedResult(PLAYER_LOGIN_QUERY_LOAD_INVENTORY), time_diff);
 
@@ -6149,14 +6151,12 @@ Item* Player::_LoadMailedItem(ObjectGuid const& playerGuid, Player* player, uint
     return item;
 }
 
-void Player::_LoadMail(PreparedQueryResult mailsResult, PreparedQueryResult mailItemsResult)
+void Player::_LoadMail(PreparedQueryResult mailsResult)
 {
     time_t cur_time = GameTime::GetGameTime().count();
 
     m_mail.clear();
 
-    std::unordered_map<uint32, Mail*> mailById;
-
     if (mailsResult)
     {
         do
@@ -6193,21 +6193,51 @@ void Player::_LoadMail(PreparedQueryResult mailsResult, PreparedQueryResult mail
             m->state = MAIL_STATE_UNCHANGED;
 
             m_mail.push_back(m);
-            mailById[m->messageID] = m;
         } while (mailsResult->NextRow());
     }
 
-    if (mailItemsResult)
+    UpdateNextMailTimeAndUnreads();
+}
+
+/**
+ * @brief Loads the items of the mailbox, most players never open it in a session.
+ *
+ * Must run before any handler reads the items of a mail, see WorldSession::CanOpenMailBox.
+ * Mails received during the session already hold their items and are skipped.
+ */
+void Player::LoadMailedItems()
+{
+    if (m_mailItemsLoaded)
+        return;
+
+    m_mailItemsLoaded = true;
+
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS);
+    stmt->SetData(0, GetGUID().GetCounter());
+    _LoadMailedItems(CharacterDatabase.Query(stmt));
+}
+
+void Player::_LoadMailedItems(PreparedQueryResult mailItemsResult)
+{
+    if (!mailItemsResult)
+        return;
+
+    std::unordered_map<uint32, Mail*> mailById;
+    for (Mail* mail : m_mail)
+        mailById[mail->messageID] = mail;
+
+    do
     {
-        do
-        {
-            Field* fields = mailItemsResult->Fetch();
-            uint32 mailId = fields[14].Get<uint32>();
-            _LoadMailedItem(GetGUID(), this, mailId, mailById[mailId], fields);
-        } while (mailItemsResult->NextRow());
-    }
+        Field* fields = mailItemsResult->Fetch();
 
-    UpdateNextMailTimeAndUnreads();
+        // sent to this player after login
+        if (GetMItem(fields[11].Get<uint32>()))
+            continue;
+
+        uint32 mailId = fields[14].Get<uint32>();
+        auto itr = mailById.find(mailId);
+        _LoadMailedItem(GetGUID(), this, mailId, itr != mailById.end() ? itr->second : nullptr, fields);
+    } while (mailItemsResult->NextRow());
 }
 
 void Player::LoadPet()
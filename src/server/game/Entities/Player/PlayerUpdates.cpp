@@ -30,6 +30,7 @@
 #include "OutdoorPvPMgr.h"
 #include "Pet.h"
 #include "Player.h"
+#include "ReputationMgr.h"
 #include "ScriptMgr.h"
 #include "SkillDiscovery.h"
 #include "SpellAuraEffects.h"
@@ -85,17 +86,21 @@ void Player::Update(uint32 p_time)
 
     time_t now = GameTime::GetGameTime().count();
 
-    UpdatePvPFlag(now);
-    UpdateFFAPvPFlag(now);
+    // checks against the game time only change their outcome when a new second starts
+    bool const newSecond = now > m_Last_tick;
 
-    UpdateContestedPvP(p_time);
+    if (newSecond)
+    {
+        UpdatePvPFlag(now);
+        UpdateFFAPvPFlag(now);
+        UpdateDuelFlag(now);
+        UpdateAfkReport(now);
+    }
 
-    UpdateDuelFlag(now);
+    UpdateContestedPvP(p_time);
 
     CheckDuelDistance(now);
 
-    UpdateAfkReport(now);
-
     // Xinef: update charm AI only if we are controlled by creature or
     // non-posses player charm
     if (IsCharmed() && !HasUnitFlag(UNIT_FLAG_POSSESSED))
@@ -110,8 +115,7 @@ void Player::Update(uint32 p_time)
         }
     }
 
-    time_t lastTick = m_Last_tick;
-    if (now > m_Last_tick)
+    if (newSecond)
     {
         // Update items that have just a limited lifetime
         UpdateItemDuration(uint32(now - m_Last_tick));
@@ -128,7 +132,7 @@ void Player::Update(uint32 p_time)
     }
 
     // If mute expired, remove it from the DB
-    if (GetSession()->m_muteTime && GetSession()->m_muteTime < now)
+    if (newSecond && GetSession()->m_muteTime && GetSession()->m_muteTime < now)
     {
         GetSession()->m_muteTime = 0;
         LoginDatabasePreparedStatement* stmt =
@@ -244,7 +248,7 @@ void Player::Update(uint32 p_time)
 
     if (HasPlayerFlag(PLAYER_FLAGS_RESTING))
     {
-        if (now > lastTick && _restTime > 0) // freeze update
+        if (newSecond && _restTime > 0) // freeze update
         {
             time_t currTime = GameTime::GetGameTime().count();
             time_t timeDiff = currTime - _restTime;
@@ -313,7 +317,8 @@ void Player::Update(uint32 p_time)
             m_zoneUpdateTimer -= p_time;
     }
 
-    sScriptMgr->OnPlayerUpdate(this, p_time);
+    if (ScriptRegistry<PlayerScript>::HasEnabledHooks(PLAYERHOOK_ON_UPDATE))
+        sScriptMgr->OnPlayerUpdate(this, p_time);
 
     if (IsAlive())
     {
@@ -378,7 +383,7 @@ void Player::Update(uint32 p_time)
     UpdateEnchantTime(p_time);
     UpdateHomebindTime(p_time);
 
-    if (!_instanceResetTimes.empty())
+    if (newSecond && !_instanceResetTimes.empty())
     {
         for (InstanceTimeMap::iterator itr = _instanceResetTimes.begin();
              itr != _instanceResetTimes.end();)
@@ -390,8 +395,11 @@ void Player::Update(uint32 p_time)
         }
     }
 
+    // reputation gained since the last update
+    m_reputationMgr->SendPendingStates();
+
     // group update
-    SendUpdateToOutOfRangeGroupMembers();
+    SendUpdateToOutOfRangeGroupMembers(p_time);
 
     Pet* pet = GetPet();
     if (pet && !pet->IsWithinDistInMap(this, GetMap()->GetVisibilityRange()) &&
@@ -741,6 +749,7 @@ bool Player::UpdateSkill(uint32 skill_id, uint32 step)
         if (itr->second.uState != SKILL_NEW)
             itr->second.uState = SKILL_CHANGED;
 
+        InvalidateQuestGiverStatusCache();
         UpdateSkillEnchantments(skill_id, value, new_value);
         UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_REACH_SKILL_LEVEL,
                                   skill_id);
@@ -959,6 +968,8 @@ bool Player::UpdateSkillPro(uint16 SkillId, int32 Chance, uint32 step)
         if (itr->second.uState != SKILL_NEW)
             itr->second.uState = SKILL_CHANGED;
 
+        InvalidateQuestGiverStatusCache();
+
         for (std::size_t i = 0; i < bonusSkillLevelsSize; ++i)
         {
             uint32 bsl = bonusSkillLevels[i];
@@ -1607,7 +1618,55 @@ void Player::UpdateVisibilityForPlayer(bool mapChange)
     notifier.SendToSelf();
 
     if (mapChange)
+    {
         m_last_notify_position.Relocate(-5000.0f, -5000.0f, -5000.0f, 0.0f);
+        // game objects only, the next update must see everything
+        _visibilityPassEpoch = 0;
+    }
+    else
+        SetVisibilityPassDone(m_seer, true);
+}
+
+bool Player::GetVisibilityPassDelta(WorldObject const* viewPoint, Acore::VisibilityPassDelta& delta) const
+{
+    uint32 const fullInterval = sWorld->getIntConfig(CONFIG_VISIBILITY_INCREMENTAL_FULL_INTERVAL);
+    if (!fullInterval || !_visibilityPassEpoch)
+        return false;
+
+    if (uint32(GameTime::GetGameTimeMS().count()) - _visibilityFullPassTime >= fullInterval)
+        return false;
+
+    // distance alone decides only for an alive player seeing from its own position with the map sight range,
+    // creature visibility conditions may depend on the area
+    if (viewPoint != this || !IsAlive() || GetFarSightDistance() || IsInWintergrasp() || GetCinematicMgr()->IsOnCinematic()
+        || GetAreaId() != _visibilityPassAreaId)
+        return false;
+
+    delta.FromX = _visibilityPassPosition.GetPositionX();
+    delta.FromY = _visibilityPassPosition.GetPositionY();
+    delta.ToX = GetPositionX();
+    delta.ToY = GetPositionY();
+    delta.SightRange = GetSightRange();
+    delta.SeerSize = GetObjectSize();
+    delta.PassEpoch = _visibilityPassEpoch;
+    return true;
+}
+
+void Player::SetVisibilityPassDone(WorldObject const* viewPoint, bool fullPass)
+{
+    // seen from elsewhere, GetVisibilityPassDelta starts over with a full update
+    if (viewPoint != this)
+    {
+        _visibilityPassEpoch = 0;
+        return;
+    }
+
+    _visibilityPassPosition.Relocate(viewPoint->GetPositionX(), viewPoint->GetPositionY(), viewPoint->GetPositionZ());
+    _visibilityPassEpoch = GetMap()->GetVisibilityEpoch();
+    _visibilityPassAreaId = GetAreaId();
+
+    if (fullPass)
+        _visibilityFullPassTime = uint32(GameTime::GetGameTimeMS().count());
 }
 
 void Player::UpdateObjectVisibility(bool forced, bool fromUpdate)
@@ -24,7 +24,7 @@
 #include "WorldPacket.h"
 #include "WorldSession.h"
 
-PlayerSocial::PlayerSocial(): m_playerGUID() { }
+PlayerSocial::PlayerSocial(): m_playerGUID(), m_ignoreCount(0) { }
 
 uint32 PlayerSocial::GetNumberOfSocialsWithFlag(SocialFlag flag) const
 {
@@ -46,6 +46,12 @@ bool PlayerSocial::AddToSocialList(ObjectGuid const& friendGuid, SocialFlag flag
     auto itr = m_playerSocialMap.find(friendGuid);
     if (itr != m_playerSocialMap.end())
     {
+        if ((flag & SOCIAL_FLAG_IGNORED) && !(itr->second.Flags & SOCIAL_FLAG_IGNORED))
+            ++m_ignoreCount;
+
+        if ((flag & SOCIAL_FLAG_FRIEND) && !(itr->second.Flags & SOCIAL_FLAG_FRIEND))
+            sSocialMgr->AddFriendLister(friendGuid, GetPlayerGUID());
+
         itr->second.Flags |= flag;
 
         CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_ADD_CHARACTER_SOCIAL_FLAGS);
@@ -58,6 +64,12 @@ bool PlayerSocial::AddToSocialList(ObjectGuid const& friendGuid, SocialFlag flag
     }
     else
     {
+        if (flag & SOCIAL_FLAG_IGNORED)
+            ++m_ignoreCount;
+
+        if (flag & SOCIAL_FLAG_FRIEND)
+            sSocialMgr->AddFriendLister(friendGuid, GetPlayerGUID());
+
         m_playerSocialMap[friendGuid].Flags |= flag;
 
         CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHARACTER_SOCIAL);
@@ -77,6 +89,12 @@ void PlayerSocial::RemoveFromSocialList(ObjectGuid const& friendGuid, SocialFlag
     if (itr == m_playerSocialMap.end())                     // not exist
         return;
 
+    if ((flag & SOCIAL_FLAG_IGNORED) && (itr->second.Flags & SOCIAL_FLAG_IGNORED))
+        --m_ignoreCount;
+
+    if ((flag & SOCIAL_FLAG_FRIEND) && (itr->second.Flags & SOCIAL_FLAG_FRIEND))
+        sSocialMgr->RemoveFriendLister(friendGuid, GetPlayerGUID());
+
     itr->second.Flags &= ~flag;
 
     if (itr->second.Flags == 0)
@@ -192,6 +210,9 @@ bool PlayerSocial::HasFriend(ObjectGuid const& friend_guid) const
 
 bool PlayerSocial::HasIgnore(ObjectGuid const& ignore_guid) const
 {
+    if (!m_ignoreCount)
+        return false;
+
     return _checkContact(ignore_guid, SOCIAL_FLAG_IGNORED);
 }
 
@@ -209,6 +230,35 @@ SocialMgr* SocialMgr::instance()
     return &instance;
 }
 
+void SocialMgr::RemovePlayerSocial(ObjectGuid const& guid)
+{
+    auto itr = m_socialMap.find(guid);
+    if (itr == m_socialMap.end())
+        return;
+
+    for (auto const& [friendGuid, friendInfo] : itr->second.m_playerSocialMap)
+        if (friendInfo.Flags & SOCIAL_FLAG_FRIEND)
+            RemoveFriendLister(friendGuid, guid);
+
+    m_socialMap.erase(itr);
+}
+
+void SocialMgr::AddFriendLister(ObjectGuid const& friendGuid, ObjectGuid const& listerGuid)
+{
+    m_friendListers[friendGuid].insert(listerGuid);
+}
+
+void SocialMgr::RemoveFriendLister(ObjectGuid const& friendGuid, ObjectGuid const& listerGuid)
+{
+    auto itr = m_friendListers.find(friendGuid);
+    if (itr == m_friendListers.end())
+        return;
+
+    itr->second.erase(listerGuid);
+    if (itr->second.empty())
+        m_friendListers.erase(itr);
+}
+
 void SocialMgr::GetFriendInfo(Player* player, ObjectGuid const& friendGUID, FriendInfo& friendInfo)
 {
     if (!player)
@@ -301,18 +351,18 @@ void SocialMgr::BroadcastToFriendListers(Player* player, WorldPacket* packet)
     bool allowTwoSideWhoList = sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_WHO_LIST);
     AccountTypes gmLevelInWhoList = AccountTypes(sWorld->getIntConfig(CONFIG_GM_LEVEL_IN_WHO_LIST));
 
-    for (auto const& itr : m_socialMap)
+    auto listers = m_friendListers.find(player->GetGUID());
+    if (listers == m_friendListers.end())
+        return;
+
+    for (ObjectGuid const& listerGuid : listers->second)
     {
-        auto const& itr2 = itr.second.m_playerSocialMap.find(player->GetGUID());
-        if (itr2 != itr.second.m_playerSocialMap.end() && (itr2->second.Flags & SOCIAL_FLAG_FRIEND))
-        {
-            Player* pFriend = ObjectAccessor::FindPlayer(itr.first);
+        Player* pFriend = ObjectAccessor::FindPlayer(listerGuid);
 
-            // PLAYER see his team only and PLAYER can't see MODERATOR, GAME MASTER, ADMINISTRATOR characters
-            // MODERATOR, GAME MASTER, ADMINISTRATOR can see all
-            if (pFriend && (!AccountMgr::IsPlayerAccount(pFriend->GetSession()->GetSecurity()) || ((pFriend->GetTeamId() == teamId || allowTwoSideWhoList) && security <= gmLevelInWhoList)) && player->IsVisibleGloballyFor(pFriend))
-                pFriend->SendDirectMessage(packet);
-        }
+        // PLAYER see his team only and PLAYER can't see MODERATOR, GAME MASTER, ADMINISTRATOR characters
+        // MODERATOR, GAME MASTER, ADMINISTRATOR can see all
+        if (pFriend && (!AccountMgr::IsPlayerAccount(pFriend->GetSession()->GetSecurity()) || ((pFriend->GetTeamId() == teamId || allowTwoSideWhoList) && security <= gmLevelInWhoList)) && player->IsVisibleGloballyFor(pFriend))
+            pFriend->SendDirectMessage(packet);
     }
 }
 
@@ -333,6 +383,12 @@ PlayerSocial* SocialMgr::LoadFromDB(PreparedQueryResult result, ObjectGuid const
         auto note = fields[2].Get<std::string>();
 
         social->m_playerSocialMap[friendGuid] = FriendInfo(flags, note);
+
+        if (flags & SOCIAL_FLAG_IGNORED)
+            ++social->m_ignoreCount;
+
+        if (flags & SOCIAL_FLAG_FRIEND)
+            AddFriendLister(friendGuid, guid);
     } while (result->NextRow());
 
     return social;
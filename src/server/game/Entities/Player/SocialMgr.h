@@ -21,6 +21,7 @@
 #include "DatabaseEnv.h"
 #include "ObjectGuid.h"
 #include <map>
+#include <unordered_map>
 
 class Player;
 class WorldPacket;
@@ -120,10 +121,13 @@ class PlayerSocial
         typedef std::map<ObjectGuid, FriendInfo> PlayerSocialMap;
         PlayerSocialMap m_playerSocialMap;
         ObjectGuid m_playerGUID;
+        uint32 m_ignoreCount;                               // channel broadcasts skip the lookup of players without ignores
 };
 
 class SocialMgr
 {
+    friend class PlayerSocial;
+
     private:
         SocialMgr();
         ~SocialMgr();
@@ -131,7 +135,7 @@ class SocialMgr
     public:
         static SocialMgr* instance();
         // Misc
-        void RemovePlayerSocial(ObjectGuid const& guid) { m_socialMap.erase(guid); }
+        void RemovePlayerSocial(ObjectGuid const& guid);
         static void GetFriendInfo(Player* player, ObjectGuid const& friendGUID, FriendInfo& friendInfo);
         // Packet management
         void MakeFriendStatusPacket(FriendsResult result, ObjectGuid const& friend_guid, WorldPacket* data);
@@ -140,8 +144,13 @@ class SocialMgr
         // Loading
         PlayerSocial* LoadFromDB(PreparedQueryResult result, ObjectGuid const& guid);
     private:
+        // Reverse index of the loaded friend lists, kept by PlayerSocial
+        void AddFriendLister(ObjectGuid const& friendGuid, ObjectGuid const& listerGuid);
+        void RemoveFriendLister(ObjectGuid const& friendGuid, ObjectGuid const& listerGuid);
+
         typedef std::map<ObjectGuid, PlayerSocial> SocialMap;
         SocialMap m_socialMap;
+        std::unordered_map<ObjectGuid, GuidUnorderedSet> m_friendListers; // friend -> players which have it in their loaded friend list
 };
 
 #define sSocialMgr SocialMgr::instance()
@@ -20,6 +20,7 @@
 #include "CellImpl.h"
 #include "Common.h"
 #include "DBCStores.h"
+#include "DynamicVisibility.h"
 #include "GameObjectAI.h"
 #include "GameTime.h"
 #include "MapMgr.h"
@@ -31,7 +32,7 @@
 #include "Vehicle.h"
 #include "WorldModel.h"
 
-MotionTransport::MotionTransport() : Transport(), _transportInfo(nullptr), _isMoving(true), _pendingStop(false), _triggeredArrivalEvent(false), _triggeredDepartureEvent(false), _passengersLoaded(false), _delayedTeleport(false)
+MotionTransport::MotionTransport() : Transport(), _transportInfo(nullptr), _lastPassengerVisibilityPosition(-5000.0f, -5000.0f, -5000.0f), _isMoving(true), _pendingStop(false), _triggeredArrivalEvent(false), _triggeredDepartureEvent(false), _passengersLoaded(false), _delayedTeleport(false)
 {
     m_updateFlag = UPDATEFLAG_TRANSPORT | UPDATEFLAG_LOWGUID | UPDATEFLAG_STATIONARY_POSITION | UPDATEFLAG_ROTATION;
 }
@@ -253,12 +254,17 @@ void MotionTransport::UpdatePosition(float x, float y, float z, float o)
     Relocate(x, y, z, o);
     UpdateModelPosition();
 
-    UpdatePassengerPositions(_passengers);
+    // passengers moving within their cell refresh visibility only once the transport moved as far as a unit must for the same
+    bool const updateVisibility = GetExactDistSq(_lastPassengerVisibilityPosition) >= DynamicVisibilityMgr::GetReqMoveDistSq(GetMap()->GetEntry()->map_type);
+    if (updateVisibility)
+        _lastPassengerVisibilityPosition.Relocate(x, y, z);
+
+    UpdatePassengerPositions(_passengers, updateVisibility);
 
     if (_staticPassengers.empty())
         LoadStaticPassengers();
     else
-        UpdatePassengerPositions(_staticPassengers);
+        UpdatePassengerPositions(_staticPassengers, updateVisibility);
 }
 
 void MotionTransport::AddPassenger(WorldObject* passenger, bool withAll)
@@ -411,18 +417,18 @@ void MotionTransport::LoadStaticPassengers()
     SetPassengersLoaded(true);
     if (uint32 mapId = GetGOInfo()->moTransport.mapID)
     {
-        CellObjectGuidsMap const& cells = sObjectMgr->GetMapObjectGuids(mapId, GetMap()->GetSpawnMode());
+        CellObjectGuidsMap const cells = sObjectMgr->GetMapObjectGuids(mapId, GetMap()->GetSpawnMode());
         CellGuidSet::const_iterator guidEnd;
         for (CellObjectGuidsMap::const_iterator cellItr = cells.begin(); cellItr != cells.end(); ++cellItr)
         {
             // Creatures on transport
-            guidEnd = cellItr->second.creatures.end();
-            for (CellGuidSet::const_iterator guidItr = cellItr->second.creatures.begin(); guidItr != guidEnd; ++guidItr)
+            guidEnd = cellItr->second->creatures.end();
+            for (CellGuidSet::const_iterator guidItr = cellItr->second->creatures.begin(); guidItr != guidEnd; ++guidItr)
                 CreateNPCPassenger(*guidItr, sObjectMgr->GetCreatureData(*guidItr));
 
             // GameObjects on transport
-            guidEnd = cellItr->second.gameobjects.end();
-            for (CellGuidSet::const_iterator guidItr = cellItr->second.gameobjects.begin(); guidItr != guidEnd; ++guidItr)
+            guidEnd = cellItr->second->gameobjects.end();
+            for (CellGuidSet::const_iterator guidItr = cellItr->second->gameobjects.begin(); guidItr != guidEnd; ++guidItr)
                 CreateGOPassenger(*guidItr, sObjectMgr->GetGameObjectData(*guidItr));
         }
     }
@@ -617,7 +623,7 @@ void MotionTransport::DelayedTeleportTransport()
     LoadStaticPassengers();
 }
 
-void MotionTransport::UpdatePassengerPositions(PassengerSet& passengers)
+void MotionTransport::UpdatePassengerPositions(PassengerSet& passengers, bool updateVisibility)
 {
     for (PassengerSet::iterator itr = passengers.begin(); itr != passengers.end(); ++itr)
     {
@@ -645,7 +651,7 @@ void MotionTransport::UpdatePassengerPositions(PassengerSet& passengers)
             case TYPEID_UNIT:
                 {
                     Creature* creature = passenger->ToCreature();
-                    GetMap()->CreatureRelocation(creature, x, y, z, o);
+                    GetMap()->CreatureRelocation(creature, x, y, z, o, updateVisibility);
 
                     creature->GetTransportHomePosition(x, y, z, o);
                     CalculatePassengerPosition(x, y, z, &o);
@@ -654,13 +660,13 @@ void MotionTransport::UpdatePassengerPositions(PassengerSet& passengers)
                 break;
             case TYPEID_PLAYER:
                 if (passenger->IsInWorld())
-                    GetMap()->PlayerRelocation(passenger->ToPlayer(), x, y, z, o);
+                    GetMap()->PlayerRelocation(passenger->ToPlayer(), x, y, z, o, updateVisibility);
                 break;
             case TYPEID_GAMEOBJECT:
-                GetMap()->GameObjectRelocation(passenger->ToGameObject(), x, y, z, o);
+                GetMap()->GameObjectRelocation(passenger->ToGameObject(), x, y, z, o, updateVisibility);
                 break;
             case TYPEID_DYNAMICOBJECT:
-                GetMap()->DynamicObjectRelocation(passenger->ToDynObject(), x, y, z, o);
+                GetMap()->DynamicObjectRelocation(passenger->ToDynObject(), x, y, z, o, updateVisibility);
                 break;
             default:
                 break;
@@ -87,7 +87,7 @@ private:
     float CalculateSegmentPos(float perc);
     bool TeleportTransport(uint32 newMapid, float x, float y, float z, float o);
     void DelayedTeleportTransport();
-    void UpdatePassengerPositions(PassengerSet& passengers);
+    void UpdatePassengerPositions(PassengerSet& passengers, bool updateVisibility);
     void DoEventIfAny(KeyFrame const& node, bool departure);
 
     //! Helpers to know if stop frame was reached
@@ -98,6 +98,7 @@ private:
     KeyFrameVec::const_iterator _currentFrame;
     KeyFrameVec::const_iterator _nextFrame;
     TimeTrackerSmall _positionChangeTimer;
+    Position _lastPassengerVisibilityPosition;
     bool _isMoving;
     bool _pendingStop;
 
@@ -15,7 +15,7 @@
  * with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include "Config.h"
+#include "ConfigValueCache.h"
 #include "Creature.h"
 #include "Pet.h"
 #include "Player.h"
@@ -25,6 +25,15 @@
 #include "SpellMgr.h"
 #include "Unit.h"
 
+namespace
+{
+    ConfigOption<bool> const StatsLimitsEnabled("Stats.Limits.Enable", false);
+    ConfigOption<float> const StatsLimitBlock("Stats.Limits.Block", 95.0f);
+    ConfigOption<float> const StatsLimitCrit("Stats.Limits.Crit", 95.0f);
+    ConfigOption<float> const StatsLimitParry("Stats.Limits.Parry", 95.0f);
+    ConfigOption<float> const StatsLimitDodge("Stats.Limits.Dodge", 95.0f);
+}
+
 inline bool _ModifyUInt32(bool apply, uint32& baseValue, int32& amount)
 {
     // If amount is negative, change sign and value of apply.
@@ -94,6 +103,22 @@ void Unit::UpdateDamagePhysical(WeaponAttackType attType)
 ########                         ########
 #######################################*/
 
+// Values derived from the primary stats, recalculated by Player::UpdateStatDependents
+enum PlayerStatDependents : uint32
+{
+    STAT_DEPENDENT_SHIELD_BLOCK     = 0x0001,
+    STAT_DEPENDENT_ARMOR            = 0x0002,
+    STAT_DEPENDENT_CRIT             = 0x0004,
+    STAT_DEPENDENT_DODGE            = 0x0008,
+    STAT_DEPENDENT_MAX_HEALTH       = 0x0010,
+    STAT_DEPENDENT_MAX_MANA         = 0x0020,
+    STAT_DEPENDENT_SPELL_CRIT       = 0x0040,
+    STAT_DEPENDENT_ATTACK_POWER     = 0x0080,
+    STAT_DEPENDENT_RANGED_AP        = 0x0100,
+    STAT_DEPENDENT_SPELL_POWER      = 0x0200,
+    STAT_DEPENDENT_MANA_REGEN       = 0x0400
+};
+
 bool Player::UpdateStats(Stats stat)
 {
     if (stat > STAT_SPIRIT)
@@ -104,23 +129,22 @@ bool Player::UpdateStats(Stats stat)
 
     SetStat(stat, int32(value));
 
+    uint32 dependents = STAT_DEPENDENT_SPELL_POWER | STAT_DEPENDENT_MANA_REGEN;
+
     switch (stat)
     {
         case STAT_STRENGTH:
-            UpdateShieldBlockValue();
+            dependents |= STAT_DEPENDENT_SHIELD_BLOCK;
             break;
         case STAT_AGILITY:
-            UpdateArmor();
-            UpdateAllCritPercentages();
-            UpdateDodgePercentage();
+            dependents |= STAT_DEPENDENT_ARMOR | STAT_DEPENDENT_CRIT | STAT_DEPENDENT_DODGE;
             break;
         case STAT_STAMINA:
-            UpdateMaxHealth();
+            dependents |= STAT_DEPENDENT_MAX_HEALTH;
             break;
         case STAT_INTELLECT:
-            UpdateMaxPower(POWER_MANA);
-            UpdateAllSpellCritChances();
-            UpdateArmor();                                  //SPELL_AURA_MOD_RESISTANCE_OF_INTELLECT_PERCENT, only armor currently
+            dependents |= STAT_DEPENDENT_MAX_MANA | STAT_DEPENDENT_SPELL_CRIT;
+            dependents |= STAT_DEPENDENT_ARMOR;             //SPELL_AURA_MOD_RESISTANCE_OF_INTELLECT_PERCENT, only armor currently
             break;
         default:
             break;
@@ -128,40 +152,94 @@ bool Player::UpdateStats(Stats stat)
 
     if (stat == STAT_STRENGTH)
     {
-        UpdateAttackPowerAndDamage(false);
+        dependents |= STAT_DEPENDENT_ATTACK_POWER;
         if (HasAuraTypeWithMiscvalue(SPELL_AURA_MOD_RANGED_ATTACK_POWER_OF_STAT_PERCENT, stat))
-            UpdateAttackPowerAndDamage(true);
+            dependents |= STAT_DEPENDENT_RANGED_AP;
     }
     else if (stat == STAT_AGILITY)
-    {
-        UpdateAttackPowerAndDamage(false);
-        UpdateAttackPowerAndDamage(true);
-    }
+        dependents |= STAT_DEPENDENT_ATTACK_POWER | STAT_DEPENDENT_RANGED_AP;
     else
     {
         // Need update (exist AP from stat auras)
         if (HasAuraTypeWithMiscvalue(SPELL_AURA_MOD_ATTACK_POWER_OF_STAT_PERCENT, stat))
-            UpdateAttackPowerAndDamage(false);
+            dependents |= STAT_DEPENDENT_ATTACK_POWER;
         if (HasAuraTypeWithMiscvalue(SPELL_AURA_MOD_RANGED_ATTACK_POWER_OF_STAT_PERCENT, stat))
-            UpdateAttackPowerAndDamage(true);
+            dependents |= STAT_DEPENDENT_RANGED_AP;
     }
 
-    UpdateSpellDamageAndHealingBonus();
-    UpdateManaRegen();
-
     // Update ratings in exist SPELL_AURA_MOD_RATING_FROM_STAT and only depends from stat
     uint32 mask = 0;
     AuraEffectList const& modRatingFromStat = GetAuraEffectsByType(SPELL_AURA_MOD_RATING_FROM_STAT);
     for (AuraEffectList::const_iterator i = modRatingFromStat.begin(); i != modRatingFromStat.end(); ++i)
         if (Stats((*i)->GetMiscValueB()) == stat)
             mask |= (*i)->GetMiscValue();
-    if (mask)
+
+    if (m_statUpdateBatchDepth)
+    {
+        m_deferredStatDependents |= dependents;
+        m_deferredStatRatings |= mask;
+    }
+    else
+        UpdateStatDependents(dependents, mask);
+
+    return true;
+}
+
+void Player::UpdateStatDependents(uint32 dependents, uint32 ratingMask)
+{
+    if (dependents & STAT_DEPENDENT_SHIELD_BLOCK)
+        UpdateShieldBlockValue();
+    if (dependents & STAT_DEPENDENT_ARMOR)
+        UpdateArmor();
+    if (dependents & STAT_DEPENDENT_CRIT)
+        UpdateAllCritPercentages();
+    if (dependents & STAT_DEPENDENT_DODGE)
+        UpdateDodgePercentage();
+    if (dependents & STAT_DEPENDENT_MAX_HEALTH)
+        UpdateMaxHealth();
+    if (dependents & STAT_DEPENDENT_MAX_MANA)
+        UpdateMaxPower(POWER_MANA);
+    if (dependents & STAT_DEPENDENT_SPELL_CRIT)
+        UpdateAllSpellCritChances();
+    if (dependents & STAT_DEPENDENT_ATTACK_POWER)
+        UpdateAttackPowerAndDamage(false);
+    if (dependents & STAT_DEPENDENT_RANGED_AP)
+        UpdateAttackPowerAndDamage(true);
+    if (dependents & STAT_DEPENDENT_SPELL_POWER)
+        UpdateSpellDamageAndHealingBonus();
+    if (dependents & STAT_DEPENDENT_MANA_REGEN)
+        UpdateManaRegen();
+
+    if (ratingMask)
     {
         for (uint8 rating = 0; rating < MAX_COMBAT_RATING; ++rating)
-            if (mask & (1 << rating))
+            if (ratingMask & (1 << rating))
                 ApplyRatingMod(CombatRating(rating), 0, true);
     }
-    return true;
+}
+
+Player::StatUpdateBatch::StatUpdateBatch(Player* player) : _player(player)
+{
+    if (_player)
+        ++_player->m_statUpdateBatchDepth;
+}
+
+// Ends the batch and updates what its stat changes affect, so code after it reads final values,
+// changes done later in an enclosing batch are still deferred to its end
+Player::StatUpdateBatch::~StatUpdateBatch()
+{
+    if (!_player)
+        return;
+
+    --_player->m_statUpdateBatchDepth;
+
+    uint32 dependents = _player->m_deferredStatDependents;
+    uint32 ratingMask = _player->m_deferredStatRatings;
+    _player->m_deferredStatDependents = 0;
+    _player->m_deferredStatRatings = 0;
+
+    if (dependents || ratingMask)
+        _player->UpdateStatDependents(dependents, ratingMask);
 }
 
 void Player::ApplySpellPowerBonus(int32 amount, bool apply)
@@ -645,9 +723,9 @@ void Player::UpdateBlockPercentage()
         // Increase from rating
         value += GetRatingBonusValue(CR_BLOCK);
 
-        if (sConfigMgr->GetOption<bool>("Stats.Limits.Enable", false))
+        if (StatsLimitsEnabled.Get())
         {
-            value = value > sConfigMgr->GetOption<float>("Stats.Limits.Block", 95.0f) ? sConfigMgr->GetOption<float>("Stats.Limits.Block", 95.0f) : value;
+            value = std::min(value, StatsLimitBlock.Get());
         }
 
         value = value < 0.0f ? 0.0f : value;
@@ -686,9 +764,9 @@ void Player::UpdateCritPercentage(WeaponAttackType attType)
     // Modify crit from weapon skill and maximized defense skill of same level victim difference
     value += (int32(GetWeaponSkillValue(attType)) - int32(GetMaxSkillValueForLevel())) * 0.04f;
 
-    if (sConfigMgr->GetOption<bool>("Stats.Limits.Enable", false))
+    if (StatsLimitsEnabled.Get())
     {
-        value = value > sConfigMgr->GetOption<float>("Stats.Limits.Crit", 95.0f) ? sConfigMgr->GetOption<float>("Stats.Limits.Crit", 95.0f) : value;
+        value = std::min(value, StatsLimitCrit.Get());
     }
 
     value = value < 0.0f ? 0.0f : value;
@@ -787,9 +865,9 @@ void Player::UpdateParryPercentage()
 
         value = std::max(diminishing + nondiminishing, 0.0f);
 
-        if (sConfigMgr->GetOption<bool>("Stats.Limits.Enable", false))
+        if (StatsLimitsEnabled.Get())
         {
-            value = value > sConfigMgr->GetOption<float>("Stats.Limits.Parry", 95.0f) ? sConfigMgr->GetOption<float>("Stats.Limits.Parry", 95.0f) : value;
+            value = std::min(value, StatsLimitParry.Get());
         }
     }
 
@@ -829,9 +907,9 @@ void Player::UpdateDodgePercentage()
     m_realDodge = m_realDodge < 0.0f ? 0.0f : m_realDodge;
     float value = std::max(diminishing + nondiminishing, 0.0f);
 
-    if (sConfigMgr->GetOption<bool>("Stats.Limits.Enable", false))
+    if (StatsLimitsEnabled.Get())
     {
-        value = value > sConfigMgr->GetOption<float>("Stats.Limits.Dodge", 95.0f) ? sConfigMgr->GetOption<float>("Stats.Limits.Dodge", 95.0f) : value;
+        value = std::min(value, StatsLimitDodge.Get());
     }
 
     SetStatFloatValue(PLAYER_DODGE_PERCENTAGE, value);
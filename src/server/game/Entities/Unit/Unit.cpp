@@ -257,7 +257,7 @@ Unit::Unit() : WorldObject(),
     for (uint8 i = 0; i < MAX_GAMEOBJECT_SLOT; ++i)
         m_ObjectSlot[i].Clear();
 
-    m_auraUpdateIterator = m_ownedAuras.end();
+    m_auraUpdateIndex = AURA_UPDATE_INDEX_NONE;
 
     m_interruptMask = 0;
     m_transform = 0;
@@ -289,6 +289,8 @@ Unit::Unit() : WorldObject(),
         m_createStats[i] = 0.0f;
 
     m_attacking = nullptr;
+    _movementUpdateCacheTime = 0ms;
+    _movementUpdateCacheMoveFlags = 0;
     m_modMeleeHitChance = 0.0f;
     m_modRangedHitChance = 0.0f;
     m_modSpellHitChance = 0.0f;
@@ -369,6 +371,7 @@ Unit::~Unit()
 
     ASSERT(m_Controlled.empty());
     ASSERT(m_appliedAuras.empty());
+    ASSERT(m_procAuras.empty());
     ASSERT(m_ownedAuras.empty());
     ASSERT(m_removedAuras.empty());
     ASSERT(m_gameObj.empty());
@@ -382,7 +385,8 @@ Unit::~Unit()
 
 void Unit::Update(uint32 p_time)
 {
-    sScriptMgr->OnUnitUpdate(this, p_time);
+    if (ScriptRegistry<UnitScript>::HasEnabledHooks(UNITHOOK_ON_UNIT_UPDATE))
+        sScriptMgr->OnUnitUpdate(this, p_time);
 
     // WARNING! Order of execution here is important, do not change.
     // Spells must be processed with event system BEFORE they go to _UpdateSpells.
@@ -401,7 +405,7 @@ void Unit::Update(uint32 p_time)
             {
                 m_delayed_unit_relocation_timer = 0;
                 //ExecuteDelayedUnitRelocationEvent();
-                FindMap()->i_objectsForDelayedVisibility.insert(this);
+                FindMap()->AddObjectToDelayedVisibility(this);
             }
             else
                 m_delayed_unit_relocation_timer -= p_time;
@@ -517,6 +521,7 @@ void Unit::Update(uint32 p_time)
     GetMotionMaster()->UpdateMotion(p_time);
 
     InvalidateValuesUpdateCache();
+    InvalidateMovementUpdateCache();
 }
 
 bool Unit::haveOffhandWeapon() const
@@ -1593,7 +1598,8 @@ void Unit::CalculateMeleeDamage(Unit* victim, CalcDamageInfo* damageInfo, Weapon
         damage = damageInfo->target->MeleeDamageBonusTaken(this, damage, damageInfo->attackType, nullptr, schoolMask);
 
         // Script Hook For CalculateMeleeDamage -- Allow scripts to change the Damage pre class mitigation calculations
-        sScriptMgr->ModifyMeleeDamage(damageInfo->target, damageInfo->attacker, damage);
+        if (ScriptRegistry<UnitScript>::HasEnabledHooks(UNITHOOK_MODIFY_MELEE_DAMAGE))
+            sScriptMgr->ModifyMeleeDamage(damageInfo->target, damageInfo->attacker, damage);
 
         if (victim->GetAI())
         {
@@ -3891,13 +3897,14 @@ void Unit::_UpdateSpells(uint32 time)
         }
     }
 
-    // m_auraUpdateIterator can be updated in indirect called code at aura remove to skip next planned to update but removed auras
-    for (m_auraUpdateIterator = m_ownedAuras.begin(); m_auraUpdateIterator != m_ownedAuras.end();)
+    // m_auraUpdateIndex is shifted in indirect called code at aura add and remove, to update every remaining aura once
+    for (m_auraUpdateIndex = 0; m_auraUpdateIndex < m_ownedAuras.size();)
     {
-        Aura* i_aura = m_auraUpdateIterator->second;
-        ++m_auraUpdateIterator;                            // need shift to next for allow update if need into aura update
+        Aura* i_aura = m_ownedAuras.begin()[m_auraUpdateIndex].second;
+        ++m_auraUpdateIndex;                               // need shift to next for allow update if need into aura update
         i_aura->UpdateOwner(time, this);
     }
+    m_auraUpdateIndex = AURA_UPDATE_INDEX_NONE;
 
     // remove expired auras - do that after updates(used in scripts?)
     for (AuraMap::iterator i = m_ownedAuras.begin(); i != m_ownedAuras.end();)
@@ -4553,7 +4560,11 @@ Aura* Unit::_TryStackingOrRefreshingExistingAura(SpellInfo const* newAura, uint8
 void Unit::_AddAura(UnitAura* aura, Unit* caster)
 {
     ASSERT(!m_cleanupDone);
-    m_ownedAuras.insert(AuraMap::value_type(aura->GetId(), aura));
+    AuraMap::iterator inserted = m_ownedAuras.insert(AuraMap::value_type(aura->GetId(), aura));
+
+    // if unit currently update aura list then keep the update index on the same aura
+    if (m_auraUpdateIndex != AURA_UPDATE_INDEX_NONE && std::size_t(inserted - m_ownedAuras.begin()) < m_auraUpdateIndex)
+        ++m_auraUpdateIndex;
 
     _RemoveNoStackAurasDueToAura(aura, true);
 
@@ -4612,6 +4623,12 @@ AuraApplication* Unit::_CreateAuraApplication(Aura* aura, uint8 effMask)
     AuraApplication* aurApp = new AuraApplication(this, caster, aura, effMask);
     m_appliedAuras.insert(AuraApplicationMap::value_type(aurId, aurApp));
 
+    // proc flags come from static spell data, so they are looked up once per application
+    aurApp->_procEventFlags = aura->GetProcEventFlags();
+    aurApp->_procFlags = aura->GetProcFlags();
+    if (aurApp->_procEventFlags || aurApp->_procFlags)
+        m_procAuras.insert(AuraApplicationMap::value_type(aurId, aurApp));
+
     // xinef: do not insert our application to interruptible list if application target is not the owner (area auras)
     // xinef: even if it gets removed, it will be reapplied in a second
     if (aurSpellInfo->AuraInterruptFlags && this == aura->GetOwner())
@@ -4708,6 +4725,14 @@ void Unit::_UnapplyAura(AuraApplicationMap::iterator& i, AuraRemoveMode removeMo
     // Remove all pointers from lists here to prevent possible pointer invalidation on spellcast/auraapply/auraremove
     m_appliedAuras.erase(i);
 
+    if (aurApp->GetProcEventFlags() || aurApp->GetProcFlags())
+    {
+        AuraApplicationMapBoundsNonConst range = m_procAuras.equal_range(aura->GetId());
+        AuraApplicationMap::iterator itr = std::find_if(range.first, range.second, [aurApp](AuraApplicationMap::value_type const& pair) { return pair.second == aurApp; });
+        ASSERT(itr != range.second);
+        m_procAuras.erase(itr);
+    }
+
     // xinef: do not insert our application to interruptible list if application target is not the owner (area auras)
     // xinef: event if it gets removed, it will be reapplied in a second
     if (aura->GetSpellInfo()->AuraInterruptFlags && this == aura->GetOwner())
@@ -4832,6 +4857,15 @@ void Unit::_RegisterAuraEffect(AuraEffect* aurEff, bool apply)
         m_modAuras[aurEff->GetAuraType()].push_back(aurEff);
     else
         m_modAuras[aurEff->GetAuraType()].erase(std::remove(m_modAuras[aurEff->GetAuraType()].begin(), m_modAuras[aurEff->GetAuraType()].end(), aurEff), m_modAuras[aurEff->GetAuraType()].end());
+
+    _InvalidateAuraModifierTotals(aurEff->GetAuraType());
+}
+
+void Unit::_InvalidateAuraModifierTotals(AuraType auraType)
+{
+    auto itr = m_auraModifierTotals.find(auraType);
+    if (itr != m_auraModifierTotals.end())
+        itr->second.validMask = 0;
 }
 
 // All aura base removes should go threw this function!
@@ -4840,9 +4874,9 @@ void Unit::RemoveOwnedAura(AuraMap::iterator& i, AuraRemoveMode removeMode)
     Aura* aura = i->second;
     ASSERT(!aura->IsRemoved());
 
-    // if unit currently update aura list then make safe update iterator shift to next
-    if (m_auraUpdateIterator == i && m_auraUpdateIterator != m_ownedAuras.end())
-        ++m_auraUpdateIterator;
+    // if unit currently update aura list then keep the update index on the next aura to update
+    if (m_auraUpdateIndex != AURA_UPDATE_INDEX_NONE && std::size_t(i - m_ownedAuras.begin()) < m_auraUpdateIndex)
+        --m_auraUpdateIndex;
 
     m_ownedAuras.erase(i);
     m_removedAuras.push_back(aura);
@@ -6146,22 +6180,70 @@ int32 Unit::GetMaxNegativeAuraModifier(AuraType auraType, std::function<bool(Aur
 
 int32 Unit::GetTotalAuraModifier(AuraType auraType) const
 {
-    return GetTotalAuraModifier(auraType, [](AuraEffect const* /*aurEff*/) { return true; });
+    if (m_modAuras[auraType].empty())
+        return 0;
+
+    auto itr = m_auraModifierTotals.find(auraType);
+    if (itr != m_auraModifierTotals.end() && (itr->second.validMask & AURA_MODIFIER_TOTAL))
+        return itr->second.total;
+
+    int32 modifier = GetTotalAuraModifier(auraType, [](AuraEffect const* /*aurEff*/) { return true; });
+
+    AuraModifierTotals& totals = m_auraModifierTotals[auraType];
+    totals.total = modifier;
+    totals.validMask |= AURA_MODIFIER_TOTAL;
+    return modifier;
 }
 
 float Unit::GetTotalAuraMultiplier(AuraType auraType) const
 {
-    return GetTotalAuraMultiplier(auraType, [](AuraEffect const* /*aurEff*/) { return true; });
+    if (m_modAuras[auraType].empty())
+        return 1.0f;
+
+    auto itr = m_auraModifierTotals.find(auraType);
+    if (itr != m_auraModifierTotals.end() && (itr->second.validMask & AURA_MODIFIER_MULTIPLIER))
+        return itr->second.multiplier;
+
+    float multiplier = GetTotalAuraMultiplier(auraType, [](AuraEffect const* /*aurEff*/) { return true; });
+
+    AuraModifierTotals& totals = m_auraModifierTotals[auraType];
+    totals.multiplier = multiplier;
+    totals.validMask |= AURA_MODIFIER_MULTIPLIER;
+    return multiplier;
 }
 
 int32 Unit::GetMaxPositiveAuraModifier(AuraType auraType) const
 {
-    return GetMaxPositiveAuraModifier(auraType, [](AuraEffect const* /*aurEff*/) { return true; });
+    if (m_modAuras[auraType].empty())
+        return 0;
+
+    auto itr = m_auraModifierTotals.find(auraType);
+    if (itr != m_auraModifierTotals.end() && (itr->second.validMask & AURA_MODIFIER_MAX_POSITIVE))
+        return itr->second.maxPositive;
+
+    int32 modifier = GetMaxPositiveAuraModifier(auraType, [](AuraEffect const* /*aurEff*/) { return true; });
+
+    AuraModifierTotals& totals = m_auraModifierTotals[auraType];
+    totals.maxPositive = modifier;
+    totals.validMask |= AURA_MODIFIER_MAX_POSITIVE;
+    return modifier;
 }
 
 int32 Unit::GetMaxNegativeAuraModifier(AuraType auraType) const
 {
-    return GetMaxNegativeAuraModifier(auraType, [](AuraEffect const* /*aurEff*/) { return true; });
+    if (m_modAuras[auraType].empty())
+        return 0;
+
+    auto itr = m_auraModifierTotals.find(auraType);
+    if (itr != m_auraModifierTotals.end() && (itr->second.validMask & AURA_MODIFIER_MAX_NEGATIVE))
+        return itr->second.maxNegative;
+
+    int32 modifier = GetMaxNegativeAuraModifier(auraType, [](AuraEffect const* /*aurEff*/) { return true; });
+
+    AuraModifierTotals& totals = m_auraModifierTotals[auraType];
+    totals.maxNegative = modifier;
+    totals.validMask |= AURA_MODIFIER_MAX_NEGATIVE;
+    return modifier;
 }
 
 int32 Unit::GetTotalAuraModifierByMiscMask(AuraType auraType, uint32 miscMask) const
@@ -6634,14 +6716,72 @@ void Unit::ProcDamageAndSpell(Unit* actor, Unit* victim, uint32 procAttacker, ui
         victim->ProcDamageAndSpellFor(true, actor, procVictim, procExtra, attType, procSpellInfo, amount, procAura, procAuraEffectIndex, procSpell, damageInfo, healInfo, procPhase);
 }
 
+namespace
+{
+    thread_local PeriodicAuraLogBatch* t_periodicAuraLogBatch = nullptr;
+}
+
+PeriodicAuraLogBatch::PeriodicAuraLogBatch(Aura const* aura) : _aura(aura), _previous(t_periodicAuraLogBatch)
+{
+    t_periodicAuraLogBatch = this;
+}
+
+PeriodicAuraLogBatch::~PeriodicAuraLogBatch()
+{
+    t_periodicAuraLogBatch = _previous;
+
+    for (Entry const& entry : _entries)
+    {
+        Unit* target = ObjectAccessor::GetUnit(*_aura->GetOwner(), entry.TargetGUID);
+        if (!target)
+            continue;
+
+        WorldPacket data(SMSG_PERIODICAURALOG, 8 + 8 + 4 + 4 + entry.Data.size());
+        data << target->GetPackGUID();
+        data << _aura->GetCasterGUID().WriteAsPacked();
+        data << uint32(_aura->GetId());                         // spellId
+        data << uint32(entry.Count);                            // count
+        data.append(entry.Data);
+        target->SendMessageToSet(&data, true);
+    }
+}
+
+bool PeriodicAuraLogBatch::Add(Unit* target, SpellPeriodicAuraLogInfo const* pInfo)
+{
+    PeriodicAuraLogBatch* batch = t_periodicAuraLogBatch;
+    if (!batch || pInfo->auraEff->GetBase() != batch->_aura)
+        return false;
+
+    auto itr = std::find_if(batch->_entries.begin(), batch->_entries.end(), [target](Entry const& entry) { return entry.TargetGUID == target->GetGUID(); });
+    if (itr == batch->_entries.end())
+        itr = batch->_entries.insert(batch->_entries.end(), { target->GetGUID(), 0, ByteBuffer(32) });
+
+    if (target->BuildPeriodicAuraLogEntry(itr->Data, pInfo))
+        ++itr->Count;
+
+    return true;
+}
+
 void Unit::SendPeriodicAuraLog(SpellPeriodicAuraLogInfo* pInfo)
 {
+    if (PeriodicAuraLogBatch::Add(this, pInfo))
+        return;
+
     AuraEffect const* aura = pInfo->auraEff;
     WorldPacket data(SMSG_PERIODICAURALOG, 30);
     data << GetPackGUID();
     data << aura->GetCasterGUID().WriteAsPacked();
     data << uint32(aura->GetId());                          // spellId
     data << uint32(1);                                      // count
+    if (!BuildPeriodicAuraLogEntry(data, pInfo))
+        return;
+
+    SendMessageToSet(&data, true);
+}
+
+bool Unit::BuildPeriodicAuraLogEntry(ByteBuffer& data, SpellPeriodicAuraLogInfo const* pInfo) const
+{
+    AuraEffect const* aura = pInfo->auraEff;
     data << uint32(aura->GetAuraType());                    // auraId
     switch (aura->GetAuraType())
     {
@@ -6684,10 +6824,10 @@ void Unit::SendPeriodicAuraLog(SpellPeriodicAuraLogInfo* pInfo)
             break;
         default:
             LOG_ERROR("entities.unit", "Unit::SendPeriodicAuraLog: unknown aura {}", uint32(aura->GetAuraType()));
-            return;
+            return false;
     }
 
-    SendMessageToSet(&data, true);
+    return true;
 }
 
 void Unit::SendSpellMiss(Unit* target, uint32 spellID, SpellMissInfo missInfo)
@@ -10556,6 +10696,7 @@ bool Unit::Attack(Unit* victim, bool meleeAttack)
 
     m_attacking = victim;
     m_attacking->_addAttacker(this);
+    InvalidateMovementUpdateCache();
 
     // Set our target
     SetTarget(victim->GetGUID());
@@ -10634,6 +10775,7 @@ bool Unit::AttackStop()
 
     m_attacking->_removeAttacker(this);
     m_attacking = nullptr;
+    InvalidateMovementUpdateCache();
 
     // Clear our target
     SetTarget(ObjectGuid::Empty);
@@ -14623,6 +14765,7 @@ void Unit::SetSpeed(UnitMoveType mtype, float rate, bool forced)
         return;
 
     m_speed_rate[mtype] = rate;
+    InvalidateMovementUpdateCache();
 
     propagateSpeedChange();
 
@@ -16095,7 +16238,7 @@ struct ProcTriggeredData
     }
 };
 
-typedef std::list< ProcTriggeredData > ProcTriggeredList;
+typedef Acore::FrameList<ProcTriggeredData> ProcTriggeredList;
 
 // List of auras that CAN be trigger but may not exist in spell_proc_event
 // in most case need for drop charges
@@ -16387,10 +16530,14 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
 
     ProcEventInfo eventInfo = ProcEventInfo(actor, actionTarget, target, procFlag, 0, procPhase, procExtra, procSpell, damageInfo, healInfo, procAura, procAuraEffectIndex);
 
-    ProcTriggeredList procTriggered;
+    ProcTriggeredList procTriggered(Acore::FrameArena::GetResource());
     // Fill procTriggered list
-    for (AuraApplicationMap::const_iterator itr = GetAppliedAuras().begin(); itr != GetAppliedAuras().end(); ++itr)
+    for (AuraApplicationMap::const_iterator itr = m_procAuras.begin(); itr != m_procAuras.end(); ++itr)
     {
+        // The aura has no proc flag of this event, it would fail IsTriggeredAtSpellProcEvent
+        if (!(itr->second->GetProcEventFlags() & procFlag))
+            continue;
+
         // Do not allow auras to proc from effect triggered by itself
         if (procAura && procAura->Id == itr->first)
             continue;
@@ -16750,7 +16897,7 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
         SetCantProc(false);
 }
 
-void Unit::GetProcAurasTriggeredOnEvent(std::list<AuraApplication*>& aurasTriggeringProc, std::list<AuraApplication*>* procAuras, ProcEventInfo eventInfo)
+void Unit::GetProcAurasTriggeredOnEvent(Acore::FrameList<AuraApplication*>& aurasTriggeringProc, std::list<AuraApplication*>* procAuras, ProcEventInfo eventInfo)
 {
     // use provided list of auras which can proc
     if (procAuras)
@@ -16769,8 +16916,12 @@ void Unit::GetProcAurasTriggeredOnEvent(std::list<AuraApplication*>& aurasTrigge
     // or generate one on our own
     else
     {
-        for (AuraApplicationMap::iterator itr = GetAppliedAuras().begin(); itr != GetAppliedAuras().end(); ++itr)
+        for (AuraApplicationMap::iterator itr = m_procAuras.begin(); itr != m_procAuras.end(); ++itr)
         {
+            // The aura has no proc flag of this event, it would fail SpellMgr::CanSpellTriggerProcOnEvent
+            if (!(itr->second->GetProcFlags() & eventInfo.GetTypeMask()))
+                continue;
+
             if (itr->second->GetBase()->IsProcTriggeredOnEvent(itr->second, eventInfo))
             {
                 itr->second->GetBase()->PrepareProcToTrigger(itr->second, eventInfo);
@@ -16790,12 +16941,12 @@ void Unit::TriggerAurasProcOnEvent(std::list<AuraApplication*>* myProcAuras, std
 {
     // prepare data for self trigger
     ProcEventInfo myProcEventInfo = ProcEventInfo(this, actionTarget, actionTarget, typeMaskActor, spellTypeMask, spellPhaseMask, hitMask, spell, damageInfo, healInfo);
-    std::list<AuraApplication*> myAurasTriggeringProc;
+    Acore::FrameList<AuraApplication*> myAurasTriggeringProc(Acore::FrameArena::GetResource());
     GetProcAurasTriggeredOnEvent(myAurasTriggeringProc, myProcAuras, myProcEventInfo);
 
     // prepare data for target trigger
     ProcEventInfo targetProcEventInfo = ProcEventInfo(this, actionTarget, this, typeMaskActionTarget, spellTypeMask, spellPhaseMask, hitMask, spell, damageInfo, healInfo);
-    std::list<AuraApplication*> targetAurasTriggeringProc;
+    Acore::FrameList<AuraApplication*> targetAurasTriggeringProc(Acore::FrameArena::GetResource());
     if (typeMaskActionTarget)
         GetProcAurasTriggeredOnEvent(targetAurasTriggeringProc, targetProcAuras, targetProcEventInfo);
 
@@ -16805,9 +16956,9 @@ void Unit::TriggerAurasProcOnEvent(std::list<AuraApplication*>* myProcAuras, std
         TriggerAurasProcOnEvent(targetProcEventInfo, targetAurasTriggeringProc);
 }
 
-void Unit::TriggerAurasProcOnEvent(ProcEventInfo& eventInfo, std::list<AuraApplication*>& aurasTriggeringProc)
+void Unit::TriggerAurasProcOnEvent(ProcEventInfo& eventInfo, Acore::FrameList<AuraApplication*>& aurasTriggeringProc)
 {
-    for (std::list<AuraApplication*>::iterator itr = aurasTriggeringProc.begin(); itr != aurasTriggeringProc.end(); ++itr)
+    for (Acore::FrameList<AuraApplication*>::iterator itr = aurasTriggeringProc.begin(); itr != aurasTriggeringProc.end(); ++itr)
     {
         if (!(*itr)->GetRemoveMode())
             (*itr)->GetBase()->TriggerProcOnEvent(*itr, eventInfo);
@@ -19353,10 +19504,7 @@ void Unit::SetPhaseMask(uint32 newPhaseMask, bool update)
                 ThreatContainer::StorageType threatList = GetThreatMgr().GetThreatList();
                 ThreatContainer::StorageType offlineThreatList = GetThreatMgr().GetOfflineThreatList();
 
-                // merge expects sorted lists
-                threatList.sort();
-                offlineThreatList.sort();
-                threatList.merge(offlineThreatList);
+                threatList.insert(threatList.end(), offlineThreatList.begin(), offlineThreatList.end());
 
                 for (ThreatContainer::StorageType::const_iterator itr = threatList.begin(); itr != threatList.end(); ++itr)
                     if (Unit* unit = (*itr)->getTarget())
@@ -19406,8 +19554,8 @@ void Unit::UpdateObjectVisibility(bool forced, bool /*fromUpdate*/)
     else
     {
         WorldObject::UpdateObjectVisibility(true);
-        Acore::AIRelocationNotifier notifier(*this);
         float radius = 60.0f;
+        Acore::AIRelocationNotifier notifier(*this, radius);
         Cell::VisitObjects(this, notifier, radius);
     }
 }
@@ -20472,10 +20620,14 @@ void Unit::ExecuteDelayedUnitRelocationEvent()
 
         GetMap()->LoadGridsInRange(*player, MAX_VISIBILITY_DISTANCE);
 
-        Acore::PlayerRelocationNotifier notifier(*player);
+        Acore::VisibilityPassDelta delta;
+        bool const incremental = player->GetVisibilityPassDelta(viewPoint, delta);
+
+        Acore::PlayerRelocationNotifier notifier(*player, incremental ? &delta : nullptr);
         Cell::VisitObjects(viewPoint, notifier, player->GetSightRange());
         Cell::VisitFarVisibleObjects(viewPoint, notifier, VISIBILITY_DISTANCE_GIGANTIC);
         notifier.SendToSelf();
+        player->SetVisibilityPassDone(viewPoint, !incremental);
 
         this->AddToNotify(NOTIFY_AI_RELOCATION);
     }
@@ -20507,8 +20659,8 @@ void Unit::ExecuteDelayedUnitAINotifyEvent()
     if (!this->IsInWorld() || this->IsDuringRemoveFromWorld())
         return;
 
-    Acore::AIRelocationNotifier notifier(*this);
     float radius = 60.0f;
+    Acore::AIRelocationNotifier notifier(*this, radius);
     Cell::VisitObjects(this, notifier, radius);
 }
 
@@ -20865,79 +21017,82 @@ void Unit::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target)
     ByteBuffer fieldBuffer(400);
 
     UpdateMask updateMask;
-    updateMask.SetCount(m_valuesCount);
+    BuildValuesUpdateMask(updateType, flags, visibleFlag, updateMask);
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    // special info fields are sent even unchanged, as is the aura state while it holds per caster states
+    if (visibleFlag & UF_FLAG_SPECIAL_INFO)
     {
-        if (_fieldNotifyFlags & flags[index] ||
-                ((flags[index] & visibleFlag) & UF_FLAG_SPECIAL_INFO) ||
-                ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)) ||
-                (index == UNIT_FIELD_AURASTATE && HasFlag(UNIT_FIELD_AURASTATE, PER_CASTER_AURA_STATE_MASK)))
-        {
-            updateMask.SetBit(index);
+        UpdateMask specialInfoMask;
+        BuildUpdateFieldFlagMask(flags, m_valuesCount, UF_FLAG_SPECIAL_INFO, specialInfoMask);
+        updateMask |= specialInfoMask;
+    }
 
-            if (index == UNIT_NPC_FLAGS)
-            {
-                cacheValue.posPointers.UnitNPCFlagsPos = int32(fieldBuffer.wpos());
-                fieldBuffer << m_uint32Values[UNIT_NPC_FLAGS];
-            }
-            else if (index == UNIT_FIELD_AURASTATE)
-            {
-                cacheValue.posPointers.UnitFieldAuraStatePos = int32(fieldBuffer.wpos());
-                fieldBuffer << uint32(0); // Fill in later.
-            }
-            // FIXME: Some values at server stored in float format but must be sent to client in uint32 format
-            else if (index >= UNIT_FIELD_BASEATTACKTIME && index <= UNIT_FIELD_RANGEDATTACKTIME)
-            {
-                // convert from float to uint32 and send
-                fieldBuffer << uint32(m_floatValues[index] < 0 ? 0 : m_floatValues[index]);
-            }
-            // there are some float values which may be negative or can't get negative due to other checks
-            else if ((index >= UNIT_FIELD_NEGSTAT0   && index <= UNIT_FIELD_NEGSTAT4) ||
-                     (index >= UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE  && index <= (UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE + 6)) ||
-                     (index >= UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE  && index <= (UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE + 6)) ||
-                     (index >= UNIT_FIELD_POSSTAT0   && index <= UNIT_FIELD_POSSTAT4))
-            {
-                fieldBuffer << uint32(m_floatValues[index]);
-            }
-            // Gamemasters should be always able to select units - remove not selectable flag
-            else if (index == UNIT_FIELD_FLAGS)
-            {
-                cacheValue.posPointers.UnitFieldFlagsPos = int32(fieldBuffer.wpos());
-                fieldBuffer << m_uint32Values[UNIT_FIELD_FLAGS];
-            }
-            // use modelid_a if not gm, _h if gm for CREATURE_FLAG_EXTRA_TRIGGER creatures
-            else if (index == UNIT_FIELD_DISPLAYID)
-            {
-                cacheValue.posPointers.UnitFieldDisplayPos = int32(fieldBuffer.wpos());
-                fieldBuffer << m_uint32Values[UNIT_FIELD_DISPLAYID];
-            }
-            else if (index == UNIT_DYNAMIC_FLAGS)
-            {
-                cacheValue.posPointers.UnitDynamicFlagsPos = int32(fieldBuffer.wpos());
-                uint32 dynamicFlags = m_uint32Values[UNIT_DYNAMIC_FLAGS] & ~(UNIT_DYNFLAG_TAPPED | UNIT_DYNFLAG_TAPPED_BY_PLAYER);
-                fieldBuffer << dynamicFlags;
-            }
-            else if (index == UNIT_FIELD_BYTES_2)
-            {
-                cacheValue.posPointers.UnitFieldBytes2Pos = int32(fieldBuffer.wpos());
-                fieldBuffer << m_uint32Values[index];
-            }
-            else if (index == UNIT_FIELD_FACTIONTEMPLATE)
-            {
-                cacheValue.posPointers.UnitFieldFactionTemplatePos = int32(fieldBuffer.wpos());
-                fieldBuffer << m_uint32Values[index];
-            }
-            else
-            {
-                if (sScriptMgr->ShouldTrackValuesUpdatePosByIndex(this, updateType, index))
-                    cacheValue.posPointers.other[index] = static_cast<uint32>(fieldBuffer.wpos());
+    if (HasFlag(UNIT_FIELD_AURASTATE, PER_CASTER_AURA_STATE_MASK))
+        updateMask.SetBit(UNIT_FIELD_AURASTATE);
 
-                // send in current format (float as float, uint32 as uint32)
-                fieldBuffer << m_uint32Values[index];
-            }
+    updateMask.ForEachSetBit([&](uint32 index)
+    {
+        if (index == UNIT_NPC_FLAGS)
+        {
+            cacheValue.posPointers.UnitNPCFlagsPos = int32(fieldBuffer.wpos());
+            fieldBuffer << m_uint32Values[UNIT_NPC_FLAGS];
         }
-    }
+        else if (index == UNIT_FIELD_AURASTATE)
+        {
+            cacheValue.posPointers.UnitFieldAuraStatePos = int32(fieldBuffer.wpos());
+            fieldBuffer << uint32(0); // Fill in later.
+        }
+        // FIXME: Some values at server stored in float format but must be sent to client in uint32 format
+        else if (index >= UNIT_FIELD_BASEATTACKTIME && index <= UNIT_FIELD_RANGEDATTACKTIME)
+        {
+            // convert from float to uint32 and send
+            fieldBuffer << uint32(m_floatValues[index] < 0 ? 0 : m_floatValues[index]);
+        }
+        // there are some float values which may be negative or can't get negative due to other checks
+        else if ((index >= UNIT_FIELD_NEGSTAT0   && index <= UNIT_FIELD_NEGSTAT4) ||
+                 (index >= UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE  && index <= (UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE + 6)) ||
+                 (index >= UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE  && index <= (UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE + 6)) ||
+                 (index >= UNIT_FIELD_POSSTAT0   && index <= UNIT_FIELD_POSSTAT4))
+        {
+            fieldBuffer << uint32(m_floatValues[index]);
+        }
+        // Gamemasters should be always able to select units - remove not selectable flag
+        else if (index == UNIT_FIELD_FLAGS)
+        {
+            cacheValue.posPointers.UnitFieldFlagsPos = int32(fieldBuffer.wpos());
+            fieldBuffer << m_uint32Values[UNIT_FIELD_FLAGS];
+        }
+        // use modelid_a if not gm, _h if gm for CREATURE_FLAG_EXTRA_TRIGGER creatures
+        else if (index == UNIT_FIELD_DISPLAYID)
+        {
+            cacheValue.posPointers.UnitFieldDisplayPos = int32(fieldBuffer.wpos());
+            fieldBuffer << m_uint32Values[UNIT_FIELD_DISPLAYID];
+        }
+        else if (index == UNIT_DYNAMIC_FLAGS)
+        {
+            cacheValue.posPointers.UnitDynamicFlagsPos = int32(fieldBuffer.wpos());
+            uint32 dynamicFlags = m_uint32Values[UNIT_DYNAMIC_FLAGS] & ~(UNIT_DYNFLAG_TAPPED | UNIT_DYNFLAG_TAPPED_BY_PLAYER);
+            fieldBuffer << dynamicFlags;
+        }
+        else if (index == UNIT_FIELD_BYTES_2)
+        {
+            cacheValue.posPointers.UnitFieldBytes2Pos = int32(fieldBuffer.wpos());
+            fieldBuffer << m_uint32Values[index];
+        }
+        else if (index == UNIT_FIELD_FACTIONTEMPLATE)
+        {
+            cacheValue.posPointers.UnitFieldFactionTemplatePos = int32(fieldBuffer.wpos());
+            fieldBuffer << m_uint32Values[index];
+        }
+        else
+        {
+            if (sScriptMgr->ShouldTrackValuesUpdatePosByIndex(this, updateType, index))
+                cacheValue.posPointers.other[index] = static_cast<uint32>(fieldBuffer.wpos());
+
+            // send in current format (float as float, uint32 as uint32)
+            fieldBuffer << m_uint32Values[index];
+        }
+    });
 
     cacheValue.buffer << uint8(updateMask.GetBlockCount());
     updateMask.AppendToPacket(&cacheValue.buffer);
@@ -20957,6 +21112,30 @@ void Unit::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target)
     _valuesUpdateCache.insert(std::pair<uint64, BuildValuesCachedBuffer>(cacheKey, std::move(cacheValue)));
 }
 
+void Unit::BuildCachedMovementUpdate(ByteBuffer* data, uint16 flags)
+{
+    // Spline progress, position and movement flags all end up in the block, drop it as soon as any of them moved on
+    Milliseconds now = GameTime::GetGameTimeMS();
+    if (_movementUpdateCacheTime != now || _movementUpdateCacheMoveFlags != m_movementInfo.GetMovementFlags() ||
+        _movementUpdateCachePosition != GetPosition())
+    {
+        _movementUpdateCache.clear();
+        _movementUpdateCacheTime = now;
+        _movementUpdateCacheMoveFlags = m_movementInfo.GetMovementFlags();
+        _movementUpdateCachePosition = GetPosition();
+    }
+
+    auto cacheIt = _movementUpdateCache.find(flags);
+    if (cacheIt == _movementUpdateCache.end())
+    {
+        ByteBuffer block(150);
+        BuildMovementUpdate(&block, flags);
+        cacheIt = _movementUpdateCache.emplace(flags, std::move(block)).first;
+    }
+
+    data->append(cacheIt->second);
+}
+
 void Unit::PatchValuesUpdate(ByteBuffer& valuesUpdateBuf, BuildValuesCachePosPointers& posPointers, Player* target)
 {
     Creature const* creature = ToCreature();
@@ -18,10 +18,14 @@
 #ifndef __UNIT_H
 #define __UNIT_H
 
+#include "ByteBuffer.h"
 #include "EnumFlag.h"
 #include "EventProcessor.h"
+#include "FlatHashMap.h"
+#include "FlatMultiMap.h"
 #include "FollowerRefMgr.h"
 #include "FollowerReference.h"
+#include "FrameArena.h"
 #include "HostileRefMgr.h"
 #include "ItemTemplate.h"
 #include "MotionMaster.h"
@@ -530,6 +534,33 @@ struct SpellPeriodicAuraLogInfo
     bool   critical;
 };
 
+// Collects the SMSG_PERIODICAURALOG entries of the effects of an aura ticking in the same update,
+// each target then gets one packet listing all of them instead of one packet per effect
+class PeriodicAuraLogBatch
+{
+public:
+    explicit PeriodicAuraLogBatch(Aura const* aura);
+    ~PeriodicAuraLogBatch();
+
+    PeriodicAuraLogBatch(PeriodicAuraLogBatch const&) = delete;
+    PeriodicAuraLogBatch& operator=(PeriodicAuraLogBatch const&) = delete;
+
+    // returns false if the entry does not belong to the aura of the innermost batch
+    static bool Add(Unit* target, SpellPeriodicAuraLogInfo const* pInfo);
+
+private:
+    struct Entry
+    {
+        ObjectGuid TargetGUID;
+        uint32 Count;
+        ByteBuffer Data;
+    };
+
+    Aura const* _aura;
+    PeriodicAuraLogBatch* _previous;
+    std::vector<Entry> _entries;
+};
+
 void createProcFlags(SpellInfo const* spellInfo, WeaponAttackType attackType, bool positive, uint32& procAttacker, uint32& procVictim);
 uint32 createProcExtendMask(SpellNonMeleeDamage* damageInfo, SpellMissInfo missCondition);
 
@@ -658,11 +689,14 @@ public:
     typedef std::unordered_set<Unit*> AttackerSet;
     typedef std::set<Unit*> ControlSet;
 
-    typedef std::multimap<uint32,  Aura*> AuraMap;
+    // Sorted by spell id in contiguous storage, raid members rarely carry more than AURA_MAP_INLINE_CAPACITY auras
+    static constexpr std::size_t AURA_MAP_INLINE_CAPACITY = 16;
+
+    typedef Acore::FlatMultiMap<uint32, Aura*, AURA_MAP_INLINE_CAPACITY> AuraMap;
     typedef std::pair<AuraMap::const_iterator, AuraMap::const_iterator> AuraMapBounds;
     typedef std::pair<AuraMap::iterator, AuraMap::iterator> AuraMapBoundsNonConst;
 
-    typedef std::multimap<uint32,  AuraApplication*> AuraApplicationMap;
+    typedef Acore::FlatMultiMap<uint32, AuraApplication*, AURA_MAP_INLINE_CAPACITY> AuraApplicationMap;
     typedef std::pair<AuraApplicationMap::const_iterator, AuraApplicationMap::const_iterator> AuraApplicationMapBounds;
     typedef std::pair<AuraApplicationMap::iterator, AuraApplicationMap::iterator> AuraApplicationMapBoundsNonConst;
 
@@ -1354,6 +1388,7 @@ public:
     void _RemoveNoStackAurasDueToAura(Aura* aura, bool owned);
     bool _IsNoStackAuraDueToAura(Aura* appliedAura, Aura* existingAura) const;
     void _RegisterAuraEffect(AuraEffect* aurEff, bool apply);
+    void _InvalidateAuraModifierTotals(AuraType auraType);
 
     // m_ownedAuras container management
     AuraMap&       GetOwnedAuras()       { return m_ownedAuras; }
@@ -1546,11 +1581,11 @@ public:
     static void ProcDamageAndSpell(Unit* actor, Unit* victim, uint32 procAttacker, uint32 procVictim, uint32 procEx, uint32 amount, WeaponAttackType attType = BASE_ATTACK, SpellInfo const* procSpellInfo = nullptr, SpellInfo const* procAura = nullptr, int8 procAuraEffectIndex = -1, Spell const* procSpell = nullptr, DamageInfo* damageInfo = nullptr, HealInfo* healInfo = nullptr, uint32 procPhase = 2 /*PROC_SPELL_PHASE_HIT*/);
     void ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, uint32 procExtra, WeaponAttackType attType, SpellInfo const* procSpellInfo, uint32 damage, SpellInfo const* procAura = nullptr, int8 procAuraEffectIndex = -1, Spell const* procSpell = nullptr, DamageInfo* damageInfo = nullptr, HealInfo* healInfo = nullptr, uint32 procPhase = 2 /*PROC_SPELL_PHASE_HIT*/);
 
-    void GetProcAurasTriggeredOnEvent(std::list<AuraApplication*>& aurasTriggeringProc, std::list<AuraApplication*>* procAuras, ProcEventInfo eventInfo);
+    void GetProcAurasTriggeredOnEvent(Acore::FrameList<AuraApplication*>& aurasTriggeringProc, std::list<AuraApplication*>* procAuras, ProcEventInfo eventInfo);
 
     void TriggerAurasProcOnEvent(CalcDamageInfo& damageInfo);
     void TriggerAurasProcOnEvent(std::list<AuraApplication*>* myProcAuras, std::list<AuraApplication*>* targetProcAuras, Unit* actionTarget, uint32 typeMaskActor, uint32 typeMaskActionTarget, uint32 spellTypeMask, uint32 spellPhaseMask, uint32 hitMask, Spell* spell, DamageInfo* damageInfo, HealInfo* healInfo);
-    void TriggerAurasProcOnEvent(ProcEventInfo& eventInfo, std::list<AuraApplication*>& procAuras);
+    void TriggerAurasProcOnEvent(ProcEventInfo& eventInfo, Acore::FrameList<AuraApplication*>& procAuras);
 
     [[nodiscard]] float GetWeaponProcChance() const;
     float GetPPMProcChance(uint32 WeaponSpeed, float PPM,  SpellInfo const* spellProto) const;
@@ -2017,6 +2052,7 @@ public:
     void SendPetAIReaction(ObjectGuid guid) const;
 
     void SendPeriodicAuraLog(SpellPeriodicAuraLogInfo* pInfo);
+    bool BuildPeriodicAuraLogEntry(ByteBuffer& data, SpellPeriodicAuraLogInfo const* pInfo) const;
 
     void SendSpellNonMeleeDamageLog(SpellNonMeleeDamage* log);
     void SendSpellNonMeleeReflectLog(SpellNonMeleeDamage* log, Unit* attacker);
@@ -2057,6 +2093,14 @@ public:
 
     ControlSet m_Controlled;
 
+    // Nearest target found by an aggressive summon of this unit, reused by its other summons for a short time
+    struct ControlledTargetSearch
+    {
+        ObjectGuid Target;
+        uint32 Time = 0;
+    };
+    ControlledTargetSearch m_controlledTargetSearch;
+
     SafeUnitPointer m_movedByPlayer;
 
     ObjectGuid m_SummonSlot[MAX_SUMMON_SLOT];
@@ -2096,6 +2140,10 @@ public:
     // Movement info
     Movement::MoveSpline* movespline;
 
+    // Movement part of a create block, shared by all players that start seeing this creature in the same tick
+    void BuildCachedMovementUpdate(ByteBuffer* data, uint16 flags);
+    void InvalidateMovementUpdateCache() { _movementUpdateCache.clear(); }
+
 protected:
     explicit Unit();
 
@@ -2148,11 +2196,34 @@ protected:
 
     AuraMap m_ownedAuras;
     AuraApplicationMap m_appliedAuras;
+    AuraApplicationMap m_procAuras;            // applications of m_appliedAuras with proc flags, the only ones looked at on proc events
     AuraList m_removedAuras;
-    AuraMap::iterator m_auraUpdateIterator;
+    static constexpr std::size_t AURA_UPDATE_INDEX_NONE = std::size_t(-1);
+    std::size_t m_auraUpdateIndex;             // next owned aura to update, AURA_UPDATE_INDEX_NONE out of _UpdateSpells
     uint32 m_removedAurasCount;
 
     AuraEffectList m_modAuras[TOTAL_AURAS];
+
+    // Results of the GetTotalAuraModifier family without predicate, reset for an aura type when its effects register or change amount
+    enum AuraModifierTotalFlags : uint8
+    {
+        AURA_MODIFIER_TOTAL        = 0x01,
+        AURA_MODIFIER_MULTIPLIER   = 0x02,
+        AURA_MODIFIER_MAX_POSITIVE = 0x04,
+        AURA_MODIFIER_MAX_NEGATIVE = 0x08
+    };
+
+    struct AuraModifierTotals
+    {
+        uint8 validMask = 0;
+        int32 total = 0;
+        float multiplier = 1.0f;
+        int32 maxPositive = 0;
+        int32 maxNegative = 0;
+    };
+
+    mutable Acore::FlatHashMap<uint32, AuraModifierTotals> m_auraModifierTotals;
+
     AuraList m_scAuras;                        // casted singlecast auras
     AuraApplicationList m_interruptableAuras;  // auras which have interrupt mask applied on unit
     AuraStateAurasMap m_auraStateAuras;        // Used for improve performance of aura state checks on aura apply/remove
@@ -2242,6 +2313,12 @@ private:
 
     typedef std::unordered_map<uint64 /*visibleFlag(uint32) + updateType(uint8)*/, BuildValuesCachedBuffer>  ValuesUpdateCache;
     ValuesUpdateCache _valuesUpdateCache;
+
+    typedef std::unordered_map<uint16 /*update flags*/, ByteBuffer> MovementUpdateCache;
+    MovementUpdateCache _movementUpdateCache;
+    Milliseconds _movementUpdateCacheTime;  ///< game time the cached blocks were built at
+    Position _movementUpdateCachePosition;
+    uint32 _movementUpdateCacheMoveFlags;
 };
 
 namespace Acore
@@ -27,6 +27,7 @@
 #include "Unit.h"
 #include "Util.h"
 #include <algorithm>
+#include <array>
 
 Vehicle::Vehicle(Unit* unit, VehicleEntry const* vehInfo, uint32 creatureEntry) :
     _me(unit), _vehicleInfo(vehInfo), _usableSeatNum(0), _creatureEntry(creatureEntry), _status(STATUS_NONE)
@@ -518,12 +519,16 @@ void Vehicle::RelocatePassengers()
 {
     ASSERT(_me->GetMap());
 
-    std::vector<std::pair<Unit*, Position>> seatRelocation;
-    seatRelocation.reserve(Seats.size());
+    // called on every move of the base, seats are built from the MAX_VEHICLE_SEATS of the vehicle entry
+    std::array<std::pair<Unit*, Position>, MAX_VEHICLE_SEATS> seatRelocation;
+    std::size_t seatCount = 0;
 
     // not sure that absolute position calculation is correct, it must depend on vehicle pitch angle
     for (auto const& itr : Seats)
     {
+        if (itr.second.IsEmpty())
+            continue;
+
         if (Unit* passenger = ObjectAccessor::GetUnit(*GetBase(), itr.second.Passenger.Guid))
         {
             ASSERT(passenger->IsInWorld());
@@ -531,12 +536,12 @@ void Vehicle::RelocatePassengers()
             float px, py, pz, po;
             passenger->m_movementInfo.transport.pos.GetPosition(px, py, pz, po);
             CalculatePassengerPosition(px, py, pz, &po);
-            seatRelocation.emplace_back(passenger, Position(px, py, pz, po));
+            seatRelocation[seatCount++] = { passenger, Position(px, py, pz, po) };
         }
     }
 
-    for (auto const& pair : seatRelocation)
-        pair.first->UpdatePosition(pair.second);
+    for (std::size_t i = 0; i < seatCount; ++i)
+        seatRelocation[i].first->UpdatePosition(seatRelocation[i].second);
 }
 
 void Vehicle::Dismiss()
@@ -1433,6 +1433,99 @@ void GameEventMgr::UpdateEventNPCVendor(uint16 eventId, bool activate)
     }
 }
 
+namespace
+{
+    struct EventSpawnQueue
+    {
+        std::vector<ObjectGuid::LowType> Creatures;
+        std::vector<ObjectGuid::LowType> GameObjects;
+        std::size_t Next = 0;
+    };
+
+    EventSpawnQueue& GetSpawnQueue(std::unordered_map<Map*, std::shared_ptr<EventSpawnQueue>>& queues, Map* map)
+    {
+        std::shared_ptr<EventSpawnQueue>& queue = queues[map];
+        if (!queue)
+            queue = std::make_shared<EventSpawnQueue>();
+
+        return *queue;
+    }
+
+    bool IsEventSpawnInGrid(Map* map, ObjectGuid::LowType spawnId, float x, float y, bool creature)
+    {
+        // the grid was unloaded since it was queued
+        if (!map->IsGridLoaded(x, y))
+            return false;
+
+        // or the object was unspawned by the stop of its event
+        std::shared_ptr<CellObjectGuids const> cellGuids = sObjectMgr->GetGridObjectGuids(map->GetId(), map->GetSpawnMode(), Acore::ComputeGridCoord(x, y).GetId());
+        return CellObjectGuids::Contains(creature ? cellGuids->creatures : cellGuids->gameobjects, spawnId);
+    }
+
+    void SpawnEventObject(Map* map, ObjectGuid::LowType spawnId, bool creature)
+    {
+        if (creature)
+        {
+            CreatureData const* data = sObjectMgr->GetCreatureData(spawnId);
+            // skip it if the grid loader spawned it meanwhile
+            if (!data || !IsEventSpawnInGrid(map, spawnId, data->posX, data->posY, true) || map->GetCreatureBySpawnIdStore().count(spawnId))
+                return;
+
+            Creature* creature = new Creature;
+            if (!creature->LoadCreatureFromDB(spawnId, map))
+                delete creature;
+
+            return;
+        }
+
+        GameObjectData const* data = sObjectMgr->GetGameObjectData(spawnId);
+        if (!data || !IsEventSpawnInGrid(map, spawnId, data->posX, data->posY, false) || map->GetGameObjectBySpawnIdStore().count(spawnId))
+            return;
+
+        GameObject* pGameobject = sObjectMgr->IsGameObjectStaticTransport(data->id) ? new StaticTransport() : new GameObject();
+        //TODO: find out when it is add to map
+        if (!pGameobject->LoadGameObjectFromDB(spawnId, map, false))
+            delete pGameobject;
+        else
+        {
+            if (pGameobject->isSpawnedByDefault())
+                map->AddToMap(pGameobject);
+        }
+    }
+
+    // spawns up to Event.SpawnsPerMapUpdate objects and requeues the rest for the next update of the map
+    void ScheduleEventSpawns(Map* map, std::shared_ptr<EventSpawnQueue> queue)
+    {
+        uint32 const batchSize = sWorld->getIntConfig(CONFIG_EVENT_SPAWNS_PER_MAP_UPDATE);
+        if (!batchSize)
+        {
+            for (ObjectGuid::LowType spawnId : queue->Creatures)
+                SpawnEventObject(map, spawnId, true);
+
+            for (ObjectGuid::LowType spawnId : queue->GameObjects)
+                SpawnEventObject(map, spawnId, false);
+
+            return;
+        }
+
+        map->Events.AddEventAtOffset([map, queue, batchSize]()
+        {
+            std::size_t const total = queue->Creatures.size() + queue->GameObjects.size();
+            std::size_t const end = std::min<std::size_t>(queue->Next + batchSize, total);
+            for (; queue->Next < end; ++queue->Next)
+            {
+                if (queue->Next < queue->Creatures.size())
+                    SpawnEventObject(map, queue->Creatures[queue->Next], true);
+                else
+                    SpawnEventObject(map, queue->GameObjects[queue->Next - queue->Creatures.size()], false);
+            }
+
+            if (queue->Next < total)
+                ScheduleEventSpawns(map, queue);
+        }, 1ms);
+    }
+}
+
 void GameEventMgr::GameEventSpawn(int16 eventId)
 {
     int32 internal_event_id = _gameEvent.size() + eventId - 1;
@@ -1444,6 +1537,9 @@ void GameEventMgr::GameEventSpawn(int16 eventId)
         return;
     }
 
+    // objects of loaded grids are spawned by their map thread, a batch per map update
+    std::unordered_map<Map*, std::shared_ptr<EventSpawnQueue>> spawnQueues;
+
     for (GuidLowList::iterator itr = GameEventCreatureGuids[internal_event_id].begin(); itr != GameEventCreatureGuids[internal_event_id].end(); ++itr)
     {
         // Add to correct cell
@@ -1455,11 +1551,7 @@ void GameEventMgr::GameEventSpawn(int16 eventId)
             Map* map = sMapMgr->CreateBaseMap(data->mapid);
             // We use spawn coords to spawn
             if (!map->Instanceable() && map->IsGridLoaded(data->posX, data->posY))
-            {
-                Creature* creature = new Creature;
-                if (!creature->LoadCreatureFromDB(*itr, map))
-                    delete creature;
-            }
+                GetSpawnQueue(spawnQueues, map).Creatures.push_back(*itr);
         }
     }
 
@@ -1481,20 +1573,13 @@ void GameEventMgr::GameEventSpawn(int16 eventId)
             Map* map = sMapMgr->CreateBaseMap(data->mapid);
             // We use current coords to unspawn, not spawn coords since creature can have changed grid
             if (!map->Instanceable() && map->IsGridLoaded(data->posX, data->posY))
-            {
-                GameObject* pGameobject = sObjectMgr->IsGameObjectStaticTransport(data->id) ? new StaticTransport() : new GameObject();
-                //TODO: find out when it is add to map
-                if (!pGameobject->LoadGameObjectFromDB(*itr, map, false))
-                    delete pGameobject;
-                else
-                {
-                    if (pGameobject->isSpawnedByDefault())
-                        map->AddToMap(pGameobject);
-                }
-            }
+                GetSpawnQueue(spawnQueues, map).GameObjects.push_back(*itr);
         }
     }
 
+    for (auto& [map, queue] : spawnQueues)
+        ScheduleEventSpawns(map, std::move(queue));
+
     if (internal_event_id >= int32(_gameEventPoolIds.size()))
     {
         LOG_ERROR("gameevent", "GameEventMgr::GameEventSpawn attempt access to out of range _gameEventPoolIds element {} (size: {})",
@@ -1697,6 +1782,9 @@ bool GameEventMgr::HasGameObjectActiveEventExcept(ObjectGuid::LowType go_guid, u
 
 void GameEventMgr::UpdateEventQuests(uint16 eventId, bool activate)
 {
+    // seasonal quests and the relations of the event change for everyone
+    sObjectMgr->InvalidateQuestGiverStatuses();
+
     QuestRelList::iterator itr;
     for (itr = _gameEventCreatureQuests[eventId].begin(); itr != _gameEventCreatureQuests[eventId].end(); ++itr)
     {
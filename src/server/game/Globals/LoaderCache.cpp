@@ -0,0 +1,153 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LoaderCache.h"
+#include "CryptoHash.h"
+#include "GitRevision.h"
+#include "Log.h"
+#include "StringFormat.h"
+#include "Util.h"
+#include "World.h"
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+    constexpr uint32 LOADER_CACHE_MAGIC = 0x434C4341; // "ACLC"
+    constexpr uint32 LOADER_CACHE_VERSION = 1;
+
+    // fixed size so the records following it stay aligned in the mapped file
+    struct LoaderCacheHeader
+    {
+        uint32 Magic;
+        uint32 Version;
+        uint32 RecordSize;
+        uint32 Count;
+        char Key[48];
+    };
+
+    static_assert(sizeof(LoaderCacheHeader) == 64);
+}
+
+LoaderCache* LoaderCache::instance()
+{
+    static LoaderCache instance;
+    return &instance;
+}
+
+void LoaderCache::Initialize(std::string const& worldUpdatesHash)
+{
+    _key.clear();
+
+    if (worldUpdatesHash.empty())
+    {
+        LOG_WARN("server.loading", "Loader cache disabled, world database has no applied updates to build the cache key from.");
+        return;
+    }
+
+    // record layouts and loader checks change with the core, the revision is part of the key
+    _key = ByteArrayToHexStr(Acore::Crypto::SHA1::GetDigestOf(worldUpdatesHash, std::string_view(GitRevision::GetHash())));
+    _directory = sWorld->GetDataPath() + "cache/";
+
+    LOG_INFO("server.loading", "Loader cache enabled in '{}'.", _directory);
+}
+
+std::string LoaderCache::GetFileName(std::string_view name) const
+{
+    return Acore::StringFormat("{}{}.cache", _directory, name);
+}
+
+bool LoaderCache::LoadRaw(std::string_view name, uint32 recordSize, std::function<void(void const*, uint32)> const& assign) const
+{
+    if (!IsEnabled())
+        return false;
+
+    std::string const fileName = GetFileName(name);
+
+    std::error_code error;
+    if (!std::filesystem::exists(fileName, error))
+        return false;
+
+    boost::iostreams::mapped_file_source file;
+    try
+    {
+        file.open(fileName);
+    }
+    catch (std::exception const& e)
+    {
+        LOG_WARN("server.loading", "Loader cache: could not map '{}': {}", fileName, e.what());
+        return false;
+    }
+
+    if (file.size() < sizeof(LoaderCacheHeader))
+        return false;
+
+    LoaderCacheHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+
+    if (header.Magic != LOADER_CACHE_MAGIC || header.Version != LOADER_CACHE_VERSION || header.RecordSize != recordSize ||
+        std::string_view(header.Key, strnlen(header.Key, sizeof(header.Key))) != _key)
+    {
+        LOG_INFO("server.loading", "Loader cache '{}' is outdated, rebuilding it from the database.", name);
+        return false;
+    }
+
+    if (file.size() != sizeof(LoaderCacheHeader) + std::size_t(header.Count) * recordSize)
+    {
+        LOG_WARN("server.loading", "Loader cache '{}' is truncated, rebuilding it from the database.", name);
+        return false;
+    }
+
+    assign(file.data() + sizeof(LoaderCacheHeader), header.Count);
+    return true;
+}
+
+void LoaderCache::SaveRaw(std::string_view name, uint32 recordSize, void const* data, std::size_t count) const
+{
+    if (!IsEnabled())
+        return;
+
+    std::error_code error;
+    std::filesystem::create_directories(_directory, error);
+
+    LoaderCacheHeader header{};
+    header.Magic = LOADER_CACHE_MAGIC;
+    header.Version = LOADER_CACHE_VERSION;
+    header.RecordSize = recordSize;
+    header.Count = uint32(count);
+    std::memcpy(header.Key, _key.data(), std::min(_key.size(), sizeof(header.Key) - 1));
+
+    // written next to the old file and swapped in, a crash never leaves a half written cache behind
+    std::string const fileName = GetFileName(name);
+    std::string const tempFileName = fileName + ".tmp";
+    {
+        std::ofstream out(tempFileName, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        out.write(static_cast<char const*>(data), std::streamsize(count * recordSize));
+        if (!out)
+        {
+            LOG_WARN("server.loading", "Loader cache: could not write '{}'.", tempFileName);
+            return;
+        }
+    }
+
+    std::filesystem::rename(tempFileName, fileName, error);
+    if (error)
+        LOG_WARN("server.loading", "Loader cache: could not replace '{}': {}", fileName, error.message());
+}
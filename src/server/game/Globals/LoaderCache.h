@@ -0,0 +1,83 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _LOADERCACHE_H
+#define _LOADERCACHE_H
+
+#include "Define.h"
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * On-disk snapshots of containers filled by the startup loaders.
+ *
+ * A snapshot is a flat array of trivially copyable records stored under
+ * <DataDir>/cache/<name>.cache together with a key built from the world
+ * database updates hash and the core revision. Snapshots with another key
+ * are ignored and rewritten by the loader after it read the database.
+ * Snapshots only serve the startup, reloads always read the database.
+ */
+class AC_GAME_API LoaderCache
+{
+    LoaderCache() = default;
+    ~LoaderCache() = default;
+
+public:
+    static LoaderCache* instance();
+
+    /// Must be called before the first loader, key is the world database updates hash
+    void Initialize(std::string const& worldUpdatesHash);
+
+    /// Called once the world is initialized, the loaders called by reload commands skip the cache
+    void FinishStartup() { _key.clear(); }
+
+    [[nodiscard]] bool IsEnabled() const { return !_key.empty(); }
+
+    template<class Record>
+    bool Load(std::string_view name, std::vector<Record>& records) const
+    {
+        static_assert(std::is_trivially_copyable_v<Record>, "LoaderCache records are stored as raw memory");
+        return LoadRaw(name, sizeof(Record), [&records](void const* data, uint32 count)
+        {
+            Record const* begin = static_cast<Record const*>(data);
+            records.assign(begin, begin + count);
+        });
+    }
+
+    template<class Record>
+    void Save(std::string_view name, std::vector<Record> const& records) const
+    {
+        static_assert(std::is_trivially_copyable_v<Record>, "LoaderCache records are stored as raw memory");
+        SaveRaw(name, sizeof(Record), records.data(), records.size());
+    }
+
+private:
+    bool LoadRaw(std::string_view name, uint32 recordSize, std::function<void(void const*, uint32)> const& assign) const;
+    void SaveRaw(std::string_view name, uint32 recordSize, void const* data, std::size_t count) const;
+
+    [[nodiscard]] std::string GetFileName(std::string_view name) const;
+
+    std::string _key;
+    std::string _directory;
+};
+
+#define sLoaderCache LoaderCache::instance()
+
+#endif
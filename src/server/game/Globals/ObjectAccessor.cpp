@@ -28,6 +28,7 @@
 #include "Pet.h"
 #include "Player.h"
 #include "Transport.h"
+#include <array>
 
 template<class T>
 void HashMapHolder<T>::Insert(T* o)
@@ -39,6 +40,10 @@ void HashMapHolder<T>::Insert(T* o)
     std::unique_lock<std::shared_mutex> lock(*GetLock());
 
     GetContainer()[o->GetGUID()] = o;
+
+    Shard& shard = GetShard(o->GetGUID());
+    std::unique_lock<std::shared_mutex> shardLock(shard.Lock);
+    shard.Objects[o->GetGUID()] = o;
 }
 
 template<class T>
@@ -47,15 +52,20 @@ void HashMapHolder<T>::Remove(T* o)
     std::unique_lock<std::shared_mutex> lock(*GetLock());
 
     GetContainer().erase(o->GetGUID());
+
+    Shard& shard = GetShard(o->GetGUID());
+    std::unique_lock<std::shared_mutex> shardLock(shard.Lock);
+    shard.Objects.erase(o->GetGUID());
 }
 
 template<class T>
 T* HashMapHolder<T>::Find(ObjectGuid guid)
 {
-    std::shared_lock<std::shared_mutex> lock(*GetLock());
+    Shard& shard = GetShard(guid);
+    std::shared_lock<std::shared_mutex> lock(shard.Lock);
 
-    typename MapType::iterator itr = GetContainer().find(guid);
-    return (itr != GetContainer().end()) ? itr->second : nullptr;
+    typename MapType::iterator itr = shard.Objects.find(guid);
+    return (itr != shard.Objects.end()) ? itr->second : nullptr;
 }
 
 template<class T>
@@ -72,6 +82,13 @@ std::shared_mutex* HashMapHolder<T>::GetLock()
     return &_lock;
 }
 
+template<class T>
+auto HashMapHolder<T>::GetShard(ObjectGuid guid) -> Shard&
+{
+    static std::array<Shard, ShardCount> _shards;
+    return _shards[std::hash<ObjectGuid>()(guid) % ShardCount];
+}
+
 HashMapHolder<Player>::MapType const& ObjectAccessor::GetPlayers()
 {
     return HashMapHolder<Player>::GetContainer();
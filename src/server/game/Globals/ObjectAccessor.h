@@ -52,9 +52,22 @@ public:
 
     static T* Find(ObjectGuid guid);
 
+    // full map for iteration, guarded by GetLock()
     static MapType& GetContainer();
 
     static std::shared_mutex* GetLock();
+
+private:
+    // Find only locks the shard of the guid, so lookups from different map threads rarely meet on the same lock
+    static constexpr std::size_t ShardCount = 64;
+
+    struct alignas(64) Shard
+    {
+        std::shared_mutex Lock;
+        MapType Objects;
+    };
+
+    static Shard& GetShard(ObjectGuid guid);
 };
 
 namespace ObjectAccessor
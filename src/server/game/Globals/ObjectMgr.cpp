@@ -34,6 +34,7 @@
 #include "GroupMgr.h"
 #include "GuildMgr.h"
 #include "LFGMgr.h"
+#include "LoaderCache.h"
 #include "Log.h"
 #include "MapMgr.h"
 #include "Pet.h"
@@ -56,6 +57,25 @@
 
 #include "ItemEnchantmentMgr.h"
 
+namespace
+{
+    /// Spawn as left behind by LoadCreatures, stored by the loader cache
+    struct CreatureSpawnCacheRecord
+    {
+        ObjectGuid::LowType SpawnId;
+        bool AddToGrid;
+        CreatureData Data;
+    };
+
+    /// Spawn as left behind by LoadGameobjects, stored by the loader cache
+    struct GameObjectSpawnCacheRecord
+    {
+        ObjectGuid::LowType SpawnId;
+        bool AddToGrid;
+        GameObjectData Data;
+    };
+}
+
 ScriptMapMap sSpellScripts;
 ScriptMapMap sEventScripts;
 ScriptMapMap sWaypointScripts;
@@ -305,6 +325,8 @@ ObjectMgr::ObjectMgr():
     _gameObjectSpawnId(1),
     DBCLocaleIndex(LOCALE_enUS)
 {
+    _emptyCellObjectGuids = std::make_shared<CellObjectGuids const>();
+
     for (uint8 i = 0; i < MAX_CLASSES; ++i)
     {
         _playerClassInfo[i] = nullptr;
@@ -392,6 +414,8 @@ void ObjectMgr::LoadCreatureLocales()
 {
     uint32 oldMSTime = getMSTime();
 
+    ClearQueryResponses(QUERY_RESPONSE_CREATURE);
+
     _creatureLocaleStore.clear();                              // need for reload case
 
     //                                               0      1       2     3
@@ -521,6 +545,8 @@ void ObjectMgr::LoadCreatureTemplates()
 {
     uint32 oldMSTime = getMSTime();
 
+    ClearQueryResponses(QUERY_RESPONSE_CREATURE);
+
 //                                                        0      1                   2                   3                   4            5            6     7        8
     QueryResult result = WorldDatabase.Query("SELECT entry, difficulty_entry_1, difficulty_entry_2, difficulty_entry_3, KillCredit1, KillCredit2, name, subname, IconName, "
 //                        9               10        11        12   13       14       15          16         17          18            19               20     21      22
@@ -566,7 +592,6 @@ void ObjectMgr::LoadCreatureTemplates()
     for (CreatureTemplateContainer::iterator itr = _creatureTemplateStore.begin(); itr != _creatureTemplateStore.end(); ++itr)
     {
         CheckCreatureTemplate(&itr->second);
-        itr->second.InitializeQueryData();
     }
 
     LOG_INFO("server.loading", ">> Loaded {} Creature Definitions in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
@@ -2228,21 +2253,26 @@ void ObjectMgr::LoadCreatures()
 {
     uint32 oldMSTime = getMSTime();
 
-    //                                                     0         1    2    3    4        5            6           7           8            9              10            11
-    QueryResult result = WorldDatabase.Query("SELECT creature.guid, id1, id2, id3, map, equipment_id, position_x, position_y, position_z, orientation, spawntimesecs, wander_distance, "
-                         //      12            13       14          15           16         17         18          19             20                 21                    22
-                         "currentwaypoint, curhealth, curmana, MovementType, spawnMask, phaseMask, eventEntry, pool_entry, creature.npcflag, creature.unit_flags, creature.dynamicflags, "
-                         //       23
-                         "creature.ScriptName "
-                         "FROM creature "
-                         "LEFT OUTER JOIN game_event_creature ON creature.guid = game_event_creature.guid "
-                         "LEFT OUTER JOIN pool_creature ON creature.guid = pool_creature.guid");
-
-    if (!result)
+    // zone/area calculation writes back to the database, it needs the full load
+    bool const useCache = sLoaderCache->IsEnabled() && !sWorld->getBoolConfig(CONFIG_CALCULATE_CREATURE_ZONE_AREA_DATA);
+    if (useCache)
     {
-        LOG_WARN("server.loading", ">> Loaded 0 creatures. DB table `creature` is empty.");
-        LOG_INFO("server.loading", " ");
-        return;
+        std::vector<CreatureSpawnCacheRecord> records;
+        if (sLoaderCache->Load("creature", records))
+        {
+            _creatureDataStore.rehash(records.size());
+            for (CreatureSpawnCacheRecord const& record : records)
+            {
+                CreatureData& data = _creatureDataStore[record.SpawnId];
+                data = record.Data;
+                if (record.AddToGrid)
+                    AddCreatureToGrid(record.SpawnId, &data);
+            }
+
+            LOG_INFO("server.loading", ">> Loaded {} Creatures from loader cache in {} ms", records.size(), GetMSTimeDiffToNow(oldMSTime));
+            LOG_INFO("server.loading", " ");
+            return;
+        }
     }
 
     if (sWorld->getBoolConfig(CONFIG_CALCULATE_CREATURE_ZONE_AREA_DATA))
@@ -2256,12 +2286,21 @@ void ObjectMgr::LoadCreatures()
                 if (GetMapDifficultyData(i, Difficulty(k)))
                     spawnMasks[i] |= (1 << k);
 
-    _creatureDataStore.rehash(result->GetRowCount());
+    //                                                     0         1    2    3    4        5            6           7           8            9              10            11
+    std::string_view const query = "SELECT creature.guid, id1, id2, id3, map, equipment_id, position_x, position_y, position_z, orientation, spawntimesecs, wander_distance, "
+                         //      12            13       14          15           16         17         18          19             20                 21                    22
+                         "currentwaypoint, curhealth, curmana, MovementType, spawnMask, phaseMask, eventEntry, pool_entry, creature.npcflag, creature.unit_flags, creature.dynamicflags, "
+                         //       23
+                         "creature.ScriptName "
+                         "FROM creature "
+                         "LEFT OUTER JOIN game_event_creature ON creature.guid = game_event_creature.guid "
+                         "LEFT OUTER JOIN pool_creature ON creature.guid = pool_creature.guid";
+
+    // streamed, the creature table is too big to be buffered as a whole
+    std::unordered_set<ObjectGuid::LowType> gridSpawns;
     uint32 count = 0;
-    do
+    WorldDatabase.StreamQuery(query, [&](Field* fields)
     {
-        Field* fields = result->Fetch();
-
         ObjectGuid::LowType spawnId     = fields[0].Get<uint32>();
         uint32 id1                      = fields[1].Get<uint32>();
         uint32 id2                      = fields[2].Get<uint32>();
@@ -2271,24 +2310,24 @@ void ObjectMgr::LoadCreatures()
         if (!cInfo)
         {
             LOG_ERROR("sql.sql", "Table `creature` has creature (SpawnId: {}) with non existing creature entry {} in id1 field, skipped.", spawnId, id1);
-            continue;
+            return;
         }
         CreatureTemplate const* cInfo2 = GetCreatureTemplate(id2);
         if (!cInfo2 && id2)
         {
             LOG_ERROR("sql.sql", "Table `creature` has creature (SpawnId: {}) with non existing creature entry {} in id2 field, skipped.", spawnId, id2);
-            continue;
+            return;
         }
         CreatureTemplate const* cInfo3 = GetCreatureTemplate(id3);
         if (!cInfo3 && id3)
         {
             LOG_ERROR("sql.sql", "Table `creature` has creature (SpawnId: {}) with non existing creature entry {} in id3 field, skipped.", spawnId, id3);
-            continue;
+            return;
         }
         if (!id2 && id3)
         {
             LOG_ERROR("sql.sql", "Table `creature` has creature (SpawnId: {}) with creature entry {} in id3 field but no entry in id2 field, skipped.", spawnId, id3);
-            continue;
+            return;
         }
         CreatureData& data      = _creatureDataStore[spawnId];
         data.id1                = id1;
@@ -2313,7 +2352,7 @@ void ObjectMgr::LoadCreatures()
         data.npcflag            = fields[20].Get<uint32>();
         data.unit_flags         = fields[21].Get<uint32>();
         data.dynamicflags       = fields[22].Get<uint32>();
-        data.ScriptId           = GetScriptId(fields[23].Get<std::string>());
+        data.ScriptId           = GetScriptId(fields[23].Get<std::string_view>());
 
         if (!data.ScriptId)
             data.ScriptId = cInfo->ScriptID;
@@ -2322,7 +2361,7 @@ void ObjectMgr::LoadCreatures()
         if (!mapEntry)
         {
             LOG_ERROR("sql.sql", "Table `creature` have creature (SpawnId: {}) that spawned at not existed map (Id: {}), skipped.", spawnId, data.mapid);
-            continue;
+            return;
         }
 
         // pussywizard: 7 days means no reaspawn, so set it to 14 days, because manual id reset may be late
@@ -2345,7 +2384,7 @@ void ObjectMgr::LoadCreatures()
             }
         }
         if (!ok)
-            continue;
+            return;
 
         // -1 random, 0 no equipment,
         if (data.equipmentId != 0)
@@ -2413,10 +2452,32 @@ void ObjectMgr::LoadCreatures()
 
         // Add to grid if not managed by the game event or pool system
         if (gameEvent == 0 && PoolId == 0)
+        {
             AddCreatureToGrid(spawnId, &data);
+            if (useCache)
+                gridSpawns.insert(spawnId);
+        }
 
         ++count;
-    } while (result->NextRow());
+    });
+
+    if (!count)
+    {
+        LOG_WARN("server.loading", ">> Loaded 0 creatures. DB table `creature` is empty.");
+        LOG_INFO("server.loading", " ");
+        return;
+    }
+
+    // the store also keeps the entries skipped after being created, snapshot it as is
+    if (useCache)
+    {
+        std::vector<CreatureSpawnCacheRecord> records;
+        records.reserve(_creatureDataStore.size());
+        for (auto const& [spawnId, data] : _creatureDataStore)
+            records.push_back({ spawnId, gridSpawns.count(spawnId) > 0, data });
+
+        sLoaderCache->Save("creature", records);
+    }
 
     LOG_INFO("server.loading", ">> Loaded {} Creatures in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
@@ -2458,30 +2519,92 @@ void ObjectMgr::LoadCreatureSparring()
     LOG_INFO("server.loading", " ");
 }
 
+std::shared_ptr<CellObjectGuids const> ObjectMgr::GetGridObjectGuids(uint16 mapid, uint8 spawnMode, uint32 gridId)
+{
+    std::shared_lock<std::shared_mutex> lock(_mapObjectGuidsLock);
+
+    MapObjectGuids::const_iterator itr1 = _mapObjectGuidsStore.find(MAKE_PAIR32(mapid, spawnMode));
+    if (itr1 != _mapObjectGuidsStore.end())
+    {
+        auto itr2 = itr1->second.find(gridId);
+        if (itr2 != itr1->second.end())
+            return itr2->second;
+    }
+
+    return _emptyCellObjectGuids;
+}
+
+CellObjectGuidsMap ObjectMgr::GetMapObjectGuids(uint16 mapid, uint8 spawnMode)
+{
+    std::shared_lock<std::shared_mutex> lock(_mapObjectGuidsLock);
+
+    CellObjectGuidsMap cells;
+    MapObjectGuids::const_iterator itr = _mapObjectGuidsStore.find(MAKE_PAIR32(mapid, spawnMode));
+    if (itr != _mapObjectGuidsStore.end())
+        cells.insert(itr->second.begin(), itr->second.end());
+
+    return cells;
+}
+
+CellObjectGuids& ObjectMgr::GetWritableGridObjectGuids(uint16 mapid, uint8 spawnMode, uint32 gridId)
+{
+    std::shared_ptr<CellObjectGuids>& cell = _mapObjectGuidsStore[MAKE_PAIR32(mapid, spawnMode)][gridId];
+
+    // the store holds the only reference during the loading, so the cells are only copied
+    // when a spawn changes while a map is loading the grid
+    if (!cell)
+        cell = std::make_shared<CellObjectGuids>();
+    else if (cell.use_count() > 1)
+        cell = std::make_shared<CellObjectGuids>(*cell);
+
+    return *cell;
+}
+
+void ObjectMgr::InsertGuid(CellGuidSet& guids, ObjectGuid::LowType guid)
+{
+    // spawns are mostly loaded in guid order
+    if (guids.empty() || guids.back() < guid)
+    {
+        guids.push_back(guid);
+        return;
+    }
+
+    CellGuidSet::iterator itr = std::lower_bound(guids.begin(), guids.end(), guid);
+    if (*itr != guid)
+        guids.insert(itr, guid);
+}
+
+void ObjectMgr::EraseGuid(CellGuidSet& guids, ObjectGuid::LowType guid)
+{
+    CellGuidSet::iterator itr = std::lower_bound(guids.begin(), guids.end(), guid);
+    if (itr != guids.end() && *itr == guid)
+        guids.erase(itr);
+}
+
 void ObjectMgr::AddCreatureToGrid(ObjectGuid::LowType guid, CreatureData const* data)
 {
+    std::unique_lock<std::shared_mutex> lock(_mapObjectGuidsLock);
     uint8 mask = data->spawnMask;
     for (uint8 i = 0; mask != 0; i++, mask >>= 1)
     {
         if (mask & 1)
         {
             GridCoord gridCoord = Acore::ComputeGridCoord(data->posX, data->posY);
-            CellObjectGuids& cell_guids = _mapObjectGuidsStore[MAKE_PAIR32(data->mapid, i)][gridCoord.GetId()];
-            cell_guids.creatures.insert(guid);
+            InsertGuid(GetWritableGridObjectGuids(data->mapid, i, gridCoord.GetId()).creatures, guid);
         }
     }
 }
 
 void ObjectMgr::RemoveCreatureFromGrid(ObjectGuid::LowType guid, CreatureData const* data)
 {
+    std::unique_lock<std::shared_mutex> lock(_mapObjectGuidsLock);
     uint8 mask = data->spawnMask;
     for (uint8 i = 0; mask != 0; i++, mask >>= 1)
     {
         if (mask & 1)
         {
             GridCoord gridCoord = Acore::ComputeGridCoord(data->posX, data->posY);
-            CellObjectGuids& cell_guids = _mapObjectGuidsStore[MAKE_PAIR32(data->mapid, i)][gridCoord.GetId()];
-            cell_guids.creatures.erase(guid);
+            EraseGuid(GetWritableGridObjectGuids(data->mapid, i, gridCoord.GetId()).creatures, guid);
         }
     }
 }
@@ -2596,20 +2719,26 @@ void ObjectMgr::LoadGameobjects()
 {
     uint32 oldMSTime = getMSTime();
 
-    //                                                0                1   2    3           4           5           6
-    QueryResult result = WorldDatabase.Query("SELECT gameobject.guid, id, map, position_x, position_y, position_z, orientation, "
-                         //   7          8          9          10         11             12            13     14         15         16          17
-                         "rotation0, rotation1, rotation2, rotation3, spawntimesecs, animprogress, state, spawnMask, phaseMask, eventEntry, pool_entry, "
-                         //   18
-                         "ScriptName "
-                         "FROM gameobject LEFT OUTER JOIN game_event_gameobject ON gameobject.guid = game_event_gameobject.guid "
-                         "LEFT OUTER JOIN pool_gameobject ON gameobject.guid = pool_gameobject.guid");
-
-    if (!result)
+    // zone/area calculation writes back to the database, it needs the full load
+    bool const useCache = sLoaderCache->IsEnabled() && !sWorld->getBoolConfig(CONFIG_CALCULATE_GAMEOBJECT_ZONE_AREA_DATA);
+    if (useCache)
     {
-        LOG_WARN("server.loading", ">> Loaded 0 gameobjects. DB table `gameobject` is empty.");
-        LOG_INFO("server.loading", " ");
-        return;
+        std::vector<GameObjectSpawnCacheRecord> records;
+        if (sLoaderCache->Load("gameobject", records))
+        {
+            _gameObjectDataStore.rehash(records.size());
+            for (GameObjectSpawnCacheRecord const& record : records)
+            {
+                GameObjectData& data = _gameObjectDataStore[record.SpawnId];
+                data = record.Data;
+                if (record.AddToGrid)
+                    AddGameobjectToGrid(record.SpawnId, &data);
+            }
+
+            LOG_INFO("server.loading", ">> Loaded {} Gameobjects from loader cache in {} ms", records.size(), GetMSTimeDiffToNow(oldMSTime));
+            LOG_INFO("server.loading", " ");
+            return;
+        }
     }
 
     if (sWorld->getBoolConfig(CONFIG_CALCULATE_GAMEOBJECT_ZONE_AREA_DATA))
@@ -2623,11 +2752,19 @@ void ObjectMgr::LoadGameobjects()
                 if (GetMapDifficultyData(i, Difficulty(k)))
                     spawnMasks[i] |= (1 << k);
 
-    _gameObjectDataStore.rehash(result->GetRowCount());
-    do
-    {
-        Field* fields = result->Fetch();
+    //                                                0                1   2    3           4           5           6
+    std::string_view const query = "SELECT gameobject.guid, id, map, position_x, position_y, position_z, orientation, "
+                         //   7          8          9          10         11             12            13     14         15         16          17
+                         "rotation0, rotation1, rotation2, rotation3, spawntimesecs, animprogress, state, spawnMask, phaseMask, eventEntry, pool_entry, "
+                         //   18
+                         "ScriptName "
+                         "FROM gameobject LEFT OUTER JOIN game_event_gameobject ON gameobject.guid = game_event_gameobject.guid "
+                         "LEFT OUTER JOIN pool_gameobject ON gameobject.guid = pool_gameobject.guid";
 
+    // streamed, the gameobject table is too big to be buffered as a whole
+    std::unordered_set<ObjectGuid::LowType> gridSpawns;
+    uint64 const count = WorldDatabase.StreamQuery(query, [&](Field* fields)
+    {
         ObjectGuid::LowType guid    = fields[0].Get<uint32>();
         uint32 entry                = fields[1].Get<uint32>();
 
@@ -2635,7 +2772,7 @@ void ObjectMgr::LoadGameobjects()
         if (!gInfo)
         {
             LOG_ERROR("sql.sql", "Table `gameobject` has gameobject (GUID: {}) with non existing gameobject entry {}, skipped.", guid, entry);
-            continue;
+            return;
         }
 
         if (!gInfo->displayId)
@@ -2654,7 +2791,7 @@ void ObjectMgr::LoadGameobjects()
         if (gInfo->displayId && !sGameObjectDisplayInfoStore.LookupEntry(gInfo->displayId))
         {
             LOG_ERROR("sql.sql", "Gameobject (GUID: {} Entry {} GoType: {}) has an invalid displayId ({}), not loaded.", guid, entry, gInfo->type, gInfo->displayId);
-            continue;
+            return;
         }
 
         GameObjectData& data = _gameObjectDataStore[guid];
@@ -2670,7 +2807,7 @@ void ObjectMgr::LoadGameobjects()
         data.rotation.z     = fields[9].Get<float>();
         data.rotation.w     = fields[10].Get<float>();
         data.spawntimesecs  = fields[11].Get<int32>();
-        data.ScriptId       = GetScriptId(fields[18].Get<std::string>());
+        data.ScriptId       = GetScriptId(fields[18].Get<std::string_view>());
         if (!data.ScriptId)
             data.ScriptId = gInfo->ScriptId;
 
@@ -2678,7 +2815,7 @@ void ObjectMgr::LoadGameobjects()
         if (!mapEntry)
         {
             LOG_ERROR("sql.sql", "Table `gameobject` has gameobject (GUID: {} Entry: {}) spawned on a non-existed map (Id: {}), skip", guid, data.id, data.mapid);
-            continue;
+            return;
         }
 
         if (data.spawntimesecs == 0 && gInfo->IsDespawnAtAction())
@@ -2693,7 +2830,7 @@ void ObjectMgr::LoadGameobjects()
         if (go_state >= MAX_GO_STATE)
         {
             LOG_ERROR("sql.sql", "Table `gameobject` has gameobject (GUID: {} Entry: {}) with invalid `state` ({}) value, skip", guid, data.id, go_state);
-            continue;
+            return;
         }
         data.go_state       = GOState(go_state);
 
@@ -2709,31 +2846,31 @@ void ObjectMgr::LoadGameobjects()
         if (data.rotation.x < -1.0f || data.rotation.x > 1.0f)
         {
             LOG_ERROR("sql.sql", "Table `gameobject` has gameobject (GUID: {} Entry: {}) with invalid rotationX ({}) value, skip", guid, data.id, data.rotation.x);
-            continue;
+            return;
         }
 
         if (data.rotation.y < -1.0f || data.rotation.y > 1.0f)
         {
             LOG_ERROR("sql.sql", "Table `gameobject` has gameobject (GUID: {} Entry: {}) with invalid rotationY ({}) value, skip", guid, data.id, data.rotation.y);
-            continue;
+            return;
         }
 
         if (data.rotation.z < -1.0f || data.rotation.z > 1.0f)
         {
             LOG_ERROR("sql.sql", "Table `gameobject` has gameobject (GUID: {} Entry: {}) with invalid rotationZ ({}) value, skip", guid, data.id, data.rotation.z);
-            continue;
+            return;
         }
 
         if (data.rotation.w < -1.0f || data.rotation.w > 1.0f)
         {
             LOG_ERROR("sql.sql", "Table `gameobject` has gameobject (GUID: {} Entry: {}) with invalid rotationW ({}) value, skip", guid, data.id, data.rotation.w);
-            continue;
+            return;
         }
 
         if (!MapMgr::IsValidMapCoord(data.mapid, data.posX, data.posY, data.posZ, data.orientation))
         {
             LOG_ERROR("sql.sql", "Table `gameobject` has gameobject (GUID: {} Entry: {}) with invalid coordinates, skip", guid, data.id);
-            continue;
+            return;
         }
 
         if (data.phaseMask == 0)
@@ -2757,8 +2894,30 @@ void ObjectMgr::LoadGameobjects()
         }
 
         if (gameEvent == 0 && PoolId == 0)                      // if not this is to be managed by GameEvent System or Pool system
+        {
             AddGameobjectToGrid(guid, &data);
-    } while (result->NextRow());
+            if (useCache)
+                gridSpawns.insert(guid);
+        }
+    });
+
+    if (!count)
+    {
+        LOG_WARN("server.loading", ">> Loaded 0 gameobjects. DB table `gameobject` is empty.");
+        LOG_INFO("server.loading", " ");
+        return;
+    }
+
+    // the store also keeps the entries skipped after being created, snapshot it as is
+    if (useCache)
+    {
+        std::vector<GameObjectSpawnCacheRecord> records;
+        records.reserve(_gameObjectDataStore.size());
+        for (auto const& [guid, data] : _gameObjectDataStore)
+            records.push_back({ guid, gridSpawns.count(guid) > 0, data });
+
+        sLoaderCache->Save("gameobject", records);
+    }
 
     LOG_INFO("server.loading", ">> Loaded {} Gameobjects in {} ms", (unsigned long)_gameObjectDataStore.size(), GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
@@ -2766,28 +2925,28 @@ void ObjectMgr::LoadGameobjects()
 
 void ObjectMgr::AddGameobjectToGrid(ObjectGuid::LowType guid, GameObjectData const* data)
 {
+    std::unique_lock<std::shared_mutex> lock(_mapObjectGuidsLock);
     uint8 mask = data->spawnMask;
     for (uint8 i = 0; mask != 0; i++, mask >>= 1)
     {
         if (mask & 1)
         {
             GridCoord gridCoord = Acore::ComputeGridCoord(data->posX, data->posY);
-            CellObjectGuids& cell_guids = _mapObjectGuidsStore[MAKE_PAIR32(data->mapid, i)][gridCoord.GetId()];
-            cell_guids.gameobjects.insert(guid);
+            InsertGuid(GetWritableGridObjectGuids(data->mapid, i, gridCoord.GetId()).gameobjects, guid);
         }
     }
 }
 
 void ObjectMgr::RemoveGameobjectFromGrid(ObjectGuid::LowType guid, GameObjectData const* data)
 {
+    std::unique_lock<std::shared_mutex> lock(_mapObjectGuidsLock);
     uint8 mask = data->spawnMask;
     for (uint8 i = 0; mask != 0; i++, mask >>= 1)
     {
         if (mask & 1)
         {
             GridCoord gridCoord = Acore::ComputeGridCoord(data->posX, data->posY);
-            CellObjectGuids& cell_guids = _mapObjectGuidsStore[MAKE_PAIR32(data->mapid, i)][gridCoord.GetId()];
-            cell_guids.gameobjects.erase(guid);
+            EraseGuid(GetWritableGridObjectGuids(data->mapid, i, gridCoord.GetId()).gameobjects, guid);
         }
     }
 }
@@ -2796,6 +2955,8 @@ void ObjectMgr::LoadItemLocales()
 {
     uint32 oldMSTime = getMSTime();
 
+    ClearQueryResponses(QUERY_RESPONSE_ITEM);
+
     _itemLocaleStore.clear();                                 // need for reload case
 
     QueryResult result = WorldDatabase.Query("SELECT ID, locale, Name, Description FROM item_template_locale");
@@ -2848,6 +3009,8 @@ void ObjectMgr::LoadItemTemplates()
 {
     uint32 oldMSTime = getMSTime();
 
+    ClearQueryResponses(QUERY_RESPONSE_ITEM);
+
     //                                                 0      1       2               3              4        5        6       7          8         9        10        11           12
     QueryResult result = WorldDatabase.Query("SELECT entry, class, subclass, SoundOverrideSubclass, name, displayid, Quality, Flags, FlagsExtra, BuyCount, BuyPrice, SellPrice, InventoryType, "
                          //     13              14           15          16             17               18                19              20
@@ -4602,6 +4765,9 @@ void ObjectMgr::LoadQuests()
 {
     uint32 oldMSTime = getMSTime();
 
+    ClearQueryResponses(QUERY_RESPONSE_QUEST);
+    InvalidateQuestGiverStatuses();
+
     // For reload case
     for (QuestMap::const_iterator itr = _questTemplates.begin(); itr != _questTemplates.end(); ++itr)
         delete itr->second;
@@ -4670,9 +4836,6 @@ void ObjectMgr::LoadQuests()
         }
     }
 
-    for (QuestMap::iterator itr = _questTemplates.begin(); itr != _questTemplates.end(); ++itr)
-        itr->second->InitializeQueryData();
-
     std::map<uint32, uint32> usedMailTemplates;
 
     // Load `quest_details`
@@ -5412,6 +5575,8 @@ void ObjectMgr::LoadQuestLocales()
 {
     uint32 oldMSTime = getMSTime();
 
+    ClearQueryResponses(QUERY_RESPONSE_QUEST);
+
     _questLocaleStore.clear();                                // need for reload case
 
     //                                               0   1       2      3        4           5        6              7               8               9               10
@@ -7315,6 +7480,8 @@ void ObjectMgr::LoadGameObjectLocales()
 {
     uint32 oldMSTime = getMSTime();
 
+    ClearQueryResponses(QUERY_RESPONSE_GAMEOBJECT);
+
     _gameObjectLocaleStore.clear(); // need for reload case
 
     //                                               0      1       2     3
@@ -7403,6 +7570,8 @@ void ObjectMgr::LoadGameObjectTemplate()
 {
     uint32 oldMSTime = getMSTime();
 
+    ClearQueryResponses(QUERY_RESPONSE_GAMEOBJECT);
+
     //                                                 0      1      2        3       4             5          6      7
     QueryResult result = WorldDatabase.Query("SELECT entry, type, displayId, name, IconName, castBarCaption, unk1, size, "
                          //                                          8      9      10     11     12     13     14     15     16     17     18      19      20
@@ -7584,6 +7753,19 @@ void ObjectMgr::LoadGameObjectTemplate()
         ++count;
     } while (result->NextRow());
 
+    // entry indexed lookups, the map is kept for iteration
+    {
+        uint32 max = 0;
+        for (GameObjectTemplateContainer::const_iterator itr = _gameObjectTemplateStore.begin(); itr != _gameObjectTemplateStore.end(); ++itr)
+            if (itr->first > max)
+                max = itr->first;
+
+        _gameObjectTemplateStoreFast.clear();
+        _gameObjectTemplateStoreFast.resize(max + 1, nullptr);
+        for (GameObjectTemplateContainer::iterator itr = _gameObjectTemplateStore.begin(); itr != _gameObjectTemplateStore.end(); ++itr)
+            _gameObjectTemplateStoreFast[itr->first] = &(itr->second);
+    }
+
     LOG_INFO("server.loading", ">> Loaded {} Game Object Templates in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
@@ -8293,6 +8475,7 @@ void ObjectMgr::LoadQuestRelationsHelper(QuestRelations& map, std::string const&
     uint32 oldMSTime = getMSTime();
 
     map.clear();                                            // need for reload case
+    InvalidateQuestGiverStatuses();
 
     uint32 count = 0;
 
@@ -9887,7 +10070,7 @@ std::string const& ObjectMgr::GetScriptName(uint32 id) const
     return (id < _scriptNamesStore.size()) ? _scriptNamesStore[id] : empty;
 }
 
-uint32 ObjectMgr::GetScriptId(std::string const& name)
+uint32 ObjectMgr::GetScriptId(std::string_view name)
 {
     // use binary search to find the script name in the sorted vector
     // assume "" is the first element
@@ -10353,11 +10536,7 @@ void ObjectMgr::LoadFactionChangeTitles()
 
 GameObjectTemplate const* ObjectMgr::GetGameObjectTemplate(uint32 entry)
 {
-    GameObjectTemplateContainer::const_iterator itr = _gameObjectTemplateStore.find(entry);
-    if (itr != _gameObjectTemplateStore.end())
-        return &(itr->second);
-
-    return nullptr;
+    return entry < _gameObjectTemplateStoreFast.size() ? _gameObjectTemplateStoreFast[entry] : nullptr;
 }
 
 bool ObjectMgr::IsGameObjectStaticTransport(uint32 entry)
@@ -10413,6 +10592,8 @@ void ObjectMgr::LoadGameObjectQuestItems()
 {
     uint32 oldMSTime = getMSTime();
 
+    ClearQueryResponses(QUERY_RESPONSE_GAMEOBJECT);
+
     //                                               0                1        2
     QueryResult result = WorldDatabase.Query("SELECT GameObjectEntry, ItemId, Idx FROM gameobject_questitem ORDER BY Idx ASC");
 
@@ -10458,6 +10639,8 @@ void ObjectMgr::LoadCreatureQuestItems()
 {
     uint32 oldMSTime = getMSTime();
 
+    ClearQueryResponses(QUERY_RESPONSE_CREATURE);
+
     //                                               0              1        2
     QueryResult result = WorldDatabase.Query("SELECT CreatureEntry, ItemId, Idx FROM creature_questitem ORDER BY Idx ASC");
 
@@ -10546,3 +10729,29 @@ uint32 ObjectMgr::GetQuestMoneyReward(uint8 level, uint32 questMoneyDifficulty)
 
     return 0;
 }
+
+QueryResponse ObjectMgr::GetQueryResponse(QueryResponseType type, uint32 entry, LocaleConstant locale, std::function<WorldPacket()> const& build)
+{
+    QueryResponseCache& cache = _queryResponseCaches[type];
+    {
+        std::shared_lock<std::shared_mutex> lock(cache.Lock);
+        auto itr = cache.Responses[locale].find(entry);
+        if (itr != cache.Responses[locale].end())
+            return itr->second;
+    }
+
+    // built outside of the lock, concurrent first queries of an entry build identical packets and the first one is kept
+    QueryResponse response = std::make_shared<WorldPacket const>(build());
+
+    std::unique_lock<std::shared_mutex> lock(cache.Lock);
+    return cache.Responses[locale].try_emplace(entry, std::move(response)).first->second;
+}
+
+void ObjectMgr::ClearQueryResponses(QueryResponseType type)
+{
+    QueryResponseCache& cache = _queryResponseCaches[type];
+
+    std::unique_lock<std::shared_mutex> lock(cache.Lock);
+    for (std::unordered_map<uint32, QueryResponse>& responses : cache.Responses)
+        responses.clear();
+}
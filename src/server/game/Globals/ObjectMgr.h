@@ -35,9 +35,14 @@
 #include "TemporarySummon.h"
 #include "Trainer.h"
 #include "VehicleDefines.h"
+#include "WorldPacket.h"
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <limits>
 #include <map>
+#include <memory>
+#include <shared_mutex>
 #include <string>
 
 class Item;
@@ -473,16 +478,20 @@ struct BroadcastText
 
 typedef std::unordered_map<uint32, BroadcastText> BroadcastTextContainer;
 
-typedef std::set<ObjectGuid::LowType> CellGuidSet;
+// Sorted spawn ids
+typedef std::vector<ObjectGuid::LowType> CellGuidSet;
 
+// Spawns of a grid shared by all the instances of a map and difficulty, never changed once handed out
 struct CellObjectGuids
 {
     CellGuidSet creatures;
     CellGuidSet gameobjects;
+
+    [[nodiscard]] static bool Contains(CellGuidSet const& guids, ObjectGuid::LowType guid) { return std::binary_search(guids.begin(), guids.end(), guid); }
 };
 
-typedef std::unordered_map<uint32/*cell_id*/, CellObjectGuids> CellObjectGuidsMap;
-typedef std::unordered_map<uint32/*(mapid, spawnMode) pair*/, CellObjectGuidsMap> MapObjectGuids;
+typedef std::unordered_map<uint32/*cell_id*/, std::shared_ptr<CellObjectGuids const>> CellObjectGuidsMap;
+typedef std::unordered_map<uint32/*(mapid, spawnMode) pair*/, std::unordered_map<uint32/*cell_id*/, std::shared_ptr<CellObjectGuids>>> MapObjectGuids;
 
 // Acore string ranges
 #define MIN_ACORE_STRING_ID           1                    // 'acore_string'
@@ -719,6 +728,17 @@ static constexpr uint32 MAX_QUEST_MONEY_REWARDS = 10;
 typedef std::array<uint32, MAX_QUEST_MONEY_REWARDS> QuestMoneyRewardArray;
 typedef std::unordered_map<uint32, QuestMoneyRewardArray> QuestMoneyRewardStore;
 
+enum QueryResponseType : uint8
+{
+    QUERY_RESPONSE_ITEM,
+    QUERY_RESPONSE_CREATURE,
+    QUERY_RESPONSE_GAMEOBJECT,
+    QUERY_RESPONSE_QUEST,
+    MAX_QUERY_RESPONSE_TYPES
+};
+
+typedef SharedWorldPacket QueryResponse;
+
 class PlayerDumpReader;
 
 class ObjectMgr
@@ -1009,6 +1029,10 @@ public:
         return _creatureQuestInvolvedRelations.equal_range(creature_entry);
     }
 
+    // Players drop their cached quest dialog statuses when quests, their relations or conditions change
+    [[nodiscard]] uint32 GetQuestGiverStatusGeneration() const { return _questGiverStatusGeneration.load(std::memory_order_relaxed); }
+    void InvalidateQuestGiverStatuses() { _questGiverStatusGeneration.fetch_add(1, std::memory_order_relaxed); }
+
     void LoadEventScripts();
     void LoadSpellScripts();
     void LoadWaypointScripts();
@@ -1170,25 +1194,9 @@ public:
         return nullptr;
     }
 
-    CellObjectGuids const& GetGridObjectGuids(uint16 mapid, uint8 spawnMode, uint32 gridId)
-    {
-        MapObjectGuids::const_iterator itr1 = _mapObjectGuidsStore.find(MAKE_PAIR32(mapid, spawnMode));
-        if (itr1 != _mapObjectGuidsStore.end())
-        {
-            CellObjectGuidsMap::const_iterator itr2 = itr1->second.find(gridId);
-            if (itr2 != itr1->second.end())
-                return itr2->second;
-        }
-        return _emptyCellObjectGuids;
-    }
-
-    CellObjectGuidsMap const& GetMapObjectGuids(uint16 mapid, uint8 spawnMode)
-    {
-        MapObjectGuids::const_iterator itr1 = _mapObjectGuidsStore.find(MAKE_PAIR32(mapid, spawnMode));
-        if (itr1 != _mapObjectGuidsStore.end())
-            return itr1->second;
-        return _emptyCellObjectGuidsMap;
-    }
+    // Snapshot of the spawns of a grid, kept valid by the pointer while spawns are added or removed
+    [[nodiscard]] std::shared_ptr<CellObjectGuids const> GetGridObjectGuids(uint16 mapid, uint8 spawnMode, uint32 gridId);
+    [[nodiscard]] CellObjectGuidsMap GetMapObjectGuids(uint16 mapid, uint8 spawnMode);
 
     /**
      * Gets temp summon data for all creatures of specified group.
@@ -1394,7 +1402,7 @@ public:
     void LoadScriptNames();
     ScriptNameContainer& GetScriptNames() { return _scriptNamesStore; }
     [[nodiscard]] std::string const& GetScriptName(uint32 id) const;
-    uint32 GetScriptId(std::string const& name);
+    uint32 GetScriptId(std::string_view name);
 
     [[nodiscard]] SpellClickInfoMapBounds GetSpellClickInfoMapBounds(uint32 creature_id) const
     {
@@ -1460,6 +1468,11 @@ public:
     }
 
     [[nodiscard]] uint32 GetQuestMoneyReward(uint8 level, uint32 questMoneyDifficulty) const;
+
+    // Responses of the item, creature, gameobject and quest queries, built by build on the first query of an entry in a locale.
+    // Loading the templates or locales of a type clears its responses, so reloads are picked up by the next query.
+    QueryResponse GetQueryResponse(QueryResponseType type, uint32 entry, LocaleConstant locale, std::function<WorldPacket()> const& build);
+    void ClearQueryResponses(QueryResponseType type);
 private:
     // first free id for selected id type
     uint32 _auctionId; // pussywizard: accessed by a single thread
@@ -1469,6 +1482,15 @@ private:
     uint32 _hiPetNumber;
     std::mutex _hiPetNumberMutex;
 
+    // query handlers run on the map threads
+    struct QueryResponseCache
+    {
+        std::shared_mutex Lock;
+        std::array<std::unordered_map<uint32, QueryResponse>, TOTAL_LOCALES> Responses;
+    };
+
+    std::array<QueryResponseCache, MAX_QUERY_RESPONSE_TYPES> _queryResponseCaches;
+
     ObjectGuid::LowType _creatureSpawnId;
     ObjectGuid::LowType _gameObjectSpawnId;
 
@@ -1516,6 +1538,7 @@ private:
     QuestRelations _goQuestInvolvedRelations;
     QuestRelations _creatureQuestRelations;
     QuestRelations _creatureQuestInvolvedRelations;
+    std::atomic<uint32> _questGiverStatusGeneration{ 0 };
 
     //character reserved names
     typedef std::set<std::wstring> ReservedNamesContainer;
@@ -1582,9 +1605,14 @@ private:
     typedef std::unordered_map<uint32, ItemSetNameEntry> ItemSetNameContainer;
     ItemSetNameContainer _itemSetNameStore;
 
+    // cells are copied on write while some map still holds them
+    CellObjectGuids& GetWritableGridObjectGuids(uint16 mapid, uint8 spawnMode, uint32 gridId);
+    static void InsertGuid(CellGuidSet& guids, ObjectGuid::LowType guid);
+    static void EraseGuid(CellGuidSet& guids, ObjectGuid::LowType guid);
+
     MapObjectGuids _mapObjectGuidsStore;
-    CellObjectGuidsMap _emptyCellObjectGuidsMap;
-    CellObjectGuids _emptyCellObjectGuids;
+    std::shared_mutex _mapObjectGuidsLock;
+    std::shared_ptr<CellObjectGuids const> _emptyCellObjectGuids;
     CreatureDataContainer _creatureDataStore;
     CreatureTemplateContainer _creatureTemplateStore;
     CreatureCustomIDsContainer _creatureCustomIDsStore;
@@ -1602,6 +1630,7 @@ private:
     GameObjectDataContainer _gameObjectDataStore;
     GameObjectLocaleContainer _gameObjectLocaleStore;
     GameObjectTemplateContainer _gameObjectTemplateStore;
+    std::vector<GameObjectTemplate*> _gameObjectTemplateStoreFast;
     GameObjectTemplateAddonContainer _gameObjectTemplateAddonStore;
     /// Stores temp summon data grouped by summoner's entry, summoner's type and group id
     TempSummonDataContainer _tempSummonDataStore;
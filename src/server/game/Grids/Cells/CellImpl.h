@@ -184,11 +184,15 @@ inline void Cell::VisitObjects(float x, float y, Map* map, T& visitor, float rad
 template<class T>
 inline void Cell::VisitFarVisibleObjects(WorldObject const* center_obj, T& visitor, float radius)
 {
-    CellCoord p(Acore::ComputeCellCoord(center_obj->GetPositionX(), center_obj->GetPositionY()));
-    Cell cell(p);
-
+    Map& map = *center_obj->GetMap();
     TypeContainerVisitor<T, FarVisibleGridContainer> gnotifier(visitor);
-    cell.Visit(p, gnotifier, *center_obj->GetMap(), *center_obj, radius);
+
+    // only the cells holding far visible objects which may be seen from center_obj
+    map.GetFarVisibleObjectIndex().VisitCellsInRange(center_obj->GetPositionX(), center_obj->GetPositionY(), radius, center_obj->GetCombatReach(),
+        [&map, &gnotifier](CellCoord const& cellCoord)
+        {
+            map.Visit(Cell(cellCoord), gnotifier);
+        });
 }
 
 #endif
@@ -0,0 +1,66 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FarVisibleObjectIndex.h"
+
+void FarVisibleObjectIndex::Add(CellCoord const& cell, float distance, float extent)
+{
+    std::vector<CellEntry>& entries = _grids[MakeGridKey(cell.x_coord / MAX_NUMBER_OF_CELLS, cell.y_coord / MAX_NUMBER_OF_CELLS)];
+    _maxExtent = std::max(_maxExtent, extent);
+
+    for (CellEntry& entry : entries)
+    {
+        if (entry.Cell != cell)
+            continue;
+
+        ++entry.Count;
+        entry.Distance = std::max(entry.Distance, distance);
+        entry.Extent = std::max(entry.Extent, extent);
+        return;
+    }
+
+    entries.push_back({ cell, 1, distance, extent });
+}
+
+void FarVisibleObjectIndex::Remove(CellCoord const& cell)
+{
+    auto itr = _grids.find(MakeGridKey(cell.x_coord / MAX_NUMBER_OF_CELLS, cell.y_coord / MAX_NUMBER_OF_CELLS));
+    if (itr == _grids.end())
+        return;
+
+    std::vector<CellEntry>& entries = itr->second;
+    for (std::size_t i = 0; i < entries.size(); ++i)
+    {
+        if (entries[i].Cell != cell)
+            continue;
+
+        if (--entries[i].Count)
+            return;
+
+        entries[i] = entries.back();
+        entries.pop_back();
+        break;
+    }
+
+    if (entries.empty())
+        _grids.erase(itr);
+}
+
+void FarVisibleObjectIndex::RemoveGrid(uint32 gridX, uint32 gridY)
+{
+    _grids.erase(MakeGridKey(gridX, gridY));
+}
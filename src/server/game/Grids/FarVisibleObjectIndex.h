@@ -0,0 +1,109 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_FAR_VISIBLE_OBJECT_INDEX_H
+#define ACORE_FAR_VISIBLE_OBJECT_INDEX_H
+
+#include "GridDefines.h"
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Coarse spatial hash of the grid cells holding far visible objects
+ * (VisibilityDistanceType::Large and Gigantic). The objects themselves stay
+ * in the far visible containers of their cell, the index only tells which
+ * cells hold some and how far the objects of each cell may be seen.
+ *
+ * Cells are hashed by grid. A visibility pass looks up the few grids around
+ * the viewpoint and visits only the cells whose objects may be seen from it,
+ * instead of every cell within VISIBILITY_DISTANCE_GIGANTIC.
+ *
+ * The range of a cell is the largest override distance and object extent
+ * added to it. It only shrinks once the cell is empty, a cell visited in vain
+ * costs a visit while a cell missed would hide its objects.
+ */
+class FarVisibleObjectIndex
+{
+public:
+    // distance is the override visibility distance of the object, extent how far its model reaches from its position
+    void Add(CellCoord const& cell, float distance, float extent);
+    void Remove(CellCoord const& cell);
+
+    // Drops the cells of an unloaded grid, their containers are gone
+    void RemoveGrid(uint32 gridX, uint32 gridY);
+
+    /*
+     * Calls visitor with the coord of every cell whose objects may be seen from
+     * x, y within maxDistance. margin is added to the distances, the size of
+     * the viewpoint.
+     */
+    template<class VISITOR>
+    void VisitCellsInRange(float x, float y, float maxDistance, float margin, VISITOR&& visitor) const
+    {
+        if (_grids.empty())
+            return;
+
+        float const reach = maxDistance + _maxExtent + margin;
+        GridCoord const low = Acore::ComputeGridCoord(x + reach, y + reach);
+        GridCoord const high = Acore::ComputeGridCoord(x - reach, y - reach);
+
+        for (uint32 gridX = low.x_coord; gridX <= std::min<uint32>(high.x_coord, MAX_NUMBER_OF_GRIDS - 1); ++gridX)
+        {
+            for (uint32 gridY = low.y_coord; gridY <= std::min<uint32>(high.y_coord, MAX_NUMBER_OF_GRIDS - 1); ++gridY)
+            {
+                auto itr = _grids.find(MakeGridKey(gridX, gridY));
+                if (itr == _grids.end())
+                    continue;
+
+                for (CellEntry const& entry : itr->second)
+                {
+                    float const range = std::min(entry.Distance, maxDistance) + entry.Extent + margin;
+                    if (GetDistSqToCell(entry.Cell, x, y) <= range * range)
+                        visitor(entry.Cell);
+                }
+            }
+        }
+    }
+
+private:
+    struct CellEntry
+    {
+        CellCoord Cell;
+        uint32 Count;
+        float Distance;
+        float Extent;
+    };
+
+    static uint32 MakeGridKey(uint32 gridX, uint32 gridY) { return gridX * MAX_NUMBER_OF_GRIDS + gridY; }
+
+    // Squared 2d distance from x, y to the nearest point of the cell
+    static float GetDistSqToCell(CellCoord const& cell, float x, float y)
+    {
+        // cell coords grow towards lower positions, see Acore::Compute
+        float const maxX = (float(CENTER_GRID_CELL_ID) - float(cell.x_coord)) * SIZE_OF_GRID_CELL;
+        float const maxY = (float(CENTER_GRID_CELL_ID) - float(cell.y_coord)) * SIZE_OF_GRID_CELL;
+        float const dx = std::max({ maxX - SIZE_OF_GRID_CELL - x, 0.0f, x - maxX });
+        float const dy = std::max({ maxY - SIZE_OF_GRID_CELL - y, 0.0f, y - maxY });
+        return dx * dx + dy * dy;
+    }
+
+    std::unordered_map<uint32 /*grid key*/, std::vector<CellEntry>> _grids;
+    float _maxExtent = 0.0f;
+};
+
+#endif
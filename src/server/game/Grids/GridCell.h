@@ -66,9 +66,9 @@ public:
     }
 
     template<class SPECIFIC_OBJECT>
-    void RemoveFarVisibleObject(SPECIFIC_OBJECT* obj)
+    bool RemoveFarVisibleObject(SPECIFIC_OBJECT* obj)
     {
-        _farVisibleObjects.template Remove<SPECIFIC_OBJECT>(obj);
+        return _farVisibleObjects.template Remove<SPECIFIC_OBJECT>(obj);
     }
 
     // Visit far objects
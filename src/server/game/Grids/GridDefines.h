@@ -60,11 +60,11 @@ typedef TYPELIST_4(Creature, GameObject, DynamicObject, Corpse) AllMapStoredObje
 // List of object types that can have far visible range
 typedef TYPELIST_2(Creature, GameObject) AllFarVisibleObjectTypes;
 
-typedef GridRefMgr<Corpse>          CorpseMapType;
-typedef GridRefMgr<Creature>        CreatureMapType;
-typedef GridRefMgr<DynamicObject>   DynamicObjectMapType;
-typedef GridRefMgr<GameObject>      GameObjectMapType;
-typedef GridRefMgr<Player>          PlayerMapType;
+typedef GridObjectVector<Corpse>          CorpseMapType;
+typedef GridObjectVector<Creature>        CreatureMapType;
+typedef GridObjectVector<DynamicObject>   DynamicObjectMapType;
+typedef GridObjectVector<GameObject>      GameObjectMapType;
+typedef GridObjectVector<Player>          PlayerMapType;
 
 enum GridMapTypeMask
 {
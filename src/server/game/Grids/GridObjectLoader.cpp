@@ -22,7 +22,10 @@
 #include "DynamicObject.h"
 #include "GameObject.h"
 #include "GridNotifiers.h"
+#include "GridObjectReclaimer.h"
+#include "MapRegionUpdater.h"
 #include "Transport.h"
+#include "World.h"
 
 template <class T>
 void GridObjectLoader::AddObjectHelper(Map* map, T* obj)
@@ -34,12 +37,48 @@ void GridObjectLoader::AddObjectHelper(Map* map, T* obj)
     obj->AddToWorld();
 }
 
+bool GridObjectLoader::PrepareCreatureTerrainStatus(CellGuidSet const& guid_set, Map* map, std::vector<PositionFullTerrainStatus>& terrainStatus)
+{
+    uint32 const minCreatures = sWorld->getIntConfig(CONFIG_MAP_GRID_LOAD_PREPARE_MIN_CREATURES);
+    if (!minCreatures || guid_set.size() < minCreatures || !sMapRegionUpdater->IsActive())
+        return false;
+
+    std::vector<CreatureData const*> spawns;
+    spawns.reserve(guid_set.size());
+    for (ObjectGuid::LowType const& guid : guid_set)
+        spawns.push_back(sObjectMgr->GetCreatureData(guid));
+
+    // Terrain and vmap queries only read the grid terrain and the thread safe vmap cache,
+    // everything touching the map or the creature itself stays on the calling thread
+    static constexpr std::size_t SpawnsPerJob = 64;
+    terrainStatus.resize(spawns.size());
+    std::vector<std::function<void()>> jobs;
+    jobs.reserve(spawns.size() / SpawnsPerJob + 1);
+    for (std::size_t begin = 0; begin < spawns.size(); begin += SpawnsPerJob)
+    {
+        std::size_t const end = std::min(begin + SpawnsPerJob, spawns.size());
+        jobs.emplace_back([&spawns, &terrainStatus, map, begin, end]()
+        {
+            for (std::size_t i = begin; i < end; ++i)
+                if (CreatureData const* data = spawns[i])
+                    map->GetFullTerrainStatusForPosition(data->phaseMask, data->posX, data->posY, data->posZ, DEFAULT_COLLISION_HEIGHT, terrainStatus[i]);
+        });
+    }
+
+    sMapRegionUpdater->Execute(jobs);
+    return true;
+}
+
 void GridObjectLoader::LoadCreatures(CellGuidSet const& guid_set, Map* map)
 {
+    std::vector<PositionFullTerrainStatus> terrainStatus;
+    bool const prepared = PrepareCreatureTerrainStatus(guid_set, map, terrainStatus);
+
+    std::size_t spawnIndex = 0;
     for (ObjectGuid::LowType const& guid : guid_set)
     {
         Creature* obj = new Creature();
-        if (!obj->LoadFromDB(guid, map))
+        if (!obj->LoadFromDB(guid, map, false, prepared ? &terrainStatus[spawnIndex++] : nullptr))
         {
             delete obj;
             continue;
@@ -52,7 +91,7 @@ void GridObjectLoader::LoadCreatures(CellGuidSet const& guid_set, Map* map)
             if (obj->IsAlive() && !obj->HasUnitState(UNIT_STATE_SIGHTLESS) && obj->HasReactState(REACT_AGGRESSIVE) && !obj->IsImmuneToNPC())
             {
                 // call MoveInLineOfSight for nearby grid creatures
-                Acore::AIRelocationNotifier notifier(*obj);
+                Acore::AIRelocationNotifier notifier(*obj, 60.f);
                 Cell::VisitObjects(obj, notifier, 60.f);
             }
         }
@@ -91,9 +130,9 @@ void GridObjectLoader::LoadGameObjects(CellGuidSet const& guid_set, Map* map)
 
 void GridObjectLoader::LoadAllCellsInGrid()
 {
-    CellObjectGuids const& cell_guids = sObjectMgr->GetGridObjectGuids(_map->GetId(), _map->GetSpawnMode(), _grid.GetId());
-    LoadGameObjects(cell_guids.gameobjects, _map);
-    LoadCreatures(cell_guids.creatures, _map);
+    std::shared_ptr<CellObjectGuids const> cell_guids = sObjectMgr->GetGridObjectGuids(_map->GetId(), _map->GetSpawnMode(), _grid.GetId());
+    LoadGameObjects(cell_guids->gameobjects, _map);
+    LoadCreatures(cell_guids->creatures, _map);
 
     if (std::unordered_set<Corpse*> const* corpses = _map->GetCorpsesInGrid(_grid.GetId()))
     {
@@ -108,7 +147,7 @@ void GridObjectLoader::LoadAllCellsInGrid()
 }
 
 template<class T>
-void GridObjectUnloader::Visit(GridRefMgr<T>& m)
+void GridObjectUnloader::Visit(GridObjectVector<T>& m)
 {
     while (!m.IsEmpty())
     {
@@ -124,15 +163,27 @@ void GridObjectUnloader::Visit(GridRefMgr<T>& m)
 
         obj->GetMap()->RemoveObjectFromMapUpdateList(obj);
 
+        if (sGridObjectReclaimer->IsActive())
+        {
+            // Leave nothing on the map pointing to the object, the reclaim thread only runs its destructors
+            obj->m_Events.KillAllEvents(true);
+            if (Unit* unit = obj->ToUnit())
+                Unit::HandleSafeUnitPointersOnDelete(unit);
+
+            obj->RemoveFromGrid();
+            sGridObjectReclaimer->Queue(obj);
+            continue;
+        }
+
         ///- object will get delinked from the manager when deleted
         delete obj;
     }
 }
 
 template<class T>
-void GridObjectCleaner::Visit(GridRefMgr<T>& m)
+void GridObjectCleaner::Visit(GridObjectVector<T>& m)
 {
-    for (typename GridRefMgr<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
+    for (typename GridObjectVector<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
         iter->GetSource()->CleanupsBeforeDelete();
 }
 
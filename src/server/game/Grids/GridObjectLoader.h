@@ -36,6 +36,8 @@ private:
     void AddObjectHelper(Map* map, T* obj);
 
     void LoadCreatures(CellGuidSet const& guid_set, Map* map);
+    // Terrain status of the spawn points of crowded grids, computed on the region worker pool
+    static bool PrepareCreatureTerrainStatus(CellGuidSet const& guid_set, Map* map, std::vector<PositionFullTerrainStatus>& terrainStatus);
     void LoadGameObjects(CellGuidSet const& guid_set, Map* map);
 
     MapGridType& _grid;
@@ -46,7 +48,7 @@ private:
 class GridObjectCleaner
 {
 public:
-    template<class T> void Visit(GridRefMgr<T>&);
+    template<class T> void Visit(GridObjectVector<T>&);
     void Visit(PlayerMapType&) { }
 };
 
@@ -56,6 +58,6 @@ class GridObjectUnloader
 public:
     void Visit(CorpseMapType&) { }    // corpses are deleted with Map
     void Visit(PlayerMapType&) { }
-    template<class T> void Visit(GridRefMgr<T>& m);
+    template<class T> void Visit(GridObjectVector<T>& m);
 };
 #endif
@@ -0,0 +1,104 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridObjectReclaimer.h"
+#include "Object.h"
+
+GridObjectReclaimer* GridObjectReclaimer::instance()
+{
+    static GridObjectReclaimer instance;
+    return &instance;
+}
+
+void GridObjectReclaimer::Activate(uint32 perTick)
+{
+    _perTick = perTick;
+    _budget = perTick;
+    _stop = false;
+    _thread = std::thread(&GridObjectReclaimer::WorkerThread, this);
+}
+
+void GridObjectReclaimer::Deactivate()
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _stop = true;
+    }
+
+    _condition.notify_one();
+
+    if (_thread.joinable())
+        _thread.join();
+
+    for (WorldObject* obj : _queue)
+        delete obj;
+
+    _queue.clear();
+}
+
+void GridObjectReclaimer::Queue(WorldObject* obj)
+{
+    bool notify;
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _queue.push_back(obj);
+        notify = _budget != 0;
+    }
+
+    if (notify)
+        _condition.notify_one();
+}
+
+void GridObjectReclaimer::Update()
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _budget = _perTick;
+        if (_queue.empty())
+            return;
+    }
+
+    _condition.notify_one();
+}
+
+std::size_t GridObjectReclaimer::GetQueuedCount()
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    return _queue.size();
+}
+
+void GridObjectReclaimer::WorkerThread()
+{
+    while (true)
+    {
+        WorldObject* obj;
+
+        {
+            std::unique_lock<std::mutex> guard(_lock);
+            _condition.wait(guard, [this] { return _stop || (_budget && !_queue.empty()); });
+            if (_stop)
+                break;
+
+            obj = _queue.front();
+            _queue.pop_front();
+            --_budget;
+        }
+
+        delete obj;
+    }
+}
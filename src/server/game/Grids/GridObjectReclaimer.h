@@ -0,0 +1,74 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_GRID_OBJECT_RECLAIMER_H
+#define ACORE_GRID_OBJECT_RECLAIMER_H
+
+#include "Define.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+class WorldObject;
+
+/*
+ * Background thread deleting the creatures, game objects and dynamic objects
+ * of unloaded grids (GridUnload.ReclaimPerTick).
+ *
+ * The map thread cleans the objects up and detaches them from the map, its
+ * grids, their events and the units pointing to them. Only the destructors
+ * (AI, motion master, removed auras, loot, object fields) run on the reclaim
+ * thread, at most GridUnload.ReclaimPerTick objects per world update, so that
+ * instances expiring together do not stall the map threads.
+ */
+class GridObjectReclaimer
+{
+public:
+    GridObjectReclaimer() = default;
+    ~GridObjectReclaimer() = default;
+
+    static GridObjectReclaimer* instance();
+
+    void Activate(uint32 perTick);
+    // Deletes the objects still queued on the calling thread
+    void Deactivate();
+    [[nodiscard]] bool IsActive() const { return _thread.joinable(); }
+
+    // Takes ownership of an object cleaned up and detached from its map
+    void Queue(WorldObject* obj);
+
+    // Called once per world update, allows the next GridUnload.ReclaimPerTick deletions
+    void Update();
+
+    [[nodiscard]] std::size_t GetQueuedCount();
+
+private:
+    void WorkerThread();
+
+    uint32 _perTick = 0;
+    uint32 _budget = 0;                 // deletions left in this world update
+    std::mutex _lock;
+    std::condition_variable _condition;
+    std::deque<WorldObject*> _queue;
+    bool _stop = false;
+    std::thread _thread;
+};
+
+#define sGridObjectReclaimer GridObjectReclaimer::instance()
+
+#endif
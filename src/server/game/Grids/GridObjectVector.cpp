@@ -0,0 +1,74 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridObjectVector.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GRID_SELECT_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define GRID_SELECT_NEON
+#endif
+
+uint32 SelectWithinDist2d(float const* x, float const* y, float const* size, uint32 count, float centerX, float centerY, float dist, uint32 firstIndex, uint32* indexes)
+{
+    uint32 selected = 0;
+    uint32 i = 0;
+
+#if defined(GRID_SELECT_SSE2)
+    __m128 const cx = _mm_set1_ps(centerX), cy = _mm_set1_ps(centerY), d = _mm_set1_ps(dist);
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 const dx = _mm_sub_ps(_mm_loadu_ps(x + i), cx);
+        __m128 const dy = _mm_sub_ps(_mm_loadu_ps(y + i), cy);
+        __m128 const maxDist = _mm_add_ps(_mm_loadu_ps(size + i), d);
+        __m128 const inRange = _mm_cmple_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(maxDist, maxDist));
+
+        for (uint32 mask = uint32(_mm_movemask_ps(inRange)), lane = 0; mask; mask >>= 1, ++lane)
+            if (mask & 1)
+                indexes[selected++] = firstIndex + i + lane;
+    }
+#elif defined(GRID_SELECT_NEON)
+    float32x4_t const cx = vdupq_n_f32(centerX), cy = vdupq_n_f32(centerY), d = vdupq_n_f32(dist);
+    for (; i + 4 <= count; i += 4)
+    {
+        float32x4_t const dx = vsubq_f32(vld1q_f32(x + i), cx);
+        float32x4_t const dy = vsubq_f32(vld1q_f32(y + i), cy);
+        float32x4_t const maxDist = vaddq_f32(vld1q_f32(size + i), d);
+        uint32x4_t const inRange = vcleq_f32(vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dy, dy)), vmulq_f32(maxDist, maxDist));
+
+        alignas(16) uint32 lanes[4];
+        vst1q_u32(lanes, inRange);
+        for (uint32 lane = 0; lane < 4; ++lane)
+            if (lanes[lane])
+                indexes[selected++] = firstIndex + i + lane;
+    }
+#endif
+
+    // remaining positions, all of them without vector instructions
+    for (; i < count; ++i)
+    {
+        float const dx = x[i] - centerX;
+        float const dy = y[i] - centerY;
+        float const maxDist = size[i] + dist;
+        if (dx * dx + dy * dy <= maxDist * maxDist)
+            indexes[selected++] = firstIndex + i;
+    }
+
+    return selected;
+}
@@ -0,0 +1,184 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _GRID_OBJECT_VECTOR_H
+#define _GRID_OBJECT_VECTOR_H
+
+#include "Define.h"
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+// Writes the indexes, firstIndex based, of the count positions within dist (2d, size of the position included) of center, returns how many
+AC_GAME_API uint32 SelectWithinDist2d(float const* x, float const* y, float const* size, uint32 count, float centerX, float centerY, float dist, uint32 firstIndex, uint32* indexes);
+
+/*
+ * Objects of one type stored in a grid cell, a dense array of object pointers
+ * next to packed arrays of the 2d position and size of every object. Visitors
+ * walk contiguous memory and range searches select the objects in range from
+ * the packed positions, four at a time where the CPU allows, without touching
+ * the objects themselves.
+ *
+ * Objects know their slot (GridObjectVectorLink) and are removed by moving the last
+ * slot into theirs. Iteration runs from the last slot to the first, so
+ * removing the visited object, or one visited before, while iterating does
+ * not skip any object; objects added meanwhile are not visited.
+ *
+ * Positions are updated by the Map relocation functions.
+ */
+template<class OBJECT>
+class GridObjectVector;
+
+// Where an object is stored, kept by the object itself (GridObject<T>)
+template<class OBJECT>
+struct GridObjectVectorLink
+{
+    GridObjectVector<OBJECT>* Container = nullptr;
+    uint32 Index = 0;
+};
+
+template<class OBJECT>
+class GridObjectVector
+{
+public:
+    struct Slot
+    {
+        OBJECT* Source;
+        GridObjectVectorLink<OBJECT>* Link;
+
+        [[nodiscard]] OBJECT* GetSource() const { return Source; }
+    };
+
+    class iterator
+    {
+    public:
+        iterator(GridObjectVector* owner, std::size_t remaining) : _owner(owner), _remaining(remaining) { }
+
+        Slot* operator->() const { return &_owner->_slots[_remaining - 1]; }
+        Slot& operator*() const { return _owner->_slots[_remaining - 1]; }
+
+        // Position and size kept for the current object
+        [[nodiscard]] float GetPositionX() const { return _owner->_x[_remaining - 1]; }
+        [[nodiscard]] float GetPositionY() const { return _owner->_y[_remaining - 1]; }
+        [[nodiscard]] float GetObjectSize() const { return _owner->_size[_remaining - 1]; }
+
+        iterator& operator++()
+        {
+            --_remaining;
+
+            // visited objects were removed meanwhile
+            if (_remaining > _owner->_slots.size())
+                _remaining = _owner->_slots.size();
+
+            return *this;
+        }
+
+        bool operator==(iterator const& other) const { return _remaining == other._remaining; }
+        bool operator!=(iterator const& other) const { return _remaining != other._remaining; }
+
+    private:
+        GridObjectVector* _owner;
+        std::size_t _remaining;     // slots left to visit, the current one included
+    };
+
+    GridObjectVector() = default;
+    GridObjectVector(GridObjectVector const&) = delete;
+    GridObjectVector& operator=(GridObjectVector const&) = delete;
+
+    ~GridObjectVector()
+    {
+        for (Slot& slot : _slots)
+            slot.Link->Container = nullptr;
+    }
+
+    iterator begin() { return iterator(this, _slots.size()); }
+    iterator end() { return iterator(this, 0); }
+
+    Slot* getFirst() { return _slots.empty() ? nullptr : &_slots.back(); }
+    [[nodiscard]] bool IsEmpty() const { return _slots.empty(); }
+    [[nodiscard]] uint32 getSize() const { return uint32(_slots.size()); }
+
+    void Insert(OBJECT* obj, GridObjectVectorLink<OBJECT>& link)
+    {
+        link.Container = this;
+        link.Index = uint32(_slots.size());
+        _slots.push_back({ obj, &link });
+        _x.push_back(obj->GetPositionX());
+        _y.push_back(obj->GetPositionY());
+        _size.push_back(obj->GetObjectSize());
+    }
+
+    void Erase(uint32 index)
+    {
+        _slots[index].Link->Container = nullptr;
+
+        if (index + 1 != _slots.size())
+        {
+            _slots[index] = _slots.back();
+            _slots[index].Link->Index = index;
+            _x[index] = _x.back();
+            _y[index] = _y.back();
+            _size[index] = _size.back();
+        }
+
+        _slots.pop_back();
+        _x.pop_back();
+        _y.pop_back();
+        _size.pop_back();
+    }
+
+    void UpdatePosition(uint32 index)
+    {
+        OBJECT const* obj = _slots[index].Source;
+        _x[index] = obj->GetPositionX();
+        _y[index] = obj->GetPositionY();
+        _size[index] = obj->GetObjectSize();
+    }
+
+    /*
+     * Calls visitor for the objects within dist (2d, their size included) of
+     * x, y by their kept position, until it returns false. A prefilter, the
+     * visitor still does the exact test. It must not add or remove objects of
+     * this cell.
+     */
+    template<class VISITOR>
+    void VisitWithinDist2d(float x, float y, float dist, VISITOR&& visitor)
+    {
+        uint32 indexes[SELECT_BLOCK_SIZE];
+
+        for (uint32 first = 0; first < _slots.size(); first += SELECT_BLOCK_SIZE)
+        {
+            uint32 const count = std::min<uint32>(SELECT_BLOCK_SIZE, uint32(_slots.size()) - first);
+            uint32 const selected = SelectWithinDist2d(_x.data() + first, _y.data() + first, _size.data() + first, count,
+                x, y, dist, first, indexes);
+
+            for (uint32 i = 0; i < selected; ++i)
+                if (!visitor(_slots[indexes[i]].Source))
+                    return;
+        }
+    }
+
+private:
+    static constexpr uint32 SELECT_BLOCK_SIZE = 64;
+
+    std::vector<Slot> _slots;
+    std::vector<float> _x;
+    std::vector<float> _y;
+    std::vector<float> _size;
+};
+
+#endif
@@ -32,7 +32,7 @@ TerrainMapDataReadResult GridTerrainData::Load(std::string const& mapFileName)
         return TerrainMapDataReadResult::ReadError;
 
     // Check for valid map and version magics
-    if (header.mapMagic != MapMagic.asUInt || header.versionMagic != MapVersionMagic)
+    if (header.mapMagic != MapMagic.asUInt || header.versionMagic < MapMinVersionMagic || header.versionMagic > MapVersionMagic)
         return TerrainMapDataReadResult::InvalidMagic;
 
     // Load area data
@@ -105,6 +105,17 @@ bool GridTerrainData::LoadHeightData(std::ifstream& fileStream, uint32 const off
             _loadedHeightData->uint8HeightData->gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 255;
             _gridGetHeight = &GridTerrainData::getHeightFromUint8;
         }
+        else if ((header.flags & MAP_HEIGHT_AS_CHUNKED_INT8))
+        {
+            _loadedHeightData->chunkedUint8HeightData = std::make_unique<LoadedHeightData::ChunkedUint8HeightData>();
+            if (!fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->chunkedUint8HeightData->chunkHeight), sizeof(_loadedHeightData->chunkedUint8HeightData->chunkHeight))
+                || !fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->chunkedUint8HeightData->chunkIntHeightMultiplier), sizeof(_loadedHeightData->chunkedUint8HeightData->chunkIntHeightMultiplier))
+                || !fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->chunkedUint8HeightData->v9), sizeof(_loadedHeightData->chunkedUint8HeightData->v9))
+                || !fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->chunkedUint8HeightData->v8), sizeof(_loadedHeightData->chunkedUint8HeightData->v8)))
+                return false;
+
+            _gridGetHeight = &GridTerrainData::getHeightFromChunkedUint8;
+        }
         else
         {
             _loadedHeightData->floatHeightData = std::make_unique<LoadedHeightData::FloatHeightData>();
@@ -389,6 +400,79 @@ float GridTerrainData::getHeightFromUint8(float x, float y) const
     return (float)((a * x) + (b * y) + c) * _loadedHeightData->uint8HeightData->gridIntHeightMultiplier + _loadedHeightData->gridHeight;
 }
 
+float GridTerrainData::getHeightFromChunkedUint8(float x, float y) const
+{
+    if (!_loadedHeightData || !_loadedHeightData->chunkedUint8HeightData)
+        return INVALID_HEIGHT;
+
+    x = MAP_RESOLUTION * (32 - x / SIZE_OF_GRIDS);
+    y = MAP_RESOLUTION * (32 - y / SIZE_OF_GRIDS);
+
+    int x_int = (int)x;
+    int y_int = (int)y;
+    x -= x_int;
+    y -= y_int;
+    x_int &= (MAP_RESOLUTION - 1);
+    y_int &= (MAP_RESOLUTION - 1);
+
+    if (isHole(x_int, y_int))
+        return INVALID_HEIGHT;
+
+    // All points of a square belong to the same cell
+    LoadedHeightData::ChunkedUint8HeightData const& heightData = *_loadedHeightData->chunkedUint8HeightData;
+    int chunk = (x_int / 8) * 16 + y_int / 8;
+    int chunk_x = x_int % 8;
+    int chunk_y = y_int % 8;
+
+    int32 a, b, c;
+    uint8 const* V9_h1_ptr = &heightData.v9[chunk * 9 * 9 + chunk_x * 9 + chunk_y];
+    int32 h5 = 2 * heightData.v8[chunk * 8 * 8 + chunk_x * 8 + chunk_y];
+    if (x + y < 1)
+    {
+        if (x > y)
+        {
+            // 1 triangle (h1, h2, h5 points)
+            int32 h1 = V9_h1_ptr[0];
+            int32 h2 = V9_h1_ptr[9];
+            a = h2 - h1;
+            b = h5 - h1 - h2;
+            c = h1;
+        }
+        else
+        {
+            // 2 triangle (h1, h3, h5 points)
+            int32 h1 = V9_h1_ptr[0];
+            int32 h3 = V9_h1_ptr[1];
+            a = h5 - h1 - h3;
+            b = h3 - h1;
+            c = h1;
+        }
+    }
+    else
+    {
+        if (x > y)
+        {
+            // 3 triangle (h2, h4, h5 points)
+            int32 h2 = V9_h1_ptr[9];
+            int32 h4 = V9_h1_ptr[10];
+            a = h2 + h4 - h5;
+            b = h4 - h2;
+            c = h5 - h4;
+        }
+        else
+        {
+            // 4 triangle (h3, h4, h5 points)
+            int32 h3 = V9_h1_ptr[1];
+            int32 h4 = V9_h1_ptr[10];
+            a = h4 - h3;
+            b = h3 + h4 - h5;
+            c = h5 - h4;
+        }
+    }
+    // Calculate height
+    return (float)((a * x) + (b * y) + c) * heightData.chunkIntHeightMultiplier[chunk] + heightData.chunkHeight[chunk];
+}
+
 float GridTerrainData::getHeightFromUint16(float x, float y) const
 {
     if (!_loadedHeightData || !_loadedHeightData->uint16HeightData)
@@ -617,3 +701,46 @@ LiquidData const GridTerrainData::GetLiquidData(float x, float y, float z, float
 
     return liquidData;
 }
+
+std::size_t GridTerrainData::GetMemoryUsage() const
+{
+    std::size_t memory = sizeof(GridTerrainData);
+
+    if (_loadedAreaData)
+    {
+        memory += sizeof(LoadedAreaData);
+        if (_loadedAreaData->areaMap)
+            memory += sizeof(LoadedAreaData::AreaMapType);
+    }
+
+    if (_loadedHeightData)
+    {
+        memory += sizeof(LoadedHeightData);
+        if (_loadedHeightData->uint16HeightData)
+            memory += sizeof(LoadedHeightData::Uint16HeightData);
+        if (_loadedHeightData->uint8HeightData)
+            memory += sizeof(LoadedHeightData::Uint8HeightData);
+        if (_loadedHeightData->chunkedUint8HeightData)
+            memory += sizeof(LoadedHeightData::ChunkedUint8HeightData);
+        if (_loadedHeightData->floatHeightData)
+            memory += sizeof(LoadedHeightData::FloatHeightData);
+        if (_loadedHeightData->minHeightPlanes)
+            memory += sizeof(LoadedHeightData::HeightPlanesType);
+    }
+
+    if (_loadedLiquidData)
+    {
+        memory += sizeof(LoadedLiquidData);
+        if (_loadedLiquidData->liquidEntry)
+            memory += sizeof(LoadedLiquidData::LiquidEntryType);
+        if (_loadedLiquidData->liquidFlags)
+            memory += sizeof(LoadedLiquidData::LiquidFlagsType);
+        if (_loadedLiquidData->liquidMap)
+            memory += sizeof(LoadedLiquidData::LiquidMapType) + _loadedLiquidData->liquidMap->capacity() * sizeof(float);
+    }
+
+    if (_loadedHoleData)
+        memory += sizeof(LoadedHoleData);
+
+    return memory;
+}
@@ -19,6 +19,8 @@
 #define GRID_TERRAIN_DATA_H
 
 #include "Common.h"
+#include "Optional.h"
+#include <array>
 #include <fstream>
 #include <G3D/Plane.h>
 #include <memory>
@@ -51,7 +53,8 @@ union u_map_magic
 };
 
 const u_map_magic MapMagic        = { {'M', 'A', 'P', 'S'} };
-const uint32 MapVersionMagic      = 9;
+const uint32 MapVersionMagic      = 10;
+const uint32 MapMinVersionMagic   = 9;                    // oldest version still read, without per cell packed heights
 const u_map_magic MapAreaMagic    = { {'A', 'R', 'E', 'A'} };
 const u_map_magic MapHeightMagic  = { {'M', 'H', 'G', 'T'} };
 const u_map_magic MapLiquidMagic  = { {'M', 'L', 'I', 'Q'} };
@@ -84,6 +87,7 @@ struct map_areaHeader
 #define MAP_HEIGHT_AS_INT16             0x0002
 #define MAP_HEIGHT_AS_INT8              0x0004
 #define MAP_HEIGHT_HAS_FLIGHT_BOUNDS    0x0008
+#define MAP_HEIGHT_AS_CHUNKED_INT8      0x0010
 
 struct map_heightHeader
 {
@@ -145,6 +149,19 @@ struct LoadedHeightData
         float gridIntHeightMultiplier;
     };
 
+    // Every cell (8x8 squares) has its own base height and step, points on cell borders are stored by each cell they belong to
+    struct ChunkedUint8HeightData
+    {
+        typedef std::array<float, 16 * 16> ChunkValuesType;
+        typedef std::array<uint8, 16 * 16 * 9 * 9> V9Type;
+        typedef std::array<uint8, 16 * 16 * 8 * 8> V8Type;
+
+        ChunkValuesType chunkHeight;
+        ChunkValuesType chunkIntHeightMultiplier;
+        V9Type v9;
+        V8Type v8;
+    };
+
     struct FloatHeightData
     {
         typedef std::array<float, 129 * 129> V9Type;
@@ -157,6 +174,7 @@ struct LoadedHeightData
     float gridHeight;
     std::unique_ptr<Uint16HeightData> uint16HeightData;
     std::unique_ptr<Uint8HeightData> uint8HeightData;
+    std::unique_ptr<ChunkedUint8HeightData> chunkedUint8HeightData;
     std::unique_ptr<FloatHeightData> floatHeightData;
     std::unique_ptr<HeightPlanesType> minHeightPlanes;
 };
@@ -238,6 +256,7 @@ class GridTerrainData
     float getHeightFromFloat(float x, float y) const;
     float getHeightFromUint16(float x, float y) const;
     float getHeightFromUint8(float x, float y) const;
+    float getHeightFromChunkedUint8(float x, float y) const;
     float getHeightFromFlat(float x, float y) const;
 
 public:
@@ -250,6 +269,9 @@ public:
     float getMinHeight(float x, float y) const;
     float getLiquidLevel(float x, float y) const;
     LiquidData const GetLiquidData(float x, float y, float z, float collisionHeight, Optional<uint8> ReqLiquidType) const;
+
+    // Bytes held by the loaded data
+    std::size_t GetMemoryUsage() const;
 };
 
 #endif
@@ -0,0 +1,119 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridTerrainDataStore.h"
+#include "GridTerrainData.h"
+
+GridTerrainDataStore* GridTerrainDataStore::instance()
+{
+    static GridTerrainDataStore instance;
+    return &instance;
+}
+
+std::shared_ptr<GridTerrainData> GridTerrainDataStore::Acquire(uint32 mapId, uint16 x, uint16 y)
+{
+    uint32 const key = MakeKey(mapId, x, y);
+
+    std::lock_guard<std::mutex> guard(_lock);
+    auto itr = _entries.find(key);
+    if (itr == _entries.end())
+        return nullptr;
+
+    return Lease(key, itr->second);
+}
+
+std::shared_ptr<GridTerrainData> GridTerrainDataStore::Insert(uint32 mapId, uint16 x, uint16 y, std::unique_ptr<GridTerrainData> terrainData)
+{
+    uint32 const key = MakeKey(mapId, x, y);
+
+    std::lock_guard<std::mutex> guard(_lock);
+    auto [itr, inserted] = _entries.try_emplace(key);
+    if (inserted)
+    {
+        itr->second.Memory = terrainData->GetMemoryUsage();
+        itr->second.Data = std::move(terrainData);
+        _memory += itr->second.Memory;
+    }
+
+    return Lease(key, itr->second);
+}
+
+std::shared_ptr<GridTerrainData> GridTerrainDataStore::Lease(uint32 key, Entry& entry)
+{
+    std::shared_ptr<void> lease = entry.Lease.lock();
+    if (!lease)
+    {
+        if (entry.Cached)
+        {
+            _cache.erase(entry.CacheItr);
+            entry.Cached = false;
+        }
+
+        lease = std::shared_ptr<void>(nullptr, [this, key](void*) { Release(key); });
+        entry.Lease = lease;
+    }
+
+    // Shares ownership with the lease, the entry keeps the data itself alive
+    return std::shared_ptr<GridTerrainData>(lease, entry.Data.get());
+}
+
+void GridTerrainDataStore::Release(uint32 key)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    auto itr = _entries.find(key);
+
+    // Acquired again before the last lease was released
+    if (itr == _entries.end() || !itr->second.Lease.expired() || itr->second.Cached)
+        return;
+
+    _cache.push_front(key);
+    itr->second.CacheItr = _cache.begin();
+    itr->second.Cached = true;
+    Trim();
+}
+
+bool GridTerrainDataStore::Contains(uint32 mapId, uint16 x, uint16 y)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    return _entries.contains(MakeKey(mapId, x, y));
+}
+
+void GridTerrainDataStore::SetCacheSize(uint32 cacheSize)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _cacheSize = cacheSize;
+    Trim();
+}
+
+void GridTerrainDataStore::Trim()
+{
+    while (_cache.size() > _cacheSize)
+    {
+        auto itr = _entries.find(_cache.back());
+        _memory -= itr->second.Memory;
+        _entries.erase(itr);
+        _cache.pop_back();
+    }
+}
+
+void GridTerrainDataStore::GetStats(uint32& grids, uint32& cachedGrids, uint64& memory)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    grids = _entries.size();
+    cachedGrids = _cache.size();
+    memory = _memory;
+}
@@ -0,0 +1,83 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_GRID_TERRAIN_DATA_STORE_H
+#define ACORE_GRID_TERRAIN_DATA_STORE_H
+
+#include "Define.h"
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+class GridTerrainData;
+
+/*
+ * Process wide owner of the terrain read from .map files, one GridTerrainData
+ * per map id and grid shared by the map and all of its instances. Terrain
+ * data is never modified once loaded.
+ *
+ * Grids hold leases on the data. Data no grid holds a lease on any more is
+ * kept for GridTerrain.CacheSize grids, least recently used first out, so
+ * instances created again soon after do not read the files again.
+ */
+class GridTerrainDataStore
+{
+public:
+    GridTerrainDataStore() = default;
+    ~GridTerrainDataStore() = default;
+
+    static GridTerrainDataStore* instance();
+
+    // Lease on the terrain of the grid, nullptr if it is not loaded
+    std::shared_ptr<GridTerrainData> Acquire(uint32 mapId, uint16 x, uint16 y);
+
+    // Takes over the terrain read for the grid, returns the already stored one when another map was faster
+    std::shared_ptr<GridTerrainData> Insert(uint32 mapId, uint16 x, uint16 y, std::unique_ptr<GridTerrainData> terrainData);
+
+    [[nodiscard]] bool Contains(uint32 mapId, uint16 x, uint16 y);
+
+    void SetCacheSize(uint32 cacheSize);
+
+    void GetStats(uint32& grids, uint32& cachedGrids, uint64& memory);
+
+private:
+    struct Entry
+    {
+        std::shared_ptr<GridTerrainData> Data;
+        std::weak_ptr<void> Lease;
+        std::size_t Memory = 0;
+        std::list<uint32>::iterator CacheItr;      // valid while not leased
+        bool Cached = false;
+    };
+
+    static uint32 MakeKey(uint32 mapId, uint16 x, uint16 y) { return (mapId << 16) | (uint32(x) << 8) | y; }
+
+    std::shared_ptr<GridTerrainData> Lease(uint32 key, Entry& entry);
+    void Release(uint32 key);
+    void Trim();
+
+    std::mutex _lock;
+    std::unordered_map<uint32, Entry> _entries;
+    std::list<uint32> _cache;                       // not leased grids, most recently used first
+    uint32 _cacheSize = 0;
+    uint64 _memory = 0;
+};
+
+#define sGridTerrainDataStore GridTerrainDataStore::instance()
+
+#endif
@@ -1,5 +1,7 @@
 #include "DisableMgr.h"
+#include "GridTerrainDataStore.h"
 #include "GridTerrainLoader.h"
+#include "GridTerrainPrefetcher.h"
 #include "MMapFactory.h"
 #include "MMapMgr.h"
 #include "ScriptMgr.h"
@@ -24,28 +26,43 @@ void GridTerrainLoader::LoadMap()
         // load grid map for base map
         Map* parentMap = const_cast<Map*>(_map->GetParent());
 
-        // GetGridTerrainData will create the parent map grid
+        // GetGridTerrainData will create the parent map grid, which also loads the vmap and mmap tiles
         _grid.SetTerrainData(parentMap->GetGridTerrainDataSharedPtr(GridCoord(_grid.GetX(), _grid.GetY())));
         return;
     }
 
-    // map file name
-    std::string const mapFileName = Acore::StringFormat("{}maps/{:03}{:02}{:02}.map", sWorld->GetDataPath(), _map->GetId(), _grid.GetX(), _grid.GetY());
-
-    // loading data
-    LOG_DEBUG("maps", "Loading map {}", mapFileName);
-    std::unique_ptr<GridTerrainData> terrainData = std::make_unique<GridTerrainData>();
-    TerrainMapDataReadResult loadResult = terrainData->Load(mapFileName);
-    if (loadResult == TerrainMapDataReadResult::Success)
-        _grid.SetTerrainData(std::move(terrainData));
-    else
+    // Kept by the store while no grid uses it, a parent grid created again finds it there
+    std::shared_ptr<GridTerrainData> sharedTerrainData = sGridTerrainDataStore->Acquire(_map->GetId(), _grid.GetX(), _grid.GetY());
+    if (!sharedTerrainData)
     {
-        if (loadResult == TerrainMapDataReadResult::InvalidMagic)
-            LOG_ERROR("maps", "Map file '{}' is from an incompatible clientversion. Please recreate using the mapextractor.", mapFileName);
+        // map file name
+        std::string const mapFileName = Acore::StringFormat("{}maps/{:03}{:02}{:02}.map", sWorld->GetDataPath(), _map->GetId(), _grid.GetX(), _grid.GetY());
+
+        // loading data
+        std::unique_ptr<GridTerrainData> terrainData;
+        TerrainMapDataReadResult loadResult;
+        if (sGridTerrainPrefetcher->IsActive() && sGridTerrainPrefetcher->Take(_map->GetId(), _grid.GetX(), _grid.GetY(), terrainData, loadResult))
+            LOG_DEBUG("maps", "Loading prefetched map {}", mapFileName);
+        else
+        {
+            LOG_DEBUG("maps", "Loading map {}", mapFileName);
+            terrainData = std::make_unique<GridTerrainData>();
+            loadResult = terrainData->Load(mapFileName);
+        }
+
+        if (loadResult == TerrainMapDataReadResult::Success)
+            sharedTerrainData = sGridTerrainDataStore->Insert(_map->GetId(), _grid.GetX(), _grid.GetY(), std::move(terrainData));
         else
-            LOG_DEBUG("maps", "Error (result: {}) loading map file: {}", uint32(loadResult), mapFileName);
+        {
+            if (loadResult == TerrainMapDataReadResult::InvalidMagic)
+                LOG_ERROR("maps", "Map file '{}' is from an incompatible clientversion. Please recreate using the mapextractor.", mapFileName);
+            else
+                LOG_DEBUG("maps", "Error (result: {}) loading map file: {}", uint32(loadResult), mapFileName);
+        }
     }
 
+    _grid.SetTerrainData(sharedTerrainData);
+
     sScriptMgr->OnLoadGridMap(_map, _grid.GetTerrainData(), _grid.GetX(), _grid.GetY());
 }
 
@@ -109,7 +126,7 @@ bool GridTerrainLoader::ExistMap(uint32 mapid, int gx, int gy)
         return false;
     }
 
-    if (header.mapMagic != MapMagic.asUInt || header.versionMagic != MapVersionMagic)
+    if (header.mapMagic != MapMagic.asUInt || header.versionMagic < MapMinVersionMagic || header.versionMagic > MapVersionMagic)
     {
         LOG_ERROR("maps", "Map file '{}' is from an incompatible map version ({:.4u} v{}), {:.4s} v{} is expected. Please pull your source, recompile tools and recreate maps using the updated mapextractor, then replace your old map files with new files.",
             mapFileName, 4, header.mapMagic, header.versionMagic, 4, MapMagic.asChar, MapVersionMagic);
@@ -0,0 +1,172 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridTerrainPrefetcher.h"
+#include "GridTerrainData.h"
+#include "Log.h"
+#include "MMapMgr.h"
+#include "MapTree.h"
+#include "StringFormat.h"
+#include <algorithm>
+#include <cstdio>
+
+GridTerrainPrefetcher* GridTerrainPrefetcher::instance()
+{
+    static GridTerrainPrefetcher instance;
+    return &instance;
+}
+
+void GridTerrainPrefetcher::Activate(std::string const& dataPath)
+{
+    _dataPath = dataPath;
+    _stop = false;
+    _thread = std::thread(&GridTerrainPrefetcher::WorkerThread, this);
+}
+
+void GridTerrainPrefetcher::Deactivate()
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _stop = true;
+    }
+
+    _condition.notify_one();
+
+    if (_thread.joinable())
+        _thread.join();
+
+    _queue.clear();
+    _readOrder.clear();
+    _entries.clear();
+}
+
+void GridTerrainPrefetcher::Request(uint32 mapId, uint16 x, uint16 y, bool vmap, bool mmap)
+{
+    uint32 const key = MakeKey(mapId, x, y);
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        auto [itr, inserted] = _entries.try_emplace(key);
+        if (!inserted)
+            return;
+
+        itr->second.VMap = vmap;
+        itr->second.MMap = mmap;
+        _queue.push_back(key);
+    }
+
+    _condition.notify_one();
+}
+
+bool GridTerrainPrefetcher::Take(uint32 mapId, uint16 x, uint16 y, std::unique_ptr<GridTerrainData>& terrainData, TerrainMapDataReadResult& result)
+{
+    uint32 const key = MakeKey(mapId, x, y);
+
+    std::lock_guard<std::mutex> guard(_lock);
+    auto itr = _entries.find(key);
+    if (itr == _entries.end())
+        return false;
+
+    // Still queued or being read, the caller reads the file itself and the worker drops its copy
+    if (!itr->second.Read)
+    {
+        _entries.erase(itr);
+        return false;
+    }
+
+    terrainData = std::move(itr->second.TerrainData);
+    result = itr->second.Result;
+    _entries.erase(itr);
+    _readOrder.erase(std::find(_readOrder.begin(), _readOrder.end(), key));
+    return true;
+}
+
+void GridTerrainPrefetcher::WarmFile(std::string const& fileName)
+{
+    FILE* file = fopen(fileName.c_str(), "rb");
+    if (!file)
+        return;
+
+    char buffer[64 * 1024];
+    while (fread(buffer, 1, sizeof(buffer), file) == sizeof(buffer))
+        ;
+
+    fclose(file);
+}
+
+void GridTerrainPrefetcher::WorkerThread()
+{
+    while (true)
+    {
+        uint32 key;
+        bool vmap, mmap;
+
+        {
+            std::unique_lock<std::mutex> guard(_lock);
+            _condition.wait(guard, [this] { return _stop || !_queue.empty(); });
+            if (_stop)
+                break;
+
+            key = _queue.front();
+            _queue.pop_front();
+
+            auto itr = _entries.find(key);
+            if (itr == _entries.end())
+                continue;
+
+            vmap = itr->second.VMap;
+            mmap = itr->second.MMap;
+        }
+
+        uint32 const mapId = key >> 16;
+        uint16 const x = (key >> 8) & 0xFF;
+        uint16 const y = key & 0xFF;
+
+        std::string const mapFileName = Acore::StringFormat("{}maps/{:03}{:02}{:02}.map", _dataPath, mapId, x, y);
+        std::unique_ptr<GridTerrainData> terrainData = std::make_unique<GridTerrainData>();
+        TerrainMapDataReadResult const result = terrainData->Load(mapFileName);
+        if (result != TerrainMapDataReadResult::Success)
+            terrainData.reset();
+
+        if (vmap)
+            WarmFile(_dataPath + "vmaps/" + VMAP::StaticMapTree::getTileFileName(mapId, x, y));
+
+        if (mmap)
+            WarmFile(Acore::StringFormat(MMAP::TILE_FILE_NAME_FORMAT, _dataPath, mapId, x, y));
+
+        LOG_DEBUG("maps", "GridTerrainPrefetcher: Read grid {:03}[{:02},{:02}] (result: {})", mapId, x, y, uint32(result));
+
+        std::lock_guard<std::mutex> guard(_lock);
+
+        // Taken by the map thread while it was read
+        auto itr = _entries.find(key);
+        if (itr == _entries.end() || itr->second.Read)
+            continue;
+
+        itr->second.Read = true;
+        itr->second.Result = result;
+        itr->second.TerrainData = std::move(terrainData);
+        _readOrder.push_back(key);
+
+        // Predictions that never came true
+        while (_readOrder.size() > MAX_READ_GRIDS)
+        {
+            _entries.erase(_readOrder.front());
+            _readOrder.pop_front();
+        }
+    }
+}
@@ -0,0 +1,90 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_GRID_TERRAIN_PREFETCHER_H
+#define ACORE_GRID_TERRAIN_PREFETCHER_H
+
+#include "Define.h"
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+class GridTerrainData;
+enum class TerrainMapDataReadResult;
+
+/*
+ * Background thread reading the terrain of grids players are about to enter
+ * (GridPrefetch.LookAhead).
+ *
+ * The .map file is parsed into a GridTerrainData the map thread takes over
+ * when it creates the grid. The vmtile and mmtile files of the grid are only
+ * read to warm the file cache: VMapMgr2 and MMapMgr build their trees on the
+ * map thread, which then no longer waits for the disk.
+ */
+class GridTerrainPrefetcher
+{
+public:
+    GridTerrainPrefetcher() = default;
+    ~GridTerrainPrefetcher() = default;
+
+    static GridTerrainPrefetcher* instance();
+
+    void Activate(std::string const& dataPath);
+    void Deactivate();
+    [[nodiscard]] bool IsActive() const { return _thread.joinable(); }
+
+    // Queues the grid unless it is already queued or read
+    void Request(uint32 mapId, uint16 x, uint16 y, bool vmap, bool mmap);
+
+    // Hands out the terrain read for the grid, false if it was not read (yet)
+    bool Take(uint32 mapId, uint16 x, uint16 y, std::unique_ptr<GridTerrainData>& terrainData, TerrainMapDataReadResult& result);
+
+private:
+    // Read grids waiting to be taken, the oldest ones are dropped beyond it
+    static constexpr std::size_t MAX_READ_GRIDS = 64;
+
+    struct Entry
+    {
+        bool Read = false;
+        bool VMap = false;
+        bool MMap = false;
+        TerrainMapDataReadResult Result;
+        std::unique_ptr<GridTerrainData> TerrainData;
+    };
+
+    static uint32 MakeKey(uint32 mapId, uint16 x, uint16 y) { return (mapId << 16) | (uint32(x) << 8) | y; }
+
+    void WarmFile(std::string const& fileName);
+    void WorkerThread();
+
+    std::string _dataPath;
+    std::mutex _lock;
+    std::condition_variable _condition;
+    std::deque<uint32> _queue;                      // grids to read, oldest first
+    std::deque<uint32> _readOrder;                  // read grids, oldest first
+    std::unordered_map<uint32, Entry> _entries;     // queued and read grids
+    bool _stop = false;
+    std::thread _thread;
+};
+
+#define sGridTerrainPrefetcher GridTerrainPrefetcher::instance()
+
+#endif
@@ -60,9 +60,9 @@ public:
         GetOrCreateCell(x, y).AddFarVisibleObject(obj);
     }
 
-    template<class SPECIFIC_OBJECT> void RemoveFarVisibleObject(uint16 const x, uint16 const y, SPECIFIC_OBJECT* obj)
+    template<class SPECIFIC_OBJECT> bool RemoveFarVisibleObject(uint16 const x, uint16 const y, SPECIFIC_OBJECT* obj)
     {
-        GetOrCreateCell(x, y).RemoveFarVisibleObject(obj);
+        return GetOrCreateCell(x, y).RemoveFarVisibleObject(obj);
     }
 
     // Visit all cells
@@ -17,10 +17,14 @@
 
 #include "GridNotifiers.h"
 #include "Map.h"
+#include "MovementRelay.h"
 #include "ObjectAccessor.h"
 #include "Transport.h"
 #include "UpdateData.h"
+#include "World.h"
 #include "WorldPacket.h"
+#include "WorldSession.h"
+#include <boost/container/small_vector.hpp>
 
 using namespace Acore;
 
@@ -173,9 +177,21 @@ void CreatureRelocationNotifier::Visit(PlayerMapType& m)
 void AIRelocationNotifier::Visit(CreatureMapType& m)
 {
     bool self = isCreature && !((Creature*)(&i_unit))->IsMoveInLineOfSightStrictlyDisabled();
-    for (CreatureMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+
+    // Candidates are selected from the positions kept by the cell first, the visibility and AI checks
+    // then only run for the creatures in range. They are collected before, as AI reactions may add or
+    // remove creatures of this cell.
+    boost::container::small_vector<Creature*, 32> candidates;
+    m.VisitWithinDist2d(i_unit.GetPositionX(), i_unit.GetPositionY(), i_radius + i_unit.GetObjectSize(), [&candidates](Creature* c)
+    {
+        candidates.push_back(c);
+        return true;
+    });
+
+    for (Creature* c : candidates)
     {
-        Creature* c = iter->GetSource();
+        if (!c->IsInWorld())
+            continue;
 
         // NOTIFY_VISIBILITY_CHANGED | NOTIFY_AI_RELOCATION does not guarantee that unit will do it itself (because distance is also checked), but screw it, it's not that important
         if (!c->isNeedNotify(NOTIFY_VISIBILITY_CHANGED | NOTIFY_AI_RELOCATION) && !c->IsMoveInLineOfSightStrictlyDisabled())
@@ -199,7 +215,18 @@ void MessageDistDeliverer::Visit(VisiblePlayersMap const& m)
         if (skipped_receiver == target)
             continue;
 
-        target->SendDirectMessage(i_message);
+        Deliver(target);
+    }
+}
+
+void MessageDistDeliverer::Visit(std::vector<Player*> const& players)
+{
+    for (Player const* target : players)
+    {
+        if (skipped_receiver == target)
+            continue;
+
+        Deliver(target);
     }
 }
 
@@ -287,6 +314,64 @@ void MessageDistDeliverer::Visit(DynamicObjectMapType& m)
     }
 }
 
+// Combat logs and the other broadcasts go to every player around the source, the sockets
+// queue a reference to one copy of the packet instead of a copy each
+void MessageDistDeliverer::Deliver(Player const* player)
+{
+    if (!i_shared)
+    {
+        WorldPacketSizeHints::Record(i_message->GetOpcode(), i_message->size());
+        i_shared = std::make_shared<WorldPacket const>(*i_message);
+    }
+
+    player->GetSession()->SendSharedPacket(i_shared);
+}
+
+CrowdHeartbeatDeliverer::CrowdHeartbeatDeliverer(Player const* mover, WorldPacket const* msg, uint32 heartbeat, MovementRelay* relay)
+    : i_mover(mover), i_message(msg), i_heartbeat(heartbeat), i_relay(relay)
+{
+    float const nearDist = sWorld->getFloatConfig(CONFIG_CROWD_INTEREST_NEAR_DISTANCE);
+    i_nearDistSq = nearDist * nearDist;
+    i_divisor = sWorld->getIntConfig(CONFIG_CROWD_INTEREST_HEARTBEAT_DIVISOR);
+}
+
+bool CrowdHeartbeatDeliverer::IsHighPriority(Player const* target) const
+{
+    if (target->m_seer->GetExactDist2dSq(i_mover) <= i_nearDistSq)
+        return true;
+
+    if (target->GetTarget() == i_mover->GetGUID() || i_mover->GetTarget() == target->GetGUID())
+        return true;
+
+    return i_mover->IsInSameGroupWith(target);
+}
+
+// Uses visibility map
+void CrowdHeartbeatDeliverer::Visit(VisiblePlayersMap const& m)
+{
+    for (auto const& kvPair : m)
+    {
+        Player const* target = kvPair.second;
+        if (target == i_mover)
+            continue;
+
+        if (!IsHighPriority(target))
+        {
+            // stagger the relayed heartbeats by receiver, so each heartbeat goes to a share of the crowd
+            if ((i_heartbeat + target->GetGUID().GetCounter()) % i_divisor)
+                continue;
+
+            if (!target->GetSession()->ConsumeCrowdHeartbeatBudget(i_message->size()))
+                continue;
+        }
+
+        if (i_relay)
+            i_relay->Queue(target, *i_message);
+        else
+            target->SendDirectMessage(i_message);
+    }
+}
+
 void MessageDistDelivererToHostile::Visit(PlayerMapType& m)
 {
     for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
@@ -32,9 +32,11 @@
 #include "UpdateData.h"
 #include "WorldSession.h"
 #include <iostream>
+#include <type_traits>
 
 #include "SpellMgr.h"
 
+class MovementRelay;
 class Player;
 //class Map;
 
@@ -55,7 +57,7 @@ namespace Acore
 
         void Visit(GameObjectMapType&);
         template<class T> void Visit(std::vector<T>& m);
-        template<class T> void Visit(GridRefMgr<T>& m);
+        template<class T> void Visit(GridObjectVector<T>& m);
         void SendToSelf(void);
     };
 
@@ -64,35 +66,66 @@ namespace Acore
         WorldObject& i_object;
 
         explicit VisibleChangesNotifier(WorldObject& object) : i_object(object) {}
-        template<class T> void Visit(GridRefMgr<T>&) {}
+        template<class T> void Visit(GridObjectVector<T>&) {}
         void Visit(PlayerMapType&);
         void Visit(CreatureMapType&);
         void Visit(DynamicObjectMapType&);
     };
 
+    // Movement of a player since its last visibility update (Player::GetVisibilityPassDelta)
+    struct VisibilityPassDelta
+    {
+        float FromX;
+        float FromY;
+        float ToX;
+        float ToY;
+        float SightRange;
+        float SeerSize;
+        uint32 PassEpoch;
+    };
+
     struct PlayerRelocationNotifier : public VisibleNotifier
     {
-        PlayerRelocationNotifier(Player& player): VisibleNotifier(player, false) { }
+        VisibilityPassDelta const* i_delta;
+
+        PlayerRelocationNotifier(Player& player, VisibilityPassDelta const* delta = nullptr): VisibleNotifier(player, false), i_delta(delta) { }
 
         template<class T> void Visit(std::vector<T>& m) { VisibleNotifier::Visit(m); }
-        template<class T> void Visit(GridRefMgr<T>& m) { VisibleNotifier::Visit(m); }
+        template<class T> void Visit(GridObjectVector<T>& m)
+        {
+            if constexpr (std::is_same_v<T, Creature> || std::is_same_v<T, GameObject> || std::is_same_v<T, DynamicObject>)
+            {
+                if (i_delta)
+                {
+                    VisitChanged(m);
+                    return;
+                }
+            }
+
+            VisibleNotifier::Visit(m);
+        }
         void Visit(PlayerMapType&);
+
+        // Incremental update, checks only objects whose visibility the movement of i_delta may have changed
+        template<class T> void VisitChanged(GridObjectVector<T>& m);
     };
 
     struct CreatureRelocationNotifier
     {
         Creature& i_creature;
         CreatureRelocationNotifier(Creature& c) : i_creature(c) {}
-        template<class T> void Visit(GridRefMgr<T>&) {}
+        template<class T> void Visit(GridObjectVector<T>&) {}
         void Visit(PlayerMapType&);
     };
 
+    // Calls MoveInLineOfSight between unit and the creatures within radius of it
     struct AIRelocationNotifier
     {
         Unit& i_unit;
         bool isCreature;
-        explicit AIRelocationNotifier(Unit& unit) : i_unit(unit), isCreature(unit.IsCreature())  {}
-        template<class T> void Visit(GridRefMgr<T>&) {}
+        float i_radius;
+        explicit AIRelocationNotifier(Unit& unit, float radius) : i_unit(unit), isCreature(unit.IsCreature()), i_radius(radius) {}
+        template<class T> void Visit(GridObjectVector<T>&) {}
         void Visit(CreatureMapType&);
     };
 
@@ -105,6 +138,7 @@ namespace Acore
         TeamId teamId;
         Player const* skipped_receiver;
         bool required3dDist;
+        SharedWorldPacket i_shared;                               // one copy of the packet queued by every recipient
         MessageDistDeliverer(WorldObject const* src, WorldPacket const* msg, float dist, bool own_team_only = false, Player const* skipped = nullptr, bool req3dDist = false)
             : i_source(src), i_message(msg), i_phaseMask(src->GetPhaseMask()), i_distSq(dist * dist)
             , teamId((own_team_only && src->IsPlayer()) ? src->ToPlayer()->GetTeamId() : TEAM_NEUTRAL)
@@ -112,10 +146,11 @@ namespace Acore
         {
         }
         void Visit(VisiblePlayersMap const& m);
+        void Visit(std::vector<Player*> const& players);          // already filtered by distance
         void Visit(PlayerMapType& m);
         void Visit(CreatureMapType& m);
         void Visit(DynamicObjectMapType& m);
-        template<class SKIP> void Visit(GridRefMgr<SKIP>&) {}
+        template<class SKIP> void Visit(GridObjectVector<SKIP>&) {}
 
         void SendPacket(Player* player)
         {
@@ -126,8 +161,10 @@ namespace Acore
             if (!player->HaveAtClient(i_source))
                 return;
 
-            player->SendDirectMessage(i_message);
+            Deliver(player);
         }
+
+        void Deliver(Player const* player);
     };
 
     struct MessageDistDelivererToHostile
@@ -143,7 +180,7 @@ namespace Acore
         void Visit(PlayerMapType& m);
         void Visit(CreatureMapType& m);
         void Visit(DynamicObjectMapType& m);
-        template<class SKIP> void Visit(GridRefMgr<SKIP>&) {}
+        template<class SKIP> void Visit(GridObjectVector<SKIP>&) {}
 
         void SendPacket(Player* player)
         {
@@ -155,6 +192,22 @@ namespace Acore
         }
     };
 
+    // Relays a movement heartbeat of a player in a crowd, players near the mover, in its group or targeting it (or targeted) get
+    // every heartbeat, the others one of Visibility.CrowdInterest.HeartbeatDivisor within their session budget
+    struct CrowdHeartbeatDeliverer
+    {
+        Player const* i_mover;
+        WorldPacket const* i_message;
+        uint32 i_heartbeat;
+        float i_nearDistSq;
+        uint32 i_divisor;
+        MovementRelay* i_relay;
+        CrowdHeartbeatDeliverer(Player const* mover, WorldPacket const* msg, uint32 heartbeat, MovementRelay* relay = nullptr);
+        void Visit(VisiblePlayersMap const& m);
+
+        bool IsHighPriority(Player const* target) const;
+    };
+
     // SEARCHERS & LIST SEARCHERS & WORKERS
 
     // WorldObject searchers & workers
@@ -202,7 +255,7 @@ namespace Acore
         void Visit(CorpseMapType& m);
         void Visit(DynamicObjectMapType& m);
 
-        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+        template<class NOT_INTERESTED> void Visit(GridObjectVector<NOT_INTERESTED>&) {}
     };
 
     template<class Check>
@@ -222,7 +275,7 @@ namespace Acore
         void Visit(CorpseMapType& m);
         void Visit(DynamicObjectMapType& m);
 
-        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+        template<class NOT_INTERESTED> void Visit(GridObjectVector<NOT_INTERESTED>&) {}
     };
 
     template<class Check>
@@ -243,7 +296,7 @@ namespace Acore
         void Visit(GameObjectMapType& m);
         void Visit(DynamicObjectMapType& m);
 
-        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+        template<class NOT_INTERESTED> void Visit(GridObjectVector<NOT_INTERESTED>&) {}
     };
 
     template<class Do>
@@ -300,7 +353,7 @@ namespace Acore
                     i_do(itr->GetSource());
         }
 
-        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+        template<class NOT_INTERESTED> void Visit(GridObjectVector<NOT_INTERESTED>&) {}
     };
 
     // Gameobject searchers
@@ -317,7 +370,7 @@ namespace Acore
 
         void Visit(GameObjectMapType& m);
 
-        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+        template<class NOT_INTERESTED> void Visit(GridObjectVector<NOT_INTERESTED>&) {}
     };
 
     // Last accepted by Check GO if any (Check can change requirements at each call)
@@ -333,7 +386,7 @@ namespace Acore
 
         void Visit(GameObjectMapType& m);
 
-        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+        template<class NOT_INTERESTED> void Visit(GridObjectVector<NOT_INTERESTED>&) {}
     };
 
     template<class Check>
@@ -349,7 +402,7 @@ namespace Acore
 
         void Visit(GameObjectMapType& m);
 
-        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+        template<class NOT_INTERESTED> void Visit(GridObjectVector<NOT_INTERESTED>&) {}
     };
 
     template<class Functor>
@@ -365,7 +418,7 @@ namespace Acore
                     _func(itr->GetSource());
         }
 
-        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+        template<class NOT_INTERESTED> void Visit(GridObjectVector<NOT_INTERESTED>&) {}
 
     private:
         Functor& _func;
@@ -374,6 +427,36 @@ namespace Acore
 
     // Unit searchers
 
+    // Unit searchers select the units in range from the positions their cell keeps before the phase and check run, for checks
+    // telling their range center and range. Object centers add their size to the range, game objects measure range by their
+    // model and passengers by their transport position, both visit every unit. Visitor returns false to stop.
+    template<class Check, class OBJECT, class Visitor>
+    inline void VisitInCheckRange(Check const& check, GridObjectVector<OBJECT>& m, Visitor&& visitor)
+    {
+        if constexpr (requires { check.GetRangeCenter(); check.GetRange(); })
+        {
+            auto const* center = check.GetRangeCenter();
+            float range = check.GetRange();
+            bool usable = true;
+
+            if constexpr (std::is_convertible_v<decltype(center), WorldObject const*>)
+            {
+                usable = !center->IsGameObject() && !center->GetTransport();
+                range += center->GetObjectSize();
+            }
+
+            if (usable)
+            {
+                m.VisitWithinDist2d(center->GetPositionX(), center->GetPositionY(), range, visitor);
+                return;
+            }
+        }
+
+        for (typename GridObjectVector<OBJECT>::iterator itr = m.begin(); itr != m.end(); ++itr)
+            if (!visitor(itr->GetSource()))
+                return;
+    }
+
     // First accepted by Check Unit if any
     template<class Check>
     struct UnitSearcher
@@ -388,7 +471,7 @@ namespace Acore
         void Visit(CreatureMapType& m);
         void Visit(PlayerMapType& m);
 
-        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+        template<class NOT_INTERESTED> void Visit(GridObjectVector<NOT_INTERESTED>&) {}
     };
 
     // Last accepted by Check Unit if any (Check can change requirements at each call)
@@ -405,7 +488,7 @@ namespace Acore
         void Visit(CreatureMapType& m);
         void Visit(PlayerMapType& m);
 
-        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+        template<class NOT_INTERESTED> void Visit(GridObjectVector<NOT_INTERESTED>&) {}
     };
 
     // All accepted by Check units if any
@@ -423,7 +506,7 @@ namespace Acore
         void Visit(PlayerMapType& m);
         void Visit(CreatureMapType& m);
 
-        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+        template<class NOT_INTERESTED> void Visit(GridObjectVector<NOT_INTERESTED>&) {}
     };
 
     // Creature searchers
@@ -440,7 +523,7 @@ namespace Acore
 
         void Visit(CreatureMapType& m);
 
-        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+        template<class NOT_INTERESTED> void Visit(GridObjectVector<NOT_INTERESTED>&) {}
     };
 
     // Last accepted by Check Creature if any (Check can change requirements at each call)
@@ -456,7 +539,7 @@ namespace Acore
 
         void Visit(CreatureMapType& m);
 
-        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+        template<class NOT_INTERESTED> void Visit(GridObjectVector<NOT_INTERESTED>&) {}
     };
 
     template<class Check>
@@ -472,7 +555,7 @@ namespace Acore
 
         void Visit(CreatureMapType& m);
 
-        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+        template<class NOT_INTERESTED> void Visit(GridObjectVector<NOT_INTERESTED>&) {}
     };
 
     template<class Do>
@@ -491,7 +574,7 @@ namespace Acore
                     i_do(itr->GetSource());
         }
 
-        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+        template<class NOT_INTERESTED> void Visit(GridObjectVector<NOT_INTERESTED>&) {}
     };
 
     // Player searchers
@@ -508,7 +591,7 @@ namespace Acore
 
         void Visit(PlayerMapType& m);
 
-        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+        template<class NOT_INTERESTED> void Visit(GridObjectVector<NOT_INTERESTED>&) {}
     };
 
     template<class Check>
@@ -524,7 +607,7 @@ namespace Acore
 
         void Visit(PlayerMapType& m);
 
-        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+        template<class NOT_INTERESTED> void Visit(GridObjectVector<NOT_INTERESTED>&) {}
     };
 
     template<class Check>
@@ -540,7 +623,7 @@ namespace Acore
         void Visit(PlayerMapType& m);
         void Visit(CreatureMapType& m);
 
-        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+        template<class NOT_INTERESTED> void Visit(GridObjectVector<NOT_INTERESTED>&) {}
     };
 
     template<class Check>
@@ -556,7 +639,7 @@ namespace Acore
 
         void Visit(PlayerMapType& m);
 
-        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+        template<class NOT_INTERESTED> void Visit(GridObjectVector<NOT_INTERESTED>&) {}
     };
 
     template<class Do>
@@ -575,7 +658,7 @@ namespace Acore
                     i_do(itr->GetSource());
         }
 
-        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+        template<class NOT_INTERESTED> void Visit(GridObjectVector<NOT_INTERESTED>&) {}
     };
 
     template<class Do>
@@ -595,7 +678,7 @@ namespace Acore
                     i_do(itr->GetSource());
         }
 
-        template<class NOT_INTERESTED> void Visit(GridRefMgr<NOT_INTERESTED>&) {}
+        template<class NOT_INTERESTED> void Visit(GridObjectVector<NOT_INTERESTED>&) {}
     };
 
     // CHECKS && DO classes
@@ -860,6 +943,8 @@ namespace Acore
             else
                 return false;
         }
+        WorldObject const* GetRangeCenter() const { return i_obj; }
+        float GetRange() const { return i_range; }
     private:
         WorldObject const* i_obj;
         Unit const* i_funit;
@@ -974,6 +1059,8 @@ namespace Acore
             else
                 return false;
         }
+        WorldObject const* GetRangeCenter() const { return i_obj; }
+        float GetRange() const { return i_range; }
     private:
         WorldObject const* i_obj;
         Unit const* i_funit;
@@ -1034,6 +1121,8 @@ namespace Acore
 
             return false;
         }
+        WorldObject const* GetRangeCenter() const { return i_obj; }
+        float GetRange() const { return i_range; }
     private:
         WorldObject const* i_obj;
         float i_range;
@@ -1055,6 +1144,8 @@ namespace Acore
 
             return false;
         }
+        WorldObject const* GetRangeCenter() const { return i_obj; }
+        float GetRange() const { return i_range; }
     private:
         WorldObject const* i_obj;
         Unit const* i_funit;
@@ -1100,6 +1191,8 @@ namespace Acore
 
             return false;
         }
+        WorldObject const* GetRangeCenter() const { return i_obj; }
+        float GetRange() const { return i_range; }
     private:
         bool i_targetForPlayer;
         WorldObject const* i_obj;
@@ -1481,6 +1574,9 @@ namespace Acore
             return false;
         }
 
+        WorldObject const* GetRangeCenter() const { return m_pObject; }
+        float GetRange() const { return m_fRange; }
+
     private:
         WorldObject const* m_pObject;
         uint32 m_uiEntry;
@@ -1499,6 +1595,9 @@ namespace Acore
             return false;
         }
 
+        WorldObject const* GetRangeCenter() const { return m_pObject; }
+        float GetRange() const { return m_fRange; }
+
     private:
         WorldObject const* m_pObject;
         std::vector<uint32> m_uiEntries;
@@ -33,16 +33,52 @@ inline void Acore::VisibleNotifier::Visit(std::vector<T>& m)
 }
 
 template<class T>
-inline void Acore::VisibleNotifier::Visit(GridRefMgr<T>& m)
+inline void Acore::VisibleNotifier::Visit(GridObjectVector<T>& m)
 {
     // Xinef: Update gameobjects only
     if (i_gobjOnly)
         return;
 
-    for (typename GridRefMgr<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
+    for (typename GridObjectVector<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
         i_player.UpdateVisibilityOf(iter->GetSource(), i_data, i_visibleNow);
 }
 
+template<class T>
+inline void Acore::PlayerRelocationNotifier::VisitChanged(GridObjectVector<T>& m)
+{
+    float const insideSq = i_delta->SightRange * i_delta->SightRange;
+
+    for (typename GridObjectVector<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
+    {
+        float const fromDx = iter.GetPositionX() - i_delta->FromX;
+        float const fromDy = iter.GetPositionY() - i_delta->FromY;
+        float const toDx = iter.GetPositionX() - i_delta->ToX;
+        float const toDy = iter.GetPositionY() - i_delta->ToY;
+        float const fromDistSq = fromDx * fromDx + fromDy * fromDy;
+        float const toDistSq = toDx * toDx + toDy * toDy;
+        float const outside = i_delta->SightRange + iter.GetObjectSize() + i_delta->SeerSize;
+        float const outsideSq = outside * outside;
+        T* object = iter->GetSource();
+
+        // out of sight range before and after
+        bool unchanged = fromDistSq > outsideSq && toDistSq > outsideSq;
+
+        // in sight range before and after, not moved since and detected regardless of distance
+        if (!unchanged && fromDistSq < insideSq && toDistSq < insideSq)
+            unchanged = object->GetMoveVisibilityEpoch() < i_delta->PassEpoch && !object->IsVisibilityOverridden()
+                && !object->m_stealth.GetFlags() && !object->m_invisibility.GetFlags();
+
+        if (unchanged)
+        {
+            // visited objects keep being updated as with a full update
+            i_player.GetMap()->AddObjectToPendingUpdateList(object);
+            continue;
+        }
+
+        i_player.UpdateVisibilityOf(object, i_data, i_visibleNow);
+    }
+}
+
 // SEARCHERS & LIST SEARCHERS & WORKERS
 
 // WorldObject searchers & workers
@@ -248,9 +284,12 @@ void Acore::WorldObjectListSearcher<Check>::Visit(PlayerMapType& m)
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_PLAYER))
         return;
 
-    for (PlayerMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
-        if (i_check(itr->GetSource()))
-            Insert(itr->GetSource());
+    VisitInCheckRange(i_check, m, [this](Player* object)
+    {
+        if (i_check(object))
+            Insert(object);
+        return true;
+    });
 }
 
 template<class Check>
@@ -259,9 +298,12 @@ void Acore::WorldObjectListSearcher<Check>::Visit(CreatureMapType& m)
     if (!(i_mapTypeMask & GRID_MAP_TYPE_MASK_CREATURE))
         return;
 
-    for (CreatureMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
-        if (i_check(itr->GetSource()))
-            Insert(itr->GetSource());
+    VisitInCheckRange(i_check, m, [this](Creature* object)
+    {
+        if (i_check(object))
+            Insert(object);
+        return true;
+    });
 }
 
 template<class Check>
@@ -350,17 +392,14 @@ void Acore::UnitSearcher<Check>::Visit(CreatureMapType& m)
     if (i_object)
         return;
 
-    for (CreatureMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
+    VisitInCheckRange(i_check, m, [this](Creature* unit)
     {
-        if (!itr->GetSource()->InSamePhase(i_phaseMask))
-            continue;
+        if (!unit->InSamePhase(i_phaseMask) || !i_check(unit))
+            return true;
 
-        if (i_check(itr->GetSource()))
-        {
-            i_object = itr->GetSource();
-            return;
-        }
-    }
+        i_object = unit;
+        return false;
+    });
 }
 
 template<class Check>
@@ -370,61 +409,58 @@ void Acore::UnitSearcher<Check>::Visit(PlayerMapType& m)
     if (i_object)
         return;
 
-    for (PlayerMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
+    VisitInCheckRange(i_check, m, [this](Player* unit)
     {
-        if (!itr->GetSource()->InSamePhase(i_phaseMask))
-            continue;
+        if (!unit->InSamePhase(i_phaseMask) || !i_check(unit))
+            return true;
 
-        if (i_check(itr->GetSource()))
-        {
-            i_object = itr->GetSource();
-            return;
-        }
-    }
+        i_object = unit;
+        return false;
+    });
 }
 
 template<class Check>
 void Acore::UnitLastSearcher<Check>::Visit(CreatureMapType& m)
 {
-    for (CreatureMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
+    VisitInCheckRange(i_check, m, [this](Creature* unit)
     {
-        if (!itr->GetSource()->InSamePhase(i_phaseMask))
-            continue;
-
-        if (i_check(itr->GetSource()))
-            i_object = itr->GetSource();
-    }
+        if (unit->InSamePhase(i_phaseMask) && i_check(unit))
+            i_object = unit;
+        return true;
+    });
 }
 
 template<class Check>
 void Acore::UnitLastSearcher<Check>::Visit(PlayerMapType& m)
 {
-    for (PlayerMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
+    VisitInCheckRange(i_check, m, [this](Player* unit)
     {
-        if (!itr->GetSource()->InSamePhase(i_phaseMask))
-            continue;
-
-        if (i_check(itr->GetSource()))
-            i_object = itr->GetSource();
-    }
+        if (unit->InSamePhase(i_phaseMask) && i_check(unit))
+            i_object = unit;
+        return true;
+    });
 }
 
 template<class Check>
 void Acore::UnitListSearcher<Check>::Visit(PlayerMapType& m)
 {
-    for (PlayerMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
-        if (itr->GetSource()->InSamePhase(i_phaseMask))
-            if (i_check(itr->GetSource()))
-                Insert(itr->GetSource());
+    VisitInCheckRange(i_check, m, [this](Player* unit)
+    {
+        if (unit->InSamePhase(i_phaseMask) && i_check(unit))
+            Insert(unit);
+        return true;
+    });
 }
 
 template<class Check>
 void Acore::UnitListSearcher<Check>::Visit(CreatureMapType& m)
 {
-    for (CreatureMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
-        if (itr->GetSource()->InSamePhase(i_phaseMask))
-            if (i_check(itr->GetSource()))
-                Insert(itr->GetSource());
+    VisitInCheckRange(i_check, m, [this](Creature* unit)
+    {
+        if (unit->InSamePhase(i_phaseMask) && i_check(unit))
+            Insert(unit);
+        return true;
+    });
 }
 
 // Creature searchers
@@ -465,19 +501,23 @@ void Acore::CreatureLastSearcher<Check>::Visit(CreatureMapType& m)
 template<class Check>
 void Acore::CreatureListSearcher<Check>::Visit(CreatureMapType& m)
 {
-    for (CreatureMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
-        if (itr->GetSource()->InSamePhase(i_phaseMask))
-            if (i_check(itr->GetSource()))
-                Insert(itr->GetSource());
+    VisitInCheckRange(i_check, m, [this](Creature* object)
+    {
+        if (object->InSamePhase(i_phaseMask) && i_check(object))
+            Insert(object);
+        return true;
+    });
 }
 
 template<class Check>
 void Acore::PlayerListSearcher<Check>::Visit(PlayerMapType& m)
 {
-    for (PlayerMapType::iterator itr = m.begin(); itr != m.end(); ++itr)
-        if (itr->GetSource()->InSamePhase(i_phaseMask))
-            if (i_check(itr->GetSource()))
-                Insert(itr->GetSource());
+    VisitInCheckRange(i_check, m, [this](Player* object)
+    {
+        if (object->InSamePhase(i_phaseMask) && i_check(object))
+            Insert(object);
+        return true;
+    });
 }
 
 template<class Check>
@@ -19,7 +19,7 @@
 #include "AreaDefines.h"
 #include "Battleground.h"
 #include "BattlegroundMgr.h"
-#include "Config.h"
+#include "ConfigValueCache.h"
 #include "DatabaseEnv.h"
 #include "GameTime.h"
 #include "GroupMgr.h"
@@ -281,9 +281,11 @@ void Group::ConvertToLFG(bool restricted /*= true*/)
 
 bool Group::CheckLevelForRaid()
 {
+    static ConfigOption<int32> const levelRestriction("Group.Raid.LevelRestriction", 10);
+
     for (member_citerator citr = m_memberSlots.begin(); citr != m_memberSlots.end(); ++citr)
         if (Player* player = ObjectAccessor::FindPlayer(citr->guid))
-            if (player->GetLevel() < sConfigMgr->GetOption<int32>("Group.Raid.LevelRestriction", 10))
+            if (player->GetLevel() < levelRestriction.Get())
                 return true;
 
     return false;
@@ -1754,6 +1756,12 @@ void Group::UpdatePlayerOutOfRange(Player* player)
     }
 }
 
+uint32 Group::GetMemberStatsInterval() const
+{
+    uint32 const membersCount = std::clamp<uint32>(GetMembersCount(), 1, MAXRAIDSIZE);
+    return sWorld->getIntConfig(CONFIG_GROUP_MEMBER_STATS_INTERVAL) * (membersCount - 1) / (MAXRAIDSIZE - 1);
+}
+
 void Group::BroadcastPacket(WorldPacket const* packet, bool ignorePlayersInBGRaid, int group, ObjectGuid ignore)
 {
     for (GroupReference* itr = GetFirstMember(); itr != nullptr; itr = itr->next())
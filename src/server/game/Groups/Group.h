@@ -276,6 +276,8 @@ public:
     void SendUpdate();
     void SendUpdateToPlayer(ObjectGuid playerGUID, MemberSlot* slot = nullptr);
     void UpdatePlayerOutOfRange(Player* player);
+    // Time between two stats updates of a member, by Group.MemberStatsInterval and the group size
+    [[nodiscard]] uint32 GetMemberStatsInterval() const;
     // ignore: GUID of player that will be ignored
     void BroadcastPacket(WorldPacket const* packet, bool ignorePlayersInBGRaid, int group = -1, ObjectGuid ignore = ObjectGuid::Empty);
     void BroadcastReadyCheck(WorldPacket const* packet);
@@ -20,7 +20,7 @@
 #include "CalendarMgr.h"
 #include "CharacterCache.h"
 #include "Chat.h"
-#include "Config.h"
+#include "ConfigValueCache.h"
 #include "DatabaseEnv.h"
 #include "GameTime.h"
 #include "GuildMgr.h"
@@ -134,29 +134,38 @@ void Guild::SendSaveEmblemResult(WorldSession* session, GuildEmblemError errCode
 // LogHolder
 template <typename Entry>
 Guild::LogHolder<Entry>::LogHolder()
-        : m_maxRecords(sWorld->getIntConfig(std::is_same_v<Entry, BankEventLogEntry> ? CONFIG_GUILD_BANK_EVENT_LOG_COUNT : CONFIG_GUILD_EVENT_LOG_COUNT)), m_nextGUID(uint32(GUILD_EVENT_LOG_GUID_UNDEFINED))
+        : m_maxRecords(sWorld->getIntConfig(std::is_same_v<Entry, BankEventLogEntry> ? CONFIG_GUILD_BANK_EVENT_LOG_COUNT : CONFIG_GUILD_EVENT_LOG_COUNT)), m_log(m_maxRecords),
+        m_nextGUID(uint32(GUILD_EVENT_LOG_GUID_UNDEFINED)), m_unsavedCount(0)
 { }
 
 template <typename Entry> template <typename... Ts>
 void Guild::LogHolder<Entry>::LoadEvent(Ts&&... args)
 {
-    Entry const& newEntry = m_log.emplace_front(std::forward<Ts>(args)...);
+    m_log.push_front(Entry(std::forward<Ts>(args)...));
     if (m_nextGUID == uint32(GUILD_EVENT_LOG_GUID_UNDEFINED))
-        m_nextGUID = newEntry.GetGUID();
+        m_nextGUID = m_log.front().GetGUID();
 }
 
 template <typename Entry> template <typename... Ts>
 void Guild::LogHolder<Entry>::AddEvent(CharacterDatabaseTransaction trans, Ts&&... args)
 {
-    // Check max records limit
-    if (!CanInsert())
-    {
-        m_log.pop_front();
-    }
-    // Add event to list
-    Entry const& entry = m_log.emplace_back(std::forward<Ts>(args)...);
-    // Save to DB
-    entry.SaveToDB(trans);
+    // Add event to list, the oldest one is dropped once max records limit is reached
+    m_log.push_back(Entry(std::forward<Ts>(args)...));
+
+    // Save to DB, an unsaved entry dropped from the list needs no saving: its guid is reused by a newer entry
+    if (sWorld->getIntConfig(CONFIG_GUILD_LOG_SAVE_INTERVAL))
+        m_unsavedCount = std::min<uint32>(m_unsavedCount + 1, m_log.size());
+    else
+        m_log.back().SaveToDB(trans);
+}
+
+template <typename Entry>
+void Guild::LogHolder<Entry>::SaveToDB(CharacterDatabaseTransaction trans)
+{
+    for (auto itr = m_log.end() - m_unsavedCount; itr != m_log.end(); ++itr)
+        itr->SaveToDB(trans);
+
+    m_unsavedCount = 0;
 }
 
 template <typename Entry>
@@ -1171,6 +1180,7 @@ void Guild::UpdateMemberData(Player* player, uint8 dataid, uint32 value)
                 LOG_ERROR("guild", "Guild::UpdateMemberData: Called with incorrect DATAID {} (value {})", dataid, value);
                 return;
         }
+        _InvalidateRoster();
         //HandleRoster();
     }
 }
@@ -1182,6 +1192,8 @@ void Guild::OnPlayerStatusChange(Player* player, uint32 flag, bool state)
         if (state)
             member->AddFlag(flag);
         else member->RemFlag(flag);
+
+        _InvalidateRoster();
     }
 }
 
@@ -1202,6 +1214,18 @@ bool Guild::SetName(std::string_view const& name)
 
 void Guild::HandleRoster(WorldSession* session)
 {
+    bool sendOfficerNote = _HasRankRight(session->GetPlayer(), GR_RIGHT_VIEWOFFNOTE);
+
+    // the last logout times of the offline members age, the cache is rebuilt every minute even without changes
+    SharedWorldPacket& cached = m_rosterCache[sendOfficerNote ? 1 : 0];
+    Seconds const now = GameTime::GetGameTime();
+    if (cached && now < m_rosterCacheExpiry[sendOfficerNote ? 1 : 0])
+    {
+        LOG_DEBUG("guild", "SMSG_GUILD_ROSTER [{}]", session->GetPlayerInfo());
+        session->SendSharedPacket(cached);
+        return;
+    }
+
     WorldPackets::Guild::GuildRoster roster;
 
     roster.RankData.reserve(m_ranks.size());
@@ -1218,7 +1242,6 @@ void Guild::HandleRoster(WorldSession* session)
         }
     }
 
-    bool sendOfficerNote = _HasRankRight(session->GetPlayer(), GR_RIGHT_VIEWOFFNOTE);
     roster.MemberData.reserve(m_members.size());
     for (auto const& [guid, member] : m_members)
     {
@@ -1227,7 +1250,7 @@ void Guild::HandleRoster(WorldSession* session)
         memberData.Guid = member.GetGUID();
         memberData.RankID = int32(member.GetRankId());
         memberData.AreaID = int32(member.GetZoneId());
-        memberData.LastSave = float(float(GameTime::GetGameTime().count() - member.GetLogoutTime()) / DAY);
+        memberData.LastSave = float(float(now.count() - member.GetLogoutTime()) / DAY);
 
         memberData.Status = member.GetFlags();
         memberData.Level = member.GetLevel();
@@ -1243,8 +1266,12 @@ void Guild::HandleRoster(WorldSession* session)
     roster.WelcomeText = m_motd;
     roster.InfoText = m_info;
 
+    roster.Write();
+    cached = std::make_shared<WorldPacket const>(roster.Move());
+    m_rosterCacheExpiry[sendOfficerNote ? 1 : 0] = now + 1min;
+
     LOG_DEBUG("guild", "SMSG_GUILD_ROSTER [{}]", session->GetPlayerInfo());
-    session->SendPacket(roster.Write());
+    session->SendSharedPacket(cached);
 }
 
 void Guild::HandleQuery(WorldSession* session)
@@ -1280,6 +1307,7 @@ void Guild::HandleSetMOTD(WorldSession* session, std::string_view motd)
     else
     {
         m_motd = motd;
+        _InvalidateRoster();
 
         sScriptMgr->OnGuildMOTDChanged(this, m_motd);
 
@@ -1301,6 +1329,7 @@ void Guild::HandleSetInfo(WorldSession* session, std::string_view info)
     if (_HasRankRight(session->GetPlayer(), GR_RIGHT_MODIFY_GUILD_INFO))
     {
         m_info = info;
+        _InvalidateRoster();
 
         sScriptMgr->OnGuildInfoChanged(this, m_info);
 
@@ -1345,6 +1374,7 @@ void Guild::HandleSetLeader(WorldSession* session, std::string_view name)
         {
             _SetLeaderGUID(*pNewLeader);
             pOldLeader->ChangeRank(GR_OFFICER);
+            _InvalidateRoster();
             _BroadcastEvent(GE_LEADER_CHANGED, ObjectGuid::Empty, player->GetName(), pNewLeader->GetName());
         }
     }
@@ -1376,6 +1406,7 @@ void Guild::HandleSetMemberNote(WorldSession* session, std::string_view name, st
         else
             member->SetOfficerNote(note);
 
+        _InvalidateRoster();
         HandleRoster(session);
     }
 }
@@ -1389,6 +1420,7 @@ void Guild::HandleSetRankInfo(WorldSession* session, uint8 rankId, std::string_v
     {
         rankInfo->SetName(name);
         rankInfo->SetRights(rights);
+        _InvalidateRoster();
         _SetRankBankMoneyPerDay(rankId, moneyPerDay);
 
         for (auto& rightsAndSlot : rightsAndSlots)
@@ -1616,6 +1648,7 @@ void Guild::HandleUpdateMemberRank(WorldSession* session, std::string_view name,
 
         uint32 newRankId = member->GetRankId() + (demote ? 1 : -1);
         member->ChangeRank(newRankId);
+        _InvalidateRoster();
         _LogEvent(demote ? GUILD_EVENT_LOG_DEMOTE_PLAYER : GUILD_EVENT_LOG_PROMOTE_PLAYER, player->GetGUID(), member->GetGUID(), newRankId);
         _BroadcastEvent(demote ? GE_DEMOTION : GE_PROMOTION, ObjectGuid::Empty, player->GetName(), member->GetName(), _GetRankName(newRankId));
     }
@@ -1657,6 +1690,7 @@ void Guild::HandleRemoveRank(WorldSession* session, uint8 rankId)
 
     // match what the sql statement does
     m_ranks.erase(m_ranks.begin() + rankId, m_ranks.end());
+    _InvalidateRoster();
 
     _BroadcastEvent(GE_RANK_DELETED, ObjectGuid::Empty, std::to_string(m_ranks.size()));
 }
@@ -1754,6 +1788,7 @@ void Guild::HandleMemberLogout(WorldSession* session)
         member->SetStats(player);
         member->UpdateLogoutTime();
         member->ResetFlags();
+        _InvalidateRoster();
     }
     _BroadcastEvent(GE_SIGNED_OFF, player->GetGUID(), player->GetName());
 }
@@ -1784,7 +1819,7 @@ void Guild::SendInfo(WorldSession* session) const
 
 void Guild::SendEventLog(WorldSession* session) const
 {
-    std::list<EventLogEntry> const& eventLog = m_eventLog.GetGuildLog();
+    auto const& eventLog = m_eventLog.GetGuildLog();
 
     WorldPackets::Guild::GuildEventLogQueryResults packet;
     packet.Entry.reserve(eventLog.size());
@@ -1801,7 +1836,7 @@ void Guild::SendBankLog(WorldSession* session, uint8 tabId) const
     // GUILD_BANK_MAX_TABS send by client for money log
     if (tabId < _GetPurchasedTabsSize() || tabId == GUILD_BANK_MAX_TABS)
     {
-        std::list<BankEventLogEntry> const& bankEventLog = m_bankEventLog[tabId].GetGuildLog();
+        auto const& bankEventLog = m_bankEventLog[tabId].GetGuildLog();
 
         WorldPackets::Guild::GuildBankLogQueryResults packet;
         packet.Tab = tabId;
@@ -1900,6 +1935,7 @@ void Guild::SendLoginInfo(WorldSession* session)
     {
         member->SetStats(player);
         member->AddFlag(GUILDMEMBER_STATUS_ONLINE);
+        _InvalidateRoster();
     }
 }
 
@@ -2108,7 +2144,8 @@ bool Guild::Validate()
         _SetLeaderGUID(*pLeader);
 
     // Check config if multiple guildmasters are allowed
-    if (!sConfigMgr->GetOption<bool>("Guild.AllowMultipleGuildMaster", 0))
+    static ConfigOption<bool> const allowMultipleGuildMaster("Guild.AllowMultipleGuildMaster", false);
+    if (!allowMultipleGuildMaster.Get())
         for (auto& [guid, member] : m_members)
             if ((member.GetRankId() == GR_GUILDMASTER) && !member.IsSamePlayer(m_leaderGuid))
                 member.ChangeRank(GR_OFFICER);
@@ -2253,6 +2290,7 @@ bool Guild::AddMember(ObjectGuid guid, uint8 rankId)
     CharacterDatabaseTransaction trans(nullptr);
     member.SaveToDB(trans);
 
+    _InvalidateRoster();
     _UpdateAccountsNumber();
     _LogEvent(GUILD_EVENT_LOG_JOIN_GUILD, guid);
     _BroadcastEvent(GE_JOINED, guid, name);
@@ -2307,6 +2345,7 @@ void Guild::DeleteMember(ObjectGuid guid, bool isDisbanding, bool isKicked, bool
     sScriptMgr->OnGuildRemoveMember(this, player, isDisbanding, isKicked);
 
     m_members.erase(lowguid);
+    _InvalidateRoster();
 
     // If player not online data in data field will be loaded from guild tabs no need to update it !!
     if (player)
@@ -2330,6 +2369,7 @@ bool Guild::ChangeMemberRank(ObjectGuid guid, uint8 newRank)
         if (Member* member = GetMember(guid))
         {
             member->ChangeRank(newRank);
+            _InvalidateRoster();
 
             if (newRank == GR_GUILDMASTER)
             {
@@ -2406,6 +2446,8 @@ void Guild::_CreateNewBankTab()
     for (auto& m_rank : m_ranks)
         m_rank.CreateMissingTabsIfNeeded(tabId, trans, false);
 
+    _InvalidateRoster();
+
     CharacterDatabase.CommitTransaction(trans);
 }
 
@@ -2435,6 +2477,7 @@ bool Guild::_CreateRank(std::string_view name, uint32 rights)
     // Ranks represent sequence 0, 1, 2, ... where 0 means guildmaster
     RankInfo info(m_id, newRankId, name, rights, 0);
     m_ranks.push_back(info);
+    _InvalidateRoster();
 
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
     info.CreateMissingTabsIfNeeded(_GetPurchasedTabsSize(), trans);
@@ -2500,6 +2543,7 @@ void Guild::_SetLeaderGUID(Member& pLeader)
 {
     m_leaderGuid = pLeader.GetGUID();
     pLeader.ChangeRank(GR_GUILDMASTER);
+    _InvalidateRoster();
 
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_LEADER);
     stmt->SetData(0, m_leaderGuid.GetCounter());
@@ -2510,7 +2554,10 @@ void Guild::_SetLeaderGUID(Member& pLeader)
 void Guild::_SetRankBankMoneyPerDay(uint8 rankId, uint32 moneyPerDay)
 {
     if (RankInfo* rankInfo = GetRankInfo(rankId))
+    {
         rankInfo->SetBankMoneyPerDay(moneyPerDay);
+        _InvalidateRoster();
+    }
 }
 
 void Guild::_SetRankBankTabRightsAndSlots(uint8 rankId, GuildBankRightsAndSlots rightsAndSlots, bool saveToDB)
@@ -2519,7 +2566,10 @@ void Guild::_SetRankBankTabRightsAndSlots(uint8 rankId, GuildBankRightsAndSlots
         return;
 
     if (RankInfo* rankInfo = GetRankInfo(rankId))
+    {
         rankInfo->SetBankTabSlotsAndRights(rightsAndSlots, saveToDB);
+        _InvalidateRoster();
+    }
 }
 
 inline std::string Guild::_GetRankName(uint8 rankId) const
@@ -2610,6 +2660,14 @@ inline bool Guild::_MemberHasTabRights(ObjectGuid guid, uint8 tabId, uint32 righ
     return false;
 }
 
+void Guild::SaveLogsToDB(CharacterDatabaseTransaction trans)
+{
+    m_eventLog.SaveToDB(trans);
+
+    for (LogHolder<BankEventLogEntry>& bankLog : m_bankEventLog)
+        bankLog.SaveToDB(trans);
+}
+
 // Add new event log record
 inline void Guild::_LogEvent(GuildEventLogTypes eventType, ObjectGuid playerGuid1, ObjectGuid playerGuid2, uint8 newRank)
 {
@@ -22,6 +22,7 @@
 #include "ObjectMgr.h"
 #include "Optional.h"
 #include "Player.h"
+#include <boost/circular_buffer.hpp>
 #include <set>
 #include <unordered_map>
 
@@ -491,18 +492,21 @@ private:
         // Adds event from DB to collection
         template <typename... Ts>
         void LoadEvent(Ts&&... args);
-        // Adds new event to collection and saves it to DB
+        // Adds new event to collection, saved to DB at once or by the next SaveToDB (Guild.LogSaveInterval)
         template <typename... Ts>
         void AddEvent(CharacterDatabaseTransaction trans, Ts&&... args);
+        // Saves the events added since the last call, oldest first
+        void SaveToDB(CharacterDatabaseTransaction trans);
         uint32 GetNextGUID();
-        std::list<Entry>& GetGuildLog() { return m_log; }
-        std::list<Entry> const& GetGuildLog() const { return m_log; }
+        boost::circular_buffer<Entry>& GetGuildLog() { return m_log; }
+        boost::circular_buffer<Entry> const& GetGuildLog() const { return m_log; }
 
     private:
         uint32 m_guildId;
-        std::list<Entry> m_log;
         uint32 const m_maxRecords;
+        boost::circular_buffer<Entry> m_log;            // the newest entry overwrites the oldest one once full
         uint32 m_nextGUID;
+        uint32 m_unsavedCount;                          // newest entries of m_log not saved to DB yet
     };
 
     // Class encapsulating guild rank data
@@ -740,6 +744,9 @@ public:
     bool LoadBankItemFromDB(Field* fields);
     bool Validate();
 
+    // Saves the event and bank logs written since the last call
+    void SaveLogsToDB(CharacterDatabaseTransaction trans);
+
     // Broadcasts
     void BroadcastToGuild(WorldSession* session, bool officerOnly, std::string_view msg, uint32 language = LANG_UNIVERSAL) const;
     void BroadcastPacketToRank(WorldPacket const* packet, uint8 rankId) const;
@@ -799,6 +806,10 @@ protected:
     LogHolder<EventLogEntry> m_eventLog;
     std::array<LogHolder<BankEventLogEntry>, GUILD_BANK_MAX_TABS + 1> m_bankEventLog = {};
 
+    // SMSG_GUILD_ROSTER without and with the officer notes, shared by the roster requests until the guild changes
+    std::array<SharedWorldPacket, 2> m_rosterCache;
+    std::array<Seconds, 2> m_rosterCacheExpiry = {};
+
 private:
     inline uint8 _GetRanksSize() const { return uint8(m_ranks.size()); }
     inline const RankInfo* GetRankInfo(uint8 rankId) const { return rankId < _GetRanksSize() ? &m_ranks[rankId] : nullptr; }
@@ -836,6 +847,8 @@ private:
     void _DeleteBankItems(CharacterDatabaseTransaction trans, bool removeItemsFromDB = false);
     bool _ModifyBankMoney(CharacterDatabaseTransaction trans, uint64 amount, bool add);
     void _SetLeaderGUID(Member& pLeader);
+    // Drops the cached rosters, called on every change of the members, ranks and guild texts they show
+    void _InvalidateRoster() { m_rosterCache = {}; }
 
     void _SetRankBankMoneyPerDay(uint8 rankId, uint32 moneyPerDay);
     void _SetRankBankTabRightsAndSlots(uint8 rankId, GuildBankRightsAndSlots rightsAndSlots, bool saveToDB = true);
@@ -412,3 +412,15 @@ void GuildMgr::ResetTimes()
 
     CharacterDatabase.DirectExecute("TRUNCATE guild_member_withdraw");
 }
+
+void GuildMgr::SaveGuildLogs()
+{
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+
+    for (GuildContainer::const_iterator itr = GuildStore.begin(); itr != GuildStore.end(); ++itr)
+        if (Guild* guild = itr->second)
+            guild->SaveLogsToDB(trans);
+
+    if (trans->GetSize())
+        CharacterDatabase.CommitTransaction(trans);
+}
@@ -66,7 +66,7 @@ bool AddonHandler::BuildAddonPacket(WorldPacket* Source, WorldPacket* Target)
 
         for (uint32 i = 0; i < addonsCount; ++i)
         {
-            std::string addonName;
+            std::string_view addonName;
             uint8 enabled;
             uint32 crc, unk2;
 
@@ -74,7 +74,7 @@ bool AddonHandler::BuildAddonPacket(WorldPacket* Source, WorldPacket* Target)
             if (AddOnPacked.rpos() + 1 > AddOnPacked.size())
                 return false;
 
-            AddOnPacked >> addonName;
+            addonName = AddOnPacked.ReadCStringView();
 
             // recheck next addon data format correctness
             if (AddOnPacked.rpos() + 1 + 4 + 4 > AddOnPacked.size())
@@ -130,10 +130,6 @@ bool LoginQueryHolder::Initialize()
     stmt->SetData(1, uint32(GameTime::GetGameTime().count()));
     res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_MAILS, stmt);
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_MAILITEMS);
-    stmt->SetData(0, lowGuid);
-    res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_MAIL_ITEMS, stmt);
-
     stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_SOCIALLIST);
     stmt->SetData(0, lowGuid);
     res &= SetPreparedQuery(PLAYER_LOGIN_QUERY_LOAD_SOCIAL_LIST, stmt);
@@ -377,232 +373,216 @@ void WorldSession::HandleCharCreateOpcode(WorldPacket& recvData)
         return;
     }
 
+    AddQueryTask(CreateCharacter(std::move(createInfo)));
+}
+
+QueryTask WorldSession::CreateCharacter(std::shared_ptr<CharacterCreateInfo> createInfo)
+{
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHECK_NAME);
     stmt->SetData(0, createInfo->Name);
+    if (co_await CharacterDatabase.AwaitQuery(stmt))
+    {
+        SendCharCreate(CHAR_CREATE_NAME_IN_USE);
+        co_return;
+    }
 
-    _queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt)
-    .WithChainingPreparedCallback([this](QueryCallback& queryCallback, PreparedQueryResult result)
+    LoginDatabasePreparedStatement* loginStmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_SUM_REALM_CHARACTERS);
+    loginStmt->SetData(0, GetAccountId());
+
+    uint64 acctCharCount = 0;
+    if (PreparedQueryResult result = co_await LoginDatabase.AwaitQuery(loginStmt))
     {
-        if (result)
-        {
-            SendCharCreate(CHAR_CREATE_NAME_IN_USE);
-            return;
-        }
+        Field* fields = result->Fetch();
+        acctCharCount = uint64(fields[0].Get<double>());
+    }
 
-        LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_SUM_REALM_CHARACTERS);
-        stmt->SetData(0, GetAccountId());
-        queryCallback.SetNextQuery(LoginDatabase.AsyncQuery(stmt));
-    })
-    .WithChainingPreparedCallback([this](QueryCallback& queryCallback, PreparedQueryResult result)
+    if (acctCharCount >= static_cast<uint64>(sWorld->getIntConfig(CONFIG_CHARACTERS_PER_ACCOUNT)))
     {
-        uint64 acctCharCount = 0;
-        if (result)
-        {
-            Field* fields = result->Fetch();
-            acctCharCount = uint64(fields[0].Get<double>());
-        }
+        SendCharCreate(CHAR_CREATE_ACCOUNT_LIMIT);
+        co_return;
+    }
 
-        if (acctCharCount >= static_cast<uint64>(sWorld->getIntConfig(CONFIG_CHARACTERS_PER_ACCOUNT)))
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_SUM_CHARS);
+    stmt->SetData(0, GetAccountId());
+    if (PreparedQueryResult result = co_await CharacterDatabase.AwaitQuery(stmt))
+    {
+        Field* fields = result->Fetch();
+        createInfo->CharCount = uint8(fields[0].Get<uint64>()); // SQL's COUNT() returns uint64 but it will always be less than uint8.Max
+
+        if (createInfo->CharCount >= sWorld->getIntConfig(CONFIG_CHARACTERS_PER_REALM))
         {
-            SendCharCreate(CHAR_CREATE_ACCOUNT_LIMIT);
-            return;
+            SendCharCreate(CHAR_CREATE_SERVER_LIMIT);
+            co_return;
         }
+    }
 
-        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_SUM_CHARS);
+    bool allowTwoSideAccounts = !sWorld->IsPvPRealm() || sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_ACCOUNTS) || !AccountMgr::IsPlayerAccount(GetSecurity());
+    uint32 skipCinematics = sWorld->getIntConfig(CONFIG_SKIP_CINEMATICS);
+
+    PreparedQueryResult result;
+    if (!allowTwoSideAccounts || skipCinematics || createInfo->Class == CLASS_DEATH_KNIGHT)
+    {
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHAR_CREATE_INFO);
         stmt->SetData(0, GetAccountId());
-        queryCallback.SetNextQuery(CharacterDatabase.AsyncQuery(stmt));
-    })
-    .WithChainingPreparedCallback([this, createInfo](QueryCallback& queryCallback, PreparedQueryResult result)
+        stmt->SetData(1, (skipCinematics == 1 || createInfo->Class == CLASS_DEATH_KNIGHT) ? 10 : 1);
+        result = co_await CharacterDatabase.AwaitQuery(stmt);
+    }
+
+    if (!sScriptMgr->CanAccountCreateCharacter(GetAccountId(), createInfo->Race, createInfo->Class))
     {
-        if (result)
+        SendCharCreate(CHAR_CREATE_DISABLED);
+        co_return;
+    }
+    bool haveSameRace = false;
+    uint32 heroicReqLevel = sWorld->getIntConfig(CONFIG_CHARACTER_CREATING_MIN_LEVEL_FOR_HEROIC_CHARACTER);
+    bool hasHeroicReqLevel = (heroicReqLevel == 0);
+    bool checkDeathKnightReqs = AccountMgr::IsPlayerAccount(GetSecurity()) && createInfo->Class == CLASS_DEATH_KNIGHT;
+
+    if (result)
+    {
+        TeamId teamId = Player::TeamIdForRace(createInfo->Race);
+        uint32 freeDeathKnightSlots = sWorld->getIntConfig(CONFIG_HEROIC_CHARACTERS_PER_REALM);
+
+        Field* field = result->Fetch();
+        uint8 accRace = field[1].Get<uint8>();
+
+        if (checkDeathKnightReqs)
         {
-            Field* fields = result->Fetch();
-            createInfo->CharCount = uint8(fields[0].Get<uint64>()); // SQL's COUNT() returns uint64 but it will always be less than uint8.Max
+            uint8 accClass = field[2].Get<uint8>();
+            if (accClass == CLASS_DEATH_KNIGHT)
+            {
+                if (freeDeathKnightSlots > 0)
+                    --freeDeathKnightSlots;
 
-            if (createInfo->CharCount >= sWorld->getIntConfig(CONFIG_CHARACTERS_PER_REALM))
+                if (freeDeathKnightSlots == 0)
+                {
+                    SendCharCreate(CHAR_CREATE_UNIQUE_CLASS_LIMIT);
+                    co_return;
+                }
+            }
+
+            if (!hasHeroicReqLevel)
             {
-                SendCharCreate(CHAR_CREATE_SERVER_LIMIT);
-                return;
+                uint8 accLevel = field[0].Get<uint8>();
+                if (accLevel >= heroicReqLevel)
+                    hasHeroicReqLevel = true;
             }
         }
 
-        bool allowTwoSideAccounts = !sWorld->IsPvPRealm() || sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_ACCOUNTS) || !AccountMgr::IsPlayerAccount(GetSecurity());
-        uint32 skipCinematics = sWorld->getIntConfig(CONFIG_SKIP_CINEMATICS);
-
-        std::function<void(PreparedQueryResult)> finalizeCharacterCreation = [this, createInfo](PreparedQueryResult result)
+        // need to check team only for first character
+        /// @todo what to if account already has characters of both races?
+        if (!allowTwoSideAccounts)
         {
-            if (!sScriptMgr->CanAccountCreateCharacter(GetAccountId(), createInfo->Race, createInfo->Class))
+            uint32 accTeam = 0;
+            if (accRace > 0)
+                accTeam = Player::TeamIdForRace(accRace);
+
+            if (accTeam != teamId)
             {
-                SendCharCreate(CHAR_CREATE_DISABLED);
-                return;
+                SendCharCreate(CHAR_CREATE_PVP_TEAMS_VIOLATION);
+                co_return;
             }
-            bool haveSameRace = false;
-            uint32 heroicReqLevel = sWorld->getIntConfig(CONFIG_CHARACTER_CREATING_MIN_LEVEL_FOR_HEROIC_CHARACTER);
-            bool hasHeroicReqLevel = (heroicReqLevel == 0);
-            bool allowTwoSideAccounts = !sWorld->IsPvPRealm() || sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_ACCOUNTS) || !AccountMgr::IsPlayerAccount(GetSecurity());
-            uint32 skipCinematics = sWorld->getIntConfig(CONFIG_SKIP_CINEMATICS);
-            bool checkDeathKnightReqs = AccountMgr::IsPlayerAccount(GetSecurity()) && createInfo->Class == CLASS_DEATH_KNIGHT;
-
-            if (result)
-            {
-                TeamId teamId = Player::TeamIdForRace(createInfo->Race);
-                uint32 freeDeathKnightSlots = sWorld->getIntConfig(CONFIG_HEROIC_CHARACTERS_PER_REALM);
-
-                Field* field = result->Fetch();
-                uint8 accRace = field[1].Get<uint8>();
+        }
 
-                if (checkDeathKnightReqs)
-                {
-                    uint8 accClass = field[2].Get<uint8>();
-                    if (accClass == CLASS_DEATH_KNIGHT)
-                    {
-                        if (freeDeathKnightSlots > 0)
-                            --freeDeathKnightSlots;
+        // search same race for cinematic or same class if need
+        /// @todo check if cinematic already shown? (already logged in?; cinematic field)
+        while ((skipCinematics == 1 && !haveSameRace) || createInfo->Class == CLASS_DEATH_KNIGHT)
+        {
+            if (!result->NextRow())
+                break;
 
-                        if (freeDeathKnightSlots == 0)
-                        {
-                            SendCharCreate(CHAR_CREATE_UNIQUE_CLASS_LIMIT);
-                            return;
-                        }
-                    }
+            field = result->Fetch();
+            accRace = field[1].Get<uint8>();
 
-                    if (!hasHeroicReqLevel)
-                    {
-                        uint8 accLevel = field[0].Get<uint8>();
-                        if (accLevel >= heroicReqLevel)
-                            hasHeroicReqLevel = true;
-                    }
-                }
+            if (!haveSameRace)
+                haveSameRace = createInfo->Race == accRace;
 
-                // need to check team only for first character
-                /// @todo what to if account already has characters of both races?
-                if (!allowTwoSideAccounts)
+            if (checkDeathKnightReqs)
+            {
+                uint8 acc_class = field[2].Get<uint8>();
+                if (acc_class == CLASS_DEATH_KNIGHT)
                 {
-                    uint32 accTeam = 0;
-                    if (accRace > 0)
-                        accTeam = Player::TeamIdForRace(accRace);
+                    if (freeDeathKnightSlots > 0)
+                        --freeDeathKnightSlots;
 
-                    if (accTeam != teamId)
+                    if (freeDeathKnightSlots == 0)
                     {
-                        SendCharCreate(CHAR_CREATE_PVP_TEAMS_VIOLATION);
-                        return;
+                        SendCharCreate(CHAR_CREATE_UNIQUE_CLASS_LIMIT);
+                        co_return;
                     }
                 }
 
-                // search same race for cinematic or same class if need
-                /// @todo check if cinematic already shown? (already logged in?; cinematic field)
-                while ((skipCinematics == 1 && !haveSameRace) || createInfo->Class == CLASS_DEATH_KNIGHT)
+                if (!hasHeroicReqLevel)
                 {
-                    if (!result->NextRow())
-                        break;
-
-                    field = result->Fetch();
-                    accRace = field[1].Get<uint8>();
-
-                    if (!haveSameRace)
-                        haveSameRace = createInfo->Race == accRace;
-
-                    if (checkDeathKnightReqs)
-                    {
-                        uint8 acc_class = field[2].Get<uint8>();
-                        if (acc_class == CLASS_DEATH_KNIGHT)
-                        {
-                            if (freeDeathKnightSlots > 0)
-                                --freeDeathKnightSlots;
-
-                            if (freeDeathKnightSlots == 0)
-                            {
-                                SendCharCreate(CHAR_CREATE_UNIQUE_CLASS_LIMIT);
-                                return;
-                            }
-                        }
-
-                        if (!hasHeroicReqLevel)
-                        {
-                            uint8 acc_level = field[0].Get<uint8>();
-                            if (acc_level >= heroicReqLevel)
-                                hasHeroicReqLevel = true;
-                        }
-                    }
+                    uint8 acc_level = field[0].Get<uint8>();
+                    if (acc_level >= heroicReqLevel)
+                        hasHeroicReqLevel = true;
                 }
             }
+        }
+    }
 
-            if (checkDeathKnightReqs && !hasHeroicReqLevel)
-            {
-                SendCharCreate(CHAR_CREATE_LEVEL_REQUIREMENT);
-                return;
-            }
-
-            // Check name uniqueness in the same step as saving to database
-            if (sCharacterCache->GetCharacterGuidByName(createInfo->Name))
-            {
-                SendCharCreate(CHAR_CREATE_NAME_IN_USE);
-                return;
-            }
+    if (checkDeathKnightReqs && !hasHeroicReqLevel)
+    {
+        SendCharCreate(CHAR_CREATE_LEVEL_REQUIREMENT);
+        co_return;
+    }
 
-            std::shared_ptr<Player> newChar(new Player(this), [](Player* ptr)
-            {
-                // Only when player is created correctly do clean
-                if (ptr->HasAtLoginFlag(AT_LOGIN_FIRST))
-                {
-                    ptr->CleanupsBeforeDelete();
-                }
-                delete ptr;
-            });
+    // Check name uniqueness in the same step as saving to database
+    if (sCharacterCache->GetCharacterGuidByName(createInfo->Name))
+    {
+        SendCharCreate(CHAR_CREATE_NAME_IN_USE);
+        co_return;
+    }
 
-            newChar->GetMotionMaster()->Initialize();
-            if (!newChar->Create(sObjectMgr->GetGenerator<HighGuid::Player>().Generate(), createInfo.get()))
-            {
-                // Player not create (race/class/etc problem?)
-                SendCharCreate(CHAR_CREATE_ERROR);
-                return;
-            }
+    std::shared_ptr<Player> newChar(new Player(this), [](Player* ptr)
+    {
+        // Only when player is created correctly do clean
+        if (ptr->HasAtLoginFlag(AT_LOGIN_FIRST))
+        {
+            ptr->CleanupsBeforeDelete();
+        }
+        delete ptr;
+    });
 
-            if ((haveSameRace && skipCinematics == 1) || skipCinematics == 2)
-                newChar->setCinematic(1);                         // not show intro
+    newChar->GetMotionMaster()->Initialize();
+    if (!newChar->Create(sObjectMgr->GetGenerator<HighGuid::Player>().Generate(), createInfo.get()))
+    {
+        // Player not create (race/class/etc problem?)
+        SendCharCreate(CHAR_CREATE_ERROR);
+        co_return;
+    }
 
-            newChar->SetAtLoginFlag(AT_LOGIN_FIRST);              // First login
+    if ((haveSameRace && skipCinematics == 1) || skipCinematics == 2)
+        newChar->setCinematic(1);                         // not show intro
 
-            CharacterDatabaseTransaction characterTransaction = CharacterDatabase.BeginTransaction();
-            LoginDatabaseTransaction trans = LoginDatabase.BeginTransaction();
+    newChar->SetAtLoginFlag(AT_LOGIN_FIRST);              // First login
 
-            // Player created, save it now
-            newChar->SaveToDB(characterTransaction, true, false);
-            createInfo->CharCount++;
+    CharacterDatabaseTransaction characterTransaction = CharacterDatabase.BeginTransaction();
+    LoginDatabaseTransaction trans = LoginDatabase.BeginTransaction();
 
-            LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_REP_REALM_CHARACTERS);
-            stmt->SetData(0, createInfo->CharCount);
-            stmt->SetData(1, GetAccountId());
-            stmt->SetData(2, realm.Id.Realm);
-            trans->Append(stmt);
+    // Player created, save it now
+    newChar->SaveToDB(characterTransaction, true, false);
+    createInfo->CharCount++;
 
-            LoginDatabase.CommitTransaction(trans);
+    loginStmt = LoginDatabase.GetPreparedStatement(LOGIN_REP_REALM_CHARACTERS);
+    loginStmt->SetData(0, createInfo->CharCount);
+    loginStmt->SetData(1, GetAccountId());
+    loginStmt->SetData(2, realm.Id.Realm);
+    trans->Append(loginStmt);
 
-            AddTransactionCallback(CharacterDatabase.AsyncCommitTransaction(characterTransaction)).AfterComplete([this, newChar = std::move(newChar)](bool success)
-            {
-                if (success)
-                {
-                    LOG_INFO("entities.player.character", "Account: {} (IP: {}) Create Character: {} {}", GetAccountId(), GetRemoteAddress(), newChar->GetName(), newChar->GetGUID().ToString());
-                    sScriptMgr->OnPlayerCreate(newChar.get());
-                    sCharacterCache->AddCharacterCacheEntry(newChar->GetGUID(), GetAccountId(), newChar->GetName(), newChar->getGender(), newChar->getRace(), newChar->getClass(), newChar->GetLevel());
-                    SendCharCreate(CHAR_CREATE_SUCCESS);
-                }
-                else
-                    SendCharCreate(CHAR_CREATE_ERROR);
-            });
-        };
+    LoginDatabase.CommitTransaction(trans);
 
-        if (allowTwoSideAccounts && !skipCinematics && createInfo->Class != CLASS_DEATH_KNIGHT)
-        {
-            finalizeCharacterCreation(PreparedQueryResult(nullptr));
-            return;
-        }
+    if (!co_await CharacterDatabase.AwaitCommitTransaction(characterTransaction))
+    {
+        SendCharCreate(CHAR_CREATE_ERROR);
+        co_return;
+    }
 
-        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHAR_CREATE_INFO);
-        stmt->SetData(0, GetAccountId());
-        stmt->SetData(1, (skipCinematics == 1 || createInfo->Class == CLASS_DEATH_KNIGHT) ? 10 : 1);
-        queryCallback.WithPreparedCallback(std::move(finalizeCharacterCreation)).SetNextQuery(CharacterDatabase.AsyncQuery(stmt));
-    }));
+    LOG_INFO("entities.player.character", "Account: {} (IP: {}) Create Character: {} {}", GetAccountId(), GetRemoteAddress(), newChar->GetName(), newChar->GetGUID().ToString());
+    sScriptMgr->OnPlayerCreate(newChar.get());
+    sCharacterCache->AddCharacterCacheEntry(newChar->GetGUID(), GetAccountId(), newChar->GetName(), newChar->getGender(), newChar->getRace(), newChar->getClass(), newChar->GetLevel());
+    SendCharCreate(CHAR_CREATE_SUCCESS);
 }
 
 void WorldSession::HandleCharDeleteOpcode(WorldPacket& recvData)
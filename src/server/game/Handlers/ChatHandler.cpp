@@ -235,7 +235,9 @@ void WorldSession::HandleMessagechatOpcode(WorldPacket& recvData)
             sender->UpdateSpeakTime(lang == LANG_ADDON ? Player::ChatFloodThrottle::ADDON : Player::ChatFloodThrottle::REGULAR);
     }
 
-    std::string to, channel, msg;
+    // the message is only copied out of the packet once the cheap checks passed
+    std::string to, channel;
+    std::string_view msgView;
     bool ignoreChecks = false;
     switch (type)
     {
@@ -251,38 +253,40 @@ void WorldSession::HandleMessagechatOpcode(WorldPacket& recvData)
         case CHAT_MSG_RAID_WARNING:
         case CHAT_MSG_BATTLEGROUND:
         case CHAT_MSG_BATTLEGROUND_LEADER:
-            msg = recvData.ReadCString(lang != LANG_ADDON);
+            msgView = recvData.ReadCStringView(lang != LANG_ADDON);
             break;
         case CHAT_MSG_WHISPER:
             recvData >> to;
-            msg = recvData.ReadCString(lang != LANG_ADDON);
+            msgView = recvData.ReadCStringView(lang != LANG_ADDON);
             break;
         case CHAT_MSG_CHANNEL:
             recvData >> channel;
-            msg = recvData.ReadCString(lang != LANG_ADDON);
+            msgView = recvData.ReadCStringView(lang != LANG_ADDON);
             break;
         case CHAT_MSG_AFK:
         case CHAT_MSG_DND:
-            msg = recvData.ReadCString(lang != LANG_ADDON);
+            msgView = recvData.ReadCStringView(lang != LANG_ADDON);
             ignoreChecks = true;
             break;
     }
 
     // Our Warden module also uses SendAddonMessage as a way to communicate Lua check results to the server, see if this is that
-    if (type == CHAT_MSG_GUILD && lang == LANG_ADDON && _warden && _warden->ProcessLuaCheckResponse(msg))
+    if (type == CHAT_MSG_GUILD && lang == LANG_ADDON && _warden && _warden->ProcessLuaCheckResponse(std::string(msgView)))
     {
         return;
     }
 
     // pussywizard:
-    if (msg.length() > 255 || (lang != LANG_ADDON && msg.find("|0") != std::string::npos))
+    if (msgView.length() > 255 || (lang != LANG_ADDON && msgView.find("|0") != std::string_view::npos))
         return;
 
+    if (!ignoreChecks && msgView.empty())
+        return;
+
+    std::string msg(msgView);
+
     if (!ignoreChecks)
     {
-        if (msg.empty())
-            return;
-
         if (lang == LANG_ADDON)
         {
             if (AddonChannelCommandHandler(this).ParseCommands(msg.c_str()))
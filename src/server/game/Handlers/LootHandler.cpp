@@ -66,7 +66,7 @@ void WorldSession::HandleAutostoreLootItemOpcode(WorldPacket& recvData)
             return;
         }
 
-        loot = &pItem->loot;
+        loot = &pItem->GetLoot();
     }
     else if (lguid.IsCorpse())
     {
@@ -153,7 +153,7 @@ void WorldSession::HandleLootMoneyOpcode(WorldPacket& /*recvData*/)
             {
                 if (Item* item = player->GetItemByGuid(guid))
                 {
-                    loot = &item->loot;
+                    loot = &item->GetLoot();
                     shareMoney = false;
                 }
                 break;
@@ -355,14 +355,14 @@ void WorldSession::DoLootRelease(ObjectGuid lguid)
         if (!pItem)
             return;
 
-        loot = &pItem->loot;
+        loot = &pItem->GetLoot();
         ItemTemplate const* proto = pItem->GetTemplate();
 
         // destroy only 5 items from stack in case prospecting and milling
         if (proto->Flags & (ITEM_FLAG_IS_PROSPECTABLE | ITEM_FLAG_IS_MILLABLE))
         {
             pItem->m_lootGenerated = false;
-            pItem->loot.clear();
+            pItem->GetLoot().clear();
 
             uint32 count = pItem->GetCount();
 
@@ -372,7 +372,7 @@ void WorldSession::DoLootRelease(ObjectGuid lguid)
 
             player->DestroyItemCount(pItem, count, true);
         }
-        else if (pItem->loot.isLooted() || !proto->HasFlag(ITEM_FLAG_HAS_LOOT))
+        else if (pItem->GetLoot().isLooted() || !proto->HasFlag(ITEM_FLAG_HAS_LOOT))
         {
             player->DestroyItem(pItem->GetBagSlot(), pItem->GetSlot(), true);
             return;
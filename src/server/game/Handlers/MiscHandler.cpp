@@ -285,8 +285,10 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
     data << uint32(matchCount);         // placeholder, count of players matching criteria
     data << uint32(displaycount);       // placeholder, count of players displayed
 
-    for (auto const& target : sWhoListCacheMgr->GetWhoList())
+    for (WhoListPlayerInfo const* info : sWhoListCacheMgr->GetCandidates(levelMin, levelMax, racemask, classmask, zoneids.data(), zonesCount, wpacketPlayerName, wpacketGuildName))
     {
+        WhoListPlayerInfo const& target = *info;
+
         if (AccountMgr::IsPlayerAccount(security))
         {
             // player can see member of other team only if CONFIG_ALLOW_TWO_SIDE_WHO_LIST
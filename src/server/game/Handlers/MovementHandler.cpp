@@ -24,6 +24,7 @@
 #include "Corpse.h"
 #include "GameGraveyard.h"
 #include "GameTime.h"
+#include "GridNotifiers.h"
 #include "InstanceSaveMgr.h"
 #include "Log.h"
 #include "MapMgr.h"
@@ -37,6 +38,7 @@
 #include "Transport.h"
 #include "Vehicle.h"
 #include "WaypointMovementGenerator.h"
+#include "World.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
 
@@ -392,7 +394,30 @@ void WorldSession::HandleMovementOpcodes(WorldPacket& recvData)
     /* process position-change */
     WorldPacket data(opcode, recvData.size());
     WriteMovementInfo(&data, &movementInfo);
-    mover->SendMessageToSet(&data, _player);
+
+    MovementRelay* relay = mover->GetMap()->GetMovementRelay();
+
+    // in crowds the less interested players get only part of the heartbeats, other movement packets always go to everyone
+    if (opcode == MSG_MOVE_HEARTBEAT && plrMover == _player && IsCrowdHeartbeat(plrMover))
+    {
+        Acore::CrowdHeartbeatDeliverer notifier(plrMover, &data, NextMovementHeartbeat(), relay);
+        notifier.Visit(plrMover->GetObjectVisibilityContainer().GetVisiblePlayersMap());
+        return;
+    }
+
+    if (relay)
+        relay->QueueToSet(mover, data, _player);
+    else
+        mover->SendMessageToSet(&data, _player);
+}
+
+bool WorldSession::IsCrowdHeartbeat(Player const* mover) const
+{
+    uint32 const minPlayers = sWorld->getIntConfig(CONFIG_CROWD_INTEREST_MIN_PLAYERS);
+    if (!minPlayers || !mover->GetMap()->IsCrowdInterestMap())
+        return false;
+
+    return mover->GetObjectVisibilityContainer().GetVisiblePlayersMap().size() >= minPlayers;
 }
 
 void WorldSession::SynchronizeMovement(MovementInfo& movementInfo)
@@ -95,62 +95,68 @@ void WorldSession::HandleCreatureQueryOpcode(WorldPacket& recvData)
     CreatureTemplate const* ci = sObjectMgr->GetCreatureTemplate(entry);
     if (ci)
     {
-        std::string Name, Title;
-        Name = ci->Name;
-        Title = ci->SubName;
-
         LocaleConstant loc_idx = GetSessionDbLocaleIndex();
-        if (loc_idx >= 0)
+        QueryResponse response = sObjectMgr->GetQueryResponse(QUERY_RESPONSE_CREATURE, entry, loc_idx, [&]()
         {
-            if (CreatureLocale const* cl = sObjectMgr->GetCreatureLocale(entry))
+            std::string Name, Title;
+            Name = ci->Name;
+            Title = ci->SubName;
+
+            if (loc_idx >= 0)
             {
-                ObjectMgr::GetLocaleString(cl->Name, loc_idx, Name);
-                ObjectMgr::GetLocaleString(cl->Title, loc_idx, Title);
+                if (CreatureLocale const* cl = sObjectMgr->GetCreatureLocale(entry))
+                {
+                    ObjectMgr::GetLocaleString(cl->Name, loc_idx, Name);
+                    ObjectMgr::GetLocaleString(cl->Title, loc_idx, Title);
+                }
             }
-        }
-        // guess size
-        WorldPacket data(SMSG_CREATURE_QUERY_RESPONSE, 100);
-        data << uint32(entry);                                       // creature entry
-        data << Name;
-        data << uint8(0) << uint8(0) << uint8(0);                    // name2, name3, name4, always empty
-        data << Title;
-        data << ci->IconName;                                        // "Directions" for guard, string for Icons 2.3.0
-        data << uint32(ci->type_flags);                              // flags
-        data << uint32(ci->type);                                    // CreatureType.dbc
-        data << uint32(ci->family);                                  // CreatureFamily.dbc
-        data << uint32(ci->rank);                                    // Creature Rank (elite, boss, etc)
-        data << uint32(ci->KillCredit[0]);                           // new in 3.1, kill credit
-        data << uint32(ci->KillCredit[1]);                           // new in 3.1, kill credit
-        if (ci->GetModelByIdx(0))
-            data << uint32(ci->GetModelByIdx(0)->CreatureDisplayID); // Modelid1
-        else
-            data << uint32(0);                                       // Modelid1
-        if (ci->GetModelByIdx(1))
-            data << uint32(ci->GetModelByIdx(1)->CreatureDisplayID); // Modelid2
-        else
-            data << uint32(0);                                       // Modelid2
-        if (ci->GetModelByIdx(2))
-            data << uint32(ci->GetModelByIdx(2)->CreatureDisplayID); // Modelid3
-        else
-            data << uint32(0);                                       // Modelid3
-        if (ci->GetModelByIdx(3))
-            data << uint32(ci->GetModelByIdx(3)->CreatureDisplayID); // Modelid4
-        else
-            data << uint32(0);                                       // Modelid4
-        data << float(ci->ModHealth);                                // dmg/hp modifier
-        data << float(ci->ModMana);                                  // dmg/mana modifier
-        data << uint8(ci->RacialLeader);
-
-        CreatureQuestItemList const* items = sObjectMgr->GetCreatureQuestItemList(entry);
-        if (items)
-            for (std::size_t i = 0; i < MAX_CREATURE_QUEST_ITEMS; ++i)
-                data << (i < items->size() ? uint32((*items)[i]) : uint32(0));
-        else
-            for (std::size_t i = 0; i < MAX_CREATURE_QUEST_ITEMS; ++i)
-                data << uint32(0);
 
-        data << uint32(ci->movementId);                              // CreatureMovementInfo.dbc
-        SendPacket(&data);
+            // guess size
+            WorldPacket data(SMSG_CREATURE_QUERY_RESPONSE, 100);
+            data << uint32(entry);                                       // creature entry
+            data << Name;
+            data << uint8(0) << uint8(0) << uint8(0);                    // name2, name3, name4, always empty
+            data << Title;
+            data << ci->IconName;                                        // "Directions" for guard, string for Icons 2.3.0
+            data << uint32(ci->type_flags);                              // flags
+            data << uint32(ci->type);                                    // CreatureType.dbc
+            data << uint32(ci->family);                                  // CreatureFamily.dbc
+            data << uint32(ci->rank);                                    // Creature Rank (elite, boss, etc)
+            data << uint32(ci->KillCredit[0]);                           // new in 3.1, kill credit
+            data << uint32(ci->KillCredit[1]);                           // new in 3.1, kill credit
+            if (ci->GetModelByIdx(0))
+                data << uint32(ci->GetModelByIdx(0)->CreatureDisplayID); // Modelid1
+            else
+                data << uint32(0);                                       // Modelid1
+            if (ci->GetModelByIdx(1))
+                data << uint32(ci->GetModelByIdx(1)->CreatureDisplayID); // Modelid2
+            else
+                data << uint32(0);                                       // Modelid2
+            if (ci->GetModelByIdx(2))
+                data << uint32(ci->GetModelByIdx(2)->CreatureDisplayID); // Modelid3
+            else
+                data << uint32(0);                                       // Modelid3
+            if (ci->GetModelByIdx(3))
+                data << uint32(ci->GetModelByIdx(3)->CreatureDisplayID); // Modelid4
+            else
+                data << uint32(0);                                       // Modelid4
+            data << float(ci->ModHealth);                                // dmg/hp modifier
+            data << float(ci->ModMana);                                  // dmg/mana modifier
+            data << uint8(ci->RacialLeader);
+
+            CreatureQuestItemList const* items = sObjectMgr->GetCreatureQuestItemList(entry);
+            if (items)
+                for (std::size_t i = 0; i < MAX_CREATURE_QUEST_ITEMS; ++i)
+                    data << (i < items->size() ? uint32((*items)[i]) : uint32(0));
+            else
+                for (std::size_t i = 0; i < MAX_CREATURE_QUEST_ITEMS; ++i)
+                    data << uint32(0);
+
+            data << uint32(ci->movementId);                              // CreatureMovementInfo.dbc
+            return data;
+        });
+
+        SendSharedPacket(response);
     }
     else
     {
@@ -173,44 +179,50 @@ void WorldSession::HandleGameObjectQueryOpcode(WorldPacket& recvData)
     const GameObjectTemplate* info = sObjectMgr->GetGameObjectTemplate(entry);
     if (info)
     {
-        std::string Name;
-        std::string IconName;
-        std::string CastBarCaption;
-
-        Name = info->name;
-        IconName = info->IconName;
-        CastBarCaption = info->castBarCaption;
+        LOG_DEBUG("network", "WORLD: CMSG_GAMEOBJECT_QUERY '{}' - Entry: {}. ", info->name, entry);
 
         LocaleConstant localeConstant = GetSessionDbLocaleIndex();
-        if (localeConstant >= LOCALE_enUS)
-            if (GameObjectLocale const* gameObjectLocale = sObjectMgr->GetGameObjectLocale(entry))
-            {
-                ObjectMgr::GetLocaleString(gameObjectLocale->Name, localeConstant, Name);
-                ObjectMgr::GetLocaleString(gameObjectLocale->CastBarCaption, localeConstant, CastBarCaption);
-            }
+        QueryResponse response = sObjectMgr->GetQueryResponse(QUERY_RESPONSE_GAMEOBJECT, entry, localeConstant, [&]()
+        {
+            std::string Name;
+            std::string IconName;
+            std::string CastBarCaption;
 
-        LOG_DEBUG("network", "WORLD: CMSG_GAMEOBJECT_QUERY '{}' - Entry: {}. ", info->name, entry);
-        WorldPacket data (SMSG_GAMEOBJECT_QUERY_RESPONSE, 150);
-        data << uint32(entry);
-        data << uint32(info->type);
-        data << uint32(info->displayId);
-        data << Name;
-        data << uint8(0) << uint8(0) << uint8(0);           // name2, name3, name4
-        data << IconName;                                   // 2.0.3, string. Icon name to use instead of default icon for go's (ex: "Attack" makes sword)
-        data << CastBarCaption;                             // 2.0.3, string. Text will appear in Cast Bar when using GO (ex: "Collecting")
-        data << info->unk1;                                 // 2.0.3, string
-        data.append(info->raw.data, MAX_GAMEOBJECT_DATA);
-        data << float(info->size);                          // go size
-
-        GameObjectQuestItemList const* items = sObjectMgr->GetGameObjectQuestItemList(entry);
-        if (items)
-            for (std::size_t i = 0; i < MAX_GAMEOBJECT_QUEST_ITEMS; ++i)
-                data << (i < items->size() ? uint32((*items)[i]) : uint32(0));
-        else
-            for (std::size_t i = 0; i < MAX_GAMEOBJECT_QUEST_ITEMS; ++i)
-                data << uint32(0);
+            Name = info->name;
+            IconName = info->IconName;
+            CastBarCaption = info->castBarCaption;
 
-        SendPacket(&data);
+            if (localeConstant >= LOCALE_enUS)
+                if (GameObjectLocale const* gameObjectLocale = sObjectMgr->GetGameObjectLocale(entry))
+                {
+                    ObjectMgr::GetLocaleString(gameObjectLocale->Name, localeConstant, Name);
+                    ObjectMgr::GetLocaleString(gameObjectLocale->CastBarCaption, localeConstant, CastBarCaption);
+                }
+
+            WorldPacket data (SMSG_GAMEOBJECT_QUERY_RESPONSE, 150);
+            data << uint32(entry);
+            data << uint32(info->type);
+            data << uint32(info->displayId);
+            data << Name;
+            data << uint8(0) << uint8(0) << uint8(0);           // name2, name3, name4
+            data << IconName;                                   // 2.0.3, string. Icon name to use instead of default icon for go's (ex: "Attack" makes sword)
+            data << CastBarCaption;                             // 2.0.3, string. Text will appear in Cast Bar when using GO (ex: "Collecting")
+            data << info->unk1;                                 // 2.0.3, string
+            data.append(info->raw.data, MAX_GAMEOBJECT_DATA);
+            data << float(info->size);                          // go size
+
+            GameObjectQuestItemList const* items = sObjectMgr->GetGameObjectQuestItemList(entry);
+            if (items)
+                for (std::size_t i = 0; i < MAX_GAMEOBJECT_QUEST_ITEMS; ++i)
+                    data << (i < items->size() ? uint32((*items)[i]) : uint32(0));
+            else
+                for (std::size_t i = 0; i < MAX_GAMEOBJECT_QUEST_ITEMS; ++i)
+                    data << uint32(0);
+
+            return data;
+        });
+
+        SendSharedPacket(response);
         LOG_DEBUG("network", "WORLD: Sent SMSG_GAMEOBJECT_QUERY_RESPONSE");
     }
     else
@@ -257,6 +257,16 @@ void InstanceSaveMgr::DeleteInstanceSavedData(uint32 instanceId)
     }
 }
 
+void InstanceSaveMgr::DeleteInstanceSavedData(uint32 instanceId, CharacterDatabaseTransaction trans)
+{
+    if (instanceId)
+    {
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DELETE_INSTANCE_SAVED_DATA);
+        stmt->SetData(0, instanceId);
+        trans->Append(stmt);
+    }
+}
+
 void InstanceSaveMgr::LoadInstances()
 {
     uint32 oldMSTime = getMSTime();
@@ -494,19 +504,35 @@ void InstanceSaveMgr::Update()
     if (resetOccurred)
     {
         LOG_INFO("instance.save", "Instance ID reset occurred, sending updated calendar and raid info to all players!");
-        WorldPacket dummy;
 
+        m_resetNotificationQueue.clear();
         WorldSessionMgr::SessionMap const& sessionMap = sWorldSessionMgr->GetAllSessions();
         for (WorldSessionMgr::SessionMap::const_iterator itr = sessionMap.begin(); itr != sessionMap.end(); ++itr)
             if (Player* plr = itr->second->GetPlayer())
-            {
-                itr->second->HandleCalendarGetCalendar(dummy);
-                plr->SendRaidInfo();
-            }
+                m_resetNotificationQueue.push_back(plr->GetGUID());
     }
+
+    _SendResetNotifications();
 }
 
-void InstanceSaveMgr::_ResetSave(InstanceSaveHashMap::iterator& itr)
+void InstanceSaveMgr::_SendResetNotifications()
+{
+    WorldPacket dummy;
+
+    // players which logged out meanwhile are skipped, they get the new lockouts at login
+    for (std::size_t count = 0; count < ResetNotificationsPerUpdate && !m_resetNotificationQueue.empty(); ++count)
+    {
+        if (Player* plr = ObjectAccessor::FindConnectedPlayer(m_resetNotificationQueue.front()))
+        {
+            plr->GetSession()->HandleCalendarGetCalendar(dummy);
+            plr->SendRaidInfo();
+        }
+
+        m_resetNotificationQueue.pop_front();
+    }
+}
+
+void InstanceSaveMgr::_ResetSave(InstanceSaveHashMap::iterator& itr, CharacterDatabaseTransaction trans)
 {
     lock_instLists = true;
 
@@ -523,15 +549,15 @@ void InstanceSaveMgr::_ResetSave(InstanceSaveHashMap::iterator& itr)
         // delete character_instance per id, delete instance per id
         CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_INSTANCE_BY_INSTANCE);
         stmt->SetData(0, itr->second->GetInstanceId());
-        CharacterDatabase.Execute(stmt);
+        trans->Append(stmt);
         stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_INSTANCE_BY_INSTANCE);
         stmt->SetData(0, itr->second->GetInstanceId());
-        CharacterDatabase.Execute(stmt);
-        DeleteInstanceSavedData(itr->second->GetInstanceId());
+        trans->Append(stmt);
+        DeleteInstanceSavedData(itr->second->GetInstanceId(), trans);
 
         // clear respawn times if the map is already unloaded and won't do it by itself
         if (!sMapMgr->FindMap(itr->second->GetMapId(), itr->second->GetInstanceId()))
-            Map::DeleteRespawnTimesInDB(itr->second->GetMapId(), itr->second->GetInstanceId());
+            Map::DeleteRespawnTimesInDB(itr->second->GetMapId(), itr->second->GetInstanceId(), trans);
 
         sScriptMgr->OnInstanceIdRemoved(itr->second->GetInstanceId());
 
@@ -540,15 +566,13 @@ void InstanceSaveMgr::_ResetSave(InstanceSaveHashMap::iterator& itr)
     }
     else
     {
-        // delete character_instance per id where extended = 0, transtaction with set extended = 0, transaction is used to avoid mysql thread races
-        CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+        // delete character_instance per id where extended = 0, in the same transaction as set extended = 0 to avoid mysql thread races
         CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_INSTANCE_BY_INSTANCE_NOT_EXTENDED);
         stmt->SetData(0, itr->second->GetInstanceId());
         trans->Append(stmt);
         stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_CHAR_INSTANCE_SET_NOT_EXTENDED);
         stmt->SetData(0, itr->second->GetInstanceId());
         trans->Append(stmt);
-        CharacterDatabase.CommitTransaction(trans);
 
         // update reset time and extended reset time for instance save
         itr->second->SetResetTime(GetResetTimeFor(itr->second->GetMapId(), itr->second->GetDifficulty()));
@@ -593,16 +617,20 @@ void InstanceSaveMgr::_ResetOrWarnAll(uint32 mapid, Difficulty difficulty, bool
         stmt->SetData(0, next_reset);
         stmt->SetData(1, uint16(mapid));
         stmt->SetData(2, uint8(difficulty));
-        CharacterDatabase.Execute(stmt);
 
         // remove all binds to instances of the given map and delete from db (delete per instance id, no mass deletion!)
-        // do this after new reset time is calculated
+        // do this after new reset time is calculated, the whole reset is committed as a single transaction
+        CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+        trans->Append(stmt);
+
         for (InstanceSaveHashMap::iterator itr = m_instanceSaveById.begin(), itr2; itr != m_instanceSaveById.end(); )
         {
             itr2 = itr++;
             if (itr2->second->GetMapId() == mapid && itr2->second->GetDifficulty() == difficulty)
-                _ResetSave(itr2);
+                _ResetSave(itr2, trans);
         }
+
+        CharacterDatabase.CommitTransaction(trans);
     }
 
     // now loop all existing maps to warn / reset
@@ -23,6 +23,7 @@
 #include "Define.h"
 #include "ObjectDefines.h"
 #include "ObjectGuid.h"
+#include <deque>
 #include <list>
 #include <map>
 #include <mutex>
@@ -184,6 +185,7 @@ public:
 
     void SanitizeInstanceSavedData();
     void DeleteInstanceSavedData(uint32 instanceId);
+    void DeleteInstanceSavedData(uint32 instanceId, CharacterDatabaseTransaction trans);
 protected:
     static uint16 ResetTimeDelay[];
     static PlayerBindStorage playerBindStorage;
@@ -191,12 +193,18 @@ protected:
 
 private:
     void _ResetOrWarnAll(uint32 mapid, Difficulty difficulty, bool warn, time_t resetTime);
-    void _ResetSave(InstanceSaveHashMap::iterator& itr);
+    void _ResetSave(InstanceSaveHashMap::iterator& itr, CharacterDatabaseTransaction trans);
+    void _SendResetNotifications();
+
+    // players getting their calendar and raid info resent after a reset, a batch per update
+    static constexpr std::size_t ResetNotificationsPerUpdate = 100;
+
     bool lock_instLists{false};
     InstanceSaveHashMap m_instanceSaveById;
     ResetTimeByMapDifficultyMap m_resetTimeByMapDifficulty;
     ResetTimeByMapDifficultyMap m_resetExtendedTimeByMapDifficulty;
     ResetTimeQueue m_resetTimeQueue;
+    std::deque<ObjectGuid> m_resetNotificationQueue;
 };
 
 #define sInstanceSaveMgr InstanceSaveMgr::instance()
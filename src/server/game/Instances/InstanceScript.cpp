@@ -620,18 +620,13 @@ void InstanceScript::DoRespawnCreature(uint32 type, bool force)
 
 void InstanceScript::DoUpdateWorldState(uint32 uiStateId, uint32 uiStateData)
 {
-    Map::PlayerList const& lPlayers = instance->GetPlayers();
-
-    if (!lPlayers.IsEmpty())
-    {
-        for (Map::PlayerList::const_iterator itr = lPlayers.begin(); itr != lPlayers.end(); ++itr)
-            if (Player* player = itr->GetSource())
-                player->SendUpdateWorldState(uiStateId, uiStateData);
-    }
-    else
+    if (!instance->HavePlayers())
     {
         LOG_DEBUG("scripts.ai", "DoUpdateWorldState attempt send data but no players in map.");
+        return;
     }
+
+    instance->UpdateWorldState(uiStateId, uiStateData);
 }
 
 // Send Notify to all players in instance
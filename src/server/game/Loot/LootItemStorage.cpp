@@ -169,7 +169,7 @@ bool LootItemStorage::LoadStoredLoot(Item* item, Player* player)
         return false;
     }
 
-    Loot* loot = &item->loot;
+    Loot* loot = &item->GetLoot();
     LootItemContainer::iterator itr = lootItemStore.find(loot->containerGUID);
     if (itr == lootItemStore.end())
         return false;
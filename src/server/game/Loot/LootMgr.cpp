@@ -20,6 +20,7 @@
 #include "DisableMgr.h"
 #include "Group.h"
 #include "ItemEnchantmentMgr.h"
+#include "LoaderCache.h"
 #include "Log.h"
 #include "ObjectMgr.h"
 #include "Player.h"
@@ -140,6 +141,52 @@ void LootStore::Verify() const
 
 // Loads a *_loot_template DB table into loot store
 // All checks of the loaded template are called from here, no error reports at loot generation required
+namespace
+{
+    // a row of a loot table as read from the database, before the validity checks
+    struct LootTableRow
+    {
+        uint32 Entry;
+        uint32 Item;
+        int32 Reference;
+        float Chance;
+        uint16 LootMode;
+        uint8 GroupId;
+        uint8 MinCount;
+        uint8 MaxCount;
+        bool NeedsQuest;
+    };
+
+    std::vector<LootTableRow> SelectLootTableRows(char const* name)
+    {
+        std::vector<LootTableRow> rows;
+
+        //                                                  0     1            2               3         4         5             6
+        QueryResult result = WorldDatabase.Query("SELECT Entry, Item, Reference, Chance, QuestRequired, LootMode, GroupId, MinCount, MaxCount FROM {}", name);
+        if (!result)
+            return rows;
+
+        rows.reserve(result->GetRowCount());
+        do
+        {
+            Field* fields = result->Fetch();
+
+            LootTableRow& row = rows.emplace_back();
+            row.Entry       = fields[0].Get<uint32>();
+            row.Item        = fields[1].Get<uint32>();
+            row.Reference   = fields[2].Get<int32>();
+            row.Chance      = fields[3].Get<float>();
+            row.NeedsQuest  = fields[4].Get<bool>();
+            row.LootMode    = fields[5].Get<uint16>();
+            row.GroupId     = fields[6].Get<uint8>();
+            row.MinCount    = fields[7].Get<uint8>();
+            row.MaxCount    = fields[8].Get<uint8>();
+        } while (result->NextRow());
+
+        return rows;
+    }
+}
+
 uint32 LootStore::LoadLootTable()
 {
     LootTemplateMap::const_iterator tab;
@@ -147,27 +194,30 @@ uint32 LootStore::LoadLootTable()
     // Clearing store (for reloading case)
     Clear();
 
-    //                                                  0     1            2               3         4         5             6
-    QueryResult result = WorldDatabase.Query("SELECT Entry, Item, Reference, Chance, QuestRequired, LootMode, GroupId, MinCount, MaxCount FROM {}", GetName());
+    // the rows are cached as read, the checks below run on every load
+    std::vector<LootTableRow> rows;
+    if (!sLoaderCache->Load(GetName(), rows))
+    {
+        rows = SelectLootTableRows(GetName());
+        sLoaderCache->Save(GetName(), rows);
+    }
 
-    if (!result)
+    if (rows.empty())
         return 0;
 
     uint32 count = 0;
 
-    do
+    for (LootTableRow const& row : rows)
     {
-        Field* fields = result->Fetch();
-
-        uint32 entry               = fields[0].Get<uint32>();
-        uint32 item                = fields[1].Get<uint32>();
-        int32  reference           = fields[2].Get<int32>();
-        float  chance              = fields[3].Get<float>();
-        bool   needsquest          = fields[4].Get<bool>();
-        uint16 lootmode            = fields[5].Get<uint16>();
-        uint8  groupid             = fields[6].Get<uint8>();
-        int32  mincount            = fields[7].Get<uint8>();
-        int32  maxcount            = fields[8].Get<uint8>();
+        uint32 entry               = row.Entry;
+        uint32 item                = row.Item;
+        int32  reference           = row.Reference;
+        float  chance              = row.Chance;
+        bool   needsquest          = row.NeedsQuest;
+        uint16 lootmode            = row.LootMode;
+        uint8  groupid             = row.GroupId;
+        int32  mincount            = row.MinCount;
+        int32  maxcount            = row.MaxCount;
 
         if (maxcount > std::numeric_limits<uint8>::max())
         {
@@ -208,7 +258,7 @@ uint32 LootStore::LoadLootTable()
         // Adds current row to the template
         tab->second->AddEntry(storeitem);
         ++count;
-    } while (result->NextRow());
+    }
 
     Verify();                                           // Checks validity of the loot store
 
@@ -1291,37 +1341,45 @@ void LootTemplate::LootGroup::AddEntry(LootStoreItem* item)
 // Rolls an item from the group, returns nullptr if all miss their chances
 LootStoreItem const* LootTemplate::LootGroup::Roll(Loot& loot, Player const* player, LootStore const& store, uint16 lootMode) const
 {
-    LootStoreItemList possibleLoot = ExplicitlyChanced;
-    possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
+    // the entries are filtered in place, copying the lists allocated a node per entry on every roll
+    LootGroupInvalidSelector isInvalid(loot, lootMode);
+
+    float roll = 0.0f;
+    bool rolled = false;
 
-    if (!possibleLoot.empty())                             // First explicitly chanced entries are checked
+    for (LootStoreItem* item : ExplicitlyChanced)           // First explicitly chanced entries are checked
     {
-        float roll = (float)rand_chance();
+        if (isInvalid(item))
+            continue;
 
-        for (LootStoreItemList::const_iterator itr = possibleLoot.begin(); itr != possibleLoot.end(); ++itr)   // check each explicitly chanced entry in the template and modify its chance based on quality.
+        // only rolled when at least one entry can drop
+        if (!rolled)
         {
-            LootStoreItem* item = *itr;
-            float chance = item->chance;
+            roll = (float)rand_chance();
+            rolled = true;
+        }
 
-            if (!sScriptMgr->OnItemRoll(player, item, chance, loot, store))
-                return nullptr;
+        // check each explicitly chanced entry in the template and modify its chance based on quality.
+        float chance = item->chance;
 
-            if (chance >= 100.0f)
-                return item;
+        if (!sScriptMgr->OnItemRoll(player, item, chance, loot, store))
+            return nullptr;
 
-            roll -= chance;
-            if (roll < 0)
-                return item;
-        }
+        if (chance >= 100.0f)
+            return item;
+
+        roll -= chance;
+        if (roll < 0)
+            return item;
     }
 
     if (!sScriptMgr->OnBeforeLootEqualChanced(player, EqualChanced, loot, store))
         return nullptr;
 
-    possibleLoot = EqualChanced;
-    possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
-    if (!possibleLoot.empty())                              // If nothing selected yet - an item is taken from equal-chanced part
-        return Acore::Containers::SelectRandomContainerElement(possibleLoot);
+    // If nothing selected yet - an item is taken from equal-chanced part
+    auto itr = Acore::Containers::SelectRandomContainerElementIf(EqualChanced, [&isInvalid](LootStoreItem* item) { return !isInvalid(item); });
+    if (itr != EqualChanced.end())
+        return *itr;
 
     return nullptr;                                            // Empty drop from the group
 }
@@ -1904,7 +1962,7 @@ bool LootTemplate::addConditionItem(Condition* cond)
         {
             if ((*i)->itemid == uint32(cond->SourceEntry))
             {
-                (*i)->conditions.push_back(cond);
+                ConditionMgr::AddToConditionList((*i)->conditions, cond);
                 return true;
             }
         }
@@ -1925,7 +1983,7 @@ bool LootTemplate::addConditionItem(Condition* cond)
                 {
                     if ((*i)->itemid == uint32(cond->SourceEntry))
                     {
-                        (*i)->conditions.push_back(cond);
+                        ConditionMgr::AddToConditionList((*i)->conditions, cond);
                         return true;
                     }
                 }
@@ -1938,7 +1996,7 @@ bool LootTemplate::addConditionItem(Condition* cond)
                 {
                     if ((*i)->itemid == uint32(cond->SourceEntry))
                     {
-                        (*i)->conditions.push_back(cond);
+                        ConditionMgr::AddToConditionList((*i)->conditions, cond);
                         return true;
                     }
                 }
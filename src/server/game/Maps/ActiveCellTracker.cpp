@@ -0,0 +1,109 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ActiveCellTracker.h"
+
+namespace
+{
+    bool SameArea(CellArea const& a, CellArea const& b)
+    {
+        return a.low_bound == b.low_bound && a.high_bound == b.high_bound;
+    }
+
+    bool Contains(CellArea const& area, uint32 x, uint32 y)
+    {
+        return x >= area.low_bound.x_coord && x <= area.high_bound.x_coord && y >= area.low_bound.y_coord && y <= area.high_bound.y_coord;
+    }
+}
+
+void ActiveCellTracker::SetAreas(ObjectGuid player, CellArea const& area, Optional<CellArea> const& viewpointArea)
+{
+    auto itr = _playerAreas.find(player);
+    if (itr == _playerAreas.end())
+    {
+        Move({}, area);
+        Move({}, viewpointArea);
+        _playerAreas.insert(std::make_pair(player, PlayerAreas{ area, viewpointArea }));
+        return;
+    }
+
+    PlayerAreas& areas = itr->second;
+    if (!SameArea(areas.Area, area))
+    {
+        Move(areas.Area, area);
+        areas.Area = area;
+    }
+
+    if (areas.ViewpointArea.has_value() != viewpointArea.has_value() || (viewpointArea && !SameArea(*areas.ViewpointArea, *viewpointArea)))
+    {
+        Move(areas.ViewpointArea, viewpointArea);
+        areas.ViewpointArea = viewpointArea;
+    }
+}
+
+void ActiveCellTracker::Remove(ObjectGuid player)
+{
+    auto itr = _playerAreas.find(player);
+    if (itr == _playerAreas.end())
+        return;
+
+    Move(itr->second.Area, {});
+    Move(itr->second.ViewpointArea, {});
+    _playerAreas.erase(itr);
+}
+
+void ActiveCellTracker::Move(Optional<CellArea> const& from, Optional<CellArea> const& to)
+{
+    // Cells in both areas keep their count
+    if (to)
+        for (uint32 y = to->low_bound.y_coord; y <= to->high_bound.y_coord; ++y)
+            for (uint32 x = to->low_bound.x_coord; x <= to->high_bound.x_coord; ++x)
+                if (!from || !Contains(*from, x, y))
+                    AddCell(y * TOTAL_NUMBER_OF_CELLS_PER_MAP + x);
+
+    if (from)
+        for (uint32 y = from->low_bound.y_coord; y <= from->high_bound.y_coord; ++y)
+            for (uint32 x = from->low_bound.x_coord; x <= from->high_bound.x_coord; ++x)
+                if (!to || !Contains(*to, x, y))
+                    RemoveCell(y * TOTAL_NUMBER_OF_CELLS_PER_MAP + x);
+}
+
+void ActiveCellTracker::AddCell(uint32 cellId)
+{
+    auto itr = _cellAreaCounts.find(cellId);
+    if (itr != _cellAreaCounts.end())
+    {
+        ++itr->second;
+        return;
+    }
+
+    _cellAreaCounts.insert(std::make_pair(cellId, uint16(1)));
+    _activeCells.set(cellId);
+}
+
+void ActiveCellTracker::RemoveCell(uint32 cellId)
+{
+    auto itr = _cellAreaCounts.find(cellId);
+    if (itr == _cellAreaCounts.end())
+        return;
+
+    if (--itr->second)
+        return;
+
+    _cellAreaCounts.erase(itr);
+    _activeCells.reset(cellId);
+}
@@ -0,0 +1,65 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _ACTIVE_CELL_TRACKER_H_INCLUDED
+#define _ACTIVE_CELL_TRACKER_H_INCLUDED
+
+#include "Cell.h"
+#include "FlatHashMap.h"
+#include "ObjectGuid.h"
+#include "Optional.h"
+#include <bitset>
+
+/*
+ * Cells of a map around its players (and their far sight viewpoints), whose
+ * objects are kept in the map update list.
+ *
+ * Every player owns one area around itself and optionally one around its
+ * viewpoint. Cells count the areas covering them, moving an area only
+ * touches the cells entering or leaving it, and nothing when the player
+ * stays within the same cells.
+ */
+class ActiveCellTracker
+{
+public:
+    static constexpr uint32 CELL_COUNT = TOTAL_NUMBER_OF_CELLS_PER_MAP * TOTAL_NUMBER_OF_CELLS_PER_MAP;
+
+    // Sets the areas of a player, an empty viewpoint removes the previous one
+    void SetAreas(ObjectGuid player, CellArea const& area, Optional<CellArea> const& viewpointArea);
+    void Remove(ObjectGuid player);
+
+    [[nodiscard]] bool IsActive(uint32 cellId) const { return _activeCells.test(cellId); }
+    [[nodiscard]] uint32 GetActiveCellCount() const { return uint32(_cellAreaCounts.size()); }
+
+private:
+    struct PlayerAreas
+    {
+        CellArea Area;
+        Optional<CellArea> ViewpointArea;
+    };
+
+    // Moves one area, from and to may be empty
+    void Move(Optional<CellArea> const& from, Optional<CellArea> const& to);
+    void AddCell(uint32 cellId);
+    void RemoveCell(uint32 cellId);
+
+    std::bitset<CELL_COUNT> _activeCells;
+    Acore::FlatHashMap<uint32, uint16> _cellAreaCounts;     // only active cells
+    Acore::FlatHashMap<ObjectGuid, PlayerAreas> _playerAreas;
+};
+
+#endif //_ACTIVE_CELL_TRACKER_H_INCLUDED
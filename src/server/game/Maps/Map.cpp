@@ -16,34 +16,52 @@
  */
 
 #include "Map.h"
+#include "Battlefield.h"
+#include "BattlefieldMgr.h"
 #include "Battleground.h"
 #include "CellImpl.h"
+#include "ChaseFlowField.h"
+#include "CycleClock.h"
 #include "Chat.h"
+#include "Config.h"
 #include "DisableMgr.h"
 #include "DynamicTree.h"
 #include "GameTime.h"
 #include "Geometry.h"
 #include "GridNotifiers.h"
+#include "GridTerrainDataStore.h"
+#include "GridTerrainPrefetcher.h"
 #include "Group.h"
 #include "InstanceScript.h"
 #include "IVMapMgr.h"
 #include "LFGMgr.h"
 #include "MapGrid.h"
 #include "MapInstanced.h"
+#include "MapRegionUpdater.h"
+#include "MapReplay.h"
 #include "Metric.h"
 #include "MiscPackets.h"
 #include "MMapFactory.h"
 #include "Object.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
+#include "OutdoorPvPMgr.h"
+#include "PathCache.h"
 #include "Pet.h"
+#include "Profiler.h"
 #include "ScriptMgr.h"
+#include "StringConvert.h"
+#include "Tokenize.h"
 #include "Transport.h"
 #include "VMapFactory.h"
 #include "Vehicle.h"
 #include "VMapMgr2.h"
+#include "VMapQueryCache.h"
+#include "WaypointMovementGenerator.h"
 #include "Weather.h"
 #include "WeatherMgr.h"
+#include "WorldLoadGovernor.h"
+#include "WorldStatePackets.h"
 
 #define MAP_INVALID_ZONE        0xFFFFFFFF
 
@@ -68,8 +86,9 @@ Map::~Map()
 
 Map::Map(uint32 id, uint32 InstanceId, uint8 SpawnMode, Map* _parent) :
     _mapGridManager(this), i_mapEntry(sMapStore.LookupEntry(id)), i_spawnMode(SpawnMode), i_InstanceId(InstanceId),
-    m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE), _instanceResetPeriod(0),
-    _transportsUpdateIter(_transports.end()), i_scriptLock(false), _defaultLight(GetDefaultMapLight(id))
+    m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE), _visibilityEpoch(1), _crowdInterestMap(true), _movementRelayActive(false), _instanceResetPeriod(0),
+    _transportsUpdateIter(_transports.end()), i_scriptLock(false), _regionUpdateInProgress(false), _defaultLight(GetDefaultMapLight(id)),
+    _sleptObjects(0), _lastUpdateSleptObjects(0), _lastUpdateCost(0), _updatePhaseHistograms()
 {
     m_parentMap = (_parent ? _parent : this);
 
@@ -81,6 +100,25 @@ Map::Map(uint32 id, uint32 InstanceId, uint8 SpawnMode, Map* _parent) :
 
     _weatherUpdateTimer.SetInterval(1 * IN_MILLISECONDS);
     _corpseUpdateTimer.SetInterval(20 * MINUTE * IN_MILLISECONDS);
+    _updatePhaseMetricsTimer.SetInterval(10 * IN_MILLISECONDS);
+
+    if (uint32 cacheSize = sWorld->getIntConfig(CONFIG_VMAP_QUERY_CACHE_SIZE))
+        _vmapQueryCache = std::make_unique<VMapQueryCache>(cacheSize, sWorld->getFloatConfig(CONFIG_VMAP_QUERY_CACHE_PRECISION));
+
+    if (uint32 cacheSize = sWorld->getIntConfig(CONFIG_MMAP_PATH_CACHE_SIZE))
+        _pathCache = std::make_unique<PathCache>(cacheSize, sWorld->getFloatConfig(CONFIG_MMAP_PATH_CACHE_PRECISION));
+
+    if (sWorld->getIntConfig(CONFIG_CHASE_FLOW_FIELD_MIN_CHASERS))
+        _chaseFlowFields = std::make_unique<ChaseFlowFieldStore>();
+
+    std::string const crowdInterestMaps = sConfigMgr->GetOption<std::string>("Visibility.CrowdInterest.Maps", "");
+    if (!crowdInterestMaps.empty())
+    {
+        _crowdInterestMap = false;
+        for (std::string_view mapId : Acore::Tokenize(crowdInterestMaps, ',', false))
+            if (Acore::StringTo<uint32>(mapId) == id)
+                _crowdInterestMap = true;
+    }
 }
 
 // Hook called after map is created AND after added to map list
@@ -117,6 +155,7 @@ void Map::AddToGrid(T* obj, Cell const& cell)
     grid->AddGridObject<T>(cell.CellX(), cell.CellY(), obj);
 
     obj->SetCurrentCell(cell);
+    obj->SetMoveVisibilityEpoch(_visibilityEpoch);
 }
 
 template<>
@@ -125,9 +164,13 @@ void Map::AddToGrid(Creature* obj, Cell const& cell)
     MapGridType* grid = GetMapGrid(cell.GridX(), cell.GridY());
     grid->AddGridObject(cell.CellX(), cell.CellY(), obj);
     if (obj->IsFarVisible())
+    {
         grid->AddFarVisibleObject(cell.CellX(), cell.CellY(), obj);
+        AddToFarVisibleObjectIndex(obj, cell);
+    }
 
     obj->SetCurrentCell(cell);
+    obj->SetMoveVisibilityEpoch(_visibilityEpoch);
 }
 
 template<>
@@ -136,9 +179,13 @@ void Map::AddToGrid(GameObject* obj, Cell const& cell)
     MapGridType* grid = GetMapGrid(cell.GridX(), cell.GridY());
     grid->AddGridObject(cell.CellX(), cell.CellY(), obj);
     if (obj->IsFarVisible())
+    {
         grid->AddFarVisibleObject(cell.CellX(), cell.CellY(), obj);
+        AddToFarVisibleObjectIndex(obj, cell);
+    }
 
     obj->SetCurrentCell(cell);
+    obj->SetMoveVisibilityEpoch(_visibilityEpoch);
 }
 
 template<>
@@ -185,6 +232,7 @@ void Map::EnsureGridCreated(GridCoord const& gridCoord)
 
 bool Map::EnsureGridLoaded(Cell const& cell)
 {
+    std::unique_lock<std::recursive_mutex> guard = GetRegionUpdateGuard();
     EnsureGridCreated(GridCoord(cell.GridX(), cell.GridY()));
 
     if (_mapGridManager.LoadGrid(cell.GridX(), cell.GridY()))
@@ -393,23 +441,21 @@ bool Map::AddToMap(Transport* obj, bool /*checkTransport*/)
     return true;
 }
 
-void Map::MarkNearbyCellsOf(WorldObject* obj)
+void Map::UpdateActiveCellsOf(Player* player)
 {
     // Check for valid position
-    if (!obj->IsPositionValid())
+    if (!player->IsPositionValid())
         return;
 
-    // Update mobs/objects in ALL visible cells around object!
-    CellArea area = Cell::CalculateCellArea(obj->GetPositionX(), obj->GetPositionY(), obj->GetGridActivationRange());
-    for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
-    {
-        for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
-        {
-            // marked cells are those that have been visited
-            uint32 cell_id = (y * TOTAL_NUMBER_OF_CELLS_PER_MAP) + x;
-            markCell(cell_id);
-        }
-    }
+    // Update mobs/objects in ALL visible cells around the player and its far sight viewpoint
+    CellArea const area = Cell::CalculateCellArea(player->GetPositionX(), player->GetPositionY(), player->GetGridActivationRange());
+
+    Optional<CellArea> viewpointArea;
+    if (WorldObject* viewPoint = player->GetViewpoint())
+        if ((viewPoint->ToCreature() || viewPoint->ToDynObject()) && viewPoint->IsPositionValid())
+            viewpointArea = Cell::CalculateCellArea(viewPoint->GetPositionX(), viewPoint->GetPositionY(), viewPoint->GetGridActivationRange());
+
+    _activeCells.SetAreas(player->GetGUID(), area, viewpointArea);
 }
 
 void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
@@ -429,29 +475,90 @@ void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
         ++_zonePlayerCountMap[newZone];
 }
 
+namespace
+{
+    // upper bounds of the update phase buckets, in microseconds
+    constexpr std::array<uint32, 9> UpdatePhaseBucketBounds = { 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000 };
+    constexpr std::array<char const*, 10> UpdatePhaseBucketNames = { "100us", "250us", "500us", "1ms", "2.5ms", "5ms", "10ms", "25ms", "50ms", "inf" };
+
+    constexpr std::array<char const*, MAX_MAP_UPDATE_PHASES> UpdatePhaseNames =
+    {
+        "sessions", "players", "non_player_objects", "send_object_updates", "scripts", "move_lists", "delayed_visibility", "script_hooks"
+    };
+}
+
+// Adds the duration of its scope to the histogram of an update phase
+class Map::UpdatePhaseTimer
+{
+    static_assert(UpdatePhaseBucketBounds.size() + 1 == UpdatePhaseBuckets && UpdatePhaseBucketNames.size() == UpdatePhaseBuckets);
+
+public:
+    UpdatePhaseTimer(Map* map, MapUpdatePhase phase) :
+        _histogram(sMetric->IsEnabled() ? &map->_updatePhaseHistograms[phase] : nullptr), _start(_histogram ? Acore::CycleClock::now() : Acore::CycleClock::time_point()) { }
+
+    ~UpdatePhaseTimer()
+    {
+        if (!_histogram)
+            return;
+
+        uint32 duration = uint32(std::chrono::duration_cast<Microseconds>(Acore::CycleClock::now() - _start).count());
+        std::size_t bucket = std::upper_bound(UpdatePhaseBucketBounds.begin(), UpdatePhaseBucketBounds.end(), duration) - UpdatePhaseBucketBounds.begin();
+        ++_histogram->Buckets[bucket];
+        _histogram->Max = std::max(_histogram->Max, duration);
+        _histogram->Total += duration;
+    }
+
+    UpdatePhaseTimer(UpdatePhaseTimer const&) = delete;
+    UpdatePhaseTimer& operator=(UpdatePhaseTimer const&) = delete;
+
+private:
+    UpdatePhaseHistogram* _histogram;
+    Acore::CycleClock::time_point _start;
+};
+
 void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 {
-    if (t_diff)
-        _dynamicTree.update(t_diff);
+    MapReplay::UpdateScope replayScope(this);
+
+    ++_visibilityEpoch;
+
+    PrepareSessionPackets();
+    SendWorldStateUpdates();
+
+    uint32 const movementRelayMinPlayers = sWorld->getIntConfig(CONFIG_MAP_MOVEMENT_RELAY_MIN_PLAYERS);
+    _movementRelayActive = movementRelayMinPlayers && m_mapRefMgr.getSize() >= movementRelayMinPlayers;
 
     // Update world sessions and players
-    for (m_mapRefIter = m_mapRefMgr.begin(); m_mapRefIter != m_mapRefMgr.end(); ++m_mapRefIter)
     {
-        Player* player = m_mapRefIter->GetSource();
-        if (player && player->IsInWorld())
+        PROFILER_ZONE("Map::UpdateSessions");
+        UpdatePhaseTimer phaseTimer(this, MAP_UPDATE_PHASE_SESSIONS);
+        for (m_mapRefIter = m_mapRefMgr.begin(); m_mapRefIter != m_mapRefMgr.end(); ++m_mapRefIter)
         {
-            // Update session
-            WorldSession* session = player->GetSession();
-            MapSessionFilter updater(session);
-            session->Update(s_diff, updater);
-
-            // update players at tick
-            if (!t_diff)
-                player->Update(s_diff);
+            Player* player = m_mapRefIter->GetSource();
+            if (player && player->IsInWorld())
+            {
+                // Update session
+                WorldSession* session = player->GetSession();
+                MapSessionFilter updater(session);
+                session->Update(s_diff, updater);
+
+                // update players at tick
+                if (!t_diff)
+                    player->Update(s_diff);
+            }
         }
     }
 
-    Events.Update(t_diff);
+    if (_movementRelayActive)
+    {
+        _movementRelay.Flush(this);
+        _movementRelayActive = false;
+    }
+
+    {
+        PROFILER_ZONE("Map::UpdateEvents");
+        Events.Update(t_diff);
+    }
 
     if (!t_diff)
     {
@@ -460,55 +567,78 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     }
 
     _updatableObjectListRecheckTimer.Update(t_diff);
-    resetMarkedCells();
 
     // Update players
-    for (m_mapRefIter = m_mapRefMgr.begin(); m_mapRefIter != m_mapRefMgr.end(); ++m_mapRefIter)
     {
-        Player* player = m_mapRefIter->GetSource();
-
-        if (!player || !player->IsInWorld())
-            continue;
-
-        player->Update(s_diff);
-
-        if (_updatableObjectListRecheckTimer.Passed())
+        PROFILER_ZONE("Map::UpdatePlayers");
+        UpdatePhaseTimer phaseTimer(this, MAP_UPDATE_PHASE_PLAYERS);
+        for (m_mapRefIter = m_mapRefMgr.begin(); m_mapRefIter != m_mapRefMgr.end(); ++m_mapRefIter)
         {
-            MarkNearbyCellsOf(player);
+            Player* player = m_mapRefIter->GetSource();
 
-            // If player is using far sight, update viewpoint
-            if (WorldObject* viewPoint = player->GetViewpoint())
-            {
-                if (Creature* viewCreature = viewPoint->ToCreature())
-                    MarkNearbyCellsOf(viewCreature);
-                else if (DynamicObject* viewObject = viewPoint->ToDynObject())
-                    MarkNearbyCellsOf(viewObject);
-            }
+            if (!player || !player->IsInWorld())
+                continue;
+
+            player->Update(s_diff);
+            UpdateActiveCellsOf(player);
         }
     }
 
-    UpdateNonPlayerObjects(t_diff);
+    {
+        PROFILER_ZONE("Map::UpdateNonPlayerObjects");
+        UpdatePhaseTimer phaseTimer(this, MAP_UPDATE_PHASE_NON_PLAYER_OBJECTS);
+        UpdateNonPlayerObjects(t_diff);
+    }
 
-    SendObjectUpdates();
+    {
+        PROFILER_ZONE("Map::SendObjectUpdates");
+        UpdatePhaseTimer phaseTimer(this, MAP_UPDATE_PHASE_SEND_OBJECT_UPDATES);
+        SendObjectUpdates();
+    }
 
     ///- Process necessary scripts
     if (!m_scriptSchedule.empty())
     {
+        PROFILER_ZONE("Map::ScriptsProcess");
+        UpdatePhaseTimer phaseTimer(this, MAP_UPDATE_PHASE_SCRIPTS);
         i_scriptLock = true;
         ScriptsProcess();
         i_scriptLock = false;
     }
 
-    MoveAllCreaturesInMoveList();
-    MoveAllGameObjectsInMoveList();
-    MoveAllDynamicObjectsInMoveList();
+    {
+        PROFILER_ZONE("Map::MoveObjects");
+        UpdatePhaseTimer phaseTimer(this, MAP_UPDATE_PHASE_MOVE_LISTS);
+        MoveAllCreaturesInMoveList();
+        MoveAllGameObjectsInMoveList();
+        MoveAllDynamicObjectsInMoveList();
+    }
 
-    HandleDelayedVisibility();
+    {
+        PROFILER_ZONE("Map::HandleDelayedVisibility");
+        UpdatePhaseTimer phaseTimer(this, MAP_UPDATE_PHASE_DELAYED_VISIBILITY);
+        HandleDelayedVisibility();
+    }
 
     UpdateWeather(t_diff);
     UpdateExpiredCorpses(t_diff);
+    UpdateCreatureRespawnQueue();
+
+    if (ScriptRegistry<AllMapScript>::HasEnabledHooks(ALLMAPHOOK_ON_MAP_UPDATE))
+    {
+        UpdatePhaseTimer phaseTimer(this, MAP_UPDATE_PHASE_SCRIPT_HOOKS);
+        sScriptMgr->OnMapUpdate(this, t_diff);
+    }
 
-    sScriptMgr->OnMapUpdate(this, t_diff);
+    if (sMetric->IsEnabled())
+    {
+        _updatePhaseMetricsTimer.Update(t_diff);
+        if (_updatePhaseMetricsTimer.Passed())
+        {
+            _updatePhaseMetricsTimer.Reset();
+            SendUpdatePhaseMetrics();
+        }
+    }
 
     METRIC_VALUE("map_creatures", uint64(GetObjectsStore().Size<Creature>()),
         METRIC_TAG("map_id", std::to_string(GetId())),
@@ -517,6 +647,76 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     METRIC_VALUE("map_gameobjects", uint64(GetObjectsStore().Size<GameObject>()),
         METRIC_TAG("map_id", std::to_string(GetId())),
         METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_slept_objects", uint64(_lastUpdateSleptObjects),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_active_cells", uint64(GetActiveCellCount()),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    if (_vmapQueryCache)
+    {
+        uint64 hits, misses;
+        _vmapQueryCache->GetAndResetStats(hits, misses);
+
+        METRIC_VALUE("map_vmap_cache_hits", hits,
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+        METRIC_VALUE("map_vmap_cache_misses", misses,
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+    }
+
+    if (_pathCache)
+    {
+        uint64 hits, misses;
+        _pathCache->GetAndResetStats(hits, misses);
+
+        METRIC_VALUE("map_path_cache_hits", hits,
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+        METRIC_VALUE("map_path_cache_misses", misses,
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+    }
+}
+
+void Map::SendUpdatePhaseMetrics()
+{
+    std::string const mapId = std::to_string(GetId());
+    std::string const instanceId = std::to_string(GetInstanceId());
+
+    for (uint8 phase = 0; phase < MAX_MAP_UPDATE_PHASES; ++phase)
+    {
+        UpdatePhaseHistogram& histogram = _updatePhaseHistograms[phase];
+        if (std::all_of(histogram.Buckets.begin(), histogram.Buckets.end(), [](uint32 count) { return !count; }))
+            continue;
+
+        for (std::size_t bucket = 0; bucket < UpdatePhaseBuckets; ++bucket)
+        {
+            METRIC_VALUE("map_update_phase_time", uint64(histogram.Buckets[bucket]),
+                METRIC_TAG("map_id", mapId),
+                METRIC_TAG("map_instanceid", instanceId),
+                METRIC_TAG("phase", UpdatePhaseNames[phase]),
+                METRIC_TAG("bucket", UpdatePhaseBucketNames[bucket]));
+        }
+
+        METRIC_VALUE("map_update_phase_max", uint64(histogram.Max),
+            METRIC_TAG("map_id", mapId),
+            METRIC_TAG("map_instanceid", instanceId),
+            METRIC_TAG("phase", UpdatePhaseNames[phase]));
+
+        METRIC_VALUE("map_update_phase_total", histogram.Total,
+            METRIC_TAG("map_id", mapId),
+            METRIC_TAG("map_instanceid", instanceId),
+            METRIC_TAG("phase", UpdatePhaseNames[phase]));
+
+        histogram = { };
+    }
 }
 
 void Map::UpdateNonPlayerObjects(uint32 const diff)
@@ -525,19 +725,30 @@ void Map::UpdateNonPlayerObjects(uint32 const diff)
         _AddObjectToUpdateList(obj);
     _pendingAddUpdatableObjectList.clear();
 
+    _lastUpdateSleptObjects = _sleptObjects;
+    _sleptObjects = 0;
+
+    PrepareThreatLists();
+
+    if (!Instanceable() && sMapRegionUpdater->IsActive() && _updatableObjectList.size() >= sWorld->getIntConfig(CONFIG_MAP_REGION_UPDATE_MIN_OBJECTS))
+    {
+        UpdateNonPlayerObjectsInRegions(diff);
+        return;
+    }
+
+    uint32 const now = uint32(GameTime::GetGameTimeMS().count());
+
     if (_updatableObjectListRecheckTimer.Passed())
     {
         for (uint32 i = 0; i < _updatableObjectList.size();)
         {
             WorldObject* obj = _updatableObjectList[i];
-            if (!obj->IsInWorld())
+            if (!UpdateUpdatableObjectAt(i, diff, now))
             {
                 ++i;
                 continue;
             }
 
-            obj->Update(diff);
-
             if (!obj->IsUpdateNeeded())
             {
                 _RemoveObjectFromUpdateList(obj);
@@ -552,21 +763,258 @@ void Map::UpdateNonPlayerObjects(uint32 const diff)
     else
     {
         for (uint32 i = 0; i < _updatableObjectList.size(); ++i)
+            UpdateUpdatableObjectAt(i, diff, now);
+    }
+}
+
+void Map::PrepareSessionPackets()
+{
+    uint32 const minPlayers = sWorld->getIntConfig(CONFIG_MAP_SESSION_PREPARE_MIN_PLAYERS);
+    if (!minPlayers || !sMapRegionUpdater->IsActive() || m_mapRefMgr.getSize() < minPlayers)
+        return;
+
+    // Receive queue filtering and anti-DOS accounting only touch the session itself,
+    // packet handlers keep running serially in the loop below
+    std::vector<std::function<void()>> jobs;
+    jobs.reserve(m_mapRefMgr.getSize());
+    for (MapRefMgr::iterator itr = m_mapRefMgr.begin(); itr != m_mapRefMgr.end(); ++itr)
+    {
+        Player* player = itr->GetSource();
+        if (!player || !player->IsInWorld())
+            continue;
+
+        WorldSession* session = player->GetSession();
+        jobs.emplace_back([session]()
         {
-            WorldObject* obj = _updatableObjectList[i];
-            if (!obj->IsInWorld())
-                continue;
+            MapSessionFilter updater(session);
+            session->PrepareMapPackets(updater);
+        });
+    }
 
-            obj->Update(diff);
+    sMapRegionUpdater->Execute(jobs);
+}
+
+void Map::PrepareThreatLists()
+{
+    uint32 const minCreatures = sWorld->getIntConfig(CONFIG_MAP_THREAT_PREPARE_MIN_CREATURES);
+    if (!minCreatures || !sMapRegionUpdater->IsActive())
+        return;
+
+    std::vector<ThreatMgr*> threatMgrs;
+    for (WorldObject* obj : _updatableObjectList)
+        if (Creature* creature = obj->ToCreature())
+            if (creature->IsInWorld() && creature->IsInCombat() && creature->GetThreatMgr().isThreatListDirty())
+                threatMgrs.push_back(&creature->GetThreatMgr());
+
+    if (threatMgrs.size() < minCreatures)
+        return;
+
+    // Sorting a threat list only touches the references of its own creature, the victims
+    // are still selected by the serial AI updates as they depend on the state of the world
+    static constexpr std::size_t ThreatListsPerJob = 32;
+    std::vector<std::function<void()>> jobs;
+    jobs.reserve(threatMgrs.size() / ThreatListsPerJob + 1);
+    for (std::size_t begin = 0; begin < threatMgrs.size(); begin += ThreatListsPerJob)
+    {
+        std::size_t const end = std::min(begin + ThreatListsPerJob, threatMgrs.size());
+        jobs.emplace_back([&threatMgrs, begin, end]()
+        {
+            for (std::size_t i = begin; i < end; ++i)
+                threatMgrs[i]->UpdateThreatList();
+        });
+    }
+
+    sMapRegionUpdater->Execute(jobs);
+}
+
+void Map::UpdateNonPlayerObjectsInRegions(uint32 const diff)
+{
+    // Regions are squares of grids whose side is larger than the visibility range,
+    // colored like a checkerboard so that regions updated at the same time are
+    // always separated by at least one full region
+    uint32 const regionSize = MapRegionUpdater::GetRegionSizeInGrids(GetVisibilityRange());
+    struct RegionObject
+    {
+        WorldObject* Object;
+        UpdatableObjectKind Kind;
+        uint32 Diff;
+    };
+
+    std::array<std::unordered_map<uint32, std::vector<RegionObject>>, MapRegionUpdater::REGION_PHASE_COUNT> phases;
+
+    uint32 const now = uint32(GameTime::GetGameTimeMS().count());
+    for (std::size_t i = 0; i < _updatableObjectList.size(); ++i)
+    {
+        WorldObject* obj = _updatableObjectList[i];
+        uint32 const objectDiff = ConsumeUpdatableObjectDiff(i, diff, now);
+        if (!objectDiff || !obj->IsInWorld())
+            continue;
+
+        GridCoord const gridCoord = Acore::ComputeGridCoord(obj->GetPositionX(), obj->GetPositionY());
+        uint32 const regionX = gridCoord.x_coord / regionSize;
+        uint32 const regionY = gridCoord.y_coord / regionSize;
+        phases[(regionX & 1) | ((regionY & 1) << 1)][regionX * MAX_NUMBER_OF_GRIDS + regionY].push_back({ obj, _updatableObjectKinds[i], objectDiff });
+    }
+
+    bool const recheck = _updatableObjectListRecheckTimer.Passed();
+    std::mutex idleLock;
+    std::vector<WorldObject*> idleObjects;
+
+    _regionUpdateInProgress = true;
+
+    for (auto& regions : phases)
+    {
+        std::vector<std::function<void()>> jobs;
+        jobs.reserve(regions.size());
+        for (auto& [regionId, objects] : regions)
+        {
+            jobs.emplace_back([this, &objects, &idleLock, &idleObjects, recheck, now]()
+            {
+                for (RegionObject const& regionObject : objects)
+                {
+                    WorldObject* obj = regionObject.Object;
+                    if (!obj->IsInWorld())
+                        continue;
+
+                    UpdateUpdatableObject(obj, regionObject.Kind, regionObject.Diff);
+
+                    if (obj->IsInWorld())
+                        if (uint32 sleepTime = GetUpdatableObjectSleepTime(obj, regionObject.Kind))
+                            SetUpdatableObjectSleep(obj, now + sleepTime);
+
+                    if (recheck && !obj->IsUpdateNeeded())
+                    {
+                        std::lock_guard<std::mutex> idleGuard(idleLock);
+                        idleObjects.push_back(obj);
+                    }
+                }
+            });
         }
+
+        sMapRegionUpdater->Execute(jobs);
     }
+
+    _regionUpdateInProgress = false;
+
+    // Serial merge: update list removals are deferred until no region is running
+    for (WorldObject* obj : idleObjects)
+        if (!obj->IsUpdateNeeded())
+            RemoveObjectFromMapUpdateList(obj);
+
+    if (recheck)
+        _updatableObjectListRecheckTimer.Reset();
+}
+
+std::unique_lock<std::recursive_mutex> Map::GetRegionUpdateGuard()
+{
+    if (!_regionUpdateInProgress)
+        return std::unique_lock<std::recursive_mutex>();
+
+    return std::unique_lock<std::recursive_mutex>(_regionUpdateLock);
+}
+
+uint32 Map::ConsumeUpdatableObjectDiff(std::size_t index, uint32 diff, uint32 now)
+{
+    uint32& wakeTime = _updatableObjectWakeTimes[index];
+    if (!wakeTime)
+        return diff;
+
+    if (int32(wakeTime - now) > 0)
+    {
+        _updatableObjectSleptDiffs[index] += diff;
+        ++_sleptObjects;
+        return 0;
+    }
+
+    diff += _updatableObjectSleptDiffs[index];
+    _updatableObjectSleptDiffs[index] = 0;
+    wakeTime = 0;
+    return diff;
+}
+
+bool Map::UpdateUpdatableObjectAt(std::size_t index, uint32 diff, uint32 now)
+{
+    uint32 const objectDiff = ConsumeUpdatableObjectDiff(index, diff, now);
+    if (!objectDiff)
+        return false;
+
+    WorldObject* obj = _updatableObjectList[index];
+    if (!obj->IsInWorld())
+        return false;
+
+    UpdatableObjectKind const kind = _updatableObjectKinds[index];
+    UpdateUpdatableObject(obj, kind, objectDiff);
+
+    // The update may have swapped another object at this offset
+    if (_updatableObjectList[index] == obj && obj->IsInWorld())
+        if (uint32 sleepTime = GetUpdatableObjectSleepTime(obj, kind))
+            _updatableObjectWakeTimes[index] = std::max<uint32>(now + sleepTime, 1);
+
+    return true;
+}
+
+uint32 Map::GetUpdatableObjectSleepTime(WorldObject* obj, UpdatableObjectKind kind)
+{
+    if (kind == UpdatableObjectKind::Creature)
+        return static_cast<Creature*>(obj)->GetUpdateSleepTime();
+
+    return 0;
+}
+
+void Map::UpdateUpdatableObject(WorldObject* obj, UpdatableObjectKind kind, uint32 diff)
+{
+    switch (kind)
+    {
+        case UpdatableObjectKind::Creature:
+            static_cast<Creature*>(obj)->Creature::Update(diff);
+            break;
+        case UpdatableObjectKind::GameObject:
+            static_cast<GameObject*>(obj)->GameObject::Update(diff);
+            break;
+        case UpdatableObjectKind::DynamicObject:
+            static_cast<DynamicObject*>(obj)->DynamicObject::Update(diff);
+            break;
+        default:
+            obj->Update(diff);
+            break;
+    }
+}
+
+void Map::SetUpdatableObjectSleep(WorldObject* obj, uint32 wakeTime)
+{
+    std::unique_lock<std::recursive_mutex> guard = GetRegionUpdateGuard();
+    UpdatableMapObject* mapUpdatableObject = dynamic_cast<UpdatableMapObject*>(obj);
+    if (!mapUpdatableObject || mapUpdatableObject->GetUpdateState() != UpdatableMapObject::UpdateState::Updating)
+        return;
+
+    // 0 is reserved for awake objects
+    _updatableObjectWakeTimes[mapUpdatableObject->GetMapUpdateListOffset()] = wakeTime ? wakeTime : 1;
+}
+
+void Map::WakeUpdatableObject(WorldObject* obj)
+{
+    std::unique_lock<std::recursive_mutex> guard = GetRegionUpdateGuard();
+    UpdatableMapObject* mapUpdatableObject = dynamic_cast<UpdatableMapObject*>(obj);
+    if (!mapUpdatableObject || mapUpdatableObject->GetUpdateState() != UpdatableMapObject::UpdateState::Updating)
+        return;
+
+    // Expire the sleep, the next update consumes the diff skipped meanwhile
+    uint32& wakeTime = _updatableObjectWakeTimes[mapUpdatableObject->GetMapUpdateListOffset()];
+    if (wakeTime)
+        wakeTime = 1;
 }
 
 void Map::AddObjectToPendingUpdateList(WorldObject* obj)
 {
+    std::unique_lock<std::recursive_mutex> guard = GetRegionUpdateGuard();
     if (!obj->CanBeAddedToMapUpdateList())
         return;
 
+    // woken up by the respawn queue
+    if (Creature* creature = obj->ToCreature())
+        if (creature->IsRespawnScheduled())
+            return;
+
     UpdatableMapObject* mapUpdatableObject = dynamic_cast<UpdatableMapObject*>(obj);
     if (mapUpdatableObject->GetUpdateState() != UpdatableMapObject::UpdateState::NotUpdating)
         return;
@@ -581,9 +1029,21 @@ void Map::_AddObjectToUpdateList(WorldObject* obj)
     UpdatableMapObject* mapUpdatableObject = dynamic_cast<UpdatableMapObject*>(obj);
     ASSERT(mapUpdatableObject && mapUpdatableObject->GetUpdateState() == UpdatableMapObject::UpdateState::PendingAdd);
 
+    // Derived types (summons, pets, transports...) override Update()
+    UpdatableObjectKind kind = UpdatableObjectKind::Generic;
+    if (typeid(*obj) == typeid(Creature))
+        kind = UpdatableObjectKind::Creature;
+    else if (typeid(*obj) == typeid(GameObject))
+        kind = UpdatableObjectKind::GameObject;
+    else if (typeid(*obj) == typeid(DynamicObject))
+        kind = UpdatableObjectKind::DynamicObject;
+
     mapUpdatableObject->SetUpdateState(UpdatableMapObject::UpdateState::Updating);
     mapUpdatableObject->SetMapUpdateListOffset(_updatableObjectList.size());
     _updatableObjectList.push_back(obj);
+    _updatableObjectKinds.push_back(kind);
+    _updatableObjectWakeTimes.push_back(0);
+    _updatableObjectSleptDiffs.push_back(0);
 }
 
 // Internal use only
@@ -594,16 +1054,24 @@ void Map::_RemoveObjectFromUpdateList(WorldObject* obj)
 
     if (obj != _updatableObjectList.back())
     {
-        dynamic_cast<UpdatableMapObject*>(_updatableObjectList.back())->SetMapUpdateListOffset(mapUpdatableObject->GetMapUpdateListOffset());
-        std::swap(_updatableObjectList[mapUpdatableObject->GetMapUpdateListOffset()], _updatableObjectList.back());
+        std::size_t const offset = mapUpdatableObject->GetMapUpdateListOffset();
+        dynamic_cast<UpdatableMapObject*>(_updatableObjectList.back())->SetMapUpdateListOffset(offset);
+        std::swap(_updatableObjectList[offset], _updatableObjectList.back());
+        std::swap(_updatableObjectKinds[offset], _updatableObjectKinds.back());
+        std::swap(_updatableObjectWakeTimes[offset], _updatableObjectWakeTimes.back());
+        std::swap(_updatableObjectSleptDiffs[offset], _updatableObjectSleptDiffs.back());
     }
 
     _updatableObjectList.pop_back();
+    _updatableObjectKinds.pop_back();
+    _updatableObjectWakeTimes.pop_back();
+    _updatableObjectSleptDiffs.pop_back();
     mapUpdatableObject->SetUpdateState(UpdatableMapObject::UpdateState::NotUpdating);
 }
 
 void Map::RemoveObjectFromMapUpdateList(WorldObject* obj)
 {
+    std::unique_lock<std::recursive_mutex> guard = GetRegionUpdateGuard();
     if (!obj->CanBeAddedToMapUpdateList())
         return;
 
@@ -625,6 +1093,7 @@ void Map::AddWorldObjectToFarVisibleMap(WorldObject* obj)
         Cell curr_cell = creature->GetCurrentCell();
         MapGridType* grid = GetMapGrid(curr_cell.GridX(), curr_cell.GridY());
         grid->AddFarVisibleObject(curr_cell.CellX(), curr_cell.CellY(), creature);
+        AddToFarVisibleObjectIndex(creature, curr_cell);
     }
     else if (GameObject* go = obj->ToGameObject())
     {
@@ -634,6 +1103,7 @@ void Map::AddWorldObjectToFarVisibleMap(WorldObject* obj)
         Cell curr_cell = go->GetCurrentCell();
         MapGridType* grid = GetMapGrid(curr_cell.GridX(), curr_cell.GridY());
         grid->AddFarVisibleObject(curr_cell.CellX(), curr_cell.CellY(), go);
+        AddToFarVisibleObjectIndex(go, curr_cell);
     }
 }
 
@@ -643,16 +1113,36 @@ void Map::RemoveWorldObjectFromFarVisibleMap(WorldObject* obj)
     {
         Cell curr_cell = creature->GetCurrentCell();
         MapGridType* grid = GetMapGrid(curr_cell.GridX(), curr_cell.GridY());
-        grid->RemoveFarVisibleObject(curr_cell.CellX(), curr_cell.CellY(), creature);
+        if (grid->RemoveFarVisibleObject(curr_cell.CellX(), curr_cell.CellY(), creature))
+            RemoveFromFarVisibleObjectIndex(curr_cell);
     }
     else if (GameObject* go = obj->ToGameObject())
     {
         Cell curr_cell = go->GetCurrentCell();
         MapGridType* grid = GetMapGrid(curr_cell.GridX(), curr_cell.GridY());
-        grid->RemoveFarVisibleObject(curr_cell.CellX(), curr_cell.CellY(), go);
+        if (grid->RemoveFarVisibleObject(curr_cell.CellX(), curr_cell.CellY(), go))
+            RemoveFromFarVisibleObjectIndex(curr_cell);
     }
 }
 
+void Map::AddToFarVisibleObjectIndex(WorldObject const* obj, Cell const& cell)
+{
+    // game objects are seen up to the edge of their model, see GameObject::IsInRange
+    float extent = obj->GetObjectSize();
+    if (GameObject const* go = obj->ToGameObject())
+        if (GameObjectDisplayInfoEntry const* info = sGameObjectDisplayInfoStore.LookupEntry(go->GetGOInfo()->displayId))
+            extent = std::max({ extent, -info->minX, info->maxX, -info->minY, info->maxY }) * std::sqrt(2.0f) * go->GetObjectScale();
+
+    std::unique_lock<std::recursive_mutex> guard = GetRegionUpdateGuard();
+    _farVisibleObjectIndex.Add(cell.GetCellCoord(), obj->GetVisibilityOverrideDistance(), extent);
+}
+
+void Map::RemoveFromFarVisibleObjectIndex(Cell const& cell)
+{
+    std::unique_lock<std::recursive_mutex> guard = GetRegionUpdateGuard();
+    _farVisibleObjectIndex.Remove(cell.GetCellCoord());
+}
+
 // Used in VisibilityDistanceType::Infinite
 void Map::AddWorldObjectToZoneWideVisibleMap(uint32 zoneId, WorldObject* obj)
 {
@@ -677,6 +1167,12 @@ ZoneWideVisibleWorldObjectsSet const* Map::GetZoneWideVisibleWorldObjectsForZone
     return &itr->second;
 }
 
+void Map::AddObjectToDelayedVisibility(Unit* unit)
+{
+    std::unique_lock<std::recursive_mutex> guard = GetRegionUpdateGuard();
+    i_objectsForDelayedVisibility.insert(unit);
+}
+
 void Map::HandleDelayedVisibility()
 {
     if (i_objectsForDelayedVisibility.empty())
@@ -688,9 +1184,9 @@ void Map::HandleDelayedVisibility()
 
 struct ResetNotifier
 {
-    template<class T>inline void resetNotify(GridRefMgr<T>& m)
+    template<class T>inline void resetNotify(GridObjectVector<T>& m)
     {
-        for (typename GridRefMgr<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
+        for (typename GridObjectVector<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
             iter->GetSource()->ResetAllNotifies();
     }
     template<class T> void Visit(GridRefMgr<T>&) {}
@@ -701,6 +1197,7 @@ struct ResetNotifier
 void Map::RemovePlayerFromMap(Player* player, bool remove)
 {
     UpdatePlayerZoneStats(player->GetZoneId(), MAP_INVALID_ZONE);
+    _activeCells.Remove(player->GetGUID());
 
     player->getHostileRefMgr().deleteReferences(true); // pussywizard: multithreading crashfix
 
@@ -781,35 +1278,118 @@ void Map::RemoveFromMap(Transport* obj, bool remove)
     }
 }
 
-void Map::PlayerRelocation(Player* player, float x, float y, float z, float o)
+void Map::PlayerRelocation(Player* player, float x, float y, float z, float o, bool updateVisibility)
 {
     Cell old_cell(player->GetPositionX(), player->GetPositionY());
     Cell new_cell(x, y);
 
     if (old_cell.DiffGrid(new_cell) || old_cell.DiffCell(new_cell))
     {
+        updateVisibility = true;
+
         player->RemoveFromGrid();
 
         if (old_cell.DiffGrid(new_cell))
             EnsureGridLoaded(new_cell);
 
         AddToGrid(player, new_cell);
+
+        if (sGridTerrainPrefetcher->IsActive())
+            PrefetchGridsAhead(player, x, y);
     }
 
     player->Relocate(x, y, z, o);
+    player->UpdateGridPosition();
+    player->SetMoveVisibilityEpoch(_visibilityEpoch);
     if (player->IsVehicle())
         player->GetVehicleKit()->RelocatePassengers();
+
+    // capture points track the players in their radius from the movements of the zone players
+    if (!Instanceable())
+    {
+        if (OutdoorPvP* pvp = sOutdoorPvPMgr->GetOutdoorPvPToZoneId(player->GetZoneId()))
+            pvp->HandlePlayerRelocation(player);
+        else if (Battlefield* bf = sBattlefieldMgr->GetBattlefieldToZoneId(player->GetZoneId()))
+            bf->HandlePlayerRelocation(player);
+    }
+
+    if (!updateVisibility)
+    {
+        player->SetPositionDataUpdate();
+        return;
+    }
+
     player->UpdatePositionData();
     player->UpdateObjectVisibility(false);
 }
 
-void Map::CreatureRelocation(Creature* creature, float x, float y, float z, float o)
+void Map::PrefetchGridsAhead(Player* player, float x, float y)
+{
+    // Instances share the terrain of their parent, which is usually loaded already
+    if (GetInstanceId() != 0 || _mapGridManager.IsGridsFullyCreated())
+        return;
+
+    float lookAhead = float(sWorld->getIntConfig(CONFIG_GRID_PREFETCH_LOOKAHEAD));
+    if (player->IsInFlight() || player->IsFlying())
+        lookAhead *= player->GetSpeed(MOVE_FLIGHT);
+    else
+        lookAhead *= player->GetSpeed(player->IsWalking() ? MOVE_WALK : MOVE_RUN);
+
+    // Taxi paths are known ahead, follow the upcoming nodes
+    if (player->IsInFlight() && player->GetMotionMaster()->GetCurrentMovementGeneratorType() == FLIGHT_MOTION_TYPE)
+    {
+        if (FlightPathMovementGenerator* flight = dynamic_cast<FlightPathMovementGenerator*>(player->GetMotionMaster()->top()))
+        {
+            TaxiPathNodeList const& path = flight->GetPath();
+            float lastX = x;
+            float lastY = y;
+            for (uint32 i = flight->GetCurrentNode(); i < path.size() && lookAhead > 0.0f; ++i)
+            {
+                if (path[i]->mapid != GetId())
+                    break;
+
+                lookAhead -= std::hypot(path[i]->x - lastX, path[i]->y - lastY);
+                lastX = path[i]->x;
+                lastY = path[i]->y;
+                PrefetchGrid(lastX, lastY);
+            }
+            return;
+        }
+    }
+
+    // Otherwise extrapolate the last move, called before the player is relocated
+    float const dx = x - player->GetPositionX();
+    float const dy = y - player->GetPositionY();
+    float const distance = std::hypot(dx, dy);
+    if (distance < 0.1f)
+        return;
+
+    // Steps of half a grid never skip one
+    for (float step = SIZE_OF_GRIDS / 2; step <= lookAhead; step += SIZE_OF_GRIDS / 2)
+        PrefetchGrid(x + dx / distance * step, y + dy / distance * step);
+}
+
+void Map::PrefetchGrid(float x, float y)
+{
+    if (!Acore::IsValidMapCoord(x, y))
+        return;
+
+    Cell const cell(x, y);
+    if (IsGridCreated(GridCoord(cell.GridX(), cell.GridY())) || sGridTerrainDataStore->Contains(GetId(), cell.GridX(), cell.GridY()))
+        return;
+
+    sGridTerrainPrefetcher->Request(GetId(), cell.GridX(), cell.GridY(), VMAP::VMapFactory::createOrGetVMapMgr()->isMapLoadingEnabled(), DisableMgr::IsPathfindingEnabled(this));
+}
+
+void Map::CreatureRelocation(Creature* creature, float x, float y, float z, float o, bool updateVisibility)
 {
     Cell old_cell = creature->GetCurrentCell();
     Cell new_cell(x, y);
 
     if (old_cell.DiffGrid(new_cell) || old_cell.DiffCell(new_cell))
     {
+        updateVisibility = true;
+
         if (old_cell.DiffGrid(new_cell))
             EnsureGridLoaded(new_cell);
 
@@ -819,19 +1399,30 @@ void Map::CreatureRelocation(Creature* creature, float x, float y, float z, floa
         RemoveCreatureFromMoveList(creature);
 
     creature->Relocate(x, y, z, o);
+    creature->UpdateGridPosition();
+    creature->SetMoveVisibilityEpoch(_visibilityEpoch);
     if (creature->IsVehicle())
         creature->GetVehicleKit()->RelocatePassengers();
+
+    if (!updateVisibility)
+    {
+        creature->SetPositionDataUpdate();
+        return;
+    }
+
     creature->UpdatePositionData();
     creature->UpdateObjectVisibility(false);
 }
 
-void Map::GameObjectRelocation(GameObject* go, float x, float y, float z, float o)
+void Map::GameObjectRelocation(GameObject* go, float x, float y, float z, float o, bool updateVisibility)
 {
     Cell old_cell = go->GetCurrentCell();
     Cell new_cell(x, y);
 
     if (old_cell.DiffGrid(new_cell) || old_cell.DiffCell(new_cell))
     {
+        updateVisibility = true;
+
         if (old_cell.DiffGrid(new_cell))
             EnsureGridLoaded(new_cell);
 
@@ -841,18 +1432,23 @@ void Map::GameObjectRelocation(GameObject* go, float x, float y, float z, float
         RemoveGameObjectFromMoveList(go);
 
     go->Relocate(x, y, z, o);
+    go->UpdateGridPosition();
+    go->SetMoveVisibilityEpoch(_visibilityEpoch);
     go->UpdateModelPosition();
     go->SetPositionDataUpdate();
-    go->UpdateObjectVisibility(false);
+    if (updateVisibility)
+        go->UpdateObjectVisibility(false);
 }
 
-void Map::DynamicObjectRelocation(DynamicObject* dynObj, float x, float y, float z, float o)
+void Map::DynamicObjectRelocation(DynamicObject* dynObj, float x, float y, float z, float o, bool updateVisibility)
 {
     Cell old_cell = dynObj->GetCurrentCell();
     Cell new_cell(x, y);
 
     if (old_cell.DiffGrid(new_cell) || old_cell.DiffCell(new_cell))
     {
+        updateVisibility = true;
+
         if (old_cell.DiffGrid(new_cell))
             EnsureGridLoaded(new_cell);
 
@@ -862,12 +1458,16 @@ void Map::DynamicObjectRelocation(DynamicObject* dynObj, float x, float y, float
         RemoveDynamicObjectFromMoveList(dynObj);
 
     dynObj->Relocate(x, y, z, o);
+    dynObj->UpdateGridPosition();
+    dynObj->SetMoveVisibilityEpoch(_visibilityEpoch);
     dynObj->SetPositionDataUpdate();
-    dynObj->UpdateObjectVisibility(false);
+    if (updateVisibility)
+        dynObj->UpdateObjectVisibility(false);
 }
 
 void Map::AddCreatureToMoveList(Creature* c)
 {
+    std::unique_lock<std::recursive_mutex> guard = GetRegionUpdateGuard();
     if (c->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
         _creaturesToMove.push_back(c);
     c->_moveState = MAP_OBJECT_CELL_MOVE_ACTIVE;
@@ -875,12 +1475,14 @@ void Map::AddCreatureToMoveList(Creature* c)
 
 void Map::RemoveCreatureFromMoveList(Creature* c)
 {
+    std::unique_lock<std::recursive_mutex> guard = GetRegionUpdateGuard();
     if (c->_moveState == MAP_OBJECT_CELL_MOVE_ACTIVE)
         c->_moveState = MAP_OBJECT_CELL_MOVE_INACTIVE;
 }
 
 void Map::AddGameObjectToMoveList(GameObject* go)
 {
+    std::unique_lock<std::recursive_mutex> guard = GetRegionUpdateGuard();
     if (go->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
         _gameObjectsToMove.push_back(go);
     go->_moveState = MAP_OBJECT_CELL_MOVE_ACTIVE;
@@ -888,12 +1490,14 @@ void Map::AddGameObjectToMoveList(GameObject* go)
 
 void Map::RemoveGameObjectFromMoveList(GameObject* go)
 {
+    std::unique_lock<std::recursive_mutex> guard = GetRegionUpdateGuard();
     if (go->_moveState == MAP_OBJECT_CELL_MOVE_ACTIVE)
         go->_moveState = MAP_OBJECT_CELL_MOVE_INACTIVE;
 }
 
 void Map::AddDynamicObjectToMoveList(DynamicObject* dynObj)
 {
+    std::unique_lock<std::recursive_mutex> guard = GetRegionUpdateGuard();
     if (dynObj->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
         _dynamicObjectsToMove.push_back(dynObj);
     dynObj->_moveState = MAP_OBJECT_CELL_MOVE_ACTIVE;
@@ -901,6 +1505,7 @@ void Map::AddDynamicObjectToMoveList(DynamicObject* dynObj)
 
 void Map::RemoveDynamicObjectFromMoveList(DynamicObject* dynObj)
 {
+    std::unique_lock<std::recursive_mutex> guard = GetRegionUpdateGuard();
     if (dynObj->_moveState == MAP_OBJECT_CELL_MOVE_ACTIVE)
         dynObj->_moveState = MAP_OBJECT_CELL_MOVE_INACTIVE;
 }
@@ -1005,6 +1610,7 @@ void Map::MoveAllDynamicObjectsInMoveList()
 
 bool Map::UnloadGrid(MapGridType& grid)
 {
+    _farVisibleObjectIndex.RemoveGrid(grid.GetX(), grid.GetY());
     _mapGridManager.UnloadGrid(grid.GetX(), grid.GetY());
 
     ASSERT(i_objectsToRemove.empty());
@@ -1153,8 +1759,7 @@ float Map::GetHeight(float x, float y, float z, bool checkVMap /*= true*/, float
     float vmapHeight = VMAP_INVALID_HEIGHT_VALUE;
     if (checkVMap)
     {
-        VMAP::IVMapMgr* vmgr = VMAP::VMapFactory::createOrGetVMapMgr();
-        vmapHeight = vmgr->getHeight(GetId(), x, y, z, maxSearchDist);   // look from a bit higher pos to find the floor
+        vmapHeight = GetStaticHeight(x, y, z, maxSearchDist);   // look from a bit higher pos to find the floor
     }
 
     // mapHeight set for any above raw ground Z or <= INVALID_HEIGHT
@@ -1203,11 +1808,10 @@ static inline bool IsInWMOInterior(uint32 mogpFlags)
 bool Map::GetAreaInfo(uint32 phaseMask, float x, float y, float z, uint32& flags, int32& adtId, int32& rootId, int32& groupId) const
 {
     float check_z = z;
-    VMAP::IVMapMgr* vmgr = VMAP::VMapFactory::createOrGetVMapMgr();
     VMAP::AreaAndLiquidData vdata;
     VMAP::AreaAndLiquidData ddata;
 
-    bool hasVmapAreaInfo = vmgr->GetAreaAndLiquidData(GetId(), x, y, z, {}, vdata) && vdata.areaInfo.has_value();
+    bool hasVmapAreaInfo = GetStaticAreaAndLiquidData(x, y, z, {}, vdata) && vdata.areaInfo.has_value();
     bool hasDynamicAreaInfo = _dynamicTree.GetAreaAndLiquidData(x, y, z, phaseMask, {}, ddata) && ddata.areaInfo.has_value();
     auto useVmap = [&] { check_z = vdata.floorZ; groupId = vdata.areaInfo->groupId; adtId = vdata.areaInfo->adtId; rootId = vdata.areaInfo->rootId; flags = vdata.areaInfo->mogpFlags; };
     auto useDyn = [&] { check_z = ddata.floorZ; groupId = ddata.areaInfo->groupId; adtId = ddata.areaInfo->adtId; rootId = ddata.areaInfo->rootId; flags = ddata.areaInfo->mogpFlags; };
@@ -1299,10 +1903,9 @@ LiquidData const Map::GetLiquidData(uint32 phaseMask, float x, float y, float z,
    LiquidData liquidData;
    liquidData.Status = LIQUID_MAP_NO_WATER;
 
-    VMAP::IVMapMgr* vmgr = VMAP::VMapFactory::createOrGetVMapMgr();
     VMAP::AreaAndLiquidData vmapData;
     bool useGridLiquid = true;
-    if (vmgr->GetAreaAndLiquidData(GetId(), x, y, z, ReqLiquidType, vmapData) && vmapData.liquidInfo)
+    if (GetStaticAreaAndLiquidData(x, y, z, ReqLiquidType, vmapData) && vmapData.liquidInfo)
     {
         useGridLiquid = !vmapData.areaInfo || !IsInWMOInterior(vmapData.areaInfo->mogpFlags);
         LOG_DEBUG("maps", "GetLiquidStatus(): vmap liquid level: {} ground: {} type: {}", vmapData.liquidInfo->level, vmapData.floorZ, vmapData.liquidInfo->type);
@@ -1382,11 +1985,10 @@ void Map::GetFullTerrainStatusForPosition(uint32 /*phaseMask*/, float x, float y
 {
     GridTerrainData* gmap = GetGridTerrainData(x, y);
 
-    VMAP::IVMapMgr* vmgr = VMAP::VMapFactory::createOrGetVMapMgr();
     VMAP::AreaAndLiquidData vmapData;
     // VMAP::AreaAndLiquidData dynData;
     VMAP::AreaAndLiquidData* wmoData = nullptr;
-    vmgr->GetAreaAndLiquidData(GetId(), x, y, z, reqLiquidType, vmapData);
+    GetStaticAreaAndLiquidData(x, y, z, reqLiquidType, vmapData);
     // _dynamicTree.GetAreaAndLiquidData(x, y, z, phaseMask, reqLiquidType, dynData);
 
     uint32 gridAreaId = 0;
@@ -1547,7 +2149,7 @@ bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, floa
         }
     }
 
-    if ((checks & LINEOFSIGHT_CHECK_VMAP) && !VMAP::VMapFactory::createOrGetVMapMgr()->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2, ignoreFlags))
+    if ((checks & LINEOFSIGHT_CHECK_VMAP) && !IsInStaticLineOfSight(x1, y1, z1, x2, y2, z2, ignoreFlags))
     {
         return false;
     }
@@ -1569,6 +2171,99 @@ bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, floa
     return true;
 }
 
+bool Map::IsInStaticLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, VMAP::ModelIgnoreFlags ignoreFlags) const
+{
+    VMAP::IVMapMgr* vmgr = VMAP::VMapFactory::createOrGetVMapMgr();
+    if (!_vmapQueryCache)
+        return vmgr->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2, ignoreFlags);
+
+    uint32 generation = vmgr->GetTreeGeneration(GetId());
+    bool lineOfSight;
+    if (_vmapQueryCache->FindLineOfSight(generation, x1, y1, z1, x2, y2, z2, ignoreFlags, lineOfSight))
+        return lineOfSight;
+
+    lineOfSight = vmgr->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2, ignoreFlags);
+    _vmapQueryCache->StoreLineOfSight(generation, x1, y1, z1, x2, y2, z2, ignoreFlags, lineOfSight);
+    return lineOfSight;
+}
+
+float Map::GetStaticHeight(float x, float y, float z, float maxSearchDist) const
+{
+    VMAP::IVMapMgr* vmgr = VMAP::VMapFactory::createOrGetVMapMgr();
+    if (!_vmapQueryCache)
+        return vmgr->getHeight(GetId(), x, y, z, maxSearchDist);
+
+    uint32 generation = vmgr->GetTreeGeneration(GetId());
+    float height;
+    if (_vmapQueryCache->FindHeight(generation, x, y, z, maxSearchDist, height))
+        return height;
+
+    height = vmgr->getHeight(GetId(), x, y, z, maxSearchDist);
+    _vmapQueryCache->StoreHeight(generation, x, y, z, maxSearchDist, height);
+    return height;
+}
+
+bool Map::GetStaticAreaAndLiquidData(float x, float y, float z, Optional<uint8> reqLiquidType, VMAP::AreaAndLiquidData& data) const
+{
+    VMAP::IVMapMgr* vmgr = VMAP::VMapFactory::createOrGetVMapMgr();
+    if (!_vmapQueryCache)
+        return vmgr->GetAreaAndLiquidData(GetId(), x, y, z, reqLiquidType, data);
+
+    uint32 generation = vmgr->GetTreeGeneration(GetId());
+    bool found;
+    if (_vmapQueryCache->FindAreaAndLiquidData(generation, x, y, z, reqLiquidType, found, data))
+        return found;
+
+    found = vmgr->GetAreaAndLiquidData(GetId(), x, y, z, reqLiquidType, data);
+    _vmapQueryCache->StoreAreaAndLiquidData(generation, x, y, z, reqLiquidType, found, data);
+    return found;
+}
+
+void Map::isInLineOfSightBatch(std::span<std::pair<Position, Position> const> segments, std::vector<bool>& inLineOfSight, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
+{
+    inLineOfSight.assign(segments.size(), true);
+
+    if (!sWorld->getBoolConfig(CONFIG_VMAP_BLIZZLIKE_PVP_LOS))
+    {
+        if (IsBattlegroundOrArena())
+        {
+            ignoreFlags = VMAP::ModelIgnoreFlags::Nothing;
+        }
+    }
+
+    if (!sWorld->getBoolConfig(CONFIG_VMAP_BLIZZLIKE_LOS_OPEN_WORLD))
+    {
+        if (IsWorldMap())
+        {
+            ignoreFlags = VMAP::ModelIgnoreFlags::Nothing;
+        }
+    }
+
+    std::vector<std::pair<G3D::Vector3, G3D::Vector3>> points;
+    points.reserve(segments.size());
+    for (std::pair<Position, Position> const& segment : segments)
+    {
+        points.emplace_back(G3D::Vector3(segment.first.GetPositionX(), segment.first.GetPositionY(), segment.first.GetPositionZ()),
+            G3D::Vector3(segment.second.GetPositionX(), segment.second.GetPositionY(), segment.second.GetPositionZ()));
+    }
+
+    if (checks & LINEOFSIGHT_CHECK_VMAP)
+    {
+        VMAP::VMapFactory::createOrGetVMapMgr()->isInLineOfSightBatch(GetId(), points, inLineOfSight, ignoreFlags);
+    }
+
+    if (sWorld->getBoolConfig(CONFIG_CHECK_GOBJECT_LOS) && (checks & LINEOFSIGHT_CHECK_GOBJECT_ALL))
+    {
+        ignoreFlags = VMAP::ModelIgnoreFlags::Nothing;
+        if (!(checks & LINEOFSIGHT_CHECK_GOBJECT_M2))
+        {
+            ignoreFlags = VMAP::ModelIgnoreFlags::M2;
+        }
+
+        _dynamicTree.isInLineOfSightBatch(points, inLineOfSight, phasemask, ignoreFlags);
+    }
+}
+
 bool Map::GetObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist)
 {
     G3D::Vector3 startPos(x1, y1, z1);
@@ -1657,12 +2352,46 @@ void Map::SendInitSelf(Player* player)
     player->SendDirectMessage(&packet);
 }
 
+void Map::ScheduleCreatureRespawn(Creature* creature)
+{
+    std::unique_lock<std::recursive_mutex> guard = GetRegionUpdateGuard();
+    creature->SetRespawnScheduled(true);
+    _creatureRespawnQueue.push({ creature->GetRespawnTime(), creature->GetGUID() });
+}
+
+void Map::UpdateCreatureRespawnQueue()
+{
+    time_t const now = GameTime::GetGameTime().count();
+    while (!_creatureRespawnQueue.empty() && _creatureRespawnQueue.top().RespawnTime <= now)
+    {
+        ObjectGuid const guid = _creatureRespawnQueue.top().Guid;
+        _creatureRespawnQueue.pop();
+
+        Creature* creature = GetCreature(guid);
+        if (!creature || !creature->IsRespawnScheduled())
+            continue;
+
+        if (creature->GetRespawnTime() > now)
+        {
+            // respawn time moved further, wait for it
+            _creatureRespawnQueue.push({ creature->GetRespawnTime(), guid });
+            continue;
+        }
+
+        // puts it back on the update list, which schedules it again if the respawn is refused
+        creature->Respawn();
+    }
+}
+
 void Map::UpdateExpiredCorpses(uint32 const diff)
 {
     _corpseUpdateTimer.Update(diff);
     if (!_corpseUpdateTimer.Passed())
         return;
 
+    if (sWorldLoadGovernor.ShouldDefer(LoadSheddingWork::CorpseCleanup, Milliseconds(_corpseUpdateTimer.GetCurrent() - _corpseUpdateTimer.GetInterval())))
+        return;
+
     RemoveOldCorpses();
 
     _corpseUpdateTimer.Reset();
@@ -1708,23 +2437,31 @@ void Map::SendRemoveTransports(Player* player)
 
 void Map::SendObjectUpdates()
 {
-    UpdateDataMapType update_players;
-
     while (!_updateObjects.empty())
     {
         Object* obj = *_updateObjects.begin();
         ASSERT(obj->IsInWorld());
 
         _updateObjects.erase(_updateObjects.begin());
-        obj->BuildUpdate(update_players);
+        obj->BuildUpdate(_updatePlayers);
     }
 
     WorldPacket packet;                                     // here we allocate a std::vector with a size of 0x10000
-    for (UpdateDataMapType::iterator iter = update_players.begin(); iter != update_players.end(); ++iter)
+    for (auto iter = _updatePlayers.begin(); iter != _updatePlayers.end();)
     {
+        // Buffers of players that received nothing this tick are released, this also drops
+        // entries of players that left the map since their last update
+        if (!iter->second.HasData())
+        {
+            iter = _updatePlayers.erase(iter);
+            continue;
+        }
+
         iter->second.BuildPacket(packet);
         iter->first->SendDirectMessage(&packet);
         packet.clear();                                     // clean the string
+        iter->second.Clear();                               // keeps the allocated storage for the next tick
+        ++iter;
     }
 }
 
@@ -1786,6 +2523,7 @@ void Map::AddObjectToRemoveList(WorldObject* obj)
 
     obj->CleanupsBeforeDelete(false);                            // remove or simplify at least cross referenced links
 
+    std::unique_lock<std::recursive_mutex> guard = GetRegionUpdateGuard();
     i_objectsToRemove.insert(obj);
     //LOG_DEBUG("maps", "Object ({}) added to removing list.", obj->GetGUID().ToString());
 }
@@ -1846,6 +2584,37 @@ void Map::SendToPlayers(WorldPacket const* data) const
         itr->GetSource()->SendDirectMessage(data);
 }
 
+void Map::UpdateWorldState(uint32 variable, uint32 value)
+{
+    std::lock_guard<std::mutex> guard(_worldStateUpdateLock);
+    auto itr = std::find_if(_worldStateUpdates.begin(), _worldStateUpdates.end(), [variable](std::pair<uint32, uint32> const& update) { return update.first == variable; });
+    if (itr != _worldStateUpdates.end())
+        itr->second = value;
+    else
+        _worldStateUpdates.emplace_back(variable, value);
+}
+
+void Map::SendWorldStateUpdates()
+{
+    std::vector<std::pair<uint32, uint32>> updates;
+    {
+        std::lock_guard<std::mutex> guard(_worldStateUpdateLock);
+        updates.swap(_worldStateUpdates);
+    }
+
+    if (updates.empty() || !HavePlayers())
+        return;
+
+    // one packet per world state, shared by all players
+    for (auto const& [variable, value] : updates)
+    {
+        WorldPackets::WorldState::UpdateWorldState worldstate;
+        worldstate.VariableID = variable;
+        worldstate.Value = value;
+        SendToPlayers(worldstate.Write());
+    }
+}
+
 template bool Map::AddToMap(Corpse*, bool);
 template bool Map::AddToMap(Creature*, bool);
 template bool Map::AddToMap(GameObject*, bool);
@@ -2335,6 +3104,15 @@ void BattlegroundMap::RemovePlayerFromMap(Player* player, bool remove)
     Map::RemovePlayerFromMap(player, remove);
 }
 
+void BattlegroundMap::Update(const uint32 t_diff, const uint32 s_diff, bool /*thread*/)
+{
+    Map::Update(t_diff, s_diff);
+
+    // everything the spectators should see of this update was queued by now
+    if (m_bg)
+        m_bg->SendSpectatorMessages();
+}
+
 void BattlegroundMap::SetUnload()
 {
     m_unloadTimer = MIN_UNLOAD_DELAY;
@@ -2462,7 +3240,17 @@ void Map::LoadRespawnTimes()
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CREATURE_RESPAWNS);
     stmt->SetData(0, GetId());
     stmt->SetData(1, GetInstanceId());
-    if (PreparedQueryResult result = CharacterDatabase.Query(stmt))
+    PreparedQueryResult creatureRespawns = CharacterDatabase.Query(stmt);
+
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_GO_RESPAWNS);
+    stmt->SetData(0, GetId());
+    stmt->SetData(1, GetInstanceId());
+    LoadRespawnTimes(creatureRespawns, CharacterDatabase.Query(stmt));
+}
+
+void Map::LoadRespawnTimes(PreparedQueryResult creatureRespawns, PreparedQueryResult goRespawns)
+{
+    if (PreparedQueryResult result = creatureRespawns)
     {
         do
         {
@@ -2474,10 +3262,7 @@ void Map::LoadRespawnTimes()
         } while (result->NextRow());
     }
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_GO_RESPAWNS);
-    stmt->SetData(0, GetId());
-    stmt->SetData(1, GetInstanceId());
-    if (PreparedQueryResult result = CharacterDatabase.Query(stmt))
+    if (PreparedQueryResult result = goRespawns)
     {
         do
         {
@@ -2511,6 +3296,19 @@ void Map::DeleteRespawnTimesInDB(uint16 mapId, uint32 instanceId)
     CharacterDatabase.Execute(stmt);
 }
 
+void Map::DeleteRespawnTimesInDB(uint16 mapId, uint32 instanceId, CharacterDatabaseTransaction trans)
+{
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CREATURE_RESPAWN_BY_INSTANCE);
+    stmt->SetData(0, mapId);
+    stmt->SetData(1, instanceId);
+    trans->Append(stmt);
+
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GO_RESPAWN_BY_INSTANCE);
+    stmt->SetData(0, mapId);
+    stmt->SetData(1, instanceId);
+    trans->Append(stmt);
+}
+
 void Map::UpdateEncounterState(EncounterCreditType type, uint32 creditEntry, Unit* source)
 {
     Difficulty difficulty_fixed = (IsSharedDifficultyMap(GetId()) ? Difficulty(GetDifficulty() % 2) : GetDifficulty());
@@ -2763,7 +3561,7 @@ void Map::ScheduleCreatureRespawn(ObjectGuid creatureGuid, Milliseconds respawnT
 /// Send a packet to all players (or players selected team) in the zone (except self if mentioned)
 bool Map::SendZoneMessage(uint32 zone, WorldPacket const* packet, WorldSession const* self, TeamId teamId) const
 {
-    bool foundPlayerToSend = false;
+    SharedWorldPacket shared;
 
     for (MapReference const& ref : GetPlayers())
     {
@@ -2773,12 +3571,15 @@ bool Map::SendZoneMessage(uint32 zone, WorldPacket const* packet, WorldSession c
             player->GetSession() != self &&
             (teamId == TEAM_NEUTRAL || player->GetTeamId() == teamId))
         {
-            player->SendDirectMessage(packet);
-            foundPlayerToSend = true;
+            if (!shared)
+                shared = std::make_shared<WorldPacket const>(*packet);
+
+            player->GetSession()->SendSharedPacket(shared);
         }
     }
 
-    return foundPlayerToSend;
+    // the packet is only shared once a player is found
+    return shared != nullptr;
 }
 
 /// Send a System Message to all players in the zone (except self if mentioned)
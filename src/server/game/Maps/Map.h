@@ -18,28 +18,37 @@
 #ifndef ACORE_MAP_H
 #define ACORE_MAP_H
 
+#include "ActiveCellTracker.h"
 #include "Cell.h"
 #include "DBCStructure.h"
 #include "DataMap.h"
+#include "DatabaseEnvFwd.h"
 #include "Define.h"
 #include "DynamicTree.h"
 #include "EventProcessor.h"
+#include "FarVisibleObjectIndex.h"
 #include "GameObjectModel.h"
 #include "GridDefines.h"
 #include "GridRefMgr.h"
 #include "MapGridManager.h"
 #include "MapRefMgr.h"
+#include "MovementRelay.h"
 #include "ObjectDefines.h"
 #include "ObjectGuid.h"
 #include "PathGenerator.h"
 #include "Position.h"
 #include "SharedDefines.h"
 #include "Timer.h"
+#include "UpdateData.h"
 #include "GridTerrainData.h"
+#include <array>
 #include <bitset>
 #include <list>
 #include <memory>
+#include <mutex>
+#include <queue>
 #include <shared_mutex>
+#include <span>
 
 class Unit;
 class WorldPacket;
@@ -64,6 +73,9 @@ class StaticTransport;
 class MotionTransport;
 class PathGenerator;
 class WorldSession;
+class VMapQueryCache;
+class PathCache;
+class ChaseFlowFieldStore;
 
 enum WeatherState : uint32;
 
@@ -159,6 +171,21 @@ enum EncounterCreditType : uint8
     ENCOUNTER_CREDIT_CAST_SPELL     = 1,
 };
 
+// Phases of Map::Update timed while metrics are enabled
+enum MapUpdatePhase : uint8
+{
+    MAP_UPDATE_PHASE_SESSIONS,
+    MAP_UPDATE_PHASE_PLAYERS,
+    MAP_UPDATE_PHASE_NON_PLAYER_OBJECTS,
+    MAP_UPDATE_PHASE_SEND_OBJECT_UPDATES,
+    MAP_UPDATE_PHASE_SCRIPTS,
+    MAP_UPDATE_PHASE_MOVE_LISTS,
+    MAP_UPDATE_PHASE_DELAYED_VISIBILITY,
+    MAP_UPDATE_PHASE_SCRIPT_HOOKS,
+
+    MAX_MAP_UPDATE_PHASES
+};
+
 class Map : public GridRefMgr<MapGridType>
 {
     friend class MapReference;
@@ -188,20 +215,28 @@ public:
     template<class T> bool AddToMap(T*, bool checkTransport = false);
     template<class T> void RemoveFromMap(T*, bool);
 
-    void MarkNearbyCellsOf(WorldObject* obj);
+    // Moves the active cells around the player and its viewpoint with them
+    void UpdateActiveCellsOf(Player* player);
 
     virtual void Update(const uint32, const uint32, bool thread = true);
 
     [[nodiscard]] float GetVisibilityRange() const { return m_VisibleDistance; }
     void SetVisibilityRange(float range) { m_VisibleDistance = range; }
+    // Count of map updates, objects and player visibility passes tag their changes with it
+    [[nodiscard]] uint32 GetVisibilityEpoch() const { return _visibilityEpoch; }
+    // Movement heartbeats may be throttled for less interested players in crowds (Visibility.CrowdInterest.Maps)
+    [[nodiscard]] bool IsCrowdInterestMap() const { return _crowdInterestMap; }
+    // Batches the movement relayed while the sessions are updated, null when the map is not crowded enough
+    [[nodiscard]] MovementRelay* GetMovementRelay() { return _movementRelayActive ? &_movementRelay : nullptr; }
     void OnCreateMap();
     //function for setting up visibility distance for maps on per-type/per-Id basis
     virtual void InitVisibilityDistance();
 
-    void PlayerRelocation(Player*, float x, float y, float z, float o);
-    void CreatureRelocation(Creature* creature, float x, float y, float z, float o);
-    void GameObjectRelocation(GameObject* go, float x, float y, float z, float o);
-    void DynamicObjectRelocation(DynamicObject* go, float x, float y, float z, float o);
+    // updateVisibility false defers the visibility and terrain refresh of moves within a cell, for passengers of moving transports
+    void PlayerRelocation(Player*, float x, float y, float z, float o, bool updateVisibility = true);
+    void CreatureRelocation(Creature* creature, float x, float y, float z, float o, bool updateVisibility = true);
+    void GameObjectRelocation(GameObject* go, float x, float y, float z, float o, bool updateVisibility = true);
+    void DynamicObjectRelocation(DynamicObject* go, float x, float y, float z, float o, bool updateVisibility = true);
 
     template<class T, class CONTAINER> void Visit(const Cell& cell, TypeContainerVisitor<T, CONTAINER>& visitor);
 
@@ -235,6 +270,11 @@ public:
     // pussywizard:
     std::unordered_set<Unit*> i_objectsForDelayedVisibility;
     void HandleDelayedVisibility();
+    void AddObjectToDelayedVisibility(Unit* unit);
+
+    // Non player objects of crowded continents may be updated in parallel by
+    // spatially disjoint regions, see MapRegionUpdater
+    [[nodiscard]] bool IsRegionUpdateInProgress() const { return _regionUpdateInProgress; }
 
     // some calls like isInWater should not use vmaps due to processor power
     // can return INVALID_HEIGHT if under z+2 z coord not found height
@@ -313,15 +353,18 @@ public:
     void AddObjectToRemoveList(WorldObject* obj);
     virtual void DelayedUpdate(const uint32 diff);
 
-    void resetMarkedCells() { marked_cells.reset(); }
-    bool isCellMarked(uint32 pCellId) { return marked_cells.test(pCellId); }
-    void markCell(uint32 pCellId) { marked_cells.set(pCellId); }
+    bool isCellMarked(uint32 pCellId) const { return _activeCells.IsActive(pCellId); }
+    [[nodiscard]] uint32 GetActiveCellCount() const { return _activeCells.GetActiveCellCount(); }
 
     [[nodiscard]] bool HavePlayers() const { return !m_mapRefMgr.IsEmpty(); }
     [[nodiscard]] uint32 GetPlayersCountExceptGMs() const;
 
     void SendToPlayers(WorldPacket const* data) const;
 
+    // Queues a world state update for all players of the map, sent at the start of the next map update.
+    // Several changes of the same world state in between only send the last value.
+    void UpdateWorldState(uint32 variable, uint32 value);
+
     typedef MapRefMgr PlayerList;
     [[nodiscard]] PlayerList const& GetPlayers() const { return m_mapRefMgr; }
 
@@ -383,6 +426,8 @@ public:
     float GetWaterOrGroundLevel(uint32 phasemask, float x, float y, float z, float* ground = nullptr, bool swim = false, float collisionHeight = DEFAULT_COLLISION_HEIGHT) const;
     [[nodiscard]] float GetHeight(uint32 phasemask, float x, float y, float z, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
     [[nodiscard]] bool isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
+    /// isInLineOfSight for many segments (start, end) at once, clears inLineOfSight[i] if segment i is blocked
+    void isInLineOfSightBatch(std::span<std::pair<Position, Position> const> segments, std::vector<bool>& inLineOfSight, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, PathGenerator *path, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, float startX, float startY, float startZ, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
@@ -392,6 +437,8 @@ public:
     void InsertGameObjectModel(const GameObjectModel& model) { _dynamicTree.insert(model); }
     [[nodiscard]] bool ContainsGameObjectModel(const GameObjectModel& model) const { return _dynamicTree.contains(model);}
     [[nodiscard]] DynamicMapTree const& GetDynamicMapTree() const { return _dynamicTree; }
+    [[nodiscard]] PathCache* GetPathCache() const { return _pathCache.get(); }
+    [[nodiscard]] ChaseFlowFieldStore* GetChaseFlowFields() const { return _chaseFlowFields.get(); }
     bool GetObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist);
     [[nodiscard]] float GetGameObjectFloor(uint32 phasemask, float x, float y, float z, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const
     {
@@ -424,6 +471,7 @@ public:
     void SaveGORespawnTime(ObjectGuid::LowType dbGuid, time_t& respawnTime);
     void RemoveGORespawnTime(ObjectGuid::LowType dbGuid);
     void LoadRespawnTimes();
+    void LoadRespawnTimes(PreparedQueryResult creatureRespawns, PreparedQueryResult goRespawns);
     void DeleteRespawnTimes();
     [[nodiscard]] time_t GetInstanceResetPeriod() const { return _instanceResetPeriod; }
 
@@ -442,6 +490,7 @@ public:
     void RemoveOldCorpses();
 
     static void DeleteRespawnTimesInDB(uint16 mapId, uint32 instanceId);
+    static void DeleteRespawnTimesInDB(uint16 mapId, uint32 instanceId, CharacterDatabaseTransaction trans);
 
     bool SendZoneMessage(uint32 zone, WorldPacket const* packet, WorldSession const* self = nullptr, TeamId teamId = TEAM_NEUTRAL) const;
     void SendZoneText(uint32 zoneId, char const* text, WorldSession const* self = nullptr, TeamId teamId = TEAM_NEUTRAL) const;
@@ -485,15 +534,25 @@ public:
 
     void AddUpdateObject(Object* obj)
     {
+        std::unique_lock<std::recursive_mutex> guard = GetRegionUpdateGuard();
         _updateObjects.insert(obj);
     }
 
     void RemoveUpdateObject(Object* obj)
     {
+        std::unique_lock<std::recursive_mutex> guard = GetRegionUpdateGuard();
         _updateObjects.erase(obj);
     }
 
     size_t GetUpdatableObjectsCount() const { return _updatableObjectList.size(); }
+    // Objects of the update list skipped by the last update because they were sleeping
+    [[nodiscard]] uint32 GetSleptObjectsCount() const { return _lastUpdateSleptObjects; }
+
+    // MapUpdater scheduling: duration of the last Update() in microseconds
+    [[nodiscard]] virtual uint32 GetExpectedUpdateCost() const { return _lastUpdateCost; }
+    void SetLastUpdateCost(uint32 cost) { _lastUpdateCost = cost; }
+    [[nodiscard]] Optional<uint32> GetLastUpdateWorker() const { return _lastUpdateWorker; }
+    void SetLastUpdateWorker(uint32 worker) { _lastUpdateWorker = worker; }
 
     virtual std::string GetDebugInfo() const;
 
@@ -508,11 +567,32 @@ public:
     typedef std::vector<WorldObject*> UpdatableObjectList;
     typedef std::unordered_set<WorldObject*> PendingAddUpdatableObjectList;
 
+    // Hot data kept next to _updatableObjectList (same offsets), so the update loop
+    // can skip sleeping objects and pick the Update() to call without touching them
+    enum class UpdatableObjectKind : uint8
+    {
+        Generic,        // derived types overriding Update(), virtual dispatch
+        Creature,
+        GameObject,
+        DynamicObject
+    };
+
+    // Sleeping objects are not updated until wakeTime (GameTimeMS), the skipped diff
+    // is added to their first update once awake
+    void SetUpdatableObjectSleep(WorldObject* obj, uint32 wakeTime);
+    void WakeUpdatableObject(WorldObject* obj);
+
+    // Dead creatures waiting for their respawn leave the update list until the respawn
+    // queue calls Creature::Respawn() at their respawn time
+    void ScheduleCreatureRespawn(Creature* creature);
+
     void AddWorldObjectToFarVisibleMap(WorldObject* obj);
     void RemoveWorldObjectFromFarVisibleMap(WorldObject* obj);
     void AddWorldObjectToZoneWideVisibleMap(uint32 zoneId, WorldObject* obj);
     void RemoveWorldObjectFromZoneWideVisibleMap(uint32 zoneId, WorldObject* obj);
     ZoneWideVisibleWorldObjectsSet const* GetZoneWideVisibleWorldObjectsForZone(uint32 zoneId) const;
+    // Cells holding far visible objects, see Cell::VisitFarVisibleObjects
+    [[nodiscard]] FarVisibleObjectIndex const& GetFarVisibleObjectIndex() const { return _farVisibleObjectIndex; }
 
     [[nodiscard]] uint32 GetPlayerCountInZone(uint32 zoneId) const
     {
@@ -539,15 +619,27 @@ private:
     bool EnsureGridLoaded(Cell const& cell);
     MapGridType* GetMapGrid(uint16 const x, uint16 const y);
 
+    // queues the terrain of grids the player reaches within GridPrefetch.LookAhead seconds
+    void PrefetchGridsAhead(Player* player, float x, float y);
+    void PrefetchGrid(float x, float y);
+
     void ScriptsProcess();
 
     void SendObjectUpdates();
 
+    // static vmap queries, answered from _vmapQueryCache when enabled
+    [[nodiscard]] bool IsInStaticLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, VMAP::ModelIgnoreFlags ignoreFlags) const;
+    [[nodiscard]] float GetStaticHeight(float x, float y, float z, float maxSearchDist) const;
+    bool GetStaticAreaAndLiquidData(float x, float y, float z, Optional<uint8> reqLiquidType, VMAP::AreaAndLiquidData& data) const;
+
 protected:
     // Type specific code for add/remove to/from grid
     template<class T>
     void AddToGrid(T* object, Cell const& cell);
 
+    void AddToFarVisibleObjectIndex(WorldObject const* obj, Cell const& cell);
+    void RemoveFromFarVisibleObjectIndex(Cell const& cell);
+
     std::mutex Lock;
     std::shared_mutex MMapLock;
 
@@ -557,7 +649,14 @@ protected:
     uint32 i_InstanceId;
     uint32 m_unloadTimer;
     float m_VisibleDistance;
+    uint32 _visibilityEpoch;
+    bool _crowdInterestMap;
+    MovementRelay _movementRelay;
+    bool _movementRelayActive;
     DynamicMapTree _dynamicTree;
+    std::unique_ptr<VMapQueryCache> _vmapQueryCache;
+    std::unique_ptr<PathCache> _pathCache;
+    std::unique_ptr<ChaseFlowFieldStore> _chaseFlowFields;
     time_t _instanceResetPeriod; // pussywizard
 
     MapRefMgr m_mapRefMgr;
@@ -580,7 +679,7 @@ private:
     //InstanceMaps and BattlegroundMaps...
     Map* m_parentMap;
 
-    std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP * TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
+    ActiveCellTracker _activeCells;
 
     bool i_scriptLock;
     std::unordered_set<WorldObject*> i_objectsToRemove;
@@ -592,9 +691,40 @@ private:
     void DeleteFromWorld(T*);
 
     void UpdateNonPlayerObjects(uint32 const diff);
+    void PrepareSessionPackets();
+    void SendWorldStateUpdates();
+    void UpdateCreatureRespawnQueue();
+    void PrepareThreatLists();
+    void UpdateNonPlayerObjectsInRegions(uint32 const diff);
+
+    // Serializes mutations of map wide containers while regions are updated in parallel
+    std::unique_lock<std::recursive_mutex> GetRegionUpdateGuard();
+    std::recursive_mutex _regionUpdateLock;
+    bool _regionUpdateInProgress;
+
+    struct CreatureRespawnEntry
+    {
+        time_t RespawnTime;
+        ObjectGuid Guid;
+
+        bool operator>(CreatureRespawnEntry const& right) const { return RespawnTime > right.RespawnTime; }
+    };
+
+    // min heap on the respawn time, entries of creatures which respawned or left the map meanwhile are skipped
+    std::priority_queue<CreatureRespawnEntry, std::vector<CreatureRespawnEntry>, std::greater<CreatureRespawnEntry>> _creatureRespawnQueue;
+
+    std::mutex _worldStateUpdateLock;
+    std::vector<std::pair<uint32, uint32>> _worldStateUpdates; // variable, value in order of the first change
 
     void _AddObjectToUpdateList(WorldObject* obj);
     void _RemoveObjectFromUpdateList(WorldObject* obj);
+    // Returns false if the object at index was not updated (not in world or sleeping)
+    bool UpdateUpdatableObjectAt(std::size_t index, uint32 diff, uint32 now);
+    // Sleep accounting of the object at index, returns the diff to update it with or 0 if it sleeps
+    uint32 ConsumeUpdatableObjectDiff(std::size_t index, uint32 diff, uint32 now);
+    static void UpdateUpdatableObject(WorldObject* obj, UpdatableObjectKind kind, uint32 diff);
+    // Sleep time requested by the object after its update, 0 if none
+    static uint32 GetUpdatableObjectSleepTime(WorldObject* obj, UpdatableObjectKind kind);
 
     std::unordered_map<ObjectGuid::LowType /*dbGUID*/, time_t> _creatureRespawnTimes;
     std::unordered_map<ObjectGuid::LowType /*dbGUID*/, time_t> _goRespawnTimes;
@@ -626,11 +756,38 @@ private:
     std::unordered_set<Corpse*> _corpseBones;
 
     std::unordered_set<Object*> _updateObjects;
+    // Per player update buffers kept between ticks so their storage is reused, see SendObjectUpdates()
+    std::unordered_map<Player*, UpdateData> _updatePlayers;
 
     UpdatableObjectList _updatableObjectList;
+    std::vector<UpdatableObjectKind> _updatableObjectKinds;
+    std::vector<uint32> _updatableObjectWakeTimes;   // 0 when awake
+    std::vector<uint32> _updatableObjectSleptDiffs;
+    uint32 _sleptObjects;
+    uint32 _lastUpdateSleptObjects;
     PendingAddUpdatableObjectList _pendingAddUpdatableObjectList;
     IntervalTimer _updatableObjectListRecheckTimer;
     ZoneWideVisibleWorldObjectsMap _zoneWideVisibleWorldObjectsMap;
+    FarVisibleObjectIndex _farVisibleObjectIndex;
+
+    uint32 _lastUpdateCost;
+    Optional<uint32> _lastUpdateWorker;
+
+    // durations of the update phases since the last SendUpdatePhaseMetrics(), counted per bucket
+    static constexpr std::size_t UpdatePhaseBuckets = 10;
+    struct UpdatePhaseHistogram
+    {
+        std::array<uint32, UpdatePhaseBuckets> Buckets;
+        uint32 Max;
+        uint64 Total;
+    };
+
+    class UpdatePhaseTimer;
+
+    void SendUpdatePhaseMetrics();
+
+    std::array<UpdatePhaseHistogram, MAX_MAP_UPDATE_PHASES> _updatePhaseHistograms;
+    IntervalTimer _updatePhaseMetricsTimer;
 };
 
 enum InstanceResetMethod
@@ -688,6 +845,7 @@ public:
     void SetUnload();
     //void UnloadAll(bool pForce);
     void RemoveAllPlayers() override;
+    void Update(const uint32, const uint32, bool thread = true) override;
 
     void InitVisibilityDistance() override;
     Battleground* GetBG() { return m_bg; }
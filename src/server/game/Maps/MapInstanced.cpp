@@ -70,6 +70,15 @@ void MapInstanced::Update(const uint32 t, const uint32 s_diff, bool /*thread*/)
     }
 }
 
+uint32 MapInstanced::GetExpectedUpdateCost() const
+{
+    uint64 cost = Map::GetExpectedUpdateCost();
+    for (auto const& [instanceId, map] : m_InstancedMaps)
+        cost += map->GetExpectedUpdateCost();
+
+    return uint32(std::min<uint64>(cost, std::numeric_limits<uint32>::max()));
+}
+
 void MapInstanced::DelayedUpdate(const uint32 diff)
 {
     for (InstancedMaps::iterator i = m_InstancedMaps.begin(); i != m_InstancedMaps.end(); ++i)
@@ -205,8 +214,17 @@ InstanceMap* MapInstanced::CreateInstance(uint32 InstanceId, InstanceSave* save,
     ASSERT(map->IsDungeon());
     m_InstancedMaps[InstanceId] = map;
 
-    map->LoadRespawnTimes();
-    map->LoadCorpseData();
+    // a new instance has nothing saved, its id may still have rows of a former instance being deleted
+    if (save)
+    {
+        PreparedQueryResult creatureRespawns, goRespawns;
+        if (sMapMgr->TakeInstanceRespawnTimes(GetId(), InstanceId, creatureRespawns, goRespawns))
+            map->LoadRespawnTimes(creatureRespawns, goRespawns);
+        else
+            map->LoadRespawnTimes();
+
+        map->LoadCorpseData();
+    }
 
     if (save)
         map->CreateInstanceScript(true, save->GetInstanceData(), save->GetCompletedEncounterMask());
@@ -49,6 +49,9 @@ public:
     InstancedMaps& GetInstancedMaps() { return m_InstancedMaps; }
     void InitVisibilityDistance() override;
 
+    // instances are scheduled by this map, so account for them to start it early
+    [[nodiscard]] uint32 GetExpectedUpdateCost() const override;
+
 private:
     InstanceMap* CreateInstance(uint32 InstanceId, InstanceSave* save, Difficulty difficulty, Player* player);
     BattlegroundMap* CreateBattleground(uint32 InstanceId, Battleground* bg);
@@ -18,14 +18,20 @@
 #include "MapMgr.h"
 #include "Chat.h"
 #include "DatabaseEnv.h"
+#include "GameTime.h"
 #include "GridDefines.h"
+#include "GridObjectReclaimer.h"
+#include "GridTerrainDataStore.h"
 #include "GridTerrainLoader.h"
+#include "GridTerrainPrefetcher.h"
 #include "Group.h"
 #include "InstanceSaveMgr.h"
 #include "LFGMgr.h"
 #include "Language.h"
 #include "Log.h"
 #include "MapInstanced.h"
+#include "MapRegionUpdater.h"
+#include "Metric.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "Opcodes.h"
@@ -35,6 +41,17 @@
 #include "World.h"
 #include "WorldPacket.h"
 
+struct MapMgr::InstanceRespawnPrefetch
+{
+    InstanceRespawnPrefetch(uint32 mapId, QueryCallback&& creatureRespawns, QueryCallback&& goRespawns)
+        : MapId(mapId), IssueTime(GameTime::GetGameTime().count()), CreatureRespawns(std::move(creatureRespawns)), GoRespawns(std::move(goRespawns)) { }
+
+    uint32 MapId;
+    time_t IssueTime;
+    QueryCallback CreatureRespawns;
+    QueryCallback GoRespawns;
+};
+
 MapMgr::MapMgr()
 {
     i_timer[3].SetInterval(sWorld->getIntConfig(CONFIG_INTERVAL_MAPUPDATE));
@@ -59,6 +76,15 @@ void MapMgr::Initialize()
     // Start mtmaps if needed
     if (num_threads > 0)
         m_updater.activate(num_threads);
+
+    if (uint32 regionThreads = sWorld->getIntConfig(CONFIG_MAP_REGION_UPDATE_THREADS))
+        sMapRegionUpdater->Activate(regionThreads);
+
+    if (sWorld->getIntConfig(CONFIG_GRID_PREFETCH_LOOKAHEAD))
+        sGridTerrainPrefetcher->Activate(sWorld->GetDataPath());
+
+    if (uint32 reclaimPerTick = sWorld->getIntConfig(CONFIG_GRID_UNLOAD_RECLAIM_PER_TICK))
+        sGridObjectReclaimer->Activate(reclaimPerTick);
 }
 
 void MapMgr::InitializeVisibilityDistanceInfo()
@@ -247,7 +273,7 @@ Map::EnterState MapMgr::PlayerCannotEnter(uint32 mapid, Player* player, bool log
     return player->Satisfy(sObjectMgr->GetAccessRequirement(mapid, targetDifficulty), mapid, true) ? Map::CAN_ENTER : Map::CANNOT_ENTER_UNSPECIFIED_REASON;
 }
 
-void MapMgr::Update(uint32 diff)
+void MapMgr::Update(uint32 diff, std::function<void()> const& alongsideMaps)
 {
     for (uint8 i = 0; i < 4; ++i)
         i_timer[i].Update(diff);
@@ -276,7 +302,9 @@ void MapMgr::Update(uint32 diff)
     }
 
     if (m_updater.activated())
-        m_updater.wait();
+        m_updater.wait(alongsideMaps);
+    else if (alongsideMaps)
+        alongsideMaps();
 
     if (mapUpdateStep < 3)
     {
@@ -295,7 +323,20 @@ void MapMgr::Update(uint32 diff)
     {
         mapUpdateStep = 0;
         i_timer[3].SetCurrent(0);
+
+        uint32 terrainGrids, cachedTerrainGrids;
+        uint64 terrainMemory;
+        sGridTerrainDataStore->GetStats(terrainGrids, cachedTerrainGrids, terrainMemory);
+        METRIC_VALUE("grid_terrain_data_grids", uint64(terrainGrids));
+        METRIC_VALUE("grid_terrain_data_cached_grids", uint64(cachedTerrainGrids));
+        METRIC_VALUE("grid_terrain_data_memory", terrainMemory);
+
+        if (sGridObjectReclaimer->IsActive())
+            METRIC_VALUE("grid_reclaim_queued_objects", uint64(sGridObjectReclaimer->GetQueuedCount()));
     }
+
+    if (sGridObjectReclaimer->IsActive())
+        sGridObjectReclaimer->Update();
 }
 
 void MapMgr::DoDelayedMovesAndRemoves()
@@ -335,6 +376,15 @@ void MapMgr::UnloadAll()
 
     if (m_updater.activated())
         m_updater.deactivate();
+
+    if (sMapRegionUpdater->IsActive())
+        sMapRegionUpdater->Deactivate();
+
+    if (sGridTerrainPrefetcher->IsActive())
+        sGridTerrainPrefetcher->Deactivate();
+
+    if (sGridObjectReclaimer->IsActive())
+        sGridObjectReclaimer->Deactivate();
 }
 
 void MapMgr::GetNumInstances(uint32& dungeons, uint32& battlegrounds, uint32& arenas)
@@ -418,3 +468,64 @@ uint32 MapMgr::GenerateInstanceId()
 
     return newInstanceId;
 }
+
+void MapMgr::PrefetchInstanceRespawnTimes(uint32 mapId, Player* player)
+{
+    MapEntry const* entry = sMapStore.LookupEntry(mapId);
+    if (!entry || !entry->IsDungeon())
+        return;
+
+    // new instances get their id on creation and have nothing saved
+    uint32 const instanceId = sInstanceSaveMgr->PlayerGetDestinationInstanceId(player, mapId, player->GetDifficulty(entry->IsRaid()));
+    if (!instanceId || FindMap(mapId, instanceId))
+        return;
+
+    std::lock_guard<std::mutex> guard(_instancePrefetchLock);
+
+    // not taken, the player did not finish the teleport or went to another instance
+    time_t const now = GameTime::GetGameTime().count();
+    for (auto itr = _instancePrefetches.begin(); itr != _instancePrefetches.end();)
+    {
+        if (itr->second->IssueTime + 2 * MINUTE < now)
+            itr = _instancePrefetches.erase(itr);
+        else
+            ++itr;
+    }
+
+    if (_instancePrefetches.count(instanceId))
+        return;
+
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CREATURE_RESPAWNS);
+    stmt->SetData(0, mapId);
+    stmt->SetData(1, instanceId);
+    QueryCallback creatureRespawns = CharacterDatabase.AsyncQuery(stmt);
+
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_GO_RESPAWNS);
+    stmt->SetData(0, mapId);
+    stmt->SetData(1, instanceId);
+    QueryCallback goRespawns = CharacterDatabase.AsyncQuery(stmt);
+
+    _instancePrefetches[instanceId] = std::make_unique<InstanceRespawnPrefetch>(mapId, std::move(creatureRespawns), std::move(goRespawns));
+}
+
+bool MapMgr::TakeInstanceRespawnTimes(uint32 mapId, uint32 instanceId, PreparedQueryResult& creatureRespawns, PreparedQueryResult& goRespawns)
+{
+    std::unique_ptr<InstanceRespawnPrefetch> prefetch;
+    {
+        std::lock_guard<std::mutex> guard(_instancePrefetchLock);
+        auto itr = _instancePrefetches.find(instanceId);
+        if (itr == _instancePrefetches.end())
+            return false;
+
+        prefetch = std::move(itr->second);
+        _instancePrefetches.erase(itr);
+    }
+
+    if (prefetch->MapId != mapId)
+        return false;
+
+    // usually done long ago, the client takes longer to load the map
+    creatureRespawns = prefetch->CreatureRespawns.GetPreparedResult();
+    goRespawns = prefetch->GoRespawns.GetPreparedResult();
+    return true;
+}
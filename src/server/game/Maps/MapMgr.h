@@ -19,12 +19,14 @@
 #define ACORE_MAPMANAGER_H
 
 #include "Common.h"
+#include "DatabaseEnvFwd.h"
 #include "Define.h"
 #include "Map.h"
 #include "MapInstanced.h"
 #include "MapUpdater.h"
 #include "Object.h"
 #include "Timer.h"
+#include <functional>
 
 class Transport;
 class StaticTransport;
@@ -70,7 +72,8 @@ public:
     }
 
     void Initialize(void);
-    void Update(uint32);
+    // alongsideMaps runs on the calling thread while the map updater works, after the maps when there are no workers
+    void Update(uint32 diff, std::function<void()> const& alongsideMaps = nullptr);
 
     void SetMapUpdateInterval(uint32 t)
     {
@@ -150,6 +153,11 @@ public:
     void RegisterInstanceId(uint32 instanceId);
     uint32 GenerateInstanceId();
 
+    // Far teleports into a saved instance which is not loaded query its respawn times while the
+    // client loads the map, CreateInstance then takes them instead of querying them itself
+    void PrefetchInstanceRespawnTimes(uint32 mapId, Player* player);
+    bool TakeInstanceRespawnTimes(uint32 mapId, uint32 instanceId, PreparedQueryResult& creatureRespawns, PreparedQueryResult& goRespawns);
+
     MapUpdater* GetMapUpdater() { return &m_updater; }
 
     template<typename Worker>
@@ -176,6 +184,10 @@ private:
     InstanceIds _instanceIds;
     uint32 _nextInstanceId;
     MapUpdater m_updater;
+
+    struct InstanceRespawnPrefetch;
+    std::mutex _instancePrefetchLock;
+    std::unordered_map<uint32 /*instanceId*/, std::unique_ptr<InstanceRespawnPrefetch>> _instancePrefetches;
 };
 
 template<typename Worker>
@@ -0,0 +1,127 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MapRegionUpdater.h"
+#include "Config.h"
+#include "DatabaseEnv.h"
+#include "GridDefines.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+struct MapRegionUpdater::Batch
+{
+    explicit Batch(std::vector<std::function<void()>> const& jobs) : Jobs(jobs), JobCount(jobs.size()), NextJob(0), RemainingJobs(jobs.size()) { }
+
+    // Only valid while the owning Execute() call waits, workers picking the
+    // batch late only look at the counters
+    std::vector<std::function<void()>> const& Jobs;
+    std::size_t const JobCount;
+    std::atomic<std::size_t> NextJob;
+    std::atomic<std::size_t> RemainingJobs;
+    std::mutex Lock;
+    std::condition_variable Condition;
+};
+
+MapRegionUpdater* MapRegionUpdater::instance()
+{
+    static MapRegionUpdater instance;
+    return &instance;
+}
+
+void MapRegionUpdater::Activate(std::size_t numThreads)
+{
+    _workerThreads.reserve(numThreads);
+    for (std::size_t i = 0; i < numThreads; ++i)
+        _workerThreads.push_back(std::thread(&MapRegionUpdater::WorkerThread, this));
+}
+
+void MapRegionUpdater::Deactivate()
+{
+    _queue.Cancel();
+
+    for (auto& thread : _workerThreads)
+        if (thread.joinable())
+            thread.join();
+
+    _workerThreads.clear();
+}
+
+void MapRegionUpdater::Execute(std::vector<std::function<void()>> const& jobs)
+{
+    if (jobs.empty())
+        return;
+
+    if (jobs.size() == 1 || !IsActive())
+    {
+        for (auto const& job : jobs)
+            job();
+        return;
+    }
+
+    std::shared_ptr<Batch> batch = std::make_shared<Batch>(jobs);
+
+    // Idle workers join the batch, busy ones find it already done
+    std::size_t const helpers = std::min(jobs.size() - 1, _workerThreads.size());
+    for (std::size_t i = 0; i < helpers; ++i)
+        _queue.Push(batch);
+
+    RunJobs(*batch);
+
+    std::unique_lock<std::mutex> guard(batch->Lock);
+    batch->Condition.wait(guard, [&batch] { return batch->RemainingJobs.load(std::memory_order_acquire) == 0; });
+}
+
+void MapRegionUpdater::RunJobs(Batch& batch)
+{
+    std::size_t index;
+    while ((index = batch.NextJob.fetch_add(1, std::memory_order_relaxed)) < batch.JobCount)
+    {
+        batch.Jobs[index]();
+
+        if (batch.RemainingJobs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            std::lock_guard<std::mutex> guard(batch.Lock);
+            batch.Condition.notify_all();
+        }
+    }
+}
+
+void MapRegionUpdater::WorkerThread()
+{
+    LoginDatabase.WarnAboutSyncQueries(true);
+    CharacterDatabase.WarnAboutSyncQueries(true);
+    WorldDatabase.WarnAboutSyncQueries(true);
+    sConfigMgr->WarnAboutRuntimeLookups(true);
+
+    while (true)
+    {
+        std::shared_ptr<Batch> batch;
+
+        _queue.WaitAndPop(batch);
+
+        if (!batch)
+            break;
+
+        RunJobs(*batch);
+    }
+}
+
+uint32 MapRegionUpdater::GetRegionSizeInGrids(float visibilityRange)
+{
+    return std::max<uint32>(1, uint32(std::ceil(visibilityRange / SIZE_OF_GRIDS)));
+}
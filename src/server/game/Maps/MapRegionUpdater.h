@@ -0,0 +1,75 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MAP_REGION_UPDATER_H_INCLUDED
+#define _MAP_REGION_UPDATER_H_INCLUDED
+
+#include "Define.h"
+#include "PCQueue.h"
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/*
+ * Worker pool used by continents to update the non player objects of
+ * spatially disjoint regions in parallel (MapUpdate.Regions.Threads).
+ *
+ * Regions are squares of grids larger than the visibility range. They are
+ * split into REGION_PHASE_COUNT checkerboard phases so that two regions
+ * updated at the same time never share a visible object. Map wide
+ * containers (move lists, update lists, delayed visibility...) are
+ * serialized by the map while a phase runs, cross region relocations and
+ * visibility updates are merged afterwards by the usual serial passes.
+ *
+ * The same pool prepares the session packets of crowded maps
+ * (MapUpdate.Sessions.MinPlayers), sorts the threat lists of large
+ * fights (MapUpdate.Threat.MinCreatures) and handles the session safe
+ * packets of the world session update (SessionUpdate.Parallel.MinSessions).
+ */
+class MapRegionUpdater
+{
+public:
+    static constexpr uint32 REGION_PHASE_COUNT = 4;
+
+    MapRegionUpdater() = default;
+    ~MapRegionUpdater() = default;
+
+    static MapRegionUpdater* instance();
+
+    void Activate(std::size_t numThreads);
+    void Deactivate();
+    [[nodiscard]] bool IsActive() const { return !_workerThreads.empty(); }
+
+    // Runs all jobs, the calling thread takes part and returns once every job is done
+    void Execute(std::vector<std::function<void()>> const& jobs);
+
+    [[nodiscard]] static uint32 GetRegionSizeInGrids(float visibilityRange);
+
+private:
+    struct Batch;
+
+    void WorkerThread();
+    static void RunJobs(Batch& batch);
+
+    ProducerConsumerQueue<std::shared_ptr<Batch>> _queue;
+    std::vector<std::thread> _workerThreads;
+};
+
+#define sMapRegionUpdater MapRegionUpdater::instance()
+
+#endif //_MAP_REGION_UPDATER_H_INCLUDED
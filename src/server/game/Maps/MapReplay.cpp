@@ -0,0 +1,476 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MapReplay.h"
+#include "DBCStores.h"
+#include "Log.h"
+#include "Map.h"
+#include "MapMgr.h"
+#include "Player.h"
+#include "Random.h"
+#include "World.h"
+#include "WorldPacket.h"
+#include "WorldSession.h"
+#include "WorldSessionMgr.h"
+#include <algorithm>
+#include <cstdio>
+#include <thread>
+
+namespace
+{
+    enum MapReplayRecord : uint8
+    {
+        MAP_REPLAY_TICK         = 0,    // uint32 diff, uint32 world seed
+        MAP_REPLAY_MAP_UPDATE   = 1,    // uint32 seed
+        MAP_REPLAY_JOIN         = 2,    // uint32 account, string name, uint8 security, uint8 expansion, uint8 locale, guid
+        MAP_REPLAY_LEAVE        = 3,    // uint32 account
+        MAP_REPLAY_PACKET       = 4     // uint32 account, uint16 opcode, uint32 size, data
+    };
+
+    constexpr uint32 MapReplayMagic = 0x524D4341; // "ACMR"
+    constexpr uint32 MapReplayVersion = 1;
+    constexpr Seconds MapReplayLoginTimeout = 30s;
+
+    uint32 GetPercentile(std::vector<uint32> const& sorted, uint32 percent)
+    {
+        return sorted[std::min<std::size_t>(sorted.size() * percent / 100, sorted.size() - 1)];
+    }
+}
+
+struct MapReplay::ReplayTick
+{
+    struct Join
+    {
+        uint32 AccountId;
+        std::string Name;
+        uint8 Security;
+        uint8 Expansion;
+        uint8 Locale;
+        ObjectGuid Guid;
+    };
+
+    struct Packet
+    {
+        uint32 AccountId;
+        uint16 Opcode;
+        std::vector<uint8> Data;
+    };
+
+    uint32 Diff = 0;
+    uint32 WorldSeed = 0;
+    Optional<uint32> MapSeed;
+    std::vector<Join> Joins;
+    std::vector<uint32> Leaves;
+    std::vector<Packet> Packets;
+};
+
+MapReplay* MapReplay::instance()
+{
+    static MapReplay instance;
+    return &instance;
+}
+
+bool MapReplay::StartRecording(uint32 mapId, Milliseconds duration, std::string fileName)
+{
+    MapEntry const* entry = sMapStore.LookupEntry(mapId);
+    if (!entry || entry->Instanceable() || _replaying)
+        return false;
+
+    std::lock_guard<std::mutex> guard(_recordLock);
+    if (_recordFile)
+        return false;
+
+    _recordFile = fopen(fileName.c_str(), "wb");
+    if (!_recordFile)
+        return false;
+
+    // the recording itself starts with the next world update
+    _mapId = mapId;
+    _recordTimeLeft = duration;
+    _recordedAccounts.clear();
+    _recordBuffer.clear();
+    _recordBuffer << uint32(MapReplayMagic) << uint32(MapReplayVersion) << uint32(mapId);
+    return true;
+}
+
+bool MapReplay::StopRecording()
+{
+    std::lock_guard<std::mutex> guard(_recordLock);
+    if (!_recordFile)
+        return false;
+
+    _recording.store(false, std::memory_order_relaxed);
+    if (!_recordBuffer.empty())
+        fwrite(_recordBuffer.contents(), 1, _recordBuffer.size(), _recordFile);
+
+    fclose(_recordFile);
+    _recordFile = nullptr;
+    _recordBuffer.clear();
+    _recordedAccounts.clear();
+    return true;
+}
+
+void MapReplay::OnWorldUpdate(uint32 diff)
+{
+    if (_replaying)
+    {
+        if (_pendingWorldSeed)
+            SetRandomSeed(*_pendingWorldSeed);
+
+        _pendingWorldSeed.reset();
+        return;
+    }
+
+    if (!_recordFile)
+        return;
+
+    if (IsRecording())
+    {
+        _recordTimeLeft -= Milliseconds(diff);
+        if (_recordTimeLeft <= 0ms)
+        {
+            StopRecording();
+            LOG_INFO("maps.replay", "Recording of map {} ended.", _mapId);
+            return;
+        }
+    }
+    else
+        _recording.store(true, std::memory_order_relaxed);
+
+    uint32 const seed = rand32();
+    SetRandomSeed(seed);
+
+    {
+        std::lock_guard<std::mutex> guard(_recordLock);
+        _recordBuffer << uint8(MAP_REPLAY_TICK) << uint32(diff) << uint32(seed);
+    }
+
+    // the maps don't update yet, their players can be walked
+    RecordJoinsAndLeaves(sMapMgr->FindBaseNonInstanceMap(_mapId));
+    FlushRecording();
+}
+
+void MapReplay::RecordPacket(WorldSession const* session, WorldPacket const& packet)
+{
+    std::lock_guard<std::mutex> guard(_recordLock);
+    if (!_recordFile || !_recordedAccounts.count(session->GetAccountId()))
+        return;
+
+    _recordBuffer << uint8(MAP_REPLAY_PACKET) << uint32(session->GetAccountId()) << uint16(packet.GetOpcode()) << uint32(packet.size());
+    if (!packet.empty())
+        _recordBuffer.append(packet.contents(), packet.size());
+}
+
+bool MapReplay::IsRecordedMap(Map const* map) const
+{
+    return map->GetId() == _mapId && !map->Instanceable();
+}
+
+void MapReplay::RecordJoinsAndLeaves(Map* map)
+{
+    std::unordered_set<uint32> accounts;
+
+    std::lock_guard<std::mutex> guard(_recordLock);
+    if (map)
+    {
+        for (Map::PlayerList::const_iterator itr = map->GetPlayers().begin(); itr != map->GetPlayers().end(); ++itr)
+        {
+            Player* player = itr->GetSource();
+            if (!player || !player->IsInWorld())
+                continue;
+
+            WorldSession* session = player->GetSession();
+            accounts.insert(session->GetAccountId());
+            if (_recordedAccounts.count(session->GetAccountId()))
+                continue;
+
+            // the replay loads the character from the database
+            player->SaveToDB(false, false);
+            _recordBuffer << uint8(MAP_REPLAY_JOIN) << uint32(session->GetAccountId()) << session->GetAccountName();
+            _recordBuffer << uint8(session->GetSecurity()) << uint8(session->Expansion()) << uint8(session->GetSessionDbcLocale());
+            _recordBuffer << player->GetGUID();
+        }
+    }
+
+    for (uint32 accountId : _recordedAccounts)
+        if (!accounts.count(accountId))
+            _recordBuffer << uint8(MAP_REPLAY_LEAVE) << uint32(accountId);
+
+    _recordedAccounts = std::move(accounts);
+}
+
+void MapReplay::FlushRecording()
+{
+    std::lock_guard<std::mutex> guard(_recordLock);
+    if (!_recordFile || _recordBuffer.empty())
+        return;
+
+    fwrite(_recordBuffer.contents(), 1, _recordBuffer.size(), _recordFile);
+    _recordBuffer.clear();
+}
+
+bool MapReplay::Replay(std::string const& fileName, std::string const& reportFileName)
+{
+    if (_recordFile)
+    {
+        LOG_ERROR("maps.replay", "Can't replay while recording.");
+        return false;
+    }
+
+    FILE* file = fopen(fileName.c_str(), "rb");
+    if (!file)
+    {
+        LOG_ERROR("maps.replay", "Can't open the map replay {}.", fileName);
+        return false;
+    }
+
+    // the whole recording is read first, the replay doesn't wait for the disk
+    ByteBuffer data;
+    uint8 chunk[64 * 1024];
+    for (std::size_t read; (read = fread(chunk, 1, sizeof(chunk), file)) > 0;)
+        data.append(chunk, read);
+
+    fclose(file);
+
+    std::vector<ReplayTick> ticks;
+    try
+    {
+        if (data.read<uint32>() != MapReplayMagic || data.read<uint32>() != MapReplayVersion)
+        {
+            LOG_ERROR("maps.replay", "{} is not a map replay of this version.", fileName);
+            return false;
+        }
+
+        data >> _mapId;
+        while (data.rpos() < data.size())
+        {
+            uint8 const type = data.read<uint8>();
+            if (type == MAP_REPLAY_TICK)
+            {
+                ReplayTick& tick = ticks.emplace_back();
+                data >> tick.Diff >> tick.WorldSeed;
+                continue;
+            }
+
+            // nothing is recorded before the first tick
+            if (ticks.empty())
+                break;
+
+            ReplayTick& tick = ticks.back();
+            switch (type)
+            {
+                case MAP_REPLAY_MAP_UPDATE:
+                    tick.MapSeed = data.read<uint32>();
+                    break;
+                case MAP_REPLAY_JOIN:
+                {
+                    ReplayTick::Join& join = tick.Joins.emplace_back();
+                    data >> join.AccountId >> join.Name >> join.Security >> join.Expansion >> join.Locale >> join.Guid;
+                    break;
+                }
+                case MAP_REPLAY_LEAVE:
+                    tick.Leaves.push_back(data.read<uint32>());
+                    break;
+                case MAP_REPLAY_PACKET:
+                {
+                    ReplayTick::Packet& packet = tick.Packets.emplace_back();
+                    packet.AccountId = data.read<uint32>();
+                    packet.Opcode = data.read<uint16>();
+                    packet.Data.resize(data.read<uint32>());
+                    if (!packet.Data.empty())
+                        data.read(packet.Data.data(), packet.Data.size());
+                    break;
+                }
+                default:
+                    LOG_ERROR("maps.replay", "Unknown record {} in {}.", type, fileName);
+                    return false;
+            }
+        }
+    }
+    catch (ByteBufferException const&)
+    {
+        // the server stopped while recording, the last tick may be incomplete
+        if (!ticks.empty())
+            ticks.pop_back();
+    }
+
+    LOG_INFO("server.worldserver", "Replaying {} updates of map {} from {}...", ticks.size(), _mapId, fileName);
+
+    _replaying = true;
+
+    std::vector<uint32> worldUpdateTimes;
+    std::vector<uint32> tickDiffs;
+    _mapUpdateTimes.clear();
+    _mapUpdateTimes.reserve(ticks.size());
+    worldUpdateTimes.reserve(ticks.size());
+    tickDiffs.reserve(ticks.size());
+
+    for (ReplayTick const& tick : ticks)
+    {
+        if (World::IsStopped() || !ReplayTickData(tick))
+            break;
+
+        _pendingWorldSeed = tick.WorldSeed;
+        _pendingMapSeed = tick.MapSeed;
+        _tickMapUpdateTime = 0;
+
+        TimePoint const start = std::chrono::steady_clock::now();
+        sWorld->Update(tick.Diff);
+        ++World::m_worldLoopCounter;
+
+        worldUpdateTimes.push_back(uint32(std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - start).count()));
+        _mapUpdateTimes.push_back(_tickMapUpdateTime);
+        tickDiffs.push_back(tick.Diff);
+    }
+
+    for (auto const& [accountId, session] : sWorldSessionMgr->GetAllSessions())
+        if (session->IsReplayed())
+            session->KickPlayer("Map replay ended");
+
+    _replaying = false;
+    _pendingWorldSeed.reset();
+    _pendingMapSeed.reset();
+
+    if (!reportFileName.empty())
+    {
+        if (FILE* report = fopen(reportFileName.c_str(), "w"))
+        {
+            fprintf(report, "tick,diff_ms,map_update_us,world_update_us\n");
+            for (std::size_t i = 0; i < _mapUpdateTimes.size(); ++i)
+                fprintf(report, "%u,%u,%u,%u\n", uint32(i), tickDiffs[i], _mapUpdateTimes[i], worldUpdateTimes[i]);
+
+            fclose(report);
+        }
+        else
+            LOG_ERROR("maps.replay", "Can't write the replay report {}.", reportFileName);
+    }
+
+    if (_mapUpdateTimes.empty())
+    {
+        LOG_INFO("server.worldserver", "Nothing was replayed.");
+        return true;
+    }
+
+    for (std::vector<uint32>* times : { &_mapUpdateTimes, &worldUpdateTimes })
+    {
+        std::vector<uint32> sorted = *times;
+        std::sort(sorted.begin(), sorted.end());
+        uint64 total = 0;
+        for (uint32 time : sorted)
+            total += time;
+
+        LOG_INFO("server.worldserver", "{} of {} ticks: mean {}us, median {}us, p95 {}us, p99 {}us, max {}us",
+            times == &_mapUpdateTimes ? "Map::Update" : "World::Update", sorted.size(), total / sorted.size(),
+            GetPercentile(sorted, 50), GetPercentile(sorted, 95), GetPercentile(sorted, 99), sorted.back());
+    }
+
+    return true;
+}
+
+bool MapReplay::ReplayTickData(ReplayTick const& tick)
+{
+    for (uint32 accountId : tick.Leaves)
+        if (WorldSession* session = sWorldSessionMgr->FindSession(accountId))
+            if (session->IsReplayed())
+                session->KickPlayer("Left the replayed map");
+
+    // logins are asynchronous, the replay waits for them between two recorded updates
+    std::vector<std::pair<uint32, WorldSession*>> joining;
+    for (ReplayTick::Join const& join : tick.Joins)
+    {
+        WorldSession* session = new WorldSession(join.AccountId, std::string(join.Name), 0, nullptr, AccountTypes(join.Security), join.Expansion,
+            0, LocaleConstant(join.Locale), 0, false, true, 0);
+        session->SetReplayed(join.Guid);
+
+        WorldPacket* login = new WorldPacket(CMSG_PLAYER_LOGIN, 8);
+        *login << join.Guid;
+        session->QueuePacket(login);
+
+        sWorldSessionMgr->AddSession(session);
+        joining.emplace_back(join.AccountId, session);
+    }
+
+    TimePoint const timeout = std::chrono::steady_clock::now() + MapReplayLoginTimeout;
+    while (!joining.empty())
+    {
+        sWorld->Update(0);
+        ++World::m_worldLoopCounter;
+
+        // refused sessions are deleted by the session updates, only the listed ones are used
+        joining.erase(std::remove_if(joining.begin(), joining.end(), [](std::pair<uint32, WorldSession*> const& join)
+        {
+            WorldSession* session = sWorldSessionMgr->FindSession(join.first);
+            return session != join.second || (session->GetPlayer() && session->GetPlayer()->IsInWorld());
+        }), joining.end());
+
+        if (World::IsStopped())
+            return false;
+
+        if (std::chrono::steady_clock::now() > timeout)
+        {
+            LOG_ERROR("maps.replay", "{} characters couldn't log in, the replay continues without them.", joining.size());
+            break;
+        }
+
+        std::this_thread::sleep_for(1ms);
+    }
+
+    for (ReplayTick::Packet const& recorded : tick.Packets)
+    {
+        WorldSession* session = sWorldSessionMgr->FindSession(recorded.AccountId);
+        if (!session || !session->IsReplayed())
+            continue;
+
+        WorldPacket* packet = new WorldPacket(recorded.Opcode, recorded.Data.size());
+        if (!recorded.Data.empty())
+            packet->append(recorded.Data.data(), recorded.Data.size());
+
+        session->QueuePacket(packet);
+    }
+
+    return true;
+}
+
+MapReplay::UpdateScope::UpdateScope(Map const* map) : _active(false)
+{
+    MapReplay* replay = sMapReplay;
+    if ((!replay->IsRecording() && !replay->IsReplaying()) || !replay->IsRecordedMap(map))
+        return;
+
+    if (replay->IsReplaying())
+    {
+        if (replay->_pendingMapSeed)
+            SetRandomSeed(*replay->_pendingMapSeed);
+
+        replay->_pendingMapSeed.reset();
+        _active = true;
+        _start = std::chrono::steady_clock::now();
+        return;
+    }
+
+    uint32 const seed = rand32();
+    SetRandomSeed(seed);
+
+    std::lock_guard<std::mutex> guard(replay->_recordLock);
+    replay->_recordBuffer << uint8(MAP_REPLAY_MAP_UPDATE) << uint32(seed);
+}
+
+MapReplay::UpdateScope::~UpdateScope()
+{
+    if (_active)
+        sMapReplay->_tickMapUpdateTime += uint32(std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - _start).count());
+}
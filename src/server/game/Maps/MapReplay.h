@@ -0,0 +1,118 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_MAP_REPLAY_H
+#define ACORE_MAP_REPLAY_H
+
+#include "ByteBuffer.h"
+#include "Duration.h"
+#include "ObjectGuid.h"
+#include "Optional.h"
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+class Map;
+class WorldPacket;
+class WorldSession;
+
+/*
+ * Records the client packets and random seeds of a non instanced map for a
+ * while, and replays them offline in a worldserver started without
+ * network, timing every Map::Update of the recorded map.
+ *
+ * A recording holds one entry per world update: its diff and the seeds of
+ * the world thread and of the map update, the players who entered or left
+ * the map and the packets their sessions processed during that update.
+ * The replay logs the same characters in on sessions without socket,
+ * queues the packets right before the update which processed them and
+ * restarts the generators from the same seeds, so two builds replaying the
+ * same file run the same game logic and can be compared tick by tick.
+ *
+ * The characters are loaded from the database, the recording saves them
+ * when they enter the map, so the replay should run against a copy of the
+ * characters database taken after the recording.
+ */
+class AC_GAME_API MapReplay
+{
+    MapReplay() = default;
+
+public:
+    static MapReplay* instance();
+
+    // records the map for the next duration into fileName, false when a recording already runs or the map is instanced
+    bool StartRecording(uint32 mapId, Milliseconds duration, std::string fileName);
+    // ends the running recording early, false when none runs
+    bool StopRecording();
+    [[nodiscard]] bool IsRecording() const { return _recording.load(std::memory_order_relaxed); }
+    [[nodiscard]] bool IsReplaying() const { return _replaying; }
+
+    // replays fileName, the world must be initialized and nobody connected, false when the file can't be read
+    bool Replay(std::string const& fileName, std::string const& reportFileName);
+
+    // start of World::Update, on the world thread
+    void OnWorldUpdate(uint32 diff);
+    // processed packet of any session, on the thread processing it
+    void RecordPacket(WorldSession const* session, WorldPacket const& packet);
+
+    // Seeds and, in a replay, times a Map::Update of the recorded map
+    class UpdateScope
+    {
+    public:
+        explicit UpdateScope(Map const* map);
+        ~UpdateScope();
+
+        UpdateScope(UpdateScope const&) = delete;
+        UpdateScope& operator=(UpdateScope const&) = delete;
+
+    private:
+        bool _active;
+        TimePoint _start;
+    };
+
+private:
+    struct ReplayTick;
+
+
+    bool IsRecordedMap(Map const* map) const;
+    void RecordJoinsAndLeaves(Map* map);
+    void FlushRecording();
+
+    bool ReplayTickData(ReplayTick const& tick);
+
+    uint32 _mapId = 0;
+
+    // recording, the buffer is shared by all the threads processing packets
+    std::atomic<bool> _recording = false;
+    std::mutex _recordLock;
+    ByteBuffer _recordBuffer;
+    std::unordered_set<uint32> _recordedAccounts;
+    FILE* _recordFile = nullptr;
+    Milliseconds _recordTimeLeft = 0ms;
+
+    // replay, everything runs on the thread calling Replay()
+    bool _replaying = false;
+    Optional<uint32> _pendingWorldSeed;
+    Optional<uint32> _pendingMapSeed;
+    uint32 _tickMapUpdateTime = 0;      // us
+    std::vector<uint32> _mapUpdateTimes; // us, one per replayed tick
+};
+
+#define sMapReplay MapReplay::instance()
+
+#endif
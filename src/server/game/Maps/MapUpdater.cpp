@@ -16,12 +16,27 @@
  */
 
 #include "MapUpdater.h"
+#include "Config.h"
+#include "CycleClock.h"
 #include "DatabaseEnv.h"
+#include "FrameArena.h"
 #include "LFGMgr.h"
 #include "Log.h"
 #include "Map.h"
 #include "MapMgr.h"
 #include "Metric.h"
+#include "MetricRegistry.h"
+#include "ProcessPriority.h"
+#include "Profiler.h"
+#include <algorithm>
+
+namespace
+{
+    // Identifies the worker executing on the current thread, used to keep
+    // requests scheduled from inside a worker on its own queue
+    thread_local MapUpdater const* t_workerOwner = nullptr;
+    thread_local std::size_t t_workerIndex = 0;
+}
 
 class UpdateRequest
 {
@@ -30,35 +45,60 @@ public:
     virtual ~UpdateRequest() = default;
 
     virtual void call() = 0;
+
+    // Used to order staged requests, longest first
+    [[nodiscard]] virtual uint32 GetExpectedCost() const { return 0; }
+
+    // Worker which ran the same request in the previous tick, if any
+    [[nodiscard]] virtual Optional<std::size_t> GetPreferredWorker() const { return {}; }
 };
 
 class MapUpdateRequest : public UpdateRequest
 {
 public:
-    MapUpdateRequest(Map& m, MapUpdater& u, uint32 d, uint32 sd)
-        : m_map(m), m_updater(u), m_diff(d), s_diff(sd)
+    MapUpdateRequest(Map& m, uint32 d, uint32 sd)
+        : m_map(m), m_diff(d), s_diff(sd), m_expectedCost(m.GetExpectedUpdateCost())
     {
     }
 
     void call() override
     {
         METRIC_TIMER("map_update_time_diff", METRIC_TAG("map_id", std::to_string(m_map.GetId())));
+        PROFILER_ZONE_ARG("Map::Update", m_map.GetId());
+        Acore::CycleClock::time_point start = Acore::CycleClock::now();
         m_map.Update(m_diff, s_diff);
-        m_updater.update_finished();
+        Acore::FrameArena::Trim();
+        m_map.SetLastUpdateWorker(uint32(t_workerIndex));
+
+        static MetricHistogram& updateTime = sMetricRegistry->GetHistogram("acore_map_update_time_microseconds", "Duration of a map update",
+            { 100, 500, 1000, 5000, 10000, 25000, 50000, 100000, 250000 });
+        uint32 cost = uint32(std::chrono::duration_cast<Microseconds>(Acore::CycleClock::now() - start).count());
+        updateTime.Observe(cost);
+        m_map.SetLastUpdateCost(cost);
+    }
+
+    [[nodiscard]] uint32 GetExpectedCost() const override { return m_expectedCost; }
+
+    [[nodiscard]] Optional<std::size_t> GetPreferredWorker() const override
+    {
+        if (Optional<uint32> worker = m_map.GetLastUpdateWorker())
+            return *worker;
+
+        return {};
     }
 
 private:
     Map& m_map;
-    MapUpdater& m_updater;
     uint32 m_diff;
     uint32 s_diff;
+    uint32 m_expectedCost;
 };
 
 class MapPreloadRequest : public UpdateRequest
 {
 public:
-    MapPreloadRequest(uint32 mapId, MapUpdater& updater)
-        : _mapId(mapId), _updater(updater)
+    MapPreloadRequest(uint32 mapId)
+        : _mapId(mapId)
     {
     }
 
@@ -67,49 +107,58 @@ public:
         Map* map = sMapMgr->CreateBaseMap(_mapId);
         LOG_INFO("server.loading", ">> Loading All Grids For Map {} ({})", map->GetId(), map->GetMapName());
         map->LoadAllGrids();
-        _updater.update_finished();
     }
 
 private:
     uint32 _mapId;
-    MapUpdater& _updater;
 };
 
 class LFGUpdateRequest : public UpdateRequest
 {
 public:
-    LFGUpdateRequest(MapUpdater& u, uint32 d) : m_updater(u), m_diff(d) {}
+    LFGUpdateRequest(uint8 queueId, uint32 d) : m_queueId(queueId), m_diff(d) {}
 
     void call() override
     {
-        sLFGMgr->Update(m_diff, 1);
-        m_updater.update_finished();
+        sLFGMgr->UpdateQueue(m_queueId, m_diff);
     }
+
+    // pussywizard: lfg compatibles update should be processed from the very beginning
+    [[nodiscard]] uint32 GetExpectedCost() const override { return std::numeric_limits<uint32>::max(); }
+
 private:
-    MapUpdater& m_updater;
+    uint8 m_queueId;
     uint32 m_diff;
 };
 
-MapUpdater::MapUpdater() : pending_requests(0), _cancelationToken(false)
+MapUpdater::MapUpdater() : _queuedRequests(0), pending_requests(0), _cancelationToken(false)
 {
 }
 
 void MapUpdater::activate(std::size_t num_threads)
 {
+    _workerQueues.reserve(num_threads);
+    for (std::size_t i = 0; i < num_threads; ++i)
+        _workerQueues.push_back(std::make_unique<WorkerQueue>());
+
+    std::string const affinity = sConfigMgr->GetOption<std::string>("MapUpdate.Threads.Affinity", "");
+
     _workerThreads.reserve(num_threads);
     for (std::size_t i = 0; i < num_threads; ++i)
     {
-        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this));
+        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this, i, affinity));
     }
 }
 
 void MapUpdater::deactivate()
 {
-    _cancelationToken = true;
-
     wait();  // This is where we wait for tasks to complete
 
-    _queue.Cancel();  // Cancel the queue to prevent further task processing
+    {
+        std::lock_guard<std::mutex> lock(_workLock);
+        _cancelationToken = true;
+    }
+    _workCondition.notify_all();  // Wake up idle workers so they can exit
 
     // Join all worker threads
     for (auto& thread : _workerThreads)
@@ -121,36 +170,55 @@ void MapUpdater::deactivate()
     }
 }
 
-void MapUpdater::wait()
+void MapUpdater::wait(std::function<void()> const& whileWaiting)
 {
-    std::unique_lock<std::mutex> guard(_lock);  // Guard lock for safe waiting
+    DistributeStagedRequests();
 
-    // Wait until there are no pending requests
-    _condition.wait(guard, [this] {
-        return pending_requests.load(std::memory_order_acquire) == 0;
-    });
+    if (whileWaiting)
+        whileWaiting();
+
+    {
+        std::unique_lock<std::mutex> guard(_lock);  // Guard lock for safe waiting
+
+        // Wait until there are no pending requests
+        _condition.wait(guard, [this] {
+            return pending_requests.load(std::memory_order_acquire) == 0;
+        });
+    }
+
+    LogWorkerStats();
 }
 
 void MapUpdater::schedule_task(UpdateRequest* request)
 {
     // Atomic increment for pending_requests
     pending_requests.fetch_add(1, std::memory_order_release);
-    _queue.Push(request);
+
+    // Scheduled from inside a worker: keep it local, idle workers will steal it if needed
+    if (t_workerOwner == this)
+    {
+        PushToWorker(t_workerIndex, request);
+        return;
+    }
+
+    _stagedRequests.push_back(request);
 }
 
 void MapUpdater::schedule_update(Map& map, uint32 diff, uint32 s_diff)
 {
-    schedule_task(new MapUpdateRequest(map, *this, diff, s_diff));
+    schedule_task(new MapUpdateRequest(map, diff, s_diff));
 }
 
 void MapUpdater::schedule_map_preload(uint32 mapid)
 {
-    schedule_task(new MapPreloadRequest(mapid, *this));
+    schedule_task(new MapPreloadRequest(mapid));
 }
 
 void MapUpdater::schedule_lfg_update(uint32 diff)
 {
-    schedule_task(new LFGUpdateRequest(*this, diff));
+    // the queues are independent, their proposals are added by the world thread afterwards
+    for (uint8 queueId : sLFGMgr->GetQueueIds())
+        schedule_task(new LFGUpdateRequest(queueId, diff));
 }
 
 bool MapUpdater::activated()
@@ -169,22 +237,154 @@ void MapUpdater::update_finished()
     }
 }
 
-void MapUpdater::WorkerThread()
+void MapUpdater::DistributeStagedRequests()
 {
+    if (_stagedRequests.empty())
+        return;
+
+    // Longest processing time first: the most expensive maps start right away
+    // and every request goes to the worker with the least expected work
+    std::stable_sort(_stagedRequests.begin(), _stagedRequests.end(), [](UpdateRequest const* left, UpdateRequest const* right)
+    {
+        return left->GetExpectedCost() > right->GetExpectedCost();
+    });
+
+    std::vector<uint64> expectedLoad(_workerQueues.size(), 0);
+    std::vector<std::vector<UpdateRequest*>> assigned(_workerQueues.size());
+    for (UpdateRequest* request : _stagedRequests)
+    {
+        std::size_t worker = std::distance(expectedLoad.begin(), std::min_element(expectedLoad.begin(), expectedLoad.end()));
+
+        // back to the worker of the previous tick, unless that unbalances the tick by more than a quarter of the request
+        Optional<std::size_t> preferred = request->GetPreferredWorker();
+        if (preferred && *preferred < expectedLoad.size() && expectedLoad[*preferred] <= expectedLoad[worker] + request->GetExpectedCost() / 4)
+            worker = *preferred;
+
+        expectedLoad[worker] += request->GetExpectedCost();
+        assigned[worker].push_back(request);
+    }
+
+    uint32 stagedCount = uint32(_stagedRequests.size());
+    _stagedRequests.clear();
+
+    for (std::size_t i = 0; i < _workerQueues.size(); ++i)
+    {
+        if (assigned[i].empty())
+            continue;
+
+        std::lock_guard<std::mutex> lock(_workerQueues[i]->Lock);
+        _workerQueues[i]->Requests.insert(_workerQueues[i]->Requests.end(), assigned[i].begin(), assigned[i].end());
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_workLock);
+        _queuedRequests.fetch_add(stagedCount, std::memory_order_release);
+    }
+    _workCondition.notify_all();
+}
+
+void MapUpdater::PushToWorker(std::size_t workerIndex, UpdateRequest* request)
+{
+    {
+        WorkerQueue& queue = *_workerQueues[workerIndex];
+        std::lock_guard<std::mutex> lock(queue.Lock);
+
+        // Keep the queue ordered longest first
+        auto itr = std::find_if(queue.Requests.begin(), queue.Requests.end(), [cost = request->GetExpectedCost()](UpdateRequest const* queued)
+        {
+            return queued->GetExpectedCost() < cost;
+        });
+        queue.Requests.insert(itr, request);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_workLock);
+        _queuedRequests.fetch_add(1, std::memory_order_release);
+    }
+    _workCondition.notify_one();
+}
+
+UpdateRequest* MapUpdater::PopRequest(std::size_t workerIndex)
+{
+    auto tryPop = [this](WorkerQueue& queue) -> UpdateRequest*
+    {
+        std::lock_guard<std::mutex> lock(queue.Lock);
+        if (queue.Requests.empty())
+            return nullptr;
+
+        UpdateRequest* request = queue.Requests.front();
+        queue.Requests.pop_front();
+        _queuedRequests.fetch_sub(1, std::memory_order_acq_rel);
+        return request;
+    };
+
+    WorkerQueue& ownQueue = *_workerQueues[workerIndex];
+    if (UpdateRequest* request = tryPop(ownQueue))
+        return request;
+
+    // Own queue is drained, steal the most expensive pending request of another worker
+    for (std::size_t i = 1; i < _workerQueues.size(); ++i)
+    {
+        if (UpdateRequest* request = tryPop(*_workerQueues[(workerIndex + i) % _workerQueues.size()]))
+        {
+            ownQueue.StolenRequests.fetch_add(1, std::memory_order_relaxed);
+            return request;
+        }
+    }
+
+    return nullptr;
+}
+
+void MapUpdater::LogWorkerStats()
+{
+    for (std::size_t i = 0; i < _workerQueues.size(); ++i)
+    {
+        WorkerQueue& queue = *_workerQueues[i];
+        uint64 busyTime = queue.BusyTime.exchange(0, std::memory_order_relaxed);
+        uint32 processed = queue.ProcessedRequests.exchange(0, std::memory_order_relaxed);
+        uint32 stolen = queue.StolenRequests.exchange(0, std::memory_order_relaxed);
+
+        METRIC_VALUE("map_updater_worker_busy_time", busyTime, METRIC_TAG("worker", std::to_string(i)));
+        METRIC_VALUE("map_updater_worker_requests", processed, METRIC_TAG("worker", std::to_string(i)));
+        METRIC_VALUE("map_updater_worker_steals", stolen, METRIC_TAG("worker", std::to_string(i)));
+    }
+}
+
+void MapUpdater::WorkerThread(std::size_t workerIndex, std::string const& affinity)
+{
+    SetCurrentThreadAffinity("maps", affinity);
+
     LoginDatabase.WarnAboutSyncQueries(true);
     CharacterDatabase.WarnAboutSyncQueries(true);
     WorldDatabase.WarnAboutSyncQueries(true);
+    sConfigMgr->WarnAboutRuntimeLookups(true);
+
+    t_workerOwner = this;
+    t_workerIndex = workerIndex;
+
+    WorkerQueue& ownQueue = *_workerQueues[workerIndex];
 
     while (!_cancelationToken)
     {
-        UpdateRequest* request = nullptr;
-
-        _queue.WaitAndPop(request);  // Wait for and pop a request from the queue
+        UpdateRequest* request = PopRequest(workerIndex);
 
-        if (!_cancelationToken && request)
+        if (!request)
         {
-            request->call();  // Execute the request
-            delete request;  // Clean up after processing
+            // Nothing to run or to steal, sleep until new requests are queued
+            std::unique_lock<std::mutex> lock(_workLock);
+            _workCondition.wait(lock, [this] {
+                return _cancelationToken || _queuedRequests.load(std::memory_order_acquire) > 0;
+            });
+            continue;
         }
+
+        Acore::CycleClock::time_point start = Acore::CycleClock::now();
+        request->call();  // Execute the request
+        delete request;  // Clean up after processing
+
+        ownQueue.BusyTime.fetch_add(std::chrono::duration_cast<Microseconds>(Acore::CycleClock::now() - start).count(), std::memory_order_relaxed);
+        ownQueue.ProcessedRequests.fetch_add(1, std::memory_order_relaxed);
+
+        update_finished();
     }
 }
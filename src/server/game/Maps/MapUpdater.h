@@ -19,14 +19,31 @@
 #define _MAP_UPDATER_H_INCLUDED
 
 #include "Define.h"
-#include "PCQueue.h"
 #include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <thread>
 #include <atomic>
+#include <vector>
 
 class Map;
 class UpdateRequest;
 
+/*
+ * Work-stealing scheduler for map updates.
+ *
+ * Requests scheduled from the world thread are staged and distributed when
+ * wait() is called: they are sorted by their expected cost (the measured
+ * duration of the previous update of the same map, longest first) and
+ * assigned to the least loaded worker. Requests scheduled from a worker
+ * (e.g. instances scheduled by their MapInstanced parent) go to that
+ * worker's own queue. Idle workers steal pending requests from the others.
+ * A map stays on the worker which updated it in the previous tick while that
+ * costs little balance, so its objects are still in that worker's caches.
+ */
 class MapUpdater
 {
 public:
@@ -37,15 +54,37 @@ public:
     void schedule_update(Map& map, uint32 diff, uint32 s_diff);
     void schedule_map_preload(uint32 mapid);
     void schedule_lfg_update(uint32 diff);
-    void wait();
+    // whileWaiting runs on the calling thread once the staged requests are handed to the workers
+    void wait(std::function<void()> const& whileWaiting = nullptr);
     void activate(std::size_t num_threads);
     void deactivate();
     bool activated();
     void update_finished();
 
 private:
-    void WorkerThread();
-    ProducerConsumerQueue<UpdateRequest*> _queue;
+    struct WorkerQueue
+    {
+        std::mutex Lock;
+        std::deque<UpdateRequest*> Requests;
+
+        // Per tick statistics, reset by the world thread after wait()
+        std::atomic<uint64> BusyTime{0}; // microseconds
+        std::atomic<uint32> ProcessedRequests{0};
+        std::atomic<uint32> StolenRequests{0};
+    };
+
+    void WorkerThread(std::size_t workerIndex, std::string const& affinity);
+    void DistributeStagedRequests();
+    void PushToWorker(std::size_t workerIndex, UpdateRequest* request);
+    UpdateRequest* PopRequest(std::size_t workerIndex);
+    void LogWorkerStats();
+
+    std::vector<std::unique_ptr<WorkerQueue>> _workerQueues;
+    std::vector<UpdateRequest*> _stagedRequests; // only touched by the world thread
+    std::atomic<uint32> _queuedRequests;  // requests sitting in worker queues, guarded by _workLock on increment
+    std::mutex _workLock;
+    std::condition_variable _workCondition;
+
     std::atomic<int> pending_requests;  // Use std::atomic for pending_requests to avoid lock contention
     std::atomic<bool> _cancelationToken;  // Atomic flag for cancellation to avoid race conditions
     std::vector<std::thread> _workerThreads;
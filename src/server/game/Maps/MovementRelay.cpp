@@ -0,0 +1,57 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MovementRelay.h"
+#include "ObjectAccessor.h"
+#include "Player.h"
+#include "WorldSession.h"
+
+void MovementRelay::Queue(Player const* recipient, WorldPacket const& packet)
+{
+    _recipients[recipient->GetGUID()].Append(packet);
+}
+
+void MovementRelay::QueueToSet(WorldObject const* mover, WorldPacket const& packet, Player const* skipped)
+{
+    // Player::SendMessageToSet sends to the player itself too
+    if (Player const* player = mover->ToPlayer())
+        if (player != skipped)
+            Queue(player, packet);
+
+    for (auto const& kvPair : mover->GetObjectVisibilityContainer().GetVisiblePlayersMap())
+        if (kvPair.second != skipped)
+            Queue(kvPair.second, packet);
+}
+
+void MovementRelay::Flush(Map const* map)
+{
+    for (auto itr = _recipients.begin(); itr != _recipients.end();)
+    {
+        // Batches of players that received nothing this tick are released
+        if (itr->second.IsEmpty())
+        {
+            itr = _recipients.erase(itr);
+            continue;
+        }
+
+        if (Player* player = ObjectAccessor::GetPlayer(map, itr->first))
+            player->GetSession()->SendPacketBatch(itr->second);
+
+        itr->second.Clear();
+        ++itr;
+    }
+}
@@ -0,0 +1,53 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MOVEMENT_RELAY_H_INCLUDED
+#define _MOVEMENT_RELAY_H_INCLUDED
+
+#include "ObjectGuid.h"
+#include "WorldPacketBatch.h"
+#include <unordered_map>
+
+class Map;
+class Player;
+class WorldObject;
+
+/*
+ * Movement packets relayed while the sessions of a crowded map are updated
+ * (MapUpdate.MovementRelay.MinPlayers). Instead of being copied and queued to
+ * the socket of every recipient one by one, the packets are written into one
+ * WorldPacketBatch per recipient, handed to its session once all sessions of
+ * the map were updated.
+ *
+ * Packets keep their order per recipient. Recipients are kept by guid, a
+ * player leaving the map meanwhile does not get them.
+ */
+class MovementRelay
+{
+public:
+    void Queue(Player const* recipient, WorldPacket const& packet);
+
+    // To the players seeing mover except skipped, like WorldObject::SendMessageToSet
+    void QueueToSet(WorldObject const* mover, WorldPacket const& packet, Player const* skipped);
+
+    void Flush(Map const* map);
+
+private:
+    std::unordered_map<ObjectGuid, WorldPacketBatch> _recipients;
+};
+
+#endif //_MOVEMENT_RELAY_H_INCLUDED
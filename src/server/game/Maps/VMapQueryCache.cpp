@@ -0,0 +1,159 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "VMapQueryCache.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <functional>
+
+VMapQueryCache::VMapQueryCache(uint32 capacity, float precision) :
+    _shardCapacity(std::max<std::size_t>(capacity / SHARD_COUNT, 1)), _inversePrecision(1.0f / precision), _hits(0), _misses(0)
+{
+}
+
+std::size_t VMapQueryCache::KeyHash::operator()(Key const& key) const
+{
+    std::size_t hash = std::hash<uint32>()((uint32(key.Type) << 24) ^ key.Param);
+    for (int32 cell : key.Cells)
+        hash = hash * 31 + std::hash<int32>()(cell);
+
+    return hash;
+}
+
+int32 VMapQueryCache::ToCell(float coordinate) const
+{
+    return int32(std::floor(coordinate * _inversePrecision));
+}
+
+bool VMapQueryCache::Find(uint32 generation, Key const& key, Value& value)
+{
+    Shard& shard = _shards[KeyHash()(key) % SHARD_COUNT];
+    std::lock_guard<std::mutex> guard(shard.Lock);
+
+    // tiles were loaded or unloaded since the entries were stored
+    if (shard.Generation != generation)
+    {
+        shard.Entries.clear();
+        shard.Index.clear();
+        shard.Generation = generation;
+    }
+
+    auto itr = shard.Index.find(key);
+    if (itr == shard.Index.end())
+    {
+        ++_misses;
+        return false;
+    }
+
+    shard.Entries.splice(shard.Entries.begin(), shard.Entries, itr->second);
+    value = itr->second->second;
+    ++_hits;
+    return true;
+}
+
+void VMapQueryCache::Store(uint32 generation, Key const& key, Value const& value)
+{
+    Shard& shard = _shards[KeyHash()(key) % SHARD_COUNT];
+    std::lock_guard<std::mutex> guard(shard.Lock);
+
+    // read from a tree that changed meanwhile
+    if (shard.Generation != generation)
+        return;
+
+    auto itr = shard.Index.find(key);
+    if (itr != shard.Index.end())
+    {
+        itr->second->second = value;
+        shard.Entries.splice(shard.Entries.begin(), shard.Entries, itr->second);
+        return;
+    }
+
+    if (shard.Entries.size() >= _shardCapacity)
+    {
+        shard.Index.erase(shard.Entries.back().first);
+        shard.Entries.pop_back();
+    }
+
+    shard.Entries.emplace_front(key, value);
+    shard.Index.emplace(key, shard.Entries.begin());
+}
+
+bool VMapQueryCache::FindLineOfSight(uint32 generation, float x1, float y1, float z1, float x2, float y2, float z2, VMAP::ModelIgnoreFlags ignoreFlags, bool& lineOfSight)
+{
+    Key key{ QueryType::LineOfSight, uint32(ignoreFlags), { ToCell(x1), ToCell(y1), ToCell(z1), ToCell(x2), ToCell(y2), ToCell(z2) } };
+    Value value;
+    if (!Find(generation, key, value))
+        return false;
+
+    lineOfSight = value.Found;
+    return true;
+}
+
+void VMapQueryCache::StoreLineOfSight(uint32 generation, float x1, float y1, float z1, float x2, float y2, float z2, VMAP::ModelIgnoreFlags ignoreFlags, bool lineOfSight)
+{
+    Key key{ QueryType::LineOfSight, uint32(ignoreFlags), { ToCell(x1), ToCell(y1), ToCell(z1), ToCell(x2), ToCell(y2), ToCell(z2) } };
+    Value value;
+    value.Found = lineOfSight;
+    Store(generation, key, value);
+}
+
+bool VMapQueryCache::FindHeight(uint32 generation, float x, float y, float z, float maxSearchDist, float& height)
+{
+    Key key{ QueryType::Height, std::bit_cast<uint32>(maxSearchDist), { ToCell(x), ToCell(y), ToCell(z), 0, 0, 0 } };
+    Value value;
+    if (!Find(generation, key, value))
+        return false;
+
+    height = value.Height;
+    return true;
+}
+
+void VMapQueryCache::StoreHeight(uint32 generation, float x, float y, float z, float maxSearchDist, float height)
+{
+    Key key{ QueryType::Height, std::bit_cast<uint32>(maxSearchDist), { ToCell(x), ToCell(y), ToCell(z), 0, 0, 0 } };
+    Value value;
+    value.Height = height;
+    Store(generation, key, value);
+}
+
+bool VMapQueryCache::FindAreaAndLiquidData(uint32 generation, float x, float y, float z, Optional<uint8> reqLiquidType, bool& found, VMAP::AreaAndLiquidData& data)
+{
+    Key key{ QueryType::AreaAndLiquidData, reqLiquidType ? 0x100u | *reqLiquidType : 0u, { ToCell(x), ToCell(y), ToCell(z), 0, 0, 0 } };
+    Value value;
+    if (!Find(generation, key, value))
+        return false;
+
+    found = value.Found;
+    data = value.AreaAndLiquid;
+    return true;
+}
+
+void VMapQueryCache::StoreAreaAndLiquidData(uint32 generation, float x, float y, float z, Optional<uint8> reqLiquidType, bool found, VMAP::AreaAndLiquidData const& data)
+{
+    Key key{ QueryType::AreaAndLiquidData, reqLiquidType ? 0x100u | *reqLiquidType : 0u, { ToCell(x), ToCell(y), ToCell(z), 0, 0, 0 } };
+    Value value;
+    value.Found = found;
+    value.AreaAndLiquid = data;
+    Store(generation, key, value);
+}
+
+void VMapQueryCache::GetAndResetStats(uint64& hits, uint64& misses)
+{
+    hits = _hits.exchange(0);
+    misses = _misses.exchange(0);
+}
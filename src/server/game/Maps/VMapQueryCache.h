@@ -0,0 +1,108 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _VMAP_QUERY_CACHE_H_INCLUDED
+#define _VMAP_QUERY_CACHE_H_INCLUDED
+
+#include "Define.h"
+#include "IVMapMgr.h"
+#include <array>
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+/*
+ * Per map LRU cache of static vmap queries (line of sight, height, area and
+ * liquid data), keyed by positions rounded to vmap.QueryCache.Precision.
+ *
+ * Only the static vmap tree is cached, it changes when tiles are loaded or
+ * unloaded and every entry is tagged with the tree generation it was read
+ * from. Game object models are always tested live: doors and other models
+ * change collision, phase or spawn state without leaving the dynamic tree.
+ *
+ * Split into shards with their own lock, the regions of a continent may
+ * query concurrently (MapUpdate.Regions.Threads).
+ */
+class VMapQueryCache
+{
+public:
+    VMapQueryCache(uint32 capacity, float precision);
+
+    bool FindLineOfSight(uint32 generation, float x1, float y1, float z1, float x2, float y2, float z2, VMAP::ModelIgnoreFlags ignoreFlags, bool& lineOfSight);
+    void StoreLineOfSight(uint32 generation, float x1, float y1, float z1, float x2, float y2, float z2, VMAP::ModelIgnoreFlags ignoreFlags, bool lineOfSight);
+
+    bool FindHeight(uint32 generation, float x, float y, float z, float maxSearchDist, float& height);
+    void StoreHeight(uint32 generation, float x, float y, float z, float maxSearchDist, float height);
+
+    bool FindAreaAndLiquidData(uint32 generation, float x, float y, float z, Optional<uint8> reqLiquidType, bool& found, VMAP::AreaAndLiquidData& data);
+    void StoreAreaAndLiquidData(uint32 generation, float x, float y, float z, Optional<uint8> reqLiquidType, bool found, VMAP::AreaAndLiquidData const& data);
+
+    // Hits and misses since the last call
+    void GetAndResetStats(uint64& hits, uint64& misses);
+
+private:
+    static constexpr std::size_t SHARD_COUNT = 16;
+
+    enum class QueryType : uint8
+    {
+        LineOfSight,
+        Height,
+        AreaAndLiquidData
+    };
+
+    struct Key
+    {
+        QueryType Type;
+        uint32 Param;                   // ignore flags, search distance bits or requested liquid type
+        std::array<int32, 6> Cells;     // rounded positions, unused ones are 0
+
+        bool operator==(Key const& other) const { return Type == other.Type && Param == other.Param && Cells == other.Cells; }
+    };
+
+    struct KeyHash
+    {
+        std::size_t operator()(Key const& key) const;
+    };
+
+    struct Value
+    {
+        bool Found = false;             // line of sight, or whether area and liquid data was found
+        float Height = 0.0f;
+        VMAP::AreaAndLiquidData AreaAndLiquid;
+    };
+
+    struct Shard
+    {
+        std::mutex Lock;
+        uint32 Generation = 0;
+        std::list<std::pair<Key, Value>> Entries;   // most recently used first
+        std::unordered_map<Key, std::list<std::pair<Key, Value>>::iterator, KeyHash> Index;
+    };
+
+    int32 ToCell(float coordinate) const;
+    bool Find(uint32 generation, Key const& key, Value& value);
+    void Store(uint32 generation, Key const& key, Value const& value);
+
+    std::size_t _shardCapacity;
+    float _inversePrecision;
+    std::array<Shard, SHARD_COUNT> _shards;
+    std::atomic<uint64> _hits;
+    std::atomic<uint64> _misses;
+};
+
+#endif //_VMAP_QUERY_CACHE_H_INCLUDED
@@ -16,13 +16,26 @@
  */
 
 #include "DynamicVisibility.h"
+#include "WorldLoadGovernor.h"
 
 uint8 DynamicVisibilityMgr::visibilitySettingsIndex = 0;
+Milliseconds DynamicVisibilityMgr::lowerTierDeferral = 0ms;
 
-void DynamicVisibilityMgr::Update(uint32 sessionCount)
+void DynamicVisibilityMgr::Update(uint32 sessionCount, uint32 diff)
 {
     if (sessionCount >= (visibilitySettingsIndex + 1) * ((uint32)VISIBILITY_SETTINGS_PLAYER_INTERVAL) && visibilitySettingsIndex < VISIBILITY_SETTINGS_MAX_INTERVAL_NUM - 1)
         ++visibilitySettingsIndex;
     else if (visibilitySettingsIndex && sessionCount < visibilitySettingsIndex * ((uint32)VISIBILITY_SETTINGS_PLAYER_INTERVAL) - 100)
+    {
+        // the lower tiers update visibility more often, they wait for the load to drop
+        if (sWorldLoadGovernor.ShouldDefer(LoadSheddingWork::VisibilityTier, lowerTierDeferral))
+        {
+            lowerTierDeferral += Milliseconds(diff);
+            return;
+        }
+
         --visibilitySettingsIndex;
+    }
+
+    lowerTierDeferral = 0ms;
 }
@@ -19,6 +19,7 @@
 #define __DYNAMICVISIBILITY_H
 
 #include "Define.h"
+#include "Duration.h"
 
 struct VisibilitySettingData
 {
@@ -47,12 +48,13 @@ const VisibilitySettingData VisibilitySettings[VISIBILITY_SETTINGS_MAX_INTERVAL_
 class DynamicVisibilityMgr
 {
 public:
-    static void Update(uint32 sessionCount);
+    static void Update(uint32 sessionCount, uint32 diff);
     static uint32 GetVisibilityNotifyDelay(uint32 map_type) { return VisibilitySettings[visibilitySettingsIndex][map_type].visibilityNotifyDelay; }
     static uint32 GetAINotifyDelay(uint32 map_type) { return VisibilitySettings[visibilitySettingsIndex][map_type].aiNotifyDelay; }
     static float GetReqMoveDistSq(uint32 map_type) { return VisibilitySettings[visibilitySettingsIndex][map_type].requiredMoveDistanceSq; }
 protected:
     static uint8 visibilitySettingsIndex;
+    static Milliseconds lowerTierDeferral;
 };
 
 #endif
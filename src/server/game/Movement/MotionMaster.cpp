@@ -488,6 +488,18 @@ void MotionMaster::MovePoint(uint32 id, float x, float y, float z, ForcedMovemen
     }
 }
 
+void MotionMaster::MovePoint(uint32 id, Movement::PointsArray const& path, ForcedMovement forcedMovement)
+{
+    if (_owner->HasUnitFlag(UNIT_FLAG_DISABLE_MOVE) || path.size() < 2)
+        return;
+
+    G3D::Vector3 const& dest = path.back();
+    if (_owner->IsPlayer())
+        Mutate(new PointMovementGenerator<Player>(id, dest.x, dest.y, dest.z, forcedMovement, 0.0f, 0.0f, &path), MOTION_SLOT_ACTIVE);
+    else
+        Mutate(new PointMovementGenerator<Creature>(id, dest.x, dest.y, dest.z, forcedMovement, 0.0f, 0.0f, &path), MOTION_SLOT_ACTIVE);
+}
+
 void MotionMaster::MoveSplinePath(Movement::PointsArray* path, ForcedMovement forcedMovement)
 {
     // Xinef: do not allow to move with UNIT_FLAG_DISABLE_MOVE
@@ -0,0 +1,132 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ChaseFlowField.h"
+#include "DetourNavMeshQuery.h"
+#include "GameTime.h"
+
+std::shared_ptr<ChaseFlowField> ChaseFlowField::Build(dtNavMeshQuery const* query, dtQueryFilter const* filter, G3D::Vector3 const& center)
+{
+    float const centerPoint[3] = { center.y, center.z, center.x };
+    float const extents[3] = { 3.0f, 5.0f, 3.0f };
+    float closestPoint[3];
+    dtPolyRef centerPoly = 0;
+    if (dtStatusFailed(query->findNearestPoly(centerPoint, extents, filter, &centerPoly, closestPoint)) || !centerPoly)
+        return nullptr;
+
+    dtPolyRef polys[MAX_FLOW_FIELD_POLYS];
+    dtPolyRef parents[MAX_FLOW_FIELD_POLYS];
+    int count = 0;
+    if (dtStatusFailed(query->findPolysAroundCircle(centerPoly, closestPoint, CHASE_FLOW_FIELD_RADIUS, filter, polys, parents, nullptr, &count, MAX_FLOW_FIELD_POLYS)) || !count)
+        return nullptr;
+
+    std::shared_ptr<ChaseFlowField> field = std::make_shared<ChaseFlowField>();
+    field->_center = center;
+    field->_polys.assign(polys, polys + count);
+    field->_parents.resize(count);
+    field->_index.reserve(count);
+
+    // polygons are returned in search order, parents always come before their children
+    for (int i = 0; i < count; ++i)
+    {
+        field->_index.emplace(polys[i], uint32(i));
+
+        auto parent = field->_index.find(parents[i]);
+        field->_parents[i] = parent != field->_index.end() ? parent->second : uint32(i);
+    }
+
+    return field;
+}
+
+uint32 ChaseFlowField::GetCorridor(dtPolyRef startPoly, dtPolyRef endPoly, dtPolyRef* path, uint32 maxPath) const
+{
+    auto start = _index.find(startPoly);
+    auto end = _index.find(endPoly);
+    if (start == _index.end() || end == _index.end())
+        return 0;
+
+    // branch of the destination, from its polygon towards the center
+    std::unordered_map<uint32, uint32> endBranch;
+    std::vector<uint32> endPolys;
+    for (uint32 i = end->second; ; i = _parents[i])
+    {
+        endBranch.emplace(i, uint32(endPolys.size()));
+        endPolys.push_back(i);
+        if (_parents[i] == i)
+            break;
+    }
+
+    // walk towards the center until the branch of the destination is reached, then follow it back out
+    uint32 length = 0;
+    for (uint32 i = start->second; ; i = _parents[i])
+    {
+        auto joint = endBranch.find(i);
+        if (joint != endBranch.end())
+        {
+            if (length + joint->second + 1 > maxPath)
+                return 0;
+
+            for (int32 j = int32(joint->second); j >= 0; --j)
+                path[length++] = _polys[endPolys[j]];
+
+            return length;
+        }
+
+        if (length + 1 > maxPath || _parents[i] == i)
+            return 0;
+
+        path[length++] = _polys[i];
+    }
+}
+
+std::shared_ptr<ChaseFlowField const> ChaseFlowFieldStore::Get(ObjectGuid const& target, uint32 filter, uint32 generation, G3D::Vector3 const& center)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    auto itr = _fields.find({ target, filter });
+    if (itr == _fields.end())
+        return nullptr;
+
+    if (itr->second.Generation != generation || (itr->second.Field->GetCenter() - center).squaredLength() > REBUILD_DISTANCE * REBUILD_DISTANCE)
+    {
+        _fields.erase(itr);
+        return nullptr;
+    }
+
+    itr->second.LastUsed = uint32(GameTime::GetGameTimeMS().count());
+    return itr->second.Field;
+}
+
+void ChaseFlowFieldStore::Store(ObjectGuid const& target, uint32 filter, uint32 generation, std::shared_ptr<ChaseFlowField const> field)
+{
+    uint32 const now = uint32(GameTime::GetGameTimeMS().count());
+
+    std::lock_guard<std::mutex> guard(_lock);
+
+    // targets nobody chases any more
+    for (auto itr = _fields.begin(); itr != _fields.end();)
+    {
+        if (now - itr->second.LastUsed > EXPIRE_TIME)
+            itr = _fields.erase(itr);
+        else
+            ++itr;
+    }
+
+    Entry& entry = _fields[{ target, filter }];
+    entry.Field = std::move(field);
+    entry.Generation = generation;
+    entry.LastUsed = now;
+}
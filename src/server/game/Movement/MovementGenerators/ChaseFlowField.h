@@ -0,0 +1,95 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _CHASE_FLOW_FIELD_H
+#define _CHASE_FLOW_FIELD_H
+
+#include "Common.h"
+#include "DetourNavMesh.h"
+#include "ObjectGuid.h"
+#include <G3D/Vector3.h>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+class dtNavMeshQuery;
+class dtQueryFilter;
+
+/*
+ * Dijkstra search over the navmesh polygons around a chase target, every
+ * polygon within CHASE_FLOW_FIELD_RADIUS knows its neighbour on the cheapest
+ * way to the target. Chasers take their polygon corridor from it instead of
+ * searching the navmesh each, one search serves all creatures chasing the
+ * same unit (MoveMaps.ChaseFlowField.MinChasers).
+ */
+class ChaseFlowField
+{
+public:
+    static constexpr float CHASE_FLOW_FIELD_RADIUS = 60.0f;
+
+    // nullptr if the center is not on the navmesh
+    static std::shared_ptr<ChaseFlowField> Build(dtNavMeshQuery const* query, dtQueryFilter const* filter, G3D::Vector3 const& center);
+
+    [[nodiscard]] G3D::Vector3 const& GetCenter() const { return _center; }
+
+    // Corridor from startPoly to endPoly through the field, 0 if either is outside it or it does not fit maxPath
+    uint32 GetCorridor(dtPolyRef startPoly, dtPolyRef endPoly, dtPolyRef* path, uint32 maxPath) const;
+
+private:
+    static constexpr uint32 MAX_FLOW_FIELD_POLYS = 1024;
+
+    G3D::Vector3 _center;
+    std::vector<dtPolyRef> _polys;                  // in search order, the center polygon first
+    std::vector<uint32> _parents;                   // index of the next polygon towards the center
+    std::unordered_map<dtPolyRef, uint32> _index;   // polygon to its index
+};
+
+/*
+ * Flow fields of a map, one per chase target and query filter. A field is
+ * built again once its target moved away from the center or navmesh tiles
+ * of the map were removed.
+ */
+class ChaseFlowFieldStore
+{
+public:
+    std::shared_ptr<ChaseFlowField const> Get(ObjectGuid const& target, uint32 filter, uint32 generation, G3D::Vector3 const& center);
+    void Store(ObjectGuid const& target, uint32 filter, uint32 generation, std::shared_ptr<ChaseFlowField const> field);
+
+private:
+    // target may move this far before its field is built again
+    static constexpr float REBUILD_DISTANCE = 2.0f;
+    // fields not used for this long are dropped
+    static constexpr uint32 EXPIRE_TIME = 10 * IN_MILLISECONDS;
+
+    struct Entry
+    {
+        std::shared_ptr<ChaseFlowField const> Field;
+        uint32 Generation = 0;
+        uint32 LastUsed = 0;
+    };
+
+    struct KeyHash
+    {
+        std::size_t operator()(std::pair<ObjectGuid, uint32> const& key) const { return std::hash<ObjectGuid>()(key.first) ^ (std::size_t(key.second) << 1); }
+    };
+
+    std::mutex _lock;
+    std::unordered_map<std::pair<ObjectGuid, uint32>, Entry, KeyHash> _fields;
+};
+
+#endif
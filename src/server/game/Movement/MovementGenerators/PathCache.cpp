@@ -0,0 +1,101 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PathCache.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+PathCache::PathCache(uint32 capacity, float precision) :
+    _shardCapacity(std::max<std::size_t>(capacity / SHARD_COUNT, 1)), _inversePrecision(1.0f / precision), _hits(0), _misses(0)
+{
+}
+
+std::size_t PathCache::KeyHash::operator()(Key const& key) const
+{
+    std::size_t hash = std::hash<uint32>()(key.Entry);
+    hash = hash * 31 + std::hash<uint32>()(key.Filter);
+    hash = hash * 31 + std::hash<uint32>()(key.Options);
+    for (int32 cell : key.Cells)
+        hash = hash * 31 + std::hash<int32>()(cell);
+
+    return hash;
+}
+
+int32 PathCache::ToCell(float coordinate) const
+{
+    return int32(std::floor(coordinate * _inversePrecision));
+}
+
+bool PathCache::Find(uint32 generation, Key const& key, Path& path)
+{
+    Shard& shard = _shards[KeyHash()(key) % SHARD_COUNT];
+    std::lock_guard<std::mutex> guard(shard.Lock);
+
+    // navmesh tiles were removed since the entries were stored
+    if (shard.Generation != generation)
+    {
+        shard.Entries.clear();
+        shard.Index.clear();
+        shard.Generation = generation;
+    }
+
+    auto itr = shard.Index.find(key);
+    if (itr == shard.Index.end())
+    {
+        ++_misses;
+        return false;
+    }
+
+    shard.Entries.splice(shard.Entries.begin(), shard.Entries, itr->second);
+    path = itr->second->second;
+    ++_hits;
+    return true;
+}
+
+void PathCache::Store(uint32 generation, Key const& key, Path const& path)
+{
+    Shard& shard = _shards[KeyHash()(key) % SHARD_COUNT];
+    std::lock_guard<std::mutex> guard(shard.Lock);
+
+    // built on a navmesh that changed meanwhile
+    if (shard.Generation != generation)
+        return;
+
+    auto itr = shard.Index.find(key);
+    if (itr != shard.Index.end())
+    {
+        itr->second->second = path;
+        shard.Entries.splice(shard.Entries.begin(), shard.Entries, itr->second);
+        return;
+    }
+
+    if (shard.Entries.size() >= _shardCapacity)
+    {
+        shard.Index.erase(shard.Entries.back().first);
+        shard.Entries.pop_back();
+    }
+
+    shard.Entries.emplace_front(key, path);
+    shard.Index.emplace(key, shard.Entries.begin());
+}
+
+void PathCache::GetAndResetStats(uint64& hits, uint64& misses)
+{
+    hits = _hits.exchange(0);
+    misses = _misses.exchange(0);
+}
@@ -0,0 +1,98 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PATH_CACHE_H
+#define _PATH_CACHE_H
+
+#include "Define.h"
+#include "DetourNavMesh.h"
+#include "MoveSplineInitArgs.h"
+#include <array>
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Per map LRU cache of complete PathGenerator results, so paths to fixed
+ * destinations (home, waypoint, escort and random movement) are searched once
+ * and then reused by every creature of the same entry walking them again.
+ *
+ * Keyed by start and end rounded to MoveMaps.PathCache.Precision, the query
+ * filter and the path options. Every entry is tagged with the navmesh tile
+ * generation of the map it was built from, removing tiles drops the entries
+ * since their polygon references are no longer valid.
+ *
+ * Split into shards with their own lock, the regions of a continent may
+ * calculate paths concurrently (MapUpdate.Regions.Threads).
+ */
+class PathCache
+{
+public:
+    struct Key
+    {
+        uint32 Entry;                   // creature entry, paths follow the height and swim rules of the mover
+        uint32 Filter;                  // include and exclude flags of the query filter
+        uint32 Options;                 // path options and point limit
+        std::array<int32, 6> Cells;     // rounded start and end
+
+        bool operator==(Key const& other) const { return Entry == other.Entry && Filter == other.Filter && Options == other.Options && Cells == other.Cells; }
+    };
+
+    struct Path
+    {
+        uint32 Type = 0;
+        G3D::Vector3 ActualEndPosition;
+        Movement::PointsArray Points;
+        std::vector<dtPolyRef> Polys;
+    };
+
+    PathCache(uint32 capacity, float precision);
+
+    int32 ToCell(float coordinate) const;
+
+    bool Find(uint32 generation, Key const& key, Path& path);
+    void Store(uint32 generation, Key const& key, Path const& path);
+
+    // Hits and misses since the last call
+    void GetAndResetStats(uint64& hits, uint64& misses);
+
+private:
+    static constexpr std::size_t SHARD_COUNT = 16;
+
+    struct KeyHash
+    {
+        std::size_t operator()(Key const& key) const;
+    };
+
+    struct Shard
+    {
+        std::mutex Lock;
+        uint32 Generation = 0;
+        std::list<std::pair<Key, Path>> Entries;    // most recently used first
+        std::unordered_map<Key, std::list<std::pair<Key, Path>>::iterator, KeyHash> Index;
+    };
+
+    std::size_t _shardCapacity;
+    float _inversePrecision;
+    std::array<Shard, SHARD_COUNT> _shards;
+    std::atomic<uint64> _hits;
+    std::atomic<uint64> _misses;
+};
+
+#endif
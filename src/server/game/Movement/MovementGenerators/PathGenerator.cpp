@@ -16,6 +16,7 @@
  */
 
 #include "PathGenerator.h"
+#include "ChaseFlowField.h"
 #include "Creature.h"
 #include "DetourCommon.h"
 #include "Geometry.h"
@@ -28,7 +29,7 @@
  ////////////////// PathGenerator //////////////////
 PathGenerator::PathGenerator(WorldObject const* owner) :
     _polyLength(0), _type(PATHFIND_BLANK), _useStraightPath(false), _forceDestination(false),
-    _slopeCheck(false), _pointPathLimit(MAX_POINT_PATH_LENGTH), _useRaycast(false),
+    _slopeCheck(false), _pointPathLimit(MAX_POINT_PATH_LENGTH), _useRaycast(false), _useCache(false),
     _endPosition(G3D::Vector3::zero()), _source(owner), _navMesh(nullptr),
     _navMeshQuery(nullptr)
 {
@@ -72,6 +73,10 @@ bool PathGenerator::CalculatePath(float x, float y, float z, float destX, float
 
     _forceDestination = forceDest;
 
+    // queries belong to a thread, the owner may be updated by another one than last time
+    if (_navMesh)
+        _navMeshQuery = MMAP::MMapFactory::createOrGetMMapMgr()->GetNavMeshQuery(_source->GetMapId(), _source->GetInstanceId());
+
     // make sure navMesh works - we can run on map w/o mmap
     // check if the start and end point have a .mmtile loaded (can we pass via not loaded tile on the way?)
     Unit const* _sourceUnit = _source->ToUnit();
@@ -85,10 +90,68 @@ bool PathGenerator::CalculatePath(float x, float y, float z, float destX, float
 
     UpdateFilter();
 
+    PathCache::Key cacheKey;
+    PathCache* cache = _useCache ? GetPathCacheKey(start, dest, cacheKey) : nullptr;
+    uint32 generation = cache ? MMAP::MMapFactory::createOrGetMMapMgr()->GetTileGeneration(_source->GetMapId()) : 0;
+    if (cache && LoadCachedPath(*cache, generation, cacheKey))
+        return true;
+
     BuildPolyPath(start, dest);
+
+    if (cache)
+        StoreCachedPath(*cache, generation, cacheKey);
+
+    return true;
+}
+
+PathCache* PathGenerator::GetPathCacheKey(G3D::Vector3 const& startPos, G3D::Vector3 const& endPos, PathCache::Key& key) const
+{
+    Map* map = _source->FindMap();
+    PathCache* cache = map ? map->GetPathCache() : nullptr;
+    if (!cache)
+        return nullptr;
+
+    uint32 options = (_useStraightPath ? 0x01 : 0) | (_forceDestination ? 0x02 : 0) | (_slopeCheck ? 0x04 : 0) | (_useRaycast ? 0x08 : 0);
+    if (Unit const* sourceUnit = _source->ToUnit())
+        options |= (sourceUnit->CanFly() ? 0x10 : 0) | (sourceUnit->CanSwim() ? 0x20 : 0) | (sourceUnit->IsHovering() ? 0x40 : 0);
+
+    key.Entry = _source->GetEntry();
+    key.Filter = (uint32(_filter.getIncludeFlags()) << 16) | _filter.getExcludeFlags();
+    key.Options = options | (_pointPathLimit << 8);
+    key.Cells = { cache->ToCell(startPos.x), cache->ToCell(startPos.y), cache->ToCell(startPos.z),
+        cache->ToCell(endPos.x), cache->ToCell(endPos.y), cache->ToCell(endPos.z) };
+    return cache;
+}
+
+bool PathGenerator::LoadCachedPath(PathCache& cache, uint32 generation, PathCache::Key const& key)
+{
+    PathCache::Path path;
+    if (!cache.Find(generation, key, path))
+        return false;
+
+    _type = PathType(path.Type);
+    _pathPoints = std::move(path.Points);
+    SetActualEndPosition(path.ActualEndPosition);
+
+    _polyLength = path.Polys.size();
+    std::copy(path.Polys.begin(), path.Polys.end(), _pathPolyRefs);
     return true;
 }
 
+void PathGenerator::StoreCachedPath(PathCache& cache, uint32 generation, PathCache::Key const& key) const
+{
+    // only complete paths, the others depend on liquids and the state of the mover
+    if (_type != PATHFIND_NORMAL)
+        return;
+
+    PathCache::Path path;
+    path.Type = _type;
+    path.Points = _pathPoints;
+    path.ActualEndPosition = GetActualEndPosition();
+    path.Polys.assign(_pathPolyRefs, _pathPolyRefs + _polyLength);
+    cache.Store(generation, key, path);
+}
+
 dtPolyRef PathGenerator::GetPathPolyByPosition(dtPolyRef const* polyPath, uint32 polyPathSize, float const* point, float* distance) const
 {
     if (!polyPath || !polyPathSize)
@@ -470,6 +533,11 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
                 return;
             }
         }
+        else if (uint32 corridorLength = GetChaseFlowFieldCorridor(startPoly, endPoly))
+        {
+            _polyLength = corridorLength;
+            dtResult = DT_SUCCESS;
+        }
         else
         {
             dtResult = _navMeshQuery->findPath(
@@ -631,6 +699,31 @@ void PathGenerator::NormalizePath()
     }
 }
 
+uint32 PathGenerator::GetChaseFlowFieldCorridor(dtPolyRef startPoly, dtPolyRef endPoly)
+{
+    if (!_chaseTarget)
+        return 0;
+
+    Map* map = _source->FindMap();
+    ChaseFlowFieldStore* store = map ? map->GetChaseFlowFields() : nullptr;
+    if (!store)
+        return 0;
+
+    uint32 filter = (uint32(_filter.getIncludeFlags()) << 16) | _filter.getExcludeFlags();
+    uint32 generation = MMAP::MMapFactory::createOrGetMMapMgr()->GetTileGeneration(_source->GetMapId());
+    std::shared_ptr<ChaseFlowField const> field = store->Get(_chaseTarget, filter, generation, _chaseTargetPosition);
+    if (!field)
+    {
+        field = ChaseFlowField::Build(_navMeshQuery, &_filter, _chaseTargetPosition);
+        if (!field)
+            return 0;
+
+        store->Store(_chaseTarget, filter, generation, field);
+    }
+
+    return field->GetCorridor(startPoly, endPoly, _pathPolyRefs, MAX_PATH_LENGTH);
+}
+
 void PathGenerator::BuildShortcut()
 {
     Clear();
@@ -23,6 +23,8 @@
 #include "MMapMgr.h"
 #include "MapDefines.h"
 #include "MoveSplineInitArgs.h"
+#include "ObjectGuid.h"
+#include "PathCache.h"
 #include "SharedDefines.h"
 #include <G3D/Vector3.h>
 
@@ -81,6 +83,10 @@ class PathGenerator
         void SetUseStraightPath(bool useStraightPath) { _useStraightPath = useStraightPath; }
         void SetPathLengthLimit(float distance) { _pointPathLimit = std::min<uint32>(uint32(distance/SMOOTH_PATH_STEP_SIZE), MAX_POINT_PATH_LENGTH); }
         void SetUseRaycast(bool useRaycast) { _useRaycast = useRaycast; }
+        // when set, complete paths are shared through the path cache of the map (for fixed destinations only)
+        void SetUseCache(bool useCache) { _useCache = useCache; }
+        // when set, the polygon corridor is taken from the flow field the chasers of target share (empty guid to unset)
+        void SetChaseTarget(ObjectGuid const& target, G3D::Vector3 const& targetPosition) { _chaseTarget = target; _chaseTargetPosition = targetPosition; }
 
         // result getters
         [[nodiscard]] G3D::Vector3 const& GetStartPosition() const { return _startPosition; }
@@ -139,11 +145,15 @@ class PathGenerator
         bool _slopeCheck;       // when set, it skips paths with too high slopes (doesn't work with _useStraightPath)
         uint32 _pointPathLimit; // limit point path size; min(this, MAX_POINT_PATH_LENGTH)
         bool _useRaycast;       // use raycast if true for a straight line path
+        bool _useCache;         // look up and store the path in the path cache of the map
 
         G3D::Vector3 _startPosition;        // {x, y, z} of current location
         G3D::Vector3 _endPosition;          // {x, y, z} of the destination
         G3D::Vector3 _actualEndPosition;    // {x, y, z} of the closest possible point to given destination
 
+        ObjectGuid _chaseTarget;            // unit whose flow field provides the corridor
+        G3D::Vector3 _chaseTargetPosition;  // {x, y, z} of the chase target
+
         WorldObject const* const _source;       // the object that is moving
         dtNavMesh const* _navMesh;              // the nav mesh
         dtNavMeshQuery const* _navMeshQuery;    // the nav mesh query used to find the path
@@ -167,6 +177,11 @@ class PathGenerator
         void BuildPointPath(float const* startPoint, float const* endPoint);
         void BuildShortcut();
 
+        PathCache* GetPathCacheKey(G3D::Vector3 const& startPos, G3D::Vector3 const& endPos, PathCache::Key& key) const;
+        bool LoadCachedPath(PathCache& cache, uint32 generation, PathCache::Key const& key);
+        void StoreCachedPath(PathCache& cache, uint32 generation, PathCache::Key const& key) const;
+        uint32 GetChaseFlowFieldCorridor(dtPolyRef startPoly, dtPolyRef endPoly);
+
         [[nodiscard]] NavTerrain GetNavTerrain(float x, float y, float z) const;
         void CreateFilter();
         void UpdateFilter();
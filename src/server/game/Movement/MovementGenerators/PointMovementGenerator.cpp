@@ -52,6 +52,7 @@ void PointMovementGenerator<T>::DoInitialize(T* unit)
     else if (_generatePath)
     {
         PathGenerator path(unit);
+        path.SetUseCache(unit->IsCreature() && !unit->IsControlledByPlayer());
         bool result = path.CalculatePath(i_x, i_y, i_z, _forceDestination);
         if (result && !(path.GetPathType() & PATHFIND_NOPATH) && path.GetPath().size() > 2)
         {
@@ -149,7 +149,10 @@ void RandomMovementGenerator<Creature>::_setRandomLocation(Creature* creature)
         else // ground
         {
             if (!_pathGenerator)
+            {
                 _pathGenerator = std::make_unique<PathGenerator>(creature);
+                _pathGenerator->SetUseCache(true);
+            }
             else
                 _pathGenerator->Clear();
 
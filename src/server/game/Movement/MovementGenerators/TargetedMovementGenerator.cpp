@@ -23,6 +23,10 @@
 #include "Player.h"
 #include "Spell.h"
 #include "Transport.h"
+#include "World.h"
+
+// Up to this distance between the end of the last chase path and the target the new path starts from its polygons
+static constexpr float CHASE_PATH_REUSE_DISTANCE = 10.0f;
 
 static bool IsMutualChase(Unit* owner, Unit* target)
 {
@@ -305,9 +309,17 @@ bool ChaseMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
             // make a new path if we have to...
             if (!i_path || moveToward != _movingTowards)
                 i_path = std::make_unique<PathGenerator>(owner);
-            else
+            // the target moved only a bit, the polygons of the last path are reused to build the new one
+            else if ((i_path->GetActualEndPosition() - G3D::Vector3(x, y, z)).squaredLength() > G3D::square(CHASE_PATH_REUSE_DISTANCE))
                 i_path->Clear();
 
+            // many units chase the target, share one navmesh search between them
+            uint32 minChasers = sWorld->getIntConfig(CONFIG_CHASE_FLOW_FIELD_MIN_CHASERS);
+            if (minChasers && target->getAttackers().size() >= minChasers)
+                i_path->SetChaseTarget(target->GetGUID(), G3D::Vector3(x, y, z));
+            else
+                i_path->SetChaseTarget(ObjectGuid::Empty, G3D::Vector3::zero());
+
             // Predict chase destination to keep up with chase target
             float additionalRange = 0;
             bool predictDestination = !mutualChase && target->isMoving();
@@ -33,7 +33,15 @@ namespace Movement
             u = (time_passed - spline.length(point_Idx)) / (float)seg_time;
         Location c;
         c.orientation = initialOrientation;
-        spline.evaluate_percent(point_Idx, u, c);
+
+        // the orientation follows the spline unless it is fixed or given by the facing of the finished spline
+        bool const orientationFromSpline = !(splineflags.done && splineflags.isFacing()) &&
+            !splineflags.hasFlag(MoveSplineFlag::OrientationFixed | MoveSplineFlag::Falling);
+        Vector3 hermite;
+        if (orientationFromSpline)
+            spline.evaluate_percent_and_derivative(point_Idx, u, c, hermite);
+        else
+            spline.evaluate_percent(point_Idx, u, c);
 
         if (splineflags.animation)
             ;// MoveSplineFlag::Animation disables falling or parabolic movement
@@ -52,12 +60,8 @@ namespace Movement
         }
         else
         {
-            if (!splineflags.hasFlag(MoveSplineFlag::OrientationFixed | MoveSplineFlag::Falling))
-            {
-                Vector3 hermite;
-                spline.evaluate_derivative(point_Idx, u, hermite);
+            if (orientationFromSpline)
                 c.orientation = std::atan2(hermite.y, hermite.x);
-            }
 
             if (splineflags.orientationInversed)
                 c.orientation = -c.orientation;
@@ -134,8 +134,10 @@ namespace Movement
 
         unit->m_movementInfo.SetMovementFlags(moveFlags);
         move_spline.Initialize(args);
+        unit->InvalidateMovementUpdateCache();
 
-        WorldPacket data(SMSG_MONSTER_MOVE, 64);
+        // sized up front, long waypoint and chase paths would otherwise grow the packet several times
+        WorldPacket data(SMSG_MONSTER_MOVE, unit->GetPackGUID().size() + (transport ? 8 + 1 + 1 : 0) + PacketBuilder::GetMonsterMoveSize(move_spline));
         data << unit->GetPackGUID();
         if (transport)
         {
@@ -228,6 +230,7 @@ namespace Movement
         if (generatePath)
         {
             PathGenerator path(unit);
+            path.SetUseCache(unit->IsCreature() && !unit->IsControlledByPlayer());
             bool result = path.CalculatePath(dest.x, dest.y, dest.z, forceDestination);
             if (result && !(path.GetPathType() & PATHFIND_NOPATH))
             {
@@ -156,6 +156,43 @@ namespace Movement
             WriteLinearPath(spline, data);
     }
 
+    std::size_t PacketBuilder::GetMonsterMoveSize(const MoveSpline& move_spline)
+    {
+        MoveSplineFlag const splineflags = move_spline.splineflags;
+
+        // unk byte, start point, spline id, facing type, flags, duration
+        std::size_t size = 1 + sizeof(float) * 3 + 4 + 1 + 4 + 4;
+        switch (splineflags & MoveSplineFlag::Mask_Final_Facing)
+        {
+            case MoveSplineFlag::Final_Target:
+                size += 8;
+                break;
+            case MoveSplineFlag::Final_Angle:
+                size += 4;
+                break;
+            case MoveSplineFlag::Final_Point:
+                size += sizeof(float) * 3;
+                break;
+            default:
+                break;
+        }
+
+        if (splineflags.animation)
+            size += 1 + 4;
+
+        if (splineflags.parabolic)
+            size += 4 + 4;
+
+        // point count, then full points for catmull-rom paths or the destination and packed offsets for linear ones
+        uint32 const count = move_spline.spline.getPointCount() - 3;
+        if (splineflags & MoveSplineFlag::Mask_CatmullRom)
+            size += 4 + sizeof(float) * 3 * (count + (splineflags.cyclic ? 1 : 0));
+        else
+            size += 4 + sizeof(float) * 3 + (count > 1 ? 4 * (count - 1) : 0);
+
+        return size;
+    }
+
     void PacketBuilder::WriteCreate(const MoveSpline& move_spline, ByteBuffer& data)
     {
         //WriteClientStatus(mov, data);
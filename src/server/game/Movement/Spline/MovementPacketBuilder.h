@@ -19,6 +19,7 @@
 #define AC_PACKET_BUILDER_H
 
 #include "Define.h"
+#include <cstddef>
 
 class ByteBuffer;
 namespace G3D
@@ -36,6 +37,8 @@ namespace Movement
         static void WriteCommonMonsterMovePart(const MoveSpline& mov, ByteBuffer& data);
     public:
         static void WriteMonsterMove(const MoveSpline& mov, ByteBuffer& data);
+        // bytes written by WriteMonsterMove, to size the packet before writing it
+        static std::size_t GetMonsterMoveSize(const MoveSpline& mov);
         static void WriteStopMovement(Vector3 const& loc, uint32 splineId, ByteBuffer& data);
         static void WriteCreate(const MoveSpline& mov, ByteBuffer& data);
     };
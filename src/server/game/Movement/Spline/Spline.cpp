@@ -16,7 +16,6 @@
  */
 
 #include "Spline.h"
-#include <G3D/Matrix4.h>
 #include <sstream>
 
 namespace Movement
@@ -38,6 +37,14 @@ namespace Movement
         &SplineBase::UninitializedSplineEvaluationMethod,
     };
 
+    SplineBase::EvaluationWithDerivativeMethtod SplineBase::evaluators_with_derivative[SplineBase::ModesEnd] =
+    {
+        &SplineBase::EvaluateWithDerivativeLinear,
+        &SplineBase::EvaluateWithDerivativeCatmullRom,
+        &SplineBase::EvaluateWithDerivativeBezier3,
+        &SplineBase::UninitializedSplineEvaluationWithDerivativeMethod,
+    };
+
     SplineBase::SegLenghtMethtod SplineBase::seglengths[SplineBase::ModesEnd] =
     {
         &SplineBase::SegLengthLinear,
@@ -57,59 +64,52 @@ namespace Movement
 
     ///////////
 
-    using G3D::Matrix4;
-    static const Matrix4 s_catmullRomCoeffs(
-        -0.5f, 1.5f, -1.5f, 0.5f,
-        1.f, -2.5f, 2.f, -0.5f,
-        -0.5f, 0.f,  0.5f, 0.f,
-        0.f,  1.f,  0.f,  0.f);
-
-    static const Matrix4 s_Bezier3Coeffs(
-        -1.f,  3.f, -3.f, 1.f,
-        3.f, -6.f,  3.f, 0.f,
-        -3.f,  3.f,  0.f, 0.f,
-        1.f,  0.f,  0.f, 0.f);
-
-    /*  classic view:
-    inline void C_Evaluate(Vector3 const* vertice, float t, const float (&matrix)[4][4], Vector3 &position)
-    {
-        Vector3 tvec(t*t*t, t*t, t);
-        int i = 0;
-        double c;
-        double x = 0, y = 0, z = 0;
-        while ( i < 4 )
-        {
-            c = matrix[0][i]*tvec.x + matrix[1][i]*tvec.y + matrix[2][i]*tvec.z + matrix[3][i];
+    /*  the weights of the 4 control points are the rows of the coefficient matrices
+        multiplied by (t^3, t^2, t, 1), or by (3t^2, 2t, 1, 0) for the derivative:
 
-            x += c * vertice->x;
-            y += c * vertice->y;
-            z += c * vertice->z;
+        catmull-rom             bezier3
+        -0.5  1.5 -1.5  0.5     -1  3 -3  1
+         1   -2.5  2   -0.5      3 -6  3  0
+        -0.5  0    0.5  0       -3  3  0  0
+         0    1    0    0        1  0  0  0
 
-            ++i;
-            ++vertice;
-        }
+        they are expanded here, as position and derivative are evaluated for every moving unit each update
+    */
+    struct SplineWeights
+    {
+        float w[4];
+    };
 
-        position.x = x;
-        position.y = y;
-        position.z = z;
-    }*/
+    inline SplineWeights CatmullRomWeights(float t)
+    {
+        float const t2 = t * t;
+        float const t3 = t2 * t;
+        return { { -0.5f * t3 + t2 - 0.5f * t, 1.5f * t3 - 2.5f * t2 + 1.f, -1.5f * t3 + 2.f * t2 + 0.5f * t, 0.5f * t3 - 0.5f * t2 } };
+    }
 
-    inline void C_Evaluate(const Vector3* vertice, float t, const Matrix4& matr, Vector3& result)
+    inline SplineWeights CatmullRomDerivativeWeights(float t)
     {
-        Vector4 tvec(t * t * t, t * t, t, 1.f);
-        Vector4 weights(tvec * matr);
+        float const t2 = t * t;
+        return { { -1.5f * t2 + 2.f * t - 0.5f, 4.5f * t2 - 5.f * t, -4.5f * t2 + 4.f * t + 0.5f, 1.5f * t2 - t } };
+    }
 
-        result = vertice[0] * weights[0] + vertice[1] * weights[1]
-                 + vertice[2] * weights[2] + vertice[3] * weights[3];
+    inline SplineWeights Bezier3Weights(float t)
+    {
+        float const t2 = t * t;
+        float const t3 = t2 * t;
+        return { { -t3 + 3.f * t2 - 3.f * t + 1.f, 3.f * t3 - 6.f * t2 + 3.f * t, -3.f * t3 + 3.f * t2, t3 } };
     }
 
-    inline void C_Evaluate_Derivative(const Vector3* vertice, float t, const Matrix4& matr, Vector3& result)
+    inline SplineWeights Bezier3DerivativeWeights(float t)
     {
-        Vector4 tvec(3.f * t * t, 2.f * t, 1.f, 0.f);
-        Vector4 weights(tvec * matr);
+        float const t2 = t * t;
+        return { { -3.f * t2 + 6.f * t - 3.f, 9.f * t2 - 12.f * t + 3.f, -9.f * t2 + 6.f * t, 3.f * t2 } };
+    }
 
-        result = vertice[0] * weights[0] + vertice[1] * weights[1]
-                 + vertice[2] * weights[2] + vertice[3] * weights[3];
+    inline void C_Evaluate(const Vector3* vertice, SplineWeights const& weights, Vector3& result)
+    {
+        result = vertice[0] * weights.w[0] + vertice[1] * weights.w[1]
+                 + vertice[2] * weights.w[2] + vertice[3] * weights.w[3];
     }
 
     void SplineBase::EvaluateLinear(index_type index, float u, Vector3& result) const
@@ -121,14 +121,14 @@ namespace Movement
     void SplineBase::EvaluateCatmullRom( index_type index, float t, Vector3& result) const
     {
         ASSERT(index >= index_lo && index < index_hi);
-        C_Evaluate(&points[index - 1], t, s_catmullRomCoeffs, result);
+        C_Evaluate(&points[index - 1], CatmullRomWeights(t), result);
     }
 
     void SplineBase::EvaluateBezier3(index_type index, float t, Vector3& result) const
     {
         index *= 3u;
         ASSERT(index >= index_lo && index < index_hi);
-        C_Evaluate(&points[index], t, s_Bezier3Coeffs, result);
+        C_Evaluate(&points[index], Bezier3Weights(t), result);
     }
 
     void SplineBase::EvaluateDerivativeLinear(index_type index, float, Vector3& result) const
@@ -140,14 +140,36 @@ namespace Movement
     void SplineBase::EvaluateDerivativeCatmullRom(index_type index, float t, Vector3& result) const
     {
         ASSERT(index >= index_lo && index < index_hi);
-        C_Evaluate_Derivative(&points[index - 1], t, s_catmullRomCoeffs, result);
+        C_Evaluate(&points[index - 1], CatmullRomDerivativeWeights(t), result);
     }
 
     void SplineBase::EvaluateDerivativeBezier3(index_type index, float t, Vector3& result) const
     {
         index *= 3u;
         ASSERT(index >= index_lo && index < index_hi);
-        C_Evaluate_Derivative(&points[index], t, s_Bezier3Coeffs, result);
+        C_Evaluate(&points[index], Bezier3DerivativeWeights(t), result);
+    }
+
+    void SplineBase::EvaluateWithDerivativeLinear(index_type index, float u, Vector3& result, Vector3& hermite) const
+    {
+        ASSERT(index >= index_lo && index < index_hi);
+        hermite = points[index + 1] - points[index];
+        result = points[index] + hermite * u;
+    }
+
+    void SplineBase::EvaluateWithDerivativeCatmullRom(index_type index, float t, Vector3& result, Vector3& hermite) const
+    {
+        ASSERT(index >= index_lo && index < index_hi);
+        C_Evaluate(&points[index - 1], CatmullRomWeights(t), result);
+        C_Evaluate(&points[index - 1], CatmullRomDerivativeWeights(t), hermite);
+    }
+
+    void SplineBase::EvaluateWithDerivativeBezier3(index_type index, float t, Vector3& result, Vector3& hermite) const
+    {
+        index *= 3u;
+        ASSERT(index >= index_lo && index < index_hi);
+        C_Evaluate(&points[index], Bezier3Weights(t), result);
+        C_Evaluate(&points[index], Bezier3DerivativeWeights(t), hermite);
     }
 
     float SplineBase::SegLengthLinear(index_type index) const
@@ -168,7 +190,7 @@ namespace Movement
         double length = 0;
         while (i <= STEPS_PER_SEGMENT)
         {
-            C_Evaluate(p, float(i) / float(STEPS_PER_SEGMENT), s_catmullRomCoeffs, nextPos);
+            C_Evaluate(p, CatmullRomWeights(float(i) / float(STEPS_PER_SEGMENT)), nextPos);
             length += (nextPos - curPos).length();
             curPos = nextPos;
             ++i;
@@ -184,14 +206,14 @@ namespace Movement
         Vector3 curPos, nextPos;
         const Vector3* p = &points[index];
 
-        C_Evaluate(p, 0.f, s_Bezier3Coeffs, nextPos);
+        C_Evaluate(p, Bezier3Weights(0.f), nextPos);
         curPos = nextPos;
 
         index_type i = 1;
         double length = 0;
         while (i <= STEPS_PER_SEGMENT)
         {
-            C_Evaluate(p, float(i) / float(STEPS_PER_SEGMENT), s_Bezier3Coeffs, nextPos);
+            C_Evaluate(p, Bezier3Weights(float(i) / float(STEPS_PER_SEGMENT)), nextPos);
             length += (nextPos - curPos).length();
             curPos = nextPos;
             ++i;
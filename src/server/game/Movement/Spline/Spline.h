@@ -72,6 +72,12 @@ namespace Movement
         void EvaluateDerivativeBezier3(index_type, float, Vector3&) const;
         static EvaluationMethtod derivative_evaluators[ModesEnd];
 
+        void EvaluateWithDerivativeLinear(index_type, float, Vector3&, Vector3&) const;
+        void EvaluateWithDerivativeCatmullRom(index_type, float, Vector3&, Vector3&) const;
+        void EvaluateWithDerivativeBezier3(index_type, float, Vector3&, Vector3&) const;
+        typedef void (SplineBase::*EvaluationWithDerivativeMethtod)(index_type, float, Vector3&, Vector3&) const;
+        static EvaluationWithDerivativeMethtod evaluators_with_derivative[ModesEnd];
+
         [[nodiscard]] float SegLengthLinear(index_type) const;
         [[nodiscard]] float SegLengthCatmullRom(index_type) const;
         [[nodiscard]] float SegLengthBezier3(index_type) const;
@@ -85,6 +91,7 @@ namespace Movement
         static InitMethtod initializers[ModesEnd];
 
         void UninitializedSplineEvaluationMethod(index_type, float, Vector3&) const { ABORT(); }
+        void UninitializedSplineEvaluationWithDerivativeMethod(index_type, float, Vector3&, Vector3&) const { ABORT(); }
         [[nodiscard]] float UninitializedSplineSegLenghtMethod(index_type) const { ABORT(); }
         void UninitializedSplineInitMethod(Vector3 const*, index_type, bool, index_type) { ABORT(); }
 
@@ -103,6 +110,9 @@ namespace Movement
          */
         void evaluate_derivative(index_type Idx, float u, Vector3& hermite) const {(this->*derivative_evaluators[m_mode])(Idx, u, hermite);}
 
+        /** Caclulates position and derivation in index Idx in one pass, see evaluate_percent and evaluate_derivative */
+        void evaluate_percent_and_derivative(index_type Idx, float u, Vector3& c, Vector3& hermite) const {(this->*evaluators_with_derivative[m_mode])(Idx, u, c, hermite);}
+
         /**  Bounds for spline indexes. All indexes should be in range [first, last). */
         [[nodiscard]] index_type first() const { return index_lo;}
         [[nodiscard]] index_type last()  const { return index_hi;}
@@ -99,6 +99,7 @@ void WaypointMgr::Load()
 
     for (auto itr = _waypointStore.begin(); itr != _waypointStore.end(); )
     {
+        itr->second.shrink_to_fit();
         uint32 first = itr->second.begin()->first;
         uint32 last = itr->second.rbegin()->first;
         if (last - first + 1 != itr->second.size())
@@ -167,4 +168,6 @@ void WaypointMgr::ReloadPath(uint32 id)
 
         path.emplace(data.id, data);
     } while (result->NextRow());
+
+    path.shrink_to_fit();
 }
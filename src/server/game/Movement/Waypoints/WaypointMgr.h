@@ -19,10 +19,11 @@
 #define ACORE_WAYPOINTMANAGER_H
 
 #include "Define.h"
+#include <algorithm>
 #include <optional>
 #include <unordered_map>
+#include <utility>
 #include <vector>
-#include <map>
 
 enum WaypointMoveType
 {
@@ -45,7 +46,62 @@ struct WaypointData
     uint8 event_chance = 0;
 };
 
-typedef std::map<uint32, WaypointData> WaypointPath;
+// Points of a path sorted by point id in a single array. Point ids are
+// contiguous in nearly every path, so lookups index the array directly.
+class WaypointPath
+{
+public:
+    typedef std::pair<uint32, WaypointData> value_type;
+    typedef std::vector<value_type>::const_iterator const_iterator;
+    typedef std::vector<value_type>::const_reverse_iterator const_reverse_iterator;
+
+    [[nodiscard]] const_iterator begin() const { return _nodes.begin(); }
+    [[nodiscard]] const_iterator end() const { return _nodes.end(); }
+    [[nodiscard]] const_reverse_iterator rbegin() const { return _nodes.rbegin(); }
+    [[nodiscard]] const_reverse_iterator rend() const { return _nodes.rend(); }
+    [[nodiscard]] std::size_t size() const { return _nodes.size(); }
+    [[nodiscard]] bool empty() const { return _nodes.empty(); }
+
+    [[nodiscard]] const_iterator find(uint32 id) const
+    {
+        if (_nodes.empty() || id < _nodes.front().first)
+            return end();
+
+        std::size_t const index = id - _nodes.front().first;
+        if (index < _nodes.size() && _nodes[index].first == id)
+            return begin() + index;
+
+        const_iterator itr = LowerBound(id);
+        return itr != end() && itr->first == id ? itr : end();
+    }
+
+    // keeps the existing point when the id is already used, like std::map::emplace
+    void emplace(uint32 id, WaypointData const& data)
+    {
+        if (_nodes.empty() || _nodes.back().first < id)
+        {
+            _nodes.emplace_back(id, data);
+            return;
+        }
+
+        const_iterator itr = LowerBound(id);
+        if (itr->first != id)
+            _nodes.emplace(itr, id, data);
+    }
+
+    void reserve(std::size_t count) { _nodes.reserve(count); }
+    void shrink_to_fit() { _nodes.shrink_to_fit(); }
+    void clear() { _nodes.clear(); }
+
+private:
+    [[nodiscard]] const_iterator LowerBound(uint32 id) const
+    {
+        return std::lower_bound(_nodes.begin(), _nodes.end(), id, [](value_type const& node, uint32 key) { return node.first < key; });
+    }
+
+    std::vector<value_type> _nodes;
+};
+
 typedef std::unordered_map<uint32, WaypointPath> WaypointPathContainer;
 
 class WaypointMgr
@@ -278,6 +278,7 @@ OutdoorPvP::~OutdoorPvP()
 void OutdoorPvP::HandlePlayerEnterZone(Player* player, uint32 /*zone*/)
 {
     _players[player->GetTeamId()].insert(player->GetGUID());
+    QueueRelocation(player->GetGUID());
 }
 
 void OutdoorPvP::HandlePlayerLeaveZone(Player* player, uint32 /*zone*/)
@@ -286,6 +287,7 @@ void OutdoorPvP::HandlePlayerLeaveZone(Player* player, uint32 /*zone*/)
     for (auto& _capturePoint : _capturePoints)
     {
         _capturePoint.second->HandlePlayerLeave(player);
+        _capturePoint.second->RemovePlayerInRange(player->GetGUID());
     }
 
     // remove the world state information from the player (we can't keep everyone up to date, so leave out those who are not in the concerning zones)
@@ -314,13 +316,52 @@ bool OutdoorPvP::Update(uint32 diff)
     return objective_changed;
 }
 
-bool OPvPCapturePoint::Update(uint32 diff)
+void OutdoorPvP::HandlePlayerRelocation(Player* player)
+{
+    if (_capturePoints.empty())
+        return;
+
+    QueueRelocation(player->GetGUID());
+}
+
+void OutdoorPvP::QueueRelocation(ObjectGuid guid)
+{
+    std::lock_guard<std::mutex> guard(_relocationLock);
+    _relocatedPlayers.insert(guid);
+}
+
+void OutdoorPvP::ProcessRelocations()
+{
+    GuidUnorderedSet relocatedPlayers;
+    {
+        std::lock_guard<std::mutex> guard(_relocationLock);
+        relocatedPlayers.swap(_relocatedPlayers);
+    }
+
+    for (ObjectGuid const& playerGuid : relocatedPlayers)
+    {
+        Player* player = ObjectAccessor::FindPlayer(playerGuid);
+        if (!player || !HasPlayer(player))
+            continue;
+
+        for (auto& capturePoint : _capturePoints)
+            capturePoint.second->HandlePlayerRelocation(player);
+    }
+}
+
+void OPvPCapturePoint::HandlePlayerRelocation(Player* player)
 {
     if (!_capturePoint)
-        return false;
+        return;
 
-    auto radius = (float)_capturePoint->GetGOInfo()->capturePoint.radius;
+    if (_capturePoint->IsWithinDistInMap(player, (float)_capturePoint->GetGOInfo()->capturePoint.radius))
+        _playersInRange.insert(player->GetGUID());
+    else
+        _playersInRange.erase(player->GetGUID());
+}
 
+void OPvPCapturePoint::UpdateActivePlayers()
+{
     for (auto const& activePlayer : _activePlayers)
     {
         for (auto itr = activePlayer.begin(); itr != activePlayer.end();)
@@ -329,25 +370,25 @@ bool OPvPCapturePoint::Update(uint32 diff)
             ++itr;
 
             if (Player* player = ObjectAccessor::FindPlayer(playerGuid))
-                if (!_capturePoint->IsWithinDistInMap(player, radius) || !player->IsOutdoorPvPActive())
+                if (!_playersInRange.count(playerGuid) || !player->IsOutdoorPvPActive())
                     HandlePlayerLeave(player);
         }
     }
 
-    std::list<Player*> players;
-    Acore::AnyPlayerInObjectRangeCheck checker(_capturePoint, radius);
-    Acore::PlayerListSearcher<Acore::AnyPlayerInObjectRangeCheck> searcher(_capturePoint, players, checker);
-    Cell::VisitObjects(_capturePoint, searcher, radius);
-
-    for (auto& itr : players)
+    for (ObjectGuid const& playerGuid : _playersInRange)
     {
-        Player* const player = itr;
-        if (player->IsOutdoorPvPActive())
-        {
-            if (_activePlayers[player->GetTeamId()].insert(player->GetGUID()).second)
-                HandlePlayerEnter(itr);
-        }
+        if (Player* player = ObjectAccessor::FindPlayer(playerGuid))
+            if (player->IsOutdoorPvPActive() && _activePlayers[player->GetTeamId()].insert(playerGuid).second)
+                HandlePlayerEnter(player);
     }
+}
+
+bool OPvPCapturePoint::Update(uint32 diff)
+{
+    if (!_capturePoint)
+        return false;
+
+    UpdateActivePlayers();
 
     // get the difference of numbers
     float factDiff = (((float)_activePlayers[0].size() - (float)_activePlayers[1].size()) * float(diff) / OUTDOORPVP_OBJECTIVE_UPDATE_INTERVAL) * sWorld->getFloatConfig(CONFIG_OUTDOOR_PVP_CAPTURE_RATE);
@@ -687,6 +728,11 @@ void OutdoorPvP::OnGameObjectCreate(GameObject* go)
     if (OPvPCapturePoint* cp = GetCapturePoint(go->GetSpawnId()))
     {
         cp->_capturePoint = go;
+
+        // the players already in the zone are only checked against the new capture point once they move
+        for (PlayerSet const& players : _players)
+            for (ObjectGuid const& playerGuid : players)
+                QueueRelocation(playerGuid);
     }
 }
 
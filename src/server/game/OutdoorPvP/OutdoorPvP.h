@@ -22,6 +22,7 @@
 #include "ZoneScript.h"
 #include "WorldStatePackets.h"
 #include <array>
+#include <mutex>
 
 class GameObject;
 
@@ -108,6 +109,10 @@ public:
     // checks if player is in range of a capture credit marker
     bool IsInsideObjective(Player* player) const;
 
+    // rechecks if a moved player of the zone is within the capture radius
+    void HandlePlayerRelocation(Player* player);
+    void RemovePlayerInRange(ObjectGuid guid) { _playersInRange.erase(guid); }
+
     virtual bool HandleCustomSpell(Player* player, uint32 spellId, GameObject* go);
 
     virtual int32 HandleOpenGo(Player* player, GameObject* go);
@@ -146,10 +151,16 @@ protected:
     bool DelObject(uint32 type);
     bool DelCapturePoint();
 
+    // activates the players within the capture radius and deactivates the others
+    void UpdateActivePlayers();
+
 protected:
     // active players in the area of the objective, 0 - alliance, 1 - horde
     std::array<PlayerSet, 2> _activePlayers;
 
+    // players within the capture radius, kept up to date by HandlePlayerRelocation
+    PlayerSet _playersInRange;
+
     // total shift needed to capture the objective
     float _maxValue{};
     float _minValue{};
@@ -225,6 +236,12 @@ public:
     // called by OutdoorPvPMgr, updates the objectives and if needed, sends new worldstateui information
     virtual bool Update(uint32 diff);
 
+    // called from the map update when a player of the zone moves
+    void HandlePlayerRelocation(Player* player);
+
+    // called by OutdoorPvPMgr before Update, passes the moved players to the objectives
+    void ProcessRelocations();
+
     // handle npc/player kill
     virtual void HandleKill(Player* killer, Unit* killed);
     virtual void HandleKillImpl(Player* /*killer*/, Unit* /*killed*/) {}
@@ -272,6 +289,12 @@ protected:
     Map* _map{};
     std::unordered_map<ObjectGuid::LowType, GameObject*> _goScriptStore;
     std::unordered_map<ObjectGuid::LowType, Creature*> _creatureScriptStore;
+
+private:
+    void QueueRelocation(ObjectGuid guid);
+
+    std::mutex _relocationLock;
+    GuidUnorderedSet _relocatedPlayers;
 };
 
 #endif /*OUTDOOR_PVP_H_*/
@@ -163,6 +163,7 @@ void OutdoorPvPMgr::Update(uint32 diff)
     {
         for (auto const& itr : m_OutdoorPvPSet)
         {
+            itr->ProcessRelocations();
             itr->Update(m_UpdateTimer);
         }
 
@@ -159,6 +159,18 @@ bool PoolGroup<T>::CheckPool() const
 template<class T>
 void PoolGroup<T>::DespawnObject(ActivePoolData& spawns, ObjectGuid::LowType guid)
 {
+    // respawn case, only the given object needs a look
+    if (guid)
+    {
+        if (spawns.IsActiveObject<T>(guid) && sPoolMgr->IsPartOfAPool<T>(guid) == poolId)
+        {
+            Despawn1Object(guid);
+            spawns.RemoveObject<T>(guid, poolId);
+        }
+
+        return;
+    }
+
     for (std::size_t i = 0; i < EqualChanced.size(); ++i)
     {
         // if spawned
@@ -341,12 +353,34 @@ void PoolGroup<T>::SpawnObject(ActivePoolData& spawns, uint32 limit, uint32 trig
 
         if (!EqualChanced.empty() && rolledObjects.empty())
         {
-            std::copy_if(EqualChanced.begin(), EqualChanced.end(), std::back_inserter(rolledObjects), [triggerFrom, &spawns](PoolObject const& object)
+            auto canSpawn = [triggerFrom, &spawns](PoolObject const& object)
             {
                  return object.guid == triggerFrom || !spawns.IsActiveObject<T>(object.guid);
-            });
+            };
 
-            Acore::Containers::RandomResize(rolledObjects, count);
+            // Pools usually have many more members than spawns, so random members are drawn until enough
+            // free ones are found, without a scan of the whole pool. Each pick is uniform among the free
+            // members left, like the subset kept by RandomResize.
+            uint32 const tries = uint32(count) * 4;
+            for (uint32 i = 0; i < tries && rolledObjects.size() < std::size_t(count); ++i)
+            {
+                PoolObject const& obj = Acore::Containers::SelectRandomContainerElement(EqualChanced);
+                if (!canSpawn(obj))
+                    continue;
+
+                if (std::find_if(rolledObjects.begin(), rolledObjects.end(), [&obj](PoolObject const& rolled) { return rolled.guid == obj.guid; }) != rolledObjects.end())
+                    continue;
+
+                rolledObjects.push_back(obj);
+            }
+
+            // nearly full pool, or fewer free members than requested
+            if (rolledObjects.size() < std::size_t(count))
+            {
+                rolledObjects.clear();
+                std::copy_if(EqualChanced.begin(), EqualChanced.end(), std::back_inserter(rolledObjects), canSpawn);
+                Acore::Containers::RandomResize(rolledObjects, count);
+            }
         }
 
         // try to spawn rolled objects
@@ -40,7 +40,7 @@ class Pool                                                  // for Pool of Pool
 };
 
 typedef std::unordered_set<uint32> ActivePoolObjects;
-typedef std::map<uint32, uint32> ActivePoolPools;
+typedef std::unordered_map<uint32, uint32> ActivePoolPools;
 
 class ActivePoolData
 {
@@ -144,7 +144,7 @@ private:
     typedef std::unordered_map<uint32, PoolGroup<Pool>>       PoolGroupPoolMap;
     typedef std::unordered_map<uint32, PoolGroup<Quest>>      PoolGroupQuestMap;
     typedef std::pair<uint32, uint32>           SearchPair;
-    typedef std::map<uint32, uint32>            SearchMap;
+    typedef std::unordered_map<uint32, uint32>  SearchMap;
 
     PoolTemplateDataMap    mPoolTemplate;
     PoolGroupCreatureMap   mPoolCreatureGroups;
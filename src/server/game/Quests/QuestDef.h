@@ -326,9 +326,6 @@ public:
     typedef std::vector<uint32> PrevChainQuests;
     PrevChainQuests prevChainQuests;
 
-    WorldPacket queryData; // pussywizard
-    void InitializeQueryData(); // pussywizard
-
     void SetEventIdForQuest(uint16 eventId) { _eventIdForQuest = eventId; }
     [[nodiscard]] uint16 GetEventIdForQuest() const { return _eventIdForQuest; }
 
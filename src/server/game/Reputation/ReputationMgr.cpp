@@ -249,6 +249,24 @@ void ReputationMgr::SendStates()
         SendState(&(itr->second));
 }
 
+void ReputationMgr::SendPendingStates()
+{
+    if (!_sendStatesPending)
+        return;
+
+    _sendStatesPending = false;
+
+    // SendState includes every other faction flagged for sending
+    for (FactionStateList::iterator itr = _factions.begin(); itr != _factions.end(); ++itr)
+    {
+        if (itr->second.needSend)
+        {
+            SendState(&(itr->second));
+            return;
+        }
+    }
+}
+
 void ReputationMgr::SendVisible(FactionState const* faction) const
 {
     if (_player->GetSession()->PlayerLoading())
@@ -370,7 +388,9 @@ bool ReputationMgr::SetReputation(FactionEntry const* factionEntry, float standi
         }
 
         // only this faction gets reported to client, even if it has no own visible standing
-        SendState(&faction->second);
+        // kills of a whole pull are reported together at the next player update
+        faction->second.needSend = true;
+        _sendStatesPending = true;
     }
     return res;
 }
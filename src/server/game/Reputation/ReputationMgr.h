@@ -57,7 +57,7 @@ class ReputationMgr
 {
 public:                                                 // constructors and global modifiers
     explicit ReputationMgr(Player* owner) : _player(owner),
-        _visibleFactionCount(0), _honoredFactionCount(0), _reveredFactionCount(0), _exaltedFactionCount(0), _sendFactionIncreased(false) {}
+        _visibleFactionCount(0), _honoredFactionCount(0), _reveredFactionCount(0), _exaltedFactionCount(0), _sendFactionIncreased(false), _sendStatesPending(false) {}
     ~ReputationMgr() {}
 
     void SaveToDB(CharacterDatabaseTransaction trans);
@@ -134,6 +134,8 @@ public:                                                 // senders
     void SendForceReactions();
     void SendState(FactionState const* faction);
     void SendStates();
+    //! Sends the standings changed since the last update in a single SMSG_SET_FACTION_STANDING
+    void SendPendingStates();
 
 private:                                                // internal helper functions
     void Initialize();
@@ -153,6 +155,7 @@ private:
     uint8 _reveredFactionCount : 8;
     uint8 _exaltedFactionCount : 8;
     bool _sendFactionIncreased; //! Play visual effect on next SMSG_SET_FACTION_STANDING sent
+    bool _sendStatesPending;    //! Reputation changed, standings are sent at the next player update
 };
 
 #endif
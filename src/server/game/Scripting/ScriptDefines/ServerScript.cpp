@@ -55,6 +55,11 @@ bool ScriptMgr::CanPacketSend(WorldSession* session, WorldPacket const& packet)
     CALL_ENABLED_BOOLEAN_HOOKS(ServerScript, SERVERHOOK_CAN_PACKET_SEND, !script->CanPacketSend(session, copy));
 }
 
+bool ScriptMgr::HasPacketSendHooks() const
+{
+    return !ScriptRegistry<ServerScript>::EnabledHooks[SERVERHOOK_CAN_PACKET_SEND].empty();
+}
+
 bool ScriptMgr::CanPacketReceive(WorldSession* session, WorldPacket const& packet)
 {
     if (ScriptRegistry<ServerScript>::ScriptPointerList.empty())
@@ -19,6 +19,7 @@
 #include "AllScriptsObjects.h"
 #include "InstanceScript.h"
 #include "LFGScripts.h"
+#include "Metric.h"
 #include "ScriptSystem.h"
 #include "SmartAI.h"
 #include "SpellMgr.h"
@@ -36,6 +37,16 @@ namespace
 
         ScriptRegistry<T>::ScriptPointerList.clear();
     }
+
+    template<typename T>
+    inline void CollectHookProfiles(std::string_view type, std::vector<ScriptMgr::HookProfileInfo>& profiles)
+    {
+        for (std::size_t hook = 0; hook < ScriptRegistry<T>::EnabledHooks.size(); ++hook)
+            for (T* script : ScriptRegistry<T>::EnabledHooks[hook])
+                if (ScriptObject::HookProfile* profile = script->GetHookProfile(uint16(hook)))
+                    if (profile->Calls.load(std::memory_order_relaxed))
+                        profiles.push_back({ type, script, uint16(hook), profile });
+    }
 }
 
 struct TSpellSummary
@@ -44,6 +55,9 @@ struct TSpellSummary
     uint8 Effects; // set of enum SelectEffect
 }*SpellSummary;
 
+std::atomic<bool> ScriptMgr::_hookProfiling(false);
+std::atomic<bool> ScriptMgr::_hookMetrics(false);
+
 ScriptMgr::ScriptMgr()
     : _scriptCount(0),
     _scheduledScripts(0),
@@ -158,6 +172,72 @@ void ScriptMgr::Unload()
     delete[] SpellSummary;
 }
 
+std::vector<ScriptMgr::HookProfileInfo> ScriptMgr::GetHookProfiles() const
+{
+    std::vector<HookProfileInfo> profiles;
+    CollectHookProfiles<AccountScript>("AccountScript", profiles);
+    CollectHookProfiles<AchievementScript>("AchievementScript", profiles);
+    CollectHookProfiles<ArenaScript>("ArenaScript", profiles);
+    CollectHookProfiles<ArenaTeamScript>("ArenaTeamScript", profiles);
+    CollectHookProfiles<AuctionHouseScript>("AuctionHouseScript", profiles);
+    CollectHookProfiles<BGScript>("BGScript", profiles);
+    CollectHookProfiles<CommandSC>("CommandSC", profiles);
+    CollectHookProfiles<DatabaseScript>("DatabaseScript", profiles);
+    CollectHookProfiles<FormulaScript>("FormulaScript", profiles);
+    CollectHookProfiles<GameEventScript>("GameEventScript", profiles);
+    CollectHookProfiles<GlobalScript>("GlobalScript", profiles);
+    CollectHookProfiles<GroupScript>("GroupScript", profiles);
+    CollectHookProfiles<GuildScript>("GuildScript", profiles);
+    CollectHookProfiles<LootScript>("LootScript", profiles);
+    CollectHookProfiles<MailScript>("MailScript", profiles);
+    CollectHookProfiles<MiscScript>("MiscScript", profiles);
+    CollectHookProfiles<MovementHandlerScript>("MovementHandlerScript", profiles);
+    CollectHookProfiles<PetScript>("PetScript", profiles);
+    CollectHookProfiles<PlayerScript>("PlayerScript", profiles);
+    CollectHookProfiles<ServerScript>("ServerScript", profiles);
+    CollectHookProfiles<SpellSC>("SpellSC", profiles);
+    CollectHookProfiles<TicketScript>("TicketScript", profiles);
+    CollectHookProfiles<UnitScript>("UnitScript", profiles);
+    CollectHookProfiles<WorldObjectScript>("WorldObjectScript", profiles);
+    CollectHookProfiles<WorldScript>("WorldScript", profiles);
+    CollectHookProfiles<AllMapScript>("AllMapScript", profiles);
+    return profiles;
+}
+
+void ScriptMgr::ResetHookProfiles()
+{
+    for (HookProfileInfo const& info : GetHookProfiles())
+    {
+        info.Profile->Calls.store(0, std::memory_order_relaxed);
+        info.Profile->Time.store(0, std::memory_order_relaxed);
+        info.Profile->ReportedCalls = 0;
+    }
+}
+
+void ScriptMgr::LogHookMetrics()
+{
+#if defined PERFORMANCE_PROFILING || defined WITHOUT_METRICS
+    _hookMetrics.store(false, std::memory_order_relaxed);
+#else
+    _hookMetrics.store(sMetric->IsEnabled(), std::memory_order_relaxed);
+    if (!sMetric->IsEnabled())
+        return;
+
+    for (HookProfileInfo const& info : GetHookProfiles())
+    {
+        uint64 const calls = info.Profile->Calls.load(std::memory_order_relaxed);
+        if (calls == info.Profile->ReportedCalls)
+            continue;
+
+        info.Profile->ReportedCalls = calls;
+        std::string const type(info.Type);
+        METRIC_VALUE("script_hook_calls", calls, METRIC_TAG("type", type), METRIC_TAG("script", info.Script->GetName()), METRIC_TAG("hook", std::to_string(info.Hook)));
+        METRIC_VALUE("script_hook_time", std::chrono::nanoseconds(info.Profile->Time.load(std::memory_order_relaxed)),
+            METRIC_TAG("type", type), METRIC_TAG("script", info.Script->GetName()), METRIC_TAG("hook", std::to_string(info.Hook)));
+    }
+#endif
+}
+
 void ScriptMgr::LoadDatabase()
 {
     uint32 oldMSTime = getMSTime();
@@ -160,6 +160,7 @@ public: /* ServerScript */
     void OnSocketClose(std::shared_ptr<WorldSocket> const& socket);
     bool CanPacketReceive(WorldSession* session, WorldPacket const& packet);
     bool CanPacketSend(WorldSession* session, WorldPacket const& packet);
+    bool HasPacketSendHooks() const;
 
 public: /* WorldScript */
     void OnLoadCustomDatabaseTable();
@@ -719,6 +720,27 @@ public: /* TicketScript */
     void OnTicketStatusUpdate(GmTicket* ticket);
     void OnTicketResolve(GmTicket* ticket);
 
+public: /* Hook profiling */
+
+    struct HookProfileInfo
+    {
+        std::string_view Type;
+        ScriptObject const* Script;
+        uint16 Hook;
+        ScriptObject::HookProfile* Profile;
+    };
+
+    /// Hook calls are timed per script while enabled, or while metrics are enabled.
+    static bool IsHookProfilingEnabled() { return _hookProfiling.load(std::memory_order_relaxed) || _hookMetrics.load(std::memory_order_relaxed); }
+    static void SetHookProfilingEnabled(bool enabled) { _hookProfiling.store(enabled, std::memory_order_relaxed); }
+
+    /// Returns the profile of every script hook which was called since the last reset.
+    std::vector<HookProfileInfo> GetHookProfiles() const;
+    void ResetHookProfiles();
+
+    /// Logs the cumulative calls and time of the script hooks called since the last log.
+    void LogHookMetrics();
+
 private:
     uint32 _scriptCount;
 
@@ -727,6 +749,9 @@ private:
 
     ScriptLoaderCallbackType _script_loader_callback;
     ModulesLoaderCallbackType _modules_loader_callback;
+
+    static std::atomic<bool> _hookProfiling;
+    static std::atomic<bool> _hookMetrics;
 };
 
 #define sScriptMgr ScriptMgr::instance()
@@ -758,6 +783,12 @@ public:
         EnabledHooks.resize(totalAvailableHooks);
     }
 
+    // Lets hot callers skip the call and the building of its arguments when no script listens to the hook.
+    static bool HasEnabledHooks(uint16 hookType)
+    {
+        return !EnabledHooks[hookType].empty();
+    }
+
     static void AddScript(TScript* const script, std::vector<uint16> enabledHooks = {})
     {
         ASSERT(script);
@@ -18,6 +18,7 @@
 #ifndef _SCRIPT_MGR_MACRO_H_
 #define _SCRIPT_MGR_MACRO_H_
 
+#include "Profiler.h"
 #include "ScriptMgr.h"
 
 template<typename ScriptName>
@@ -69,20 +70,47 @@ inline bool ReturnValidBool(Optional<bool> ret, bool need = false)
     return ret && *ret ? need : !need;
 }
 
+// Times one call of a script hook while hook profiling or metrics are enabled,
+// and records it as a profiler zone named after the script while a capture runs.
+class ScriptHookProfiler
+{
+public:
+    ScriptHookProfiler(ScriptObject const* script, uint16 hookType)
+        : _profile(ScriptMgr::IsHookProfilingEnabled() ? script->GetHookProfile(hookType) : nullptr), _startTime(_profile ? std::chrono::steady_clock::now() : TimePoint()),
+        _zone(script->GetName().c_str(), hookType) { }
+
+    ~ScriptHookProfiler()
+    {
+        if (!_profile)
+            return;
+
+        _profile->Calls.fetch_add(1, std::memory_order_relaxed);
+        _profile->Time.fetch_add(uint64(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _startTime).count()), std::memory_order_relaxed);
+    }
+
+    ScriptHookProfiler(ScriptHookProfiler const&) = delete;
+    ScriptHookProfiler& operator=(ScriptHookProfiler const&) = delete;
+
+private:
+    ScriptObject::HookProfile* _profile;
+    TimePoint _startTime;
+    ProfilerZone _zone;
+};
+
 #define CALL_ENABLED_HOOKS(scriptType, hookType, action) \
-    if (!ScriptRegistry<scriptType>::EnabledHooks[hookType].empty()) \
-        for (auto const& script : ScriptRegistry<scriptType>::EnabledHooks[hookType]) { action; }
+    if (ScriptRegistry<scriptType>::HasEnabledHooks(hookType)) \
+        for (auto const& script : ScriptRegistry<scriptType>::EnabledHooks[hookType]) { ScriptHookProfiler hookProfiler(script, hookType); action; }
 
 #define CALL_ENABLED_BOOLEAN_HOOKS(scriptType, hookType, action) \
-    if (ScriptRegistry<scriptType>::EnabledHooks[hookType].empty()) \
+    if (!ScriptRegistry<scriptType>::HasEnabledHooks(hookType)) \
         return true; \
-    for (auto const& script : ScriptRegistry<scriptType>::EnabledHooks[hookType]) { if (action) return false; } \
+    for (auto const& script : ScriptRegistry<scriptType>::EnabledHooks[hookType]) { ScriptHookProfiler hookProfiler(script, hookType); if (action) return false; } \
     return true;
 
 #define CALL_ENABLED_BOOLEAN_HOOKS_WITH_DEFAULT_FALSE(scriptType, hookType, action) \
-    if (ScriptRegistry<scriptType>::EnabledHooks[hookType].empty()) \
+    if (!ScriptRegistry<scriptType>::HasEnabledHooks(hookType)) \
         return false; \
-    for (auto const& script : ScriptRegistry<scriptType>::EnabledHooks[hookType]) { if (action) return true; } \
+    for (auto const& script : ScriptRegistry<scriptType>::EnabledHooks[hookType]) { ScriptHookProfiler hookProfiler(script, hookType); if (action) return true; } \
     return false;
 
 #endif // _SCRIPT_MGR_MACRO_H_
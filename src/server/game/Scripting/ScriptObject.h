@@ -19,6 +19,8 @@
 #define _SCRIPT_OBJECT_H_
 
 #include "ScriptObjectFwd.h"
+#include <atomic>
+#include <memory>
 #include <string>
 
 //#include "Duration.h"
@@ -54,8 +56,19 @@ public:
 
     [[nodiscard]] uint16 GetTotalAvailableHooks() { return _totalAvailableHooks; }
 
+    // Calls and time spent in one hook of this script, collected while hook profiling is enabled.
+    struct HookProfile
+    {
+        std::atomic<uint64> Calls{ 0 };
+        std::atomic<uint64> Time{ 0 }; // nanoseconds
+        uint64 ReportedCalls = 0;      // calls already sent to the metrics
+    };
+
+    [[nodiscard]] HookProfile* GetHookProfile(uint16 hookType) const { return _hookProfiles ? &_hookProfiles[hookType] : nullptr; }
+
 protected:
-    ScriptObject(const char* name, uint16 totalAvailableHooks = 0) : _name(std::string(name)), _totalAvailableHooks(totalAvailableHooks)
+    ScriptObject(const char* name, uint16 totalAvailableHooks = 0) : _name(std::string(name)), _totalAvailableHooks(totalAvailableHooks),
+        _hookProfiles(totalAvailableHooks ? std::make_unique<HookProfile[]>(totalAvailableHooks) : nullptr)
     {
     }
 
@@ -64,6 +77,7 @@ protected:
 private:
     const std::string _name;
     const uint16 _totalAvailableHooks;
+    std::unique_ptr<HookProfile[]> const _hookProfiles;
 };
 
 template<class TObject>
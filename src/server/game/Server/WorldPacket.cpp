@@ -0,0 +1,32 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldPacket.h"
+
+std::array<std::atomic<uint32>, NUM_OPCODE_HANDLERS> WorldPacketSizeHints::_averages = { };
+
+void WorldPacketSizeHints::Record(uint16 opcode, std::size_t size)
+{
+    if (opcode >= NUM_OPCODE_HANDLERS)
+        return;
+
+    // concurrent senders may lose a sample, which doesn't matter for an average
+    std::atomic<uint32>& average = _averages[opcode];
+    int64 const current = average.load(std::memory_order_relaxed);
+    int64 const sample = int64(std::min<std::size_t>(size, MaxHint));
+    average.store(uint32(current ? current + (sample - current) / 8 : std::max<int64>(sample, 1)), std::memory_order_relaxed);
+}
@@ -21,6 +21,36 @@
 #include "ByteBuffer.h"
 #include "Duration.h"
 #include "Opcodes.h"
+#include <array>
+#include <atomic>
+#include <memory>
+
+/*
+ * Running average of the size of the packets sent with each opcode.
+ * Packets created without an explicit size reserve a little more than it,
+ * instead of a flat 200 bytes which is too much for most packets and too
+ * few for updates, chat or lists.
+ */
+class AC_GAME_API WorldPacketSizeHints
+{
+public:
+    static constexpr std::size_t DefaultSize = 200;
+    static constexpr std::size_t MaxHint = 16384;
+
+    [[nodiscard]] static std::size_t Get(uint16 opcode)
+    {
+        if (opcode >= NUM_OPCODE_HANDLERS)
+            return DefaultSize;
+
+        uint32 const average = _averages[opcode].load(std::memory_order_relaxed);
+        return average ? std::min<std::size_t>(average + average / 4, MaxHint) : DefaultSize;
+    }
+
+    static void Record(uint16 opcode, std::size_t size);
+
+private:
+    static std::array<std::atomic<uint32>, NUM_OPCODE_HANDLERS> _averages;
+};
 
 class WorldPacket : public ByteBuffer
 {
@@ -28,7 +58,10 @@ public:
     // just container for later use
     WorldPacket() : ByteBuffer(0) { }
 
-    explicit WorldPacket(uint16 opcode, std::size_t res = 200) :
+    explicit WorldPacket(uint16 opcode) :
+        ByteBuffer(WorldPacketSizeHints::Get(opcode)), m_opcode(opcode) { }
+
+    WorldPacket(uint16 opcode, std::size_t res) :
         ByteBuffer(res), m_opcode(opcode) { }
 
     WorldPacket(WorldPacket&& packet) noexcept :
@@ -65,21 +98,36 @@ public:
     WorldPacket(uint16 opcode, MessageBuffer&& buffer) :
         ByteBuffer(std::move(buffer)), m_opcode(opcode) { }
 
-    void Initialize(uint16 opcode, std::size_t newres = 200)
+    void Initialize(uint16 opcode)
+    {
+        Initialize(opcode, WorldPacketSizeHints::Get(opcode));
+    }
+
+    void Initialize(uint16 opcode, std::size_t newres)
     {
         clear();
         _storage.reserve(newres);
         m_opcode = opcode;
     }
 
+    // queued packets are allocated by the network threads and freed by the world and map threads
+    static void* operator new(std::size_t size) { return Acore::BufferPool::Allocate(size); }
+    static void operator delete(void* ptr, std::size_t size) { Acore::BufferPool::Deallocate(ptr, size); }
+
     [[nodiscard]] uint16 GetOpcode() const { return m_opcode; }
     void SetOpcode(uint16 opcode) { m_opcode = opcode; }
 
     [[nodiscard]] TimePoint GetReceivedTime() const { return m_receivedTime; }
 
+    // Link of the receive queue of WorldSession
+    std::atomic<WorldPacket*> RecvQueueLink{ nullptr };
+
 protected:
     uint16 m_opcode{NULL_OPCODE};
     TimePoint m_receivedTime; // only set for a specific set of opcodes, for performance reasons.
 };
 
+// Immutable packet sent to several sessions, the sockets queue a reference instead of a copy
+typedef std::shared_ptr<WorldPacket const> SharedWorldPacket;
+
 #endif
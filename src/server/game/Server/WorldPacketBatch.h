@@ -0,0 +1,86 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _WORLDPACKETBATCH_H_
+#define _WORLDPACKETBATCH_H_
+
+#include "WorldPacket.h"
+
+/*
+ * Server packets written one after another into one buffer, each as its
+ * opcode, size and content. The socket still sends them as separate packets,
+ * a batch only saves copying and queueing every packet on its own.
+ */
+class WorldPacketBatch
+{
+public:
+    static constexpr std::size_t ENTRY_HEADER_SIZE = sizeof(uint16) + sizeof(uint32);
+
+    WorldPacketBatch() : _buffer(0), _count(0) { }
+
+    void Append(uint16 opcode, uint8 const* contents, std::size_t size)
+    {
+        _buffer << uint16(opcode) << uint32(size);
+        if (size)
+            _buffer.append(contents, size);
+
+        ++_count;
+    }
+
+    void Append(WorldPacket const& packet)
+    {
+        Append(packet.GetOpcode(), packet.empty() ? nullptr : packet.contents(), packet.size());
+    }
+
+    [[nodiscard]] bool IsEmpty() const { return !_count; }
+    [[nodiscard]] uint32 GetCount() const { return _count; }
+    [[nodiscard]] ByteBuffer const& GetBuffer() const { return _buffer; }
+
+    // Keeps the allocated storage for the next packets
+    void Clear()
+    {
+        _buffer.clear();
+        _count = 0;
+    }
+
+    // Calls visitor with the opcode, contents and size of every packet written into buffer, in order
+    template<class VISITOR>
+    static void ForEachPacket(ByteBuffer const& buffer, VISITOR&& visitor)
+    {
+        for (std::size_t pos = 0; pos + ENTRY_HEADER_SIZE <= buffer.size();)
+        {
+            uint16 const opcode = buffer.read<uint16>(pos);
+            uint32 const size = buffer.read<uint32>(pos + sizeof(uint16));
+            pos += ENTRY_HEADER_SIZE;
+
+            visitor(opcode, size ? buffer.contents() + pos : nullptr, size);
+            pos += size;
+        }
+    }
+
+    template<class VISITOR>
+    void ForEachPacket(VISITOR&& visitor) const
+    {
+        ForEachPacket(_buffer, std::forward<VISITOR>(visitor));
+    }
+
+private:
+    ByteBuffer _buffer;
+    uint32 _count;
+};
+
+#endif
@@ -25,6 +25,7 @@
 #include "BanMgr.h"
 #include "CharacterPackets.h"
 #include "Common.h"
+#include "CycleClock.h"
 #include "DatabaseEnv.h"
 #include "GameTime.h"
 #include "Group.h"
@@ -33,7 +34,9 @@
 #include "Hyperlinks.h"
 #include "Log.h"
 #include "MapMgr.h"
+#include "MapReplay.h"
 #include "Metric.h"
+#include "MetricRegistry.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "Opcodes.h"
@@ -41,6 +44,7 @@
 #include "PacketUtilities.h"
 #include "Pet.h"
 #include "Player.h"
+#include "Profiler.h"
 #include "QueryHolder.h"
 #include "ScriptMgr.h"
 #include "SocialMgr.h"
@@ -51,6 +55,7 @@
 #include "World.h"
 #include "WorldGlobals.h"
 #include "WorldPacket.h"
+#include "WorldPacketBatch.h"
 #include "WorldSocket.h"
 #include "WorldState.h"
 #include <zlib.h>
@@ -58,6 +63,40 @@
 namespace
 {
     std::string const DefaultPlayerName = "<none>";
+
+    constexpr uint32 MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE = 150;
+
+    // upper bounds in microseconds of the handler time buckets, the last bucket holds the slower calls
+    constexpr std::array<uint64, 3> OpcodeHandlerBucketBounds = { 50, 500, 5000 };
+
+    struct OpcodeHandlerStats
+    {
+        std::atomic<uint64> Calls;
+        std::atomic<uint64> Time;
+        std::array<std::atomic<uint64>, OpcodeHandlerBucketBounds.size() + 1> Buckets;
+    };
+
+    // zero initialized, over all sessions
+    std::array<OpcodeHandlerStats, NUM_OPCODE_HANDLERS> OpcodeStats;
+    std::atomic<bool> OpcodeMetricsEnabled(false);
+    std::atomic<uint64> DeferredSessionUpdates(0);
+
+    void RecordOpcodeHandlerTime(uint16 opcode, std::chrono::nanoseconds time)
+    {
+        if (opcode >= NUM_OPCODE_HANDLERS)
+            return;
+
+        OpcodeHandlerStats& stats = OpcodeStats[opcode];
+        stats.Calls.fetch_add(1, std::memory_order_relaxed);
+        stats.Time.fetch_add(time.count(), std::memory_order_relaxed);
+
+        uint64 const microseconds = std::chrono::duration_cast<std::chrono::microseconds>(time).count();
+        std::size_t bucket = 0;
+        while (bucket < OpcodeHandlerBucketBounds.size() && microseconds >= OpcodeHandlerBucketBounds[bucket])
+            ++bucket;
+
+        stats.Buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
 }
 
 bool MapSessionFilter::Process(WorldPacket* packet)
@@ -80,6 +119,11 @@ bool MapSessionFilter::Process(WorldPacket* packet)
     return player->IsInWorld();
 }
 
+bool SessionSafeFilter::Process(WorldPacket* packet)
+{
+    return opcodeTable[static_cast<OpcodeClient>(packet->GetOpcode())]->ProcessingPlace == PROCESS_SESSIONSAFE;
+}
+
 //we should process ALL packets when player is not in world/logged in
 //OR packet handler is not thread-safe!
 bool WorldSessionFilter::Process(WorldPacket* packet)
@@ -131,18 +175,24 @@ WorldSession::WorldSession(uint32 id, std::string&& name, uint32 accountFlags, s
     m_TutorialsChanged(false),
     recruiterId(recruiter),
     isRecruiter(isARecruiter),
+    _recvQueueSize(0),
+    _packetsPrepared(false),
     m_currentVendorEntry(0),
     _calendarEventCreationCooldown(0),
     _addonMessageReceiveCount(0),
     _timeSyncClockDeltaQueue(6),
     _timeSyncClockDelta(0),
     _pendingTimeSyncRequests(),
-    _orderCounter(0)
+    _orderCounter(0),
+    _movementHeartbeatCount(0),
+    _crowdHeartbeatBudgetTime(0),
+    _crowdHeartbeatBytes(0)
 {
     memset(m_Tutorials, 0, sizeof(m_Tutorials));
 
     _offlineTime = 0;
     _kicked = false;
+    _replayed = false;
 
     _timeSyncNextCounter = 0;
     _timeSyncTimer = 0;
@@ -173,7 +223,7 @@ WorldSession::~WorldSession()
 
     ///- empty incoming packet queue
     WorldPacket* packet = nullptr;
-    while (_recvQueue.next(packet))
+    while (NextRecvPacket(packet))
         delete packet;
 
     LoginDatabase.Execute("UPDATE account SET online = 0 WHERE id = {};", GetAccountId());     // One-time query
@@ -295,13 +345,119 @@ void WorldSession::SendPacket(WorldPacket const* packet)
         return;
     }
 
+    WorldPacketSizeHints::Record(packet->GetOpcode(), packet->size());
     m_Socket->SendPacket(*packet);
 }
 
+/// Send a packet shared with other sessions, the socket keeps a reference to it until it's written
+void WorldSession::SendSharedPacket(SharedWorldPacket const& packet)
+{
+    if (!m_Socket)
+        return;
+
+    if (!sScriptMgr->CanPacketSend(this, *packet))
+    {
+        return;
+    }
+
+    m_Socket->SendSharedPacket(packet);
+}
+
+/// Send several packets to the client at once, see WorldPacketBatch
+void WorldSession::SendPacketBatch(WorldPacketBatch const& batch)
+{
+    if (!m_Socket)
+        return;
+
+    // send hooks may drop packets, they get the packets one by one
+    if (sScriptMgr->HasPacketSendHooks())
+    {
+        batch.ForEachPacket([this](uint16 opcode, uint8 const* contents, std::size_t size)
+        {
+            WorldPacket packet(opcode, size);
+            if (size)
+                packet.append(contents, size);
+
+            SendPacket(&packet);
+        });
+        return;
+    }
+
+    m_Socket->SendPacketBatch(batch);
+}
+
 /// Add an incoming packet to the queue
 void WorldSession::QueuePacket(WorldPacket* new_packet)
 {
-    _recvQueue.add(new_packet);
+    _recvQueueSize.fetch_add(1, std::memory_order_relaxed);
+    _recvQueue.Enqueue(new_packet);
+}
+
+void WorldSession::LogOpcodeMetrics()
+{
+#if defined PERFORMANCE_PROFILING || defined WITHOUT_METRICS
+    OpcodeMetricsEnabled.store(false, std::memory_order_relaxed);
+#else
+    OpcodeMetricsEnabled.store(sMetric->IsEnabled(), std::memory_order_relaxed);
+    if (!sMetric->IsEnabled())
+        return;
+
+    METRIC_VALUE("session_update_deferred", DeferredSessionUpdates.exchange(0, std::memory_order_relaxed));
+
+    for (uint16 opcode = 0; opcode < NUM_OPCODE_HANDLERS; ++opcode)
+    {
+        OpcodeHandlerStats& stats = OpcodeStats[opcode];
+        uint64 const calls = stats.Calls.exchange(0, std::memory_order_relaxed);
+        if (!calls)
+            continue;
+
+        std::string const name = opcodeTable[static_cast<OpcodeClient>(opcode)]->Name;
+        METRIC_VALUE("opcode_handler_calls", calls, METRIC_TAG("opcode", name));
+        METRIC_VALUE("opcode_handler_time", std::chrono::nanoseconds(stats.Time.exchange(0, std::memory_order_relaxed)), METRIC_TAG("opcode", name));
+
+        for (std::size_t bucket = 0; bucket < stats.Buckets.size(); ++bucket)
+        {
+            uint64 const bucketCalls = stats.Buckets[bucket].exchange(0, std::memory_order_relaxed);
+            if (!bucketCalls)
+                continue;
+
+            std::string const bound = bucket < OpcodeHandlerBucketBounds.size() ? std::to_string(OpcodeHandlerBucketBounds[bucket]) : "inf";
+            METRIC_VALUE("opcode_handler_time_bucket", bucketCalls, METRIC_TAG("opcode", name), METRIC_TAG("le_us", bound));
+        }
+    }
+#endif
+}
+
+bool WorldSession::NextRecvPacket(WorldPacket*& packet)
+{
+    // take everything the network thread queued so far at once
+    if (_recvPackets.empty())
+        for (WorldPacket* received = nullptr; _recvQueue.Dequeue(received);)
+            _recvPackets.push_back(received);
+
+    if (_recvPackets.empty())
+        return false;
+
+    packet = _recvPackets.front();
+    _recvPackets.pop_front();
+    _recvQueueSize.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool WorldSession::NextRecvPacket(WorldPacket*& packet, PacketFilter& updater)
+{
+    if (_recvPackets.empty())
+        for (WorldPacket* received = nullptr; _recvQueue.Dequeue(received);)
+            _recvPackets.push_back(received);
+
+    // the packets the filter doesn't process stay in front, in order, until the next update
+    if (_recvPackets.empty() || !updater.Process(_recvPackets.front()))
+        return false;
+
+    packet = _recvPackets.front();
+    _recvPackets.pop_front();
+    _recvQueueSize.fetch_sub(1, std::memory_order_relaxed);
+    return true;
 }
 
 /// Logging helper for unexpected opcodes
@@ -323,9 +479,31 @@ void WorldSession::LogUnprocessedTail(WorldPacket* packet)
     packet->print_storage();
 }
 
+void WorldSession::PrepareMapPackets(PacketFilter& updater)
+{
+    time_t currentTime = GameTime::GetGameTime().count();
+    WorldPacket* packet = nullptr;
+
+    // Mirrors the limits of Update(): it stops at the first kicked, banned or throttled
+    // packet and never handles more than MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE + 1
+    while (IsConnected() && _preparedPackets.size() <= MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE && NextRecvPacket(packet, updater))
+    {
+        Optional<DosProtection::Policy> limitPolicy = AntiDOS.CountOpcode(*packet, currentTime);
+        _preparedPackets.emplace_back(packet, limitPolicy);
+
+        if (limitPolicy && (*limitPolicy == DosProtection::Policy::Kick || *limitPolicy == DosProtection::Policy::Ban
+            || *limitPolicy == DosProtection::Policy::BlockingThrottle))
+            break;
+    }
+
+    _packetsPrepared = true;
+}
+
 /// Update the WorldSession (triggered by World update)
 bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 {
+    PROFILER_ZONE_ARG("WorldSession::Update", GetAccountId());
+
     ///- Before we process anything:
     /// If necessary, kick the player because the client didn't send anything for too long
     /// (or they've been idling in character select)
@@ -337,6 +515,66 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 
     HandleTeleportTimeout(updater.ProcessUnsafe());
 
+    ProcessRecvPackets(updater);
+
+    // left over by the packet limit or throttling, only reported for the sessions falling behind
+    if (uint32 backlog = GetRecvQueueSize())
+        METRIC_VALUE("session_recv_backlog", uint64(backlog), METRIC_TAG("account_id", std::to_string(GetAccountId())));
+    METRIC_VALUE("addon_messages", _addonMessageReceiveCount.load());
+    _addonMessageReceiveCount = 0;
+
+    if (!updater.ProcessUnsafe()) // <=> updater is of type MapSessionFilter
+    {
+        // Send time sync packet every 10s.
+        if (_timeSyncTimer > 0)
+        {
+            if (diff >= _timeSyncTimer)
+            {
+                SendTimeSync();
+            }
+            else
+            {
+                _timeSyncTimer -= diff;
+            }
+        }
+    }
+
+    ProcessQueryCallbacks();
+
+    //check if we are safe to proceed with logout
+    //logout procedure should happen only in World::UpdateSessions() method!!!
+    if (updater.ProcessUnsafe())
+    {
+        if (m_Socket && m_Socket->IsOpen() && _warden)
+        {
+            _warden->Update(diff);
+        }
+
+        if (ShouldLogOut(GameTime::GetGameTime().count()) && !m_playerLoading)
+        {
+            LogoutPlayer(true);
+        }
+
+        if (m_Socket && !m_Socket->IsOpen())
+        {
+            if (GetPlayer() && _warden)
+                _warden->Update(diff);
+
+            m_Socket = nullptr;
+        }
+
+        if (!IsConnected())
+        {
+            return false;                                       //Will remove this session from the world session map
+        }
+    }
+
+    return true;
+}
+
+/// Handles the queued packets accepted by the filter, in order, until one is rejected
+void WorldSession::ProcessRecvPackets(PacketFilter& updater)
+{
     ///- Retrieve packets from the receive queue and call the appropriate handlers
     /// not process packets if socket already closed
     WorldPacket* packet = nullptr;
@@ -347,17 +585,36 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
     uint32 processedPackets = 0;
     time_t currentTime = GameTime::GetGameTime().count();
 
-    constexpr uint32 MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE = 150;
+    // Handlers are timed for the metrics and the CPU budget of the session
+    uint32 const cpuBudget = sWorld->getIntConfig(CONFIG_SESSION_UPDATE_CPU_BUDGET);
+    bool const timeHandlers = cpuBudget || OpcodeMetricsEnabled.load(std::memory_order_relaxed);
+    std::chrono::nanoseconds spentTime(0);
+
+    // Packets already pulled and accounted by PrepareMapPackets()
+    bool const usePreparedPackets = _packetsPrepared;
+    std::size_t preparedIndex = 0;
+    _packetsPrepared = false;
 
-    while (m_Socket && _recvQueue.next(packet, updater))
+    while (IsConnected() && (usePreparedPackets ? preparedIndex < _preparedPackets.size() : NextRecvPacket(packet, updater)))
     {
+        Optional<WorldSession::DosProtection::Policy> limitPolicy;
+        if (usePreparedPackets)
+        {
+            packet = _preparedPackets[preparedIndex].first;
+            limitPolicy = _preparedPackets[preparedIndex].second;
+            ++preparedIndex;
+        }
+        else
+            limitPolicy = AntiDOS.CountOpcode(*packet, currentTime);
+
         OpcodeClient opcode = static_cast<OpcodeClient>(packet->GetOpcode());
         ClientOpcodeHandler const* opHandle = opcodeTable[opcode];
 
         METRIC_DETAILED_TIMER("worldsession_update_opcode_time", METRIC_TAG("opcode", opHandle->Name));
+        PROFILER_ZONE(opHandle->Name);
         LOG_DEBUG("network", "message id {} ({}) under READ", opcode, opHandle->Name);
 
-        WorldSession::DosProtection::Policy const evaluationPolicy = AntiDOS.EvaluateOpcode(*packet, currentTime);
+        WorldSession::DosProtection::Policy const evaluationPolicy = AntiDOS.ApplyPolicy(*packet, limitPolicy);
         switch (evaluationPolicy)
         {
             case WorldSession::DosProtection::Policy::Kick:
@@ -373,9 +630,15 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                 break;
         }
 
+        // requeued packets are recorded when they are processed
+        if (evaluationPolicy != WorldSession::DosProtection::Policy::BlockingThrottle && sMapReplay->IsRecording())
+            sMapReplay->RecordPacket(this, *packet);
+
         if (evaluationPolicy == WorldSession::DosProtection::Policy::Process
             || evaluationPolicy == WorldSession::DosProtection::Policy::Log)
         {
+            Acore::CycleClock::time_point const handlerStartTime = timeHandlers ? Acore::CycleClock::now() : Acore::CycleClock::time_point();
+
             try
             {
                 switch (opHandle->Status)
@@ -490,6 +753,13 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                     packet->hexlike();
                 }
             }
+
+            if (timeHandlers)
+            {
+                std::chrono::nanoseconds const handlerTime = Acore::CycleClock::now() - handlerStartTime;
+                spentTime += handlerTime;
+                RecordOpcodeHandlerTime(opcode, handlerTime);
+            }
         }
 
         if (deletePacket)
@@ -503,61 +773,42 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
         //Any leftover will be processed in next update
         if (processedPackets > MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE)
             break;
-    }
-
-    _recvQueue.readd(requeuePackets.begin(), requeuePackets.end());
 
-    METRIC_VALUE("processed_packets", processedPackets);
-    METRIC_VALUE("addon_messages", _addonMessageReceiveCount.load());
-    _addonMessageReceiveCount = 0;
-
-    if (!updater.ProcessUnsafe()) // <=> updater is of type MapSessionFilter
-    {
-        // Send time sync packet every 10s.
-        if (_timeSyncTimer > 0)
+        // CPU budget spent, the leftovers wait for the next update
+        if (cpuBudget && spentTime >= std::chrono::microseconds(cpuBudget))
         {
-            if (diff >= _timeSyncTimer)
-            {
-                SendTimeSync();
-            }
-            else
-            {
-                _timeSyncTimer -= diff;
-            }
+            if (GetRecvQueueSize() || (usePreparedPackets && preparedIndex < _preparedPackets.size()))
+                DeferredSessionUpdates.fetch_add(1, std::memory_order_relaxed);
+
+            break;
         }
     }
 
-    ProcessQueryCallbacks();
-
-    //check if we are safe to proceed with logout
-    //logout procedure should happen only in World::UpdateSessions() method!!!
-    if (updater.ProcessUnsafe())
+    if (usePreparedPackets)
     {
-        if (m_Socket && m_Socket->IsOpen() && _warden)
-        {
-            _warden->Update(diff);
-        }
+        // Socket closed while handling prepared packets, give the leftovers back to the queue
+        std::vector<WorldPacket*> leftoverPackets;
+        for (std::size_t i = preparedIndex; i < _preparedPackets.size(); ++i)
+            leftoverPackets.push_back(_preparedPackets[i].first);
 
-        if (ShouldLogOut(currentTime) && !m_playerLoading)
-        {
-            LogoutPlayer(true);
-        }
+        RequeueRecvPackets(leftoverPackets.begin(), leftoverPackets.end());
+        _preparedPackets.clear();
+    }
 
-        if (m_Socket && !m_Socket->IsOpen())
-        {
-            if (GetPlayer() && _warden)
-                _warden->Update(diff);
+    RequeueRecvPackets(requeuePackets.begin(), requeuePackets.end());
 
-            m_Socket = nullptr;
-        }
+    METRIC_VALUE("processed_packets", processedPackets);
 
-        if (!m_Socket)
-        {
-            return false;                                       //Will remove this session from the world session map
-        }
-    }
+    static MetricCounter& processedPacketsCounter = sMetricRegistry->GetCounter("acore_world_processed_packets_total", "Client packets handled by the world sessions");
+    processedPacketsCounter.Add(processedPackets);
+}
 
-    return true;
+/// Handles the leading packets of the queue which only need this session, see PROCESS_SESSIONSAFE.
+/// Called by the session workers, in parallel with the other sessions and before their world update.
+void WorldSession::ProcessSessionSafePackets()
+{
+    SessionSafeFilter updater(this);
+    ProcessRecvPackets(updater);
 }
 
 bool WorldSession::HandleSocketClosed()
@@ -577,6 +828,12 @@ bool WorldSession::IsSocketClosed() const
     return !m_Socket || !m_Socket->IsOpen();
 }
 
+void WorldSession::SetReplayed(ObjectGuid character)
+{
+    _replayed = true;
+    _legitCharacters.insert(character);
+}
+
 void WorldSession::HandleTeleportTimeout(bool updateInSessions)
 {
     // pussywizard: handle teleport ack timeout
@@ -1316,9 +1573,11 @@ void WorldSession::SetPlayer(Player* player)
 
 void WorldSession::ProcessQueryCallbacks()
 {
+    PROFILER_ZONE("WorldSession::ProcessQueryCallbacks");
     _queryProcessor.ProcessReadyCallbacks();
     _transactionCallbacks.ProcessReadyCallbacks();
     _queryHolderProcessor.ProcessReadyCallbacks();
+    _queryTasks.ProcessReadyCallbacks();
 }
 
 TransactionCallback& WorldSession::AddTransactionCallback(TransactionCallback&& callback)
@@ -1331,6 +1590,11 @@ SQLQueryHolderCallback& WorldSession::AddQueryHolderCallback(SQLQueryHolderCallb
     return _queryHolderProcessor.AddCallback(std::move(callback));
 }
 
+void WorldSession::AddQueryTask(QueryTask&& task)
+{
+    _queryTasks.AddCallback(std::move(task));
+}
+
 void WorldSession::InitWarden(SessionKey const& k, std::string const& os)
 {
     if (os == "Win")
@@ -1352,14 +1616,19 @@ Warden* WorldSession::GetWarden()
 }
 
 WorldSession::DosProtection::Policy WorldSession::DosProtection::EvaluateOpcode(WorldPacket const& p, time_t const time) const
+{
+    return ApplyPolicy(p, CountOpcode(p, time));
+}
+
+Optional<WorldSession::DosProtection::Policy> WorldSession::DosProtection::CountOpcode(WorldPacket const& p, time_t const time) const
 {
     AntiDosOpcodePolicy const* policy = sWorldGlobals->GetAntiDosPolicyForOpcode(p.GetOpcode());
     if (!policy)
-        return WorldSession::DosProtection::Policy::Process; // Return true if there is no policy for the opcode
+        return {}; // There is no policy for the opcode
 
     uint32 const maxPacketCounterAllowed = policy->MaxAllowedCount;
     if (!maxPacketCounterAllowed)
-        return WorldSession::DosProtection::Policy::Process; // Return true if there no limit for the opcode
+        return {}; // There is no limit for the opcode
 
     // packetCounter is opcodes handled in the same world second, so MaxAllowedCount is per second
     PacketCounter& packetCounter = _PacketThrottlingMap[p.GetOpcode()];
@@ -1371,16 +1640,24 @@ WorldSession::DosProtection::Policy WorldSession::DosProtection::EvaluateOpcode(
 
     // Check if player is flooding some packets
     if (++packetCounter.amountCounter <= maxPacketCounterAllowed)
+        return {};
+
+    return WorldSession::DosProtection::Policy(policy->Policy);
+}
+
+WorldSession::DosProtection::Policy WorldSession::DosProtection::ApplyPolicy(WorldPacket const& p, Optional<Policy> policy) const
+{
+    if (!policy)
         return WorldSession::DosProtection::Policy::Process;
 
-    if (WorldSession::DosProtection::Policy(policy->Policy) != WorldSession::DosProtection::Policy::BlockingThrottle)
+    if (*policy != WorldSession::DosProtection::Policy::BlockingThrottle)
     {
         LOG_WARN("network", "AntiDOS: Account {}, IP: {}, Ping: {}, Character: {}, flooding packet (opc: {} (0x{:X}), count: {})",
             Session->GetAccountId(), Session->GetRemoteAddress(), Session->GetLatency(), Session->GetPlayerName(),
-            opcodeTable[static_cast<OpcodeClient>(p.GetOpcode())]->Name, p.GetOpcode(), packetCounter.amountCounter);
+            opcodeTable[static_cast<OpcodeClient>(p.GetOpcode())]->Name, p.GetOpcode(), _PacketThrottlingMap[p.GetOpcode()].amountCounter);
     }
 
-    switch (WorldSession::DosProtection::Policy(policy->Policy))
+    switch (*policy)
     {
         case WorldSession::DosProtection::Policy::Kick:
         {
@@ -1417,12 +1694,32 @@ WorldSession::DosProtection::Policy WorldSession::DosProtection::EvaluateOpcode(
             break;
     }
 
-    return WorldSession::DosProtection::Policy(policy->Policy);
+    return *policy;
 }
 
 WorldSession::DosProtection::DosProtection(WorldSession* s) :
     Session(s) { }
 
+bool WorldSession::ConsumeCrowdHeartbeatBudget(uint32 bytes)
+{
+    uint32 const budget = sWorld->getIntConfig(CONFIG_CROWD_INTEREST_SESSION_BYTES);
+    if (!budget)
+        return true;
+
+    time_t const now = GameTime::GetGameTime().count();
+    if (now != _crowdHeartbeatBudgetTime)
+    {
+        _crowdHeartbeatBudgetTime = now;
+        _crowdHeartbeatBytes = 0;
+    }
+
+    if (_crowdHeartbeatBytes + bytes > budget)
+        return false;
+
+    _crowdHeartbeatBytes += bytes;
+    return true;
+}
+
 void WorldSession::ResetTimeSync()
 {
     _timeSyncNextCounter = 0;
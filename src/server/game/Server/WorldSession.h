@@ -29,9 +29,12 @@
 #include "Common.h"
 #include "DatabaseEnv.h"
 #include "GossipDef.h"
+#include "MPSCQueue.h"
+#include "Optional.h"
 #include "Packet.h"
 #include "SharedDefines.h"
 #include "World.h"
+#include <deque>
 #include <map>
 #include <memory>
 #include <utility>
@@ -50,6 +53,7 @@ class SpellCastTargets;
 class Unit;
 class Warden;
 class WorldPacket;
+class WorldPacketBatch;
 class WorldSocket;
 class AsynchPetSummon;
 struct AreaTableEntry;
@@ -307,6 +311,17 @@ public:
     bool Process(WorldPacket* packet) override;
 };
 
+// filters the packets which only need their own session, processed by the session workers of World::UpdateSessions()
+class SessionSafeFilter : public PacketFilter
+{
+public:
+    explicit SessionSafeFilter(WorldSession* pSession) : PacketFilter(pSession) {}
+    ~SessionSafeFilter() override = default;
+
+    bool Process(WorldPacket* packet) override;
+    [[nodiscard]] bool ProcessUnsafe() const override { return false; }
+};
+
 // Proxy structure to contain data passed to callback function,
 // only to prevent bloating the parameter list
 class CharacterCreateInfo
@@ -400,6 +415,8 @@ public:
     bool ProcessMovementInfo(MovementInfo& movementInfo, Unit* mover, Player* plrMover, WorldPacket& recvData);
 
     void SendPacket(WorldPacket const* packet);
+    void SendSharedPacket(SharedWorldPacket const& packet);
+    void SendPacketBatch(WorldPacketBatch const& batch);
     void SendPetNameInvalid(uint32 error, std::string const& name, DeclinedName* declinedName);
     void SendPartyResult(PartyOperation operation, std::string const& member, PartyResult res, uint32 val = 0);
 
@@ -425,6 +442,7 @@ public:
     void SendClientCacheVersion(uint32 version);
 
     AccountTypes GetSecurity() const { return _security; }
+    std::string const& GetAccountName() const { return _accountName; }
     bool CanSkipQueue() const { return _skipQueue; }
     uint32 GetAccountId() const { return _accountId; }
     Player* GetPlayer() const { return _player; }
@@ -477,6 +495,15 @@ public:
 
     void QueuePacket(WorldPacket* new_packet);
     bool Update(uint32 diff, PacketFilter& updater);
+    // Reports the handler calls and time per opcode, over all sessions
+    static void LogOpcodeMetrics();
+    // Pulls the packets of the next map update and runs their anti-DOS accounting.
+    // Only touches this session, so the sessions of a map can be prepared in parallel.
+    void PrepareMapPackets(PacketFilter& updater);
+    // Handles the leading PROCESS_SESSIONSAFE packets, sessions may do it in parallel
+    void ProcessSessionSafePackets();
+    // Received packets not handled yet
+    [[nodiscard]] uint32 GetRecvQueueSize() const { return _recvQueueSize.load(std::memory_order_relaxed); }
 
     /// Handle the authentication waiting queue (to be completed)
     void SendAuthWaitQueue(uint32 position);
@@ -569,6 +596,14 @@ public:
     uint32 GetLatency() const { return m_latency; }
     void SetLatency(uint32 latency) { m_latency = latency; }
 
+    // Null once the connection is gone
+    std::shared_ptr<WorldSocket> const& GetSocket() const { return m_Socket; }
+
+    // Crowd interest management (Visibility.CrowdInterest.*), see Acore::CrowdHeartbeatDeliverer
+    uint32 NextMovementHeartbeat() { return _movementHeartbeatCount++; }
+    bool IsCrowdHeartbeat(Player const* mover) const;
+    bool ConsumeCrowdHeartbeatBudget(uint32 bytes);
+
     std::atomic<time_t> m_timeOutTime;
     void UpdateTimeOutTime(uint32 diff)
     {
@@ -613,6 +648,7 @@ public:                                                 // opcodes handlers
     void HandleCharEnumOpcode(WorldPacket& recvPacket);
     void HandleCharDeleteOpcode(WorldPacket& recvPacket);
     void HandleCharCreateOpcode(WorldPacket& recvPacket);
+    QueryTask CreateCharacter(std::shared_ptr<CharacterCreateInfo> createInfo);
     void HandlePlayerLoginOpcode(WorldPacket& recvPacket);
     void HandleCharEnum(PreparedQueryResult result);
     void HandlePlayerLoginFromDB(LoginQueryHolder const& holder);
@@ -1131,6 +1167,9 @@ public:                                                 // opcodes handlers
     bool IsKicked() const { return _kicked; }
     void SetKicked(bool val) { _kicked = val; }
     bool IsSocketClosed() const;
+    // a session fed by a map replay, it has no socket and stays until kicked
+    void SetReplayed(ObjectGuid character);
+    bool IsReplayed() const { return _replayed; }
 
     /*
      * CALLBACKS
@@ -1139,6 +1178,7 @@ public:                                                 // opcodes handlers
     QueryCallbackProcessor& GetQueryProcessor() { return _queryProcessor; }
     TransactionCallback& AddTransactionCallback(TransactionCallback&& callback);
     SQLQueryHolderCallback& AddQueryHolderCallback(SQLQueryHolderCallback&& callback);
+    void AddQueryTask(QueryTask&& task);
 
     void InitializeSession();
     void InitializeSessionCallback(CharacterDatabaseQueryHolder const& realmHolder, uint32 clientCacheVersion);
@@ -1151,6 +1191,7 @@ private:
     QueryCallbackProcessor _queryProcessor;
     AsyncCallbackProcessor<TransactionCallback> _transactionCallbacks;
     AsyncCallbackProcessor<SQLQueryHolderCallback> _queryHolderProcessor;
+    AsyncCallbackProcessor<QueryTask> _queryTasks;
 
     friend class World;
 protected:
@@ -1170,6 +1211,11 @@ protected:
 
         DosProtection(WorldSession* s);
         Policy EvaluateOpcode(WorldPacket const& p, time_t const time) const;
+
+        // Split of EvaluateOpcode: counting has no side effect outside of the session
+        // and returns the policy to apply when the opcode went above its limit
+        Optional<Policy> CountOpcode(WorldPacket const& p, time_t const time) const;
+        Policy ApplyPolicy(WorldPacket const& p, Optional<Policy> policy) const;
     protected:
         WorldSession* Session;
     private:
@@ -1193,6 +1239,18 @@ private:
     void LogUnexpectedOpcode(WorldPacket* packet, char const* status, const char* reason);
     void LogUnprocessedTail(WorldPacket* packet);
 
+    void ProcessRecvPackets(PacketFilter& updater);
+    bool IsConnected() const { return m_Socket || (_replayed && !_kicked); }
+    bool NextRecvPacket(WorldPacket*& packet);
+    bool NextRecvPacket(WorldPacket*& packet, PacketFilter& updater);
+    // puts packets back in front of the receive queue
+    template<class Iterator>
+    void RequeueRecvPackets(Iterator begin, Iterator end)
+    {
+        _recvQueueSize.fetch_add(uint32(std::distance(begin, end)), std::memory_order_relaxed);
+        _recvPackets.insert(_recvPackets.begin(), begin, end);
+    }
+
     // EnumData helpers
     bool IsLegitCharacterForAccount(ObjectGuid guid)
     {
@@ -1236,11 +1294,18 @@ private:
     AddonsList m_addonsList;
     uint32 recruiterId;
     bool isRecruiter;
-    LockedQueue<WorldPacket*> _recvQueue;
+    // Filled by the network thread, drained in batches by the thread updating the session.
+    // Drained packets wait in _recvPackets, which only that thread touches.
+    MPSCQueue<WorldPacket, &WorldPacket::RecvQueueLink> _recvQueue;
+    std::deque<WorldPacket*> _recvPackets;
+    std::atomic<uint32> _recvQueueSize;
+    std::vector<std::pair<WorldPacket*, Optional<DosProtection::Policy>>> _preparedPackets;
+    bool _packetsPrepared;
     uint32 m_currentVendorEntry;
     ObjectGuid m_currentBankerGUID;
     uint32 _offlineTime;
     bool _kicked;
+    bool _replayed;
     // Packets cooldown
     time_t _calendarEventCreationCooldown;
 
@@ -1257,6 +1322,10 @@ private:
 
     uint32 _orderCounter;
 
+    uint32 _movementHeartbeatCount;
+    time_t _crowdHeartbeatBudgetTime;
+    uint32 _crowdHeartbeatBytes;
+
     WorldSession(WorldSession const& right) = delete;
     WorldSession& operator=(WorldSession const& right) = delete;
 };
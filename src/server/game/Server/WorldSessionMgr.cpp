@@ -18,6 +18,7 @@
 #include "Chat.h"
 #include "ChatPackets.h"
 #include "GameTime.h"
+#include "MapRegionUpdater.h"
 #include "Metric.h"
 #include "Player.h"
 #include "World.h"
@@ -103,6 +104,8 @@ void WorldSessionMgr::UpdateSessions(uint32 const diff)
         }
     }
 
+    ProcessSessionSafePackets();
+
     ///- Then send an update signal to remaining ones
     for (SessionMap::iterator itr = _sessions.begin(), next; itr != _sessions.end(); itr = next)
     {
@@ -363,9 +366,49 @@ void WorldSessionMgr::UpdateMaxSessionCounters()
     _maxQueuedSessionCount = std::max(_maxQueuedSessionCount, uint32(_queuedPlayer.size()));
 }
 
+/// Handle the leading PROCESS_SESSIONSAFE packets of all sessions in parallel, before their serial update
+void WorldSessionMgr::ProcessSessionSafePackets()
+{
+    uint32 const minSessions = sWorld->getIntConfig(CONFIG_SESSION_UPDATE_PARALLEL_MIN_SESSIONS);
+    if (!minSessions || _sessions.size() < minSessions || !sMapRegionUpdater->IsActive())
+        return;
+
+    METRIC_DETAILED_NO_THRESHOLD_TIMER("world_update_time",
+        METRIC_TAG("type", "Parallel session packets"),
+        METRIC_TAG("parent_type", "Update sessions"));
+
+    _parallelSessions.clear();
+    for (SessionMap::value_type const& session : _sessions)
+        if (session.second)
+            _parallelSessions.push_back(session.second);
+
+    std::size_t const shardSize = (_parallelSessions.size() + SESSION_UPDATE_SHARDS - 1) / SESSION_UPDATE_SHARDS;
+
+    std::vector<std::function<void()>> jobs;
+    for (uint32 shard = 0; shard * shardSize < _parallelSessions.size(); ++shard)
+    {
+        std::size_t const begin = shard * shardSize;
+        std::size_t const end = std::min(begin + shardSize, _parallelSessions.size());
+        jobs.emplace_back([this, shard, begin, end]()
+        {
+            [[maybe_unused]] TimePoint const startTime = std::chrono::steady_clock::now();
+
+            for (std::size_t i = begin; i < end; ++i)
+                _parallelSessions[i]->ProcessSessionSafePackets();
+
+            METRIC_VALUE("session_shard_update_time", std::chrono::nanoseconds(std::chrono::steady_clock::now() - startTime),
+                METRIC_TAG("shard", std::to_string(shard)));
+        });
+    }
+
+    sMapRegionUpdater->Execute(jobs);
+}
+
 /// Send a packet to all players (except self if mentioned)
 void WorldSessionMgr::SendGlobalMessage(WorldPacket const* packet, WorldSession* self, TeamId teamId)
 {
+    SharedWorldPacket const shared = std::make_shared<WorldPacket const>(*packet);
+
     SessionMap::const_iterator itr;
     for (itr = _sessions.begin(); itr != _sessions.end(); ++itr)
     {
@@ -375,7 +418,7 @@ void WorldSessionMgr::SendGlobalMessage(WorldPacket const* packet, WorldSession*
             itr->second != self &&
             (teamId == TEAM_NEUTRAL || itr->second->GetPlayer()->GetTeamId() == teamId))
         {
-            itr->second->SendPacket(packet);
+            itr->second->SendSharedPacket(shared);
         }
     }
 }
@@ -383,6 +426,8 @@ void WorldSessionMgr::SendGlobalMessage(WorldPacket const* packet, WorldSession*
 /// Send a packet to all GMs (except self if mentioned)
 void WorldSessionMgr::SendGlobalGMMessage(WorldPacket const* packet, WorldSession* self, TeamId teamId)
 {
+    SharedWorldPacket const shared = std::make_shared<WorldPacket const>(*packet);
+
     SessionMap::iterator itr;
     for (itr = _sessions.begin(); itr != _sessions.end(); ++itr)
     {
@@ -393,7 +438,7 @@ void WorldSessionMgr::SendGlobalGMMessage(WorldPacket const* packet, WorldSessio
             !AccountMgr::IsPlayerAccount(itr->second->GetSecurity()) &&
             (teamId == TEAM_NEUTRAL || itr->second->GetPlayer()->GetTeamId() == teamId))
         {
-            itr->second->SendPacket(packet);
+            itr->second->SendSharedPacket(shared);
         }
     }
 }
@@ -86,11 +86,16 @@ public:
     void DoForAllOnlinePlayers(std::function<void(Player*)> exec);
 
 private:
+    // shards of the parallel packet pass, each reports its update time
+    static constexpr uint32 SESSION_UPDATE_SHARDS = 16;
+
     LockedQueue<WorldSession*> _addSessQueue;
     void AddSession_(WorldSession* session);
+    void ProcessSessionSafePackets();
 
     SessionMap _sessions;
     SessionMap _offlineSessions;
+    std::vector<WorldSession*> _parallelSessions;
 
     typedef std::unordered_map<uint32, time_t> DisconnectMap;
     DisconnectMap _disconnects;
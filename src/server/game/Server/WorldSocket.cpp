@@ -38,29 +38,79 @@
 
 using boost::asio::ip::tcp;
 
-void compressBuff(void* dst, uint32* dst_size, void* src, int src_size)
+namespace
 {
-    z_stream c_stream;
+    // zlib state is expensive to set up, every thread that compresses packets keeps its own and resets it per packet
+    class UpdatePacketCompressor
+    {
+    public:
+        UpdatePacketCompressor() : _level(0)
+        {
+            _stream.zalloc = (alloc_func)0;
+            _stream.zfree = (free_func)0;
+            _stream.opaque = (voidpf)0;
+        }
+
+        ~UpdatePacketCompressor()
+        {
+            if (_level)
+                deflateEnd(&_stream);
+        }
+
+        UpdatePacketCompressor(UpdatePacketCompressor const&) = delete;
+        UpdatePacketCompressor& operator=(UpdatePacketCompressor const&) = delete;
+
+        z_stream* Acquire(int level)
+        {
+            if (_level == level)
+            {
+                int z_res = deflateReset(&_stream);
+                if (z_res == Z_OK)
+                    return &_stream;
+
+                LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateReset) Error code: {} ({})", z_res, zError(z_res));
+            }
+
+            // first use on this thread or the configured level was reloaded
+            if (_level)
+                deflateEnd(&_stream);
+
+            _level = 0;
+            int z_res = deflateInit(&_stream, level);
+            if (z_res != Z_OK)
+            {
+                LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateInit) Error code: {} ({})", z_res, zError(z_res));
+                return nullptr;
+            }
+
+            _level = level;
+            return &_stream;
+        }
 
-    c_stream.zalloc = (alloc_func)0;
-    c_stream.zfree = (free_func)0;
-    c_stream.opaque = (voidpf)0;
+    private:
+        z_stream _stream;
+        int _level;
+    };
 
+    thread_local UpdatePacketCompressor t_compressor;
+}
+
+void compressBuff(void* dst, uint32* dst_size, void* src, int src_size)
+{
     // default Z_BEST_SPEED (1)
-    int z_res = deflateInit(&c_stream, sWorld->getIntConfig(CONFIG_COMPRESSION));
-    if (z_res != Z_OK)
+    z_stream* c_stream = t_compressor.Acquire(sWorld->getIntConfig(CONFIG_COMPRESSION));
+    if (!c_stream)
     {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateInit) Error code: {} ({})", z_res, zError(z_res));
         *dst_size = 0;
         return;
     }
 
-    c_stream.next_out = (Bytef*)dst;
-    c_stream.avail_out = *dst_size;
-    c_stream.next_in = (Bytef*)src;
-    c_stream.avail_in = (uInt)src_size;
+    c_stream->next_out = (Bytef*)dst;
+    c_stream->avail_out = *dst_size;
+    c_stream->next_in = (Bytef*)src;
+    c_stream->avail_in = (uInt)src_size;
 
-    z_res = deflate(&c_stream, Z_NO_FLUSH);
+    int z_res = deflate(c_stream, Z_NO_FLUSH);
     if (z_res != Z_OK)
     {
         LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate) Error code: {} ({})", z_res, zError(z_res));
@@ -68,14 +118,14 @@ void compressBuff(void* dst, uint32* dst_size, void* src, int src_size)
         return;
     }
 
-    if (c_stream.avail_in != 0)
+    if (c_stream->avail_in != 0)
     {
         LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate not greedy)");
         *dst_size = 0;
         return;
     }
 
-    z_res = deflate(&c_stream, Z_FINISH);
+    z_res = deflate(c_stream, Z_FINISH);
     if (z_res != Z_STREAM_END)
     {
         LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate should report Z_STREAM_END instead {} ({})", z_res, zError(z_res));
@@ -83,21 +133,13 @@ void compressBuff(void* dst, uint32* dst_size, void* src, int src_size)
         return;
     }
 
-    z_res = deflateEnd(&c_stream);
-    if (z_res != Z_OK)
-    {
-        LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateEnd) Error code: {} ({})", z_res, zError(z_res));
-        *dst_size = 0;
-        return;
-    }
-
-    *dst_size = c_stream.total_out;
+    *dst_size = c_stream->total_out;
 }
 
-void EncryptableAndCompressiblePacket::CompressIfNeeded()
+bool EncryptableAndCompressiblePacket::CompressIfNeeded()
 {
     if (!NeedsCompression())
-        return;
+        return false;
 
     uint32 pSize = size();
 
@@ -108,12 +150,13 @@ void EncryptableAndCompressiblePacket::CompressIfNeeded()
     buf.put<uint32>(0, pSize);
     compressBuff(const_cast<uint8*>(buf.contents()) + sizeof(uint32), &destsize, (void*)contents(), pSize);
     if (destsize == 0)
-        return;
+        return false;
 
     buf.resize(destsize + sizeof(uint32));
 
     ByteBuffer::operator=(std::move(buf));
     SetOpcode(SMSG_COMPRESSED_UPDATE_OBJECT);
+    return true;
 }
 
 WorldSocket::WorldSocket(IoContextTcpSocket&& socket)
@@ -168,15 +211,13 @@ bool WorldSocket::Update()
     {
         // Allocate buffer only when it's needed but not on every Update() call.
         MessageBuffer buffer(_sendBufferSize);
-        std::size_t currentPacketSize;
-        do
+        auto writePacket = [this, &buffer](uint16 opcode, uint8 const* contents, std::size_t size, bool encrypt)
         {
-            queued->CompressIfNeeded();
-            ServerPktHeader header(queued->size() + 2, queued->GetOpcode());
-            if (queued->NeedsEncryption())
+            ServerPktHeader header(size + 2, opcode);
+            if (encrypt)
                 _authCrypt.EncryptSend(header.header, header.getHeaderLength());
 
-            currentPacketSize = queued->size() + header.getHeaderLength();
+            std::size_t const currentPacketSize = size + header.getHeaderLength();
 
             if (buffer.GetRemainingSpace() < currentPacketSize)
             {
@@ -184,13 +225,7 @@ bool WorldSocket::Update()
                 buffer.Resize(_sendBufferSize);
             }
 
-            if (buffer.GetRemainingSpace() >= currentPacketSize)
-            {
-                buffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    buffer.Write(queued->contents(), queued->size());
-            }
-            else    // Single packet larger than current buffer size
+            if (buffer.GetRemainingSpace() < currentPacketSize)    // Single packet larger than current buffer size
             {
                 // Resize buffer to fit current packet
                 buffer.Resize(currentPacketSize);
@@ -198,10 +233,32 @@ bool WorldSocket::Update()
                 // Grow future buffers to current packet size if still below limit
                 if (currentPacketSize <= 65536)
                     _sendBufferSize = currentPacketSize;
+            }
+
+            buffer.Write(header.header, header.getHeaderLength());
+            if (size)
+                buffer.Write(contents, size);
+        };
+
+        do
+        {
+            if (queued->IsBatch())
+            {
+                bool const encrypt = queued->NeedsEncryption();
+                WorldPacketBatch::ForEachPacket(*queued, [&writePacket, encrypt](uint16 opcode, uint8 const* contents, std::size_t size)
+                {
+                    writePacket(opcode, contents, size, encrypt);
+                });
+            }
+            else if (WorldPacket const* shared = queued->GetSharedPacket())
+                writePacket(shared->GetOpcode(), shared->empty() ? nullptr : shared->contents(), shared->size(), queued->NeedsEncryption());
+            else
+            {
+                std::size_t const uncompressedSize = queued->size();
+                if (queued->CompressIfNeeded())
+                    RecordCompression(uncompressedSize, queued->size());
 
-                buffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    buffer.Write(queued->contents(), queued->size());
+                writePacket(queued->GetOpcode(), queued->empty() ? nullptr : queued->contents(), queued->size(), queued->NeedsEncryption());
             }
 
             delete queued;
@@ -523,9 +580,57 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
     if (sPacketLog->CanLogPacket() && IsLoggingPackets())
         sPacketLog->LogPacket(packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
 
+    EncryptableAndCompressiblePacket* queued = new EncryptableAndCompressiblePacket(packet, _authCrypt.IsInitialized());
+    if (sWorld->getBoolConfig(CONFIG_COMPRESSION_IN_SENDER_THREAD))
+    {
+        std::size_t const uncompressedSize = queued->size();
+        if (queued->CompressIfNeeded())
+            RecordCompression(uncompressedSize, queued->size());
+    }
+
+    _bufferQueue.Enqueue(queued);
+}
+
+void WorldSocket::SendSharedPacket(SharedWorldPacket const& packet)
+{
+    if (!IsOpen())
+        return;
+
+    // compression replaces the contents, the packet is copied for it
+    if (EncryptableAndCompressiblePacket::NeedsCompression(*packet))
+    {
+        SendPacket(*packet);
+        return;
+    }
+
+    if (sPacketLog->CanLogPacket() && IsLoggingPackets())
+        sPacketLog->LogPacket(*packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
+
     _bufferQueue.Enqueue(new EncryptableAndCompressiblePacket(packet, _authCrypt.IsInitialized()));
 }
 
+void WorldSocket::SendPacketBatch(WorldPacketBatch const& batch)
+{
+    if (!IsOpen() || batch.IsEmpty())
+        return;
+
+    // logged packets are sent one by one, the log takes whole packets
+    if (sPacketLog->CanLogPacket() && IsLoggingPackets())
+    {
+        batch.ForEachPacket([this](uint16 opcode, uint8 const* contents, std::size_t size)
+        {
+            WorldPacket packet(opcode, size);
+            if (size)
+                packet.append(contents, size);
+
+            SendPacket(packet);
+        });
+        return;
+    }
+
+    _bufferQueue.Enqueue(new EncryptableAndCompressiblePacket(batch, _authCrypt.IsInitialized()));
+}
+
 void WorldSocket::HandleAuthSession(WorldPacket & recvPacket)
 {
     std::shared_ptr<ClientAuthSession> authSession = std::make_shared<ClientAuthSession>();
@@ -24,6 +24,7 @@
 #include "Socket.h"
 #include "Util.h"
 #include "WorldPacket.h"
+#include "WorldPacketBatch.h"
 #include "WorldSession.h"
 #include <boost/asio/ip/tcp.hpp>
 
@@ -32,21 +33,42 @@ using boost::asio::ip::tcp;
 class EncryptableAndCompressiblePacket : public WorldPacket
 {
 public:
-    EncryptableAndCompressiblePacket(WorldPacket const& packet, bool encrypt) : WorldPacket(packet), _encrypt(encrypt)
+    EncryptableAndCompressiblePacket(WorldPacket const& packet, bool encrypt) : WorldPacket(packet), _encrypt(encrypt), _batch(false)
+    {
+        SocketQueueLink.store(nullptr, std::memory_order_relaxed);
+    }
+
+    // Holds the packets of the batch, written as WorldPacketBatch does
+    EncryptableAndCompressiblePacket(WorldPacketBatch const& batch, bool encrypt) : WorldPacket(NULL_OPCODE, 0), _encrypt(encrypt), _batch(true)
+    {
+        ByteBuffer::operator=(batch.GetBuffer());
+        SocketQueueLink.store(nullptr, std::memory_order_relaxed);
+    }
+
+    // References a packet shared by several sockets, written as it is
+    EncryptableAndCompressiblePacket(SharedWorldPacket packet, bool encrypt) : WorldPacket(packet->GetOpcode(), 0), _encrypt(encrypt), _batch(false), _shared(std::move(packet))
     {
         SocketQueueLink.store(nullptr, std::memory_order_relaxed);
     }
 
     bool NeedsEncryption() const { return _encrypt; }
 
-    bool NeedsCompression() const { return GetOpcode() == SMSG_UPDATE_OBJECT && size() > 100; }
+    bool NeedsCompression() const { return !_batch && NeedsCompression(*this); }
+    static bool NeedsCompression(WorldPacket const& packet) { return packet.GetOpcode() == SMSG_UPDATE_OBJECT && packet.size() > 100; }
+
+    bool IsBatch() const { return _batch; }
+
+    WorldPacket const* GetSharedPacket() const { return _shared.get(); }
 
-    void CompressIfNeeded();
+    // Returns whether the contents were replaced by their compressed form
+    bool CompressIfNeeded();
 
     std::atomic<EncryptableAndCompressiblePacket*> SocketQueueLink;
 
 private:
     bool _encrypt;
+    bool _batch;
+    SharedWorldPacket _shared;
 };
 
 namespace WorldPackets
@@ -82,6 +104,8 @@ public:
     bool Update() final;
 
     void SendPacket(WorldPacket const& packet);
+    void SendSharedPacket(SharedWorldPacket const& packet);
+    void SendPacketBatch(WorldPacketBatch const& batch);
 
     void SetSendBufferSize(std::size_t sendBufferSize) { _sendBufferSize = sendBufferSize; }
 
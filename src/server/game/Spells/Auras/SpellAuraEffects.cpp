@@ -39,6 +39,7 @@
 #include "Util.h"
 #include "Vehicle.h"
 #include "WorldPacket.h"
+#include <boost/container/small_vector.hpp>
 
 /// @todo: this import is not necessary for compilation and marked as unused by the IDE
 //  however, for some reasons removing it would cause a damn linking issue
@@ -429,6 +430,27 @@ void AuraEffect::GetApplicationList(std::list<AuraApplication*>& applicationList
     }
 }
 
+void AuraEffect::SetAmount(int32 amount)
+{
+    m_amount = amount;
+    m_canBeRecalculated = false;
+    InvalidateTargetsAuraModifierTotals();
+}
+
+void AuraEffect::SetEnabled(bool enabled)
+{
+    m_isAuraEnabled = enabled;
+    InvalidateTargetsAuraModifierTotals();
+}
+
+// GetAmount changed without re-registering the effect, drop the modifier totals cached on the targets
+void AuraEffect::InvalidateTargetsAuraModifierTotals()
+{
+    Aura::ApplicationMap const& targetMap = GetBase()->GetApplicationMap();
+    for (Aura::ApplicationMap::const_iterator appIter = targetMap.begin(); appIter != targetMap.end(); ++appIter)
+        appIter->second->GetTarget()->_InvalidateAuraModifierTotals(GetAuraType());
+}
+
 uint32 AuraEffect::GetId() const
 {
     return m_spellInfo->Id;
@@ -929,12 +951,16 @@ void AuraEffect::Update(uint32 diff, Unit* caster)
             m_periodicTimer += m_amplitude;
             UpdatePeriodic(caster);
 
-            std::list<AuraApplication*> effectApplications;
-            GetApplicationList(effectApplications);
+            // copy the targets of the effect, ticks can remove applications; unit auras have only one
+            boost::container::small_vector<AuraApplication*, 4> effectApplications;
+            for (auto const& [guid, aurApp] : GetBase()->GetApplicationMap())
+                if (aurApp->HasEffect(GetEffIndex()))
+                    effectApplications.push_back(aurApp);
+
             // tick on targets of effects
-            for (std::list<AuraApplication*>::const_iterator apptItr = effectApplications.begin(); apptItr != effectApplications.end(); ++apptItr)
-                if ((*apptItr)->HasEffect(GetEffIndex()))
-                    PeriodicTick(*apptItr, caster);
+            for (AuraApplication* aurApp : effectApplications)
+                if (aurApp->HasEffect(GetEffIndex()))
+                    PeriodicTick(aurApp, caster);
         }
     }
 }
@@ -4467,6 +4493,7 @@ void AuraEffect::HandleAuraModStat(AuraApplication const* aurApp, uint8 mode, bo
     if (std::abs(spellGroupVal) >= std::abs(GetAmount()))
         return;
 
+    Player::StatUpdateBatch statUpdateBatch(target->ToPlayer());
     for (int32 i = STAT_STRENGTH; i < MAX_STATS; i++)
     {
         // -1 or -2 is all stats (misc < -2 checked in function beginning)
@@ -4499,6 +4526,7 @@ void AuraEffect::HandleModPercentStat(AuraApplication const* aurApp, uint8 mode,
     if (!target->IsPlayer())
         return;
 
+    Player::StatUpdateBatch statUpdateBatch(target->ToPlayer());
     for (int32 i = STAT_STRENGTH; i < MAX_STATS; ++i)
     {
         if (apply)
@@ -4605,21 +4633,24 @@ void AuraEffect::HandleModTotalPercentStat(AuraApplication const* aurApp, uint8
     float healthPct = target->GetHealthPct();
     bool alive = target->IsAlive();
 
-    for (int32 i = STAT_STRENGTH; i < MAX_STATS; i++)
     {
-        if (GetMiscValue() == i || GetMiscValue() == -1)
+        Player::StatUpdateBatch statUpdateBatch(target->ToPlayer());
+        for (int32 i = STAT_STRENGTH; i < MAX_STATS; i++)
         {
-            float amount = target->GetTotalAuraMultiplier(SPELL_AURA_MOD_TOTAL_STAT_PERCENTAGE, [i](AuraEffect const* aurEff)
+            if (GetMiscValue() == i || GetMiscValue() == -1)
             {
-                return (aurEff->GetMiscValue() == i || aurEff->GetMiscValue() == -1);
-            });
+                float amount = target->GetTotalAuraMultiplier(SPELL_AURA_MOD_TOTAL_STAT_PERCENTAGE, [i](AuraEffect const* aurEff)
+                {
+                    return (aurEff->GetMiscValue() == i || aurEff->GetMiscValue() == -1);
+                });
 
-            if (target->GetPctModifierValue(UnitMods(UNIT_MOD_STAT_START + i), TOTAL_PCT) == amount)
-                continue;
+                if (target->GetPctModifierValue(UnitMods(UNIT_MOD_STAT_START + i), TOTAL_PCT) == amount)
+                    continue;
 
-            target->SetStatPctModifier(UnitMods(UNIT_MOD_STAT_START + i), TOTAL_PCT, amount);
-            if (target->IsPlayer() || target->IsPet())
-                target->UpdateStatBuffMod(Stats(i));
+                target->SetStatPctModifier(UnitMods(UNIT_MOD_STAT_START + i), TOTAL_PCT, amount);
+                if (target->IsPlayer() || target->IsPet())
+                    target->UpdateStatBuffMod(Stats(i));
+            }
         }
     }
 
@@ -44,6 +44,9 @@ private:
     ~AuraEffect();
     explicit AuraEffect(Aura* base, uint8 effIndex, int32* baseAmount, Unit* caster);
 public:
+    static void* operator new(std::size_t size) { return Acore::ObjectPool<AuraEffect>::Allocate(size); }
+    static void operator delete(void* ptr, std::size_t size) { Acore::ObjectPool<AuraEffect>::Deallocate(ptr, size); }
+
     Unit* GetCaster() const { return GetBase()->GetCaster(); }
     ObjectGuid GetCasterGUID() const { return GetBase()->GetCasterGUID(); }
     Aura* GetBase() const { return m_base; }
@@ -63,7 +66,7 @@ public:
     AuraType GetAuraType() const;
     int32 GetAmount() const { return m_isAuraEnabled ? m_amount : 0; }
     int32 GetForcedAmount() const { return m_amount; }
-    void SetAmount(int32 amount) { m_amount = amount; m_canBeRecalculated = false;}
+    void SetAmount(int32 amount);
 
     int32 GetPeriodicTimer() const { return m_periodicTimer; }
     void SetPeriodicTimer(int32 periodicTimer) { m_periodicTimer = periodicTimer; }
@@ -114,7 +117,7 @@ public:
 
     int32 GetOldAmount() const { return m_oldAmount; }
     void SetOldAmount(int32 amount) { m_oldAmount = amount; }
-    void SetEnabled(bool enabled) { m_isAuraEnabled = enabled; }
+    void SetEnabled(bool enabled);
 
 private:
     Aura* const m_base;
@@ -145,6 +148,7 @@ private:
     bool m_isPeriodic;
 private:
     float CalcPeriodicCritChance(Unit const* caster, Unit const* target) const;
+    void InvalidateTargetsAuraModifierTotals();
 
 public:
     // aura effect apply/remove handlers
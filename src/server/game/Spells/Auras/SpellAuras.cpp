@@ -46,7 +46,8 @@ static constexpr int32 UPDATE_TARGET_MAP_INTERVAL = 500;
 
 AuraApplication::AuraApplication(Unit* target, Unit* caster, Aura* aura, uint8 effMask):
     _target(target), _base(aura), _removeMode(AURA_REMOVE_NONE), _slot(MAX_AURAS),
-    _flags(AFLAG_NONE), _effectsToApply(effMask), _needClientUpdate(false), _disableMask(0)
+    _flags(AFLAG_NONE), _effectsToApply(effMask), _needClientUpdate(false), _disableMask(0),
+    _procEventFlags(0), _procFlags(0)
 {
     ASSERT(GetTarget() && GetBase());
 
@@ -725,10 +726,21 @@ void Aura::UpdateOwner(uint32 diff, WorldObject* owner)
     else
         m_updateTargetMapInterval -= diff;
 
-    // update aura effects
+    // update aura effects, the combat log of periodic effects ticking together is sent as one packet per target
+    uint8 periodicEffects = 0;
     for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
-        if (m_effects[i])
-            m_effects[i]->Update(diff, caster);
+        if (m_effects[i] && m_effects[i]->IsPeriodic())
+            ++periodicEffects;
+
+    {
+        Optional<PeriodicAuraLogBatch> periodicLogBatch;
+        if (periodicEffects > 1)
+            periodicLogBatch.emplace(this);
+
+        for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
+            if (m_effects[i])
+                m_effects[i]->Update(diff, caster);
+    }
 
     // remove spellmods after effects update
     if (modSpell)
@@ -2154,6 +2166,34 @@ void Aura::PrepareProcToTrigger(AuraApplication* aurApp, ProcEventInfo& eventInf
     AddProcCooldown(procEntry->Cooldown);
 }
 
+// Proc flags Unit::ProcDamageAndSpellFor may trigger the aura on, mirrors the checks of Unit::IsTriggeredAtSpellProcEvent
+uint32 Aura::GetProcEventFlags() const
+{
+    // check proc hooks are called on every event, before the proc flags are checked
+    for (AuraScript* script : m_loadedScripts)
+        if (script->DoCheckProc.size())
+            return uint32(-1);
+
+    // handled by new proc system
+    if (sSpellMgr->GetSpellProcEntry(GetId()))
+        return 0;
+
+    SpellProcEventEntry const* spellProcEvent = sSpellMgr->GetSpellProcEvent(GetId());
+    if (spellProcEvent && spellProcEvent->procFlags)
+        return spellProcEvent->procFlags;
+
+    return GetSpellInfo()->ProcFlags;
+}
+
+// Proc flags Unit::GetProcAurasTriggeredOnEvent may trigger the aura on
+uint32 Aura::GetProcFlags() const
+{
+    if (SpellProcEntry const* procEntry = sSpellMgr->GetSpellProcEntry(GetId()))
+        return procEntry->ProcFlags;
+
+    return 0;
+}
+
 bool Aura::IsProcTriggeredOnEvent(AuraApplication* aurApp, ProcEventInfo& eventInfo) const
 {
     SpellProcEntry const* procEntry = sSpellMgr->GetSpellProcEntry(GetId());
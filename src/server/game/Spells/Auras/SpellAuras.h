@@ -18,6 +18,7 @@
 #ifndef ACORE_SPELLAURAS_H
 #define ACORE_SPELLAURAS_H
 
+#include "ObjectPool.h"
 #include "SpellAuraDefines.h"
 #include "Unit.h"
 
@@ -52,12 +53,18 @@ private:
     // xinef: stacking
     uint8 _disableMask;
 
+    uint32 _procEventFlags;                        // PROC_FLAG_* the aura can trigger on in Unit::ProcDamageAndSpellFor
+    uint32 _procFlags;                             // PROC_FLAG_* of the spell_proc entry of the aura
+
     explicit AuraApplication(Unit* target, Unit* caster, Aura* base, uint8 effMask);
     void _Remove();
 private:
     void _InitFlags(Unit* caster, uint8 effMask);
     void _HandleEffect(uint8 effIndex, bool apply);
 public:
+    static void* operator new(std::size_t size) { return Acore::ObjectPool<AuraApplication>::Allocate(size); }
+    static void operator delete(void* ptr, std::size_t size) { Acore::ObjectPool<AuraApplication>::Deallocate(ptr, size); }
+
     Unit* GetTarget() const { return _target; }
     Aura* GetBase() const { return _base; }
 
@@ -81,6 +88,10 @@ public:
     bool IsActive(uint8 effIdx) { return ((1 << effIdx) & _disableMask) == 0; }
     void SetDisableMask(uint8 effIdx) { _disableMask |= 1 << effIdx; }
     void RemoveDisableMask(uint8 effIdx) { _disableMask &= ~(1 << effIdx); }
+
+    // proc candidate index, see Unit::m_procAuras
+    uint32 GetProcEventFlags() const { return _procEventFlags; }
+    uint32 GetProcFlags() const { return _procFlags; }
 };
 
 class Aura
@@ -202,6 +213,8 @@ public:
     void SetUsingCharges(bool val) { m_isUsingCharges = val; }
     void PrepareProcToTrigger(AuraApplication* aurApp, ProcEventInfo& eventInfo);
     bool IsProcTriggeredOnEvent(AuraApplication* aurApp, ProcEventInfo& eventInfo) const;
+    uint32 GetProcEventFlags() const;
+    uint32 GetProcFlags() const;
     float CalcProcChance(SpellProcEntry const& procEntry, ProcEventInfo& eventInfo) const;
     void TriggerProcOnEvent(AuraApplication* aurApp, ProcEventInfo& eventInfo);
 
@@ -284,6 +297,9 @@ protected:
     explicit UnitAura(SpellInfo const* spellproto, uint8 effMask, WorldObject* owner, Unit* caster, int32* baseAmount, Item* castItem, ObjectGuid casterGUID, ObjectGuid itemGUID = ObjectGuid::Empty);
 
 public:
+    static void* operator new(std::size_t size) { return Acore::ObjectPool<UnitAura>::Allocate(size); }
+    static void operator delete(void* ptr, std::size_t size) { Acore::ObjectPool<UnitAura>::Deallocate(ptr, size); }
+
     void _ApplyForTarget(Unit* target, Unit* caster, AuraApplication* aurApp) override;
     void _UnapplyForTarget(Unit* target, Unit* caster, AuraApplication* aurApp) override;
 
@@ -307,6 +323,9 @@ protected:
     explicit DynObjAura(SpellInfo const* spellproto, uint8 effMask, WorldObject* owner, Unit* caster, int32* baseAmount, Item* castItem, ObjectGuid casterGUID, ObjectGuid itemGUID = ObjectGuid::Empty);
 
 public:
+    static void* operator new(std::size_t size) { return Acore::ObjectPool<DynObjAura>::Allocate(size); }
+    static void operator delete(void* ptr, std::size_t size) { Acore::ObjectPool<DynObjAura>::Deallocate(ptr, size); }
+
     void Remove(AuraRemoveMode removeMode = AURA_REMOVE_BY_DEFAULT) override;
 
     void FillTargetMap(std::map<Unit*, uint8>& targets, Unit* caster) override;
@@ -32,6 +32,7 @@
 #include "InstanceScript.h"
 #include "Log.h"
 #include "LootMgr.h"
+#include "Metric.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "Opcodes.h"
@@ -520,6 +521,9 @@ class SpellEvent : public BasicEvent
         SpellEvent(Spell* spell);
         ~SpellEvent();
 
+        static void* operator new(std::size_t size) { return Acore::ObjectPool<SpellEvent>::Allocate(size); }
+        static void operator delete(void* ptr, std::size_t size) { Acore::ObjectPool<SpellEvent>::Deallocate(ptr, size); }
+
         bool Execute(uint64 e_time, uint32 p_time);
         void Abort(uint64 e_time);
         bool IsDeletable() const;
@@ -670,6 +674,7 @@ Spell::Spell(Unit* caster, SpellInfo const* info, TriggerCastFlags triggerFlags,
     m_immediateHandled = false;
 
     m_channelTargetEffectMask = 0;
+    m_selectingTargets = false;
 
     m_spellFlags = SPELL_FLAG_NORMAL;
 
@@ -822,6 +827,9 @@ void Spell::SelectSpellTargets()
     // select targets for cast phase
     SelectExplicitTargets();
 
+    m_selectingTargets = true;
+    m_areaTargetSearches.clear();
+
     uint32 processedAreaEffectsMask = 0;
     for (uint32 i = 0; i < MAX_SPELL_EFFECTS; ++i)
     {
@@ -831,7 +839,7 @@ void Spell::SelectSpellTargets()
             continue;
 
         // set expected type of implicit targets to be sent to client
-        uint32 implicitTargetMask = GetTargetFlagMask(m_spellInfo->Effects[i].TargetA.GetObjectType()) | GetTargetFlagMask(m_spellInfo->Effects[i].TargetB.GetObjectType());
+        uint32 implicitTargetMask = m_spellInfo->GetEffectProvidedTargetMask(i);
         if (implicitTargetMask & TARGET_FLAG_UNIT)
             m_targets.SetTargetFlag(TARGET_FLAG_UNIT);
         if (implicitTargetMask & (TARGET_FLAG_GAMEOBJECT | TARGET_FLAG_GAMEOBJECT_ITEM))
@@ -855,6 +863,8 @@ void Spell::SelectSpellTargets()
             // maybe do this for all spells?
             if (!focusObject && m_UniqueTargetInfo.empty() && m_UniqueGOTargetInfo.empty() && m_UniqueItemInfo.empty() && !m_targets.HasDst())
             {
+                m_selectingTargets = false;
+                m_areaTargetSearches.clear();
                 SendCastResult(SPELL_FAILED_BAD_IMPLICIT_TARGETS);
                 finish(false);
                 return;
@@ -893,6 +903,9 @@ void Spell::SelectSpellTargets()
         }
     }
 
+    m_selectingTargets = false;
+    m_areaTargetSearches.clear();
+
     if (uint64 dstDelay = CalculateDelayMomentForDst())
         m_delayMoment = dstDelay;
 }
@@ -946,17 +959,19 @@ void Spell::SelectEffectImplicitTargets(SpellEffIndex effIndex, SpellImplicitTar
 
             auto const& effects = GetSpellInfo()->Effects;
 
-            // choose which targets we can select at once
-            for (uint32 j = effIndex + 1; j < MAX_SPELL_EFFECTS; ++j)
+            // choose which targets we can select at once, effects with different implicit targets are filtered out at load time
+            if (uint8 sharedMask = GetSpellInfo()->GetSharedTargetSelectionMask(effIndex))
             {
-                if (effects[j].IsEffect() &&
-                    effects[effIndex].TargetA.GetTarget() == effects[j].TargetA.GetTarget() &&
-                    effects[effIndex].TargetB.GetTarget() == effects[j].TargetB.GetTarget() &&
-                    effects[effIndex].ImplicitTargetConditions == effects[j].ImplicitTargetConditions &&
-                    effects[effIndex].CalcRadius(m_caster) == effects[j].CalcRadius(m_caster) &&
-                    CheckScriptEffectImplicitTargets(effIndex, j))
+                float radius = effects[effIndex].CalcRadius(m_caster);
+                for (uint32 j = effIndex + 1; j < MAX_SPELL_EFFECTS; ++j)
                 {
-                    effectMask |= 1 << j;
+                    if ((sharedMask & (1 << j)) &&
+                        effects[effIndex].ImplicitTargetConditions == effects[j].ImplicitTargetConditions &&
+                        (effects[effIndex].RadiusEntry == effects[j].RadiusEntry || radius == effects[j].CalcRadius(m_caster)) &&
+                        CheckScriptEffectImplicitTargets(effIndex, j))
+                    {
+                        effectMask |= 1 << j;
+                    }
                 }
             }
             processedEffectMask |= effectMask;
@@ -1326,6 +1341,8 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex effIndex, SpellImplicitTarge
             Acore::Containers::RandomResize(targets, maxTargets);
         }
 
+        BatchAreaTargetsLineOfSight(targets);
+
         for (std::list<WorldObject*>::iterator itr = targets.begin(); itr != targets.end(); ++itr)
         {
             if (Unit* unitTarget = (*itr)->ToUnit())
@@ -1333,6 +1350,8 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex effIndex, SpellImplicitTarge
             else if (GameObject* gObjTarget = (*itr)->ToGameObject())
                 AddGOTarget(gObjTarget, effMask);
         }
+
+        m_areaTargetsLineOfSight.clear();
     }
 }
 
@@ -2094,9 +2113,30 @@ void Spell::SearchAreaTargets(std::list<WorldObject*>& targets, float range, Pos
     uint32 containerTypeMask = GetSearcherTypeMask(objectType, condList);
     if (!containerTypeMask)
         return;
+
+    // effects and chains of the same cast searching the same area get a copy of the first search
+    if (m_selectingTargets)
+    {
+        for (AreaTargetSearch const& search : m_areaTargetSearches)
+        {
+            if (search.Range == range && search.Referer == referer && search.ObjectType == objectType && search.SelectionType == selectionType &&
+                search.Conditions == condList && search.Center.GetExactDistSq(position) == 0.0f)
+            {
+                targets.insert(targets.end(), search.Targets.begin(), search.Targets.end());
+                return;
+            }
+        }
+    }
+
+    std::list<WorldObject*> found;
     Acore::WorldObjectSpellAreaTargetCheck check(range, position, m_caster, referer, m_spellInfo, selectionType, condList);
-    Acore::WorldObjectListSearcher<Acore::WorldObjectSpellAreaTargetCheck> searcher(m_caster, targets, check, containerTypeMask);
+    Acore::WorldObjectListSearcher<Acore::WorldObjectSpellAreaTargetCheck> searcher(m_caster, found, check, containerTypeMask);
     SearchTargets<Acore::WorldObjectListSearcher<Acore::WorldObjectSpellAreaTargetCheck> > (searcher, containerTypeMask, m_caster, position, range);
+
+    if (m_selectingTargets)
+        m_areaTargetSearches.push_back({ Position(*position), range, referer, objectType, selectionType, condList, found });
+
+    targets.splice(targets.end(), found);
 }
 
 void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTargets, WorldObject* target, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectType, SpellTargetSelectionCategories  /*selectCategory*/, ConditionList* condList, bool isChainHeal)
@@ -2134,7 +2174,8 @@ void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTar
     if (isBouncingFar)
         searchRadius *= chainTargets;
 
-    WorldObject* chainSource = m_spellInfo->HasAttribute(SPELL_ATTR2_CHAIN_FROM_CASTER) ? m_caster : target;
+    bool chainFromCaster = m_spellInfo->HasAttribute(SPELL_ATTR2_CHAIN_FROM_CASTER);
+    WorldObject* chainSource = chainFromCaster ? m_caster : target;
     std::list<WorldObject*> tempTargets;
     SearchAreaTargets(tempTargets, searchRadius, chainSource, m_caster, objectType, selectType, condList);
     tempTargets.remove(target);
@@ -2144,6 +2185,22 @@ void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTar
     if (!isBouncingFar)
         tempTargets.remove_if([this](WorldObject* target) { return !m_caster->HasInArc(static_cast<float>(M_PI), target); });
 
+    // candidates ordered by distance to the chain source, the first one in range and line of sight is the next jump.
+    // Chains jumping from the caster keep the same source, so the order is computed once and the candidates
+    // out of line of sight are dropped for good
+    std::vector<std::pair<float, WorldObject*>> candidates;
+    auto sortCandidates = [&]()
+    {
+        candidates.clear();
+        for (WorldObject* object : tempTargets)
+            candidates.emplace_back(chainSource->GetExactDistSq(object), object);
+
+        std::stable_sort(candidates.begin(), candidates.end(), [](auto const& left, auto const& right) { return left.first < right.first; });
+    };
+
+    if (!isChainHeal && chainFromCaster)
+        sortCandidates();
+
     while (chainTargets)
     {
         // try to get unit for next chain jump
@@ -2168,15 +2225,33 @@ void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTar
         // get closest object
         else
         {
-            for (std::list<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end(); ++itr)
+            if (!chainFromCaster)
+                sortCandidates();
+
+            for (auto candidate = candidates.begin(); candidate != candidates.end();)
             {
-                if (foundItr == tempTargets.end())
+                WorldObject* object = candidate->second;
+                if (isBouncingFar && !chainSource->IsWithinDist(object, jumpRadius))
                 {
-                    if ((!isBouncingFar || chainSource->IsWithinDist(*itr, jumpRadius)) && chainSource->IsWithinLOSInMap(*itr, VMAP::ModelIgnoreFlags::M2))
-                        foundItr = itr;
+                    ++candidate;
+                    continue;
+                }
+
+                if (!chainSource->IsWithinLOSInMap(object, VMAP::ModelIgnoreFlags::M2))
+                {
+                    if (chainFromCaster)
+                    {
+                        tempTargets.remove(object);
+                        candidate = candidates.erase(candidate);
+                    }
+                    else
+                        ++candidate;
+                    continue;
                 }
-                else if (chainSource->GetDistanceOrder(*itr, *foundItr) && chainSource->IsWithinLOSInMap(*itr, VMAP::ModelIgnoreFlags::M2))
-                    foundItr = itr;
+
+                foundItr = std::find(tempTargets.begin(), tempTargets.end(), object);
+                candidates.erase(candidate);
+                break;
             }
         }
         // not found any valid target - chain ends
@@ -8006,34 +8081,23 @@ bool Spell::CheckEffectTarget(Unit const* target, uint32 eff) const
             break;
         default: // normal case
         {
-            uint32 losChecks = LINEOFSIGHT_ALL_CHECKS;
-            GameObject* gobCaster = nullptr;
-            if (m_originalCasterGUID.IsGameObject())
+            uint32 losChecks;
+            if (!GetTargetLineOfSightChecks(losChecks))
             {
-                gobCaster = m_caster->GetMap()->GetGameObject(m_originalCasterGUID);
-            }
-            else if (m_caster->GetEntry() == WORLD_TRIGGER)
-            {
-                if (TempSummon* tempSummon = m_caster->ToTempSummon())
-                {
-                    gobCaster = tempSummon->GetSummonerGameObject();
-                }
+                return true;
             }
 
-            if (gobCaster)
+            if (target != m_caster)
             {
-                if (gobCaster->GetGOInfo()->IsIgnoringLOSChecks())
+                auto itr = m_areaTargetsLineOfSight.find(target->GetGUID());
+                if (itr != m_areaTargetsLineOfSight.end())
                 {
-                    return true;
+                    if (!itr->second)
+                    {
+                        return false;
+                    }
                 }
-
-                // If spell casted by gameobject then ignore M2 models
-                losChecks &= ~LINEOFSIGHT_CHECK_GOBJECT_M2;
-            }
-
-            if (target != m_caster)
-            {
-                if (m_targets.HasDst())
+                else if (m_targets.HasDst())
                 {
                     float x = m_targets.GetDstPos()->GetPositionX();
                     float y = m_targets.GetDstPos()->GetPositionY();
@@ -8056,6 +8120,96 @@ bool Spell::CheckEffectTarget(Unit const* target, uint32 eff) const
     return true;
 }
 
+bool Spell::GetTargetLineOfSightChecks(uint32& losChecks) const
+{
+    losChecks = LINEOFSIGHT_ALL_CHECKS;
+    GameObject* gobCaster = nullptr;
+    if (m_originalCasterGUID.IsGameObject())
+    {
+        gobCaster = m_caster->GetMap()->GetGameObject(m_originalCasterGUID);
+    }
+    else if (m_caster->GetEntry() == WORLD_TRIGGER)
+    {
+        if (TempSummon* tempSummon = m_caster->ToTempSummon())
+        {
+            gobCaster = tempSummon->GetSummonerGameObject();
+        }
+    }
+
+    if (gobCaster)
+    {
+        if (gobCaster->GetGOInfo()->IsIgnoringLOSChecks())
+        {
+            return false;
+        }
+
+        // If spell casted by gameobject then ignore M2 models
+        losChecks &= ~LINEOFSIGHT_CHECK_GOBJECT_M2;
+    }
+
+    return true;
+}
+
+/// Below this many targets the per target checks of CheckEffectTarget are cheaper than the batch
+static constexpr std::size_t MIN_BATCHED_LOS_TARGETS = 8;
+
+void Spell::BatchAreaTargetsLineOfSight(std::list<WorldObject*> const& targets)
+{
+    m_areaTargetsLineOfSight.clear();
+
+    if (targets.size() < MIN_BATCHED_LOS_TARGETS || m_spellInfo->HasAttribute(SPELL_ATTR2_IGNORE_LINE_OF_SIGHT))
+        return;
+
+    uint32 losChecks;
+    if (!GetTargetLineOfSightChecks(losChecks))
+        return;
+
+    // same segments CheckEffectTarget tests: from the target to the destination, or from the caster to the target
+    std::vector<Unit*> units;
+    std::vector<std::pair<Position, Position>> segments;
+    units.reserve(targets.size());
+    segments.reserve(targets.size());
+
+    uint32 phaseMask = m_caster->GetPhaseMask();
+    for (WorldObject* object : targets)
+    {
+        Unit* unit = object->ToUnit();
+        if (!unit || unit == m_caster)
+            continue;
+
+        Position start, end;
+        if (m_targets.HasDst())
+        {
+            // tested with the phase of the target, targets not sharing the phase of the first one are left to CheckEffectTarget
+            if (!unit->IsInWorld() || unit->GetMap() != m_caster->GetMap() || (!units.empty() && unit->GetPhaseMask() != phaseMask))
+                continue;
+
+            phaseMask = unit->GetPhaseMask();
+            Position const* dst = m_targets.GetDstPos();
+            unit->GetLineOfSightSegment(dst->GetPositionX(), dst->GetPositionY(), dst->GetPositionZ(), start, end);
+        }
+        else
+        {
+            if (!m_caster->IsInMap(unit))
+                continue;
+
+            m_caster->GetLineOfSightSegment(unit, start, end);
+        }
+
+        units.push_back(unit);
+        segments.emplace_back(start, end);
+    }
+
+    if (units.size() < MIN_BATCHED_LOS_TARGETS)
+        return;
+
+    std::vector<bool> inLineOfSight;
+    m_caster->GetMap()->isInLineOfSightBatch(segments, inLineOfSight, phaseMask, LineOfSightChecks(losChecks), VMAP::ModelIgnoreFlags::M2);
+
+    for (std::size_t i = 0; i < units.size(); ++i)
+        m_areaTargetsLineOfSight[units[i]->GetGUID()] = inLineOfSight[i];
+}
+
 bool Spell::IsNextMeleeSwingSpell() const
 {
     return m_spellInfo->HasAttribute(SPELL_ATTR0_ON_NEXT_SWING_NO_DAMAGE);
@@ -8206,6 +8360,23 @@ bool SpellEvent::IsDeletable() const
     return m_Spell->IsDeletable();
 }
 
+template<class T>
+static void LogObjectPoolMetric([[maybe_unused]] char const* type)
+{
+    METRIC_VALUE("object_pool_active", uint64(Acore::ObjectPool<T>::GetActiveCount()), METRIC_TAG("type", type));
+    METRIC_VALUE("object_pool_cached", uint64(Acore::ObjectPool<T>::GetCachedCount()), METRIC_TAG("type", type));
+}
+
+void Spell::LogObjectPoolMetrics()
+{
+    LogObjectPoolMetric<Spell>("Spell");
+    LogObjectPoolMetric<SpellEvent>("SpellEvent");
+    LogObjectPoolMetric<UnitAura>("UnitAura");
+    LogObjectPoolMetric<DynObjAura>("DynObjAura");
+    LogObjectPoolMetric<AuraEffect>("AuraEffect");
+    LogObjectPoolMetric<AuraApplication>("AuraApplication");
+}
+
 bool ReflectEvent::Execute(uint64 /*e_time*/, uint32 /*p_time*/)
 {
     Unit* target = ObjectAccessor::GetUnit(*_caster, _targetGUID);
@@ -21,6 +21,7 @@
 #include "ConditionMgr.h"
 #include "GridDefines.h"
 #include "LootMgr.h"
+#include "ObjectPool.h"
 #include "PathGenerator.h"
 #include "SharedDefines.h"
 #include "SpellInfo.h"
@@ -299,6 +300,12 @@ public:
     Spell(Unit* caster, SpellInfo const* info, TriggerCastFlags triggerFlags, ObjectGuid originalCasterGUID = ObjectGuid::Empty, bool skipCheck = false);
     ~Spell();
 
+    static void* operator new(std::size_t size) { return Acore::ObjectPool<Spell>::Allocate(size); }
+    static void operator delete(void* ptr, std::size_t size) { Acore::ObjectPool<Spell>::Deallocate(ptr, size); }
+
+    // reports the occupancy of the pools of spell and aura objects
+    static void LogObjectPoolMetrics();
+
     void EffectNULL(SpellEffIndex effIndex);
     void EffectUnused(SpellEffIndex effIndex);
     void EffectDistract(SpellEffIndex effIndex);
@@ -498,6 +505,7 @@ public:
     void WriteAmmoToPacket(WorldPacket* data);
 
     bool CheckEffectTarget(Unit const* target, uint32 eff) const;
+    bool GetTargetLineOfSightChecks(uint32& losChecks) const;
     bool CanAutoCast(Unit* target);
     void CheckSrc() { if (!m_targets.HasSrc()) m_targets.SetSrc(*m_caster); }
     void CheckDst() { if (!m_targets.HasDst()) m_targets.SetDst(*m_caster); }
@@ -718,6 +726,25 @@ public:
     void AddUnitTarget(Unit* target, uint32 effectMask, bool checkIfValid = true, bool implicit = true);
     void AddGOTarget(GameObject* target, uint32 effectMask);
     void AddItemTarget(Item* item, uint32 effectMask);
+
+    // line of sight of the targets of an area, tested at once before they are added and looked up by CheckEffectTarget
+    void BatchAreaTargetsLineOfSight(std::list<WorldObject*> const& targets);
+    std::unordered_map<ObjectGuid, bool> m_areaTargetsLineOfSight;
+
+    // results of the grid searches done by SearchAreaTargets during SelectSpellTargets, shared by the effects
+    // and chain jumps searching the same area; the pointers are only valid until the selection ends
+    struct AreaTargetSearch
+    {
+        Position Center;
+        float Range;
+        Unit* Referer;
+        SpellTargetObjectTypes ObjectType;
+        SpellTargetCheckTypes SelectionType;
+        ConditionList* Conditions;
+        std::list<WorldObject*> Targets;
+    };
+    std::vector<AreaTargetSearch> m_areaTargetSearches;
+    bool m_selectingTargets;
     void AddDestTarget(SpellDestination const& dest, uint32 effIndex);
 
     void DoAllEffectOnTarget(TargetInfo* target);
@@ -829,6 +856,9 @@ namespace Acore
         WorldObjectSpellAreaTargetCheck(float range, Position const* position, Unit* caster,
                                         Unit* referer, SpellInfo const* spellInfo, SpellTargetCheckTypes selectionType, ConditionList* condList);
         bool operator()(WorldObject* target);
+
+        Position const* GetRangeCenter() const { return _position; }
+        float GetRange() const { return _range; }
     };
 
     struct WorldObjectSpellConeTargetCheck : public WorldObjectSpellAreaTargetCheck
@@ -855,6 +855,8 @@ SpellInfo::SpellInfo(SpellEntry const* spellEntry)
 
     ChainEntry = nullptr;
     ExplicitTargetMask = 0;
+    _effectProvidedTargetMask.fill(0);
+    _sharedTargetSelectionMask.fill(0);
 
     // Mine
     _isStackableWithRanks = false;
@@ -1948,6 +1950,18 @@ uint32 SpellInfo::GetExplicitTargetMask() const
     return ExplicitTargetMask;
 }
 
+uint32 SpellInfo::GetEffectProvidedTargetMask(uint8 effIndex) const
+{
+    ASSERT(effIndex < MAX_SPELL_EFFECTS);
+    return _effectProvidedTargetMask[effIndex];
+}
+
+uint8 SpellInfo::GetSharedTargetSelectionMask(uint8 effIndex) const
+{
+    ASSERT(effIndex < MAX_SPELL_EFFECTS);
+    return _sharedTargetSelectionMask[effIndex];
+}
+
 AuraStateType SpellInfo::GetAuraState() const
 {
     return _auraState;
@@ -2517,6 +2531,30 @@ void SpellInfo::_InitializeExplicitTargetMask()
     ExplicitTargetMask = targetMask;
 }
 
+void SpellInfo::_InitializeTargetSelectionPlan()
+{
+    for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
+    {
+        _effectProvidedTargetMask[i] = 0;
+        _sharedTargetSelectionMask[i] = 0;
+
+        if (!Effects[i].IsEffect())
+            continue;
+
+        _effectProvidedTargetMask[i] = Effects[i].GetProvidedTargetMask();
+
+        // later effects with the same implicit targets may reuse the area/cone/nearby search of this one,
+        // conditions, radius and script hooks can still differ and are checked when the spell is cast
+        for (uint8 j = i + 1; j < MAX_SPELL_EFFECTS; ++j)
+        {
+            if (Effects[j].IsEffect() &&
+                Effects[i].TargetA.GetTarget() == Effects[j].TargetA.GetTarget() &&
+                Effects[i].TargetB.GetTarget() == Effects[j].TargetB.GetTarget())
+                _sharedTargetSelectionMask[i] |= 1 << j;
+        }
+    }
+}
+
 bool SpellInfo::_IsPositiveEffect(uint8 effIndex, bool deep) const
 {
     // not found a single positive spell with this attribute
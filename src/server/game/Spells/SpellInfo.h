@@ -317,6 +317,8 @@ class AC_GAME_API SpellInfo
 friend class SpellMgr;
 
 public:
+    // Fields read by Spell::prepare, Spell::CheckCast and the aura code on every cast come first,
+    // so they share the first cache lines of the object
     uint32 Id;
     SpellCategoryEntry const* CategoryEntry;
     uint32 Dispel;
@@ -369,19 +371,9 @@ public:
     SpellRangeEntry const* RangeEntry;
     float  Speed;
     uint32 StackAmount;
-    std::array<uint32, 2> Totem;
-    std::array<int32, MAX_SPELL_REAGENTS>  Reagent;
-    std::array<uint32, MAX_SPELL_REAGENTS> ReagentCount;
     int32  EquippedItemClass;
     int32  EquippedItemSubClassMask;
     int32  EquippedItemInventoryTypeMask;
-    std::array<uint32, 2> TotemCategory;
-    std::array<uint32, 2> SpellVisual;
-    uint32 SpellIconID;
-    uint32 ActiveIconID;
-    uint32 SpellPriority;
-    std::array<char const*, 16> SpellName;
-    std::array<char const*, 16> Rank;
     uint32 MaxTargetLevel;
     uint32 MaxAffectedTargets;
     uint32 SpellFamilyName;
@@ -390,10 +382,13 @@ public:
     uint32 PreventionType;
     int32  AreaGroupId;
     uint32 SchoolMask;
-    std::array<SpellEffectInfo, MAX_SPELL_EFFECTS> Effects;
     uint32 ExplicitTargetMask;
     SpellChainNode const* ChainEntry;
 
+    // Target selection data derived from the effects once corrections are applied, see _InitializeTargetSelectionPlan
+    std::array<uint32, MAX_SPELL_EFFECTS> _effectProvidedTargetMask;
+    std::array<uint8, MAX_SPELL_EFFECTS> _sharedTargetSelectionMask;
+
     // Mine
     AuraStateType _auraState;
     SpellSpecificType _spellSpecific;
@@ -402,6 +397,20 @@ public:
     bool _isCritCapable;
     bool _requireCooldownInfo;
 
+    std::array<SpellEffectInfo, MAX_SPELL_EFFECTS> Effects;
+
+    // Reagents, totems and client display data, only read by item checks, packets and commands
+    std::array<uint32, 2> Totem;
+    std::array<int32, MAX_SPELL_REAGENTS>  Reagent;
+    std::array<uint32, MAX_SPELL_REAGENTS> ReagentCount;
+    std::array<uint32, 2> TotemCategory;
+    std::array<uint32, 2> SpellVisual;
+    uint32 SpellIconID;
+    uint32 ActiveIconID;
+    uint32 SpellPriority;
+    std::array<char const*, 16> SpellName;
+    std::array<char const*, 16> Rank;
+
     SpellInfo(SpellEntry const* spellEntry);
     ~SpellInfo();
 
@@ -494,6 +503,8 @@ public:
     uint32 GetDispelMask() const;
     static uint32 GetDispelMask(DispelType type);
     uint32 GetExplicitTargetMask() const;
+    uint32 GetEffectProvidedTargetMask(uint8 effIndex) const;
+    uint8 GetSharedTargetSelectionMask(uint8 effIndex) const;
 
     AuraStateType GetAuraState() const;
     SpellSpecificType GetSpellSpecific() const;
@@ -527,6 +538,7 @@ public:
 
     // loading helpers
     void _InitializeExplicitTargetMask();
+    void _InitializeTargetSelectionPlan();
     bool _IsPositiveEffect(uint8 effIndex, bool deep) const;
     bool _IsPositiveSpell() const;
     static bool _IsPositiveTarget(uint32 targetA, uint32 targetB);
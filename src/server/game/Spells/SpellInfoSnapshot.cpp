@@ -0,0 +1,387 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SpellInfoSnapshot.h"
+#include "ByteBuffer.h"
+#include "CryptoHash.h"
+#include "DBCFileLoader.h"
+#include "GitRevision.h"
+#include "Log.h"
+#include "SpellInfo.h"
+#include "SpellMgr.h"
+#include "Timer.h"
+#include "Util.h"
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace
+{
+    constexpr uint32 SnapshotMagic = 0x53495053; // 'SPIS'
+    constexpr uint32 SnapshotVersion = 1;
+    constexpr uint32 MaxLoggedDifferences = 50;
+
+    struct SnapshotField
+    {
+        char const* Name;
+        void (*Write)(SpellInfo const& spellInfo, ByteBuffer& data);
+    };
+
+    void WriteFlag96(flag96 const& flags, ByteBuffer& data)
+    {
+        data << flags[0] << flags[1] << flags[2];
+    }
+
+    void WriteChainEntry(SpellInfo const& spellInfo, ByteBuffer& data)
+    {
+        SpellChainNode const* node = spellInfo.ChainEntry;
+        data << uint32(node && node->prev ? node->prev->Id : 0);
+        data << uint32(node && node->first ? node->first->Id : 0);
+        data << uint8(node ? node->rank : 0);
+    }
+
+#define SPELL_VALUE(name, value) { name, [](SpellInfo const& spellInfo, ByteBuffer& data) { data << (value); } }
+#define SPELL_FIELD(field) SPELL_VALUE(#field, uint32(spellInfo.field))
+#define SPELL_ENTRY_FIELD(field, id) SPELL_VALUE(#field, uint32(spellInfo.field ? spellInfo.field->id : 0))
+#define SPELL_ARRAY_FIELD(field) { #field, [](SpellInfo const& spellInfo, ByteBuffer& data) { for (auto value : spellInfo.field) data << uint32(value); } }
+#define EFFECT_FIELD(name, value) { "Effects." name, [](SpellInfo const& spellInfo, ByteBuffer& data) { for (SpellEffectInfo const& effect : spellInfo.GetEffects()) data << (value); } }
+
+    // the values written per spell, in file order
+    SnapshotField const SnapshotFields[] =
+    {
+        SPELL_ENTRY_FIELD(CategoryEntry, Id),
+        SPELL_FIELD(Dispel),
+        SPELL_FIELD(Mechanic),
+        SPELL_FIELD(Attributes),
+        SPELL_FIELD(AttributesEx),
+        SPELL_FIELD(AttributesEx2),
+        SPELL_FIELD(AttributesEx3),
+        SPELL_FIELD(AttributesEx4),
+        SPELL_FIELD(AttributesEx5),
+        SPELL_FIELD(AttributesEx6),
+        SPELL_FIELD(AttributesEx7),
+        SPELL_FIELD(AttributesCu),
+        SPELL_FIELD(Stances),
+        SPELL_FIELD(StancesNot),
+        SPELL_FIELD(Targets),
+        SPELL_FIELD(TargetCreatureType),
+        SPELL_FIELD(RequiresSpellFocus),
+        SPELL_FIELD(FacingCasterFlags),
+        SPELL_FIELD(CasterAuraState),
+        SPELL_FIELD(TargetAuraState),
+        SPELL_FIELD(CasterAuraStateNot),
+        SPELL_FIELD(TargetAuraStateNot),
+        SPELL_FIELD(CasterAuraSpell),
+        SPELL_FIELD(TargetAuraSpell),
+        SPELL_FIELD(ExcludeCasterAuraSpell),
+        SPELL_FIELD(ExcludeTargetAuraSpell),
+        SPELL_ENTRY_FIELD(CastTimeEntry, ID),
+        SPELL_FIELD(RecoveryTime),
+        SPELL_FIELD(CategoryRecoveryTime),
+        SPELL_FIELD(StartRecoveryCategory),
+        SPELL_FIELD(StartRecoveryTime),
+        SPELL_FIELD(InterruptFlags),
+        SPELL_FIELD(AuraInterruptFlags),
+        SPELL_FIELD(ChannelInterruptFlags),
+        SPELL_FIELD(ProcFlags),
+        SPELL_FIELD(ProcChance),
+        SPELL_FIELD(ProcCharges),
+        SPELL_FIELD(MaxLevel),
+        SPELL_FIELD(BaseLevel),
+        SPELL_FIELD(SpellLevel),
+        SPELL_ENTRY_FIELD(DurationEntry, ID),
+        SPELL_FIELD(PowerType),
+        SPELL_FIELD(ManaCost),
+        SPELL_FIELD(ManaCostPerlevel),
+        SPELL_FIELD(ManaPerSecond),
+        SPELL_FIELD(ManaPerSecondPerLevel),
+        SPELL_FIELD(ManaCostPercentage),
+        SPELL_FIELD(RuneCostID),
+        SPELL_ENTRY_FIELD(RangeEntry, ID),
+        SPELL_VALUE("Speed", spellInfo.Speed),
+        SPELL_FIELD(StackAmount),
+        SPELL_FIELD(EquippedItemClass),
+        SPELL_FIELD(EquippedItemSubClassMask),
+        SPELL_FIELD(EquippedItemInventoryTypeMask),
+        SPELL_FIELD(MaxTargetLevel),
+        SPELL_FIELD(MaxAffectedTargets),
+        SPELL_FIELD(SpellFamilyName),
+        { "SpellFamilyFlags", [](SpellInfo const& spellInfo, ByteBuffer& data) { WriteFlag96(spellInfo.SpellFamilyFlags, data); } },
+        SPELL_FIELD(DmgClass),
+        SPELL_FIELD(PreventionType),
+        SPELL_FIELD(AreaGroupId),
+        SPELL_FIELD(SchoolMask),
+        SPELL_FIELD(ExplicitTargetMask),
+        { "ChainEntry", &WriteChainEntry },
+        SPELL_VALUE("AuraState", uint32(spellInfo.GetAuraState())),
+        SPELL_VALUE("SpellSpecific", uint32(spellInfo.GetSpellSpecific())),
+        SPELL_VALUE("IsStackableWithRanks", uint8(spellInfo.IsStackableWithRanks())),
+        SPELL_VALUE("IsSpellValid", uint8(spellInfo.IsSpellValid())),
+        SPELL_VALUE("IsCritCapable", uint8(spellInfo.IsCritCapable())),
+        SPELL_ARRAY_FIELD(Totem),
+        SPELL_ARRAY_FIELD(Reagent),
+        SPELL_ARRAY_FIELD(ReagentCount),
+        SPELL_ARRAY_FIELD(TotemCategory),
+        EFFECT_FIELD("Effect", effect.Effect),
+        EFFECT_FIELD("ApplyAuraName", uint32(effect.ApplyAuraName)),
+        EFFECT_FIELD("Amplitude", effect.Amplitude),
+        EFFECT_FIELD("DieSides", effect.DieSides),
+        EFFECT_FIELD("RealPointsPerLevel", effect.RealPointsPerLevel),
+        EFFECT_FIELD("BasePoints", effect.BasePoints),
+        EFFECT_FIELD("PointsPerComboPoint", effect.PointsPerComboPoint),
+        EFFECT_FIELD("ValueMultiplier", effect.ValueMultiplier),
+        EFFECT_FIELD("DamageMultiplier", effect.DamageMultiplier),
+        EFFECT_FIELD("BonusMultiplier", effect.BonusMultiplier),
+        EFFECT_FIELD("MiscValue", effect.MiscValue),
+        EFFECT_FIELD("MiscValueB", effect.MiscValueB),
+        EFFECT_FIELD("Mechanic", uint32(effect.Mechanic)),
+        EFFECT_FIELD("TargetA", uint32(effect.TargetA.GetTarget())),
+        EFFECT_FIELD("TargetB", uint32(effect.TargetB.GetTarget())),
+        EFFECT_FIELD("RadiusEntry", uint32(effect.RadiusEntry ? effect.RadiusEntry->ID : 0)),
+        EFFECT_FIELD("ChainTarget", effect.ChainTarget),
+        EFFECT_FIELD("ItemType", effect.ItemType),
+        EFFECT_FIELD("TriggerSpell", effect.TriggerSpell),
+        { "Effects.SpellClassMask", [](SpellInfo const& spellInfo, ByteBuffer& data) { for (SpellEffectInfo const& effect : spellInfo.GetEffects()) WriteFlag96(effect.SpellClassMask, data); } }
+    };
+
+#undef SPELL_VALUE
+#undef SPELL_FIELD
+#undef SPELL_ENTRY_FIELD
+#undef SPELL_ARRAY_FIELD
+#undef EFFECT_FIELD
+
+    void WriteHeader(ByteBuffer& data, std::string const& key)
+    {
+        data << SnapshotMagic << SnapshotVersion << key;
+        data << uint32(std::size(SnapshotFields));
+        for (SnapshotField const& field : SnapshotFields)
+            data << field.Name;
+    }
+
+    // reads the header and checks its field list matches the one of this build
+    bool ReadHeader(ByteBuffer& data, std::string& key, std::string const& fileName)
+    {
+        if (data.read<uint32>() != SnapshotMagic || data.read<uint32>() != SnapshotVersion)
+        {
+            LOG_ERROR("server.loading", "Spell info snapshot {} isn't a version {} snapshot.", fileName, SnapshotVersion);
+            return false;
+        }
+
+        data >> key;
+
+        uint32 fieldCount = data.read<uint32>();
+        if (fieldCount != std::size(SnapshotFields))
+        {
+            LOG_ERROR("server.loading", "Spell info snapshot {} has {} fields, expected {}.", fileName, fieldCount, std::size(SnapshotFields));
+            return false;
+        }
+
+        for (SnapshotField const& field : SnapshotFields)
+        {
+            std::string name;
+            data >> name;
+            if (name != field.Name)
+            {
+                LOG_ERROR("server.loading", "Spell info snapshot {} has field {} where {} is expected.", fileName, name, field.Name);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool ReadFile(std::string const& fileName, ByteBuffer& data)
+    {
+        std::ifstream file(fileName, std::ios::binary);
+        if (!file)
+            return false;
+
+        std::vector<uint8> const contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        data.append(contents.data(), contents.size());
+        return true;
+    }
+}
+
+void SpellInfoSnapshot::Process(SpellInfoSnapshotMode mode, std::string const& fileName, std::string const& dbcPath)
+{
+    if (mode == SPELL_INFO_SNAPSHOT_DISABLED)
+        return;
+
+    uint32 oldMSTime = getMSTime();
+
+    std::string const key = BuildKey(dbcPath + "Spell.dbc");
+    if (mode == SPELL_INFO_SNAPSHOT_WRITE)
+    {
+        if (ReadKey(fileName) == key)
+        {
+            LOG_INFO("server.loading", ">> Spell info snapshot {} is up to date", fileName);
+            LOG_INFO("server.loading", " ");
+            return;
+        }
+
+        if (Write(fileName, key))
+            LOG_INFO("server.loading", ">> Wrote spell info snapshot {} in {} ms", fileName, GetMSTimeDiffToNow(oldMSTime));
+        else
+            LOG_ERROR("server.loading", "Unable to write spell info snapshot {}.", fileName);
+    }
+    else
+    {
+        int32 differences = Verify(fileName, key);
+        if (differences >= 0)
+            LOG_INFO("server.loading", ">> Verified spell info snapshot {}, {} spells differ, in {} ms", fileName, differences, GetMSTimeDiffToNow(oldMSTime));
+    }
+
+    LOG_INFO("server.loading", " ");
+}
+
+bool SpellInfoSnapshot::Write(std::string const& fileName, std::string const& key)
+{
+    ByteBuffer data;
+    WriteHeader(data, key);
+
+    uint32 const countPos = data.wpos();
+    data << uint32(0);
+
+    uint32 count = 0;
+    for (uint32 i = 0; i < sSpellMgr->GetSpellInfoStoreSize(); ++i)
+    {
+        SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(i);
+        if (!spellInfo)
+            continue;
+
+        data << spellInfo->Id;
+        for (SnapshotField const& field : SnapshotFields)
+            field.Write(*spellInfo, data);
+
+        ++count;
+    }
+
+    data.put<uint32>(countPos, count);
+
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+    if (!file)
+        return false;
+
+    file.write(reinterpret_cast<char const*>(data.contents()), data.size());
+    return bool(file);
+}
+
+int32 SpellInfoSnapshot::Verify(std::string const& fileName, std::string const& key)
+{
+    ByteBuffer data;
+    if (!ReadFile(fileName, data))
+    {
+        LOG_ERROR("server.loading", "Unable to read spell info snapshot {}.", fileName);
+        return -1;
+    }
+
+    uint32 differences = 0;
+    try
+    {
+        std::string snapshotKey;
+        if (!ReadHeader(data, snapshotKey, fileName))
+            return -1;
+
+        if (snapshotKey != key)
+            LOG_INFO("server.loading", "Spell info snapshot {} was built from {}, the spell data is from {}.", fileName, snapshotKey, key);
+
+        std::vector<bool> seen(sSpellMgr->GetSpellInfoStoreSize(), false);
+        ByteBuffer fresh;
+        uint32 const count = data.read<uint32>();
+        for (uint32 i = 0; i < count; ++i)
+        {
+            uint32 const spellId = data.read<uint32>();
+            SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(spellId);
+            if (!spellInfo)
+            {
+                // the values of a missing spell can't be skipped without knowing their size
+                LOG_ERROR("server.loading", "Spell info snapshot {} has spell {} which doesn't exist anymore.", fileName, spellId);
+                return -1;
+            }
+
+            seen[spellId] = true;
+
+            bool differs = false;
+            for (SnapshotField const& field : SnapshotFields)
+            {
+                fresh.clear();
+                field.Write(*spellInfo, fresh);
+
+                std::vector<uint8> stored(fresh.size());
+                data.read(stored.data(), stored.size());
+                if (!std::equal(stored.begin(), stored.end(), fresh.contents()))
+                {
+                    if (differences < MaxLoggedDifferences)
+                        LOG_ERROR("server.loading", "Spell {} differs from spell info snapshot {} in {}.", spellId, fileName, field.Name);
+
+                    differs = true;
+                }
+            }
+
+            if (differs)
+                ++differences;
+        }
+
+        for (uint32 spellId = 0; spellId < seen.size(); ++spellId)
+        {
+            if (seen[spellId] || !sSpellMgr->GetSpellInfo(spellId))
+                continue;
+
+            if (differences < MaxLoggedDifferences)
+                LOG_ERROR("server.loading", "Spell {} is missing from spell info snapshot {}.", spellId, fileName);
+
+            ++differences;
+        }
+    }
+    catch (ByteBufferException const&)
+    {
+        LOG_ERROR("server.loading", "Spell info snapshot {} is truncated.", fileName);
+        return -1;
+    }
+
+    return int32(differences);
+}
+
+std::string SpellInfoSnapshot::BuildKey(std::string const& spellDbcFileName)
+{
+    std::shared_ptr<DBCFileMapping> file = DBCFileMapping::Open(spellDbcFileName.c_str());
+    if (!file)
+        return "";
+
+    Acore::Crypto::SHA1::Digest const digest = Acore::Crypto::SHA1::GetDigestOf(file->GetData(), file->GetSize());
+    return Acore::StringFormat("{}-{}", ByteArrayToHexStr(digest), GitRevision::GetHash());
+}
+
+std::string SpellInfoSnapshot::ReadKey(std::string const& fileName)
+{
+    ByteBuffer data;
+    if (!ReadFile(fileName, data))
+        return "";
+
+    std::string key;
+    try
+    {
+        if (!ReadHeader(data, key, fileName))
+            return "";
+    }
+    catch (ByteBufferException const&)
+    {
+        return "";
+    }
+
+    return key;
+}
@@ -0,0 +1,56 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SPELL_INFO_SNAPSHOT_H
+#define _SPELL_INFO_SNAPSHOT_H
+
+#include "Define.h"
+#include <string>
+
+enum SpellInfoSnapshotMode
+{
+    SPELL_INFO_SNAPSHOT_DISABLED = 0,
+    SPELL_INFO_SNAPSHOT_WRITE    = 1, // stores the computed spell data when the snapshot is missing or stale
+    SPELL_INFO_SNAPSHOT_VERIFY   = 2  // compares the computed spell data with the snapshot
+};
+
+/**
+ * Versioned file of the spell data computed at startup: the SpellInfo
+ * fields after the dbc corrections, the rank chains, the spell specifics
+ * and the custom attributes.
+ *
+ * A snapshot is keyed by the SHA1 of Spell.dbc and the core revision, and
+ * lists the names of its fields so a build adding or reordering them
+ * doesn't compare the wrong values.
+ */
+class AC_GAME_API SpellInfoSnapshot
+{
+public:
+    /// Writes or verifies the snapshot in fileName depending on mode, dbcPath is the directory of Spell.dbc
+    static void Process(SpellInfoSnapshotMode mode, std::string const& fileName, std::string const& dbcPath);
+
+    static bool Write(std::string const& fileName, std::string const& key);
+    /// Logs the spells differing from the snapshot and returns their count, -1 when it can't be read
+    static int32 Verify(std::string const& fileName, std::string const& key);
+
+    /// Hex SHA1 of the dbc file followed by the core revision, empty when the file can't be read
+    static std::string BuildKey(std::string const& spellDbcFileName);
+    /// Key of the snapshot in fileName, empty when it can't be read
+    static std::string ReadKey(std::string const& fileName);
+};
+
+#endif
@@ -3622,6 +3622,7 @@ void SpellMgr::LoadSpellInfoCustomAttributes()
         }
 
         spellInfo->_InitializeExplicitTargetMask();
+        spellInfo->_InitializeTargetSelectionPlan();
 
         if (HasSpellCooldownOverride(spellInfo->Id))
         {
@@ -24,6 +24,7 @@
 #include "SharedDefines.h"
 #include "WorldSession.h"
 #include "WorldSessionMgr.h"
+#include <array>
 
 enum CreatureTextRange
 {
@@ -113,56 +114,46 @@ template<class Builder>
 class CreatureTextLocalizer
 {
 public:
-    CreatureTextLocalizer(Builder const& builder, ChatMsg msgType) : _builder(builder), _msgType(msgType)
-    {
-        _packetCache.resize(TOTAL_LOCALES, nullptr);
-    }
-
-    ~CreatureTextLocalizer()
-    {
-        for (std::size_t i = 0; i < _packetCache.size(); ++i)
-        {
-            if (_packetCache[i])
-                delete _packetCache[i]->first;
-            delete _packetCache[i];
-        }
-    }
+    CreatureTextLocalizer(Builder const& builder, ChatMsg msgType) : _builder(builder), _msgType(msgType) { }
 
     void operator()(Player* player)
     {
         LocaleConstant loc_idx = player->GetSession()->GetSessionDbLocaleIndex();
-        WorldPacket* messageTemplate;
-        std::size_t whisperGUIDpos;
+        LocalizedPacket& cached = _packetCache[loc_idx];
 
         // create if not cached yet
-        if (!_packetCache[loc_idx])
+        if (!cached.Packet)
         {
-            messageTemplate = new WorldPacket();
-            whisperGUIDpos = _builder(messageTemplate, loc_idx);
-            _packetCache[loc_idx] = new std::pair<WorldPacket*, std::size_t>(messageTemplate, whisperGUIDpos);
-        }
-        else
-        {
-            messageTemplate = _packetCache[loc_idx]->first;
-            whisperGUIDpos = _packetCache[loc_idx]->second;
+            std::shared_ptr<WorldPacket> packet = std::make_shared<WorldPacket>();
+            cached.WhisperGUIDPos = _builder(packet.get(), loc_idx);
+            cached.Packet = std::move(packet);
         }
 
-        WorldPacket data(*messageTemplate);
         switch (_msgType)
         {
             case CHAT_MSG_MONSTER_WHISPER:
             case CHAT_MSG_RAID_BOSS_WHISPER:
-                data.put<uint64>(whisperGUIDpos, player->GetGUID().GetRawValue());
+            {
+                WorldPacket data(*cached.Packet);
+                data.put<uint64>(cached.WhisperGUIDPos, player->GetGUID().GetRawValue());
+                player->SendDirectMessage(&data);
                 break;
+            }
             default:
+                // the same for every player of the locale, their sockets queue a reference to it
+                player->GetSession()->SendSharedPacket(cached.Packet);
                 break;
         }
-
-        player->SendDirectMessage(&data);
     }
 
 private:
-    std::vector<std::pair<WorldPacket*, std::size_t>* > _packetCache;
+    struct LocalizedPacket
+    {
+        SharedWorldPacket Packet;
+        std::size_t WhisperGUIDPos = 0;
+    };
+
+    std::array<LocalizedPacket, TOTAL_LOCALES> _packetCache;
     Builder const& _builder;
     ChatMsg _msgType;
 };
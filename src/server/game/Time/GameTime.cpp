@@ -16,6 +16,7 @@
  */
 
 #include "GameTime.h"
+#include "TickClock.h"
 #include "Timer.h"
 
 namespace GameTime
@@ -66,5 +67,6 @@ namespace GameTime
         GameMSTime = GetTimeMS();
         GameTimeSystemPoint = system_clock::now();
         GameTimeSteadyPoint = steady_clock::now();
+        Acore::TickClock::Update(GameTimeSteadyPoint);
     }
 }
@@ -35,7 +35,7 @@ namespace GameTime
     /// Current chrono system_clock time point
     AC_GAME_API SystemTimePoint GetSystemTime();
 
-    /// Current chrono steady_clock time point
+    /// Current chrono steady_clock time point, the same as Acore::TickClock::now() for code outside of game
     AC_GAME_API TimePoint Now();
 
     /// Uptime
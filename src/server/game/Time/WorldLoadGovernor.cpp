@@ -0,0 +1,117 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldLoadGovernor.h"
+#include "Log.h"
+#include "Metric.h"
+#include "MetricRegistry.h"
+
+WorldLoadGovernor sWorldLoadGovernor;
+
+namespace
+{
+    struct LoadSheddingWorkInfo
+    {
+        char const* Name;
+        uint8 Level;    // lowest level deferring the work
+    };
+
+    constexpr std::array<LoadSheddingWorkInfo, std::size_t(LoadSheddingWork::Max)> LoadSheddingWorks =
+    { {
+        { "who_list",           1 },
+        { "calendar_cleanup",   1 },
+        { "guild_reset",        1 },
+        { "visibility_tier",    1 },
+        { "auction_expiry",     2 },
+        { "corpse_cleanup",     2 }
+    } };
+
+    // weight of the last update in the smoothed update time
+    constexpr int64 SmoothingDivisor = 8;
+
+    MetricCounter& GetDeferredWorkCounter(LoadSheddingWork work)
+    {
+        static std::array<MetricCounter*, std::size_t(LoadSheddingWork::Max)> const counters = []()
+        {
+            std::array<MetricCounter*, std::size_t(LoadSheddingWork::Max)> result;
+            for (std::size_t i = 0; i < result.size(); ++i)
+                result[i] = &sMetricRegistry->GetCounter("acore_world_deferred_work_total", "Due work deferred by the load shedding", { { "work", LoadSheddingWorks[i].Name } });
+
+            return result;
+        }();
+
+        return *counters[std::size_t(work)];
+    }
+}
+
+WorldLoadGovernor::WorldLoadGovernor() : _targetUpdateTime(0), _maxDeferral(0), _smoothedUpdateTime(0), _sinceLevelChange(0), _level(0)
+{
+    for (std::atomic<uint64>& deferred : _deferred)
+        deferred.store(0, std::memory_order_relaxed);
+}
+
+void WorldLoadGovernor::SetLimits(Milliseconds targetUpdateTime, Milliseconds maxDeferral)
+{
+    _targetUpdateTime = targetUpdateTime;
+    _maxDeferral = maxDeferral;
+
+    if (_targetUpdateTime == 0ms)
+        SetLevel(0);
+}
+
+void WorldLoadGovernor::OnWorldUpdate(Microseconds updateTime, uint32 diff)
+{
+    if (_targetUpdateTime == 0ms)
+        return;
+
+    _smoothedUpdateTime += (updateTime - _smoothedUpdateTime) / SmoothingDivisor;
+    _sinceLevelChange += Milliseconds(diff);
+    if (_sinceLevelChange < LevelHoldTime)
+        return;
+
+    uint8 const level = GetLevel();
+    if (_smoothedUpdateTime > _targetUpdateTime && level < MaxLevel)
+        SetLevel(level + 1);
+    else if (_smoothedUpdateTime * 4 < _targetUpdateTime * 3 && level > 0)
+        SetLevel(level - 1);
+}
+
+bool WorldLoadGovernor::ShouldDefer(LoadSheddingWork work, Milliseconds overdue)
+{
+    if (GetLevel() < LoadSheddingWorks[std::size_t(work)].Level || overdue >= _maxDeferral)
+        return false;
+
+    _deferred[std::size_t(work)].fetch_add(1, std::memory_order_relaxed);
+    GetDeferredWorkCounter(work).Add();
+    return true;
+}
+
+void WorldLoadGovernor::SetLevel(uint8 level)
+{
+    _sinceLevelChange = 0ms;
+    if (_level.exchange(level, std::memory_order_relaxed) == level)
+        return;
+
+    LOG_INFO("server.worldserver", "World updates take {}us on average for a target of {}ms, load shedding level {}.",
+        _smoothedUpdateTime.count(), _targetUpdateTime.count(), level);
+
+    static MetricGauge& levelGauge = sMetricRegistry->GetGauge("acore_world_load_shedding_level", "Kinds of work deferred by the load shedding, 0 when none");
+    levelGauge.Set(level);
+
+    METRIC_EVENT("events", "Load shedding", "Level " + std::to_string(level));
+    METRIC_VALUE("world_load_shedding_level", uint64(level));
+}
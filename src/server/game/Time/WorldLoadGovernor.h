@@ -0,0 +1,83 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __WORLDLOADGOVERNOR_H
+#define __WORLDLOADGOVERNOR_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <array>
+#include <atomic>
+
+// Work of the world and map updates which can wait for a lighter tick
+enum class LoadSheddingWork : uint8
+{
+    WhoList,            // refresh of the who list cache
+    CalendarCleanup,    // deletion of the old calendar events
+    GuildReset,         // daily guild cap reset
+    VisibilityTier,     // switch to a more expensive dynamic visibility tier
+    AuctionExpiry,      // closing of the expired auctions
+    CorpseCleanup,      // removal of the old corpses by the maps
+
+    Max
+};
+
+/*
+ * Sheds non urgent work while the world updates take longer than a target.
+ *
+ * The governor smooths the duration of the world updates. Above the target
+ * it raises its level one step every LevelHoldTime, below three quarters of
+ * the target it lowers it the same way. Every level defers more kinds of
+ * work, the callers ask ShouldDefer() when their work is due and retry on
+ * the next update when it answers true. Work that already waited
+ * MaxDeferral always runs, so nothing is postponed forever.
+ */
+class AC_GAME_API WorldLoadGovernor
+{
+public:
+    static constexpr uint8 MaxLevel = 2;
+    static constexpr Milliseconds LevelHoldTime = 5s;
+
+    WorldLoadGovernor();
+
+    // a target of 0 disables the shedding
+    void SetLimits(Milliseconds targetUpdateTime, Milliseconds maxDeferral);
+
+    // end of World::Update, with the time it took and its diff
+    void OnWorldUpdate(Microseconds updateTime, uint32 diff);
+
+    // true when the work should wait for a lighter update, overdue is how long it already waited
+    bool ShouldDefer(LoadSheddingWork work, Milliseconds overdue);
+
+    [[nodiscard]] uint8 GetLevel() const { return _level.load(std::memory_order_relaxed); }
+    [[nodiscard]] Microseconds GetSmoothedUpdateTime() const { return _smoothedUpdateTime; }
+    [[nodiscard]] uint64 GetDeferredCount(LoadSheddingWork work) const { return _deferred[std::size_t(work)].load(std::memory_order_relaxed); }
+
+private:
+    void SetLevel(uint8 level);
+
+    Milliseconds _targetUpdateTime;
+    Milliseconds _maxDeferral;
+    Microseconds _smoothedUpdateTime;
+    Milliseconds _sinceLevelChange;
+    std::atomic<uint8> _level;
+    std::array<std::atomic<uint64>, std::size_t(LoadSheddingWork::Max)> _deferred;
+};
+
+AC_GAME_API extern WorldLoadGovernor sWorldLoadGovernor;
+
+#endif
@@ -24,12 +24,14 @@
 #include "Opcodes.h"
 #include "Player.h"
 #include "SharedDefines.h"
+#include "WardenWorker.h"
 #include "World.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
 
 Warden::Warden() : _session(nullptr), _checkTimer(10000/*10 sec*/), _clientResponseTimer(0),
-    _dataSent(false), _module(nullptr), _initialized(false), _interrupted(false), _checkInProgress(false)
+    _dataSent(false), _module(nullptr), _initialized(false), _interrupted(false), _checkInProgress(false),
+    _asyncJob(std::make_shared<AsyncJob>())
 {
     memset(_inputKey, 0, sizeof(_inputKey));
     memset(_outputKey, 0, sizeof(_outputKey));
@@ -38,6 +40,8 @@ Warden::Warden() : _session(nullptr), _checkTimer(10000/*10 sec*/), _clientRespo
 
 Warden::~Warden()
 {
+    WaitForAsync();
+
     delete[] _module->CompressedData;
     delete _module;
     _module = nullptr;
@@ -99,6 +103,11 @@ void Warden::Update(uint32 const diff)
         return;
     }
 
+    if (!ProcessAsync(false))
+    {
+        return;
+    }
+
     if (_dataSent)
     {
         uint32 maxClientResponseDelay = sWorld->getIntConfig(CONFIG_WARDEN_CLIENT_RESPONSE_DELAY);
@@ -127,6 +136,50 @@ void Warden::Update(uint32 const diff)
     }
 }
 
+void Warden::RunAsync(std::function<void()>&& work, std::function<void()>&& done)
+{
+    ASSERT(!_asyncDone);
+
+    _asyncDone = std::move(done);
+    _asyncJob->Pending.store(true, std::memory_order_relaxed);
+    sWardenWorker->Enqueue([job = _asyncJob, work = std::move(work)]()
+    {
+        work();
+        job->Pending.store(false, std::memory_order_release);
+        job->Pending.notify_all();
+    });
+
+    // done right away if the worker isn't running
+    ProcessAsync(false);
+}
+
+bool Warden::ProcessAsync(bool wait)
+{
+    if (!_asyncDone)
+    {
+        return true;
+    }
+
+    if (wait)
+    {
+        WaitForAsync();
+    }
+    else if (_asyncJob->Pending.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    std::function<void()> done = std::move(_asyncDone);
+    _asyncDone = nullptr;
+    done();
+    return true;
+}
+
+void Warden::WaitForAsync()
+{
+    _asyncJob->Pending.wait(true, std::memory_order_acquire);
+}
+
 void Warden::DecryptData(uint8* buffer, uint32 length)
 {
     _inputCrypto.UpdateData(buffer, length);
@@ -319,6 +372,9 @@ void WorldSession::HandleWardenDataOpcode(WorldPacket& recvData)
     if (!_warden || recvData.empty())
         return;
 
+    // the worker may be encrypting a checks request with the same RC4 state
+    _warden->ProcessAsync(true);
+
     _warden->DecryptData(recvData.contents(), recvData.size());
     uint8 opcode;
     recvData >> opcode;
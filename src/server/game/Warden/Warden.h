@@ -23,6 +23,9 @@
 #include "ByteBuffer.h"
 #include "WardenPayloadMgr.h"
 #include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
 
 enum WardenOpcodes
 {
@@ -134,7 +137,22 @@ public:
 
     WardenPayloadMgr* GetPayloadMgr();
 
+    // Runs done of a finished job, or of the running job after waiting for it when wait is set.
+    // Returns false when the job is still running.
+    bool ProcessAsync(bool wait);
+
+protected:
+    // Runs work on the warden worker, then done on the session thread in Update once it finished.
+    // Only one job at a time, derived classes must wait for it in their destructor.
+    void RunAsync(std::function<void()>&& work, std::function<void()>&& done);
+    void WaitForAsync();
+
 private:
+    struct AsyncJob
+    {
+        std::atomic<bool> Pending = false;
+    };
+
     WorldSession* _session;
     WardenPayloadMgr _payloadMgr;
     uint8 _inputKey[16];
@@ -150,6 +168,8 @@ private:
     bool _interrupted;
     bool _checkInProgress;
     uint32 _interruptCounter = 0;
+    std::shared_ptr<AsyncJob> _asyncJob;         // shared with the worker, which may still touch it when the warden is gone
+    std::function<void()> _asyncDone;
 };
 
 #endif
@@ -108,7 +108,11 @@ static ServerConfigs GetMaxWardenChecksForType(uint8 type)
 
 WardenWin::WardenWin() : Warden(), _serverTicks(0) { }
 
-WardenWin::~WardenWin() = default;
+WardenWin::~WardenWin()
+{
+    // the job of the worker uses the members of this class
+    WaitForAsync();
+}
 
 void WardenWin::Init(WorldSession* session, SessionKey const& k)
 {
@@ -265,6 +269,8 @@ bool WardenWin::IsCheckInProgress()
 */
 void WardenWin::ForceChecks()
 {
+    ProcessAsync(true);
+
     if (_dataSent)
     {
         _interrupted = true;
@@ -278,6 +284,8 @@ void WardenWin::RequestChecks()
 {
     LOG_DEBUG("warden", "Request data");
 
+    ProcessAsync(true);
+
     _checkInProgress = true;
 
     // If all checks were done, fill the todo list again
@@ -430,18 +438,38 @@ void WardenWin::RequestChecks()
         }
     );
 
-    ByteBuffer buff;
+    // Resolve the checks while the payloads can't change, the worker only reads this copy
+    _currentCheckData.clear();
+    _currentPayloads.clear();
+    for (uint16 const checkId : _CurrentChecks)
+    {
+        if (WardenCheck const* check = sWardenCheckMgr->GetWardenDataById(checkId))
+        {
+            _currentCheckData.push_back({ checkId, check, false });
+            continue;
+        }
+
+        // Custom payload should be loaded in if equal to over offset.
+        _currentPayloads.push_back(_payloadMgr.CachedChecks.at(checkId));
+        _currentCheckData.push_back({ checkId, &_currentPayloads.back(), true });
+    }
+
+    RunAsync([this]() { BuildChecksRequest(); }, [this]() { SendChecksRequest(); });
+}
+
+void WardenWin::BuildChecksRequest()
+{
+    ByteBuffer& buff = _checksRequest;
+    buff.clear();
     buff << uint8(WARDEN_SMSG_CHEAT_CHECKS_REQUEST);
 
-    for (uint16 const checkId : _CurrentChecks)
+    for (CurrentCheck const& current : _currentCheckData)
     {
-        WardenCheck const* check = sWardenCheckMgr->GetWardenDataById(checkId);
+        WardenCheck const* check = current.Check;
 
         // Custom payloads do not have prefix, midfix, postfix.
-        if (!check && checkId >= WardenPayloadMgr::WardenPayloadOffsetMin)
+        if (current.Payload)
         {
-            check = &_payloadMgr.CachedChecks.at(checkId);
-
             buff << uint8(check->Str.size());
             buff.append(check->Str.data(), check->Str.size());
 
@@ -478,15 +506,9 @@ void WardenWin::RequestChecks()
 
     uint8 index = 1;
 
-    for (uint16 const checkId : _CurrentChecks)
+    for (CurrentCheck const& current : _currentCheckData)
     {
-        WardenCheck const* check = sWardenCheckMgr->GetWardenDataById(checkId);
-
-        // Custom payload should be loaded in if equal to over offset.
-        if (!check && checkId >= WardenPayloadMgr::WardenPayloadOffsetMin)
-        {
-            check = &_payloadMgr.CachedChecks.at(checkId);
-        }
+        WardenCheck const* check = current.Check;
 
         buff << uint8(check->Type ^ xorByte);
         switch (check->Type)
@@ -543,9 +565,12 @@ void WardenWin::RequestChecks()
 
     // Encrypt with warden RC4 key
     EncryptData(buff.contents(), buff.size());
+}
 
-    WorldPacket pkt(SMSG_WARDEN_DATA, buff.size());
-    pkt.append(buff);
+void WardenWin::SendChecksRequest()
+{
+    WorldPacket pkt(SMSG_WARDEN_DATA, _checksRequest.size());
+    pkt.append(_checksRequest);
     _session->SendPacket(&pkt);
 
     _dataSent = true;
@@ -564,9 +589,38 @@ void WardenWin::HandleData(ByteBuffer& buff)
 {
     LOG_DEBUG("warden", "Handle data");
 
+    // a client answering twice must not overtake the verification of its previous response
+    ProcessAsync(true);
+
     _dataSent = false;
     _clientResponseTimer = 0;
 
+    _checksResponse.clear();
+    _checksResponse.append(buff.contents() + buff.rpos(), buff.size() - buff.rpos());
+    buff.rfinish();
+
+    _responseTicks = GameTime::GetGameTimeMS().count();
+
+    RunAsync([this]()
+    {
+        // thrown here it would no longer be caught by the packet processing of the session
+        try
+        {
+            VerifyChecks();
+        }
+        catch (ByteBufferException const&)
+        {
+            LOG_ERROR("network", "WardenWin::VerifyChecks ByteBufferException occured while parsing the checks response of accountid={}. Skipped packet.", _session->GetAccountId());
+            _checksResult = { };
+        }
+    }, [this]() { ApplyChecksResult(); });
+}
+
+void WardenWin::VerifyChecks()
+{
+    ByteBuffer& buff = _checksResponse;
+    _checksResult = { };
+
     uint16 Length;
     buff >> Length;
     uint32 Checksum;
@@ -575,12 +629,7 @@ void WardenWin::HandleData(ByteBuffer& buff)
     if (Length != (buff.size() - buff.rpos()))
     {
         buff.rfinish();
-
-        if (!_interrupted)
-        {
-            ApplyPenalty(0, "Failed size checks in HandleData");
-        }
-
+        _checksResult.Penalty = "Failed size checks in HandleData";
         return;
     }
 
@@ -588,12 +637,7 @@ void WardenWin::HandleData(ByteBuffer& buff)
     {
         buff.rpos(buff.wpos());
         LOG_DEBUG("warden", "CHECKSUM FAIL");
-
-        if (!_interrupted)
-        {
-            ApplyPenalty(0, "Failed checksum in HandleData");
-        }
-
+        _checksResult.Penalty = "Failed checksum in HandleData";
         return;
     }
 
@@ -612,7 +656,7 @@ void WardenWin::HandleData(ByteBuffer& buff)
         uint32 newClientTicks;
         buff >> newClientTicks;
 
-        uint32 ticksNow = GameTime::GetGameTimeMS().count();
+        uint32 ticksNow = _responseTicks;
         uint32 ourTicks = newClientTicks + (ticksNow - _serverTicks);
 
         LOG_DEBUG("warden", "ServerTicks {}", ticksNow);         // Now
@@ -623,15 +667,10 @@ void WardenWin::HandleData(ByteBuffer& buff)
 
     uint16 checkFailed = 0;
 
-    for (uint16 const checkId : _CurrentChecks)
+    for (CurrentCheck const& current : _currentCheckData)
     {
-        WardenCheck const* rd = sWardenCheckMgr->GetWardenDataById(checkId);
-
-        // Custom payload should be loaded in if equal to over offset.
-        if (!rd && checkId >= WardenPayloadMgr::WardenPayloadOffsetMin)
-        {
-            rd = &_payloadMgr.CachedChecks.at(checkId);
-        }
+        WardenCheck const* rd = current.Check;
+        uint16 const checkId = current.Id;
 
         uint8 const type = rd->Type;
         switch (type)
@@ -747,6 +786,24 @@ void WardenWin::HandleData(ByteBuffer& buff)
         }
     }
 
+    _checksResult.FailedCheckId = checkFailed;
+    _checksResult.Completed = true;
+}
+
+void WardenWin::ApplyChecksResult()
+{
+    if (!_checksResult.Completed)
+    {
+        if (!_checksResult.Penalty.empty() && !_interrupted)
+        {
+            ApplyPenalty(0, _checksResult.Penalty);
+        }
+
+        return;
+    }
+
+    uint16 const checkFailed = _checksResult.FailedCheckId;
+
     if (checkFailed > 0 && !_interrupted)
     {
         ApplyPenalty(checkFailed, "");
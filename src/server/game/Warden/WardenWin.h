@@ -21,6 +21,7 @@
 #include "ByteBuffer.h"
 #include "Warden.h"
 #include <list>
+#include <vector>
 
 #if defined(__GNUC__)
 #pragma pack(1)
@@ -84,11 +85,39 @@ public:
     void HandleData(ByteBuffer& buff) override;
 
 private:
+    struct CurrentCheck
+    {
+        uint16 Id;
+        WardenCheck const* Check;
+        bool Payload;                            // custom payload, sent without prefix, midfix and postfix
+    };
+
+    struct ChecksResult
+    {
+        std::string Penalty;                     // response rejected before its checks were looked at
+        uint16 FailedCheckId = 0;
+        bool Completed = false;
+    };
+
+    // Run on the warden worker, they only touch the members below
+    void BuildChecksRequest();
+    void VerifyChecks();
+
+    void SendChecksRequest();
+    void ApplyChecksResult();
+
     uint32 _serverTicks;
     std::list<uint16> _ChecksTodo[MAX_WARDEN_CHECK_TYPES];
 
     std::list<uint16> _CurrentChecks;
     std::list<uint16> _PendingChecks;
+
+    std::vector<CurrentCheck> _currentCheckData;
+    std::list<WardenCheck> _currentPayloads;     // copies, the payload manager may change while the worker runs
+    ByteBuffer _checksRequest;
+    ByteBuffer _checksResponse;
+    uint32 _responseTicks = 0;
+    ChecksResult _checksResult;
 };
 
 #endif // _WARDEN_WIN_H
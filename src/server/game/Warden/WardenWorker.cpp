@@ -0,0 +1,108 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WardenWorker.h"
+#include <algorithm>
+#include <iterator>
+
+WardenWorker::~WardenWorker()
+{
+    Stop();
+}
+
+WardenWorker* WardenWorker::instance()
+{
+    static WardenWorker instance;
+    return &instance;
+}
+
+void WardenWorker::Start(uint32 threadCount)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    if (_running || !threadCount)
+        return;
+
+    _running = true;
+    for (uint32 i = 0; i < threadCount; ++i)
+        _threads.emplace_back(&WardenWorker::WorkerThread, this);
+}
+
+void WardenWorker::Stop()
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _running = false;
+    }
+
+    _condition.notify_all();
+
+    for (std::thread& thread : _threads)
+        thread.join();
+
+    _threads.clear();
+}
+
+void WardenWorker::Enqueue(Job&& job)
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        if (_running)
+        {
+            _queue.push_back(std::move(job));
+            job = nullptr;
+        }
+    }
+
+    if (job)
+    {
+        job();
+        return;
+    }
+
+    _condition.notify_one();
+}
+
+void WardenWorker::WorkerThread()
+{
+    std::vector<Job> batch;
+    batch.reserve(BatchSize);
+
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            _condition.wait(lock, [this]() { return !_queue.empty() || !_running; });
+
+            // the queue is drained before stopping, sessions wait for their jobs
+            if (_queue.empty())
+                return;
+
+            std::size_t const count = std::min(_queue.size(), BatchSize);
+            std::move(_queue.begin(), _queue.begin() + count, std::back_inserter(batch));
+            _queue.erase(_queue.begin(), _queue.begin() + count);
+
+            // more work than one batch, wake another thread
+            if (!_queue.empty())
+                _condition.notify_one();
+        }
+
+        for (Job& job : batch)
+            job();
+
+        batch.clear();
+    }
+}
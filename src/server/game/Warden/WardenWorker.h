@@ -0,0 +1,67 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _WARDEN_WORKER_H
+#define _WARDEN_WORKER_H
+
+#include "Define.h"
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+* @class WardenWorker
+* @brief Threads doing the packet crypto and the check verification of the warden of all sessions.
+* @details Building a checks request and verifying its response costs a few hashes and RC4 passes per
+* session and cycle. The worker takes these jobs off the session update, its threads pick them up in
+* batches of WardenWorker::BatchSize so the jobs of many sessions share one wakeup. When it is not
+* started, jobs run right away on the calling thread.
+*/
+class WardenWorker
+{
+    WardenWorker() = default;
+    ~WardenWorker();
+
+public:
+    using Job = std::function<void()>;
+
+    static constexpr std::size_t BatchSize = 64;
+
+    static WardenWorker* instance();
+
+    void Start(uint32 threadCount);
+
+    // Finishes the queued jobs and joins the threads
+    void Stop();
+
+    void Enqueue(Job&& job);
+
+private:
+    void WorkerThread();
+
+    std::vector<std::thread> _threads;
+    std::mutex _lock;
+    std::condition_variable _condition;
+    std::vector<Job> _queue;
+    bool _running = false;
+};
+
+#define sWardenWorker WardenWorker::instance()
+
+#endif // _WARDEN_WORKER_H
@@ -0,0 +1,130 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StartupLoaderGraph.h"
+#include "Errors.h"
+#include "Log.h"
+#include "Timer.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+void StartupLoaderGraph::AddStep(std::string name, std::function<void()> step, std::vector<std::string> const& dependencies /*= {}*/)
+{
+    std::size_t const index = _steps.size();
+    Step& node = _steps.emplace_back();
+    node.Name = std::move(name);
+    node.Function = std::move(step);
+
+    for (std::string const& dependency : dependencies)
+    {
+        auto itr = std::find_if(_steps.begin(), _steps.begin() + index, [&](Step const& other) { return other.Name == dependency; });
+        ASSERT(itr != _steps.begin() + index, "Startup step '{}' depends on '{}' which was not added before it", node.Name, dependency);
+
+        itr->Dependents.push_back(index);
+        ++node.Dependencies;
+    }
+}
+
+void StartupLoaderGraph::Execute(Step& step)
+{
+    uint32 const oldMSTime = getMSTime();
+    step.Function();
+    step.Duration = Milliseconds(GetMSTimeDiffToNow(oldMSTime));
+}
+
+void StartupLoaderGraph::Run(uint32 threads)
+{
+    uint32 const oldMSTime = getMSTime();
+
+    threads = std::min<uint32>(threads, _steps.size());
+    if (threads <= 1)
+    {
+        for (Step& step : _steps)
+            Execute(step);
+
+        LogReport(Milliseconds(GetMSTimeDiffToNow(oldMSTime)));
+        return;
+    }
+
+    std::mutex lock;
+    std::condition_variable condition;
+    std::deque<std::size_t> ready;
+    std::size_t finished = 0;
+
+    for (std::size_t i = 0; i < _steps.size(); ++i)
+        if (!_steps[i].Dependencies)
+            ready.push_back(i);
+
+    auto worker = [&]()
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        for (;;)
+        {
+            condition.wait(guard, [&]() { return !ready.empty() || finished == _steps.size(); });
+            if (ready.empty())
+                return;
+
+            Step& step = _steps[ready.front()];
+            ready.pop_front();
+
+            guard.unlock();
+            Execute(step);
+            guard.lock();
+
+            ++finished;
+            for (std::size_t dependent : step.Dependents)
+                if (!--_steps[dependent].Dependencies)
+                    ready.push_back(dependent);
+
+            condition.notify_all();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (uint32 i = 0; i < threads; ++i)
+        workers.emplace_back(worker);
+
+    for (std::thread& thread : workers)
+        thread.join();
+
+    LogReport(Milliseconds(GetMSTimeDiffToNow(oldMSTime)));
+}
+
+void StartupLoaderGraph::LogReport(Milliseconds total) const
+{
+    std::vector<Step const*> sorted;
+    sorted.reserve(_steps.size());
+    for (Step const& step : _steps)
+        sorted.push_back(&step);
+
+    std::sort(sorted.begin(), sorted.end(), [](Step const* left, Step const* right) { return left->Duration > right->Duration; });
+
+    Milliseconds sum{0};
+    LOG_INFO("server.loading", ">> {} timings:", _name);
+    for (Step const* step : sorted)
+    {
+        LOG_INFO("server.loading", "   {:<36} {:>6} ms", step->Name, step->Duration.count());
+        sum += step->Duration;
+    }
+
+    LOG_INFO("server.loading", ">> {} loaded in {} ms ({} ms of steps)", _name, total.count(), sum.count());
+    LOG_INFO("server.loading", " ");
+}
@@ -0,0 +1,62 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _STARTUPLOADERGRAPH_H
+#define _STARTUPLOADERGRAPH_H
+
+#include "Define.h"
+#include "Duration.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * Runs startup load steps with declared dependencies.
+ *
+ * Steps without a path between them may run at the same time, so a step
+ * must only write the containers it owns and only read containers of the
+ * steps it depends on. Dependencies have to be added before the steps
+ * using them, which keeps the graph acyclic.
+ */
+class AC_GAME_API StartupLoaderGraph
+{
+public:
+    explicit StartupLoaderGraph(std::string name) : _name(std::move(name)) { }
+
+    void AddStep(std::string name, std::function<void()> step, std::vector<std::string> const& dependencies = {});
+
+    /// Blocks until all steps finished, threads <= 1 runs the steps in the order they were added
+    void Run(uint32 threads);
+
+private:
+    struct Step
+    {
+        std::string Name;
+        std::function<void()> Function;
+        std::vector<std::size_t> Dependents;
+        uint32 Dependencies{0};
+        Milliseconds Duration{0};
+    };
+
+    void Execute(Step& step);
+    void LogReport(Milliseconds total) const;
+
+    std::string _name;
+    std::vector<Step> _steps;
+};
+
+#endif
@@ -23,6 +23,7 @@
 #include "AccountMgr.h"
 #include "AchievementMgr.h"
 #include "AddonMgr.h"
+#include "AllocatorStats.h"
 #include "ArenaTeamMgr.h"
 #include "ArenaSeasonMgr.h"
 #include "AuctionHouseMgr.h"
@@ -42,27 +43,33 @@
 #include "CreatureGroups.h"
 #include "CreatureTextMgr.h"
 #include "DBCStores.h"
+#include "DBUpdater.h"
 #include "DatabaseEnv.h"
 #include "DisableMgr.h"
 #include "DynamicVisibility.h"
+#include "FrameArena.h"
 #include "GameEventMgr.h"
 #include "GameGraveyard.h"
 #include "GameTime.h"
 #include "GitRevision.h"
 #include "GridNotifiersImpl.h"
+#include "GridTerrainDataStore.h"
 #include "GroupMgr.h"
 #include "GuildMgr.h"
 #include "IPLocation.h"
 #include "InstanceSaveMgr.h"
 #include "ItemEnchantmentMgr.h"
 #include "LFGMgr.h"
+#include "LoaderCache.h"
 #include "Log.h"
 #include "LootItemStorage.h"
 #include "LootMgr.h"
 #include "M2Stores.h"
 #include "MMapFactory.h"
 #include "MapMgr.h"
+#include "MapReplay.h"
 #include "Metric.h"
+#include "MetricRegistry.h"
 #include "MotdMgr.h"
 #include "ObjectMgr.h"
 #include "Opcodes.h"
@@ -71,13 +78,17 @@
 #include "Player.h"
 #include "PlayerDump.h"
 #include "PoolMgr.h"
+#include "Profiler.h"
 #include "Realm.h"
 #include "ScriptMgr.h"
 #include "ServerMailMgr.h"
 #include "SkillDiscovery.h"
 #include "SkillExtraItems.h"
 #include "SmartAI.h"
+#include "Spell.h"
+#include "SpellInfoSnapshot.h"
 #include "SpellMgr.h"
+#include "StartupLoaderGraph.h"
 #include "TaskScheduler.h"
 #include "TicketMgr.h"
 #include "Transport.h"
@@ -88,10 +99,12 @@
 #include "VMapMgr2.h"
 #include "Warden.h"
 #include "WardenCheckMgr.h"
+#include "WardenWorker.h"
 #include "WaypointMovementGenerator.h"
 #include "WeatherMgr.h"
 #include "WhoListCacheMgr.h"
 #include "WorldGlobals.h"
+#include "WorldLoadGovernor.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
 #include "WorldSessionMgr.h"
@@ -188,6 +201,9 @@ void World::LoadConfigSettings(bool reload)
         sWorldSessionMgr->SetPlayerAmountLimit(sConfigMgr->GetOption<int32>("PlayerLimit", 1000));
 
     _worldConfig.Initialize(reload);
+    sConfigOptions->Load();
+
+    sWorldLoadGovernor.SetLimits(Milliseconds(getIntConfig(CONFIG_LOAD_SHEDDING_TARGET_UPDATE_TIME)), Milliseconds(getIntConfig(CONFIG_LOAD_SHEDDING_MAX_DEFERRAL)));
 
     for (uint8 i = 0; i < MAX_MOVE_TYPE; ++i)
         playerBaseMoveSpeed[i] = baseMoveSpeed[i] * getRate(RATE_MOVESPEED_PLAYER);
@@ -207,6 +223,9 @@ void World::LoadConfigSettings(bool reload)
 
         _timers[WUPDATE_AUTOBROADCAST].SetInterval(getIntConfig(CONFIG_AUTOBROADCAST_INTERVAL));
         _timers[WUPDATE_AUTOBROADCAST].Reset();
+
+        _timers[WUPDATE_GUILD_LOGS].SetInterval(std::max<uint32>(getIntConfig(CONFIG_GUILD_LOG_SAVE_INTERVAL), 1) * IN_MILLISECONDS);
+        _timers[WUPDATE_GUILD_LOGS].Reset();
     }
 
     if (getIntConfig(CONFIG_CLIENTCACHE_VERSION) == 0)
@@ -295,6 +314,8 @@ void World::LoadConfigSettings(bool reload)
 
     MMAP::MMapFactory::InitializeDisabledMaps();
 
+    sGridTerrainDataStore->SetCacheSize(getIntConfig(CONFIG_GRID_TERRAIN_CACHE_SIZE));
+
     // call ScriptMgr if we're reloading the configuration
     sScriptMgr->OnAfterConfigLoad(reload);
 }
@@ -429,6 +450,8 @@ void World::SetInitialWorldSettings()
     LOG_INFO("server.loading", "Loading SpellInfo Custom Attributes...");
     sSpellMgr->LoadSpellInfoCustomAttributes();
 
+    SpellInfoSnapshot::Process(SpellInfoSnapshotMode(getIntConfig(CONFIG_SPELL_INFO_SNAPSHOT)), std::string(getStringConfig(CONFIG_SPELL_INFO_SNAPSHOT_FILE)), _dataPath + "dbc/");
+
     LOG_INFO("server.loading", "Loading Player Totem models...");
     sObjectMgr->LoadPlayerTotemModels();
 
@@ -441,6 +464,9 @@ void World::SetInitialWorldSettings()
     LOG_INFO("server.loading", "Loading Script Names...");
     sObjectMgr->LoadScriptNames();
 
+    if (getBoolConfig(CONFIG_LOADER_CACHE))
+        sLoaderCache->Initialize(DBUpdater<WorldDatabaseConnection>::GetUpdatesHash(WorldDatabase));
+
     LOG_INFO("server.loading", "Loading Instance Template...");
     sObjectMgr->LoadInstanceTemplate();
 
@@ -451,31 +477,30 @@ void World::SetInitialWorldSettings()
     LOG_INFO("server.loading", "Loading Instances...");
     sInstanceSaveMgr->LoadInstances();
 
-    LOG_INFO("server.loading", "Loading Broadcast Texts...");
-    sObjectMgr->LoadBroadcastTexts();
-    sObjectMgr->LoadBroadcastTextLocales();
-
-    LOG_INFO("server.loading", "Loading Localization Strings...");
-    uint32 oldMSTime = getMSTime();
-    sObjectMgr->LoadCreatureLocales();
-    sObjectMgr->LoadGameObjectLocales();
-    sObjectMgr->LoadItemLocales();
-    sObjectMgr->LoadItemSetNameLocales();
-    sObjectMgr->LoadQuestLocales();
-    sObjectMgr->LoadQuestOfferRewardLocale();
-    sObjectMgr->LoadQuestRequestItemsLocale();
-    sObjectMgr->LoadNpcTextLocales();
-    sObjectMgr->LoadPageTextLocales();
-    sObjectMgr->LoadGossipMenuItemsLocales();
-    sObjectMgr->LoadPointOfInterestLocales();
-    sObjectMgr->LoadPetNamesLocales();
+    LOG_INFO("server.loading", "Loading Broadcast Texts, Localization Strings, Page Texts and NPC Texts...");
+    {
+        // every step only fills its own ObjectMgr store, see StartupLoaderGraph
+        StartupLoaderGraph texts("Texts and Localization Strings");
+        texts.AddStep("broadcast_text", [] { sObjectMgr->LoadBroadcastTexts(); });
+        texts.AddStep("broadcast_text_locale", [] { sObjectMgr->LoadBroadcastTextLocales(); }, { "broadcast_text" });
+        texts.AddStep("creature_template_locale", [] { sObjectMgr->LoadCreatureLocales(); });
+        texts.AddStep("gameobject_template_locale", [] { sObjectMgr->LoadGameObjectLocales(); });
+        texts.AddStep("item_template_locale", [] { sObjectMgr->LoadItemLocales(); });
+        texts.AddStep("item_set_names_locale", [] { sObjectMgr->LoadItemSetNameLocales(); });
+        texts.AddStep("quest_template_locale", [] { sObjectMgr->LoadQuestLocales(); });
+        texts.AddStep("quest_offer_reward_locale", [] { sObjectMgr->LoadQuestOfferRewardLocale(); });
+        texts.AddStep("quest_request_items_locale", [] { sObjectMgr->LoadQuestRequestItemsLocale(); });
+        texts.AddStep("npc_text_locale", [] { sObjectMgr->LoadNpcTextLocales(); });
+        texts.AddStep("page_text_locale", [] { sObjectMgr->LoadPageTextLocales(); });
+        texts.AddStep("gossip_menu_option_locale", [] { sObjectMgr->LoadGossipMenuItemsLocales(); });
+        texts.AddStep("points_of_interest_locale", [] { sObjectMgr->LoadPointOfInterestLocales(); });
+        texts.AddStep("pet_name_generation_locale", [] { sObjectMgr->LoadPetNamesLocales(); });
+        texts.AddStep("page_text", [] { sObjectMgr->LoadPageTexts(); });
+        texts.AddStep("npc_text", [] { sObjectMgr->LoadGossipText(); }, { "broadcast_text" });
+        texts.Run(getIntConfig(CONFIG_STARTUP_LOADER_THREADS));
+    }
 
     sObjectMgr->SetDBCLocaleIndex(GetDefaultDbcLocale());        // Get once for all the locale index of DBC language (console/broadcasts)
-    LOG_INFO("server.loading", ">> Localization Strings loaded in {} ms", GetMSTimeDiffToNow(oldMSTime));
-    LOG_INFO("server.loading", " ");
-
-    LOG_INFO("server.loading", "Loading Page Texts...");
-    sObjectMgr->LoadPageTexts();
 
     LOG_INFO("server.loading", "Loading Game Object Templates...");         // must be after LoadPageTexts
     sObjectMgr->LoadGameObjectTemplate();
@@ -513,9 +538,6 @@ void World::SetInitialWorldSettings()
     LOG_INFO("server.loading", "Loading Spell Group Stack Rules...");
     sSpellMgr->LoadSpellGroupStackRules();
 
-    LOG_INFO("server.loading", "Loading NPC Texts...");
-    sObjectMgr->LoadGossipText();
-
     LOG_INFO("server.loading", "Loading Enchant Spells Proc Datas...");
     sSpellMgr->LoadSpellEnchantProcData();
 
@@ -901,6 +923,9 @@ void World::SetInitialWorldSettings()
 
     _timers[WUPDATE_WHO_LIST].SetInterval(5 * IN_MILLISECONDS); // update who list cache every 5 seconds
 
+    // a reload to 0 still saves the entries logged before it
+    _timers[WUPDATE_GUILD_LOGS].SetInterval(std::max<uint32>(getIntConfig(CONFIG_GUILD_LOG_SAVE_INTERVAL), 1) * IN_MILLISECONDS);
+
     _mail_expire_check_timer = GameTime::GetGameTime() + 6h;
 
     ///- Initialize MapMgr
@@ -958,6 +983,9 @@ void World::SetInitialWorldSettings()
     LOG_INFO("server.loading", "Loading Warden Action Overrides..." );
     sWardenCheckMgr->LoadWardenOverrides();
 
+    if (getBoolConfig(CONFIG_WARDEN_ENABLED))
+        sWardenWorker->Start(getIntConfig(CONFIG_WARDEN_WORKER_THREADS));
+
     LOG_INFO("server.loading", "Deleting Expired Bans...");
     LoginDatabase.Execute("DELETE FROM ip_banned WHERE unbandate <= UNIX_TIMESTAMP() AND unbandate<>bandate");      // One-time query
 
@@ -1029,6 +1057,8 @@ void World::SetInitialWorldSettings()
             sMapMgr->GetMapUpdater()->wait();
     }
 
+    sLoaderCache->FinishStartup();
+
     uint32 startupDuration = GetMSTimeDiffToNow(startupBegin);
 
     LOG_INFO("server.loading", " ");
@@ -1089,9 +1119,70 @@ void World::DetectDBCLang()
 }
 
 /// Update the World !
+static void LogBufferPoolMetrics()
+{
+#if !defined PERFORMANCE_PROFILING && !defined WITHOUT_METRICS
+    if (!sMetric->IsEnabled())
+        return;
+
+    for (std::size_t sizeClass = 0; sizeClass < Acore::BufferPool::SizeClassCount; ++sizeClass)
+    {
+        Acore::BufferPool::Stats const stats = Acore::BufferPool::GetStats(sizeClass);
+        std::string const blockSize = std::to_string(Acore::BufferPool::GetBlockSize(sizeClass));
+        METRIC_VALUE("buffer_pool_allocations", stats.Allocations, METRIC_TAG("size", blockSize));
+        METRIC_VALUE("buffer_pool_heap_allocations", stats.HeapAllocations, METRIC_TAG("size", blockSize));
+        METRIC_VALUE("buffer_pool_active", uint64(stats.Active), METRIC_TAG("size", blockSize));
+        METRIC_VALUE("buffer_pool_cached", uint64(stats.Cached), METRIC_TAG("size", blockSize));
+    }
+#endif
+}
+
+static void LogAllocatorMetrics(uint32 diff)
+{
+#if !defined PERFORMANCE_PROFILING && !defined WITHOUT_METRICS
+    // reading the arena statistics walks every arena of the allocator
+    static TimeTrackerSmall timer(10 * IN_MILLISECONDS);
+    timer.Update(diff);
+    if (!timer.Passed() || !sMetric->IsEnabled())
+        return;
+
+    timer.Reset(10 * IN_MILLISECONDS);
+
+    Acore::AllocatorStats::Stats stats;
+    bool const available = Acore::AllocatorStats::GetStats(stats, true);
+    METRIC_VALUE("process_resident", stats.ProcessResident);
+    if (!available)
+        return;
+
+    std::string const allocator = Acore::AllocatorStats::GetAllocatorName();
+    METRIC_VALUE("allocator_allocated", stats.Allocated, METRIC_TAG("allocator", allocator));
+    METRIC_VALUE("allocator_active", stats.Active, METRIC_TAG("allocator", allocator));
+    METRIC_VALUE("allocator_resident", stats.Resident, METRIC_TAG("allocator", allocator));
+    METRIC_VALUE("allocator_mapped", stats.Mapped, METRIC_TAG("allocator", allocator));
+    METRIC_VALUE("allocator_retained", stats.Retained, METRIC_TAG("allocator", allocator));
+    METRIC_VALUE("allocator_fragmentation", stats.GetFragmentation(), METRIC_TAG("allocator", allocator));
+
+    for (Acore::AllocatorStats::Arena const& arena : stats.Arenas)
+    {
+        std::string const index = std::to_string(arena.Index);
+        METRIC_VALUE("allocator_arena_active", arena.Active, METRIC_TAG("arena", index));
+        METRIC_VALUE("allocator_arena_dirty", arena.Dirty, METRIC_TAG("arena", index));
+        METRIC_VALUE("allocator_arena_threads", arena.Threads, METRIC_TAG("arena", index));
+    }
+#else
+    (void)diff;
+#endif
+}
+
 void World::Update(uint32 diff)
 {
     METRIC_TIMER("world_update_time_total");
+    PROFILER_ZONE("World::Update");
+
+    TimePoint const updateStart = std::chrono::steady_clock::now();
+
+    ///- Write the profiler capture once its duration elapsed
+    sProfiler->Update();
 
     ///- Update the game time and check for shutdown time
     _UpdateGameTime();
@@ -1102,7 +1193,23 @@ void World::Update(uint32 diff)
     // Record update if recording set in log and diff is greater then minimum set in log
     sWorldUpdateTime.RecordUpdateTime(GameTime::GetGameTimeMS(), diff, sWorldSessionMgr->GetActiveSessionCount());
 
-    DynamicVisibilityMgr::Update(sWorldSessionMgr->GetActiveSessionCount());
+    DynamicVisibilityMgr::Update(sWorldSessionMgr->GetActiveSessionCount(), diff);
+
+    ///- Seed the world thread and track the recorded map of a map replay
+    sMapReplay->OnWorldUpdate(diff);
+
+    {
+        static MetricHistogram& updateDiff = sMetricRegistry->GetHistogram("acore_world_update_diff_milliseconds", "Time between two world updates",
+            { 10, 25, 50, 100, 250, 500, 1000, 2500 });
+        static MetricGauge& onlinePlayers = sMetricRegistry->GetGauge("acore_online_players", "Players in the world");
+        static MetricGauge& activeSessions = sMetricRegistry->GetGauge("acore_sessions", "World sessions", { { "state", "active" } });
+        static MetricGauge& queuedSessions = sMetricRegistry->GetGauge("acore_sessions", "World sessions", { { "state", "queued" } });
+
+        updateDiff.Observe(diff);
+        onlinePlayers.Set(sWorldSessionMgr->GetPlayerCount());
+        activeSessions.Set(sWorldSessionMgr->GetActiveSessionCount());
+        queuedSessions.Set(sWorldSessionMgr->GetQueuedSessionCount());
+    }
 
     ///- Update the different timers
     for (int i = 0; i < WUPDATE_COUNT; ++i)
@@ -1113,24 +1220,23 @@ void World::Update(uint32 diff)
             _timers[i].SetCurrent(0);
     }
 
-    // pussywizard: our speed up and functionality
-    if (_timers[WUPDATE_5_SECS].Passed())
-    {
-        _timers[WUPDATE_5_SECS].Reset();
-
-        // moved here from HandleCharEnumOpcode
-        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_EXPIRED_BANS);
-        CharacterDatabase.Execute(stmt);
-    }
-
     ///- Update Who List Cache
-    if (_timers[WUPDATE_WHO_LIST].Passed())
+    if (_timers[WUPDATE_WHO_LIST].Passed() && !sWorldLoadGovernor.ShouldDefer(LoadSheddingWork::WhoList,
+        Milliseconds(_timers[WUPDATE_WHO_LIST].GetCurrent() - _timers[WUPDATE_WHO_LIST].GetInterval())))
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update who list"));
         _timers[WUPDATE_WHO_LIST].Reset();
         sWhoListCacheMgr->Update();
     }
 
+    ///- Save the guild event and bank logs
+    if (_timers[WUPDATE_GUILD_LOGS].Passed())
+    {
+        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Save guild logs"));
+        _timers[WUPDATE_GUILD_LOGS].Reset();
+        sGuildMgr->SaveGuildLogs();
+    }
+
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Check quest reset times"));
 
@@ -1159,13 +1265,14 @@ void World::Update(uint32 diff)
         ResetRandomBG();
     }
 
-    if (currentGameTime > _nextCalendarOldEventsDeletionTime)
+    if (currentGameTime > _nextCalendarOldEventsDeletionTime
+        && !sWorldLoadGovernor.ShouldDefer(LoadSheddingWork::CalendarCleanup, currentGameTime - _nextCalendarOldEventsDeletionTime))
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Delete old calendar events"));
         CalendarDeleteOldEvents();
     }
 
-    if (currentGameTime > _nextGuildReset)
+    if (currentGameTime > _nextGuildReset && !sWorldLoadGovernor.ShouldDefer(LoadSheddingWork::GuildReset, currentGameTime - _nextGuildReset))
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Reset guild cap"));
         ResetGuildCap();
@@ -1185,25 +1292,10 @@ void World::Update(uint32 diff)
 
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update sessions"));
+        PROFILER_ZONE("World::UpdateSessions");
         sWorldSessionMgr->UpdateSessions(diff);
     }
 
-    /// <li> Clean logs table
-    if (getIntConfig(CONFIG_LOGDB_CLEARTIME) > 0) // if not enabled, ignore the timer
-    {
-        if (_timers[WUPDATE_CLEANDB].Passed())
-        {
-            METRIC_TIMER("world_update_time", METRIC_TAG("type", "Clean logs table"));
-
-            _timers[WUPDATE_CLEANDB].Reset();
-
-            LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_DEL_OLD_LOGS);
-            stmt->SetData(0, getIntConfig(CONFIG_LOGDB_CLEARTIME));
-            stmt->SetData(1, uint32(currentGameTime.count()));
-            LoginDatabase.Execute(stmt);
-        }
-    }
-
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update LFG 0"));
         sLFGMgr->Update(diff, 0); // pussywizard: remove obsolete stuff before finding compatibility during map update
@@ -1212,7 +1304,8 @@ void World::Update(uint32 diff)
     {
         ///- Update objects when the timer has passed (maps, transport, creatures, ...)
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update maps"));
-        sMapMgr->Update(diff);
+        PROFILER_ZONE("World::UpdateMaps");
+        sMapMgr->Update(diff, [this, diff]() { UpdateAlongsideMaps(diff); });
     }
 
     if (getBoolConfig(CONFIG_AUTOBROADCAST))
@@ -1256,21 +1349,6 @@ void World::Update(uint32 diff)
         ProcessQueryCallbacks();
     }
 
-    /// <li> Update uptime table
-    if (_timers[WUPDATE_UPTIME].Passed())
-    {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update uptime"));
-
-        _timers[WUPDATE_UPTIME].Reset();
-
-        LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_UPTIME_PLAYERS);
-        stmt->SetData(0, uint32(GameTime::GetUptime().count()));
-        stmt->SetData(1, uint16(sWorldSessionMgr->GetMaxPlayerCount()));
-        stmt->SetData(2, realm.Id.Realm);
-        stmt->SetData(3, uint32(GameTime::GetStartTime().count()));
-        LoginDatabase.Execute(stmt);
-    }
-
     ///- Process Game events when necessary
     if (_timers[WUPDATE_EVENTS].Passed())
     {
@@ -1281,17 +1359,6 @@ void World::Update(uint32 diff)
         _timers[WUPDATE_EVENTS].Reset();
     }
 
-    ///- Ping to keep MySQL connections alive
-    if (_timers[WUPDATE_PINGDB].Passed())
-    {
-        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Ping MySQL"));
-        _timers[WUPDATE_PINGDB].Reset();
-        LOG_DEBUG("sql.driver", "Ping MySQL to keep connection alive");
-        CharacterDatabase.KeepAlive();
-        LoginDatabase.KeepAlive();
-        WorldDatabase.KeepAlive();
-    }
-
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update instance reset times"));
         // update the instance reset times
@@ -1309,11 +1376,78 @@ void World::Update(uint32 diff)
         sScriptMgr->OnWorldUpdate(diff);
     }
 
+    // temporaries of the sessions and of the maps updated on this thread are gone
+    Acore::FrameArena::Trim();
+
+    sWorldLoadGovernor.OnWorldUpdate(std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - updateStart), diff);
+}
+
+/// Work touching neither the maps nor their objects, run by the world thread while the map updater works
+void World::UpdateAlongsideMaps(uint32 diff)
+{
+    // pussywizard: our speed up and functionality
+    if (_timers[WUPDATE_5_SECS].Passed())
+    {
+        _timers[WUPDATE_5_SECS].Reset();
+
+        // moved here from HandleCharEnumOpcode
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_EXPIRED_BANS);
+        CharacterDatabase.Execute(stmt);
+    }
+
+    /// <li> Clean logs table
+    if (getIntConfig(CONFIG_LOGDB_CLEARTIME) > 0) // if not enabled, ignore the timer
+    {
+        if (_timers[WUPDATE_CLEANDB].Passed())
+        {
+            METRIC_TIMER("world_update_time", METRIC_TAG("type", "Clean logs table"));
+
+            _timers[WUPDATE_CLEANDB].Reset();
+
+            LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_DEL_OLD_LOGS);
+            stmt->SetData(0, getIntConfig(CONFIG_LOGDB_CLEARTIME));
+            stmt->SetData(1, uint32(GameTime::GetGameTime().count()));
+            LoginDatabase.Execute(stmt);
+        }
+    }
+
+    /// <li> Update uptime table
+    if (_timers[WUPDATE_UPTIME].Passed())
+    {
+        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update uptime"));
+
+        _timers[WUPDATE_UPTIME].Reset();
+
+        LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_UPTIME_PLAYERS);
+        stmt->SetData(0, uint32(GameTime::GetUptime().count()));
+        stmt->SetData(1, uint16(sWorldSessionMgr->GetMaxPlayerCount()));
+        stmt->SetData(2, realm.Id.Realm);
+        stmt->SetData(3, uint32(GameTime::GetStartTime().count()));
+        LoginDatabase.Execute(stmt);
+    }
+
+    ///- Ping to keep MySQL connections alive
+    if (_timers[WUPDATE_PINGDB].Passed())
+    {
+        METRIC_TIMER("world_update_time", METRIC_TAG("type", "Ping MySQL"));
+        _timers[WUPDATE_PINGDB].Reset();
+        LOG_DEBUG("sql.driver", "Ping MySQL to keep connection alive");
+        CharacterDatabase.KeepAlive();
+        LoginDatabase.KeepAlive();
+        WorldDatabase.KeepAlive();
+    }
+
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update metrics"));
         // Stats logger update
         sMetric->Update();
         METRIC_VALUE("update_time_diff", diff);
+        Spell::LogObjectPoolMetrics();
+        sScriptMgr->LogHookMetrics();
+        sConditionMgr->LogEvaluationMetrics();
+        LogBufferPoolMetrics();
+        LogAllocatorMetrics(diff);
+        WorldSession::LogOpcodeMetrics();
     }
 }
 
@@ -1802,6 +1936,7 @@ void World::UpdateAreaDependentAuras()
 
 void World::ProcessQueryCallbacks()
 {
+    PROFILER_ZONE("World::ProcessQueryCallbacks");
     _queryProcessor.ProcessReadyCallbacks();
 }
 
@@ -66,6 +66,7 @@ enum WorldTimers
     WUPDATE_PINGDB,
     WUPDATE_5_SECS,
     WUPDATE_WHO_LIST,
+    WUPDATE_GUILD_LOGS,
     WUPDATE_COUNT
 };
 
@@ -241,6 +242,7 @@ public:
 
 protected:
     void _UpdateGameTime();
+    void UpdateAlongsideMaps(uint32 diff);
     // callback for UpdateRealmCharacters
     void _UpdateRealmCharCount(PreparedQueryResult resultCharCount,uint32 accountId);
 
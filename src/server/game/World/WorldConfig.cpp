@@ -145,6 +145,7 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<bool>(CONFIG_DURABILITY_LOSS_IN_PVP, "DurabilityLoss.InPvP", false);
 
     SetConfigValue<uint32>(CONFIG_COMPRESSION, "Compression", 1, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value > 0 && value < 10; }, "> 0 && < 10");
+    SetConfigValue<bool>(CONFIG_COMPRESSION_IN_SENDER_THREAD, "Compression.InSenderThread", false);
 
     SetConfigValue<bool>(CONFIG_ADDON_CHANNEL, "AddonChannel", true);
     SetConfigValue<bool>(CONFIG_CLEAN_CHARACTER_DB, "CleanCharacterDB", false);
@@ -164,6 +165,8 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<uint32>(CONFIG_INTERVAL_DISCONNECT_TOLERANCE, "DisconnectToleranceInterval", 0);
     SetConfigValue<bool>(CONFIG_STATS_SAVE_ONLY_ON_LOGOUT, "PlayerSave.Stats.SaveOnlyOnLogout", true);
     SetConfigValue<bool>(CONFIG_VALIDATE_SKILL_LEARNED_BY_SPELLS, "ValidateSkillLearnedBySpells", true);
+    SetConfigValue<uint32>(CONFIG_SPELL_INFO_SNAPSHOT, "SpellInfo.Snapshot", 0, ConfigValueCache::Reloadable::No);
+    SetConfigValue<std::string>(CONFIG_SPELL_INFO_SNAPSHOT_FILE, "SpellInfo.Snapshot.File", "spellinfo.snapshot", ConfigValueCache::Reloadable::No);
 
     SetConfigValue<uint32>(CONFIG_MIN_LEVEL_STAT_SAVE, "PlayerSave.Stats.MinLevel", 0, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value < MAX_LEVEL; }, "< MAX_LEVEL");
 
@@ -286,6 +289,11 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<float>(CONFIG_CHANCE_OF_GM_SURVEY, "GM.TicketSystem.ChanceOfGMSurvey", 50.0f);
 
     SetConfigValue<uint32>(CONFIG_GROUP_VISIBILITY, "Visibility.GroupMode", 1);
+    SetConfigValue<uint32>(CONFIG_VISIBILITY_INCREMENTAL_FULL_INTERVAL, "Visibility.Incremental.FullUpdateInterval", 0);
+    SetConfigValue<uint32>(CONFIG_CROWD_INTEREST_MIN_PLAYERS, "Visibility.CrowdInterest.MinPlayers", 0);
+    SetConfigValue<float>(CONFIG_CROWD_INTEREST_NEAR_DISTANCE, "Visibility.CrowdInterest.NearDistance", 30.0f);
+    SetConfigValue<uint32>(CONFIG_CROWD_INTEREST_HEARTBEAT_DIVISOR, "Visibility.CrowdInterest.HeartbeatDivisor", 4, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value > 0; }, "> 0");
+    SetConfigValue<uint32>(CONFIG_CROWD_INTEREST_SESSION_BYTES, "Visibility.CrowdInterest.SessionBytesPerSecond", 0);
 
     SetConfigValue<bool>(CONFIG_OBJECT_SPARKLES, "Visibility.ObjectSparkles", true);
 
@@ -346,6 +354,7 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<uint32>(CONFIG_CHAT_TIME_MUTE_FIRST_LOGIN, "Chat.MuteTimeFirstLogin", 120);
 
     SetConfigValue<uint32>(CONFIG_EVENT_ANNOUNCE, "Event.Announce", 0);
+    SetConfigValue<uint32>(CONFIG_EVENT_SPAWNS_PER_MAP_UPDATE, "Event.SpawnsPerMapUpdate", 200);
 
     SetConfigValue<float>(CONFIG_CREATURE_LEASH_RADIUS, "CreatureLeashRadius", 30.0f);
     SetConfigValue<float>(CONFIG_CREATURE_FAMILY_FLEE_ASSISTANCE_RADIUS, "CreatureFamilyFleeAssistanceRadius", 30.0f);
@@ -388,6 +397,7 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<bool>(CONFIG_CHAT_FAKE_MESSAGE_PREVENTING, "ChatFakeMessagePreventing", true);
     SetConfigValue<uint32>(CONFIG_CHAT_STRICT_LINK_CHECKING_SEVERITY, "ChatStrictLinkChecking.Severity", 0);
     SetConfigValue<uint32>(CONFIG_CHAT_STRICT_LINK_CHECKING_KICK, "ChatStrictLinkChecking.Kick", 0);
+    SetConfigValue<uint32>(CONFIG_CHAT_STRICT_LINK_CHECKING_CACHE_SIZE, "ChatStrictLinkChecking.CacheSize", 1024, ConfigValueCache::Reloadable::No);
 
     SetConfigValue<uint32>(CONFIG_CORPSE_DECAY_NORMAL, "Corpse.Decay.NORMAL", 60);
     SetConfigValue<uint32>(CONFIG_CORPSE_DECAY_RARE, "Corpse.Decay.RARE", 300);
@@ -473,6 +483,7 @@ void WorldConfig::BuildConfigCache()
 
     SetConfigValue<uint32>(CONFIG_GUILD_EVENT_LOG_COUNT, "Guild.EventLogRecordsCount", GUILD_EVENTLOG_MAX_RECORDS, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value <= GUILD_EVENTLOG_MAX_RECORDS; }, "<= GUILD_EVENTLOG_MAX_RECORDS");
     SetConfigValue<uint32>(CONFIG_GUILD_BANK_EVENT_LOG_COUNT, "Guild.BankEventLogRecordsCount", GUILD_BANKLOG_MAX_RECORDS, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value <= GUILD_BANKLOG_MAX_RECORDS; }, "<= GUILD_BANKLOG_MAX_RECORDS");
+    SetConfigValue<uint32>(CONFIG_GUILD_LOG_SAVE_INTERVAL, "Guild.LogSaveInterval", 10, ConfigValueCache::Reloadable::Yes);
 
     ///- Load the CharDelete related config options
     SetConfigValue<uint32>(CONFIG_CHARDELETE_METHOD, "CharDelete.Method", 0);
@@ -499,6 +510,7 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<bool>(CONFIG_LEAVE_GROUP_ON_LOGOUT, "LeaveGroupOnLogout.Enabled", false);
 
     SetConfigValue<uint32>(CONFIG_RANDOM_ROLL_MAXIMUM, "Group.RandomRollMaximum", 1000000);
+    SetConfigValue<uint32>(CONFIG_GROUP_MEMBER_STATS_INTERVAL, "Group.MemberStatsInterval", 400);
 
     SetConfigValue<bool>(CONFIG_QUEST_POI_ENABLED, "QuestPOI.Enabled", true);
 
@@ -526,6 +538,11 @@ void WorldConfig::BuildConfigCache()
 
     SetConfigValue<bool>(CONFIG_VMAP_BLIZZLIKE_PVP_LOS, "vmap.BlizzlikePvPLOS", true);
     SetConfigValue<bool>(CONFIG_VMAP_BLIZZLIKE_LOS_OPEN_WORLD, "vmap.BlizzlikeLOSInOpenWorld", true);
+    SetConfigValue<uint32>(CONFIG_VMAP_QUERY_CACHE_SIZE, "vmap.QueryCache.Size", 2048, ConfigValueCache::Reloadable::No);
+    SetConfigValue<float>(CONFIG_VMAP_QUERY_CACHE_PRECISION, "vmap.QueryCache.Precision", 0.1f, ConfigValueCache::Reloadable::No, [](float const& value) { return value > 0.0f; }, "> 0");
+    SetConfigValue<uint32>(CONFIG_MMAP_PATH_CACHE_SIZE, "MoveMaps.PathCache.Size", 512, ConfigValueCache::Reloadable::No);
+    SetConfigValue<float>(CONFIG_MMAP_PATH_CACHE_PRECISION, "MoveMaps.PathCache.Precision", 0.5f, ConfigValueCache::Reloadable::No, [](float const& value) { return value > 0.0f; }, "> 0");
+    SetConfigValue<uint32>(CONFIG_CHASE_FLOW_FIELD_MIN_CHASERS, "MoveMaps.ChaseFlowField.MinChasers", 0, ConfigValueCache::Reloadable::No);
 
     SetConfigValue<bool>(CONFIG_START_CUSTOM_SPELLS, "PlayerStart.CustomSpells", false);
     SetConfigValue<uint32>(CONFIG_HONOR_AFTER_DUEL, "HonorPointsAfterDuel", 0);
@@ -543,6 +560,17 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<bool>(CONFIG_SHOW_MUTE_IN_WORLD, "ShowMuteInWorld", false);
     SetConfigValue<bool>(CONFIG_SHOW_BAN_IN_WORLD, "ShowBanInWorld", false);
     SetConfigValue<uint32>(CONFIG_NUMTHREADS, "MapUpdate.Threads", 1);
+    SetConfigValue<uint32>(CONFIG_MAP_REGION_UPDATE_THREADS, "MapUpdate.Regions.Threads", 0, ConfigValueCache::Reloadable::No);
+    SetConfigValue<uint32>(CONFIG_MAP_REGION_UPDATE_MIN_OBJECTS, "MapUpdate.Regions.MinObjects", 2000);
+    SetConfigValue<uint32>(CONFIG_MAP_SESSION_PREPARE_MIN_PLAYERS, "MapUpdate.Sessions.MinPlayers", 0);
+    SetConfigValue<uint32>(CONFIG_MAP_THREAT_PREPARE_MIN_CREATURES, "MapUpdate.Threat.MinCreatures", 0);
+    SetConfigValue<uint32>(CONFIG_MAP_GRID_LOAD_PREPARE_MIN_CREATURES, "MapUpdate.GridLoad.MinCreatures", 0);
+    SetConfigValue<uint32>(CONFIG_MAP_MOVEMENT_RELAY_MIN_PLAYERS, "MapUpdate.MovementRelay.MinPlayers", 0);
+    SetConfigValue<bool>(CONFIG_MAP_CREATURE_UPDATE_SLEEP, "MapUpdate.CreatureSleep", true);
+    SetConfigValue<float>(CONFIG_MAP_CREATURE_AI_THROTTLE_RANGE, "MapUpdate.CreatureAIThrottle.Range", 60.0f);
+    SetConfigValue<uint32>(CONFIG_MAP_CREATURE_AI_THROTTLE_CONTINENT, "MapUpdate.CreatureAIThrottle.Continent", 0);
+    SetConfigValue<uint32>(CONFIG_MAP_CREATURE_AI_THROTTLE_INSTANCE, "MapUpdate.CreatureAIThrottle.Instance", 0);
+    SetConfigValue<uint32>(CONFIG_MAP_CREATURE_AI_THROTTLE_BATTLEGROUND, "MapUpdate.CreatureAIThrottle.Battleground", 0);
     SetConfigValue<uint32>(CONFIG_MAX_RESULTS_LOOKUP_COMMANDS, "Command.LookupMaxResults", 0);
 
     // Warden
@@ -554,6 +582,7 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<uint32>(CONFIG_WARDEN_CLIENT_CHECK_HOLDOFF, "Warden.ClientCheckHoldOff", 30);
     SetConfigValue<uint32>(CONFIG_WARDEN_CLIENT_FAIL_ACTION, "Warden.ClientCheckFailAction", 0);
     SetConfigValue<uint32>(CONFIG_WARDEN_CLIENT_RESPONSE_DELAY, "Warden.ClientResponseDelay", 600);
+    SetConfigValue<uint32>(CONFIG_WARDEN_WORKER_THREADS, "Warden.WorkerThreads", 1);
 
     // Dungeon finder
     SetConfigValue<uint32>(CONFIG_LFG_OPTIONSMASK, "DungeonFinder.OptionsMask", 5);
@@ -602,16 +631,33 @@ void WorldConfig::BuildConfigCache()
 
     SetConfigValue<bool>(CONFIG_CALCULATE_CREATURE_ZONE_AREA_DATA, "Calculate.Creature.Zone.Area.Data", false);
     SetConfigValue<bool>(CONFIG_CALCULATE_GAMEOBJECT_ZONE_AREA_DATA, "Calculate.Gameoject.Zone.Area.Data", false);
+    SetConfigValue<bool>(CONFIG_LOADER_CACHE, "LoaderCache.Enable", false);
+    SetConfigValue<uint32>(CONFIG_STARTUP_LOADER_THREADS, "StartupLoader.Threads", 1, ConfigValueCache::Reloadable::No, [](uint32 const& value) { return value > 0 && value <= 32; }, "> 0 && <= 32");
 
     // Player can join LFG anywhere
     SetConfigValue<bool>(CONFIG_LFG_LOCATION_ALL, "LFG.Location.All", false);
 
     // Prevent players AFK from being logged out
     SetConfigValue<uint32>(CONFIG_AFK_PREVENT_LOGOUT, "PreventAFKLogout", 0);
+    SetConfigValue<uint32>(CONFIG_SESSION_UPDATE_CPU_BUDGET, "SessionUpdate.CpuBudget", 0);
+    SetConfigValue<uint32>(CONFIG_SESSION_UPDATE_PARALLEL_MIN_SESSIONS, "SessionUpdate.Parallel.MinSessions", 0);
+
+    // Defer non urgent work while the world updates take longer than the target
+    SetConfigValue<uint32>(CONFIG_LOAD_SHEDDING_TARGET_UPDATE_TIME, "LoadShedding.TargetUpdateTime", 0);
+    SetConfigValue<uint32>(CONFIG_LOAD_SHEDDING_MAX_DEFERRAL, "LoadShedding.MaxDeferral", 60000);
 
     // Preload all grids of all non-instanced maps
     SetConfigValue<bool>(CONFIG_PRELOAD_ALL_NON_INSTANCED_MAP_GRIDS, "PreloadAllNonInstancedMapGrids", false);
 
+    // Read the terrain of grids players are about to enter in the background
+    SetConfigValue<uint32>(CONFIG_GRID_PREFETCH_LOOKAHEAD, "GridPrefetch.LookAhead", 0, ConfigValueCache::Reloadable::No);
+
+    // Terrain of grids no map uses any more kept in memory
+    SetConfigValue<uint32>(CONFIG_GRID_TERRAIN_CACHE_SIZE, "GridTerrain.CacheSize", 64);
+
+    // Objects of unloaded grids deleted by a background thread per world update
+    SetConfigValue<uint32>(CONFIG_GRID_UNLOAD_RECLAIM_PER_TICK, "GridUnload.ReclaimPerTick", 0, ConfigValueCache::Reloadable::No);
+
     // ICC buff override
     SetConfigValue<uint32>(CONFIG_ICC_BUFF_HORDE, "ICC.Buff.Horde", 73822);
     SetConfigValue<uint32>(CONFIG_ICC_BUFF_ALLIANCE, "ICC.Buff.Alliance", 73828);
@@ -659,6 +705,7 @@ void WorldConfig::BuildConfigCache()
 
     // AH Worker threads
     SetConfigValue<uint32>(CONFIG_AUCTIONHOUSE_WORKERTHREADS, "AuctionHouse.WorkerThreads", 1, ConfigValueCache::Reloadable::No, [](uint32 const& value) { return value >= 1; }, ">= 1");
+    SetConfigValue<uint32>(CONFIG_AUCTIONHOUSE_EXPIRED_PER_UPDATE, "AuctionHouse.ExpiredAuctionsPerUpdate", 100, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value >= 1; }, ">= 1");
 
     // SpellQueue
     SetConfigValue<bool>(CONFIG_SPELL_QUEUE_ENABLED, "SpellQueue.Enabled", true);
@@ -112,6 +112,8 @@ enum ServerConfigs
     CONFIG_IP_BASED_ACTION_LOGGING,
     CONFIG_CALCULATE_CREATURE_ZONE_AREA_DATA,
     CONFIG_CALCULATE_GAMEOBJECT_ZONE_AREA_DATA,
+    CONFIG_LOADER_CACHE,
+    CONFIG_STARTUP_LOADER_THREADS,
     CONFIG_CHECK_GOBJECT_LOS,
     CONFIG_CLOSE_IDLE_CONNECTIONS,
     CONFIG_LFG_LOCATION_ALL,
@@ -132,9 +134,15 @@ enum ServerConfigs
     CONFIG_MISS_CHANCE_MULTIPLIER_ONLY_FOR_PLAYERS,
     CONFIG_LEAVE_GROUP_ON_LOGOUT,
     CONFIG_RANDOM_ROLL_MAXIMUM,
+    CONFIG_GROUP_MEMBER_STATS_INTERVAL,
     CONFIG_QUEST_POI_ENABLED,
     CONFIG_VMAP_BLIZZLIKE_PVP_LOS,
     CONFIG_VMAP_BLIZZLIKE_LOS_OPEN_WORLD,
+    CONFIG_VMAP_QUERY_CACHE_SIZE,
+    CONFIG_VMAP_QUERY_CACHE_PRECISION,
+    CONFIG_MMAP_PATH_CACHE_SIZE,
+    CONFIG_MMAP_PATH_CACHE_PRECISION,
+    CONFIG_CHASE_FLOW_FIELD_MIN_CHASERS,
     CONFIG_OBJECT_SPARKLES,
     CONFIG_LOW_LEVEL_REGEN_BOOST,
     CONFIG_OBJECT_QUEST_MARKERS,
@@ -162,6 +170,7 @@ enum ServerConfigs
     CONFIG_RESPAWN_DYNAMICRATE_GAMEOBJECT,
     CONFIG_RESPAWN_DYNAMICRATE_CREATURE,
     CONFIG_COMPRESSION,
+    CONFIG_COMPRESSION_IN_SENDER_THREAD,
     CONFIG_INTERVAL_MAPUPDATE,
     CONFIG_INTERVAL_CHANGEWEATHER,
     CONFIG_INTERVAL_DISCONNECT_TOLERANCE,
@@ -213,6 +222,11 @@ enum ServerConfigs
     CONFIG_GM_LEVEL_IN_WHO_LIST,
     CONFIG_START_GM_LEVEL,
     CONFIG_GROUP_VISIBILITY,
+    CONFIG_VISIBILITY_INCREMENTAL_FULL_INTERVAL,
+    CONFIG_CROWD_INTEREST_MIN_PLAYERS,
+    CONFIG_CROWD_INTEREST_NEAR_DISTANCE,
+    CONFIG_CROWD_INTEREST_HEARTBEAT_DIVISOR,
+    CONFIG_CROWD_INTEREST_SESSION_BYTES,
     CONFIG_MAIL_DELIVERY_DELAY,
     CONFIG_UPTIME_UPDATE,
     CONFIG_SKILL_CHANCE_ORANGE,
@@ -233,6 +247,7 @@ enum ServerConfigs
     CONFIG_CHATFLOOD_ADDON_MESSAGE_DELAY,
     CONFIG_CHATFLOOD_MUTE_TIME,
     CONFIG_EVENT_ANNOUNCE,
+    CONFIG_EVENT_SPAWNS_PER_MAP_UPDATE,
     CONFIG_CREATURE_FAMILY_ASSISTANCE_DELAY,
     CONFIG_CREATURE_FAMILY_ASSISTANCE_PERIOD,
     CONFIG_CREATURE_FAMILY_FLEE_DELAY,
@@ -241,6 +256,7 @@ enum ServerConfigs
     CONFIG_QUEST_HIGH_LEVEL_HIDE_DIFF,
     CONFIG_CHAT_STRICT_LINK_CHECKING_SEVERITY,
     CONFIG_CHAT_STRICT_LINK_CHECKING_KICK,
+    CONFIG_CHAT_STRICT_LINK_CHECKING_CACHE_SIZE,
     CONFIG_CHAT_CHANNEL_LEVEL_REQ,
     CONFIG_CHAT_WHISPER_LEVEL_REQ,
     CONFIG_CHAT_SAY_LEVEL_REQ,
@@ -297,6 +313,20 @@ enum ServerConfigs
     CONFIG_PVP_TOKEN_COUNT,
     CONFIG_ENABLE_SINFO_LOGIN,
     CONFIG_NUMTHREADS,
+    CONFIG_MAP_REGION_UPDATE_THREADS,
+    CONFIG_MAP_REGION_UPDATE_MIN_OBJECTS,
+    CONFIG_GRID_PREFETCH_LOOKAHEAD,
+    CONFIG_GRID_TERRAIN_CACHE_SIZE,
+    CONFIG_GRID_UNLOAD_RECLAIM_PER_TICK,
+    CONFIG_MAP_SESSION_PREPARE_MIN_PLAYERS,
+    CONFIG_MAP_THREAT_PREPARE_MIN_CREATURES,
+    CONFIG_MAP_GRID_LOAD_PREPARE_MIN_CREATURES,
+    CONFIG_MAP_MOVEMENT_RELAY_MIN_PLAYERS,
+    CONFIG_MAP_CREATURE_UPDATE_SLEEP,
+    CONFIG_MAP_CREATURE_AI_THROTTLE_RANGE,
+    CONFIG_MAP_CREATURE_AI_THROTTLE_CONTINENT,
+    CONFIG_MAP_CREATURE_AI_THROTTLE_INSTANCE,
+    CONFIG_MAP_CREATURE_AI_THROTTLE_BATTLEGROUND,
     CONFIG_LOGDB_CLEARINTERVAL,
     CONFIG_LOGDB_CLEARTIME,
     CONFIG_TELEPORT_TIMEOUT_NEAR,
@@ -305,6 +335,7 @@ enum ServerConfigs
     CONFIG_CLIENTCACHE_VERSION,
     CONFIG_GUILD_EVENT_LOG_COUNT,
     CONFIG_GUILD_BANK_EVENT_LOG_COUNT,
+    CONFIG_GUILD_LOG_SAVE_INTERVAL,
     CONFIG_MIN_LEVEL_STAT_SAVE,
     CONFIG_RANDOM_BG_RESET_HOUR,
     CONFIG_CALENDAR_DELETE_OLD_EVENTS_HOUR,
@@ -336,10 +367,15 @@ enum ServerConfigs
     CONFIG_WARDEN_NUM_MEM_CHECKS,
     CONFIG_WARDEN_NUM_LUA_CHECKS,
     CONFIG_WARDEN_NUM_OTHER_CHECKS,
+    CONFIG_WARDEN_WORKER_THREADS,
     CONFIG_BIRTHDAY_TIME,
     CONFIG_SOCKET_TIMEOUTTIME_ACTIVE,
     CONFIG_INSTANT_TAXI,
     CONFIG_AFK_PREVENT_LOGOUT,
+    CONFIG_SESSION_UPDATE_CPU_BUDGET,
+    CONFIG_SESSION_UPDATE_PARALLEL_MIN_SESSIONS,
+    CONFIG_LOAD_SHEDDING_TARGET_UPDATE_TIME,
+    CONFIG_LOAD_SHEDDING_MAX_DEFERRAL,
     CONFIG_ICC_BUFF_HORDE,
     CONFIG_ICC_BUFF_ALLIANCE,
     CONFIG_ITEMDELETE_QUALITY,
@@ -380,6 +416,7 @@ enum ServerConfigs
     CONFIG_WATER_BREATH_TIMER,
     CONFIG_DAILY_RBG_MIN_LEVEL_AP_REWARD,
     CONFIG_AUCTIONHOUSE_WORKERTHREADS,
+    CONFIG_AUCTIONHOUSE_EXPIRED_PER_UPDATE,
     CONFIG_SPELL_QUEUE_WINDOW,
     CONFIG_SUNSREACH_COUNTER_MAX,
     CONFIG_SCOURGEINVASION_COUNTER_FIRST,
@@ -486,6 +523,8 @@ enum ServerConfigs
     RATE_MISS_CHANCE_MULTIPLIER_TARGET_PLAYER,
     CONFIG_NEW_CHAR_STRING,
     CONFIG_VALIDATE_SKILL_LEARNED_BY_SPELLS,
+    CONFIG_SPELL_INFO_SNAPSHOT,
+    CONFIG_SPELL_INFO_SNAPSHOT_FILE,
 
     MAX_NUM_SERVER_CONFIGS
 };
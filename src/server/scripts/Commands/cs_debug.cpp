@@ -27,11 +27,14 @@
 #include "Log.h"
 #include "M2Stores.h"
 #include "MapMgr.h"
+#include "MapReplay.h"
 #include "ObjectMgr.h"
 #include "PoolMgr.h"
+#include "Profiler.h"
 #include "ScriptMgr.h"
 #include "Transport.h"
 #include "Warden.h"
+#include "WorldSocket.h"
 #include <fstream>
 #include <set>
 
@@ -97,8 +100,12 @@ public:
             { "moveflags",      HandleDebugMoveflagsCommand,           SEC_ADMINISTRATOR, Console::No },
             { "unitstate",      HandleDebugUnitStateCommand,           SEC_ADMINISTRATOR, Console::No },
             { "objectcount",    HandleDebugObjectCountCommand,         SEC_ADMINISTRATOR, Console::Yes},
+            { "scripts",        HandleDebugScriptsCommand,             SEC_ADMINISTRATOR, Console::Yes},
             { "dummy",          HandleDebugDummyCommand,               SEC_ADMINISTRATOR, Console::No },
             { "mapdata",        HandleDebugMapDataCommand,             SEC_ADMINISTRATOR, Console::No },
+            { "network",        HandleDebugNetworkCommand,             SEC_ADMINISTRATOR, Console::Yes},
+            { "profile",        HandleDebugProfileCommand,             SEC_ADMINISTRATOR, Console::Yes},
+            { "replay",         HandleDebugReplayCommand,              SEC_ADMINISTRATOR, Console::Yes},
             { "boundary",       HandleDebugBoundaryCommand,            SEC_ADMINISTRATOR, Console::No },
             { "visibilitydata", HandleDebugVisibilityDataCommand,      SEC_ADMINISTRATOR, Console::No },
             { "zonestats",      HandleDebugZoneStatsCommand,           SEC_MODERATOR,     Console::Yes}
@@ -1311,6 +1318,53 @@ public:
         return true;
     }
 
+    static bool HandleDebugScriptsCommand(ChatHandler* handler, Optional<Variant<bool, EXACT_SEQUENCE("reset")>> operationArg)
+    {
+        if (operationArg)
+        {
+            if (operationArg->holds_alternative<bool>())
+            {
+                ScriptMgr::SetHookProfilingEnabled(operationArg->get<bool>());
+                handler->PSendSysMessage("Script hook profiling {}.", operationArg->get<bool>() ? "enabled" : "disabled");
+            }
+            else
+            {
+                sScriptMgr->ResetHookProfiles();
+                handler->SendSysMessage("Script hook profiles reset.");
+            }
+
+            return true;
+        }
+
+        std::vector<ScriptMgr::HookProfileInfo> profiles = sScriptMgr->GetHookProfiles();
+        if (profiles.empty())
+        {
+            handler->SendSysMessage("No script hook was profiled yet, use .debug scripts on to start profiling.");
+            return true;
+        }
+
+        std::sort(profiles.begin(), profiles.end(), [](ScriptMgr::HookProfileInfo const& left, ScriptMgr::HookProfileInfo const& right)
+        {
+            return left.Profile->Time.load(std::memory_order_relaxed) > right.Profile->Time.load(std::memory_order_relaxed);
+        });
+
+        static std::size_t const MaxShownProfiles = 20;
+
+        handler->PSendSysMessage("Script hooks by time spent ({} of {}, profiling {}):", std::min(profiles.size(), MaxShownProfiles), profiles.size(),
+            ScriptMgr::IsHookProfilingEnabled() ? "on" : "off");
+
+        for (std::size_t i = 0; i < profiles.size() && i < MaxShownProfiles; ++i)
+        {
+            ScriptMgr::HookProfileInfo const& info = profiles[i];
+            uint64 const calls = info.Profile->Calls.load(std::memory_order_relaxed);
+            double const time = double(info.Profile->Time.load(std::memory_order_relaxed)) / 1000000.0;
+            handler->PSendSysMessage("{} {} hook {}: {} calls, {:.3f} ms, {:.3f} us per call", info.Type, info.Script->GetName(), info.Hook,
+                calls, time, calls ? time * 1000.0 / double(calls) : 0.0);
+        }
+
+        return true;
+    }
+
     class CreatureCountWorker
     {
     public:
@@ -1349,11 +1403,12 @@ public:
 
     static void HandleDebugObjectCountMap(ChatHandler* handler, Map* map)
     {
-        handler->PSendSysMessage("Map Id: {} Name: '{}' Instance Id: {} Creatures: {} GameObjects: {} Update Objects: {}",
+        handler->PSendSysMessage("Map Id: {} Name: '{}' Instance Id: {} Creatures: {} GameObjects: {} Update Objects: {} Sleeping Objects: {}",
                 map->GetId(), map->GetMapName(), map->GetInstanceId(),
                 uint64(map->GetObjectsStore().Size<Creature>()),
                 uint64(map->GetObjectsStore().Size<GameObject>()),
-                uint64(map->GetUpdatableObjectsCount()));
+                uint64(map->GetUpdatableObjectsCount()),
+                map->GetSleptObjectsCount());
 
         CreatureCountWorker worker;
         TypeContainerVisitor<CreatureCountWorker, MapStoredObjectTypesContainer> visitor(worker);
@@ -1460,6 +1515,120 @@ public:
         handler->PSendSysMessage("Player count in zone {} ({}): {}.", zoneId, (zoneEntry ? zoneEntry->area_name[LOCALE_enUS] : "<unknown>"), player->GetMap()->GetPlayerCountInZone(zoneId));
         return true;
     }
+
+    // Records the update zones of all threads for a few seconds into a Chrome trace file in the logs directory,
+    // 0 ends the running capture early
+    static bool HandleDebugProfileCommand(ChatHandler* handler, uint32 seconds)
+    {
+        if (!seconds)
+        {
+            if (!sProfiler->Stop())
+            {
+                handler->SendErrorMessage("No profiler capture is running.");
+                return false;
+            }
+
+            handler->PSendSysMessage("Profiler capture ended.");
+            return true;
+        }
+
+        if (seconds > 60)
+        {
+            handler->SendErrorMessage("The capture can last at most 60 seconds.");
+            return false;
+        }
+
+        std::string fileName = Acore::StringFormat("{}profile_{}.json", sLog->GetLogsDir(), Acore::Time::TimeToTimestampStr(GetEpochTime(), "%Y-%m-%d_%H-%M-%S"));
+        if (!sProfiler->Start(Seconds(seconds), fileName))
+        {
+            handler->SendErrorMessage("A profiler capture is already running.");
+            return false;
+        }
+
+        handler->PSendSysMessage("Profiling the next {} seconds into {}.", seconds, fileName);
+        return true;
+    }
+
+    // Records the client packets and random seeds of a non instanced map, the map of the player by default,
+    // for a few minutes into the logs directory. worldserver --replay <file> replays them offline; 0 ends the running recording early
+    static bool HandleDebugReplayCommand(ChatHandler* handler, uint32 minutes, Optional<uint32> mapId)
+    {
+        if (!minutes)
+        {
+            if (!sMapReplay->StopRecording())
+            {
+                handler->SendErrorMessage("No map recording is running.");
+                return false;
+            }
+
+            handler->PSendSysMessage("Map recording ended.");
+            return true;
+        }
+
+        if (minutes > 60)
+        {
+            handler->SendErrorMessage("The recording can last at most 60 minutes.");
+            return false;
+        }
+
+        if (!mapId)
+        {
+            Player* player = handler->GetSession() ? handler->GetSession()->GetPlayer() : nullptr;
+            if (!player)
+            {
+                handler->SendErrorMessage("Which map should be recorded?");
+                return false;
+            }
+
+            mapId = player->GetMapId();
+        }
+
+        std::string fileName = Acore::StringFormat("{}replay_{}_{}.bin", sLog->GetLogsDir(), *mapId, Acore::Time::TimeToTimestampStr(GetEpochTime(), "%Y-%m-%d_%H-%M-%S"));
+        if (!sMapReplay->StartRecording(*mapId, Minutes(minutes), fileName))
+        {
+            handler->SendErrorMessage("Map {} can't be recorded, it is instanced or a recording is already running.", *mapId);
+            return false;
+        }
+
+        handler->PSendSysMessage("Recording map {} for the next {} minutes into {}.", *mapId, minutes, fileName);
+        return true;
+    }
+
+    static bool HandleDebugNetworkCommand(ChatHandler* handler, Optional<PlayerIdentifier> playerTarget)
+    {
+        if (!playerTarget)
+            playerTarget = PlayerIdentifier::FromTargetOrSelf(handler);
+
+        Player* player = playerTarget ? playerTarget->GetConnectedPlayer() : nullptr;
+        if (!player)
+        {
+            handler->SendErrorMessage(LANG_PLAYER_NOT_FOUND);
+            return false;
+        }
+
+        std::shared_ptr<WorldSocket> socket = player->GetSession()->GetSocket();
+        if (!socket)
+        {
+            handler->PSendSysMessage("{} has no connection.", player->GetName());
+            return true;
+        }
+
+        SocketStats const& stats = socket->GetStats();
+        uint64 const writes = stats.Writes.load(std::memory_order_relaxed);
+        uint64 const compressionInput = stats.CompressionInputBytes.load(std::memory_order_relaxed);
+        uint64 const compressionOutput = stats.CompressionOutputBytes.load(std::memory_order_relaxed);
+        std::array<uint64, SocketStats::QUEUE_TIME_BUCKETS> const queueTimes = stats.GetQueueTimes();
+
+        handler->PSendSysMessage("Connection of {} ({}): latency {} ms, {} bytes queued.", player->GetName(), player->GetSession()->GetRemoteAddress(),
+            player->GetSession()->GetLatency(), stats.QueuedBytes.load(std::memory_order_relaxed));
+        handler->PSendSysMessage("Sent {} bytes in {} writes, {} partial.", stats.SentBytes.load(std::memory_order_relaxed), writes,
+            stats.PartialWrites.load(std::memory_order_relaxed));
+        handler->PSendSysMessage("Time in write queue: 50% under {} us, 99% under {} us.", SocketStats::GetPercentile(queueTimes, 50).count(),
+            SocketStats::GetPercentile(queueTimes, 99).count());
+        handler->PSendSysMessage("Compressed {} bytes into {} ({:.1f}%).", compressionInput, compressionOutput,
+            compressionInput ? double(compressionOutput) * 100.0 / double(compressionInput) : 0.0);
+        return true;
+    }
 };
 
 void AddSC_debug_commandscript()
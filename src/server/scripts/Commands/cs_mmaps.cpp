@@ -255,6 +255,13 @@ public:
         MMAP::MMapMgr* manager = MMAP::MMapFactory::createOrGetMMapMgr();
         handler->PSendSysMessage(" {} maps loaded with {} tiles overall", manager->getLoadedMapsCount(), manager->getLoadedTilesCount());
 
+        MMAP::MMapMgr::TileLoadStats const loadStats = manager->GetTileLoadStats();
+        if (loadStats.Loads)
+        {
+            handler->PSendSysMessage(" {} tile loads ({} compressed), {} us average, {} KB read for {} KB of navmesh data",
+                loadStats.Loads, loadStats.CompressedLoads, loadStats.LoadTimeUs / loadStats.Loads, loadStats.FileBytes / 1024, loadStats.DataBytes / 1024);
+        }
+
         dtNavMesh const* navmesh = manager->GetNavMesh(handler->GetSession()->GetPlayer()->GetMapId());
         if (!navmesh)
         {
@@ -25,6 +25,7 @@
 #include "CreatureTextMgr.h"
 #include "DisableMgr.h"
 #include "GameGraveyard.h"
+#include "Hyperlinks.h"
 #include "ItemEnchantmentMgr.h"
 #include "LFGMgr.h"
 #include "Language.h"
@@ -509,6 +510,7 @@ public:
             sObjectMgr->CheckCreatureTemplate(cInfo);
         }
 
+        sObjectMgr->ClearQueryResponses(QUERY_RESPONSE_CREATURE);
         handler->SendGlobalGMSysMessage("Creature template reloaded.");
         return true;
     }
@@ -594,6 +596,7 @@ public:
     {
         LOG_INFO("server.loading", "Reloading Quest Templates...");
         sObjectMgr->LoadQuests();
+        Acore::Hyperlinks::ClearLinkCache();
         handler->SendGlobalGMSysMessage("DB table `quest_template` (quest definitions) reloaded.");
 
         /// dependent also from `gameobject` but this table not reloaded anyway
@@ -1093,6 +1096,7 @@ public:
         sDisableMgr->LoadDisables();
         LOG_INFO("server.loading", "Checking quest disables...");
         sDisableMgr->CheckQuestDisables();
+        sObjectMgr->InvalidateQuestGiverStatuses();
         handler->SendGlobalGMSysMessage("DB table `disables` reloaded.");
         return true;
     }
@@ -1149,6 +1153,7 @@ public:
     {
         LOG_INFO("server.loading", "Reloading Item Template Locale ... ");
         sObjectMgr->LoadItemLocales();
+        Acore::Hyperlinks::ClearLinkCache();
         handler->SendGlobalGMSysMessage("DB table `item_template_locale` reloaded.");
         return true;
     }
@@ -1190,6 +1195,7 @@ public:
     {
         LOG_INFO("server.loading", "Reloading Locales Quest ... ");
         sObjectMgr->LoadQuestLocales();
+        Acore::Hyperlinks::ClearLinkCache();
         handler->SendGlobalGMSysMessage("DB table `quest_template_locale` reloaded.");
         return true;
     }
@@ -1248,6 +1254,7 @@ public:
     {
         LOG_INFO("server.loading", "Reloading Conditions...");
         sConditionMgr->LoadConditions(true);
+        sObjectMgr->InvalidateQuestGiverStatuses();
         handler->SendGlobalGMSysMessage("Conditions reloaded.");
         return true;
     }
@@ -15,9 +15,11 @@
  * with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "AllocatorStats.h"
 #include "Chat.h"
 #include "CommandScript.h"
 #include "Common.h"
+#include "DatabaseEnv.h"
 #include "GameTime.h"
 #include "GitRevision.h"
 #include "Log.h"
@@ -26,6 +28,7 @@
 #include "MotdMgr.h"
 #include "MySQLThreading.h"
 #include "Realm.h"
+#include "StatementStats.h"
 #include "StringConvert.h"
 #include "UpdateTime.h"
 #include "VMapFactory.h"
@@ -77,14 +80,28 @@ public:
             { "closed",       HandleServerSetClosedCommand,      SEC_CONSOLE,       Console::Yes },
         };
 
+        static ChatCommandTable serverDbStatsCommandTable =
+        {
+            { "reset",        HandleServerDbStatsResetCommand,   SEC_ADMINISTRATOR, Console::Yes },
+            { "",             HandleServerDbStatsCommand,        SEC_ADMINISTRATOR, Console::Yes }
+        };
+
+        static ChatCommandTable serverMemoryCommandTable =
+        {
+            { "purge",        HandleServerMemoryPurgeCommand,    SEC_ADMINISTRATOR, Console::Yes },
+            { "",             HandleServerMemoryCommand,         SEC_ADMINISTRATOR, Console::Yes }
+        };
+
         static ChatCommandTable serverCommandTable =
         {
             { "corpses",      HandleServerCorpsesCommand,        SEC_GAMEMASTER,    Console::Yes },
+            { "dbstats",      serverDbStatsCommandTable },
             { "debug",        HandleServerDebugCommand,          SEC_ADMINISTRATOR, Console::Yes },
             { "exit",         HandleServerExitCommand,           SEC_CONSOLE,       Console::Yes },
             { "idlerestart",  serverIdleRestartCommandTable },
             { "idleshutdown", serverIdleShutdownCommandTable },
             { "info",         HandleServerInfoCommand,           SEC_PLAYER,        Console::Yes },
+            { "memory",       serverMemoryCommandTable },
             { "motd",         HandleServerMotdCommand,           SEC_PLAYER,        Console::Yes },
             { "restart",      serverRestartCommandTable },
             { "shutdown",     serverShutdownCommandTable },
@@ -109,6 +126,101 @@ public:
         return true;
     }
 
+    static std::vector<StatementStats*> GetStatementStats(Optional<std::string> const& database)
+    {
+        std::vector<StatementStats*> result;
+        auto add = [&](std::string_view name, StatementStats* stats)
+        {
+            if (stats && (!database || *database == "all" || *database == name))
+                result.push_back(stats);
+        };
+
+        add("login", LoginDatabase.GetStatementStats());
+        add("character", CharacterDatabase.GetStatementStats());
+        add("world", WorldDatabase.GetStatementStats());
+        return result;
+    }
+
+    // .server dbstats [all|login|character|world] [count]
+    static bool HandleServerDbStatsCommand(ChatHandler* handler, Optional<std::string> database, Optional<uint32> count)
+    {
+        std::vector<StatementStats*> pools = GetStatementStats(database);
+        if (pools.empty())
+        {
+            handler->SendErrorMessage("Unknown database, use all, login, character or world.");
+            return false;
+        }
+
+        uint32 const limit = count.value_or(10);
+        for (StatementStats* stats : pools)
+        {
+            std::vector<StatementStats::Snapshot> snapshots = stats->GetSnapshots();
+            handler->PSendSysMessage("Database '{}': {} statements executed, top {} by total time:", stats->GetDatabaseName(), snapshots.size(), std::min<std::size_t>(limit, snapshots.size()));
+
+            for (std::size_t i = 0; i < snapshots.size() && i < limit; ++i)
+            {
+                StatementStats::Snapshot const& snapshot = snapshots[i];
+                handler->PSendSysMessage("  #{} calls: {} total: {} ms p50: {} us p99: {} us max: {} us rows: {} errors: {}",
+                    snapshot.Index, snapshot.Calls, snapshot.Total.count() / IN_MILLISECONDS, snapshot.P50.count(), snapshot.P99.count(), snapshot.Max.count(), snapshot.Rows, snapshot.Errors);
+                handler->PSendSysMessage("     {}", stats->GetQueryString(snapshot.Index).substr(0, 120));
+            }
+        }
+
+        return true;
+    }
+
+    static bool HandleServerMemoryCommand(ChatHandler* handler)
+    {
+        Acore::AllocatorStats::Stats stats;
+        bool const available = Acore::AllocatorStats::GetStats(stats, true);
+
+        constexpr double MiB = 1024.0 * 1024.0;
+        handler->PSendSysMessage("Process resident memory: {:.1f} MiB", stats.ProcessResident / MiB);
+        if (!available)
+        {
+            handler->PSendSysMessage("The {} allocator reports no statistics.", Acore::AllocatorStats::GetAllocatorName());
+            return true;
+        }
+
+        handler->PSendSysMessage("Allocator {}: allocated {:.1f} MiB active {:.1f} MiB resident {:.1f} MiB mapped {:.1f} MiB retained {:.1f} MiB fragmentation {:.1f}%",
+            Acore::AllocatorStats::GetAllocatorName(), stats.Allocated / MiB, stats.Active / MiB, stats.Resident / MiB, stats.Mapped / MiB, stats.Retained / MiB,
+            stats.GetFragmentation() * 100.0f);
+
+        for (Acore::AllocatorStats::Arena const& arena : stats.Arenas)
+            handler->PSendSysMessage("  arena #{} threads: {} active: {:.1f} MiB dirty: {:.1f} MiB", arena.Index, arena.Threads, arena.Active / MiB, arena.Dirty / MiB);
+
+        return true;
+    }
+
+    static bool HandleServerMemoryPurgeCommand(ChatHandler* handler)
+    {
+        Acore::AllocatorStats::Stats before;
+        Acore::AllocatorStats::GetStats(before);
+        Acore::AllocatorStats::Purge();
+        Acore::AllocatorStats::Stats after;
+        Acore::AllocatorStats::GetStats(after);
+
+        handler->PSendSysMessage("Unused allocator pages returned to the system, process resident memory {:.1f} MiB -> {:.1f} MiB.",
+            before.ProcessResident / (1024.0 * 1024.0), after.ProcessResident / (1024.0 * 1024.0));
+        return true;
+    }
+
+    static bool HandleServerDbStatsResetCommand(ChatHandler* handler, Optional<std::string> database)
+    {
+        std::vector<StatementStats*> pools = GetStatementStats(database);
+        if (pools.empty())
+        {
+            handler->SendErrorMessage("Unknown database, use all, login, character or world.");
+            return false;
+        }
+
+        for (StatementStats* stats : pools)
+            stats->Reset();
+
+        handler->SendSysMessage("Database statement statistics reset.");
+        return true;
+    }
+
     static bool HandleServerDebugCommand(ChatHandler* handler)
     {
         uint16 worldPort = uint16(sWorld->getIntConfig(CONFIG_PORT_WORLD));
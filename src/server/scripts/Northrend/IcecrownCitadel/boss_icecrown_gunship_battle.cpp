@@ -17,7 +17,7 @@
 
 #include "AchievementCriteriaScript.h"
 #include "AreaDefines.h"
-#include "Config.h"
+#include "ConfigValueCache.h"
 #include "CreatureScript.h"
 #include "CreatureTextMgr.h"
 #include "GameTime.h"
@@ -682,7 +682,8 @@ public:
 
         void UpdateAI(uint32 /*diff*/) override
         {
-            if (!sConfigMgr->GetOption<int32>("WipeGunshipBlizzlike.Enable", 1))
+            static ConfigOption<int32> const wipeBlizzlike("WipeGunshipBlizzlike.Enable", 1);
+            if (!wipeBlizzlike.Get())
                 return;
 
             if (_instance->GetBossState(DATA_ICECROWN_GUNSHIP_BATTLE) != IN_PROGRESS)
@@ -600,31 +600,7 @@ bool OPvPCapturePointNA::Update(uint32 diff)
     if (!_capturePoint)
         return false;
 
-    float radius = ((float)_capturePoint->GetGOInfo()->capturePoint.radius);
-
-    for (PlayerSet playerSet : _activePlayers)
-    {
-        for (ObjectGuid playerGuid : playerSet)
-        {
-            if (Player* player = ObjectAccessor::FindPlayer(playerGuid))
-                if (!_capturePoint->IsWithinDistInMap(player, radius) || !player->IsOutdoorPvPActive())
-                    HandlePlayerLeave(player);
-        }
-    }
-
-    std::list<Player*> players;
-    Acore::AnyPlayerInObjectRangeCheck checker(_capturePoint, radius);
-    Acore::PlayerListSearcher<Acore::AnyPlayerInObjectRangeCheck> searcher(_capturePoint, players, checker);
-    Cell::VisitObjects(_capturePoint, searcher, radius);
-
-    for (Player* player : players)
-    {
-        if (player->IsOutdoorPvPActive())
-        {
-            if (_activePlayers[player->GetTeamId()].insert(player->GetGUID()).second)
-                HandlePlayerEnter(player);
-        }
-    }
+    UpdateActivePlayers();
 
     if (m_GuardCheckTimer < diff)
     {
@@ -17,14 +17,17 @@
 
 #include "DBCStore.h"
 #include "DBCDatabaseLoader.h"
+#include "DBCFileLoader.h"
 
-DBCStorageBase::DBCStorageBase(char const* fmt) : _fieldCount(0), _fileFormat(fmt), _dataTable(nullptr), _indexTableSize(0)
+DBCStorageBase::DBCStorageBase(char const* fmt) : _fieldCount(0), _fileFormat(fmt), _dataTable(nullptr), _dataTableMapped(false), _indexTableSize(0)
 {
 }
 
 DBCStorageBase::~DBCStorageBase()
 {
-    delete[] _dataTable;
+    if (!_dataTableMapped)
+        delete[] _dataTable;
+
     for (char* strings : _stringPool)
         delete[] strings;
 }
@@ -41,12 +44,15 @@ bool DBCStorageBase::Load(char const* path, char**& indexTable)
 
     _fieldCount = dbc.GetCols();
 
-    // load raw non-string data
-    _dataTable = dbc.AutoProduceData(_fileFormat, _indexTableSize, indexTable);
+    // use the records of the file when their layout is the one of the structure, copy them otherwise
+    _dataTable = dbc.AutoProduceDataInPlace(_fileFormat, _indexTableSize, indexTable);
+    _dataTableMapped = _dataTable != nullptr;
+    if (!_dataTable)
+        _dataTable = dbc.AutoProduceData(_fileFormat, _indexTableSize, indexTable);
 
-    // load strings from dbc data
-    if (char* stringBlock = dbc.AutoProduceStrings(_fileFormat, _dataTable))
-        _stringPool.push_back(stringBlock);
+    // point strings into the dbc data
+    if (dbc.AutoProduceStrings(_fileFormat, _dataTable) || _dataTableMapped)
+        _mappings.push_back(dbc.GetMapping());
 
     // error in dbc file at loading if nullptr
     return indexTable != nullptr;
@@ -64,9 +70,9 @@ bool DBCStorageBase::LoadStringsFrom(char const* path, char** indexTable)
     if (!dbc.Load(path, _fileFormat))
         return false;
 
-    // load strings from another locale dbc data
-    if (char* stringBlock = dbc.AutoProduceStrings(_fileFormat, _dataTable))
-        _stringPool.push_back(stringBlock);
+    // point strings into another locale dbc data
+    if (dbc.AutoProduceStrings(_fileFormat, _dataTable))
+        _mappings.push_back(dbc.GetMapping());
 
     return true;
 }
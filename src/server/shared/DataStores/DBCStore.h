@@ -22,8 +22,11 @@
 #include "DBCStorageIterator.h"
 #include "Errors.h"
 #include <cstring>
+#include <memory>
 #include <vector>
 
+class DBCFileMapping;
+
 /// Interface class for common access
 class DBCStorageBase
 {
@@ -46,7 +49,9 @@ protected:
     uint32 _fieldCount;
     char const* _fileFormat;
     char* _dataTable;
+    bool _dataTableMapped;                                  // records used in place from a file mapping
     std::vector<char*> _stringPool;
+    std::vector<std::shared_ptr<DBCFileMapping>> _mappings; // files holding the mapped records and strings
     uint32 _indexTableSize;
 };
 
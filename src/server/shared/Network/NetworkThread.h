@@ -22,13 +22,17 @@
 #include "Errors.h"
 #include "IoContext.h"
 #include "Log.h"
+#include "Metric.h"
+#include "ProcessPriority.h"
 #include "Socket.h"
+#include "SocketStats.h"
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/steady_timer.hpp>
 #include <atomic>
 #include <memory>
 #include <mutex>
 #include <set>
+#include <string>
 #include <thread>
 
 using boost::asio::ip::tcp;
@@ -38,7 +42,7 @@ class NetworkThread
 {
 public:
     NetworkThread() :
-        _ioContext(1), _acceptSocket(_ioContext), _updateTimer(_ioContext), _proxyHeaderReadingEnabled(false) { }
+        _stats(std::make_shared<SocketStats>()), _ioContext(1), _acceptSocket(_ioContext), _updateTimer(_ioContext), _proxyHeaderReadingEnabled(false) { }
 
     virtual ~NetworkThread()
     {
@@ -82,10 +86,18 @@ public:
         return _connections;
     }
 
+    // Index of the thread in its SocketMgr, tags the metrics of the thread
+    void SetIndex(uint32 index) { _index = index; }
+    // processors the thread runs on, see SetCurrentThreadAffinity, applied by Start
+    void SetAffinity(std::string affinity) { _affinity = std::move(affinity); }
+
+    [[nodiscard]] SocketStats const& GetStats() const { return *_stats; }
+
     virtual void AddSocket(std::shared_ptr<SocketType> sock)
     {
         std::lock_guard<std::mutex> lock(_newSocketsLock);
 
+        sock->SetThreadStats(_stats);
         ++_connections;
         _newSockets.emplace_back(sock);
         SocketAdded(sock);
@@ -179,6 +191,8 @@ protected:
     {
         LOG_DEBUG("misc", "Network Thread Starting");
 
+        SetCurrentThreadAffinity("network", _affinity);
+
         _updateTimer.expires_at(std::chrono::steady_clock::now() + std::chrono::milliseconds(1));
         _updateTimer.async_wait([this](boost::system::error_code const&) { Update(); });
         _ioContext.run();
@@ -213,14 +227,62 @@ protected:
 
             return false;
         }), _sockets.end());
+
+        if (std::chrono::steady_clock::now() >= _nextStatsReport)
+            ReportStats();
+    }
+
+    void ReportStats()
+    {
+        _nextStatsReport = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+
+        std::string const thread = std::to_string(_index);
+
+        uint64 const sentBytes = _stats->SentBytes.load(std::memory_order_relaxed);
+        uint64 const partialWrites = _stats->PartialWrites.load(std::memory_order_relaxed);
+        uint64 const compressionInput = _stats->CompressionInputBytes.load(std::memory_order_relaxed);
+        uint64 const compressionOutput = _stats->CompressionOutputBytes.load(std::memory_order_relaxed);
+
+        // percentiles of the buffers written since the last report
+        std::array<uint64, SocketStats::QUEUE_TIME_BUCKETS> queueTimes = _stats->GetQueueTimes();
+        std::array<uint64, SocketStats::QUEUE_TIME_BUCKETS> reportQueueTimes;
+        for (std::size_t bucket = 0; bucket < SocketStats::QUEUE_TIME_BUCKETS; ++bucket)
+            reportQueueTimes[bucket] = queueTimes[bucket] - _reported.QueueTimes[bucket];
+
+        METRIC_VALUE("network_connections", uint64(_connections.load()), METRIC_TAG("thread", thread));
+        METRIC_VALUE("network_queued_bytes", _stats->QueuedBytes.load(std::memory_order_relaxed), METRIC_TAG("thread", thread));
+        METRIC_VALUE("network_sent_bytes", sentBytes - _reported.SentBytes, METRIC_TAG("thread", thread));
+        METRIC_VALUE("network_partial_writes", partialWrites - _reported.PartialWrites, METRIC_TAG("thread", thread));
+        METRIC_VALUE("network_queue_time_us", uint64(SocketStats::GetPercentile(reportQueueTimes, 50).count()), METRIC_TAG("thread", thread), METRIC_TAG("percentile", "50"));
+        METRIC_VALUE("network_queue_time_us", uint64(SocketStats::GetPercentile(reportQueueTimes, 99).count()), METRIC_TAG("thread", thread), METRIC_TAG("percentile", "99"));
+        if (compressionInput > _reported.CompressionInput)
+            METRIC_VALUE("network_compression_ratio", double(compressionOutput - _reported.CompressionOutput) / double(compressionInput - _reported.CompressionInput), METRIC_TAG("thread", thread));
+
+        _reported = { sentBytes, partialWrites, compressionInput, compressionOutput, queueTimes };
     }
 
 private:
     using SocketContainer = std::vector<std::shared_ptr<SocketType>>;
 
+    // Counters as of the last metric report
+    struct ReportedStats
+    {
+        uint64 SentBytes;
+        uint64 PartialWrites;
+        uint64 CompressionInput;
+        uint64 CompressionOutput;
+        std::array<uint64, SocketStats::QUEUE_TIME_BUCKETS> QueueTimes;
+    };
+
     std::atomic<int32> _connections{};
     std::atomic<bool> _stopped{};
 
+    uint32 _index = 0;
+    std::string _affinity;
+    std::shared_ptr<SocketStats> _stats;
+    ReportedStats _reported = { };
+    std::chrono::steady_clock::time_point _nextStatsReport;
+
     std::unique_ptr<std::thread> _thread;
 
     SocketContainer _sockets;
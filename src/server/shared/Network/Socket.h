@@ -20,17 +20,23 @@
 
 #include "Log.h"
 #include "MessageBuffer.h"
+#include "SocketStats.h"
+#include <algorithm>
 #include <atomic>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <chrono>
+#include <deque>
 #include <memory>
-#include <queue>
 #include <type_traits>
+#include <vector>
 
 using boost::asio::ip::tcp;
 
 #define READ_BLOCK_SIZE 4096
-#ifdef BOOST_ASIO_HAS_IOCP
+#define WRITE_GATHER_BUFFER_COUNT 16
+// Completion based backends (IOCP, io_uring) get the write issued directly instead of waiting for writability first
+#if defined(BOOST_ASIO_HAS_IOCP) || defined(BOOST_ASIO_HAS_IO_URING)
 #define AC_SOCKET_USE_IOCP
 #endif
 
@@ -76,6 +82,9 @@ public:
 
     virtual ~Socket()
     {
+        if (_threadStats)
+            _threadStats->QueuedBytes.fetch_sub(_stats.QueuedBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
         _state = SocketState::Closed;
         boost::system::error_code error;
         _socket.close(error);
@@ -158,7 +167,8 @@ public:
 
     void QueuePacket(MessageBuffer&& buffer)
     {
-        _writeQueue.push(std::move(buffer));
+        AddStat(&SocketStats::QueuedBytes, buffer.GetActiveSize());
+        _writeQueue.push_back({ std::move(buffer), std::chrono::steady_clock::now() });
 
 #ifdef AC_SOCKET_USE_IOCP
         AsyncProcessQueue();
@@ -199,6 +209,11 @@ public:
 
     MessageBuffer& GetReadBuffer() { return _readBuffer; }
 
+    [[nodiscard]] SocketStats const& GetStats() const { return _stats; }
+
+    // Counters of the network thread owning the socket, set before Start()
+    void SetThreadStats(std::shared_ptr<SocketStats> stats) { _threadStats = std::move(stats); }
+
 protected:
     virtual void OnClose() { }
     virtual SocketReadCallbackResult ReadHandler() = 0;
@@ -211,8 +226,8 @@ protected:
         _isWritingAsync = true;
 
 #ifdef AC_SOCKET_USE_IOCP
-        MessageBuffer& buffer = _writeQueue.front();
-        _socket.async_write_some(boost::asio::buffer(buffer.GetReadPointer(), buffer.GetActiveSize()), std::bind(&Socket<T>::WriteHandler,
+        _gatheredWriteBytes = GatherWriteBuffers();
+        _socket.async_write_some(_gatheredWriteBuffers, std::bind(&Socket<T>::WriteHandler,
             this->shared_from_this(), std::placeholders::_1, std::placeholders::_2));
 #else
         _socket.async_wait(boost::asio::socket_base::wait_write, [self = this->shared_from_this()](boost::system::error_code error)
@@ -223,6 +238,12 @@ protected:
         return false;
     }
 
+    void RecordCompression(std::size_t inputBytes, std::size_t outputBytes)
+    {
+        AddStat(&SocketStats::CompressionInputBytes, inputBytes);
+        AddStat(&SocketStats::CompressionOutputBytes, outputBytes);
+    }
+
     void SetNoDelay(bool enable)
     {
         boost::system::error_code err;
@@ -359,16 +380,80 @@ private:
         _proxyHeaderReadingState = PROXY_HEADER_READING_STATE_FINISHED;
     }
 
+    /// Collects the front of the write queue into one scatter/gather sequence so a single write call flushes several buffers
+    std::size_t GatherWriteBuffers()
+    {
+        _gatheredWriteBuffers.clear();
+
+        std::size_t bytes = 0;
+        for (QueuedBuffer& queued : _writeQueue)
+        {
+            if (_gatheredWriteBuffers.size() >= WRITE_GATHER_BUFFER_COUNT)
+                break;
+
+            _gatheredWriteBuffers.emplace_back(queued.Buffer.GetReadPointer(), queued.Buffer.GetActiveSize());
+            bytes += queued.Buffer.GetActiveSize();
+        }
+
+        return bytes;
+    }
+
+    void WriteCompleted(std::size_t transferedBytes, std::size_t bytesToSend)
+    {
+        AddStat(&SocketStats::Writes, 1);
+        AddStat(&SocketStats::SentBytes, transferedBytes);
+        if (transferedBytes < bytesToSend)
+            AddStat(&SocketStats::PartialWrites, 1);
+
+        while (!_writeQueue.empty())
+        {
+            MessageBuffer& buffer = _writeQueue.front().Buffer;
+            std::size_t consumed = std::min(transferedBytes, buffer.GetActiveSize());
+            buffer.ReadCompleted(consumed);
+            SubStat(&SocketStats::QueuedBytes, consumed);
+            transferedBytes -= consumed;
+
+            if (buffer.GetActiveSize())
+                break;
+
+            PopWriteQueue();
+        }
+    }
+
+    void PopWriteQueue()
+    {
+        QueuedBuffer const& queued = _writeQueue.front();
+        SubStat(&SocketStats::QueuedBytes, queued.Buffer.GetActiveSize());
+
+        std::chrono::steady_clock::duration const queueTime = std::chrono::steady_clock::now() - queued.QueueTime;
+        _stats.AddQueueTime(queueTime);
+        if (_threadStats)
+            _threadStats->AddQueueTime(queueTime);
+
+        _writeQueue.pop_front();
+    }
+
+    void AddStat(std::atomic<uint64> SocketStats::* counter, uint64 value)
+    {
+        (_stats.*counter).fetch_add(value, std::memory_order_relaxed);
+        if (_threadStats)
+            ((*_threadStats).*counter).fetch_add(value, std::memory_order_relaxed);
+    }
+
+    void SubStat(std::atomic<uint64> SocketStats::* counter, uint64 value)
+    {
+        (_stats.*counter).fetch_sub(value, std::memory_order_relaxed);
+        if (_threadStats)
+            ((*_threadStats).*counter).fetch_sub(value, std::memory_order_relaxed);
+    }
+
 #ifdef AC_SOCKET_USE_IOCP
     void WriteHandler(boost::system::error_code error, std::size_t transferedBytes)
     {
         if (!error)
         {
             _isWritingAsync = false;
-            _writeQueue.front().ReadCompleted(transferedBytes);
-
-            if (!_writeQueue.front().GetActiveSize())
-                _writeQueue.pop();
+            WriteCompleted(transferedBytes, _gatheredWriteBytes);
 
             if (!_writeQueue.empty())
                 AsyncProcessQueue();
@@ -392,12 +477,10 @@ private:
         if (_writeQueue.empty())
             return false;
 
-        MessageBuffer& queuedMessage = _writeQueue.front();
-
-        std::size_t bytesToSend = queuedMessage.GetActiveSize();
+        std::size_t bytesToSend = GatherWriteBuffers();
 
         boost::system::error_code error;
-        std::size_t bytesSent = _socket.write_some(boost::asio::buffer(queuedMessage.GetReadPointer(), bytesToSend), error);
+        std::size_t bytesSent = _socket.write_some(_gatheredWriteBuffers, error);
 
         if (error)
         {
@@ -406,7 +489,7 @@ private:
                 return AsyncProcessQueue();
             }
 
-            _writeQueue.pop();
+            PopWriteQueue();
 
             if (_state.load() == SocketState::Closing && _writeQueue.empty())
             {
@@ -417,7 +500,7 @@ private:
         }
         else if (bytesSent == 0)
         {
-            _writeQueue.pop();
+            PopWriteQueue();
 
             if (_state.load() == SocketState::Closing && _writeQueue.empty())
             {
@@ -426,13 +509,11 @@ private:
 
             return false;
         }
-        else if (bytesSent < bytesToSend) // now n > 0
-        {
-            queuedMessage.ReadCompleted(bytesSent);
-            return AsyncProcessQueue();
-        }
 
-        _writeQueue.pop();
+        WriteCompleted(bytesSent, bytesToSend);
+
+        if (bytesSent < bytesToSend) // now n > 0
+            return AsyncProcessQueue();
 
         if (_state.load() == SocketState::Closing && _writeQueue.empty())
         {
@@ -448,8 +529,19 @@ private:
     boost::asio::ip::address _remoteAddress;
     uint16 _remotePort;
 
+    struct QueuedBuffer
+    {
+        MessageBuffer Buffer;
+        std::chrono::steady_clock::time_point QueueTime;
+    };
+
     MessageBuffer _readBuffer;
-    std::queue<MessageBuffer> _writeQueue;
+    std::deque<QueuedBuffer> _writeQueue;
+    std::vector<boost::asio::const_buffer> _gatheredWriteBuffers;
+    std::size_t _gatheredWriteBytes = 0;
+
+    SocketStats _stats;
+    std::shared_ptr<SocketStats> _threadStats;
 
     std::atomic<SocketState> _state;
 
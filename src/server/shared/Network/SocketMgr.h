@@ -64,8 +64,13 @@ public:
 
         ASSERT(_threads);
 
+        std::string const affinity = sConfigMgr->GetOption<std::string>("Network.Threads.Affinity", "", false);
         for (int32 i = 0; i < _threadCount; ++i)
+        {
+            _threads[i].SetIndex(i);
+            _threads[i].SetAffinity(affinity);
             _threads[i].Start();
+        }
 
         _acceptor->SetSocketFactory([this]() { return GetSocketForAccept(); });
         return true;
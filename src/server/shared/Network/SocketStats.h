@@ -0,0 +1,86 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __SOCKETSTATS_H__
+#define __SOCKETSTATS_H__
+
+#include "Define.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+
+/*
+ * Write side counters of a connection, or of all the connections of a
+ * network thread. Updated by the network thread (and the compressing
+ * sender threads), read from anywhere.
+ */
+struct SocketStats
+{
+    // time in the write queue, bucket i counts buffers written in less than 2^i microseconds, the last one takes the rest
+    static constexpr std::size_t QUEUE_TIME_BUCKETS = 20;
+
+    std::atomic<uint64> QueuedBytes{};      // currently waiting in the write queue
+    std::atomic<uint64> SentBytes{};
+    std::atomic<uint64> Writes{};
+    std::atomic<uint64> PartialWrites{};    // writes the kernel didn't take entirely
+    std::atomic<uint64> CompressionInputBytes{};
+    std::atomic<uint64> CompressionOutputBytes{};
+    std::array<std::atomic<uint64>, QUEUE_TIME_BUCKETS> QueueTimes{};
+
+    void AddQueueTime(std::chrono::steady_clock::duration time)
+    {
+        uint64 const micro = std::chrono::duration_cast<std::chrono::microseconds>(time).count();
+        std::size_t bucket = 0;
+        while (bucket < QUEUE_TIME_BUCKETS - 1 && micro >= (uint64(1) << bucket))
+            ++bucket;
+
+        QueueTimes[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Upper bound of the bucket holding the given percentile of the buckets, zero without samples
+    static std::chrono::microseconds GetPercentile(std::array<uint64, QUEUE_TIME_BUCKETS> const& buckets, uint32 percentile)
+    {
+        uint64 total = 0;
+        for (uint64 count : buckets)
+            total += count;
+
+        if (!total)
+            return std::chrono::microseconds::zero();
+
+        uint64 const rank = (total * percentile + 99) / 100;
+        uint64 seen = 0;
+        for (std::size_t bucket = 0; bucket < QUEUE_TIME_BUCKETS; ++bucket)
+        {
+            seen += buckets[bucket];
+            if (seen >= rank)
+                return std::chrono::microseconds(uint64(1) << bucket);
+        }
+
+        return std::chrono::microseconds(uint64(1) << (QUEUE_TIME_BUCKETS - 1));
+    }
+
+    [[nodiscard]] std::array<uint64, QUEUE_TIME_BUCKETS> GetQueueTimes() const
+    {
+        std::array<uint64, QUEUE_TIME_BUCKETS> buckets;
+        for (std::size_t bucket = 0; bucket < QUEUE_TIME_BUCKETS; ++bucket)
+            buckets[bucket] = QueueTimes[bucket].load(std::memory_order_relaxed);
+
+        return buckets;
+    }
+};
+
+#endif // __SOCKETSTATS_H__
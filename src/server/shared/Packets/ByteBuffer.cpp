@@ -20,6 +20,7 @@
 #include "Log.h"
 #include "MessageBuffer.h"
 #include "Timer.h"
+#include <cstring>
 #include <ctime>
 #include <sstream>
 #include <utf8.h>
@@ -76,18 +77,24 @@ ByteBuffer& ByteBuffer::operator>>(double& value)
 
 std::string ByteBuffer::ReadCString(bool requireValidUtf8 /*= true*/)
 {
-    std::string value;
+    return std::string(ReadCStringView(requireValidUtf8));
+}
 
-    while (rpos() < size()) // prevent crash the wrong string format in a packet
-    {
-        char c = read<char>();
-        if (c == 0)
-            break;
-        value += c;
-    }
+std::string_view ByteBuffer::ReadCStringView(bool requireValidUtf8 /*= true*/)
+{
+    // prevent crash the wrong string format in a packet: a missing terminator ends the string at the end of the buffer
+    if (_rpos >= size())
+        return { };
+
+    char const* begin = reinterpret_cast<char const*>(&_storage[_rpos]);
+    std::size_t const remaining = size() - _rpos;
+    char const* terminator = static_cast<char const*>(std::memchr(begin, 0, remaining));
+    std::size_t const length = terminator ? std::size_t(terminator - begin) : remaining;
+    _rpos += terminator ? length + 1 : length;
 
+    std::string_view value(begin, length);
     if (requireValidUtf8 && !utf8::is_valid(value.begin(), value.end()))
-        throw ByteBufferInvalidValueException("string", value.c_str());
+        throw ByteBufferInvalidValueException("string", std::string(value).c_str());
 
     return value;
 }
@@ -18,11 +18,13 @@
 #ifndef _BYTEBUFFER_H
 #define _BYTEBUFFER_H
 
+#include "BufferPool.h"
 #include "ByteConverter.h"
 #include "Define.h"
 #include <array>
 #include <cstring>
 #include <string>
+#include <string_view>
 #include <vector>
 
 class MessageBuffer;
@@ -413,6 +415,9 @@ public:
     }
 
     std::string ReadCString(bool requireValidUtf8 = true);
+    // Reads a null terminated string without copying it, the view points into the storage of the buffer
+    // and stays valid until the buffer is modified or destroyed
+    std::string_view ReadCStringView(bool requireValidUtf8 = true);
     uint32 ReadPackedTime();
 
     ByteBuffer& ReadPackedTime(uint32& time)
@@ -529,7 +534,7 @@ public:
 
 protected:
     std::size_t _rpos{0}, _wpos{0};
-    std::vector<uint8> _storage;
+    Acore::ByteStorage _storage;
 };
 
 /// @todo Make a ByteBuffer.cpp and move all this inlining to it.
@@ -25,7 +25,7 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <memory>
 
-RealmList::RealmList() : _updateInterval(0) { }
+RealmList::RealmList() : _updateInterval(0), _realms(std::make_shared<RealmMap>()) { }
 
 RealmList* RealmList::Instance()
 {
@@ -91,12 +91,12 @@ void RealmList::LoadBuildInfo()
     }
 }
 
-void RealmList::UpdateRealm(RealmHandle const& id, uint32 build, std::string const& name,
+void RealmList::UpdateRealm(RealmMap& realms, RealmHandle const& id, uint32 build, std::string const& name,
     boost::asio::ip::address&& address, boost::asio::ip::address&& localAddr, boost::asio::ip::address&& localSubmask,
     uint16 port, uint8 icon, RealmFlags flag, uint8 realmTimezone, AccountTypes allowedSecurityLevel, float population)
 {
     // Create new if not exist or update existed
-    Realm& realm = _realms[id];
+    Realm& realm = realms[id];
 
     realm.Id = id;
     realm.Build = build;
@@ -139,12 +139,12 @@ void RealmList::UpdateRealms(boost::system::error_code const& error)
     PreparedQueryResult result = LoginDatabase.Query(stmt);
 
     std::map<RealmHandle, std::string> existingRealms;
-    for (auto const& [handle, realm] : _realms)
+    for (auto const& [handle, realm] : *GetRealms())
     {
         existingRealms[handle] = realm.Name;
     }
 
-    _realms.clear();
+    std::shared_ptr<RealmMap> realms = std::make_shared<RealmMap>();
 
     // Circle through results and add them to the realm map
     if (result)
@@ -201,7 +201,7 @@ void RealmList::UpdateRealms(boost::system::error_code const& error)
 
                 RealmHandle id{ realmId };
 
-                UpdateRealm(id, build, name, externalAddress->address(), localAddress->address(), localSubmask->address(), port, icon, flag,
+                UpdateRealm(*realms, id, build, name, externalAddress->address(), localAddress->address(), localSubmask->address(), port, icon, flag,
                     realmTimezone, (allowedSecurityLevel <= SEC_ADMINISTRATOR ? AccountTypes(allowedSecurityLevel) : SEC_ADMINISTRATOR), pop);
 
                 if (!existingRealms.count(id))
@@ -226,6 +226,11 @@ void RealmList::UpdateRealms(boost::system::error_code const& error)
     for (auto itr = existingRealms.begin(); itr != existingRealms.end(); ++itr)
         LOG_INFO("server.authserver", "Removed realm \"{}\".", itr->second);
 
+    {
+        std::lock_guard<std::mutex> guard(_realmsLock);
+        _realms = std::move(realms);
+    }
+
     if (_updateInterval)
     {
         _updateTimer->expires_at(Acore::Asio::SteadyTimer::GetExpirationTime(_updateInterval));
@@ -233,15 +238,10 @@ void RealmList::UpdateRealms(boost::system::error_code const& error)
     }
 }
 
-Realm const* RealmList::GetRealm(RealmHandle const& id) const
+std::shared_ptr<RealmList::RealmMap const> RealmList::GetRealms() const
 {
-    auto itr = _realms.find(id);
-    if (itr != _realms.end())
-    {
-        return &itr->second;
-    }
-
-    return nullptr;
+    std::lock_guard<std::mutex> guard(_realmsLock);
+    return _realms;
 }
 
 RealmBuildInfo const* RealmList::GetBuildInfo(uint32 build) const
@@ -24,6 +24,7 @@
 #include <array>
 #include <map>
 #include <memory> // NOTE: this import is NEEDED (even though some IDEs report it as unused)
+#include <mutex>
 #include <vector>
 
 namespace Acore::Asio
@@ -58,8 +59,8 @@ public:
     void Initialize(Acore::Asio::IoContext& ioContext, uint32 updateInterval);
     void Close();
 
-    [[nodiscard]] RealmMap const& GetRealms() const { return _realms; }
-    [[nodiscard]] Realm const* GetRealm(RealmHandle const& id) const;
+    // Every refresh publishes a new map, readers of other threads keep the one they got alive
+    [[nodiscard]] std::shared_ptr<RealmMap const> GetRealms() const;
 
     [[nodiscard]] RealmBuildInfo const* GetBuildInfo(uint32 build) const;
 
@@ -69,12 +70,13 @@ private:
 
     void LoadBuildInfo();
     void UpdateRealms(boost::system::error_code const& error);
-    void UpdateRealm(RealmHandle const& id, uint32 build, std::string const& name,
+    static void UpdateRealm(RealmMap& realms, RealmHandle const& id, uint32 build, std::string const& name,
         boost::asio::ip::address&& address, boost::asio::ip::address&& localAddr, boost::asio::ip::address&& localSubmask,
         uint16 port, uint8 icon, RealmFlags flag, uint8 realmTimezone, AccountTypes allowedSecurityLevel, float population);
 
     std::vector<RealmBuildInfo> _builds;
-    RealmMap _realms;
+    std::shared_ptr<RealmMap const> _realms;
+    mutable std::mutex _realmsLock;
     uint32 _updateInterval{0};
     std::unique_ptr<boost::asio::steady_timer> _updateTimer;
     std::unique_ptr<Acore::Asio::Resolver> _resolver;
@@ -0,0 +1,109 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ByteBuffer.h"
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    // the shape of a typical packet: a guid, a handful of counters, a position and a name
+    void WriteFields(ByteBuffer& data, uint32 i)
+    {
+        data << uint64(0xF130000000000000ull | i);
+        data << uint32(i) << uint32(i * 3) << uint8(i & 0xFF) << uint16(i & 0xFFFF);
+        data << float(i) << float(i * 0.5f) << float(i * 0.25f) << float(3.14f);
+        data << "Benchmark";
+    }
+}
+
+static void BM_ByteBufferWrite(benchmark::State& state)
+{
+    uint32 const fieldSets = uint32(state.range(0));
+    for (auto _ : state)
+    {
+        ByteBuffer data;
+        for (uint32 i = 0; i < fieldSets; ++i)
+            WriteFields(data, i);
+
+        benchmark::DoNotOptimize(data.contents());
+    }
+
+    state.SetItemsProcessed(state.iterations() * fieldSets);
+}
+BENCHMARK(BM_ByteBufferWrite)->Arg(1)->Arg(16)->Arg(256);
+
+static void BM_ByteBufferWriteReserved(benchmark::State& state)
+{
+    uint32 const fieldSets = uint32(state.range(0));
+    for (auto _ : state)
+    {
+        ByteBuffer data;
+        data.reserve(fieldSets * 48);
+        for (uint32 i = 0; i < fieldSets; ++i)
+            WriteFields(data, i);
+
+        benchmark::DoNotOptimize(data.contents());
+    }
+
+    state.SetItemsProcessed(state.iterations() * fieldSets);
+}
+BENCHMARK(BM_ByteBufferWriteReserved)->Arg(1)->Arg(16)->Arg(256);
+
+static void BM_ByteBufferRead(benchmark::State& state)
+{
+    uint32 const fieldSets = uint32(state.range(0));
+    ByteBuffer data;
+    for (uint32 i = 0; i < fieldSets; ++i)
+        WriteFields(data, i);
+
+    for (auto _ : state)
+    {
+        data.rpos(0);
+        for (uint32 i = 0; i < fieldSets; ++i)
+        {
+            uint64 guid;
+            uint32 counter1, counter2;
+            uint8 counter3;
+            uint16 counter4;
+            float x, y, z, o;
+            std::string name;
+            data >> guid >> counter1 >> counter2 >> counter3 >> counter4 >> x >> y >> z >> o >> name;
+            benchmark::DoNotOptimize(guid);
+            benchmark::DoNotOptimize(name);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * fieldSets);
+}
+BENCHMARK(BM_ByteBufferRead)->Arg(1)->Arg(16)->Arg(256);
+
+static void BM_ByteBufferPackGUID(benchmark::State& state)
+{
+    ByteBuffer data;
+    data.reserve(9 * 1024);
+    for (auto _ : state)
+    {
+        data.clear();
+        for (uint64 i = 0; i < 1024; ++i)
+            data.appendPackGUID(0xF130000000000000ull | (i << 24) | i);
+
+        benchmark::DoNotOptimize(data.contents());
+    }
+
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+BENCHMARK(BM_ByteBufferPackGUID);
@@ -0,0 +1,93 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EventMap.h"
+#include "EventProcessor.h"
+#include <benchmark/benchmark.h>
+
+namespace
+{
+    class CountingEvent : public BasicEvent
+    {
+    public:
+        explicit CountingEvent(uint32& executed) : _executed(executed) { }
+
+        bool Execute(uint64, uint32) override
+        {
+            ++_executed;
+            return true;
+        }
+
+    private:
+        uint32& _executed;
+    };
+}
+
+// a creature script: a few events with different timers, executed and rescheduled every update
+static void BM_EventMapScriptLoop(benchmark::State& state)
+{
+    uint32 const eventCount = uint32(state.range(0));
+    EventMap events;
+    for (uint32 eventId = 1; eventId <= eventCount; ++eventId)
+        events.ScheduleEvent(eventId, Milliseconds(eventId * 100));
+
+    for (auto _ : state)
+    {
+        events.Update(100);
+        while (uint32 eventId = events.ExecuteEvent())
+            events.ScheduleEvent(eventId, Milliseconds(eventId * 100));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EventMapScriptLoop)->Arg(4)->Arg(16)->Arg(64);
+
+static void BM_EventMapScheduleCancel(benchmark::State& state)
+{
+    EventMap events;
+    for (auto _ : state)
+    {
+        for (uint32 eventId = 1; eventId <= 32; ++eventId)
+            events.ScheduleEvent(eventId, Milliseconds(eventId * 37 % 1000));
+        for (uint32 eventId = 1; eventId <= 32; eventId += 2)
+            events.CancelEvent(eventId);
+
+        events.Reset();
+    }
+
+    state.SetItemsProcessed(state.iterations() * 32);
+}
+BENCHMARK(BM_EventMapScheduleCancel);
+
+// the events of a unit: added all the time and executed when due
+static void BM_EventProcessorAddExecute(benchmark::State& state)
+{
+    uint32 const eventCount = uint32(state.range(0));
+    uint32 executed = 0;
+    EventProcessor events;
+    for (auto _ : state)
+    {
+        for (uint32 i = 0; i < eventCount; ++i)
+            events.AddEventAtOffset(new CountingEvent(executed), Milliseconds(i % 50));
+
+        events.Update(50);
+    }
+
+    benchmark::DoNotOptimize(executed);
+    state.SetItemsProcessed(state.iterations() * eventCount);
+}
+BENCHMARK(BM_EventProcessorAddExecute)->Arg(1)->Arg(16)->Arg(256);
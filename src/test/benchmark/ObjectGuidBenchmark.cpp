@@ -0,0 +1,79 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ObjectGuid.h"
+#include <benchmark/benchmark.h>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace
+{
+    // creatures of a few entries with consecutive spawn counters, like the objects of a map
+    std::vector<ObjectGuid> MakeCreatureGuids(uint32 count)
+    {
+        std::vector<ObjectGuid> guids;
+        guids.reserve(count);
+        for (uint32 counter = 1; counter <= count; ++counter)
+            guids.emplace_back(HighGuid::Unit, 1000 + counter % 64, counter);
+
+        return guids;
+    }
+}
+
+static void BM_ObjectGuidHash(benchmark::State& state)
+{
+    std::vector<ObjectGuid> const guids = MakeCreatureGuids(1024);
+    std::hash<ObjectGuid> hasher;
+    for (auto _ : state)
+        for (ObjectGuid const& guid : guids)
+            benchmark::DoNotOptimize(hasher(guid));
+
+    state.SetItemsProcessed(state.iterations() * guids.size());
+}
+BENCHMARK(BM_ObjectGuidHash);
+
+static void BM_ObjectGuidSetInsert(benchmark::State& state)
+{
+    std::vector<ObjectGuid> const guids = MakeCreatureGuids(uint32(state.range(0)));
+    for (auto _ : state)
+    {
+        std::unordered_set<ObjectGuid> set;
+        for (ObjectGuid const& guid : guids)
+            set.insert(guid);
+
+        benchmark::DoNotOptimize(set.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * guids.size());
+}
+BENCHMARK(BM_ObjectGuidSetInsert)->Arg(64)->Arg(4096);
+
+static void BM_ObjectGuidMapFind(benchmark::State& state)
+{
+    std::vector<ObjectGuid> const guids = MakeCreatureGuids(uint32(state.range(0)));
+    std::unordered_map<ObjectGuid, uint32> map;
+    for (ObjectGuid const& guid : guids)
+        map.emplace(guid, guid.GetCounter());
+
+    for (auto _ : state)
+        for (ObjectGuid const& guid : guids)
+            benchmark::DoNotOptimize(map.find(guid));
+
+    state.SetItemsProcessed(state.iterations() * guids.size());
+}
+BENCHMARK(BM_ObjectGuidMapFind)->Arg(64)->Arg(4096);
@@ -0,0 +1,149 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Define.h"
+#include "LockedQueue.h"
+#include "MPSCQueue.h"
+#include <benchmark/benchmark.h>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct QueuedItem
+    {
+        uint32 Value = 0;
+        std::atomic<QueuedItem*> QueueLink;
+    };
+}
+
+static void BM_MPSCQueueEnqueueDequeue(benchmark::State& state)
+{
+    MPSCQueue<QueuedItem> queue;
+    std::vector<QueuedItem> items(256);
+    for (auto _ : state)
+    {
+        for (QueuedItem& item : items)
+            queue.Enqueue(&item);
+
+        QueuedItem* item;
+        while (queue.Dequeue(item))
+            benchmark::DoNotOptimize(item);
+    }
+
+    state.SetItemsProcessed(state.iterations() * items.size());
+}
+BENCHMARK(BM_MPSCQueueEnqueueDequeue);
+
+static void BM_MPSCQueueIntrusiveEnqueueDequeue(benchmark::State& state)
+{
+    MPSCQueue<QueuedItem, &QueuedItem::QueueLink> queue;
+    std::vector<QueuedItem> items(256);
+    for (auto _ : state)
+    {
+        for (QueuedItem& item : items)
+            queue.Enqueue(&item);
+
+        QueuedItem* item;
+        while (queue.Dequeue(item))
+            benchmark::DoNotOptimize(item);
+    }
+
+    state.SetItemsProcessed(state.iterations() * items.size());
+}
+BENCHMARK(BM_MPSCQueueIntrusiveEnqueueDequeue);
+
+// packets queued by the network threads and read by the world thread
+static void BM_MPSCQueueProducers(benchmark::State& state)
+{
+    uint32 const producerCount = uint32(state.range(0));
+    uint32 const itemsPerProducer = 4096;
+    std::vector<QueuedItem> items(producerCount * itemsPerProducer);
+    for (auto _ : state)
+    {
+        MPSCQueue<QueuedItem> queue;
+        std::vector<std::thread> producers;
+        for (uint32 producer = 0; producer < producerCount; ++producer)
+        {
+            producers.emplace_back([&queue, &items, producer, itemsPerProducer]()
+            {
+                for (uint32 i = 0; i < itemsPerProducer; ++i)
+                    queue.Enqueue(&items[producer * itemsPerProducer + i]);
+            });
+        }
+
+        uint32 received = 0;
+        QueuedItem* item;
+        while (received < items.size())
+            if (queue.Dequeue(item))
+                ++received;
+
+        for (std::thread& producer : producers)
+            producer.join();
+    }
+
+    state.SetItemsProcessed(state.iterations() * items.size());
+}
+BENCHMARK(BM_MPSCQueueProducers)->Arg(1)->Arg(4)->UseRealTime();
+
+static void BM_LockedQueueAddNext(benchmark::State& state)
+{
+    LockedQueue<uint32> queue;
+    for (auto _ : state)
+    {
+        for (uint32 i = 0; i < 256; ++i)
+            queue.add(i);
+
+        uint32 item;
+        while (queue.next(item))
+            benchmark::DoNotOptimize(item);
+    }
+
+    state.SetItemsProcessed(state.iterations() * 256);
+}
+BENCHMARK(BM_LockedQueueAddNext);
+
+static void BM_LockedQueueProducers(benchmark::State& state)
+{
+    uint32 const producerCount = uint32(state.range(0));
+    uint32 const itemsPerProducer = 4096;
+    for (auto _ : state)
+    {
+        LockedQueue<uint32> queue;
+        std::vector<std::thread> producers;
+        for (uint32 producer = 0; producer < producerCount; ++producer)
+        {
+            producers.emplace_back([&queue, itemsPerProducer]()
+            {
+                for (uint32 i = 0; i < itemsPerProducer; ++i)
+                    queue.add(i);
+            });
+        }
+
+        uint32 received = 0;
+        uint32 item;
+        while (received < producerCount * itemsPerProducer)
+            if (queue.next(item))
+                ++received;
+
+        for (std::thread& producer : producers)
+            producer.join();
+    }
+
+    state.SetItemsProcessed(state.iterations() * producerCount * itemsPerProducer);
+}
+BENCHMARK(BM_LockedQueueProducers)->Arg(1)->Arg(4)->UseRealTime();
@@ -0,0 +1,75 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Random.h"
+#include "SFMTRand.h"
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <random>
+
+// the raw generator, reading the next number of the SFMT block
+static void BM_SFMTRandomUInt32(benchmark::State& state)
+{
+    std::unique_ptr<SFMTRand> rng = std::make_unique<SFMTRand>(42);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(rng->RandomUInt32());
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SFMTRandomUInt32);
+
+// through the thread local generator of Random.cpp
+static void BM_Rand32(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(rand32());
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Rand32);
+
+static void BM_Urand(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(urand(0, 99));
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Urand);
+
+// proc, crit and loot chances
+static void BM_RollChance(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(roll_chance_f(33.3f));
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RollChance);
+
+// the roll as rand_chance() made it before, two draws per double
+static void BM_RollChanceUniformRealDistribution(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::uniform_real_distribution<double> urd(0.0, 100.0);
+        benchmark::DoNotOptimize(33.3f > urd(RandomEngine::Instance()));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RollChanceUniformRealDistribution);
@@ -0,0 +1,64 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StringFormat.h"
+#include <benchmark/benchmark.h>
+
+static void BM_StringFormatNumbers(benchmark::State& state)
+{
+    uint32 i = 0;
+    for (auto _ : state)
+    {
+        std::string text = Acore::StringFormat("Player {} (guid {}) at {:.2f} {:.2f} {:.2f}", "Benchmark", ++i, 1234.5678f, -987.25f, 45.125f);
+        benchmark::DoNotOptimize(text);
+    }
+}
+BENCHMARK(BM_StringFormatNumbers);
+
+static void BM_StringFormatShort(benchmark::State& state)
+{
+    uint32 i = 0;
+    for (auto _ : state)
+    {
+        std::string text = Acore::StringFormat("{}", ++i);
+        benchmark::DoNotOptimize(text);
+    }
+}
+BENCHMARK(BM_StringFormatShort);
+
+static void BM_StringFormatLong(benchmark::State& state)
+{
+    std::string const name(64, 'a');
+    for (auto _ : state)
+    {
+        std::string text = Acore::StringFormat("{} {} {} {} {} {} {} {}", name, name, name, name, name, name, name, name);
+        benchmark::DoNotOptimize(text);
+    }
+}
+BENCHMARK(BM_StringFormatLong);
+
+static void BM_FormatBufferLong(benchmark::State& state)
+{
+    std::string const name(64, 'a');
+    for (auto _ : state)
+    {
+        Acore::FormatBuffer buffer;
+        std::string_view text = buffer.Format("{} {} {} {} {} {} {} {}", name, name, name, name, name, name, name, name);
+        benchmark::DoNotOptimize(text);
+    }
+}
+BENCHMARK(BM_FormatBufferLong);
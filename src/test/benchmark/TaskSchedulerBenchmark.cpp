@@ -0,0 +1,56 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TaskScheduler.h"
+#include <benchmark/benchmark.h>
+
+static void BM_TaskSchedulerRepeat(benchmark::State& state)
+{
+    uint32 const taskCount = uint32(state.range(0));
+    uint32 executed = 0;
+    TaskScheduler scheduler;
+    for (uint32 i = 0; i < taskCount; ++i)
+    {
+        scheduler.Schedule(Milliseconds(100 + i % 100), [&executed](TaskContext context)
+        {
+            ++executed;
+            context.Repeat();
+        });
+    }
+
+    for (auto _ : state)
+        scheduler.Update(100ms);
+
+    benchmark::DoNotOptimize(executed);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TaskSchedulerRepeat)->Arg(4)->Arg(16)->Arg(64);
+
+static void BM_TaskSchedulerScheduleCancel(benchmark::State& state)
+{
+    TaskScheduler scheduler;
+    for (auto _ : state)
+    {
+        for (uint32 i = 0; i < 32; ++i)
+            scheduler.Schedule(Milliseconds(i * 37 % 1000), i % 4, [](TaskContext) { });
+        scheduler.CancelGroup(1);
+        scheduler.CancelAll();
+    }
+
+    state.SetItemsProcessed(state.iterations() * 32);
+}
+BENCHMARK(BM_TaskSchedulerScheduleCancel);
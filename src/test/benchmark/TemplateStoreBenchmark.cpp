@@ -0,0 +1,83 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ItemTemplate.h"
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // sparse entries up to the highest item id of the client, looked up with a realistic mix of misses
+    constexpr uint32 MaxEntry = 56806;
+
+    struct ItemStores
+    {
+        ItemStores()
+        {
+            std::mt19937 rng(1);
+            std::bernoulli_distribution exists(0.7);
+            for (uint32 entry = 1; entry <= MaxEntry; ++entry)
+                if (exists(rng))
+                    Map[entry].ItemId = entry;
+
+            Fast.resize(MaxEntry + 1, nullptr);
+            for (auto& [entry, itemTemplate] : Map)
+                Fast[entry] = &itemTemplate;
+
+            std::uniform_int_distribution<uint32> entries(1, MaxEntry);
+            Lookups.resize(4096);
+            for (uint32& lookup : Lookups)
+                lookup = entries(rng);
+        }
+
+        ItemTemplateContainer Map;
+        std::vector<ItemTemplate*> Fast;
+        std::vector<uint32> Lookups;
+    };
+
+    ItemStores const& GetStores()
+    {
+        static ItemStores const stores;
+        return stores;
+    }
+}
+
+static void BM_TemplateStoreMapLookup(benchmark::State& state)
+{
+    ItemStores const& stores = GetStores();
+    for (auto _ : state)
+        for (uint32 entry : stores.Lookups)
+        {
+            auto itr = stores.Map.find(entry);
+            benchmark::DoNotOptimize(itr != stores.Map.end() ? &itr->second : nullptr);
+        }
+
+    state.SetItemsProcessed(state.iterations() * stores.Lookups.size());
+}
+BENCHMARK(BM_TemplateStoreMapLookup);
+
+static void BM_TemplateStoreVectorLookup(benchmark::State& state)
+{
+    ItemStores const& stores = GetStores();
+    for (auto _ : state)
+        for (uint32 entry : stores.Lookups)
+            benchmark::DoNotOptimize(entry < stores.Fast.size() ? stores.Fast[entry] : nullptr);
+
+    state.SetItemsProcessed(state.iterations() * stores.Lookups.size());
+}
+BENCHMARK(BM_TemplateStoreVectorLookup);
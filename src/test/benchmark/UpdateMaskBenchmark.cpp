@@ -0,0 +1,141 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "UpdateFieldFlags.h"
+#include "UpdateFields.h"
+#include "UpdateMask.h"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+// the values block of a unit update: the changed fields in the mask, then their values
+static void BM_UpdateMaskValuesBlock(benchmark::State& state)
+{
+    uint32 const valuesCount = UNIT_END;
+    uint32 const changedStep = uint32(state.range(0));
+    std::vector<uint32> values(valuesCount, 0x3F800000u);
+
+    UpdateMask mask;
+    ByteBuffer data;
+    data.reserve(valuesCount * 5);
+    for (auto _ : state)
+    {
+        data.clear();
+        mask.SetCount(valuesCount);
+        for (uint32 index = 0; index < valuesCount; index += changedStep)
+            mask.SetBit(index);
+
+        data << uint8(mask.GetBlockCount());
+        mask.AppendToPacket(&data);
+        for (uint32 index = 0; index < valuesCount; ++index)
+            if (mask.GetBit(index))
+                data << values[index];
+
+        benchmark::DoNotOptimize(data.contents());
+    }
+
+    state.SetItemsProcessed(state.iterations() * valuesCount);
+}
+BENCHMARK(BM_UpdateMaskValuesBlock)->Arg(1)->Arg(8)->Arg(64);
+
+static void BM_UpdateMaskCombine(benchmark::State& state)
+{
+    UpdateMask first, second;
+    first.SetCount(PLAYER_END);
+    second.SetCount(PLAYER_END);
+    for (uint32 index = 0; index < PLAYER_END; index += 7)
+        first.SetBit(index);
+    for (uint32 index = 0; index < PLAYER_END; index += 11)
+        second.SetBit(index);
+
+    for (auto _ : state)
+    {
+        UpdateMask both = first | second;
+        benchmark::DoNotOptimize(both.GetBit(PLAYER_END - 1));
+    }
+}
+BENCHMARK(BM_UpdateMaskCombine);
+
+// the fields of a player values update seen by a party member, scanned field by field
+static void BM_PlayerValuesUpdateFieldScan(benchmark::State& state)
+{
+    uint32 const changedStep = uint32(state.range(0));
+    uint32 const visibleFlag = UF_FLAG_PUBLIC | UF_FLAG_PARTY_MEMBER;
+    std::vector<uint32> values(PLAYER_END, 0x3F800000u);
+
+    UpdateMask changesMask;
+    changesMask.SetCount(PLAYER_END);
+    for (uint32 index = 0; index < PLAYER_END; index += changedStep)
+        changesMask.SetBit(index);
+
+    ByteBuffer data;
+    data.reserve(PLAYER_END * 5);
+    for (auto _ : state)
+    {
+        data.clear();
+        UpdateMask mask;
+        mask.SetCount(PLAYER_END);
+        ByteBuffer fieldBuffer;
+        for (uint32 index = 0; index < PLAYER_END; ++index)
+        {
+            if (changesMask.GetBit(index) && (UnitUpdateFieldFlags[index] & visibleFlag))
+            {
+                mask.SetBit(index);
+                fieldBuffer << values[index];
+            }
+        }
+
+        data << uint8(mask.GetBlockCount());
+        mask.AppendToPacket(&data);
+        data.append(fieldBuffer);
+        benchmark::DoNotOptimize(data.contents());
+    }
+}
+BENCHMARK(BM_PlayerValuesUpdateFieldScan)->Arg(1)->Arg(16)->Arg(256);
+
+// the same update from the visibility mask, visiting only the set bits
+static void BM_PlayerValuesUpdateMask(benchmark::State& state)
+{
+    uint32 const changedStep = uint32(state.range(0));
+    uint32 const visibleFlag = UF_FLAG_PUBLIC | UF_FLAG_PARTY_MEMBER;
+    std::vector<uint32> values(PLAYER_END, 0x3F800000u);
+
+    UpdateMask changesMask;
+    changesMask.SetCount(PLAYER_END);
+    for (uint32 index = 0; index < PLAYER_END; index += changedStep)
+        changesMask.SetBit(index);
+
+    ByteBuffer data;
+    data.reserve(PLAYER_END * 5);
+    for (auto _ : state)
+    {
+        data.clear();
+        UpdateMask mask;
+        BuildUpdateFieldFlagMask(UnitUpdateFieldFlags, PLAYER_END, visibleFlag, mask);
+        mask &= changesMask;
+        ByteBuffer fieldBuffer;
+        mask.ForEachSetBit([&](uint32 index)
+        {
+            fieldBuffer << values[index];
+        });
+
+        data << uint8(mask.GetBlockCount());
+        mask.AppendToPacket(&data);
+        data.append(fieldBuffer);
+        benchmark::DoNotOptimize(data.contents());
+    }
+}
+BENCHMARK(BM_PlayerValuesUpdateMask)->Arg(1)->Arg(16)->Arg(256);
@@ -0,0 +1,203 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DynamicBoundingVolumeHierarchy.h"
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <random>
+#include <set>
+
+namespace
+{
+    struct TestModel
+    {
+        G3D::AABox Bounds;
+    };
+
+    struct TestModelBounds
+    {
+        static void GetBounds(TestModel const& model, G3D::AABox& out) { out = model.Bounds; }
+    };
+
+    typedef DynamicBVH<TestModel, TestModelBounds> TestTree;
+
+    std::vector<TestModel> MakeModels(std::size_t count, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+        std::uniform_real_distribution<float> size(0.5f, 20.0f);
+        std::vector<TestModel> models(count);
+        for (TestModel& model : models)
+        {
+            G3D::Vector3 low(position(rng), position(rng), position(rng) / 10.0f);
+            model.Bounds = G3D::AABox(low, low + G3D::Vector3(size(rng), size(rng), size(rng)));
+        }
+
+        return models;
+    }
+
+    struct BoxCollector
+    {
+        void operator()(TestModel const& model) { Found.insert(&model); }
+
+        std::set<TestModel const*> Found;
+    };
+
+    struct PointCollector
+    {
+        void operator()(G3D::Vector3 const& /*point*/, TestModel const& model) { Found.insert(&model); }
+
+        std::set<TestModel const*> Found;
+    };
+
+    // hits the boxes themselves, like a model filling its whole bounds
+    struct RayCollector
+    {
+        bool operator()(G3D::Ray const& ray, TestModel const& model, float& maxDist, bool /*stopAtFirstHit*/)
+        {
+            float distance = ray.intersectionTime(model.Bounds);
+            if (distance > maxDist)
+                return false;
+
+            maxDist = distance;
+            ++Hits;
+            return true;
+        }
+
+        uint32 Hits = 0;
+    };
+
+    float GetNearestHit(std::vector<TestModel> const& models, std::set<TestModel const*> const& removed, G3D::Ray const& ray, float maxDist)
+    {
+        for (TestModel const& model : models)
+            if (!removed.count(&model))
+                maxDist = std::min(maxDist, ray.intersectionTime(model.Bounds));
+
+        return maxDist;
+    }
+
+    void CheckQueries(TestTree const& tree, std::vector<TestModel> const& models, std::set<TestModel const*> const& removed, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> position(-500.0f, 500.0f);
+        for (uint32 i = 0; i < 50; ++i)
+        {
+            G3D::Vector3 low(position(rng), position(rng), -50.0f);
+            G3D::AABox box(low, low + G3D::Vector3(60.0f, 60.0f, 100.0f));
+            G3D::Vector3 point(position(rng), position(rng), position(rng) / 10.0f);
+
+            std::set<TestModel const*> inBox, atPoint;
+            for (TestModel const& model : models)
+            {
+                if (removed.count(&model))
+                    continue;
+
+                if (model.Bounds.intersects(box))
+                    inBox.insert(&model);
+                if (model.Bounds.contains(point))
+                    atPoint.insert(&model);
+            }
+
+            BoxCollector boxCollector;
+            tree.intersectBox(box, boxCollector);
+            EXPECT_EQ(boxCollector.Found, inBox);
+
+            PointCollector pointCollector;
+            tree.intersectPoint(point, pointCollector);
+            EXPECT_EQ(pointCollector.Found, atPoint);
+
+            G3D::Vector3 end(position(rng), position(rng), position(rng) / 10.0f);
+            G3D::Ray ray(point, (end - point).direction());
+            float const length = (end - point).magnitude();
+            float maxDist = length;
+            RayCollector rayCollector;
+            tree.intersectRay(ray, rayCollector, maxDist, false);
+            EXPECT_FLOAT_EQ(maxDist, GetNearestHit(models, removed, ray, length));
+        }
+    }
+}
+
+TEST(DynamicBVHTest, QueriesMatchBruteForceWhileMembersChange)
+{
+    std::mt19937 rng(42);
+    std::vector<TestModel> models = MakeModels(500, rng);
+    std::set<TestModel const*> removed;
+
+    TestTree tree;
+    for (TestModel const& model : models)
+        tree.insert(model);
+
+    EXPECT_EQ(tree.size(), models.size());
+    CheckQueries(tree, models, removed, rng);
+
+    // remove every third model, then move a few of the others
+    for (std::size_t i = 0; i < models.size(); i += 3)
+    {
+        tree.remove(models[i]);
+        removed.insert(&models[i]);
+    }
+
+    for (std::size_t i = 1; i < models.size(); i += 7)
+    {
+        if (removed.count(&models[i]))
+            continue;
+
+        tree.remove(models[i]);
+        models[i].Bounds = G3D::AABox(models[i].Bounds.low() + G3D::Vector3(30.0f, -30.0f, 0.0f), models[i].Bounds.high() + G3D::Vector3(30.0f, -30.0f, 0.0f));
+        tree.insert(models[i]);
+    }
+
+    EXPECT_EQ(tree.size(), models.size() - removed.size());
+    EXPECT_FALSE(tree.contains(models[0]));
+    EXPECT_TRUE(tree.contains(models[1]));
+    CheckQueries(tree, models, removed, rng);
+
+    tree.balance();
+    CheckQueries(tree, models, removed, rng);
+}
+
+TEST(DynamicBVHTest, StaysBalancedWithoutRebuild)
+{
+    std::mt19937 rng(7);
+    std::vector<TestModel> models = MakeModels(4096, rng);
+
+    // sorted insertions are the worst case of unbalanced trees
+    std::sort(models.begin(), models.end(), [](TestModel const& left, TestModel const& right) { return left.Bounds.low().x < right.Bounds.low().x; });
+
+    TestTree tree;
+    for (TestModel const& model : models)
+        tree.insert(model);
+
+    EXPECT_LE(tree.height(), 2 * 12);
+}
+
+TEST(DynamicBVHTest, StopsAtFirstHit)
+{
+    std::vector<TestModel> models(3);
+    for (std::size_t i = 0; i < models.size(); ++i)
+        models[i].Bounds = G3D::AABox(G3D::Vector3(10.0f * (i + 1), -1.0f, -1.0f), G3D::Vector3(10.0f * (i + 1) + 1.0f, 1.0f, 1.0f));
+
+    TestTree tree;
+    for (TestModel const& model : models)
+        tree.insert(model);
+
+    G3D::Ray ray(G3D::Vector3(0.0f, 0.0f, 0.0f), G3D::Vector3(1.0f, 0.0f, 0.0f));
+    float maxDist = 100.0f;
+    RayCollector rayCollector;
+    tree.intersectRay(ray, rayCollector, maxDist, true);
+    EXPECT_EQ(rayCollector.Hits, 1u);
+    EXPECT_FLOAT_EQ(maxDist, 10.0f);
+}
@@ -0,0 +1,77 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ConfigValueCache.h"
+#include "gtest/gtest.h"
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+
+namespace
+{
+    class ConfigOptionRegistryTest : public testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            _confFilePath = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("deleteme.ini")).string();
+
+            std::ofstream iniStream(_confFilePath);
+            iniStream << "[test]\n";
+            iniStream << "Registry.Enabled = 1\n";
+            iniStream << "Registry.Limit = 42\n";
+            iniStream << "Registry.Name = loaded\n";
+            iniStream.close();
+
+            sConfigMgr->Configure(_confFilePath, std::vector<std::string>());
+            sConfigMgr->LoadAppConfigs();
+        }
+
+        void TearDown() override
+        {
+            std::remove(_confFilePath.c_str());
+        }
+
+        std::string _confFilePath;
+    };
+}
+
+TEST_F(ConfigOptionRegistryTest, InternsNamesAndLoadsValues)
+{
+    ConfigOption<bool> const enabled("Registry.Enabled", false);
+    ConfigOption<uint32> const limit("Registry.Limit", 10);
+
+    EXPECT_EQ(sConfigOptions->Register<uint32>("Registry.Limit", 10), sConfigOptions->Register<uint32>("Registry.Limit", 20));
+
+    uint32 const generation = sConfigOptions->GetGeneration();
+    sConfigOptions->Load();
+    EXPECT_EQ(sConfigOptions->GetGeneration(), generation + 1);
+
+    EXPECT_TRUE(enabled.Get());
+    EXPECT_EQ(limit.Get(), 42u);
+}
+
+TEST_F(ConfigOptionRegistryTest, OptionsRegisteredAfterLoadAreReadRightAway)
+{
+    sConfigOptions->Load();
+
+    ConfigOption<std::string> const name("Registry.Name", "default");
+    ConfigOption<float> const missing("Registry.Missing", 1.5f);
+
+    EXPECT_EQ(name.Get(), "loaded");
+    EXPECT_EQ(missing.Get(), 1.5f);
+}
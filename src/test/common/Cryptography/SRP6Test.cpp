@@ -0,0 +1,77 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AuthCrypt.h"
+#include "OpenSSLCrypto.h"
+#include "SRP6.h"
+#include "gtest/gtest.h"
+#include <cstring>
+
+using Acore::Crypto::SRP6;
+
+TEST(SRP6Test, ClientProofIsAcceptedByTheServer)
+{
+    auto [salt, verifier] = SRP6::MakeRegistrationData("TESTER", "SECRET");
+    SRP6 server("TESTER", salt, verifier);
+
+    std::optional<SRP6::ClientProof> proof = SRP6::MakeClientProof("TESTER", "SECRET", server.s, server.B);
+    ASSERT_TRUE(proof);
+
+    std::optional<SessionKey> K = server.VerifyChallengeResponse(proof->A, proof->M);
+    ASSERT_TRUE(K);
+    EXPECT_EQ(*K, proof->K);
+}
+
+TEST(SRP6Test, WrongPasswordIsRejected)
+{
+    auto [salt, verifier] = SRP6::MakeRegistrationData("TESTER", "SECRET");
+    SRP6 server("TESTER", salt, verifier);
+
+    std::optional<SRP6::ClientProof> proof = SRP6::MakeClientProof("TESTER", "WRONG", server.s, server.B);
+    ASSERT_TRUE(proof);
+    EXPECT_FALSE(server.VerifyChallengeResponse(proof->A, proof->M));
+}
+
+TEST(SRP6Test, ClientAndServerCryptMatch)
+{
+    SessionKey K;
+    for (std::size_t i = 0; i < K.size(); ++i)
+        K[i] = uint8(i * 7);
+
+    // ARC4 lives in the legacy provider of OpenSSL 3
+    OpenSSLCrypto::threadsSetup();
+
+    {
+        AuthCrypt server, client;
+        server.Init(K);
+        client.InitClient(K);
+
+        uint8 const header[6] = { 0x00, 0x04, 0xDC, 0x01, 0x00, 0x00 };
+        uint8 data[6];
+        std::memcpy(data, header, sizeof(data));
+        client.EncryptSend(data, sizeof(data));
+        EXPECT_NE(std::memcmp(data, header, sizeof(data)), 0);
+        server.DecryptRecv(data, sizeof(data));
+        EXPECT_EQ(std::memcmp(data, header, sizeof(data)), 0);
+
+        server.EncryptSend(data, 4);
+        client.DecryptRecv(data, 4);
+        EXPECT_EQ(std::memcmp(data, header, 4), 0);
+    }
+
+    OpenSSLCrypto::threadsCleanup();
+}
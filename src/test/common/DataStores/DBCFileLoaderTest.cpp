@@ -0,0 +1,127 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DBCFileLoader.h"
+#include "gtest/gtest.h"
+
+#include <boost/filesystem.hpp>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+namespace
+{
+    // WDBC file with records of three 4 byte fields and the given string table
+    std::string WriteDBC(std::vector<std::vector<uint32>> const& records, std::string const& strings)
+    {
+        std::string const fileName = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%.dbc")).string();
+        std::ofstream file(fileName, std::ios::binary);
+        uint32 const header[5] = { 0x43424457, uint32(records.size()), 3, 12, uint32(strings.size()) };
+        file.write(reinterpret_cast<char const*>(header), sizeof(header));
+        for (std::vector<uint32> const& record : records)
+            file.write(reinterpret_cast<char const*>(record.data()), record.size() * sizeof(uint32));
+
+        file.write(strings.data(), strings.size());
+        return fileName;
+    }
+
+    // packed like the structures of DBCStructure.h
+#pragma pack(push, 1)
+    struct ScalarEntry
+    {
+        uint32 ID;
+        float Value;
+        uint32 Flags;
+    };
+
+    struct StringEntry
+    {
+        uint32 ID;
+        char const* Name;
+    };
+#pragma pack(pop)
+}
+
+TEST(DBCFileLoaderTest, ScalarRecordsAreUsedInPlace)
+{
+    float const value = 1.5f;
+    uint32 valueBits;
+    memcpy(&valueBits, &value, sizeof(value));
+    std::string const fileName = WriteDBC({ { 3, valueBits, 7 }, { 1, valueBits, 9 } }, std::string(1, '\0'));
+
+    DBCFileLoader dbc;
+    ASSERT_TRUE(dbc.Load(fileName.c_str(), "nfi"));
+
+    uint32 records = 0;
+    char** indexTable = nullptr;
+    char* dataTable = dbc.AutoProduceDataInPlace("nfi", records, indexTable);
+    ASSERT_NE(dataTable, nullptr);
+    EXPECT_EQ(records, 4u);
+    EXPECT_EQ(indexTable[0], nullptr);
+    EXPECT_EQ(indexTable[3], dataTable);
+
+    ScalarEntry const* entry = reinterpret_cast<ScalarEntry const*>(indexTable[1]);
+    EXPECT_EQ(entry->ID, 1u);
+    EXPECT_EQ(entry->Value, value);
+    EXPECT_EQ(entry->Flags, 9u);
+
+    // skipped fields don't match the layout of the structure
+    delete[] indexTable;
+    EXPECT_EQ(dbc.AutoProduceDataInPlace("nxi", records, indexTable), nullptr);
+
+    boost::filesystem::remove(fileName);
+}
+
+TEST(DBCFileLoaderTest, StringsPointIntoTheMapping)
+{
+    std::string const strings("\0Stormwind\0", 11);
+    std::string const fileName = WriteDBC({ { 1, 1, 0 }, { 2, 0, 0 } }, strings);
+
+    DBCFileLoader dbc;
+    ASSERT_TRUE(dbc.Load(fileName.c_str(), "nsx"));
+
+    uint32 records = 0;
+    char** indexTable = nullptr;
+    EXPECT_EQ(dbc.AutoProduceDataInPlace("nsx", records, indexTable), nullptr);
+    char* dataTable = dbc.AutoProduceData("nsx", records, indexTable);
+    ASSERT_NE(dataTable, nullptr);
+    EXPECT_TRUE(dbc.AutoProduceStrings("nsx", dataTable));
+
+    std::shared_ptr<DBCFileMapping> mapping = dbc.GetMapping();
+    StringEntry const* first = reinterpret_cast<StringEntry const*>(indexTable[1]);
+    StringEntry const* second = reinterpret_cast<StringEntry const*>(indexTable[2]);
+    EXPECT_STREQ(first->Name, "Stormwind");
+    EXPECT_STREQ(second->Name, "");
+    EXPECT_GE(reinterpret_cast<unsigned char const*>(first->Name), mapping->GetData());
+    EXPECT_LT(reinterpret_cast<unsigned char const*>(first->Name), mapping->GetData() + mapping->GetSize());
+
+    delete[] indexTable;
+    delete[] dataTable;
+    boost::filesystem::remove(fileName);
+}
+
+TEST(DBCFileLoaderTest, TruncatedFilesAreRejected)
+{
+    std::string const fileName = WriteDBC({ { 1, 0, 0 } }, "");
+    boost::filesystem::resize_file(fileName, 20 + 8);
+
+    DBCFileLoader dbc;
+    EXPECT_FALSE(dbc.Load(fileName.c_str(), "nii"));
+    EXPECT_FALSE(dbc.IsLoaded());
+
+    boost::filesystem::remove(fileName);
+}
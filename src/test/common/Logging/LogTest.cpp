@@ -0,0 +1,94 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "Config.h"
+#include "Log.h"
+#include "gtest/gtest.h"
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <string>
+
+namespace
+{
+    std::string CreateLogConfig()
+    {
+        auto path = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("deleteme.ini");
+        std::ofstream iniStream(path.c_str());
+        iniStream << "[test]\n";
+        iniStream << "Appender.Console = 1,6,0\n";
+        iniStream << "Logger.root = 2,Console\n";
+        iniStream << "Logger.entities = 4,Console\n";
+        iniStream.close();
+        return path.string();
+    }
+
+    bool ShouldLogAtSite(LogCallSite& site, LogLevel level)
+    {
+        return sLog->ShouldLog(site, "entities.unit", level);
+    }
+}
+
+class LogTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        confFilePath = CreateLogConfig();
+        sConfigMgr->Configure(confFilePath, std::vector<std::string>());
+        sConfigMgr->LoadAppConfigs();
+        sLog->LoadFromConfig();
+    }
+
+    void TearDown() override
+    {
+        sLog->Close();
+        std::remove(confFilePath.c_str());
+    }
+
+    std::string confFilePath;
+};
+
+TEST_F(LogTest, CallSiteResolvesTheParentLogger)
+{
+    LogCallSite site;
+    EXPECT_TRUE(ShouldLogAtSite(site, LOG_LEVEL_INFO));
+    EXPECT_FALSE(ShouldLogAtSite(site, LOG_LEVEL_DEBUG));
+    EXPECT_EQ(ShouldLogAtSite(site, LOG_LEVEL_INFO), sLog->ShouldLog("entities.unit", LOG_LEVEL_INFO));
+}
+
+TEST_F(LogTest, CallSiteFollowsLevelChanges)
+{
+    LogCallSite site;
+    EXPECT_FALSE(ShouldLogAtSite(site, LOG_LEVEL_DEBUG));
+
+    ASSERT_TRUE(sLog->SetLogLevel("entities", LOG_LEVEL_DEBUG));
+    EXPECT_TRUE(ShouldLogAtSite(site, LOG_LEVEL_DEBUG));
+
+    ASSERT_TRUE(sLog->SetLogLevel("entities", LOG_LEVEL_DISABLED));
+    EXPECT_FALSE(ShouldLogAtSite(site, LOG_LEVEL_FATAL));
+}
+
+TEST_F(LogTest, CallSiteIsResolvedAgainAfterReload)
+{
+    LogCallSite site;
+    EXPECT_TRUE(ShouldLogAtSite(site, LOG_LEVEL_INFO));
+
+    sLog->Close();
+    EXPECT_FALSE(ShouldLogAtSite(site, LOG_LEVEL_INFO));
+}
@@ -0,0 +1,55 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MetricRegistry.h"
+#include "gtest/gtest.h"
+
+TEST(MetricRegistryTest, RendersCountersAndGauges)
+{
+    sMetricRegistry->GetCounter("test_packets_total", "Packets handled", { { "opcode", "CMSG_PING" } }).Add(3);
+    sMetricRegistry->GetGauge("test_players", "Online players").Set(-2);
+
+    // registering again returns the same series
+    MetricCounter& counter = sMetricRegistry->GetCounter("test_packets_total", "Packets handled", { { "opcode", "CMSG_PING" } });
+    counter.Add();
+    EXPECT_EQ(counter.Get(), 4u);
+
+    std::string const text = sMetricRegistry->Render();
+    EXPECT_NE(text.find("# TYPE test_packets_total counter\n"), std::string::npos);
+    EXPECT_NE(text.find("test_packets_total{opcode=\"CMSG_PING\"} 4\n"), std::string::npos);
+    EXPECT_NE(text.find("# TYPE test_players gauge\ntest_players -2\n"), std::string::npos);
+}
+
+TEST(MetricRegistryTest, RendersCumulativeHistogramBuckets)
+{
+    MetricHistogram& histogram = sMetricRegistry->GetHistogram("test_diff", "Update diff", { 10, 50 }, { { "map", "0" } });
+    histogram.Observe(5);
+    histogram.Observe(10);
+    histogram.Observe(30);
+    histogram.Observe(500);
+
+    EXPECT_EQ(histogram.GetBucketCount(0), 2u);
+    EXPECT_EQ(histogram.GetBucketCount(1), 1u);
+    EXPECT_EQ(histogram.GetBucketCount(2), 1u);
+
+    std::string const text = sMetricRegistry->Render();
+    EXPECT_NE(text.find("test_diff_bucket{map=\"0\",le=\"10\"} 2\n"), std::string::npos);
+    EXPECT_NE(text.find("test_diff_bucket{map=\"0\",le=\"50\"} 3\n"), std::string::npos);
+    EXPECT_NE(text.find("test_diff_bucket{map=\"0\",le=\"+Inf\"} 4\n"), std::string::npos);
+    EXPECT_NE(text.find("test_diff_sum{map=\"0\"} 545\n"), std::string::npos);
+    EXPECT_NE(text.find("test_diff_count{map=\"0\"} 4\n"), std::string::npos);
+}
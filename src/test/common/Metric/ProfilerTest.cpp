@@ -0,0 +1,104 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Profiler.h"
+#include "gtest/gtest.h"
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+    std::string ReadCapture(std::string const& fileName)
+    {
+        std::ifstream in(fileName);
+        std::stringstream content;
+        content << in.rdbuf();
+        return content.str();
+    }
+}
+
+class ProfilerTest : public testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        fileName = (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("profile-%%%%.json")).string();
+    }
+
+    void TearDown() override
+    {
+        std::remove(fileName.c_str());
+    }
+
+    std::string fileName;
+};
+
+TEST_F(ProfilerTest, ZonesAreOnlyRecordedDuringACapture)
+{
+    {
+        PROFILER_ZONE("BeforeCapture");
+    }
+
+    ASSERT_TRUE(sProfiler->Start(0ms, fileName));
+    EXPECT_FALSE(sProfiler->Start(0ms, fileName));
+
+    {
+        PROFILER_ZONE("Outer");
+        PROFILER_ZONE_ARG("Inner", 571);
+    }
+
+    std::thread other([]()
+    {
+        PROFILER_ZONE("OtherThread");
+    });
+    other.join();
+
+    sProfiler->Update();
+    EXPECT_FALSE(sProfiler->IsCapturing());
+
+    {
+        PROFILER_ZONE("AfterCapture");
+    }
+
+    std::string capture = ReadCapture(fileName);
+    EXPECT_NE(capture.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(capture.find("\"name\":\"Outer\""), std::string::npos);
+    EXPECT_NE(capture.find("\"args\":{\"id\":571}"), std::string::npos);
+    EXPECT_NE(capture.find("\"name\":\"OtherThread\""), std::string::npos);
+    EXPECT_EQ(capture.find("BeforeCapture"), std::string::npos);
+    EXPECT_EQ(capture.find("AfterCapture"), std::string::npos);
+}
+
+TEST_F(ProfilerTest, CaptureIsWrittenOnceItsDurationElapsed)
+{
+    ASSERT_TRUE(sProfiler->Start(1h, fileName));
+
+    {
+        PROFILER_ZONE("Pending");
+    }
+
+    sProfiler->Update();
+    EXPECT_TRUE(sProfiler->IsCapturing());
+    EXPECT_FALSE(boost::filesystem::exists(fileName));
+
+    EXPECT_TRUE(sProfiler->Stop());
+    EXPECT_FALSE(sProfiler->Stop());
+    EXPECT_NE(ReadCapture(fileName).find("\"name\":\"Pending\""), std::string::npos);
+}
@@ -0,0 +1,52 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AllocatorStats.h"
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <vector>
+
+using Acore::AllocatorStats;
+
+TEST(AllocatorStatsTest, ReportsTheProcessResidentMemory)
+{
+    AllocatorStats::Stats stats;
+    AllocatorStats::GetStats(stats);
+
+    EXPECT_GT(stats.ProcessResident, 0u);
+    EXPECT_NE(AllocatorStats::GetAllocatorName(), nullptr);
+}
+
+TEST(AllocatorStatsTest, AllocatedGrowsWithLiveBlocks)
+{
+    AllocatorStats::Stats before;
+    if (!AllocatorStats::GetStats(before))
+        GTEST_SKIP() << "the " << AllocatorStats::GetAllocatorName() << " allocator reports no statistics";
+
+    std::vector<std::unique_ptr<char[]>> blocks;
+    for (uint32 i = 0; i < 64; ++i)
+        blocks.emplace_back(new char[64 * 1024]);
+
+    AllocatorStats::Stats after;
+    ASSERT_TRUE(AllocatorStats::GetStats(after));
+    EXPECT_GE(after.Allocated, before.Allocated + 64 * 64 * 1024 / 2);
+    EXPECT_GE(after.GetFragmentation(), 0.0f);
+
+    blocks.clear();
+    AllocatorStats::Purge();
+}
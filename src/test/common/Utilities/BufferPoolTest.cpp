@@ -0,0 +1,99 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BufferPool.h"
+#include "MessageBuffer.h"
+#include "gtest/gtest.h"
+
+#include <thread>
+#include <vector>
+
+using Acore::BufferPool;
+
+TEST(BufferPoolTest, ReusesFreedBlocksOfTheSameSizeClass)
+{
+    BufferPool::Stats const before = BufferPool::GetStats(2);
+
+    void* first = BufferPool::Allocate(200);
+    EXPECT_EQ(BufferPool::GetStats(2).Active, before.Active + 1);
+    BufferPool::Deallocate(first, 200);
+
+    // 129 to 256 bytes share the 256 bytes class
+    void* second = BufferPool::Allocate(256);
+    EXPECT_EQ(second, first);
+    BufferPool::Deallocate(second, 256);
+
+    BufferPool::Stats const after = BufferPool::GetStats(2);
+    EXPECT_EQ(after.Allocations, before.Allocations + 2);
+    EXPECT_EQ(after.Active, before.Active);
+}
+
+TEST(BufferPoolTest, LargeRequestsUseTheHeap)
+{
+    BufferPool::Stats const before = BufferPool::GetStats(BufferPool::SizeClassCount - 1);
+
+    void* block = BufferPool::Allocate(BufferPool::MaxBlockSize + 1);
+    BufferPool::Deallocate(block, BufferPool::MaxBlockSize + 1);
+
+    EXPECT_EQ(BufferPool::GetStats(BufferPool::SizeClassCount - 1).Allocations, before.Allocations);
+}
+
+TEST(BufferPoolTest, CrossThreadBlocksComeBackThroughTheDepot)
+{
+    std::size_t const sizeClass = 4;
+    std::size_t const size = BufferPool::GetBlockSize(sizeClass);
+
+    // allocated by a "network" thread, freed by this one
+    std::vector<void*> blocks;
+    std::thread producer([&]()
+    {
+        for (uint32 i = 0; i < 1000; ++i)
+            blocks.push_back(BufferPool::Allocate(size));
+    });
+    producer.join();
+
+    for (void* block : blocks)
+        BufferPool::Deallocate(block, size);
+
+    BufferPool::Stats const before = BufferPool::GetStats(sizeClass);
+    EXPECT_GT(before.Cached, 0u);
+
+    // a new producer finds the blocks in the depot
+    std::thread consumer([&]()
+    {
+        for (uint32 i = 0; i < 32; ++i)
+            blocks[i] = BufferPool::Allocate(size);
+
+        for (uint32 i = 0; i < 32; ++i)
+            BufferPool::Deallocate(blocks[i], size);
+    });
+    consumer.join();
+
+    EXPECT_EQ(BufferPool::GetStats(sizeClass).HeapAllocations, before.HeapAllocations);
+}
+
+TEST(BufferPoolTest, MessageBufferStorageMovesIntoByteStorage)
+{
+    MessageBuffer buffer(100);
+    uint8 const data[4] = { 1, 2, 3, 4 };
+    buffer.Write(data, sizeof(data));
+
+    uint8 const* storage = buffer.GetBasePointer();
+    Acore::ByteStorage moved = buffer.Move();
+    EXPECT_EQ(moved.data(), storage);
+    EXPECT_EQ(moved[3], 4);
+}
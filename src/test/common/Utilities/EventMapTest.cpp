@@ -0,0 +1,106 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EventMap.h"
+#include "gtest/gtest.h"
+
+TEST(EventMapTest, ExecutesInTimeThenScheduleOrder)
+{
+    EventMap events;
+    events.ScheduleEvent(1, 200ms);
+    events.ScheduleEvent(2, 100ms);
+    events.ScheduleEvent(3, 100ms);
+    events.ScheduleEvent(4, 300ms);
+
+    events.Update(100);
+    EXPECT_EQ(events.ExecuteEvent(), 2);
+    EXPECT_EQ(events.ExecuteEvent(), 3);
+    EXPECT_EQ(events.ExecuteEvent(), 0);
+
+    events.Update(200);
+    EXPECT_EQ(events.ExecuteEvent(), 1);
+    EXPECT_EQ(events.ExecuteEvent(), 4);
+    EXPECT_TRUE(events.Empty());
+}
+
+TEST(EventMapTest, RepeatAndReschedule)
+{
+    EventMap events;
+    events.ScheduleEvent(1, 100ms);
+    events.ScheduleEvent(2, 150ms);
+
+    events.Update(100);
+    EXPECT_EQ(events.ExecuteEvent(), 1);
+    events.Repeat(50ms);
+
+    // both due at 150ms, the repeated one was scheduled last
+    events.Update(50);
+    EXPECT_EQ(events.ExecuteEvent(), 2);
+    EXPECT_EQ(events.ExecuteEvent(), 1);
+
+    events.ScheduleEvent(3, 100ms);
+    events.RescheduleEvent(3, 20ms);
+    EXPECT_EQ(events.GetTimeUntilEvent(3), 20ms);
+    events.CancelEvent(3);
+    EXPECT_FALSE(events.HasTimeUntilEvent(3));
+    EXPECT_TRUE(events.Empty());
+}
+
+TEST(EventMapTest, Phases)
+{
+    EventMap events;
+    events.SetPhase(1);
+    events.ScheduleEvent(1, 10ms, 0, 2);
+    events.ScheduleEvent(2, 10ms, 0, 1);
+
+    events.Update(10);
+    // event 1 is not in the current phase and gets dropped
+    EXPECT_EQ(events.ExecuteEvent(), 2);
+    EXPECT_TRUE(events.Empty());
+}
+
+TEST(EventMapTest, Groups)
+{
+    EventMap events;
+    events.ScheduleEvent(1, 100ms, 1);
+    events.ScheduleEvent(2, 100ms, 2);
+    events.ScheduleEvent(3, 200ms, 1);
+
+    events.DelayEvents(100ms, 1);
+    EXPECT_EQ(events.GetTimeUntilEvent(1), 200ms);
+    EXPECT_EQ(events.GetTimeUntilEvent(2), 100ms);
+    EXPECT_EQ(events.GetTimeUntilEvent(3), 300ms);
+
+    events.DelayEvents(50ms);
+    EXPECT_EQ(events.GetTimeUntilEvent(2), 150ms);
+
+    events.DelayEventsToMax(400ms, 1);
+    EXPECT_EQ(events.GetTimeUntilEvent(1), 400ms);
+    EXPECT_EQ(events.GetTimeUntilEvent(3), 400ms);
+
+    // both moved to the same time, in their previous order
+    events.Update(400);
+    EXPECT_EQ(events.ExecuteEvent(), 2);
+    EXPECT_EQ(events.ExecuteEvent(), 1);
+    EXPECT_EQ(events.ExecuteEvent(), 3);
+
+    events.ScheduleEvent(4, 10ms, 2);
+    events.ScheduleEvent(5, 10ms, 1);
+    events.CancelEventGroup(2);
+    EXPECT_FALSE(events.HasTimeUntilEvent(4));
+    EXPECT_TRUE(events.HasTimeUntilEvent(5));
+}
@@ -0,0 +1,161 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EventProcessor.h"
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+    class RecordingEvent : public BasicEvent
+    {
+    public:
+        RecordingEvent(std::vector<uint32>& executed, std::vector<uint32>& aborted, uint32 id) : _executed(executed), _aborted(aborted), _id(id) { }
+
+        bool Execute(uint64, uint32) override
+        {
+            _executed.push_back(_id);
+            return true;
+        }
+
+        void Abort(uint64) override { _aborted.push_back(_id); }
+
+    private:
+        std::vector<uint32>& _executed;
+        std::vector<uint32>& _aborted;
+        uint32 _id;
+    };
+}
+
+TEST(EventProcessorTest, ExecutesInTimeThenAddOrder)
+{
+    std::vector<uint32> executed, aborted;
+    EventProcessor events;
+    events.AddEventAtOffset(new RecordingEvent(executed, aborted, 1), 20ms);
+    events.AddEventAtOffset(new RecordingEvent(executed, aborted, 2), 10ms);
+    events.AddEventAtOffset(new RecordingEvent(executed, aborted, 3), 10ms);
+    events.AddEventAtOffset(new RecordingEvent(executed, aborted, 4), 30ms);
+
+    events.Update(10);
+    EXPECT_EQ(executed, (std::vector<uint32>{ 2, 3 }));
+
+    events.Update(20);
+    EXPECT_EQ(executed, (std::vector<uint32>{ 2, 3, 1, 4 }));
+    EXPECT_FALSE(events.HasEvents());
+}
+
+TEST(EventProcessorTest, ModifyEventTime)
+{
+    std::vector<uint32> executed, aborted;
+    EventProcessor events;
+    BasicEvent* late = new RecordingEvent(executed, aborted, 1);
+    events.AddEventAtOffset(late, 100ms);
+    events.AddEventAtOffset(new RecordingEvent(executed, aborted, 2), 50ms);
+
+    events.ModifyEventTime(late, 50ms);
+    events.Update(50);
+    EXPECT_EQ(executed, (std::vector<uint32>{ 2, 1 }));
+}
+
+TEST(EventProcessorTest, CancelAndKill)
+{
+    std::vector<uint32> executed, aborted;
+    EventProcessor events;
+    events.AddEventAtOffset(new RecordingEvent(executed, aborted, 1), 10ms, 1);
+    events.AddEventAtOffset(new RecordingEvent(executed, aborted, 2), 20ms, 2);
+    events.AddEventAtOffset(new RecordingEvent(executed, aborted, 3), 5ms, 1);
+    events.AddEventAtOffset(new RecordingEvent(executed, aborted, 4), 30ms);
+
+    events.CancelEventGroup(1);
+    EXPECT_EQ(aborted, (std::vector<uint32>{ 3, 1 }));
+
+    events.Update(20);
+    EXPECT_EQ(executed, (std::vector<uint32>{ 2 }));
+
+    events.KillAllEvents(false);
+    EXPECT_EQ(aborted, (std::vector<uint32>{ 3, 1, 4 }));
+    EXPECT_FALSE(events.HasEvents());
+}
+
+TEST(EventProcessorTest, ScheduledAbort)
+{
+    std::vector<uint32> executed, aborted;
+    EventProcessor events;
+    BasicEvent* event = new RecordingEvent(executed, aborted, 1);
+    events.AddEventAtOffset(event, 10ms);
+    event->ScheduleAbort();
+
+    events.Update(10);
+    EXPECT_TRUE(executed.empty());
+    EXPECT_EQ(aborted, (std::vector<uint32>{ 1 }));
+    EXPECT_FALSE(events.HasEvents());
+}
+
+// Run manually with --gtest_also_run_disabled_tests to compare the event queue with the std::multimap it replaced
+TEST(EventProcessorTest, DISABLED_QueueBenchmark)
+{
+    constexpr uint32 Units = 2000;
+    constexpr uint32 EventsPerUnit = 8;
+    constexpr uint32 Ticks = 2000;
+
+    auto run = [&](auto push, auto popDue)
+    {
+        std::mt19937 random(42);
+        auto const start = std::chrono::steady_clock::now();
+        for (uint32 tick = 1; tick <= Ticks; ++tick)
+            for (uint32 unit = 0; unit < Units; ++unit)
+                while (popDue(unit, tick))
+                    push(unit, tick + 1 + random() % 50);
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    std::vector<Acore::TimerHeap<uint64, uint32>> heaps(Units);
+    std::vector<std::multimap<uint64, uint32>> maps(Units);
+    for (uint32 unit = 0; unit < Units; ++unit)
+    {
+        for (uint32 i = 0; i < EventsPerUnit; ++i)
+        {
+            heaps[unit].push(1 + i, i);
+            maps[unit].emplace(1 + i, i);
+        }
+    }
+
+    auto heapTime = run([&](uint32 unit, uint64 time) { heaps[unit].push(time, 0); },
+        [&](uint32 unit, uint64 time)
+        {
+            if (heaps[unit].empty() || heaps[unit].top().DueTime > time)
+                return false;
+            heaps[unit].pop();
+            return true;
+        });
+
+    auto mapTime = run([&](uint32 unit, uint64 time) { maps[unit].emplace(time, 0); },
+        [&](uint32 unit, uint64 time)
+        {
+            if (maps[unit].empty() || maps[unit].begin()->first > time)
+                return false;
+            maps[unit].erase(maps[unit].begin());
+            return true;
+        });
+
+    std::cout << "TimerHeap: " << heapTime << "ms, std::multimap: " << mapTime << "ms" << std::endl;
+}
@@ -0,0 +1,152 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FlatHashMap.h"
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+
+TEST(FlatHashMapTest, InsertFindErase)
+{
+    Acore::FlatHashMap<uint64, uint32> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(1), map.end());
+
+    EXPECT_TRUE(map.insert({ 1, 10 }).second);
+    EXPECT_FALSE(map.insert({ 1, 20 }).second);
+    map[2] = 30;
+
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_EQ(map.find(1)->second, 10u);
+    EXPECT_EQ(map[2], 30u);
+    EXPECT_TRUE(map.contains(2));
+
+    EXPECT_EQ(map.erase(1), 1u);
+    EXPECT_EQ(map.erase(1), 0u);
+    EXPECT_FALSE(map.contains(1));
+    EXPECT_EQ(map.size(), 1u);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.contains(2));
+}
+
+TEST(FlatHashMapTest, MatchesUnorderedMap)
+{
+    Acore::FlatHashMap<uint64, uint64> map;
+    std::unordered_map<uint64, uint64> reference;
+    std::mt19937_64 random(42);
+
+    for (uint32 i = 0; i < 200000; ++i)
+    {
+        uint64 const key = random() % 4096;
+        switch (random() % 3)
+        {
+            case 0:
+                EXPECT_EQ(map.insert({ key, i }).second, reference.insert({ key, i }).second);
+                break;
+            case 1:
+                EXPECT_EQ(map.erase(key), reference.erase(key));
+                break;
+            default:
+            {
+                auto itr = map.find(key);
+                auto refItr = reference.find(key);
+                ASSERT_EQ(itr == map.end(), refItr == reference.end());
+                if (itr != map.end())
+                {
+                    EXPECT_EQ(itr->second, refItr->second);
+                }
+                break;
+            }
+        }
+    }
+
+    EXPECT_EQ(map.size(), reference.size());
+    for (auto const& [key, value] : map)
+        EXPECT_EQ(reference.at(key), value);
+}
+
+TEST(FlatHashMapTest, EraseWhileIterating)
+{
+    Acore::FlatHashMap<uint64, uint64> map;
+    for (uint64 i = 0; i < 1000; ++i)
+        map[i] = i;
+
+    std::unordered_set<uint64> visited;
+    for (auto itr = map.begin(); itr != map.end();)
+    {
+        EXPECT_TRUE(visited.insert(itr->first).second);
+        if (itr->first % 2)
+            itr = map.erase(itr);
+        else
+            ++itr;
+    }
+
+    EXPECT_EQ(visited.size(), 1000u);
+    EXPECT_EQ(map.size(), 500u);
+    for (uint64 i = 0; i < 1000; ++i)
+        EXPECT_EQ(map.contains(i), i % 2 == 0);
+}
+
+// Lookup, insert and erase timings against std::unordered_map with the key pattern of a player visibility map in a city.
+// Run with --gtest_also_run_disabled_tests --gtest_filter=FlatHashMapTest.*
+template<class Map>
+static std::chrono::microseconds TimeVisibilityPattern(std::vector<uint64> const& keys, uint64& checksum)
+{
+    auto const start = std::chrono::steady_clock::now();
+
+    for (uint32 round = 0; round < 100; ++round)
+    {
+        Map map;
+        for (uint64 key : keys)
+            map.insert({ key, key });
+
+        for (uint32 lookup = 0; lookup < 10; ++lookup)
+            for (uint64 key : keys)
+                checksum += map.find(key)->second;
+
+        for (auto const& entry : map)
+            checksum += entry.second;
+
+        for (std::size_t i = 0; i < keys.size(); i += 2)
+            map.erase(keys[i]);
+
+        checksum += map.size();
+    }
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+}
+
+TEST(FlatHashMapTest, DISABLED_Benchmark)
+{
+    // raw guid values, creature and game object spawns of a few entries with sequential counters
+    std::vector<uint64> keys;
+    std::mt19937_64 random(42);
+    for (uint64 i = 0; i < 3000; ++i)
+        keys.push_back((uint64(0xF130 + i % 2) << 48) | (uint64(random() % 500) << 24) | (100000 + i));
+
+    uint64 checksum = 0;
+    std::chrono::microseconds const unordered = TimeVisibilityPattern<std::unordered_map<uint64, uint64>>(keys, checksum);
+    std::chrono::microseconds const flat = TimeVisibilityPattern<Acore::FlatHashMap<uint64, uint64>>(keys, checksum);
+
+    std::cout << "std::unordered_map: " << unordered.count() << " us, Acore::FlatHashMap: " << flat.count() << " us (" << checksum << ")\n";
+}
@@ -0,0 +1,144 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FlatMultiMap.h"
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <random>
+#include <vector>
+
+TEST(FlatMultiMapTest, KeepsMultimapOrder)
+{
+    Acore::FlatMultiMap<uint32, uint32, 4> map;
+    std::multimap<uint32, uint32> reference;
+    std::mt19937 random(42);
+
+    for (uint32 i = 0; i < 2000; ++i)
+    {
+        uint32 const key = random() % 64;
+        if (random() % 3)
+        {
+            map.insert({ key, i });
+            reference.insert({ key, i });
+        }
+        else
+        {
+            auto itr = map.find(key);
+            auto refItr = reference.find(key);
+            ASSERT_EQ(itr == map.end(), refItr == reference.end());
+            if (itr != map.end())
+            {
+                EXPECT_EQ(itr->second, refItr->second);
+                map.erase(itr);
+                reference.erase(refItr);
+            }
+        }
+
+        ASSERT_EQ(map.count(key), reference.count(key));
+    }
+
+    ASSERT_EQ(map.size(), reference.size());
+    EXPECT_TRUE(std::equal(map.begin(), map.end(), reference.begin(), [](auto const& a, auto const& b) { return a.first == b.first && a.second == b.second; }));
+}
+
+TEST(FlatMultiMapTest, RangesAndErase)
+{
+    Acore::FlatMultiMap<uint32, uint32, 4> map;
+    for (uint32 i = 0; i < 10; ++i)
+        map.insert({ i % 3, i });
+
+    auto range = map.equal_range(1);
+    EXPECT_EQ(range.second - range.first, 3);
+    EXPECT_EQ(range.first->second, 1u);
+    EXPECT_EQ(map.lower_bound(1), range.first);
+    EXPECT_EQ(map.upper_bound(1), range.second);
+    EXPECT_FALSE(map.contains(5));
+    EXPECT_EQ(map.find(5), map.end());
+
+    // erase returns the position of the erased entry, now holding the next one
+    auto itr = map.erase(range.first);
+    EXPECT_EQ(itr->first, 1u);
+    EXPECT_EQ(itr->second, 4u);
+
+    EXPECT_EQ(map.erase(0), 4u);
+    EXPECT_EQ(map.size(), 5u);
+    EXPECT_EQ(map.begin()->first, 1u);
+}
+
+TEST(FlatMultiMapTest, IteratorsSurviveGrowth)
+{
+    Acore::FlatMultiMap<uint32, uint32, 2> map;
+    map.insert({ 1, 1 });
+    map.insert({ 5, 5 });
+
+    // kept by index, the first entry stays reachable past the inline storage
+    Acore::FlatMultiMap<uint32, uint32, 2>::const_iterator itr = map.begin();
+    for (uint32 i = 10; i < 100; ++i)
+        map.insert({ i, i });
+
+    EXPECT_EQ(itr->first, 1u);
+    EXPECT_EQ(map.size(), 92u);
+}
+
+// HasAura style lookups and RemoveAurasDueToSpell style range removals against std::multimap,
+// on aura loads of raid members (~40 auras per unit, a few stacking spell ids).
+// Run with --gtest_also_run_disabled_tests --gtest_filter=FlatMultiMapTest.*
+template<class Map>
+static std::chrono::microseconds TimeAuraPattern(std::vector<uint32> const& spellIds, uint64& checksum)
+{
+    auto const start = std::chrono::steady_clock::now();
+
+    for (uint32 round = 0; round < 20000; ++round)
+    {
+        Map map;
+        for (uint32 spellId : spellIds)
+            map.insert({ spellId, spellId });
+
+        // HasAura
+        for (uint32 lookup = 0; lookup < 4; ++lookup)
+            for (uint32 spellId : spellIds)
+                checksum += map.find(spellId + lookup % 2) != map.end();
+
+        // RemoveAurasDueToSpell
+        for (std::size_t i = 0; i < spellIds.size(); i += 4)
+        {
+            auto range = map.equal_range(spellIds[i]);
+            map.erase(range.first, range.second);
+        }
+
+        checksum += map.size();
+    }
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+}
+
+TEST(FlatMultiMapTest, DISABLED_Benchmark)
+{
+    std::vector<uint32> spellIds;
+    std::mt19937 random(42);
+    for (uint32 i = 0; i < 40; ++i)
+        spellIds.push_back(i % 8 ? 1000 + random() % 70000 : spellIds.empty() ? 48938 : spellIds.back());
+
+    uint64 checksum = 0;
+    std::chrono::microseconds const multimap = TimeAuraPattern<std::multimap<uint32, uint32>>(spellIds, checksum);
+    std::chrono::microseconds const flat = TimeAuraPattern<Acore::FlatMultiMap<uint32, uint32, 16>>(spellIds, checksum);
+
+    std::cout << "std::multimap: " << multimap.count() << " us, Acore::FlatMultiMap: " << flat.count() << " us (" << checksum << ")\n";
+}
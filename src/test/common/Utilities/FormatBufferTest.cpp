@@ -0,0 +1,55 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StringFormat.h"
+#include "gtest/gtest.h"
+
+TEST(FormatBufferTest, ReusesTheThreadBuffer)
+{
+    char const* storage = nullptr;
+    {
+        Acore::FormatBuffer buffer;
+        EXPECT_EQ(buffer.Format("{} {}", "map", 571), "map 571");
+        buffer.Append(",{}={}", "tag", 1);
+        EXPECT_EQ(buffer.View(), "map 571,tag=1");
+        storage = buffer.View().data();
+    }
+
+    Acore::FormatBuffer buffer;
+    EXPECT_EQ(buffer.Format("{}", 1).data(), storage);
+    EXPECT_EQ(buffer.Format("{}", std::string(1000, 'a')).size(), 1000u);
+}
+
+TEST(FormatBufferTest, NestedScopesDontOverwriteTheOuterOne)
+{
+    Acore::FormatBuffer outer;
+    std::string_view text = outer.Format("outer {}", 1);
+    {
+        Acore::FormatBuffer inner;
+        EXPECT_EQ(inner.Format("inner {}", 2), "inner 2");
+    }
+    EXPECT_EQ(text, "outer 1");
+}
+
+TEST(FormatBufferTest, WrongFormatsKeepTheEarlierText)
+{
+    Acore::FormatBuffer buffer;
+    buffer.Append("a=1");
+    buffer.Append(fmt::runtime("{:d}"), "text");
+    EXPECT_EQ(buffer.View().substr(0, 3), "a=1");
+    EXPECT_NE(buffer.View().find("Wrong format occurred"), std::string_view::npos);
+}
@@ -0,0 +1,82 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FrameArena.h"
+#include "gtest/gtest.h"
+
+#include <thread>
+
+using Acore::FrameArena;
+
+TEST(FrameArenaTest, RewindsOnceEveryAllocationIsFreed)
+{
+    std::pmr::memory_resource* resource = FrameArena::GetResource();
+
+    void* first = resource->allocate(100);
+    void* second = resource->allocate(100);
+    EXPECT_EQ(FrameArena::GetStats().LiveAllocations, 2u);
+    resource->deallocate(first, 100);
+    resource->deallocate(second, 100);
+    EXPECT_EQ(FrameArena::GetStats().LiveAllocations, 0u);
+
+    // the next allocation starts from the beginning of the first chunk again
+    void* third = resource->allocate(100);
+    EXPECT_EQ(third, first);
+    resource->deallocate(third, 100);
+}
+
+TEST(FrameArenaTest, ContainersGrowInPlaceAndTrimFreesTheExtraChunks)
+{
+    {
+        Acore::FrameVector<uint32> values(FrameArena::GetResource());
+        for (uint32 i = 0; i < 3000; ++i)
+            values.push_back(i);
+
+        Acore::FrameList<uint32> list(FrameArena::GetResource());
+        for (uint32 i = 0; i < 5000; ++i)
+            list.push_back(i);
+
+        EXPECT_EQ(values[2999], 2999u);
+        EXPECT_EQ(list.back(), 4999u);
+        EXPECT_GT(FrameArena::GetStats().ReservedBytes, FrameArena::ChunkSize);
+
+        // nothing can be freed while the containers are alive
+        FrameArena::Trim();
+        EXPECT_GT(FrameArena::GetStats().ReservedBytes, FrameArena::ChunkSize);
+    }
+
+    FrameArena::Trim();
+    EXPECT_EQ(FrameArena::GetStats().ReservedBytes, FrameArena::ChunkSize);
+}
+
+TEST(FrameArenaTest, LargeRequestsUseTheHeap)
+{
+    std::pmr::memory_resource* resource = FrameArena::GetResource();
+    void* block = resource->allocate(FrameArena::MaxAllocationSize + 1);
+    EXPECT_EQ(FrameArena::GetStats().LiveAllocations, 0u);
+    resource->deallocate(block, FrameArena::MaxAllocationSize + 1);
+}
+
+TEST(FrameArenaTest, ThreadsHaveTheirOwnArena)
+{
+    std::pmr::memory_resource* resource = FrameArena::GetResource();
+    std::pmr::memory_resource* other = nullptr;
+    std::thread thread([&other]() { other = FrameArena::GetResource(); });
+    thread.join();
+
+    EXPECT_NE(resource, other);
+}
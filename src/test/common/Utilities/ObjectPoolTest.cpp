@@ -0,0 +1,101 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ObjectPool.h"
+#include "gtest/gtest.h"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct PooledObject
+    {
+        explicit PooledObject(uint32 value) : Value(value) { }
+        virtual ~PooledObject() = default;
+
+        static void* operator new(std::size_t size) { return Acore::ObjectPool<PooledObject>::Allocate(size); }
+        static void operator delete(void* ptr, std::size_t size) { Acore::ObjectPool<PooledObject>::Deallocate(ptr, size); }
+
+        uint64 Value;
+    };
+
+    struct DerivedObject : PooledObject
+    {
+        DerivedObject() : PooledObject(1) { }
+
+        uint64 Padding[4] = { };
+    };
+
+    using Pool = Acore::ObjectPool<PooledObject>;
+}
+
+TEST(ObjectPoolTest, ReusesFreedBlocks)
+{
+    std::size_t const active = Pool::GetActiveCount();
+
+    PooledObject* first = new PooledObject(1);
+    EXPECT_EQ(Pool::GetActiveCount(), active + 1);
+
+    void* address = first;
+    delete first;
+    EXPECT_EQ(Pool::GetActiveCount(), active);
+    EXPECT_GE(Pool::GetCachedCount(), 1u);
+
+    PooledObject* second = new PooledObject(2);
+    EXPECT_EQ(static_cast<void*>(second), address);
+    EXPECT_EQ(second->Value, 2u);
+    delete second;
+}
+
+TEST(ObjectPoolTest, DerivedClassesUseTheHeap)
+{
+    std::size_t const active = Pool::GetActiveCount();
+    std::size_t const cached = Pool::GetCachedCount();
+
+    PooledObject* object = new DerivedObject();
+    EXPECT_EQ(Pool::GetActiveCount(), active);
+    delete object;
+    EXPECT_EQ(Pool::GetActiveCount(), active);
+    EXPECT_EQ(Pool::GetCachedCount(), cached);
+}
+
+TEST(ObjectPoolTest, CrossThreadFree)
+{
+    std::size_t const active = Pool::GetActiveCount();
+
+    std::vector<PooledObject*> objects;
+    for (uint32 i = 0; i < 2000; ++i)
+        objects.push_back(new PooledObject(i));
+
+    EXPECT_EQ(Pool::GetActiveCount(), active + objects.size());
+
+    std::size_t cachedByThread = 0;
+    std::thread thread([&]()
+    {
+        std::size_t const cached = Pool::GetCachedCount();
+        for (PooledObject* object : objects)
+            delete object;
+
+        // the list of the thread is bounded, the rest went back to the heap
+        cachedByThread = Pool::GetCachedCount() - cached;
+    });
+    thread.join();
+
+    EXPECT_EQ(cachedByThread, 1024u);
+    EXPECT_EQ(Pool::GetActiveCount(), active);
+}
@@ -15,20 +15,20 @@
  * with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include "LogOperation.h"
-#include "LogMessage.h"
-#include "Logger.h"
+#include "ProcessPriority.h"
+#include "gtest/gtest.h"
 
-LogOperation::LogOperation(Logger const* _logger, std::unique_ptr<LogMessage>&& _msg) : logger(_logger), msg(std::forward<std::unique_ptr<LogMessage>>(_msg))
+TEST(ProcessorListTest, ParsesNumbersAndRanges)
 {
+    Optional<std::vector<uint32>> processors = ParseProcessorList("6,0-2,2");
+    ASSERT_TRUE(processors);
+    EXPECT_EQ(*processors, (std::vector<uint32>{ 0, 1, 2, 6 }));
 }
 
-LogOperation::~LogOperation()
+TEST(ProcessorListTest, RejectsMalformedLists)
 {
-}
-
-int LogOperation::call()
-{
-    logger->write(msg.get());
-    return 0;
+    EXPECT_FALSE(ParseProcessorList(""));
+    EXPECT_FALSE(ParseProcessorList("3-1"));
+    EXPECT_FALSE(ParseProcessorList("0-x"));
+    EXPECT_FALSE(ParseProcessorList("1024"));
 }
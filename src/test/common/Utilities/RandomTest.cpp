@@ -0,0 +1,80 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Random.h"
+#include "gtest/gtest.h"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+    std::vector<uint32> Draw(std::size_t count)
+    {
+        std::vector<uint32> values;
+        for (std::size_t i = 0; i < count; ++i)
+            values.push_back(urand(0, 1000000));
+
+        return values;
+    }
+}
+
+TEST(RandomTest, SameSeedRestartsTheSameSequence)
+{
+    SetRandomSeed(42);
+    std::vector<uint32> const first = Draw(64);
+
+    SetRandomSeed(42);
+    EXPECT_EQ(Draw(64), first);
+
+    SetRandomSeed(43);
+    EXPECT_NE(Draw(64), first);
+}
+
+TEST(RandomTest, ChancesStayInTheirRange)
+{
+    SetRandomSeed(42);
+    for (uint32 i = 0; i < 100000; ++i)
+    {
+        double const norm = rand_norm();
+        EXPECT_GE(norm, 0.0);
+        EXPECT_LT(norm, 1.0);
+
+        double const chance = rand_chance();
+        EXPECT_GE(chance, 0.0);
+        EXPECT_LT(chance, 100.0);
+    }
+
+    EXPECT_FALSE(roll_chance_f(0.0f));
+    EXPECT_TRUE(roll_chance_f(100.0f));
+}
+
+TEST(RandomTest, SeedOnlyAffectsTheCallingThread)
+{
+    SetRandomSeed(7);
+    std::vector<uint32> const expected = Draw(16);
+
+    SetRandomSeed(7);
+    std::thread other([]()
+    {
+        SetRandomSeed(8);
+        Draw(16);
+    });
+    other.join();
+
+    EXPECT_EQ(Draw(16), expected);
+}
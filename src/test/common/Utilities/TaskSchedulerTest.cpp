@@ -0,0 +1,148 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TaskScheduler.h"
+#include "gtest/gtest.h"
+#include <vector>
+
+TEST(TaskSchedulerTest, ExecutesInTimeThenScheduleOrder)
+{
+    TaskScheduler scheduler;
+    std::vector<int> order;
+    scheduler.Schedule(200ms, [&](TaskContext) { order.push_back(1); });
+    scheduler.Schedule(100ms, [&](TaskContext) { order.push_back(2); });
+    scheduler.Schedule(100ms, [&](TaskContext) { order.push_back(3); });
+    scheduler.Schedule(300ms, [&](TaskContext) { order.push_back(4); });
+
+    scheduler.Update(100ms);
+    EXPECT_EQ(order, (std::vector<int>{ 2, 3 }));
+
+    scheduler.Update(200ms);
+    EXPECT_EQ(order, (std::vector<int>{ 2, 3, 1, 4 }));
+}
+
+TEST(TaskSchedulerTest, RepeatKeepsTaskAndCountsRepeats)
+{
+    TaskScheduler scheduler;
+    std::vector<uint32> repeats;
+    scheduler.Schedule(100ms, [&](TaskContext context)
+    {
+        repeats.push_back(context.GetRepeatCounter());
+        if (context.GetRepeatCounter() < 2)
+            context.Repeat(50ms);
+    });
+
+    scheduler.Update(100ms);
+    scheduler.Update(50ms);
+    scheduler.Update(50ms);
+    scheduler.Update(50ms);
+    EXPECT_EQ(repeats, (std::vector<uint32>{ 0, 1, 2 }));
+}
+
+TEST(TaskSchedulerTest, RepeatedTaskRunsAfterTasksDueAtSameTime)
+{
+    TaskScheduler scheduler;
+    std::vector<int> order;
+    scheduler.Schedule(100ms, [&](TaskContext context)
+    {
+        order.push_back(1);
+        if (!context.GetRepeatCounter())
+            context.Repeat(100ms);
+    });
+    scheduler.Schedule(200ms, [&](TaskContext) { order.push_back(2); });
+
+    scheduler.Update(200ms);
+    EXPECT_EQ(order, (std::vector<int>{ 1, 2, 1 }));
+}
+
+TEST(TaskSchedulerTest, ScheduleFromContextUsesContextTime)
+{
+    TaskScheduler scheduler;
+    std::vector<int> order;
+    scheduler.Schedule(100ms, [&](TaskContext context)
+    {
+        order.push_back(1);
+        context.Schedule(50ms, [&](TaskContext) { order.push_back(2); });
+    });
+
+    scheduler.Update(150ms);
+    EXPECT_EQ(order, (std::vector<int>{ 1, 2 }));
+}
+
+TEST(TaskSchedulerTest, CancelGroup)
+{
+    TaskScheduler scheduler;
+    std::vector<int> order;
+    scheduler.Schedule(100ms, 1, [&](TaskContext) { order.push_back(1); });
+    scheduler.Schedule(100ms, 2, [&](TaskContext) { order.push_back(2); });
+    scheduler.Schedule(100ms, 1, [&](TaskContext) { order.push_back(3); });
+
+    EXPECT_TRUE(scheduler.IsGroupScheduled(1));
+    scheduler.CancelGroup(1);
+    EXPECT_FALSE(scheduler.IsGroupScheduled(1));
+    EXPECT_TRUE(scheduler.IsGroupScheduled(2));
+
+    scheduler.Update(100ms);
+    EXPECT_EQ(order, (std::vector<int>{ 2 }));
+}
+
+TEST(TaskSchedulerTest, DelayGroupKeepsOrderAmongDelayedTasks)
+{
+    TaskScheduler scheduler;
+    std::vector<int> order;
+    scheduler.Schedule(100ms, 1, [&](TaskContext) { order.push_back(1); });
+    scheduler.Schedule(100ms, 1, [&](TaskContext) { order.push_back(2); });
+    scheduler.Schedule(200ms, 2, [&](TaskContext) { order.push_back(3); });
+
+    scheduler.DelayGroup(1, 100ms);
+    scheduler.Update(100ms);
+    EXPECT_TRUE(order.empty());
+
+    scheduler.Update(100ms);
+    EXPECT_EQ(order, (std::vector<int>{ 3, 1, 2 }));
+}
+
+TEST(TaskSchedulerTest, RescheduleAll)
+{
+    TaskScheduler scheduler;
+    std::vector<int> order;
+    scheduler.Schedule(100ms, [&](TaskContext) { order.push_back(1); });
+    scheduler.Schedule(500ms, [&](TaskContext) { order.push_back(2); });
+
+    scheduler.RescheduleAll(300ms);
+    scheduler.Update(200ms);
+    EXPECT_TRUE(order.empty());
+
+    scheduler.Update(100ms);
+    EXPECT_EQ(order, (std::vector<int>{ 1, 2 }));
+}
+
+TEST(TaskSchedulerTest, CancelAllFromContext)
+{
+    TaskScheduler scheduler;
+    std::vector<int> order;
+    scheduler.Schedule(100ms, [&](TaskContext context)
+    {
+        order.push_back(1);
+        context.CancelAll();
+    });
+    scheduler.Schedule(100ms, [&](TaskContext) { order.push_back(2); });
+
+    scheduler.Update(100ms);
+    EXPECT_EQ(order, (std::vector<int>{ 1 }));
+    EXPECT_FALSE(scheduler.IsGroupScheduled(0));
+}
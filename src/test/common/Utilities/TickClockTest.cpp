@@ -0,0 +1,47 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CycleClock.h"
+#include "TickClock.h"
+#include "gtest/gtest.h"
+
+#include <thread>
+
+using namespace std::chrono_literals;
+
+TEST(TickClockTest, ReturnsTheTickSnapshotOnceUpdated)
+{
+    std::chrono::steady_clock::time_point const tick = std::chrono::steady_clock::now() - 1h;
+    Acore::TickClock::Update(tick);
+
+    EXPECT_EQ(Acore::TickClock::now(), tick);
+    std::this_thread::sleep_for(1ms);
+    EXPECT_EQ(Acore::TickClock::now(), tick);
+
+    Acore::TickClock::Update(tick + 50ms);
+    EXPECT_EQ(Acore::TickClock::now(), tick + 50ms);
+}
+
+TEST(CycleClockTest, MeasuresElapsedTime)
+{
+    Acore::CycleClock::time_point const start = Acore::CycleClock::now();
+    std::this_thread::sleep_for(20ms);
+    Acore::CycleClock::duration const elapsed = Acore::CycleClock::now() - start;
+
+    EXPECT_GE(elapsed, 15ms);
+    EXPECT_LT(elapsed, 1s);
+}
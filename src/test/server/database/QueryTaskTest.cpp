@@ -0,0 +1,93 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "QueryTask.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    struct FrameGuard
+    {
+        ~FrameGuard() { *Destroyed = true; }
+        bool* Destroyed;
+    };
+
+    QueryTask AwaitTwoQueries(PreparedQueryResultFuture first, TransactionFuture second, uint32& step, bool& committed)
+    {
+        PreparedQueryResult result = co_await PreparedQueryAwaiter(QueryCallback(std::move(first)));
+        step = result ? 10 : 1;
+
+        committed = co_await TransactionAwaiter(TransactionCallback(std::move(second)));
+        step = 2;
+    }
+
+    QueryTask AwaitForever(PreparedQueryResultFuture query, bool* destroyed)
+    {
+        FrameGuard guard{ destroyed };
+        co_await PreparedQueryAwaiter(QueryCallback(std::move(query)));
+    }
+}
+
+TEST(QueryTaskTest, ResumesWhenEachResultIsReady)
+{
+    PreparedQueryResultPromise query;
+    TransactionPromise transaction;
+    uint32 step = 0;
+    bool committed = false;
+
+    QueryTask task = AwaitTwoQueries(query.get_future(), transaction.get_future(), step, committed);
+    EXPECT_EQ(step, 0u);
+    EXPECT_FALSE(task.InvokeIfReady());
+
+    query.set_value(nullptr);
+    EXPECT_FALSE(task.InvokeIfReady());
+    EXPECT_EQ(step, 1u);
+
+    transaction.set_value(true);
+    EXPECT_TRUE(task.InvokeIfReady());
+    EXPECT_EQ(step, 2u);
+    EXPECT_TRUE(committed);
+}
+
+TEST(QueryTaskTest, ReadyResultsDoNotSuspend)
+{
+    PreparedQueryResultPromise query;
+    TransactionPromise transaction;
+    query.set_value(nullptr);
+    transaction.set_value(false);
+    uint32 step = 0;
+    bool committed = true;
+
+    QueryTask task = AwaitTwoQueries(query.get_future(), transaction.get_future(), step, committed);
+    EXPECT_EQ(step, 2u);
+    EXPECT_FALSE(committed);
+    EXPECT_TRUE(task.InvokeIfReady());
+}
+
+TEST(QueryTaskTest, DestroyingTheTaskAbandonsTheHandler)
+{
+    PreparedQueryResultPromise query;
+    bool destroyed = false;
+    {
+        QueryTask task = AwaitForever(query.get_future(), &destroyed);
+        QueryTask moved = std::move(task);
+        EXPECT_FALSE(moved.InvokeIfReady());
+        EXPECT_FALSE(destroyed);
+    }
+
+    EXPECT_TRUE(destroyed);
+}
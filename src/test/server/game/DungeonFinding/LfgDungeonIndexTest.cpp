@@ -0,0 +1,84 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LFGQueue.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+
+using namespace lfg;
+
+TEST(LfgDungeonIndexTest, MaskRoundTrip)
+{
+    LfgDungeonIndex index;
+    LfgDungeonSet const dungeons = { 261, 262, 285, 286 };
+
+    LfgDungeonIndex::Mask mask;
+    ASSERT_TRUE(index.BuildMask(dungeons, mask));
+    EXPECT_EQ(mask.count(), dungeons.size());
+
+    LfgDungeonSet result;
+    index.GetDungeons(mask, result);
+    EXPECT_EQ(result, dungeons);
+}
+
+TEST(LfgDungeonIndexTest, MaskIntersectionMatchesSetIntersection)
+{
+    LfgDungeonIndex index;
+    std::mt19937 random(12345);
+    std::uniform_int_distribution<uint32> dungeonId(1, 300);
+
+    for (uint32 i = 0; i < 1000; ++i)
+    {
+        LfgDungeonSet first, second;
+        for (uint32 j = 0; j < 20; ++j)
+        {
+            first.insert(dungeonId(random));
+            second.insert(dungeonId(random));
+        }
+
+        LfgDungeonIndex::Mask firstMask, secondMask;
+        ASSERT_TRUE(index.BuildMask(first, firstMask));
+        ASSERT_TRUE(index.BuildMask(second, secondMask));
+
+        LfgDungeonSet expected;
+        std::set_intersection(first.begin(), first.end(), second.begin(), second.end(), std::inserter(expected, expected.begin()));
+
+        LfgDungeonSet result;
+        index.GetDungeons(firstMask & secondMask, result);
+        EXPECT_EQ(result, expected);
+        EXPECT_EQ((firstMask & secondMask).none(), expected.empty());
+    }
+}
+
+TEST(LfgDungeonIndexTest, FullIndexRefusesNewDungeons)
+{
+    LfgDungeonIndex index;
+    LfgDungeonSet all;
+    for (uint32 i = 1; i <= LfgDungeonIndex::MaxDungeons; ++i)
+        all.insert(i);
+
+    LfgDungeonIndex::Mask mask;
+    ASSERT_TRUE(index.BuildMask(all, mask));
+    EXPECT_TRUE(mask.all());
+
+    // already indexed dungeons still get a mask
+    EXPECT_TRUE(index.BuildMask({ 1, 2 }, mask));
+    EXPECT_FALSE(index.BuildMask({ LfgDungeonIndex::MaxDungeons + 1 }, mask));
+}
@@ -0,0 +1,140 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "UpdateFieldFlags.h"
+#include "UpdateMask.h"
+#include "gtest/gtest.h"
+#include <vector>
+
+TEST(UpdateMaskTest, BitsAreWrittenAsClientBlocks)
+{
+    UpdateMask mask;
+    mask.SetCount(40);
+    EXPECT_EQ(mask.GetBlockCount(), 2u);
+
+    mask.SetBit(0);
+    mask.SetBit(31);
+    mask.SetBit(33);
+    mask.UnsetBit(0);
+    EXPECT_FALSE(mask.GetBit(0));
+    EXPECT_TRUE(mask.GetBit(31));
+    EXPECT_TRUE(mask.GetBit(33));
+
+    ByteBuffer data;
+    mask.AppendToPacket(&data);
+    ASSERT_EQ(data.size(), 8u);
+    EXPECT_EQ(data.read<uint32>(), 0x80000000u);
+    EXPECT_EQ(data.read<uint32>(), 0x2u);
+}
+
+TEST(UpdateMaskTest, CombinesMasks)
+{
+    UpdateMask first;
+    first.SetCount(64);
+    first.SetBit(1);
+    first.SetBit(40);
+
+    UpdateMask second;
+    second.SetCount(64);
+    second.SetBit(40);
+    second.SetBit(63);
+
+    UpdateMask both = first | second;
+    EXPECT_TRUE(both.GetBit(1));
+    EXPECT_TRUE(both.GetBit(63));
+
+    first &= second;
+    EXPECT_FALSE(first.GetBit(1));
+    EXPECT_TRUE(first.GetBit(40));
+    EXPECT_FALSE(first.GetBit(63));
+
+    first.Clear();
+    EXPECT_FALSE(first.GetBit(40));
+}
+
+TEST(UpdateMaskTest, VisitsSetBitsInOrder)
+{
+    UpdateMask mask;
+    mask.SetCount(100);
+    mask.SetBit(99);
+    mask.SetBit(0);
+    mask.SetBit(32);
+    mask.SetBit(31);
+
+    std::vector<uint32> visited;
+    mask.ForEachSetBit([&](uint32 index) { visited.push_back(index); });
+    EXPECT_EQ(visited, (std::vector<uint32>{ 0, 31, 32, 99 }));
+}
+
+TEST(UpdateMaskTest, CopiesInlineAndHeapStorage)
+{
+    UpdateMask small;
+    small.SetCount(UpdateMask::INLINE_BLOCK_COUNT * UpdateMask::CLIENT_UPDATE_MASK_BITS);
+    small.SetBit(5);
+
+    UpdateMask large;
+    large.SetCount(PLAYER_END);
+    large.SetBit(PLAYER_END - 1);
+
+    UpdateMask copy(small);
+    small.UnsetBit(5);
+    EXPECT_TRUE(copy.GetBit(5));
+
+    copy = large;
+    large.UnsetBit(PLAYER_END - 1);
+    EXPECT_EQ(copy.GetCount(), uint32(PLAYER_END));
+    EXPECT_TRUE(copy.GetBit(PLAYER_END - 1));
+
+    copy = small;
+    EXPECT_EQ(copy.GetBlockCount(), uint32(UpdateMask::INLINE_BLOCK_COUNT));
+    EXPECT_FALSE(copy.GetBit(5));
+}
+
+TEST(UpdateMaskTest, BuildsFieldFlagMasks)
+{
+    uint32 const visibleFlag = UF_FLAG_PUBLIC | UF_FLAG_PARTY_MEMBER;
+
+    UpdateMask mask;
+    BuildUpdateFieldFlagMask(UnitUpdateFieldFlags, UNIT_END, visibleFlag, mask);
+    ASSERT_EQ(mask.GetCount(), uint32(UNIT_END));
+
+    for (uint32 index = 0; index < UNIT_END; ++index)
+        EXPECT_EQ(mask.GetBit(index), (UnitUpdateFieldFlags[index] & visibleFlag) != 0) << index;
+
+    // nothing past the unit fields of the shared table
+    uint32 setBits = 0;
+    mask.ForEachSetBit([&](uint32 index)
+    {
+        EXPECT_LT(index, uint32(UNIT_END));
+        ++setBits;
+    });
+    EXPECT_GT(setBits, 0u);
+}
+
+TEST(UpdateMaskTest, ReportsFlagsOfChangedFields)
+{
+    UpdateMask changes;
+    changes.SetCount(PLAYER_END);
+    EXPECT_EQ(GetUpdateFieldFlagsOfMask(UnitUpdateFieldFlags, changes), uint32(UF_FLAG_NONE));
+
+    // private only, no other player receives it
+    changes.SetBit(PLAYER_XP);
+    EXPECT_EQ(GetUpdateFieldFlagsOfMask(UnitUpdateFieldFlags, changes), uint32(UnitUpdateFieldFlags[PLAYER_XP]));
+
+    changes.SetBit(UNIT_FIELD_HEALTH);
+    EXPECT_EQ(GetUpdateFieldFlagsOfMask(UnitUpdateFieldFlags, changes), uint32(UnitUpdateFieldFlags[PLAYER_XP] | UnitUpdateFieldFlags[UNIT_FIELD_HEALTH]));
+}
@@ -0,0 +1,78 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ActiveCellTracker.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    CellArea MakeArea(uint32 lowX, uint32 lowY, uint32 highX, uint32 highY)
+    {
+        return CellArea(CellCoord(lowX, lowY), CellCoord(highX, highY));
+    }
+
+    bool IsActive(ActiveCellTracker const& tracker, uint32 x, uint32 y)
+    {
+        return tracker.IsActive(CellCoord(x, y).GetId());
+    }
+}
+
+TEST(ActiveCellTrackerTest, AddMoveRemove)
+{
+    ActiveCellTracker tracker;
+    ObjectGuid const player = ObjectGuid::Create<HighGuid::Player>(1);
+
+    tracker.SetAreas(player, MakeArea(10, 10, 12, 12), {});
+    EXPECT_EQ(tracker.GetActiveCellCount(), 9u);
+    EXPECT_TRUE(IsActive(tracker, 10, 10));
+    EXPECT_TRUE(IsActive(tracker, 12, 12));
+    EXPECT_FALSE(IsActive(tracker, 13, 12));
+
+    tracker.SetAreas(player, MakeArea(11, 10, 13, 12), {});
+    EXPECT_EQ(tracker.GetActiveCellCount(), 9u);
+    EXPECT_FALSE(IsActive(tracker, 10, 10));
+    EXPECT_TRUE(IsActive(tracker, 13, 12));
+
+    tracker.Remove(player);
+    EXPECT_EQ(tracker.GetActiveCellCount(), 0u);
+    EXPECT_FALSE(IsActive(tracker, 12, 11));
+}
+
+TEST(ActiveCellTrackerTest, OverlappingAreas)
+{
+    ActiveCellTracker tracker;
+    ObjectGuid const first = ObjectGuid::Create<HighGuid::Player>(1);
+    ObjectGuid const second = ObjectGuid::Create<HighGuid::Player>(2);
+
+    tracker.SetAreas(first, MakeArea(0, 0, 1, 1), MakeArea(100, 100, 100, 100));
+    tracker.SetAreas(second, MakeArea(1, 1, 2, 2), {});
+    EXPECT_EQ(tracker.GetActiveCellCount(), 8u);
+
+    // The shared cell stays active while one area still covers it
+    tracker.Remove(first);
+    EXPECT_TRUE(IsActive(tracker, 1, 1));
+    EXPECT_FALSE(IsActive(tracker, 0, 0));
+    EXPECT_FALSE(IsActive(tracker, 100, 100));
+    EXPECT_EQ(tracker.GetActiveCellCount(), 4u);
+
+    // Ending far sight releases the viewpoint cells only
+    tracker.SetAreas(second, MakeArea(1, 1, 2, 2), MakeArea(50, 50, 51, 50));
+    EXPECT_EQ(tracker.GetActiveCellCount(), 6u);
+    tracker.SetAreas(second, MakeArea(1, 1, 2, 2), {});
+    EXPECT_EQ(tracker.GetActiveCellCount(), 4u);
+    EXPECT_FALSE(IsActive(tracker, 51, 50));
+}
@@ -0,0 +1,96 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Spline.h"
+#include "gtest/gtest.h"
+
+using Movement::SplineBase;
+using G3D::Vector3;
+
+namespace
+{
+    SplineBase MakeSpline(SplineBase::EvaluationMode mode)
+    {
+        Vector3 const controls[] = { { 0.f, 0.f, 0.f }, { 10.f, 2.f, 1.f }, { 14.f, 12.f, 0.f }, { 4.f, 20.f, -2.f } };
+
+        SplineBase spline;
+        spline.init_spline(controls, 4, mode, 0.f);
+        return spline;
+    }
+
+    void ExpectNear(Vector3 const& actual, Vector3 const& expected)
+    {
+        EXPECT_NEAR(actual.x, expected.x, 1e-4f);
+        EXPECT_NEAR(actual.y, expected.y, 1e-4f);
+        EXPECT_NEAR(actual.z, expected.z, 1e-4f);
+    }
+}
+
+TEST(SplineTest, CatmullRomPassesThroughControlPoints)
+{
+    SplineBase spline = MakeSpline(SplineBase::ModeCatmullrom);
+
+    for (SplineBase::index_type i = spline.first(); i < spline.last(); ++i)
+    {
+        Vector3 start, end;
+        spline.evaluate_percent(i, 0.f, start);
+        spline.evaluate_percent(i, 1.f, end);
+        ExpectNear(start, spline.getPoint(i));
+        ExpectNear(end, spline.getPoint(i + 1));
+    }
+}
+
+TEST(SplineTest, DerivativeMatchesTheSlopeOfThePositions)
+{
+    for (SplineBase::EvaluationMode mode : { SplineBase::ModeLinear, SplineBase::ModeCatmullrom })
+    {
+        SplineBase spline = MakeSpline(mode);
+        float const step = 1e-3f;
+
+        for (float u : { 0.2f, 0.5f, 0.8f })
+        {
+            Vector3 before, after, hermite;
+            spline.evaluate_percent(spline.first(), u - step, before);
+            spline.evaluate_percent(spline.first(), u + step, after);
+            spline.evaluate_derivative(spline.first(), u, hermite);
+
+            Vector3 const slope = (after - before) / (2.f * step);
+            EXPECT_NEAR(hermite.x, slope.x, 1e-2f);
+            EXPECT_NEAR(hermite.y, slope.y, 1e-2f);
+            EXPECT_NEAR(hermite.z, slope.z, 1e-2f);
+        }
+    }
+}
+
+TEST(SplineTest, CombinedEvaluationMatchesSeparateEvaluations)
+{
+    for (SplineBase::EvaluationMode mode : { SplineBase::ModeLinear, SplineBase::ModeCatmullrom })
+    {
+        SplineBase spline = MakeSpline(mode);
+
+        for (SplineBase::index_type i = spline.first(); i < spline.last(); ++i)
+        {
+            Vector3 position, hermite, combinedPosition, combinedHermite;
+            spline.evaluate_percent(i, 0.35f, position);
+            spline.evaluate_derivative(i, 0.35f, hermite);
+            spline.evaluate_percent_and_derivative(i, 0.35f, combinedPosition, combinedHermite);
+
+            EXPECT_EQ(combinedPosition, position);
+            EXPECT_EQ(combinedHermite, hermite);
+        }
+    }
+}
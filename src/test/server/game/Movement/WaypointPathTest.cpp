@@ -0,0 +1,62 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WaypointMgr.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    WaypointData MakePoint(uint32 id)
+    {
+        WaypointData data;
+        data.id = id;
+        data.x = float(id);
+        data.y = 0.0f;
+        data.z = 0.0f;
+        data.delay = 0;
+        return data;
+    }
+}
+
+TEST(WaypointPathTest, FindsContiguousPoints)
+{
+    WaypointPath path;
+    for (uint32 id = 1; id <= 5; ++id)
+        path.emplace(id, MakePoint(id));
+
+    ASSERT_EQ(path.size(), 5u);
+    EXPECT_EQ(path.begin()->first, 1u);
+    EXPECT_EQ(path.rbegin()->first, 5u);
+    EXPECT_EQ(path.find(3)->second.x, 3.0f);
+    EXPECT_EQ(path.find(0), path.end());
+    EXPECT_EQ(path.find(6), path.end());
+}
+
+TEST(WaypointPathTest, KeepsPointsSortedWithGaps)
+{
+    WaypointPath path;
+    path.emplace(10, MakePoint(10));
+    path.emplace(2, MakePoint(2));
+    path.emplace(5, MakePoint(5));
+    path.emplace(5, MakePoint(7));
+
+    ASSERT_EQ(path.size(), 3u);
+    EXPECT_EQ(path.begin()->first, 2u);
+    EXPECT_EQ(path.find(5)->second.x, 5.0f);
+    EXPECT_EQ(path.find(10)->second.x, 10.0f);
+    EXPECT_EQ(path.find(4), path.end());
+}
@@ -0,0 +1,57 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WardenWorker.h"
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+
+TEST(WardenWorkerTest, RunsJobsRightAwayWhenNotStarted)
+{
+    std::thread::id ranOn;
+    sWardenWorker->Enqueue([&ranOn]() { ranOn = std::this_thread::get_id(); });
+    EXPECT_EQ(ranOn, std::this_thread::get_id());
+}
+
+TEST(WardenWorkerTest, StopFinishesTheQueuedJobs)
+{
+    std::atomic<uint32> done = 0;
+    std::atomic<bool> offThread = true;
+    std::thread::id const self = std::this_thread::get_id();
+
+    sWardenWorker->Start(2);
+    for (uint32 i = 0; i < 1000; ++i)
+    {
+        sWardenWorker->Enqueue([&, self]()
+        {
+            if (std::this_thread::get_id() == self)
+                offThread = false;
+
+            ++done;
+        });
+    }
+    sWardenWorker->Stop();
+
+    EXPECT_EQ(done, 1000u);
+    EXPECT_TRUE(offThread);
+
+    // stopped, back to running on the caller
+    std::thread::id ranOn;
+    sWardenWorker->Enqueue([&ranOn]() { ranOn = std::this_thread::get_id(); });
+    EXPECT_EQ(ranOn, self);
+}
@@ -0,0 +1,748 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LoadTestBot.h"
+#include "CryptoHash.h"
+#include "CryptoRandom.h"
+#include "LoadTestStats.h"
+#include "SharedDefines.h"
+#include "StringFormat.h"
+#include "UnitDefines.h"
+#include "Util.h"
+#include "WorldPacket.h"
+#include <boost/asio/connect.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+    enum AuthCommand : uint8
+    {
+        AUTH_LOGON_CHALLENGE = 0x00,
+        AUTH_LOGON_PROOF     = 0x01
+    };
+
+    constexpr uint8 WOW_SUCCESS = 0x00;
+
+    constexpr uint16 ClientBuild = 12340;
+    constexpr float RunSpeed = 7.0f;
+    constexpr Seconds PingInterval = 30s; // the worldserver kicks clients pinging more often
+    constexpr std::size_t ChallengeResponseSize = 32 + 1 + 1 + 1 + 32 + 32 + 16 + 1;
+    constexpr std::size_t ProofResponseSize = 20 + 4 + 4 + 2;
+
+    // character names may only use letters
+    std::string MakeCharacterName(uint32 index)
+    {
+        std::string name = "Lt";
+        for (uint32 i = 0; i < 5; ++i, index /= 26)
+            name += char('a' + index % 26);
+
+        return name;
+    }
+}
+
+LoadTestBot::LoadTestBot(boost::asio::io_context& ioContext, LoadTestConfig const& config, LoadTestStats& stats, uint32 index)
+    : _strand(boost::asio::make_strand(ioContext)), _socket(_strand), _moveTimer(_strand), _chatTimer(_strand), _castTimer(_strand), _pingTimer(_strand),
+    _serverInfoTimer(_strand), _config(config), _stats(stats), _index(index), _recvBuffer(64 * 1024)
+{
+    _account = Acore::StringFormat("{}{}", config.AccountPrefix, config.FirstAccount + index);
+    Utf8ToUpperOnlyLatin(_account);
+}
+
+void LoadTestBot::Start()
+{
+    boost::asio::post(_strand, [self = shared_from_this()]()
+    {
+        ++self->_stats.Connecting;
+        self->_start = Clock::now();
+        self->ConnectAuth();
+    });
+}
+
+void LoadTestBot::Stop()
+{
+    boost::asio::post(_strand, [self = shared_from_this()]()
+    {
+        self->_stopped = true;
+        boost::system::error_code ec;
+        self->_socket.close(ec);
+        self->_moveTimer.cancel();
+        self->_chatTimer.cancel();
+        self->_castTimer.cancel();
+        self->_pingTimer.cancel();
+        self->_serverInfoTimer.cancel();
+    });
+}
+
+void LoadTestBot::ConnectAuth()
+{
+    _socket.async_connect(_config.AuthEndpoint, [self = shared_from_this()](boost::system::error_code const& error)
+    {
+        if (error)
+            return self->Fail("can't connect to the authserver");
+
+        self->SendLogonChallenge();
+    });
+}
+
+void LoadTestBot::SendLogonChallenge()
+{
+    ByteBuffer packet;
+    packet << uint8(AUTH_LOGON_CHALLENGE);
+    packet << uint8(8);                                 // protocol version
+    packet << uint16(30 + _account.size());             // size of the rest of the packet
+    packet.append(std::array<uint8, 4>{ 'W', 'o', 'W', 0 });
+    packet << uint8(3) << uint8(3) << uint8(5);
+    packet << uint16(ClientBuild);
+    packet.append(std::array<uint8, 4>{ '6', '8', 'x', 0 });    // x86, reversed
+    packet.append(std::array<uint8, 4>{ 'n', 'i', 'W', 0 });    // Win
+    packet.append(std::array<uint8, 4>{ 'S', 'U', 'n', 'e' });  // enUS
+    packet << uint32(0);                                // timezone bias
+    packet << uint32(0x0100007F);                       // 127.0.0.1
+    packet << uint8(_account.size());
+    packet.append(_account.data(), _account.size());
+
+    _authBuffer.assign(packet.contents(), packet.contents() + packet.size());
+    boost::asio::async_write(_socket, boost::asio::buffer(_authBuffer), [self = shared_from_this()](boost::system::error_code const& error, std::size_t)
+    {
+        if (error)
+            return self->Fail("authserver connection lost");
+
+        self->_authBuffer.resize(3);
+        boost::asio::async_read(self->_socket, boost::asio::buffer(self->_authBuffer), [self](boost::system::error_code const& error, std::size_t)
+        {
+            if (error)
+                return self->Fail("authserver connection lost");
+
+            if (self->_authBuffer[2] != WOW_SUCCESS)
+                return self->Fail("logon challenge refused, does the account exist?");
+
+            self->_authBuffer.resize(ChallengeResponseSize);
+            boost::asio::async_read(self->_socket, boost::asio::buffer(self->_authBuffer), [self](boost::system::error_code const& error, std::size_t)
+            {
+                if (error)
+                    return self->Fail("authserver connection lost");
+
+                self->HandleLogonChallenge();
+            });
+        });
+    });
+}
+
+void LoadTestBot::HandleLogonChallenge()
+{
+    ByteBuffer challenge;
+    challenge.append(_authBuffer.data(), _authBuffer.size());
+
+    Acore::Crypto::SRP6::EphemeralKey B;
+    Acore::Crypto::SRP6::Salt salt;
+    std::array<uint8, 16> versionChallenge;
+    challenge.read(B);
+    challenge.read_skip(1 + 1 + 1 + 32);                // g and N, the usual ones
+    challenge.read(salt);
+    challenge.read(versionChallenge);
+    if (challenge.read<uint8>())
+        return Fail("the account requires a PIN, matrix card or token");
+
+    std::string password = _config.Password;
+    Utf8ToUpperOnlyLatin(password);
+    _proof = Acore::Crypto::SRP6::MakeClientProof(_account, password, salt, B);
+    if (!_proof)
+        return Fail("invalid logon challenge");
+
+    ByteBuffer packet;
+    packet << uint8(AUTH_LOGON_PROOF);
+    packet.append(_proof->A);
+    packet.append(_proof->M);
+    packet.append(Acore::Crypto::SHA1::Digest{});      // crc of the client files
+    packet << uint8(0);                                 // number of keys
+    packet << uint8(0);                                 // security flags
+
+    _authBuffer.assign(packet.contents(), packet.contents() + packet.size());
+    boost::asio::async_write(_socket, boost::asio::buffer(_authBuffer), [self = shared_from_this()](boost::system::error_code const& error, std::size_t)
+    {
+        if (error)
+            return self->Fail("authserver connection lost");
+
+        self->_authBuffer.resize(2);
+        boost::asio::async_read(self->_socket, boost::asio::buffer(self->_authBuffer), [self](boost::system::error_code const& error, std::size_t)
+        {
+            if (error)
+                return self->Fail("authserver connection lost");
+
+            if (self->_authBuffer[1] != WOW_SUCCESS)
+                return self->Fail("wrong password");
+
+            self->_authBuffer.resize(ProofResponseSize);
+            boost::asio::async_read(self->_socket, boost::asio::buffer(self->_authBuffer), [self](boost::system::error_code const& error, std::size_t)
+            {
+                if (error)
+                    return self->Fail("authserver connection lost");
+
+                self->HandleLogonProof();
+            });
+        });
+    });
+}
+
+void LoadTestBot::HandleLogonProof()
+{
+    Acore::Crypto::SHA1::Digest M2;
+    std::memcpy(M2.data(), _authBuffer.data(), M2.size());
+    if (M2 != Acore::Crypto::SRP6::GetSessionVerifier(_proof->A, _proof->M, _proof->K))
+        return Fail("the authserver proof doesn't match");
+
+    // the authserver stored the session key before answering, the realm list isn't needed
+    boost::system::error_code ec;
+    _socket.close(ec);
+    _authBuffer = {};
+    ConnectWorld();
+}
+
+void LoadTestBot::ConnectWorld()
+{
+    _socket.async_connect(_config.WorldEndpoint, [self = shared_from_this()](boost::system::error_code const& error)
+    {
+        if (error)
+            return self->Fail("can't connect to the worldserver");
+
+        boost::system::error_code ec;
+        self->_socket.set_option(boost::asio::ip::tcp::no_delay(true), ec);
+        self->ReadWorld();
+    });
+}
+
+void LoadTestBot::ReadWorld()
+{
+    _socket.async_read_some(boost::asio::buffer(_recvBuffer.data() + _recvSize, _recvBuffer.size() - _recvSize),
+        [self = shared_from_this()](boost::system::error_code const& error, std::size_t transferred)
+    {
+        if (error)
+            return self->Fail("worldserver connection lost");
+
+        self->_recvSize += transferred;
+        self->_stats.BytesReceived += transferred;
+        if (self->ProcessReceived())
+            self->ReadWorld();
+    });
+}
+
+bool LoadTestBot::ProcessReceived()
+{
+    std::size_t pos = 0;
+    while (!_stopped)
+    {
+        std::size_t const available = _recvSize - pos;
+        if (available < 4)
+            break;
+
+        // the header is decrypted once, it may stay in the buffer until its payload arrives
+        uint8* header = _recvBuffer.data() + pos;
+        if (_crypt.IsInitialized() && !_headerDecrypted)
+        {
+            _crypt.DecryptRecv(header, 4);
+            _headerDecrypted = 4;
+        }
+
+        // payloads of 32 KiB and more use a 3 bytes size
+        bool const large = header[0] & 0x80;
+        std::size_t const headerSize = large ? 5 : 4;
+        if (available < headerSize)
+            break;
+
+        if (large && _crypt.IsInitialized() && _headerDecrypted < 5)
+        {
+            _crypt.DecryptRecv(header + 4, 1);
+            _headerDecrypted = 5;
+        }
+
+        uint32 const size = (large ? (uint32(header[0] & 0x7F) << 16 | uint32(header[1]) << 8 | header[2]) : (uint32(header[0]) << 8 | header[1])) - 2;
+        uint16 const opcode = large ? uint16(header[3] | header[4] << 8) : uint16(header[2] | header[3] << 8);
+        if (available < headerSize + size)
+            break;
+
+        WorldPacket packet(opcode, size);
+        if (size)
+            packet.append(header + headerSize, size);
+
+        pos += headerSize + size;
+        _headerDecrypted = 0;
+        ++_stats.PacketsReceived;
+
+        try
+        {
+            HandlePacket(packet);
+        }
+        catch (ByteBufferException const&)
+        {
+            printf("bot %u (%s): malformed packet %s\n", _index, _account.c_str(), GetOpcodeNameForLogging(Opcodes(opcode)).c_str());
+        }
+    }
+
+    if (_stopped)
+        return false;
+
+    std::memmove(_recvBuffer.data(), _recvBuffer.data() + pos, _recvSize - pos);
+    _recvSize -= pos;
+
+    // a packet larger than the buffer
+    if (_recvSize == _recvBuffer.size())
+        _recvBuffer.resize(_recvBuffer.size() * 2);
+
+    return true;
+}
+
+void LoadTestBot::HandlePacket(WorldPacket& packet)
+{
+    switch (packet.GetOpcode())
+    {
+        case SMSG_AUTH_CHALLENGE:
+            HandleAuthChallenge(packet);
+            break;
+        case SMSG_AUTH_RESPONSE:
+            HandleAuthResponse(packet);
+            break;
+        case SMSG_CHAR_ENUM:
+            HandleCharEnum(packet);
+            break;
+        case SMSG_CHAR_CREATE:
+            HandleCharCreate(packet);
+            break;
+        case SMSG_CHARACTER_LOGIN_FAILED:
+            Fail("character login failed");
+            break;
+        case SMSG_LOGIN_VERIFY_WORLD:
+            HandleLoginVerifyWorld(packet);
+            break;
+        case SMSG_TIME_SYNC_REQ:
+            HandleTimeSyncRequest(packet);
+            break;
+        case SMSG_PONG:
+            HandlePong(packet);
+            break;
+        case SMSG_MESSAGECHAT:
+            HandleMessageChat(packet);
+            break;
+        case SMSG_SPELL_START:
+        case SMSG_SPELL_GO:
+        case SMSG_CAST_FAILED:
+            HandleSpellResult(packet);
+            break;
+        default:
+            break;
+    }
+}
+
+void LoadTestBot::HandleAuthChallenge(WorldPacket& packet)
+{
+    std::array<uint8, 4> serverSeed;
+    packet.read_skip<uint32>();
+    packet.read(serverSeed);
+
+    std::array<uint8, 4> const clientSeed = Acore::Crypto::GetRandomBytes<4>();
+    std::array<uint8, 4> const zero = { };
+    Acore::Crypto::SHA1::Digest const digest = Acore::Crypto::SHA1::GetDigestOf(_account, zero, clientSeed, serverSeed, _proof->K);
+
+    WorldPacket authSession(CMSG_AUTH_SESSION, 4 + 4 + _account.size() + 1 + 4 + 4 + 4 + 4 + 4 + 8 + 20 + 4);
+    authSession << uint32(ClientBuild);
+    authSession << uint32(0);                           // login server id
+    authSession << _account;
+    authSession << uint32(0);                           // login server type
+    authSession.append(clientSeed);
+    authSession << uint32(0);                           // region id
+    authSession << uint32(0);                           // battlegroup id
+    authSession << uint32(_config.RealmId);
+    authSession << uint64(0);                           // dos response
+    authSession.append(digest);
+    authSession << uint32(0);                           // no addons
+    SendPacket(authSession);
+
+    // everything after the auth session is encrypted, both ways
+    _crypt.InitClient(_proof->K);
+}
+
+void LoadTestBot::HandleAuthResponse(WorldPacket& packet)
+{
+    uint8 const result = packet.read<uint8>();
+    if (result == AUTH_WAIT_QUEUE)
+    {
+        if (!_queued)
+            ++_stats.Queued;
+
+        _queued = true;
+        return;
+    }
+
+    if (_queued)
+        --_stats.Queued;
+
+    _queued = false;
+    if (result != AUTH_OK)
+        return Fail("worldserver authentication refused");
+
+    SendPacket(WorldPacket(CMSG_CHAR_ENUM, 0));
+}
+
+void LoadTestBot::HandleCharEnum(WorldPacket& packet)
+{
+    if (!packet.read<uint8>())
+    {
+        // human warrior
+        WorldPacket create(CMSG_CHAR_CREATE, 16);
+        create << MakeCharacterName(_config.FirstAccount + _index);
+        create << uint8(RACE_HUMAN) << uint8(CLASS_WARRIOR) << uint8(GENDER_MALE);
+        create << uint8(0) << uint8(0) << uint8(0) << uint8(0) << uint8(0); // skin, face, hair style, hair color, facial hair
+        create << uint8(0);                             // outfit
+        SendPacket(create);
+        return;
+    }
+
+    // the first character of the account
+    std::string name;
+    uint8 race;
+    packet >> _guid >> name >> race;
+    _language = ((1 << (race - 1)) & RACEMASK_ALLIANCE) ? LANG_COMMON : LANG_ORCISH;
+
+    WorldPacket login(CMSG_PLAYER_LOGIN, 8);
+    login << _guid;
+    SendPacket(login);
+}
+
+void LoadTestBot::HandleCharCreate(WorldPacket& packet)
+{
+    if (packet.read<uint8>() != CHAR_CREATE_SUCCESS)
+        return Fail("character creation failed");
+
+    SendPacket(WorldPacket(CMSG_CHAR_ENUM, 0));
+}
+
+void LoadTestBot::HandleLoginVerifyWorld(WorldPacket& packet)
+{
+    float x, y, o;
+    packet.read_skip<uint32>();                         // map
+    packet >> x >> y >> _z >> o;
+
+    // the first point of the path is the login position
+    _x = x;
+    _y = y;
+    _orientation = o;
+    _centerX = x - _config.PathRadius;
+    _centerY = y;
+    _nextPoint = 1;
+
+    if (!_inWorld)
+    {
+        _inWorld = true;
+        --_stats.Connecting;
+        ++_stats.InWorld;
+    }
+
+    // spread the requests of the bots over their intervals
+    ScheduleMove();
+    ScheduleChat();
+    ScheduleCast();
+    SchedulePing();
+    if (!_index && _config.ServerInfoInterval > 0s)
+        ScheduleServerInfo();
+}
+
+void LoadTestBot::HandleTimeSyncRequest(WorldPacket& packet)
+{
+    uint32 const counter = packet.read<uint32>();
+
+    WorldPacket response(CMSG_TIME_SYNC_RESP, 8);
+    response << uint32(counter);
+    response << uint32(std::chrono::duration_cast<Milliseconds>(Clock::now() - _start).count());
+    SendPacket(response);
+}
+
+void LoadTestBot::HandlePong(WorldPacket& packet)
+{
+    if (packet.read<uint32>() != _pingSequence)
+        return;
+
+    Clock::duration const latency = Clock::now() - _pingSent;
+    _lastLatency = uint32(std::chrono::duration_cast<Milliseconds>(latency).count());
+    _stats.AddLatency(LatencyType::Ping, latency);
+}
+
+void LoadTestBot::HandleMessageChat(WorldPacket& packet)
+{
+    uint8 type;
+    int32 language;
+    ObjectGuid sender, receiver;
+    uint32 length;
+    std::string text;
+    packet >> type >> language >> sender;
+    packet.read_skip<uint32>();                         // flags
+
+    if (type != CHAT_MSG_SAY && type != CHAT_MSG_SYSTEM)
+        return;
+
+    packet >> receiver >> length >> text;
+    if (type == CHAT_MSG_SYSTEM)
+    {
+        if (!_index)
+            HandleServerInfoLine(text);
+    }
+    else if (sender == _guid && !_pendingChats.empty())
+    {
+        _stats.AddLatency(LatencyType::Chat, Clock::now() - _pendingChats.front());
+        _pendingChats.pop_front();
+    }
+}
+
+void LoadTestBot::HandleSpellResult(WorldPacket& packet)
+{
+    if (packet.GetOpcode() != SMSG_CAST_FAILED)
+    {
+        ObjectGuid casterItem, caster;
+        packet >> casterItem.ReadAsPacked() >> caster.ReadAsPacked();
+        if (caster != _guid)
+            return;
+    }
+
+    // a start and a go for the same cast, only the first one counts
+    uint8 const castCount = packet.read<uint8>();
+    if (_pendingCasts.empty() || _pendingCasts.front().first != castCount)
+        return;
+
+    _stats.AddLatency(LatencyType::Cast, Clock::now() - _pendingCasts.front().second);
+    _pendingCasts.pop_front();
+}
+
+void LoadTestBot::HandleServerInfoLine(std::string const& line)
+{
+    static LoadTestStats::ServerTick tick;
+    if (std::sscanf(line.c_str(), "Connected players: %*u. Characters in world: %u.", &tick.PlayersInWorld) == 1)
+        return;
+
+    if (std::sscanf(line.c_str(), "Update time diff: %ums.", &tick.Last) == 1)
+        return;
+
+    if (std::sscanf(line.c_str(), "|- Mean: %ums", &tick.Mean) == 1)
+        return;
+
+    // the last line of the summary
+    if (std::sscanf(line.c_str(), "|- Percentiles (95, 99, max): %ums, %ums, %ums", &tick.P95, &tick.P99, &tick.Max) == 3)
+        _stats.SetServerTick(tick);
+}
+
+void LoadTestBot::SendPacket(WorldPacket const& packet)
+{
+    // size of the payload and the opcode, big endian, then the opcode on 4 bytes
+    uint32 const size = uint32(packet.size()) + 4;
+    std::vector<uint8> data(6 + packet.size());
+    data[0] = uint8(size >> 8);
+    data[1] = uint8(size);
+    data[2] = uint8(packet.GetOpcode());
+    data[3] = uint8(packet.GetOpcode() >> 8);
+    data[4] = 0;
+    data[5] = 0;
+    if (_crypt.IsInitialized())
+        _crypt.EncryptSend(data.data(), 6);
+
+    if (!packet.empty())
+        std::memcpy(data.data() + 6, packet.contents(), packet.size());
+
+    ++_stats.PacketsSent;
+    _stats.BytesSent += data.size();
+    _writeQueue.push_back(std::move(data));
+    if (_writeQueue.size() == 1)
+        WriteNext();
+}
+
+void LoadTestBot::WriteNext()
+{
+    boost::asio::async_write(_socket, boost::asio::buffer(_writeQueue.front()), [self = shared_from_this()](boost::system::error_code const& error, std::size_t)
+    {
+        if (error)
+            return self->Fail("worldserver connection lost");
+
+        self->_writeQueue.pop_front();
+        if (!self->_writeQueue.empty())
+            self->WriteNext();
+    });
+}
+
+void LoadTestBot::ScheduleMove()
+{
+    _moveTimer.expires_after(_config.MoveInterval);
+    _moveTimer.async_wait([self = shared_from_this()](boost::system::error_code const& error)
+    {
+        if (error || self->_stopped)
+            return;
+
+        // run towards the next corner of the path
+        float step = RunSpeed * self->_config.MoveInterval.count() / 1000.0f;
+        while (step > 0.0f)
+        {
+            float const angle = 2.0f * float(M_PI) * self->_nextPoint / self->_config.PathPoints;
+            float const dx = self->_centerX + self->_config.PathRadius * std::cos(angle) - self->_x;
+            float const dy = self->_centerY + self->_config.PathRadius * std::sin(angle) - self->_y;
+            float const dist = std::sqrt(dx * dx + dy * dy);
+            float const orientation = std::atan2(dy, dx);
+            self->_orientation = orientation < 0.0f ? orientation + 2.0f * float(M_PI) : orientation;
+            if (dist > step)
+            {
+                self->_x += dx * step / dist;
+                self->_y += dy * step / dist;
+                break;
+            }
+
+            self->_x += dx;
+            self->_y += dy;
+            step -= dist;
+            self->_nextPoint = (self->_nextPoint + 1) % self->_config.PathPoints;
+        }
+
+        self->SendMovement(self->_moving ? MSG_MOVE_HEARTBEAT : MSG_MOVE_START_FORWARD);
+        self->_moving = true;
+        self->ScheduleMove();
+    });
+}
+
+void LoadTestBot::SendMovement(uint16 opcode)
+{
+    WorldPacket packet(opcode, 9 + 4 + 2 + 4 + 16 + 4);
+    packet << _guid.WriteAsPacked();
+    packet << uint32(MOVEMENTFLAG_FORWARD);
+    packet << uint16(0);                                // extra flags
+    packet << uint32(std::chrono::duration_cast<Milliseconds>(Clock::now() - _start).count());
+    packet << _x << _y << _z << _orientation;
+    packet << uint32(0);                                // fall time
+    SendPacket(packet);
+}
+
+void LoadTestBot::ScheduleChat()
+{
+    if (_config.ChatInterval <= 0s)
+        return;
+
+    _chatTimer.expires_after(_pendingChats.empty() && !_moving ? _config.ChatInterval * (_index % 10 + 1) / 10 : _config.ChatInterval);
+    _chatTimer.async_wait([self = shared_from_this()](boost::system::error_code const& error)
+    {
+        if (error || self->_stopped)
+            return;
+
+        self->_pendingChats.push_back(Clock::now());
+        self->SendSay(Acore::StringFormat("load test {}", self->_index));
+        self->ScheduleChat();
+    });
+}
+
+void LoadTestBot::ScheduleCast()
+{
+    if (!_config.CastSpellId || _config.CastInterval <= 0s)
+        return;
+
+    _castTimer.expires_after(_castCount ? _config.CastInterval : _config.CastInterval * (_index % 10 + 1) / 10);
+    _castTimer.async_wait([self = shared_from_this()](boost::system::error_code const& error)
+    {
+        if (error || self->_stopped)
+            return;
+
+        // the cast count tells the answers of consecutive casts apart
+        WorldPacket packet(CMSG_CAST_SPELL, 1 + 4 + 1 + 4);
+        packet << uint8(++self->_castCount);
+        packet << uint32(self->_config.CastSpellId);
+        packet << uint8(0);                             // cast flags
+        packet << uint32(0);                            // no target, self cast
+        self->_pendingCasts.emplace_back(self->_castCount, Clock::now());
+        self->SendPacket(packet);
+
+        // casts the server dropped silently
+        while (self->_pendingCasts.size() > 8)
+            self->_pendingCasts.pop_front();
+
+        self->ScheduleCast();
+    });
+}
+
+void LoadTestBot::SchedulePing()
+{
+    _pingTimer.expires_after(_pingSequence ? Milliseconds(PingInterval) : Milliseconds(PingInterval) * (_index % 10 + 1) / 10);
+    _pingTimer.async_wait([self = shared_from_this()](boost::system::error_code const& error)
+    {
+        if (error || self->_stopped)
+            return;
+
+        WorldPacket packet(CMSG_PING, 8);
+        packet << uint32(++self->_pingSequence);
+        packet << uint32(self->_lastLatency);
+        self->_pingSent = Clock::now();
+        self->SendPacket(packet);
+        self->SchedulePing();
+    });
+}
+
+void LoadTestBot::ScheduleServerInfo()
+{
+    _serverInfoTimer.expires_after(_config.ServerInfoInterval);
+    _serverInfoTimer.async_wait([self = shared_from_this()](boost::system::error_code const& error)
+    {
+        if (error || self->_stopped)
+            return;
+
+        // available to every account, answered with system messages
+        self->SendSay(".server info");
+        self->ScheduleServerInfo();
+    });
+}
+
+void LoadTestBot::SendSay(std::string const& text)
+{
+    WorldPacket packet(CMSG_MESSAGECHAT, 4 + 4 + text.size() + 1);
+    packet << uint32(CHAT_MSG_SAY);
+    packet << uint32(_language);
+    packet << text;
+    SendPacket(packet);
+}
+
+void LoadTestBot::Fail(char const* reason)
+{
+    if (_stopped)
+        return;
+
+    printf("bot %u (%s): %s\n", _index, _account.c_str(), reason);
+
+    if (_inWorld)
+    {
+        --_stats.InWorld;
+        ++_stats.Disconnected;
+    }
+    else
+    {
+        --_stats.Connecting;
+        ++_stats.Failed;
+    }
+
+    if (_queued)
+        --_stats.Queued;
+
+    _stopped = true;
+    boost::system::error_code ec;
+    _socket.close(ec);
+    _moveTimer.cancel();
+    _chatTimer.cancel();
+    _castTimer.cancel();
+    _pingTimer.cancel();
+    _serverInfoTimer.cancel();
+}
@@ -0,0 +1,155 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _LOAD_TEST_BOT_H
+#define _LOAD_TEST_BOT_H
+
+#include "AuthCrypt.h"
+#include "Duration.h"
+#include "ObjectGuid.h"
+#include "SRP6.h"
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/strand.hpp>
+#include <deque>
+#include <memory>
+#include <vector>
+
+class LoadTestStats;
+class WorldPacket;
+
+struct LoadTestConfig
+{
+    boost::asio::ip::tcp::endpoint AuthEndpoint;
+    boost::asio::ip::tcp::endpoint WorldEndpoint;
+    uint32 RealmId = 1;
+    std::string AccountPrefix = "LOADTEST";
+    std::string Password = "LOADTEST";
+    uint32 FirstAccount = 1;
+    uint32 BotCount = 100;
+    Milliseconds LoginInterval = 20ms;  // between two bot logins
+    Milliseconds MoveInterval = 500ms;  // between two heartbeats
+    float PathRadius = 10.0f;           // bots run around their login position
+    uint32 PathPoints = 8;
+    Milliseconds ChatInterval = 10s;
+    uint32 CastSpellId = 6673;          // Battle Shout, known by new warriors
+    Milliseconds CastInterval = 15s;
+    Milliseconds ServerInfoInterval = 10s; // .server info sent by the first bot, 0 to disable
+};
+
+/*
+ * A headless 3.3.5a client: logs into the authserver with SRP6, connects to
+ * the worldserver with the session key, creates a character when the
+ * account has none, enters the world and then runs around its login
+ * position, says something and casts a spell at the configured intervals.
+ * Every handler of a bot runs on its own strand.
+ */
+class LoadTestBot : public std::enable_shared_from_this<LoadTestBot>
+{
+public:
+    LoadTestBot(boost::asio::io_context& ioContext, LoadTestConfig const& config, LoadTestStats& stats, uint32 index);
+
+    void Start();
+    void Stop();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    // authserver
+    void ConnectAuth();
+    void SendLogonChallenge();
+    void HandleLogonChallenge();
+    void HandleLogonProof();
+
+    // worldserver
+    void ConnectWorld();
+    void ReadWorld();
+    bool ProcessReceived();
+    void HandlePacket(WorldPacket& packet);
+    void HandleAuthChallenge(WorldPacket& packet);
+    void HandleAuthResponse(WorldPacket& packet);
+    void HandleCharEnum(WorldPacket& packet);
+    void HandleCharCreate(WorldPacket& packet);
+    void HandleLoginVerifyWorld(WorldPacket& packet);
+    void HandleTimeSyncRequest(WorldPacket& packet);
+    void HandlePong(WorldPacket& packet);
+    void HandleMessageChat(WorldPacket& packet);
+    void HandleSpellResult(WorldPacket& packet);
+    void HandleServerInfoLine(std::string const& line);
+
+    void SendPacket(WorldPacket const& packet);
+    void WriteNext();
+
+    // in world
+    void ScheduleMove();
+    void SendMovement(uint16 opcode);
+    void ScheduleChat();
+    void ScheduleCast();
+    void SchedulePing();
+    void ScheduleServerInfo();
+    void SendSay(std::string const& text);
+
+    void Fail(char const* reason);
+
+    boost::asio::strand<boost::asio::io_context::executor_type> _strand;
+    boost::asio::ip::tcp::socket _socket;
+    boost::asio::steady_timer _moveTimer;
+    boost::asio::steady_timer _chatTimer;
+    boost::asio::steady_timer _castTimer;
+    boost::asio::steady_timer _pingTimer;
+    boost::asio::steady_timer _serverInfoTimer;
+    LoadTestConfig const& _config;
+    LoadTestStats& _stats;
+    uint32 const _index;
+    std::string _account;
+    bool _stopped = false;
+
+    // authentication
+    std::vector<uint8> _authBuffer;
+    std::optional<Acore::Crypto::SRP6::ClientProof> _proof;
+    AuthCrypt _crypt;
+
+    // world connection
+    std::vector<uint8> _recvBuffer;
+    std::size_t _recvSize = 0;
+    std::size_t _headerDecrypted = 0;
+    std::deque<std::vector<uint8>> _writeQueue;
+
+    // character
+    ObjectGuid _guid;
+    uint32 _language = 0;
+    bool _inWorld = false;
+    bool _queued = false;
+    uint32 _clientTime = 0;
+    Clock::time_point _start;
+
+    // path around the login position
+    float _centerX = 0.0f, _centerY = 0.0f, _z = 0.0f;
+    float _x = 0.0f, _y = 0.0f, _orientation = 0.0f;
+    uint32 _nextPoint = 0;
+    bool _moving = false;
+
+    // requests waiting for their answer, answered in order
+    std::deque<Clock::time_point> _pendingChats;
+    std::deque<std::pair<uint8, Clock::time_point>> _pendingCasts;
+    uint8 _castCount = 0;
+    uint32 _pingSequence = 0;
+    Clock::time_point _pingSent;
+    uint32 _lastLatency = 0;
+};
+
+#endif
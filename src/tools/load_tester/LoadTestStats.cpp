@@ -0,0 +1,73 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LoadTestStats.h"
+#include "StringFormat.h"
+#include <algorithm>
+
+namespace
+{
+    constexpr char const* LatencyNames[] = { "ping", "chat", "cast" };
+
+    uint32 GetPercentile(std::vector<uint32>& samples, uint32 percentile)
+    {
+        std::size_t const index = std::min(samples.size() - 1, samples.size() * percentile / 100);
+        std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+        return samples[index];
+    }
+}
+
+void LoadTestStats::AddLatency(LatencyType type, std::chrono::steady_clock::duration latency)
+{
+    uint32 const us = uint32(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+    std::lock_guard<std::mutex> guard(_lock);
+    _latencies[std::size_t(type)].push_back(us);
+}
+
+void LoadTestStats::SetServerTick(ServerTick const& tick)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _serverTick = tick;
+    _hasServerTick = true;
+}
+
+std::string LoadTestStats::BuildReport(std::chrono::seconds elapsed)
+{
+    std::string report = Acore::StringFormat("[{:>5}s] bots: {} in world, {} logging in, {} queued, {} failed, {} disconnected | packets: {} sent, {} received | kB: {} sent, {} received",
+        elapsed.count(), InWorld.load(), Connecting.load(), Queued.load(), Failed.load(), Disconnected.load(),
+        PacketsSent.load(), PacketsReceived.load(), BytesSent.load() / 1024, BytesReceived.load() / 1024);
+
+    std::lock_guard<std::mutex> guard(_lock);
+    for (std::size_t type = 0; type < _latencies.size(); ++type)
+    {
+        std::vector<uint32>& samples = _latencies[type];
+        if (samples.empty())
+            continue;
+
+        uint32 const p50 = GetPercentile(samples, 50);
+        uint32 const p99 = GetPercentile(samples, 99);
+        uint32 const max = GetPercentile(samples, 100);
+        report += Acore::StringFormat(" | {} ms p50: {:.1f} p99: {:.1f} max: {:.1f} ({})", LatencyNames[type], p50 / 1000.0f, p99 / 1000.0f, max / 1000.0f, samples.size());
+        samples.clear();
+    }
+
+    if (_hasServerTick)
+        report += Acore::StringFormat(" | server tick ms last: {} mean: {} p95: {} p99: {} max: {} ({} players)",
+            _serverTick.Last, _serverTick.Mean, _serverTick.P95, _serverTick.P99, _serverTick.Max, _serverTick.PlayersInWorld);
+
+    return report;
+}
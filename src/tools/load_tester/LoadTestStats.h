@@ -0,0 +1,76 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _LOAD_TEST_STATS_H
+#define _LOAD_TEST_STATS_H
+
+#include "Define.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+enum class LatencyType
+{
+    Ping,   // CMSG_PING to SMSG_PONG
+    Chat,   // CMSG_MESSAGECHAT to the echo of our own say
+    Cast,   // CMSG_CAST_SPELL to the spell start, go or failure
+
+    Max
+};
+
+// Counters shared by all bots, latency samples are collected between two reports
+class LoadTestStats
+{
+public:
+    // world tick times as reported by .server info, in ms
+    struct ServerTick
+    {
+        uint32 Last = 0;
+        uint32 Mean = 0;
+        uint32 P95 = 0;
+        uint32 P99 = 0;
+        uint32 Max = 0;
+        uint32 PlayersInWorld = 0;
+    };
+
+    std::atomic<uint32> Connecting{ 0 };
+    std::atomic<uint32> InWorld{ 0 };
+    std::atomic<uint32> Queued{ 0 };
+    std::atomic<uint32> Failed{ 0 };
+    std::atomic<uint32> Disconnected{ 0 };
+    std::atomic<uint64> PacketsSent{ 0 };
+    std::atomic<uint64> PacketsReceived{ 0 };
+    std::atomic<uint64> BytesSent{ 0 };
+    std::atomic<uint64> BytesReceived{ 0 };
+
+    void AddLatency(LatencyType type, std::chrono::steady_clock::duration latency);
+    void SetServerTick(ServerTick const& tick);
+
+    // one line summary, resets the latency samples
+    std::string BuildReport(std::chrono::seconds elapsed);
+
+private:
+    std::mutex _lock;
+    std::array<std::vector<uint32>, std::size_t(LatencyType::Max)> _latencies; // in us
+    ServerTick _serverTick;
+    bool _hasServerTick = false;
+};
+
+#endif
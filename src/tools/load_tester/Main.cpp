@@ -0,0 +1,228 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Headless load test: connects many synthetic 3.3.5a clients to a running
+ * authserver and worldserver and reports what they observe.
+ *
+ * The accounts are not created by the tool, --print-accounts prints the
+ * console commands creating them. The authserver must not check the client
+ * files (StrictVersionCheck = 0).
+ */
+
+#include "IoContext.h"
+#include "LoadTestBot.h"
+#include "LoadTestStats.h"
+#include "Resolver.h"
+#include "StringFormat.h"
+#include <boost/asio/signal_set.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/program_options.hpp>
+#include <csignal>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <thread>
+
+using namespace boost::program_options;
+
+namespace
+{
+    struct Arguments
+    {
+        std::string AuthHost = "127.0.0.1";
+        std::string AuthPort = "3724";
+        std::string WorldHost = "127.0.0.1";
+        std::string WorldPort = "8085";
+        uint32 Duration = 0;
+        uint32 Threads = 0;
+        uint32 ReportInterval = 10;
+        uint32 LoginInterval = 20;
+        uint32 MoveInterval = 500;
+        uint32 ChatInterval = 10000;
+        uint32 CastInterval = 15000;
+        uint32 ServerInfoInterval = 10000;
+    };
+
+    Optional<variables_map> GetConsoleArguments(int argc, char** argv, Arguments& args, LoadTestConfig& config)
+    {
+        options_description all("Allowed options");
+        all.add_options()
+            ("help,h", "print usage message")
+            ("print-accounts", "print the worldserver console commands creating the accounts and exit")
+            ("auth-host", value<std::string>(&args.AuthHost)->default_value(args.AuthHost), "authserver address")
+            ("auth-port", value<std::string>(&args.AuthPort)->default_value(args.AuthPort), "authserver port")
+            ("world-host", value<std::string>(&args.WorldHost)->default_value(args.WorldHost), "worldserver address")
+            ("world-port", value<std::string>(&args.WorldPort)->default_value(args.WorldPort), "worldserver port")
+            ("realm", value<uint32>(&config.RealmId)->default_value(config.RealmId), "id of the realm of the worldserver")
+            ("account-prefix", value<std::string>(&config.AccountPrefix)->default_value(config.AccountPrefix), "accounts are named <prefix><number>")
+            ("password", value<std::string>(&config.Password)->default_value(config.Password), "password of every account")
+            ("first-account", value<uint32>(&config.FirstAccount)->default_value(config.FirstAccount), "number of the first account")
+            ("bots,n", value<uint32>(&config.BotCount)->default_value(config.BotCount), "number of bots")
+            ("duration,d", value<uint32>(&args.Duration)->default_value(args.Duration), "seconds before stopping, 0 to run until interrupted")
+            ("threads,t", value<uint32>(&args.Threads)->default_value(args.Threads), "network threads, 0 for one per core")
+            ("report-interval", value<uint32>(&args.ReportInterval)->default_value(args.ReportInterval), "seconds between two reports")
+            ("login-interval", value<uint32>(&args.LoginInterval)->default_value(args.LoginInterval), "ms between two bot logins")
+            ("move-interval", value<uint32>(&args.MoveInterval)->default_value(args.MoveInterval), "ms between two movement heartbeats")
+            ("path-radius", value<float>(&config.PathRadius)->default_value(config.PathRadius), "radius of the path run by the bots")
+            ("path-points", value<uint32>(&config.PathPoints)->default_value(config.PathPoints), "corners of the path run by the bots")
+            ("chat-interval", value<uint32>(&args.ChatInterval)->default_value(args.ChatInterval), "ms between two says, 0 to disable")
+            ("spell", value<uint32>(&config.CastSpellId)->default_value(config.CastSpellId), "spell cast by the bots, 0 to disable")
+            ("cast-interval", value<uint32>(&args.CastInterval)->default_value(args.CastInterval), "ms between two casts")
+            ("server-info-interval", value<uint32>(&args.ServerInfoInterval)->default_value(args.ServerInfoInterval), "ms between two .server info, 0 to disable");
+
+        variables_map vm;
+
+        try
+        {
+            store(command_line_parser(argc, argv).options(all).run(), vm);
+            notify(vm);
+        }
+        catch (std::exception const& e)
+        {
+            std::cerr << e.what() << "\n";
+            return {};
+        }
+
+        if (vm.count("help"))
+        {
+            std::cout << all << "\n";
+            return {};
+        }
+
+        if (!config.BotCount || config.PathPoints < 3 || !args.ReportInterval)
+        {
+            std::cerr << "--bots must be positive, --path-points at least 3 and --report-interval positive\n";
+            return {};
+        }
+
+        config.LoginInterval = Milliseconds(args.LoginInterval);
+        config.MoveInterval = Milliseconds(std::max<uint32>(args.MoveInterval, 100));
+        config.ChatInterval = Milliseconds(args.ChatInterval);
+        config.CastInterval = Milliseconds(args.CastInterval);
+        config.ServerInfoInterval = Milliseconds(args.ServerInfoInterval);
+        return vm;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Arguments args;
+    LoadTestConfig config;
+    Optional<variables_map> vm = GetConsoleArguments(argc, argv, args, config);
+    if (!vm)
+        return 1;
+
+    if (vm->count("print-accounts"))
+    {
+        for (uint32 i = 0; i < config.BotCount; ++i)
+            printf("account create %s%u %s\n", config.AccountPrefix.c_str(), config.FirstAccount + i, config.Password.c_str());
+
+        return 0;
+    }
+
+    Acore::Asio::IoContext ioContext;
+    Acore::Asio::Resolver resolver(ioContext);
+    Optional<boost::asio::ip::tcp::endpoint> authEndpoint = resolver.Resolve(boost::asio::ip::tcp::v4(), args.AuthHost, args.AuthPort);
+    Optional<boost::asio::ip::tcp::endpoint> worldEndpoint = resolver.Resolve(boost::asio::ip::tcp::v4(), args.WorldHost, args.WorldPort);
+    if (!authEndpoint || !worldEndpoint)
+    {
+        std::cerr << "Can't resolve the authserver or worldserver address\n";
+        return 1;
+    }
+
+    config.AuthEndpoint = *authEndpoint;
+    config.WorldEndpoint = *worldEndpoint;
+
+    LoadTestStats stats;
+    std::vector<std::shared_ptr<LoadTestBot>> bots;
+    bots.reserve(config.BotCount);
+    for (uint32 i = 0; i < config.BotCount; ++i)
+        bots.push_back(std::make_shared<LoadTestBot>(ioContext, config, stats, i));
+
+    using Clock = std::chrono::steady_clock;
+    Clock::time_point const start = Clock::now();
+
+    auto stop = [&]()
+    {
+        for (std::shared_ptr<LoadTestBot> const& bot : bots)
+            bot->Stop();
+
+        ioContext.stop();
+    };
+
+    boost::asio::signal_set signals(ioContext, SIGINT, SIGTERM);
+    signals.async_wait([&](boost::system::error_code const& error, int)
+    {
+        if (!error)
+            stop();
+    });
+
+    // logins are staggered, a burst of SRP6 handshakes would only test the authserver
+    boost::asio::steady_timer loginTimer(ioContext);
+    uint32 started = 0;
+    std::function<void()> startNext = [&]()
+    {
+        bots[started++]->Start();
+        if (started == bots.size())
+            return;
+
+        loginTimer.expires_after(config.LoginInterval);
+        loginTimer.async_wait([&](boost::system::error_code const& error)
+        {
+            if (!error)
+                startNext();
+        });
+    };
+    startNext();
+
+    boost::asio::steady_timer reportTimer(ioContext);
+    Clock::time_point lastReport = start;
+    std::function<void()> scheduleReport = [&]()
+    {
+        reportTimer.expires_after(Seconds(args.ReportInterval));
+        reportTimer.async_wait([&](boost::system::error_code const& error)
+        {
+            if (error)
+                return;
+
+            Clock::time_point const now = Clock::now();
+            std::string const report = stats.BuildReport(std::chrono::duration_cast<Seconds>(now - lastReport));
+            printf("[%4us] %s\n", uint32(std::chrono::duration_cast<Seconds>(now - start).count()), report.c_str());
+            fflush(stdout);
+            lastReport = now;
+
+            if (args.Duration && now - start >= Seconds(args.Duration))
+                stop();
+            else
+                scheduleReport();
+        });
+    };
+    scheduleReport();
+
+    uint32 const threadCount = args.Threads ? args.Threads : std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::thread> threads;
+    for (uint32 i = 1; i < threadCount; ++i)
+        threads.emplace_back([&ioContext]() { ioContext.run(); });
+
+    ioContext.run();
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    return 0;
+}
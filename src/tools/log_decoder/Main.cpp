@@ -0,0 +1,192 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Appender.h"
+#include "BinaryLogFormat.h"
+#include "ByteConverter.h"
+#include "LogMessage.h"
+#include "Timer.h"
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+
+using namespace Acore::BinaryLog;
+
+namespace
+{
+    template<class T>
+    bool Read(FILE* file, T& value)
+    {
+        if (fread(&value, sizeof(T), 1, file) != 1)
+            return false;
+
+        EndianConvert(value);
+        return true;
+    }
+
+    template<class Length>
+    bool ReadString(FILE* file, std::string& str)
+    {
+        Length length;
+        if (!Read(file, length))
+            return false;
+
+        str.resize(length);
+        return !length || fread(str.data(), 1, length, file) == length;
+    }
+
+    std::string JsonEscape(std::string const& str)
+    {
+        std::string result;
+        result.reserve(str.size() + 16);
+
+        for (char c : str)
+        {
+            switch (c)
+            {
+                case '"':  result += "\\\""; break;
+                case '\\': result += "\\\\"; break;
+                case '\b': result += "\\b";  break;
+                case '\f': result += "\\f";  break;
+                case '\n': result += "\\n";  break;
+                case '\r': result += "\\r";  break;
+                case '\t': result += "\\t";  break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        char buf[8];
+                        snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned char>(c));
+                        result += buf;
+                    }
+                    else
+                        result += c;
+                    break;
+            }
+        }
+
+        return result;
+    }
+
+    void PrintMessage(std::string const& loggerType, uint8 level, uint64 time, std::string const& text, bool jsonl)
+    {
+        std::string sev = Appender::getLogLevelString(LogLevel(level));
+        if (jsonl)
+        {
+            for (char& c : sev)
+                c = char(std::tolower(static_cast<unsigned char>(c)));
+
+            std::cout << "{\"ts\":\"" << Acore::Time::TimeToTimestampStr(Seconds(time), "%Y-%m-%dT%X")
+                << "\",\"sev\":\"" << sev
+                << "\",\"cat\":\"" << JsonEscape(loggerType)
+                << "\",\"msg\":\"" << JsonEscape(text) << "\"}\n";
+        }
+        else
+            std::cout << LogMessage::getTimeStr(Seconds(time)) << ' ' << sev << " [" << loggerType << "] " << text << '\n';
+    }
+
+    bool DecodeFile(char const* fileName, bool jsonl)
+    {
+        FILE* file = fopen(fileName, "rb");
+        if (!file)
+        {
+            std::cerr << "can't open " << fileName << std::endl;
+            return false;
+        }
+
+        uint32 magic = 0;
+        uint16 version = 0;
+        if (!Read(file, magic) || !Read(file, version) || magic != Magic || version != Version)
+        {
+            std::cerr << fileName << " is not a binary log of version " << Version << std::endl;
+            fclose(file);
+            return false;
+        }
+
+        std::unordered_map<uint16, std::string> loggerTypes;
+        std::string text;
+        bool ok = true;
+
+        uint8 record;
+        while (Read(file, record))
+        {
+            if (record == BINARY_LOG_RECORD_LOGGER_TYPE)
+            {
+                uint16 id;
+                std::string loggerType;
+                if (!Read(file, id) || !ReadString<uint16>(file, loggerType))
+                {
+                    ok = false;
+                    break;
+                }
+
+                loggerTypes[id] = std::move(loggerType);
+            }
+            else if (record == BINARY_LOG_RECORD_MESSAGE)
+            {
+                uint16 loggerTypeId;
+                uint8 level;
+                uint64 time;
+                if (!Read(file, loggerTypeId) || !Read(file, level) || !Read(file, time) || !ReadString<uint32>(file, text))
+                {
+                    ok = false;
+                    break;
+                }
+
+                auto itr = loggerTypes.find(loggerTypeId);
+                PrintMessage(itr != loggerTypes.end() ? itr->second : "unknown", level, time, text, jsonl);
+            }
+            else
+            {
+                ok = false;
+                break;
+            }
+        }
+
+        // the last record of a server which didn't stop cleanly may be cut
+        if (!ok)
+            std::cerr << fileName << ": truncated or corrupted record at offset " << ftell(file) << std::endl;
+
+        fclose(file);
+        return ok;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    bool jsonl = false;
+    int firstFile = 1;
+    if (argc > 1 && !strcmp(argv[1], "--jsonl"))
+    {
+        jsonl = true;
+        ++firstFile;
+    }
+
+    if (firstFile >= argc)
+    {
+        std::cout << "usage: " << argv[0] << " [--jsonl] <binary log file>..." << std::endl;
+        return 1;
+    }
+
+    bool ok = true;
+    for (int i = firstFile; i < argc; ++i)
+        ok = DecodeFile(argv[i], jsonl) && ok;
+
+    return ok ? 0 : 1;
+}
@@ -17,11 +17,14 @@
 
 #define _CRT_SECURE_NO_DEPRECATE
 
+#include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include <cstdlib>
 #include <deque>
 #include <filesystem>
 #include <set>
+#include <thread>
 #include <unordered_map>
 #include <cstring>
 
@@ -56,7 +59,7 @@
 #else
 #define OPEN_FLAGS (O_RDONLY | O_BINARY)
 #endif
-extern ArchiveSet gOpenArchives;
+extern thread_local ArchiveSet gOpenArchives;
 
 // cppcheck-suppress ctuOneDefinitionRuleViolation
 typedef struct
@@ -96,8 +99,12 @@ float CONF_use_minHeight = -500.0f;
 bool  CONF_allow_float_to_int   = true;
 float CONF_float_to_int8_limit  = 2.0f;      // Max accuracy = val/256
 float CONF_float_to_int16_limit = 2048.0f;   // Max accuracy = val/65536
+bool  CONF_allow_chunked_int8 = true;        // Store as uint8 with a base height and step per cell, if every cell allows it
+float CONF_chunked_int8_limit = 8.0f;        // Max height difference within a cell, max accuracy = val/256
 float CONF_flat_height_delta_limit = 0.005f; // If max - min less this value - surface is flat
 float CONF_flat_liquid_delta_limit = 0.001f; // If max - min less this value - liquid surface is flat
+// Number of threads converting map tiles, each with its own archive handles
+uint32 CONF_threads = 1;
 
 // List MPQ for extract from
 const char* CONF_mpq_list[] =
@@ -162,6 +169,8 @@ void Usage(char* prg)
         "-o set output path\n"\
         "-e extract only MAP(1)/DBC(2)/Camera(4) - standard: all(7)\n"\
         "-f height stored as int (less map size but lost some accuracy) 1 by default\n"\
+        "-c height stored as int per cell when -f allows it (less map size, accuracy depends on cell height difference) 1 by default\n"\
+        "-t, --threads number of threads converting map tiles, 0 uses all cores - 1 by default\n"\
         "Example: %s -f 0 -i \"c:\\games\\game\"", prg, prg);
     exit(1);
 }
@@ -174,13 +183,17 @@ void HandleArgs(int argc, char* arg[])
         // o - output path
         // e - extract only MAP(1)/DBC(2) - standard both(3)
         // f - use float to int conversion
+        // c - use float to int conversion per cell
         // h - limit minimum height
+        // t - number of map conversion threads
         if (arg[c][0] != '-')
         {
             Usage(arg[0]);
         }
 
-        switch (arg[c][1])
+        // same option name as mmaps_generator
+        char const option = strcmp(arg[c], "--threads") == 0 ? 't' : arg[c][1];
+        switch (option)
         {
             case 'i':
                 if (c + 1 < argc)                           // all ok
@@ -214,6 +227,28 @@ void HandleArgs(int argc, char* arg[])
                     Usage(arg[0]);
                 }
                 break;
+            case 'c':
+                if (c + 1 < argc)                           // all ok
+                {
+                    CONF_allow_chunked_int8 = atoi(arg[(c++) + 1]) != 0;
+                }
+                else
+                {
+                    Usage(arg[0]);
+                }
+                break;
+            case 't':
+                if (c + 1 < argc)                           // all ok
+                {
+                    CONF_threads = atoi(arg[(c++) + 1]);
+                    if (!CONF_threads)
+                        CONF_threads = std::max(std::thread::hardware_concurrency(), 1u);
+                }
+                else
+                {
+                    Usage(arg[0]);
+                }
+                break;
             case 'e':
                 if (c + 1 < argc)                           // all ok
                 {
@@ -317,7 +352,7 @@ void ReadLiquidTypeTableDBC()
 
 // Map file format data
 static char const* MAP_MAGIC         = "MAPS";
-static uint32 const MAP_VERSION_MAGIC = 9;
+static uint32 const MAP_VERSION_MAGIC = 10;
 static char const* MAP_AREA_MAGIC    = "AREA";
 static char const* MAP_HEIGHT_MAGIC  = "MHGT";
 static char const* MAP_LIQUID_MAGIC  = "MLIQ";
@@ -350,6 +385,7 @@ struct map_areaHeader
 #define MAP_HEIGHT_AS_INT16             0x0002
 #define MAP_HEIGHT_AS_INT8              0x0004
 #define MAP_HEIGHT_HAS_FLIGHT_BOUNDS    0x0008
+#define MAP_HEIGHT_AS_CHUNKED_INT8      0x0010
 
 struct map_heightHeader
 {
@@ -392,24 +428,76 @@ float selectUInt16StepStore(float maxDiff)
 {
     return 65535 / maxDiff;
 }
-// Temporary grid data store
-uint16 area_ids[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+// Temporary grid data store, one per conversion thread
+thread_local uint16 area_ids[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+
+thread_local float V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local float V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
+thread_local uint16 uint16_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local uint16 uint16_V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
+thread_local uint8  uint8_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local uint8  uint8_V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
+// Per cell packed heights, points on cell borders are stored by every cell they belong to
+thread_local float  chunked_height[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+thread_local float  chunked_multiplier[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+thread_local uint8  chunked_V8[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID][ADT_CELL_SIZE * ADT_CELL_SIZE];
+thread_local uint8  chunked_V9[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID][(ADT_CELL_SIZE + 1) * (ADT_CELL_SIZE + 1)];
+
+thread_local uint16 liquid_entry[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+thread_local uint8 liquid_flags[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+thread_local bool  liquid_show[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local float liquid_height[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
+thread_local uint16 holes[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+
+thread_local int16 flight_box_max[3][3];
+thread_local int16 flight_box_min[3][3];
+
+// Packs V9 and V8 as uint8 with a base height and step per cell, false if a cell is too steep for it
+bool PackChunkedHeights()
+{
+    for (int i = 0; i < ADT_CELLS_PER_GRID; i++)
+    {
+        for (int j = 0; j < ADT_CELLS_PER_GRID; j++)
+        {
+            float minHeight = V9[i * ADT_CELL_SIZE][j * ADT_CELL_SIZE];
+            float maxHeight = minHeight;
+            for (int y = 0; y <= ADT_CELL_SIZE; y++)
+            {
+                for (int x = 0; x <= ADT_CELL_SIZE; x++)
+                {
+                    float h = V9[i * ADT_CELL_SIZE + y][j * ADT_CELL_SIZE + x];
+                    if (maxHeight < h) maxHeight = h;
+                    if (minHeight > h) minHeight = h;
+                }
+            }
+            for (int y = 0; y < ADT_CELL_SIZE; y++)
+            {
+                for (int x = 0; x < ADT_CELL_SIZE; x++)
+                {
+                    float h = V8[i * ADT_CELL_SIZE + y][j * ADT_CELL_SIZE + x];
+                    if (maxHeight < h) maxHeight = h;
+                    if (minHeight > h) minHeight = h;
+                }
+            }
 
-float V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-float V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
-uint16 uint16_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-uint16 uint16_V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
-uint8  uint8_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-uint8  uint8_V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
+            float diff = maxHeight - minHeight;
+            if (diff >= CONF_chunked_int8_limit)
+                return false;
 
-uint16 liquid_entry[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-uint8 liquid_flags[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-bool  liquid_show[ADT_GRID_SIZE][ADT_GRID_SIZE];
-float liquid_height[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
-uint16 holes[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+            float step = diff > 0.0f ? selectUInt8StepStore(diff) : 0.0f;
+            chunked_height[i][j] = minHeight;
+            chunked_multiplier[i][j] = diff / 255;
+            for (int y = 0; y <= ADT_CELL_SIZE; y++)
+                for (int x = 0; x <= ADT_CELL_SIZE; x++)
+                    chunked_V9[i][j][y * (ADT_CELL_SIZE + 1) + x] = uint8((V9[i * ADT_CELL_SIZE + y][j * ADT_CELL_SIZE + x] - minHeight) * step + 0.5f);
+            for (int y = 0; y < ADT_CELL_SIZE; y++)
+                for (int x = 0; x < ADT_CELL_SIZE; x++)
+                    chunked_V8[i][j][y * ADT_CELL_SIZE + x] = uint8((V8[i * ADT_CELL_SIZE + y][j * ADT_CELL_SIZE + x] - minHeight) * step + 0.5f);
+        }
+    }
 
-int16 flight_box_max[3][3];
-int16 flight_box_min[3][3];
+    return true;
+}
 
 bool ConvertADT(std::string const& inputPath, std::string const& outputPath, int /*cell_y*/, int /*cell_x*/, uint32 build)
 {
@@ -631,6 +719,8 @@ bool ConvertADT(std::string const& inputPath, std::string const& outputPath, int
                 heightHeader.flags |= MAP_HEIGHT_AS_INT8;
                 step = selectUInt8StepStore(diff);
             }
+            else if (CONF_allow_chunked_int8 && PackChunkedHeights()) // As uint8 per cell (max accuracy = CONF_chunked_int8_limit/256)
+                heightHeader.flags |= MAP_HEIGHT_AS_CHUNKED_INT8;
             else if (diff < CONF_float_to_int16_limit) // As uint16 (max accuracy = CONF_float_to_int16_limit/65536)
             {
                 heightHeader.flags |= MAP_HEIGHT_AS_INT16;
@@ -659,6 +749,8 @@ bool ConvertADT(std::string const& inputPath, std::string const& outputPath, int
                     uint16_V9[y][x] = uint16((V9[y][x] - minHeight) * step + 0.5f);
             map.heightMapSize += sizeof(uint16_V9) + sizeof(uint16_V8);
         }
+        else if (heightHeader.flags & MAP_HEIGHT_AS_CHUNKED_INT8)
+            map.heightMapSize += sizeof(chunked_height) + sizeof(chunked_multiplier) + sizeof(chunked_V9) + sizeof(chunked_V8);
         else
             map.heightMapSize += sizeof(V9) + sizeof(V8);
     }
@@ -935,6 +1027,13 @@ bool ConvertADT(std::string const& inputPath, std::string const& outputPath, int
             fwrite(uint8_V9, sizeof(uint8_V9), 1, output);
             fwrite(uint8_V8, sizeof(uint8_V8), 1, output);
         }
+        else if (heightHeader.flags & MAP_HEIGHT_AS_CHUNKED_INT8)
+        {
+            fwrite(chunked_height, sizeof(chunked_height), 1, output);
+            fwrite(chunked_multiplier, sizeof(chunked_multiplier), 1, output);
+            fwrite(chunked_V9, sizeof(chunked_V9), 1, output);
+            fwrite(chunked_V8, sizeof(chunked_V8), 1, output);
+        }
         else
         {
             fwrite(V9, sizeof(V9), 1, output);
@@ -973,12 +1072,19 @@ bool ConvertADT(std::string const& inputPath, std::string const& outputPath, int
     return true;
 }
 
-void ExtractMapsFromMpq(uint32 build)
+struct ADTJob
 {
-    std::string mpqFileName;
-    std::string outputFileName;
-    std::string mpqMapName;
+    uint32 mapIndex;
+    uint32 x;
+    uint32 y;
+};
 
+void LoadLocaleMPQFiles(int const locale);
+void LoadCommonMPQFiles();
+void CloseMPQFiles();
+
+void ExtractMapsFromMpq(uint32 build, int locale)
+{
     printf("Extracting maps...\n");
 
     uint32 map_count = ReadMapDBC();
@@ -989,12 +1095,11 @@ void ExtractMapsFromMpq(uint32 build)
     path += "/maps/";
     CreateDir(path);
 
-    printf("Convert map files\n");
+    // Loadup map grid data, every tile is converted on its own
+    std::vector<ADTJob> jobs;
     for (uint32 z = 0; z < map_count; ++z)
     {
-        printf("Extract %s (%d/%u)                  \n", map_ids[z].name, z + 1, map_count);
-        // Loadup map grid data
-        mpqMapName = Acore::StringFormat(R"(World\Maps\{}\{}.wdt)", map_ids[z].name, map_ids[z].name);
+        std::string mpqMapName = Acore::StringFormat(R"(World\Maps\{}\{}.wdt)", map_ids[z].name, map_ids[z].name);
         WDT_file wdt;
         if (!wdt.loadFile(mpqMapName, false))
         {
@@ -1003,18 +1108,50 @@ void ExtractMapsFromMpq(uint32 build)
         }
 
         for (uint32 y = 0; y < WDT_MAP_SIZE; ++y)
-        {
             for (uint32 x = 0; x < WDT_MAP_SIZE; ++x)
-            {
-                if (!wdt.main->adt_list[y][x].exist)
-                    continue;
-                mpqFileName = Acore::StringFormat(R"(World\Maps\{}\{}_{}_{}.adt)", map_ids[z].name, map_ids[z].name, x, y);
-                outputFileName = Acore::StringFormat("{}/maps/{:03}{:02}{:02}.map", output_path, map_ids[z].id, y, x);
-                ConvertADT(mpqFileName, outputFileName, y, x, build);
-            }
+                if (wdt.main->adt_list[y][x].exist)
+                    jobs.push_back({ z, x, y });
+    }
+
+    printf("Convert %u map files with %u threads\n", uint32(jobs.size()), CONF_threads);
+    std::atomic<std::size_t> nextJob = 0;
+    std::atomic<std::size_t> doneJobs = 0;
+    auto convertTiles = [&]()
+    {
+        for (std::size_t i = nextJob++; i < jobs.size(); i = nextJob++)
+        {
+            ADTJob const& job = jobs[i];
+            map_id const& map = map_ids[job.mapIndex];
+            std::string mpqFileName = Acore::StringFormat(R"(World\Maps\{}\{}_{}_{}.adt)", map.name, map.name, job.x, job.y);
+            std::string outputFileName = Acore::StringFormat("{}/maps/{:03}{:02}{:02}.map", output_path, map.id, job.y, job.x);
+            ConvertADT(mpqFileName, outputFileName, job.y, job.x, build);
+
             // draw progress bar
-            printf("Processing........................%d%%\r", (100 * (y + 1)) / WDT_MAP_SIZE);
+            std::size_t const done = ++doneJobs;
+            if ((100 * done) / jobs.size() != (100 * (done - 1)) / jobs.size())
+                printf("Processing........................%u%%\r", uint32((100 * done) / jobs.size()));
+        }
+    };
+
+    if (CONF_threads <= 1)
+        convertTiles();
+    else
+    {
+        std::vector<std::thread> threads;
+        for (uint32 i = 0; i < CONF_threads; ++i)
+        {
+            threads.emplace_back([&]()
+            {
+                // libmpq archive handles can't be shared between threads
+                LoadLocaleMPQFiles(locale);
+                LoadCommonMPQFiles();
+                convertTiles();
+                CloseMPQFiles();
+            });
         }
+
+        for (std::thread& thread : threads)
+            thread.join();
     }
     printf("\n");
 }
@@ -1172,7 +1309,7 @@ void LoadCommonMPQFiles()
     }
 }
 
-inline void CloseMPQFiles()
+void CloseMPQFiles()
 {
     for (auto & gOpenArchive : gOpenArchives) gOpenArchive->close();
     gOpenArchives.clear();
@@ -1251,7 +1388,7 @@ int main(int argc, char* arg[])
         LoadCommonMPQFiles();
 
         // Extract maps
-        ExtractMapsFromMpq(build);
+        ExtractMapsFromMpq(build, FirstLocale);
 
         // Close MPQs
         CloseMPQFiles();
@@ -19,7 +19,7 @@
 #include <cstdio>
 #include <deque>
 
-ArchiveSet gOpenArchives;
+thread_local ArchiveSet gOpenArchives;
 
 MPQArchive::MPQArchive(const char* filename)
 {
@@ -190,6 +190,7 @@ namespace MMAP
         tryBoolean(mmapsNode, "skipJunkMaps", _skipJunkMaps);
         tryBoolean(mmapsNode, "skipBattlegrounds", _skipBattlegrounds);
         tryBoolean(mmapsNode, "debugOutput", _debugOutput);
+        tryBoolean(mmapsNode, "compressTiles", _compressTiles);
 
         std::string dataDirPath;
         tryString(mmapsNode, "dataDir", dataDirPath);
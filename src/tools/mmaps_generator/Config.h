@@ -70,6 +70,7 @@ namespace MMAP
         bool ShouldSkipJunkMaps() const { return _skipJunkMaps; }
         bool ShouldSkipBattlegrounds() const { return _skipBattlegrounds; }
         bool IsDebugOutputEnabled() const { return _debugOutput; }
+        bool ShouldCompressTiles() const { return _compressTiles; }
 
         std::string VMapsPath() const { return (_dataDir / "vmaps").string(); }
         std::string MapsPath() const { return (_dataDir / "maps").string(); }
@@ -151,6 +152,7 @@ namespace MMAP
         bool _skipJunkMaps;
         bool _skipBattlegrounds;
         bool _debugOutput;
+        bool _compressTiles{false};
 
         std::filesystem::path _dataDir;
     };
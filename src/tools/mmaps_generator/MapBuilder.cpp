@@ -27,6 +27,8 @@
 #include "PathCommon.h"
 #include "StringFormat.h"
 #include "VMapMgr2.h"
+#include <filesystem>
+#include <zlib.h>
 
 namespace MMAP
 {
@@ -55,7 +57,7 @@ namespace MMAP
             m_workerThread.join();
     }
 
-    MapBuilder::MapBuilder(Config* config, int mapid, const char* offMeshFilePath, unsigned int threads) :
+    MapBuilder::MapBuilder(Config* config, int mapid, const char* offMeshFilePath, unsigned int threads, uint32 memoryBudget) :
         m_config             (config),
         m_debugOutput        (config->IsDebugOutputEnabled()),
         m_offMeshFilePath    (offMeshFilePath),
@@ -67,8 +69,7 @@ namespace MMAP
         m_mapid              (mapid),
         m_totalTiles         (0u),
         m_totalTilesProcessed(0u),
-
-        _cancelationToken    (false)
+        m_memoryBudget       (uint64(memoryBudget) * 1024 * 1024)
     {
         m_terrainBuilder = new TerrainBuilder(config->DataDirPath(), config->ShouldSkipLiquid());
 
@@ -202,15 +203,18 @@ namespace MMAP
     void MapBuilder::buildMaps(Optional<uint32> mapID)
     {
         printf("Using %u threads to generate mmaps\n", m_threads);
+        if (m_memoryBudget)
+            printf("Limiting tile builds to an estimated %u MB of intermediate data\n", uint32(m_memoryBudget / 1024 / 1024));
 
         for (unsigned int i = 0; i < m_threads; ++i)
         {
             m_tileBuilders.push_back(new TileBuilder(this, m_skipLiquid, m_debugOutput));
         }
 
+        std::vector<TileInfo> tileInfos;
         if (mapID)
         {
-            buildMap(*mapID);
+            buildMap(*mapID, tileInfos);
         }
         else
         {
@@ -218,18 +222,24 @@ namespace MMAP
             for (TileList::iterator it = m_tiles.begin(); it != m_tiles.end(); ++it)
             {
                 if (!shouldSkipMap(it->m_mapId))
-                    buildMap(it->m_mapId);
+                    buildMap(it->m_mapId, tileInfos);
             }
         }
 
-        while (!_queue.Empty())
+        // queue the tiles of all maps together, the most expensive first, so the
+        // workers don't idle at the end of each map and finish on small tiles
+        std::stable_sort(tileInfos.begin(), tileInfos.end(), [](TileInfo const& left, TileInfo const& right)
         {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-        }
+            return left.m_cost > right.m_cost;
+        });
 
-        _cancelationToken = true;
+        {
+            std::lock_guard<std::mutex> lock(m_tileQueueLock);
+            m_tileQueue.assign(tileInfos.begin(), tileInfos.end());
+        }
+        m_tileQueueCondition.notify_all();
 
-        _queue.Cancel();
+        closeTileQueue();
 
         for (auto& builder : m_tileBuilders)
             delete builder;
@@ -366,6 +376,8 @@ namespace MMAP
         TileBuilder tileBuilder = TileBuilder(this, m_skipLiquid, m_debugOutput);
         tileBuilder.buildMoveMapTile(mapId, tileX, tileY, data, bmin, bmax, navMesh);
         fclose(file);
+
+        closeTileQueue();
     }
 
     /**************************************************************************/
@@ -385,38 +397,112 @@ namespace MMAP
         tileBuilder.buildTile(mapID, tileX, tileY, navMesh);
         dtFreeNavMesh(navMesh);
 
-        _cancelationToken = true;
-
-        _queue.Cancel();
+        closeTileQueue();
     }
 
     void TileBuilder::WorkerThread()
     {
-        while (true)
+        TileInfo tileInfo;
+        while (m_mapBuilder->popTile(tileInfo))
         {
-            TileInfo tileInfo;
-
-            m_mapBuilder->_queue.WaitAndPop(tileInfo);
-
-            if (m_mapBuilder->_cancelationToken)
-                return;
-
             dtNavMesh* navMesh = dtAllocNavMesh();
             if (!navMesh->init(&tileInfo.m_navMeshParams))
             {
                 printf("[Map %04i] Failed creating navmesh for tile %i,%i !\n", tileInfo.m_mapId, tileInfo.m_tileX, tileInfo.m_tileY);
                 dtFreeNavMesh(navMesh);
+                m_mapBuilder->releaseTile(tileInfo);
                 return;
             }
 
             buildTile(tileInfo.m_mapId, tileInfo.m_tileX, tileInfo.m_tileY, navMesh);
 
             dtFreeNavMesh(navMesh);
+            m_mapBuilder->releaseTile(tileInfo);
         }
     }
 
     /**************************************************************************/
-    void MapBuilder::buildMap(uint32 mapID)
+    bool MapBuilder::popTile(TileInfo& tileInfo)
+    {
+        std::unique_lock<std::mutex> lock(m_tileQueueLock);
+        while (true)
+        {
+            if (!m_tileQueue.empty())
+            {
+                // a tile always starts when nothing else is being built, even above the budget
+                auto fits = [this](TileInfo const& tile)
+                {
+                    return !m_memoryBudget || !m_memoryReserved || m_memoryReserved + tile.m_cost <= m_memoryBudget;
+                };
+
+                // while the heaviest tile waits for memory, take the lightest one instead
+                if (fits(m_tileQueue.front()))
+                {
+                    tileInfo = m_tileQueue.front();
+                    m_tileQueue.pop_front();
+                }
+                else if (fits(m_tileQueue.back()))
+                {
+                    tileInfo = m_tileQueue.back();
+                    m_tileQueue.pop_back();
+                }
+                else
+                {
+                    m_tileQueueCondition.wait(lock);
+                    continue;
+                }
+
+                m_memoryReserved += tileInfo.m_cost;
+                return true;
+            }
+
+            if (m_tileQueueClosed)
+                return false;
+
+            m_tileQueueCondition.wait(lock);
+        }
+    }
+
+    void MapBuilder::releaseTile(TileInfo const& tileInfo)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_tileQueueLock);
+            m_memoryReserved -= tileInfo.m_cost;
+        }
+        m_tileQueueCondition.notify_all();
+    }
+
+    void MapBuilder::closeTileQueue()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_tileQueueLock);
+            m_tileQueueClosed = true;
+        }
+        m_tileQueueCondition.notify_all();
+    }
+
+    /**************************************************************************/
+    uint64 MapBuilder::estimateTileCost(uint32 mapID, uint32 tileX, uint32 tileY) const
+    {
+        // Recast's heightfields grow with the terrain and model geometry of the tile,
+        // the sizes of its map and vmap files are cheap to get and rank tiles well enough
+        std::error_code error;
+        uint64 cost = 0;
+
+        std::uintmax_t mapSize = std::filesystem::file_size(Acore::StringFormat("{}/{:03}{:02}{:02}.map", m_config->MapsPath(), mapID, tileY, tileX), error);
+        if (!error)
+            cost += uint64(mapSize) * 16;
+
+        // every spawn record of the vmtile brings a whole model into the tile
+        std::uintmax_t vmapSize = std::filesystem::file_size(Acore::StringFormat("{}/{:03}_{:02}_{:02}.vmtile", m_config->VMapsPath(), mapID, tileX, tileY), error);
+        if (!error)
+            cost += uint64(vmapSize) * 1024;
+
+        return cost;
+    }
+
+    /**************************************************************************/
+    void MapBuilder::buildMap(uint32 mapID, std::vector<TileInfo>& tileInfos)
     {
         std::set<uint32>* tiles = getTileList(mapID);
 
@@ -445,8 +531,9 @@ namespace MMAP
                 tileInfo.m_mapId = mapID;
                 tileInfo.m_tileX = tileX;
                 tileInfo.m_tileY = tileY;
+                tileInfo.m_cost = estimateTileCost(mapID, tileX, tileY);
                 memcpy(&tileInfo.m_navMeshParams, navMesh->getParams(), sizeof(dtNavMeshParams));
-                _queue.Push(tileInfo);
+                tileInfos.push_back(tileInfo);
             }
 
             dtFreeNavMesh(navMesh);
@@ -885,10 +972,30 @@ namespace MMAP
             header.usesLiquids = m_terrainBuilder->usesLiquids();
             header.size = uint32(navDataSize);
             header.recastConfig = cfg.toMMAPTileRecastConfig();
+
+            std::vector<Bytef> compressedData;
+            if (m_mapBuilder->getConfig().ShouldCompressTiles())
+            {
+                uLongf compressedSize = compressBound(uLong(navDataSize));
+                compressedData.resize(sizeof(uint32) + compressedSize);
+                memcpy(compressedData.data(), &header.size, sizeof(uint32));
+                if (compress2(compressedData.data() + sizeof(uint32), &compressedSize, navData, uLong(navDataSize), Z_BEST_COMPRESSION) == Z_OK)
+                {
+                    compressedData.resize(sizeof(uint32) + compressedSize);
+                    header.compressed = true;
+                    header.size = uint32(compressedData.size());
+                }
+                else
+                    printf("%s Failed compressing tile, writing it uncompressed\n", tileString);
+            }
+
             fwrite(&header, sizeof(MmapTileHeader), 1, file);
 
             // write data
-            fwrite(navData, sizeof(unsigned char), navDataSize, file);
+            if (header.compressed)
+                fwrite(compressedData.data(), sizeof(Bytef), compressedData.size(), file);
+            else
+                fwrite(navData, sizeof(unsigned char), navDataSize, file);
             fclose(file);
 
             // now that tile is written to disk, we can unload it
@@ -1056,6 +1163,9 @@ namespace MMAP
         if (header.mmapVersion != MMAP_VERSION)
             return false;
 
+        if (bool(header.compressed) != m_mapBuilder->getConfig().ShouldCompressTiles())
+            return false;
+
         const auto desiredRecastConfig = m_mapBuilder->getConfig().GetConfigForTile(mapID, tileX, tileY).toMMAPTileRecastConfig();
         return header.recastConfig == desiredRecastConfig;
     }
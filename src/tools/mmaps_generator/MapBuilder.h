@@ -19,7 +19,10 @@
 #define _MAP_BUILDER_H
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <list>
+#include <mutex>
 #include <set>
 #include <thread>
 #include <vector>
@@ -29,7 +32,6 @@
 #include "TerrainBuilder.h"
 
 #include "DetourNavMesh.h"
-#include "PCQueue.h"
 #include "Recast.h"
 
 using namespace VMAP;
@@ -74,11 +76,13 @@ namespace MMAP
 
     struct TileInfo
     {
-        TileInfo() : m_mapId(uint32(-1)), m_tileX(), m_tileY(), m_navMeshParams() {}
+        TileInfo() : m_mapId(uint32(-1)), m_tileX(), m_tileY(), m_cost(), m_navMeshParams() {}
 
         uint32 m_mapId;
         uint32 m_tileX;
         uint32 m_tileY;
+        // estimated intermediate memory of the tile build, in bytes
+        uint64 m_cost;
         dtNavMeshParams m_navMeshParams;
     };
 
@@ -126,7 +130,8 @@ namespace MMAP
         MapBuilder(Config* config,
                    int mapid,
                    char const* offMeshFilePath,
-                   unsigned int threads);
+                   unsigned int threads,
+                   uint32 memoryBudget = 0);
 
         ~MapBuilder();
 
@@ -140,8 +145,14 @@ namespace MMAP
 
         const Config& getConfig() const { return *m_config; }
     private:
-        // builds all mmap tiles for the specified map id (ignores skip settings)
-        void buildMap(uint32 mapID);
+        // collects all mmap tiles for the specified map id (ignores skip settings)
+        void buildMap(uint32 mapID, std::vector<TileInfo>& tileInfos);
+        uint64 estimateTileCost(uint32 mapID, uint32 tileX, uint32 tileY) const;
+
+        // tile queue shared by all workers, heaviest tiles first
+        bool popTile(TileInfo& tileInfo);
+        void releaseTile(TileInfo const& tileInfo);
+        void closeTileQueue();
         // detect maps and tiles
         void discoverTiles();
         std::set<uint32>* getTileList(uint32 mapID);
@@ -185,8 +196,14 @@ namespace MMAP
         rcContext* m_rcContext{nullptr};
 
         std::vector<TileBuilder*> m_tileBuilders;
-        ProducerConsumerQueue<TileInfo> _queue;
-        std::atomic<bool> _cancelationToken;
+
+        std::mutex m_tileQueueLock;
+        std::condition_variable m_tileQueueCondition;
+        std::deque<TileInfo> m_tileQueue;
+        bool m_tileQueueClosed{false};
+        // estimated intermediate memory allowed for the tiles being built, 0 for no limit
+        uint64 m_memoryBudget;
+        uint64 m_memoryReserved{0};
     };
 }
 
@@ -65,7 +65,8 @@ bool handleArgs(int argc, char** argv,
                 bool& silent,
                 char*& offMeshInputPath,
                 char*& file,
-                unsigned int& threads)
+                unsigned int& threads,
+                uint32& memoryBudget)
 {
     bool hasCustomConfigPath = false;
     char* param = nullptr;
@@ -87,6 +88,13 @@ bool handleArgs(int argc, char** argv,
                 return false;
             threads = static_cast<unsigned int>(std::max(0, atoi(param)));
         }
+        else if (strcmp(argv[i], "--memoryBudget") == 0)
+        {
+            param = argv[++i];
+            if (!param)
+                return false;
+            memoryBudget = static_cast<uint32>(std::max(0, atoi(param)));
+        }
         else if (strcmp(argv[i], "--file") == 0)
         {
             param = argv[++i];
@@ -171,6 +179,7 @@ int finish(const char* message, int returnValue)
 int main(int argc, char** argv)
 {
     unsigned int threads = std::thread::hardware_concurrency();
+    uint32 memoryBudget = 0;
     int mapnum = -1;
     int tileX = -1, tileY = -1;
     bool silent = false;
@@ -178,7 +187,7 @@ int main(int argc, char** argv)
     char* file = nullptr;
     std::string configFilePath = "mmaps-config.yaml";
     bool validParam = handleArgs(argc, argv, mapnum,
-                                 tileX, tileY, configFilePath, silent, offMeshInputPath, file, threads);
+                                 tileX, tileY, configFilePath, silent, offMeshInputPath, file, threads, memoryBudget);
 
     if (!validParam)
         return silent ? -1 : finish("You have specified invalid parameters", -1);
@@ -202,7 +211,7 @@ int main(int argc, char** argv)
     if (!checkDirectories(config->DataDirPath(), config->IsDebugOutputEnabled()))
         return silent ? -3 : finish("Press ENTER to close...", -3);
 
-    MapBuilder builder(&config.value(), mapnum, offMeshInputPath, threads);
+    MapBuilder builder(&config.value(), mapnum, offMeshInputPath, threads, memoryBudget);
 
     uint32 start = getMSTime();
     if (file)
@@ -22,6 +22,7 @@
 #include "ModelInstance.h"
 #include "PathCommon.h"
 #include "VMapMgr2.h"
+#include <algorithm>
 #include <vector>
 #include <map>
 
@@ -48,6 +49,7 @@ struct map_fileheader
 #define MAP_HEIGHT_NO_HEIGHT  0x0001
 #define MAP_HEIGHT_AS_INT16   0x0002
 #define MAP_HEIGHT_AS_INT8    0x0004
+#define MAP_HEIGHT_AS_CHUNKED_INT8 0x0010
 
 struct map_heightHeader
 {
@@ -84,7 +86,8 @@ namespace MMAP
 {
     static char const* const MAP_FILE_NAME_FORMAT  = "{}/{:03}{:02}{:02}.map";
 
-    uint32 const MAP_VERSION_MAGIC = 9;
+    uint32 const MAP_VERSION_MAGIC = 10;
+    uint32 const MAP_MIN_VERSION_MAGIC = 9;                 // oldest version still read, without per cell packed heights
 
     TerrainBuilder::TerrainBuilder(const std::string &dataDirPath, bool skipLiquid) :
                 m_skipLiquid (skipLiquid),
@@ -155,7 +158,7 @@ namespace MMAP
 
         map_fileheader fheader;
         if (fread(&fheader, sizeof(map_fileheader), 1, mapFile) != 1 ||
-                fheader.versionMagic != MAP_VERSION_MAGIC)
+                fheader.versionMagic < MAP_MIN_VERSION_MAGIC || fheader.versionMagic > MAP_VERSION_MAGIC)
         {
             fclose(mapFile);
             printf("%s is the wrong version, please extract new .map files\n", mapFileName.c_str());
@@ -233,6 +236,41 @@ namespace MMAP
                 for (int i = 0; i < V8_SIZE_SQ; ++i)
                     V8[i] = (float)v8[i] * heightMultiplier + hheader.gridHeight;
             }
+            else if (hheader.flags & MAP_HEIGHT_AS_CHUNKED_INT8)
+            {
+                // per cell base height and step, points on cell borders are stored by every cell they belong to
+                float chunkHeight[16 * 16];
+                float chunkMultiplier[16 * 16];
+                uint8 v9[16 * 16 * 9 * 9];
+                uint8 v8[16 * 16 * 8 * 8];
+                int count = 0;
+                count += fread(chunkHeight, sizeof(float), 16 * 16, mapFile);
+                count += fread(chunkMultiplier, sizeof(float), 16 * 16, mapFile);
+                count += fread(v9, sizeof(uint8), 16 * 16 * 9 * 9, mapFile);
+                count += fread(v8, sizeof(uint8), 16 * 16 * 8 * 8, mapFile);
+                int chunkedExpected = 2 * 16 * 16 + 16 * 16 * 9 * 9 + 16 * 16 * 8 * 8;
+                if (count != chunkedExpected)
+                    printf("TerrainBuilder::loadMap: Failed to read some data expected %d, read %d\n", chunkedExpected, count);
+
+                for (int i = 0; i < V9_SIZE_SQ; ++i)
+                {
+                    int row = i / V9_SIZE;
+                    int col = i % V9_SIZE;
+                    int chunkRow = std::min(row / 8, 15);
+                    int chunkCol = std::min(col / 8, 15);
+                    int chunk = chunkRow * 16 + chunkCol;
+                    int point = (row - chunkRow * 8) * 9 + col - chunkCol * 8;
+                    V9[i] = (float)v9[chunk * 9 * 9 + point] * chunkMultiplier[chunk] + chunkHeight[chunk];
+                }
+
+                for (int i = 0; i < V8_SIZE_SQ; ++i)
+                {
+                    int row = i / V8_SIZE;
+                    int col = i % V8_SIZE;
+                    int chunk = (row / 8) * 16 + col / 8;
+                    V8[i] = (float)v8[chunk * 8 * 8 + (row % 8) * 8 + col % 8] * chunkMultiplier[chunk] + chunkHeight[chunk];
+                }
+            }
             else
             {
                 int count = 0;
@@ -15,8 +15,12 @@
  * with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "TileAssembler.h"
 
@@ -24,23 +28,33 @@ int main(int argc, char* argv[])
 {
     std::string src = "Buildings";
     std::string dest = "vmaps";
+    unsigned int threads = std::thread::hardware_concurrency();
 
-    if (argc > 3)
+    std::vector<std::string> directories;
+    for (int i = 1; i < argc; ++i)
     {
-        std::cout << "usage: " << argv[0] << " <raw data dir> <vmap dest dir>" << std::endl;
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            threads = static_cast<unsigned int>(std::max(0, atoi(argv[++i])));
+        else
+            directories.emplace_back(argv[i]);
+    }
+
+    if (directories.size() > 2)
+    {
+        std::cout << "usage: " << argv[0] << " [--threads <count>] <raw data dir> <vmap dest dir>" << std::endl;
         return 1;
     }
     else
     {
-        if (argc > 1)
-            src = argv[1];
-        if (argc > 2)
-            dest = argv[2];
+        if (directories.size() > 0)
+            src = directories[0];
+        if (directories.size() > 1)
+            dest = directories[1];
     }
 
     std::cout << "using " << src << " as source directory and writing output to " << dest << std::endl;
 
-    VMAP::TileAssembler* ta = new VMAP::TileAssembler(src, dest);
+    VMAP::TileAssembler* ta = new VMAP::TileAssembler(src, dest, threads);
 
     if (!ta->convertWorld2())
     {
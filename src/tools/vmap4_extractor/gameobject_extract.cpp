@@ -21,7 +21,7 @@
 #include "vmapexport.h"
 #include <cstdio>
 
-bool ExtractSingleModel(std::string& fname)
+bool GetModelFileNames(std::string& fname, std::string& mpqName, std::string& plainName)
 {
     if (fname.length() < 4)
         return false;
@@ -36,15 +36,25 @@ bool ExtractSingleModel(std::string& fname)
     // >= 3.1.0 ADT MMDX section store filename.m2 filenames for corresponded .m2 file
     // nothing do
 
-    std::string originalName = fname;
+    mpqName = fname;
 
     char* name = GetPlainName((char*)fname.c_str());
     fixnamen(name, strlen(name));
     fixname2(name, strlen(name));
+    plainName = name;
+    return true;
+}
+
+bool ExtractSingleModel(std::string& fname)
+{
+    std::string originalName;
+    std::string plainName;
+    if (!GetModelFileNames(fname, originalName, plainName))
+        return false;
 
     std::string output(szWorkDirWmo);
     output += "/";
-    output += name;
+    output += plainName;
 
     if (FileExists(output.c_str()))
         return true;
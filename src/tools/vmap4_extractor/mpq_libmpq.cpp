@@ -16,11 +16,12 @@
  */
 
 #include "mpq_libmpq04.h"
+#include "mpq_prefetch.h"
 #include <algorithm>
 #include <cstdio>
 #include <deque>
 
-ArchiveSet gOpenArchives;
+thread_local ArchiveSet gOpenArchives;
 
 MPQArchive::MPQArchive(const char* filename)
 {
@@ -71,6 +72,15 @@ MPQFile::MPQFile(const char* filename):
     pointer(0),
     size(0)
 {
+    if (!MPQPrefetcher::Take(filename, buffer, size))
+        Load(filename, buffer, size);
+
+    eof = !buffer;
+}
+
+void MPQFile::Load(const char* filename, char*& buffer, libmpq__off_t& size)
+{
+    buffer = nullptr;
     for (auto & gOpenArchive : gOpenArchives)
     {
         mpq_archive* mpq_a = gOpenArchive->mpq_a;
@@ -84,8 +94,6 @@ MPQFile::MPQFile(const char* filename):
         if (size <= 1)
         {
             // printf("info: file %s has size %d; considered dummy file.\n", filename, size);
-            eof = true;
-            buffer = nullptr;
             return;
         }
         buffer = new char[size];
@@ -95,8 +103,6 @@ MPQFile::MPQFile(const char* filename):
         /*libmpq_file_getdata(&mpq_a, hash, fileno, (unsigned char*)buffer);*/
         return;
     }
-    eof = true;
-    buffer = nullptr;
 }
 
 std::size_t MPQFile::read(void* dest, std::size_t bytes)
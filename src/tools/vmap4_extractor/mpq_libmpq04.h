@@ -71,6 +71,9 @@ private:
 };
 typedef std::deque<MPQArchive*> ArchiveSet;
 
+// Archives of the calling thread, libmpq handles can't be shared between threads
+extern thread_local ArchiveSet gOpenArchives;
+
 class MPQFile
 {
     //MPQHANDLE handle;
@@ -85,6 +88,10 @@ class MPQFile
 public:
     MPQFile(const char* filename);    // filenames are not case sensitive
     ~MPQFile() { close(); }
+
+    // Decompresses a file from the archives of the calling thread, buffer is null when it can't be read
+    static void Load(const char* filename, char*& buffer, libmpq__off_t& size);
+
     std::size_t read(void* dest, std::size_t bytes);
     std::size_t getSize() { return size; }
     std::size_t getPos() { return pointer; }
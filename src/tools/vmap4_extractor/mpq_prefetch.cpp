@@ -0,0 +1,311 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mpq_prefetch.h"
+#include "adtfile.h"
+#include "mpq_libmpq04.h"
+#include "vmapexport.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace
+{
+    // Keeps at most that much decompressed data waiting for the extraction
+    constexpr std::size_t MaxCachedBytes = 512 * 1024 * 1024;
+    // and stays within a map of WDT and ADT files ahead of it
+    constexpr std::size_t MaxLookahead = 64 * 64 + 1;
+
+    struct CachedFile
+    {
+        enum
+        {
+            PENDING,    // being read by a prefetch thread
+            READY,
+            TAKEN       // handed to or opened by the extraction
+        } State = PENDING;
+        char* Buffer = nullptr;
+        libmpq__off_t Size = 0;
+    };
+
+    std::mutex s_lock;
+    std::condition_variable s_fileReady;
+    std::condition_variable s_progress;
+    std::unordered_map<std::string, CachedFile> s_files;
+    std::unordered_set<std::string> s_extractedFiles;   // models and wmos already read ahead, by extracted file name
+    std::size_t s_cachedBytes = 0;
+    std::size_t s_position = 0;
+    bool s_stopping = false;
+    bool s_running = false;
+    std::atomic<std::size_t> s_nextJob = 0;
+    std::vector<std::thread> s_threads;
+
+    bool ClaimExtractedFile(std::string const& plainName)
+    {
+        std::lock_guard<std::mutex> guard(s_lock);
+        return s_extractedFiles.insert(plainName).second;
+    }
+
+    // Reads a file unless it was already read or opened, the parser gets it before the extraction can change it
+    template<class Parser>
+    bool PrefetchFile(std::string const& filename, Parser&& parse)
+    {
+        {
+            std::lock_guard<std::mutex> guard(s_lock);
+            if (!s_files.try_emplace(filename).second)
+                return true;
+        }
+
+        char* buffer;
+        libmpq__off_t size = 0;
+        MPQFile::Load(filename.c_str(), buffer, size);
+        if (buffer)
+            parse(buffer, size);
+
+        {
+            std::lock_guard<std::mutex> guard(s_lock);
+            CachedFile& file = s_files[filename];
+            file.State = CachedFile::READY;
+            file.Buffer = buffer;
+            file.Size = size;
+            if (buffer)
+                s_cachedBytes += size;
+        }
+
+        s_fileReady.notify_all();
+        return buffer != nullptr;
+    }
+
+    bool PrefetchFile(std::string const& filename)
+    {
+        return PrefetchFile(filename, [](char const*, libmpq__off_t) { });
+    }
+
+    template<class Visitor>
+    void ForEachChunk(char const* data, libmpq__off_t size, Visitor&& visit)
+    {
+        for (libmpq__off_t pos = 0; pos + 8 <= size;)
+        {
+            char fourcc[5];
+            memcpy(fourcc, data + pos, 4);
+            flipcc(fourcc);
+            fourcc[4] = 0;
+
+            uint32 chunkSize;
+            memcpy(&chunkSize, data + pos + 4, 4);
+            pos += 8;
+            if (chunkSize > size - pos)
+                break;
+
+            visit(fourcc, data + pos, chunkSize);
+            pos += chunkSize;
+        }
+    }
+
+    // Zero terminated names of a MMDX, MWMO or MODN chunk
+    std::vector<std::string> GetChunkNames(char const* data, uint32 size)
+    {
+        std::vector<std::string> names;
+        for (char const* name = data; name < data + size; name += names.back().length() + 1)
+            names.emplace_back(name, strnlen(name, data + size - name));
+
+        return names;
+    }
+
+    void PrefetchModel(std::string path)
+    {
+        std::string mpqName;
+        std::string plainName;
+        if (!GetModelFileNames(path, mpqName, plainName) || !ClaimExtractedFile(plainName))
+            return;
+
+        PrefetchFile(mpqName);
+    }
+
+    void PrefetchWmo(std::string path)
+    {
+        std::string mpqName;
+        std::string plainName;
+        if (path.length() < 4 || !GetWmoFileNames(path, mpqName, plainName) || !ClaimExtractedFile(plainName))
+            return;
+
+        uint32 groupCount = 0;
+        std::vector<std::string> models;
+        PrefetchFile(mpqName, [&](char const* data, libmpq__off_t size)
+        {
+            ForEachChunk(data, size, [&](char const* fourcc, char const* chunk, uint32 chunkSize)
+            {
+                if (!strcmp(fourcc, "MOHD") && chunkSize >= 8)
+                    memcpy(&groupCount, chunk + 4, 4);
+                else if (!strcmp(fourcc, "MODN"))
+                    models = GetChunkNames(chunk, chunkSize);
+            });
+        });
+
+        for (std::string const& model : models)
+            PrefetchModel(model);
+
+        // group files are named after the fixed up path, like ExtractSingleWmo does
+        std::string const groupBaseName = path.substr(0, path.length() - 4);
+        for (uint32 i = 0; i < groupCount; ++i)
+        {
+            char groupFileName[1024];
+            snprintf(groupFileName, sizeof(groupFileName), "%s_%03u.wmo", groupBaseName.c_str(), i);
+            if (!PrefetchFile(groupFileName))
+                break;
+        }
+    }
+
+    void PrefetchMapFile(std::string const& filename)
+    {
+        std::vector<std::string> models;
+        std::vector<std::string> wmos;
+        PrefetchFile(filename, [&](char const* data, libmpq__off_t size)
+        {
+            ForEachChunk(data, size, [&](char const* fourcc, char const* chunk, uint32 chunkSize)
+            {
+                if (!strcmp(fourcc, "MMDX"))
+                    models = GetChunkNames(chunk, chunkSize);
+                else if (!strcmp(fourcc, "MWMO"))
+                    wmos = GetChunkNames(chunk, chunkSize);
+            });
+        });
+
+        for (std::string& model : models)
+        {
+            // ADTFile::init fixes up the whole path before the model name
+            fixnamen(&model[0], model.length());
+            char* plainName = GetPlainName(&model[0]);
+            fixname2(plainName, strlen(plainName));
+            PrefetchModel(model);
+        }
+
+        for (std::string const& wmo : wmos)
+            PrefetchWmo(wmo);
+    }
+
+    void PrefetchThread(std::vector<std::string> const& archiveNames, std::size_t jobCount, std::function<std::string(std::size_t)> const& jobFile)
+    {
+        for (std::string const& archiveName : archiveNames)
+        {
+            MPQArchive* archive = new MPQArchive(archiveName.c_str());
+            if (gOpenArchives.empty() || gOpenArchives.front() != archive)
+                delete archive;
+        }
+
+        for (std::size_t job = s_nextJob++; job < jobCount; job = s_nextJob++)
+        {
+            {
+                std::unique_lock<std::mutex> guard(s_lock);
+                s_progress.wait(guard, [job]() { return s_stopping || (job < s_position + MaxLookahead && s_cachedBytes < MaxCachedBytes); });
+                if (s_stopping)
+                    break;
+
+                // the extraction already went past it
+                if (job < s_position)
+                    continue;
+            }
+
+            PrefetchMapFile(jobFile(job));
+        }
+
+        for (MPQArchive* archive : gOpenArchives)
+            delete archive;
+        gOpenArchives.clear();
+    }
+}
+
+void MPQPrefetcher::Start(std::vector<std::string> const& archiveNames, uint32 threads, std::size_t jobCount, std::function<std::string(std::size_t)> jobFile)
+{
+    printf("Reading archives ahead with %u threads\n", threads);
+    s_running = true;
+    for (uint32 i = 0; i < threads; ++i)
+        s_threads.emplace_back([archiveNames, jobCount, jobFile]() { PrefetchThread(archiveNames, jobCount, jobFile); });
+}
+
+void MPQPrefetcher::Stop()
+{
+    if (!s_running)
+        return;
+
+    {
+        std::lock_guard<std::mutex> guard(s_lock);
+        s_stopping = true;
+    }
+
+    s_progress.notify_all();
+    for (std::thread& thread : s_threads)
+        thread.join();
+
+    // files read ahead which the extraction didn't need after all
+    for (auto& [filename, file] : s_files)
+        delete[] file.Buffer;
+
+    s_threads.clear();
+    s_files.clear();
+    s_extractedFiles.clear();
+    s_cachedBytes = 0;
+    s_running = false;
+}
+
+void MPQPrefetcher::SetPosition(std::size_t job)
+{
+    if (!s_running)
+        return;
+
+    {
+        std::lock_guard<std::mutex> guard(s_lock);
+        s_position = job;
+    }
+
+    s_progress.notify_all();
+}
+
+bool MPQPrefetcher::Take(char const* filename, char*& buffer, libmpq__off_t& size)
+{
+    if (!s_running)
+        return false;
+
+    std::unique_lock<std::mutex> guard(s_lock);
+    auto [itr, inserted] = s_files.try_emplace(filename);
+    CachedFile& file = itr->second;
+    if (inserted)
+    {
+        // not read ahead, and not worth reading anymore
+        file.State = CachedFile::TAKEN;
+        return false;
+    }
+
+    s_fileReady.wait(guard, [&file]() { return file.State != CachedFile::PENDING; });
+    if (file.State == CachedFile::TAKEN)
+        return false;
+
+    buffer = file.Buffer;
+    size = file.Size;
+    file.Buffer = nullptr;
+    file.State = CachedFile::TAKEN;
+    if (buffer)
+        s_cachedBytes -= size;
+
+    guard.unlock();
+    s_progress.notify_all();
+    return true;
+}
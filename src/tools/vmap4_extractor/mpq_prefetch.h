@@ -0,0 +1,51 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MPQ_PREFETCH_H
+#define MPQ_PREFETCH_H
+
+#include "libmpq/mpq.h"
+#include "loadlib/loadlib.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+/*
+ * Reads ahead the archive files the extraction is about to open.
+ *
+ * The extraction itself stays sequential: the order in which it appends to
+ * dir_bin, numbers the object ids and picks the first of several models with
+ * the same name is part of its output. The prefetch threads, each with its own
+ * archive handles, walk the same list of WDT and ADT files a bit ahead of it,
+ * decompress them with the models and WMOs they reference, and hand the
+ * buffers to the first MPQFile opening them.
+ */
+class MPQPrefetcher
+{
+public:
+    // jobFile gives the WDT or ADT file of each job, in the order the extraction opens them
+    static void Start(std::vector<std::string> const& archiveNames, uint32 threads, std::size_t jobCount, std::function<std::string(std::size_t)> jobFile);
+    static void Stop();
+
+    // Jobs before that one are done and no longer read ahead
+    static void SetPosition(std::size_t job);
+
+    // Takes the buffer of a file read ahead, waiting for it when it is being read; false when it has to be opened
+    static bool Take(char const* filename, char*& buffer, libmpq__off_t& size);
+};
+
+#endif
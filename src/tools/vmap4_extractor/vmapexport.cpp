@@ -16,11 +16,13 @@
  */
 
 #define _CRT_SECURE_NO_DEPRECATE
+#include <algorithm>
 #include <cerrno>
 #include <cstdio>
 #include <list>
 #include <map>
 #include <sys/stat.h>
+#include <thread>
 #include <vector>
 
 #ifdef WIN32
@@ -37,6 +39,7 @@
 #include "adtfile.h"
 #include "dbcfile.h"
 #include "mpq_libmpq04.h"
+#include "mpq_prefetch.h"
 #include "wdtfile.h"
 #include "wmo.h"
 
@@ -47,8 +50,6 @@
 
 //-----------------------------------------------------------------------------
 
-extern ArchiveSet gOpenArchives;
-
 typedef struct
 {
     char name[64];
@@ -61,6 +62,7 @@ char output_path[128] = ".";
 char input_path[1024] = ".";
 bool hasInputPathParam = false;
 bool preciseVectorData = false;
+uint32 extractThreads = 1;
 std::unordered_map<std::string, WMODoodadData> WmoDoodads;
 
 // Constants
@@ -95,19 +97,14 @@ void strToLower(char* str)
     }
 }
 
-bool ExtractSingleWmo(std::string& fname)
+bool GetWmoFileNames(std::string& fname, std::string& mpqName, std::string& plainName)
 {
-    // Copy files from archive
-    std::string originalName = fname;
+    mpqName = fname;
 
-    char szLocalFile[1024];
     char* plain_name = GetPlainName(&fname[0]);
     fixnamen(plain_name, strlen(plain_name));
     fixname2(plain_name, strlen(plain_name));
-    sprintf(szLocalFile, "%s/%s", szWorkDirWmo, plain_name);
-
-    if (FileExists(szLocalFile))
-        return true;
+    plainName = plain_name;
 
     int p = 0;
     // Select root wmo files
@@ -123,7 +120,25 @@ bool ExtractSingleWmo(std::string& fname)
         }
     }
 
-    if (p == 3)
+    return p != 3;
+}
+
+bool ExtractSingleWmo(std::string& fname)
+{
+    // Copy files from archive
+    std::string originalName;
+    std::string plainName;
+    bool const isRootWmo = GetWmoFileNames(fname, originalName, plainName);
+    char const* plain_name = plainName.c_str();
+
+    char szLocalFile[1024];
+    sprintf(szLocalFile, "%s/%s", szWorkDirWmo, plain_name);
+
+    if (FileExists(szLocalFile))
+        return true;
+
+    // group files are extracted with their root
+    if (!isRootWmo)
         return true;
 
     bool file_ok = true;
@@ -202,6 +217,22 @@ bool ExtractSingleWmo(std::string& fname)
     return true;
 }
 
+// Prefetch jobs follow ParsMapFiles, the WDT of each map and then the 64x64 grid of its ADTs
+constexpr std::size_t MapFileJobsPerMap = 1 + 64 * 64;
+
+std::string GetMapFileJob(std::size_t job)
+{
+    map_id const& map = map_ids[job / MapFileJobsPerMap];
+    int const tile = int(job % MapFileJobsPerMap) - 1;
+
+    char fn[512];
+    if (tile < 0)
+        snprintf(fn, sizeof(fn), "World\\Maps\\%s\\%s.wdt", map.name, map.name);
+    else
+        snprintf(fn, sizeof(fn), R"(World\Maps\%s\%s_%d_%d.adt)", map.name, map.name, tile / 64, tile % 64);
+    return fn;
+}
+
 void ParsMapFiles()
 {
     char fn[512];
@@ -226,9 +257,11 @@ void ParsMapFiles()
                 }
                 printf("#");
                 fflush(stdout);
+                MPQPrefetcher::SetPosition(i * MapFileJobsPerMap + 1 + (x + 1) * 64);
             }
             printf("]\n");
         }
+        MPQPrefetcher::SetPosition((i + 1) * MapFileJobsPerMap);
     }
 }
 
@@ -397,6 +430,20 @@ bool processArgv(int argc, char** argv, const char* versionString)
         {
             preciseVectorData = true;
         }
+        else if (strcmp("-t", argv[i]) == 0 || strcmp("--threads", argv[i]) == 0)
+        {
+            if ((i + 1) < argc)
+            {
+                extractThreads = atoi(argv[i + 1]);
+                if (!extractThreads)
+                    extractThreads = std::max(std::thread::hardware_concurrency(), 1u);
+                ++i;
+            }
+            else
+            {
+                result = false;
+            }
+        }
         else
         {
             result = false;
@@ -406,10 +453,11 @@ bool processArgv(int argc, char** argv, const char* versionString)
     if (!result)
     {
         printf("Extract %s.\n", versionString);
-        printf("%s [-?][-s][-l][-d <path>]\n", argv[0]);
+        printf("%s [-?][-s][-l][-d <path>][-t|--threads <count>]\n", argv[0]);
         printf("   -s : (default) small size (data size optimization), ~500MB less vmap data.\n");
         printf("   -l : large size, ~500MB more vmap data. (might contain more details)\n");
         printf("   -d <path>: Path to the vector data source folder.\n");
+        printf("   -t, --threads <count>: Threads, all but one read the archives ahead of the extraction. 0 uses all cores, 1 by default.\n");
         printf("   -? : This message.\n");
     }
     return result;
@@ -506,7 +554,13 @@ int main(int argc, char** argv)
         }
 
         delete dbc;
+
+        // the output depends on the order of the extraction, only the reading of the archives runs in parallel
+        if (extractThreads > 1)
+            MPQPrefetcher::Start(archiveNames, extractThreads - 1, map_count * MapFileJobsPerMap, GetMapFileJob);
+
         ParsMapFiles();
+        MPQPrefetcher::Stop();
         //nError = ERROR_SUCCESS;
         // Extract models, listed in DameObjectDisplayInfo.dbc
         ExtractGameobjectModels();
@@ -45,6 +45,11 @@ uint32 GenerateUniqueObjectId(uint32 clientId, uint16 clientDoodadId);
 bool FileExists(const char* file);
 void strToLower(char* str);
 
+// Fix up the client path in place like the extraction does, returning the name to read from the archives
+// and the name of the extracted file; false when the path isn't extracted on its own
+bool GetWmoFileNames(std::string& fname, std::string& mpqName, std::string& plainName);
+bool GetModelFileNames(std::string& fname, std::string& mpqName, std::string& plainName);
+
 bool ExtractSingleWmo(std::string& fname);
 bool ExtractSingleModel(std::string& fname);
 